@@ -0,0 +1,245 @@
+/*
+ * LBEAST Firmware Templates - Host Unit Test
+ *
+ * Builds a sketch-shaped program against the wireless and scheduler templates on Linux
+ * (LBEAST_HostShim.h) and checks packet dispatch, handler fallback, safety dedupe, held
+ * batches, TX encoding and scheduler timing against the mock clock.
+ *
+ * Build and run: make test
+ *
+ * Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+ */
+
+// Both directions in one sketch, as the ECU examples do
+#include "LBEAST_Wireless_RX.h"
+#include "LBEAST_Wireless_TX.h"
+#include "LBEAST_Scheduler.h"
+
+static int Failures = 0;
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+      Failures++; \
+    } \
+  } while (0)
+
+// =====================================
+// Sketch handlers (Int32/String/Bytes left to the defaults)
+// =====================================
+
+static int BoolCalls = 0;
+static uint8_t LastBoolChannel = 0;
+static bool LastBoolValue = false;
+static uint8_t BoolChannelLog[16];
+static int FloatCalls = 0;
+static float LastFloatValue = 0.0f;
+
+void LBEAST_HandleBool(uint8_t channel, bool value) {
+  if (BoolCalls < (int)sizeof(BoolChannelLog)) {
+    BoolChannelLog[BoolCalls] = channel;
+  }
+  BoolCalls++;
+  LastBoolChannel = channel;
+  LastBoolValue = value;
+}
+
+void LBEAST_HandleFloat(uint8_t channel, float value) {
+  (void)channel;
+  FloatCalls++;
+  LastFloatValue = value;
+}
+
+static void ResetHandlers() {
+  BoolCalls = 0;
+  LastBoolChannel = 0;
+  LastBoolValue = false;
+  FloatCalls = 0;
+  LastFloatValue = 0.0f;
+}
+
+/** Append the CRC and inject as if received from the server */
+static void Inject(uint8_t* packet, int lengthWithoutCRC) {
+  packet[lengthWithoutCRC] = LBEAST_CalculateCRC(packet, lengthWithoutCRC);
+  LBEAST_UDP.injectPacket(packet, lengthWithoutCRC + 1);
+}
+
+// =====================================
+// Tests
+// =====================================
+
+static void TestDispatchAndFallback() {
+  ResetHandlers();
+  uint8_t boolPacket[5] = { LBEAST_PACKET_START_MARKER, LBEAST_TYPE_BOOL, 3, 1, 0 };
+  Inject(boolPacket, 4);
+  uint8_t intPacket[8] = { LBEAST_PACKET_START_MARKER, LBEAST_TYPE_INT32, 4, 42, 0, 0, 0, 0 };
+  Inject(intPacket, 7);
+
+  CHECK(LBEAST_ProcessIncoming() == 2);
+  CHECK(BoolCalls == 1);
+  CHECK(LastBoolChannel == 3);
+  CHECK(LastBoolValue);
+  CHECK(LBEAST_HandleInt32 == nullptr);  // Not implemented here, default logger ran
+
+  uint8_t corrupt[5] = { LBEAST_PACKET_START_MARKER, LBEAST_TYPE_BOOL, 3, 0, 0x55 };
+  CHECK(!LBEAST_ProcessPacket(corrupt, sizeof(corrupt)));
+  CHECK(BoolCalls == 1);
+}
+
+static void TestSafetyDedupe() {
+  ResetHandlers();
+  LBEAST_UDP.sentPackets.clear();
+  uint8_t safety[7] = { LBEAST_PACKET_START_MARKER, LBEAST_TYPE_SAFETY, 7, 0x10, 0x00, 1, 0 };
+  Inject(safety, 6);
+  LBEAST_UDP.injectPacket(safety, sizeof(safety));  // Redundant copy
+
+  LBEAST_ProcessIncoming();
+  CHECK(BoolCalls == 1);
+  CHECK(LastBoolChannel == 7);
+  CHECK(LBEAST_UDP.sentPackets.size() == 2);  // Every copy is acknowledged
+
+  // A newer sequence acts again
+  safety[3] = 0x11;
+  safety[5] = 0;
+  Inject(safety, 6);
+  LBEAST_ProcessIncoming();
+  CHECK(BoolCalls == 2);
+  CHECK(!LastBoolValue);
+
+  // Retransmits keep arriving until the server gives up (5 s); none of them act again
+  for (int i = 0; i < 6; i++) {
+    LBEAST_Host_AdvanceMicros(1000000);
+    Inject(safety, 6);
+    LBEAST_ProcessIncoming();
+  }
+  CHECK(BoolCalls == 2);
+
+  // Once the channel has been quiet past the window, history is dropped (server restart)
+  LBEAST_Host_AdvanceMicros((LBEAST_SAFETY_SEQ_WINDOW_MS + 1) * 1000UL);
+  Inject(safety, 6);
+  LBEAST_ProcessIncoming();
+  CHECK(BoolCalls == 3);
+}
+
+static void TestHeldBatch() {
+  ResetHandlers();
+  float target = 0.5f;
+  uint32_t bits;
+  memcpy(&bits, &target, sizeof(bits));
+  // Fire delay 20 ms, 2 entries: bool ch1 = 1, float ch2 = 0.5
+  uint8_t batch[16] = { LBEAST_PACKET_START_MARKER, LBEAST_TYPE_BATCH, 0, 20, 0, 2,
+                        LBEAST_TYPE_BOOL, 1, 1,
+                        LBEAST_TYPE_FLOAT, 2, (uint8_t)bits, (uint8_t)(bits >> 8), (uint8_t)(bits >> 16), (uint8_t)(bits >> 24), 0 };
+  Inject(batch, 15);
+
+  LBEAST_ProcessIncoming();
+  CHECK(BoolCalls == 0);
+  CHECK(FloatCalls == 0);
+
+  LBEAST_Host_AdvanceMicros(19000);
+  LBEAST_ProcessIncoming();
+  CHECK(BoolCalls == 0);
+
+  LBEAST_Host_AdvanceMicros(1000);
+  LBEAST_ProcessIncoming();
+  CHECK(BoolCalls == 1);
+  CHECK(FloatCalls == 1);
+  CHECK(LastFloatValue == 0.5f);
+}
+
+/** Held one-entry batch setting bool `channel` after `fireDelayMs` */
+static void InjectHeldBool(uint8_t channel, uint16_t fireDelayMs) {
+  uint8_t batch[10] = { LBEAST_PACKET_START_MARKER, LBEAST_TYPE_BATCH, 0, (uint8_t)fireDelayMs, (uint8_t)(fireDelayMs >> 8), 1,
+                        LBEAST_TYPE_BOOL, channel, 1, 0 };
+  Inject(batch, 9);
+}
+
+static void TestHeldBatchTableFull() {
+  ResetHandlers();
+  // Fill every slot, latest fire time first so slot order and fire order differ
+  for (int i = 0; i < LBEAST_PENDING_BATCHES; i++) {
+    InjectHeldBool((uint8_t)(10 + i), (uint16_t)(50 - 10 * i));
+  }
+  LBEAST_ProcessIncoming();
+  CHECK(BoolCalls == 0);
+
+  // One more: the earliest-due held batch is applied early, the new one is still held
+  InjectHeldBool(20, 60);
+  LBEAST_ProcessIncoming();
+  CHECK(BoolCalls == 1);
+  CHECK(BoolChannelLog[0] == 10 + LBEAST_PENDING_BATCHES - 1);
+
+  // Everything else fires in fire-time order, the newest batch last
+  LBEAST_Host_AdvanceMicros(60000);
+  LBEAST_ProcessIncoming();
+  CHECK(BoolCalls == LBEAST_PENDING_BATCHES + 1);
+  for (int i = 1; i < LBEAST_PENDING_BATCHES; i++) {
+    CHECK(BoolChannelLog[i] == 10 + LBEAST_PENDING_BATCHES - 1 - i);
+  }
+  CHECK(BoolChannelLog[LBEAST_PENDING_BATCHES] == 20);
+}
+
+static void TestTxRoundTrip() {
+  ResetHandlers();
+  LBEAST_UDP.sentPackets.clear();
+  LBEAST_SendFloat(9, -1.25f);
+  CHECK(LBEAST_UDP.sentPackets.size() == 1);
+  if (LBEAST_UDP.sentPackets.size() == 1) {
+    std::vector<uint8_t> packet = LBEAST_UDP.sentPackets[0].data;
+    CHECK(packet.size() == 8);
+    CHECK(LBEAST_ProcessPacket(packet.data(), (int)packet.size()));
+    CHECK(FloatCalls == 1);
+    CHECK(LastFloatValue == -1.25f);
+  }
+
+  // Oversized strings are clipped to what fits one packet
+  LBEAST_UDP.sentPackets.clear();
+  char longString[300];
+  memset(longString, 'x', sizeof(longString) - 1);
+  longString[sizeof(longString) - 1] = '\0';
+  LBEAST_SendString(1, longString);
+  CHECK(LBEAST_UDP.sentPackets.size() == 1);
+  if (LBEAST_UDP.sentPackets.size() == 1) {
+    CHECK(LBEAST_UDP.sentPackets[0].data.size() == 256);
+  }
+}
+
+static int SchedulerRuns = 0;
+
+static void CountRun(void*) {
+  SchedulerRuns++;
+}
+
+static void TestScheduler() {
+  LBEASTScheduler scheduler;
+  int task = scheduler.addPeriodic("Count", 1000, CountRun);
+  for (int i = 0; i < 100; i++) {
+    scheduler.runOnce();
+    LBEAST_Host_AdvanceMicros(100);
+  }
+  CHECK(SchedulerRuns == 10);
+  CHECK(scheduler.getStats(task).missedPeriods == 0);
+}
+
+int main() {
+  LBEAST_Host_SetMockMicros(0);
+  LBEAST_UDP.recordSentPackets = true;
+  LBEAST_TargetIP = IPAddress(127, 0, 0, 1);
+  LBEAST_TargetPort = 9;  // Discard; packets are inspected via sentPackets
+  LBEAST_Initialized = true;
+
+  TestDispatchAndFallback();
+  TestSafetyDedupe();
+  TestHeldBatch();
+  TestHeldBatchTableFull();
+  TestTxRoundTrip();
+  TestScheduler();
+
+  if (Failures > 0) {
+    printf("%d check(s) failed\n", Failures);
+    return 1;
+  }
+  printf("All template host tests passed\n");
+  return 0;
+}
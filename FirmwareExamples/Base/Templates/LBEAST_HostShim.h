@@ -0,0 +1,299 @@
+/*
+ * LBEAST Host Shim
+ *
+ * Minimal Arduino API surface for compiling LBEAST firmware templates on a Linux
+ * host (unit tests, CI, and running sketch logic against the Virtual ECU tools).
+ * Included automatically by the templates when ARDUINO is not defined.
+ *
+ * Provides:
+ * - micros() / millis() / delay() backed by a mockable clock
+ * - Serial (print / println / printf to stdout)
+ * - IPAddress, WiFi (always connected on loopback)
+ * - WiFiUDP over POSIX sockets, plus an injection queue for mocked traffic
+ *
+ * Mocked clock:
+ *   LBEAST_Host_SetMockMicros(0);       // freeze time at 0
+ *   LBEAST_Host_AdvanceMicros(1000);    // step 1 ms
+ *   LBEAST_Host_UseRealClock();         // back to steady_clock
+ *
+ * Mocked UDP:
+ *   LBEAST_UDP.injectPacket(bytes, len);  // next parsePacket() returns this
+ *   LBEAST_UDP.sentPackets                // everything written via endPacket()
+ *
+ * Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+ */
+
+#ifndef LBEAST_HOST_SHIM_H
+#define LBEAST_HOST_SHIM_H
+
+#if defined(ARDUINO)
+  #error "LBEAST_HostShim.h is for host builds only"
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using std::max;
+using std::min;
+
+// =====================================
+// Clock
+// =====================================
+
+struct LBEASTHostClock {
+  bool mocked = false;
+  uint64_t mockMicros = 0;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+};
+
+inline LBEASTHostClock& LBEAST_Host_Clock() {
+  static LBEASTHostClock clock;
+  return clock;
+}
+
+inline void LBEAST_Host_SetMockMicros(uint64_t us) {
+  LBEAST_Host_Clock().mocked = true;
+  LBEAST_Host_Clock().mockMicros = us;
+}
+
+inline void LBEAST_Host_AdvanceMicros(uint64_t us) {
+  LBEAST_Host_Clock().mocked = true;
+  LBEAST_Host_Clock().mockMicros += us;
+}
+
+inline void LBEAST_Host_UseRealClock() {
+  LBEAST_Host_Clock().mocked = false;
+}
+
+inline unsigned long micros() {
+  LBEASTHostClock& clock = LBEAST_Host_Clock();
+  if (clock.mocked) return (unsigned long)(uint32_t)clock.mockMicros;
+  return (unsigned long)(uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - clock.start).count();
+}
+
+inline unsigned long millis() {
+  LBEASTHostClock& clock = LBEAST_Host_Clock();
+  if (clock.mocked) return (unsigned long)(uint32_t)(clock.mockMicros / 1000);
+  return (unsigned long)(uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+    std::chrono::steady_clock::now() - clock.start).count();
+}
+
+inline void delay(unsigned long ms) {
+  if (LBEAST_Host_Clock().mocked) {
+    LBEAST_Host_AdvanceMicros((uint64_t)ms * 1000);
+  } else {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+  }
+}
+
+// =====================================
+// Serial
+// =====================================
+
+class LBEASTHostSerial {
+public:
+  void begin(unsigned long) {}
+  void print(const char* text) { fputs(text, stdout); }
+  void print(int value) { printf("%d", value); }
+  void println(const char* text = "") { puts(text); }
+  void println(int value) { printf("%d\n", value); }
+  void printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    va_list args;
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+  }
+};
+
+inline LBEASTHostSerial& LBEAST_Host_Serial() {
+  static LBEASTHostSerial serial;
+  return serial;
+}
+
+#define Serial LBEAST_Host_Serial()
+
+// =====================================
+// IPAddress / WiFi
+// =====================================
+
+class IPAddress {
+public:
+  IPAddress() { memset(octets, 0, sizeof(octets)); }
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) { octets[0] = a; octets[1] = b; octets[2] = c; octets[3] = d; }
+  explicit IPAddress(in_addr address) { memcpy(octets, &address.s_addr, 4); }
+
+  bool operator==(const IPAddress& other) const { return memcmp(octets, other.octets, 4) == 0; }
+  bool operator!=(const IPAddress& other) const { return !(*this == other); }
+  uint8_t operator[](int index) const { return octets[index]; }
+
+  in_addr toInAddr() const {
+    in_addr address;
+    memcpy(&address.s_addr, octets, 4);
+    return address;
+  }
+
+  std::string toString() const {
+    char text[16];
+    snprintf(text, sizeof(text), "%u.%u.%u.%u", octets[0], octets[1], octets[2], octets[3]);
+    return text;
+  }
+
+private:
+  uint8_t octets[4];
+};
+
+#define WL_CONNECTED 3
+
+class LBEASTHostWiFi {
+public:
+  void begin(const char*, const char*) {}
+  int status() const { return WL_CONNECTED; }
+  IPAddress localIP() const { return IPAddress(127, 0, 0, 1); }
+};
+
+inline LBEASTHostWiFi& LBEAST_Host_WiFi() {
+  static LBEASTHostWiFi wifi;
+  return wifi;
+}
+
+#define WiFi LBEAST_Host_WiFi()
+
+// =====================================
+// WiFiUDP
+// =====================================
+
+class WiFiUDP {
+public:
+  struct Datagram {
+    std::vector<uint8_t> data;
+    IPAddress address;
+    uint16_t port = 0;
+  };
+
+  /** Packets written via beginPacket/write/endPacket (mock inspection) */
+  std::vector<Datagram> sentPackets;
+
+  /** Keep sent packets in memory instead of (or in addition to) the socket */
+  bool recordSentPackets = false;
+
+  ~WiFiUDP() { stop(); }
+
+  uint8_t begin(uint16_t port) {
+    stop();
+    fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) return 0;
+    int reuse = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    sockaddr_in local;
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_port = htons(port);
+    local.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(fd, (sockaddr*)&local, sizeof(local)) != 0) {
+      stop();
+      return 0;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    return 1;
+  }
+
+  void stop() {
+    if (fd >= 0) close(fd);
+    fd = -1;
+  }
+
+  /** Queue a datagram that parsePacket() will return before reading the socket */
+  void injectPacket(const uint8_t* data, size_t length, IPAddress from = IPAddress(127, 0, 0, 1), uint16_t fromPort = 8888) {
+    Datagram datagram;
+    datagram.data.assign(data, data + length);
+    datagram.address = from;
+    datagram.port = fromPort;
+    injected.push_back(datagram);
+  }
+
+  int parsePacket() {
+    current.data.clear();
+    readOffset = 0;
+
+    if (!injected.empty()) {
+      current = injected.front();
+      injected.pop_front();
+      return (int)current.data.size();
+    }
+
+    if (fd < 0) return 0;
+    uint8_t buffer[2048];
+    sockaddr_in sender;
+    socklen_t senderLength = sizeof(sender);
+    ssize_t received = recvfrom(fd, buffer, sizeof(buffer), 0, (sockaddr*)&sender, &senderLength);
+    if (received <= 0) return 0;
+    current.data.assign(buffer, buffer + received);
+    current.address = IPAddress(sender.sin_addr);
+    current.port = ntohs(sender.sin_port);
+    return (int)received;
+  }
+
+  int read(uint8_t* buffer, size_t length) {
+    size_t available = current.data.size() - readOffset;
+    size_t count = min(length, available);
+    memcpy(buffer, current.data.data() + readOffset, count);
+    readOffset += count;
+    return (int)count;
+  }
+
+  IPAddress remoteIP() const { return current.address; }
+  uint16_t remotePort() const { return current.port; }
+
+  int beginPacket(IPAddress address, uint16_t port) {
+    outgoing.data.clear();
+    outgoing.address = address;
+    outgoing.port = port;
+    return 1;
+  }
+
+  size_t write(const uint8_t* data, size_t length) {
+    outgoing.data.insert(outgoing.data.end(), data, data + length);
+    return length;
+  }
+
+  int endPacket() {
+    if (recordSentPackets) sentPackets.push_back(outgoing);
+    if (fd < 0) {
+      // Unbound sockets (TX-only templates) still send from an ephemeral port
+      fd = socket(AF_INET, SOCK_DGRAM, 0);
+      if (fd < 0) return recordSentPackets ? 1 : 0;
+      fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    }
+    sockaddr_in target;
+    memset(&target, 0, sizeof(target));
+    target.sin_family = AF_INET;
+    target.sin_port = htons(outgoing.port);
+    target.sin_addr = outgoing.address.toInAddr();
+    ssize_t sent = sendto(fd, outgoing.data.data(), outgoing.data.size(), 0, (sockaddr*)&target, sizeof(target));
+    return (sent == (ssize_t)outgoing.data.size() || recordSentPackets) ? 1 : 0;
+  }
+
+private:
+  int fd = -1;
+  std::deque<Datagram> injected;
+  Datagram current;
+  size_t readOffset = 0;
+  Datagram outgoing;
+};
+
+#endif // LBEAST_HOST_SHIM_H
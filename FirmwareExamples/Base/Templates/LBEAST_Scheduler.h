@@ -0,0 +1,271 @@
+/*
+ * LBEAST Cooperative Scheduler Template
+ *
+ * Header-only, non-blocking task scheduler for ECU firmware.
+ * Replaces the `loop() { ...; delay(10); }` pattern so control loops can run at
+ * 1 kHz while networking and telemetry run at their own rates, and a slow
+ * Serial.printf or UDP send no longer delays everything else.
+ *
+ * Features:
+ * - Fixed-rate periodic tasks (phase-locked, no drift from task runtime)
+ * - Idle tasks that run on every pass (e.g. drain-all-packets receive)
+ * - Deadline tracking per task (lateness, runtime, overrun counters)
+ * - Missed-period detection without catch-up bursts
+ * - Runtime period changes (e.g. server-controlled telemetry intervals)
+ * - Injectable clock so the same code compiles and runs on a Linux host
+ *   (see LBEAST_HostShim.h) with a mocked clock
+ *
+ * Usage:
+ *   #include "LBEAST_Wireless_RX.h"
+ *   #include "LBEAST_Scheduler.h"
+ *
+ *   LBEASTScheduler scheduler;
+ *
+ *   void ControlTask(void*) { liftController.update(); }
+ *   void ReceiveTask(void*) { LBEAST_ProcessIncoming(); }
+ *
+ *   void setup() {
+ *     scheduler.addIdle("rx", ReceiveTask);
+ *     scheduler.addPeriodic("control", 1000, ControlTask);  // 1 kHz
+ *   }
+ *
+ *   void loop() {
+ *     scheduler.runOnce();
+ *   }
+ *
+ * Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+ */
+
+#ifndef LBEAST_SCHEDULER_H
+#define LBEAST_SCHEDULER_H
+
+#if defined(ARDUINO)
+  #include <Arduino.h>
+#else
+  #include "LBEAST_HostShim.h"
+#endif
+
+#include <stdint.h>
+
+// Maximum number of tasks per scheduler (fixed storage, no heap allocation)
+#ifndef LBEAST_SCHEDULER_MAX_TASKS
+  #define LBEAST_SCHEDULER_MAX_TASKS 16
+#endif
+
+typedef void (*LBEASTTaskFn)(void* context);
+typedef uint32_t (*LBEASTClockFn)();
+
+/**
+ * Per-task timing statistics
+ * All times in microseconds.
+ */
+struct LBEASTTaskStats {
+  const char* name;
+  uint32_t periodUs;        // 0 = idle task (runs every pass)
+  uint32_t deadlineUs;      // Max allowed runtime + lateness before counting an overrun
+  uint32_t runs;            // Number of executions
+  uint32_t overruns;        // Executions that finished after their deadline
+  uint32_t missedPeriods;   // Periods skipped because the scheduler fell behind
+  uint32_t lastRuntimeUs;
+  uint32_t maxRuntimeUs;
+  uint32_t maxLatenessUs;   // Worst start delay relative to the scheduled time
+};
+
+class LBEASTScheduler {
+public:
+  LBEASTScheduler() : taskCount(0) {}
+
+  /**
+   * Add a fixed-rate periodic task
+   * @param name Task name (for stats output, must outlive the scheduler)
+   * @param periodUs Period in microseconds (e.g. 1000 for 1 kHz)
+   * @param fn Task function
+   * @param context Passed to fn
+   * @param deadlineUs Deadline relative to the scheduled start (0 = one period)
+   * @return Task ID, or -1 if the task table is full
+   */
+  int addPeriodic(const char* name, uint32_t periodUs, LBEASTTaskFn fn, void* context = nullptr, uint32_t deadlineUs = 0) {
+    if (taskCount >= LBEAST_SCHEDULER_MAX_TASKS || fn == nullptr) return -1;
+    Task& task = tasks[taskCount];
+    task.fn = fn;
+    task.context = context;
+    task.enabled = true;
+    task.nextDueUs = now();
+    resetTaskStats(task, name, periodUs, deadlineUs ? deadlineUs : periodUs);
+    return taskCount++;
+  }
+
+  /**
+   * Add an idle task that runs on every scheduler pass (e.g. packet receive)
+   * @param deadlineUs Max runtime before counting an overrun (0 = never)
+   */
+  int addIdle(const char* name, LBEASTTaskFn fn, void* context = nullptr, uint32_t deadlineUs = 0) {
+    int id = addPeriodic(name, 0, fn, context, 0);
+    if (id >= 0) tasks[id].stats.deadlineUs = deadlineUs;
+    return id;
+  }
+
+  /**
+   * Change a task's period at runtime (takes effect from the next execution)
+   */
+  void setPeriod(int id, uint32_t periodUs) {
+    if (!isValid(id)) return;
+    Task& task = tasks[id];
+    bool deadlineFollowsPeriod = (task.stats.deadlineUs == task.stats.periodUs);
+    task.stats.periodUs = periodUs;
+    if (deadlineFollowsPeriod) task.stats.deadlineUs = periodUs;
+    task.nextDueUs = now() + periodUs;
+  }
+
+  /**
+   * Enable or disable a task (disabled tasks keep their stats)
+   */
+  void setEnabled(int id, bool enabled) {
+    if (!isValid(id)) return;
+    if (enabled && !tasks[id].enabled) tasks[id].nextDueUs = now();
+    tasks[id].enabled = enabled;
+  }
+
+  /**
+   * Run every task that is due. Call from loop() with no delay().
+   * @return Microseconds until the next periodic task is due (0 if idle tasks exist)
+   */
+  uint32_t runOnce() {
+    bool hasIdle = false;
+
+    for (int i = 0; i < taskCount; i++) {
+      Task& task = tasks[i];
+      if (!task.enabled) continue;
+
+      uint32_t startUs = now();
+
+      if (task.stats.periodUs == 0) {
+        hasIdle = true;
+        execute(task, startUs, startUs);
+        continue;
+      }
+
+      if (!isDue(task.nextDueUs, startUs)) continue;
+
+      uint32_t dueUs = task.nextDueUs;
+      execute(task, dueUs, startUs);
+
+      // Phase-locked: next slot is relative to the schedule, not to when we ran
+      task.nextDueUs = dueUs + task.stats.periodUs;
+      uint32_t afterUs = now();
+      if (isDue(task.nextDueUs, afterUs)) {
+        // Fell behind by at least one full period: skip slots instead of bursting
+        uint32_t behindUs = afterUs - task.nextDueUs;
+        uint32_t skipped = behindUs / task.stats.periodUs + 1;
+        task.stats.missedPeriods += skipped;
+        task.nextDueUs += skipped * task.stats.periodUs;
+      }
+    }
+
+    return hasIdle ? 0 : timeUntilNextDue();
+  }
+
+  /**
+   * Microseconds until the next enabled periodic task is due
+   */
+  uint32_t timeUntilNextDue() const {
+    uint32_t nowUs = now();
+    uint32_t best = 0xFFFFFFFFu;
+    for (int i = 0; i < taskCount; i++) {
+      const Task& task = tasks[i];
+      if (!task.enabled || task.stats.periodUs == 0) continue;
+      if (isDue(task.nextDueUs, nowUs)) return 0;
+      uint32_t wait = task.nextDueUs - nowUs;
+      if (wait < best) best = wait;
+    }
+    return best;
+  }
+
+  int getTaskCount() const { return taskCount; }
+
+  const LBEASTTaskStats& getStats(int id) const { return tasks[isValid(id) ? id : 0].stats; }
+
+  /**
+   * Reset all counters (e.g. after boot or a reconfiguration)
+   */
+  void resetStats() {
+    for (int i = 0; i < taskCount; i++) {
+      Task& task = tasks[i];
+      resetTaskStats(task, task.stats.name, task.stats.periodUs, task.stats.deadlineUs);
+    }
+  }
+
+  /**
+   * Print a stats table to Serial
+   */
+  void printStats() const {
+    Serial.println("LBEAST Scheduler: task        period_us  runs  overruns  missed  last_us  max_us  max_late_us");
+    for (int i = 0; i < taskCount; i++) {
+      const LBEASTTaskStats& s = tasks[i].stats;
+      Serial.printf("LBEAST Scheduler: %-12s %9lu %5lu %9lu %7lu %8lu %7lu %12lu\n",
+        s.name ? s.name : "?", (unsigned long)s.periodUs, (unsigned long)s.runs, (unsigned long)s.overruns,
+        (unsigned long)s.missedPeriods, (unsigned long)s.lastRuntimeUs, (unsigned long)s.maxRuntimeUs,
+        (unsigned long)s.maxLatenessUs);
+    }
+  }
+
+  /**
+   * Override the microsecond clock (host builds / unit tests). nullptr restores the default.
+   */
+  static void setClock(LBEASTClockFn clockFn) { clockOverride() = clockFn; }
+
+  static uint32_t now() {
+    LBEASTClockFn clockFn = clockOverride();
+    return clockFn ? clockFn() : (uint32_t)micros();
+  }
+
+private:
+  struct Task {
+    LBEASTTaskFn fn;
+    void* context;
+    bool enabled;
+    uint32_t nextDueUs;
+    LBEASTTaskStats stats;
+  };
+
+  Task tasks[LBEAST_SCHEDULER_MAX_TASKS];
+  int taskCount;
+
+  static LBEASTClockFn& clockOverride() {
+    static LBEASTClockFn clockFn = nullptr;
+    return clockFn;
+  }
+
+  bool isValid(int id) const { return id >= 0 && id < taskCount; }
+
+  // Wrap-safe comparison (micros() wraps every ~71 minutes)
+  static bool isDue(uint32_t dueUs, uint32_t nowUs) { return (int32_t)(nowUs - dueUs) >= 0; }
+
+  static void resetTaskStats(Task& task, const char* name, uint32_t periodUs, uint32_t deadlineUs) {
+    task.stats.name = name;
+    task.stats.periodUs = periodUs;
+    task.stats.deadlineUs = deadlineUs;
+    task.stats.runs = 0;
+    task.stats.overruns = 0;
+    task.stats.missedPeriods = 0;
+    task.stats.lastRuntimeUs = 0;
+    task.stats.maxRuntimeUs = 0;
+    task.stats.maxLatenessUs = 0;
+  }
+
+  void execute(Task& task, uint32_t dueUs, uint32_t startUs) {
+    task.fn(task.context);
+    uint32_t endUs = now();
+
+    LBEASTTaskStats& s = task.stats;
+    uint32_t lateness = startUs - dueUs;
+    uint32_t runtime = endUs - startUs;
+    s.runs++;
+    s.lastRuntimeUs = runtime;
+    if (runtime > s.maxRuntimeUs) s.maxRuntimeUs = runtime;
+    if (lateness > s.maxLatenessUs) s.maxLatenessUs = lateness;
+    if (s.deadlineUs > 0 && lateness + runtime > s.deadlineUs) s.overruns++;
+  }
+};
+
+#endif // LBEAST_SCHEDULER_H
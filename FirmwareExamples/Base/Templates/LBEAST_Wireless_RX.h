@@ -25,10 +25,10 @@
  *   }
  *   
  *   void loop() {
- *     LBEAST_ProcessIncoming();  // Call this regularly
+ *     LBEAST_ProcessIncoming();  // Call this regularly (drains all queued packets)
  *   }
  *   
- *   // Implement handlers
+ *   // Implement the handlers you need (any left out log via LBEAST_DefaultHandle*)
  *   void LBEAST_HandleBool(uint8_t channel, bool value) {
  *     // Handle bool command
  *   }
@@ -37,12 +37,24 @@
  *     // Handle float command
  *   }
  * 
+ * Safety packets (type 6, e.g. Channel 7 emergency stop) are delivered to LBEAST_HandleBool
+ * once per sequence number and acknowledged automatically, so the server stops retransmitting.
+ * 
+ * Batch packets (type 7) carry several bool/int/float commands in one datagram and are unpacked
+ * into the same handlers. A batch with a fire delay is held and applied by LBEAST_ProcessIncoming()
+ * once the delay expires, which is how props on different boards move on the same instant.
+ * 
  * Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
  */
 
 #ifndef LBEAST_WIRELESS_RX_H
 #define LBEAST_WIRELESS_RX_H
 
+// Definitions shared with LBEAST_Wireless_TX.h / LBEAST_Wireless_RX.h. Each header carries its
+// own copy so it stays standalone; the guard lets a sketch that both sends and receives include both.
+#ifndef LBEAST_WIRELESS_COMMON_DEFINED
+#define LBEAST_WIRELESS_COMMON_DEFINED
+
 // Platform detection
 #if defined(ESP32)
   #define LBEAST_PLATFORM_ESP
@@ -54,18 +66,25 @@
   #include <WiFiUdp.h>
 #elif defined(ARDUINO_ARCH_STM32)
   #define LBEAST_PLATFORM_STM32
+  // STM32 with WiFi module - adjust includes based on your WiFi module
   #include <WiFi.h>
   #include <WiFiUdp.h>
 #elif defined(__RASPBERRY_PI__) || defined(RASPBERRY_PI)
   #define LBEAST_PLATFORM_RASPBERRY_PI
+  // Raspberry Pi - use standard socket libraries
   #include <WiFi.h>
   #include <WiFiUdp.h>
 #elif defined(__JETSON_NANO__) || defined(JETSON_NANO)
   #define LBEAST_PLATFORM_JETSON
+  // Jetson Nano - use standard socket libraries
   #include <WiFi.h>
   #include <WiFiUdp.h>
+#elif !defined(ARDUINO)
+  #define LBEAST_PLATFORM_HOST
+  // Linux host build (unit tests, Virtual ECU) - POSIX sockets and mockable clock
+  #include "LBEAST_HostShim.h"
 #else
-  #error "LBEAST_Wireless_RX.h: Platform not supported. Use LBEAST_Serial_RX.h for serial communication."
+  #error "LBEAST wireless templates: Platform not supported. Use LBEAST_Serial_RX.h / LBEAST_Serial_TX.h for serial communication."
 #endif
 
 // Protocol constants
@@ -76,28 +95,94 @@ enum LBEASTDataType {
   LBEAST_TYPE_INT32 = 1,
   LBEAST_TYPE_FLOAT = 2,
   LBEAST_TYPE_STRING = 3,
-  LBEAST_TYPE_BYTES = 4
+  LBEAST_TYPE_BYTES = 4,
+  LBEAST_TYPE_SAFETY = 6,  // [Seq:LE16][Value:1] - acknowledged by echoing the packet back
+  LBEAST_TYPE_BATCH = 7    // [FireDelayMs:LE16][Count:1] then Count x [Type][Ch][Value:1 or 4]
 };
 
-// Global UDP object
+// Global UDP object (one socket for both directions)
 #if defined(LBEAST_PLATFORM_ESP) || defined(LBEAST_PLATFORM_STM32)
 WiFiUDP LBEAST_UDP;
-#elif defined(LBEAST_PLATFORM_RASPBERRY_PI) || defined(LBEAST_PLATFORM_JETSON)
+#elif defined(LBEAST_PLATFORM_RASPBERRY_PI) || defined(LBEAST_PLATFORM_JETSON) || defined(LBEAST_PLATFORM_HOST)
 WiFiUDP LBEAST_UDP;
 #else
 #error "Platform UDP not defined"
 #endif
 
+bool LBEAST_Initialized = false;
+
+/**
+ * Calculate CRC checksum
+ */
+uint8_t LBEAST_CalculateCRC(const uint8_t* data, int length) {
+  uint8_t crc = 0;
+  for (int i = 0; i < length; i++) {
+    crc ^= data[i];
+  }
+  return crc;
+}
+
+#endif // LBEAST_WIRELESS_COMMON_DEFINED
+
 // Configuration
 uint16_t LBEAST_LocalPort = 8888;
-bool LBEAST_Initialized = false;
 
-// Handler function prototypes (implement these in your sketch)
-void LBEAST_HandleBool(uint8_t channel, bool value);
-void LBEAST_HandleInt32(uint8_t channel, int32_t value);
-void LBEAST_HandleFloat(uint8_t channel, float value);
-void LBEAST_HandleString(uint8_t channel, const char* str, uint8_t length);
-void LBEAST_HandleBytes(uint8_t channel, uint8_t* data, uint8_t length);
+// Handler function prototypes (implement the ones you need in your sketch).
+// Declared weak without a definition: a handler the sketch does not implement resolves to null
+// and the matching LBEAST_DefaultHandle* logger below runs instead.
+__attribute__((weak)) void LBEAST_HandleBool(uint8_t channel, bool value);
+__attribute__((weak)) void LBEAST_HandleInt32(uint8_t channel, int32_t value);
+__attribute__((weak)) void LBEAST_HandleFloat(uint8_t channel, float value);
+__attribute__((weak)) void LBEAST_HandleString(uint8_t channel, const char* str, uint8_t length);
+__attribute__((weak)) void LBEAST_HandleBytes(uint8_t channel, uint8_t* data, uint8_t length);
+
+// Default handler implementations (used for any handler the sketch leaves out)
+void LBEAST_DefaultHandleBool(uint8_t channel, bool value) {
+  Serial.printf("LBEAST: Bool - Ch:%d Val:%s\n", channel, value ? "true" : "false");
+}
+
+void LBEAST_DefaultHandleInt32(uint8_t channel, int32_t value) {
+  Serial.printf("LBEAST: Int32 - Ch:%d Val:%ld\n", channel, (long)value);
+}
+
+void LBEAST_DefaultHandleFloat(uint8_t channel, float value) {
+  Serial.printf("LBEAST: Float - Ch:%d Val:%.3f\n", channel, value);
+}
+
+void LBEAST_DefaultHandleString(uint8_t channel, const char* str, uint8_t length) {
+  Serial.printf("LBEAST: String - Ch:%d Len:%d Val:%s\n", channel, length, str);
+}
+
+void LBEAST_DefaultHandleBytes(uint8_t channel, uint8_t* data, uint8_t length) {
+  (void)data;  // Default implementation just logs - override in your sketch to parse struct packets
+  Serial.printf("LBEAST: Bytes - Ch:%d Len:%d\n", channel, length);
+}
+
+// Route to the sketch's handler when it has one
+void LBEAST_DeliverBool(uint8_t channel, bool value) {
+  if (LBEAST_HandleBool) LBEAST_HandleBool(channel, value);
+  else LBEAST_DefaultHandleBool(channel, value);
+}
+
+void LBEAST_DeliverInt32(uint8_t channel, int32_t value) {
+  if (LBEAST_HandleInt32) LBEAST_HandleInt32(channel, value);
+  else LBEAST_DefaultHandleInt32(channel, value);
+}
+
+void LBEAST_DeliverFloat(uint8_t channel, float value) {
+  if (LBEAST_HandleFloat) LBEAST_HandleFloat(channel, value);
+  else LBEAST_DefaultHandleFloat(channel, value);
+}
+
+void LBEAST_DeliverString(uint8_t channel, const char* str, uint8_t length) {
+  if (LBEAST_HandleString) LBEAST_HandleString(channel, str, length);
+  else LBEAST_DefaultHandleString(channel, str, length);
+}
+
+void LBEAST_DeliverBytes(uint8_t channel, uint8_t* data, uint8_t length) {
+  if (LBEAST_HandleBytes) LBEAST_HandleBytes(channel, data, length);
+  else LBEAST_DefaultHandleBytes(channel, data, length);
+}
 
 /**
  * Initialize wireless communication
@@ -131,40 +216,168 @@ void LBEAST_Wireless_Init(const char* ssid, const char* password, uint16_t local
   Serial.println("LBEAST Wireless RX Ready!");
 }
 
+// Safety packet dedupe. The server sends redundant copies and retransmits until acked; each
+// sequence number must act once, and a late copy of an older command must not undo a newer one.
+// Sequence history is forgotten once a channel has been quiet for the window (covers server restarts).
+// The window must be at least the server's FLBEASTSafetyLaneConfig::GiveUpSeconds (5 s, max 6 s): the
+// server keeps retransmitting for that long, and a copy arriving after the window would act again.
+#ifndef LBEAST_SAFETY_CHANNELS
+  #define LBEAST_SAFETY_CHANNELS 4
+#endif
+#ifndef LBEAST_SAFETY_SEQ_WINDOW_MS
+  #define LBEAST_SAFETY_SEQ_WINDOW_MS 6000
+#endif
+
+struct LBEASTSafetySlot {
+  uint8_t channel;
+  uint16_t sequence;
+  unsigned long acceptedAt;
+  bool used;
+};
+
+LBEASTSafetySlot LBEAST_SafetySlots[LBEAST_SAFETY_CHANNELS] = {};
+
 /**
- * Calculate CRC checksum
+ * @return true if this safety command should be executed (new sequence for the channel)
  */
-uint8_t LBEAST_CalculateCRC(uint8_t* data, int length) {
-  uint8_t crc = 0;
-  for (int i = 0; i < length; i++) {
-    crc ^= data[i];
+bool LBEAST_SafetyAccept(uint8_t channel, uint16_t sequence) {
+  unsigned long now = millis();
+  LBEASTSafetySlot* slot = nullptr;
+  LBEASTSafetySlot* oldest = &LBEAST_SafetySlots[0];
+  for (int i = 0; i < LBEAST_SAFETY_CHANNELS; i++) {
+    LBEASTSafetySlot& candidate = LBEAST_SafetySlots[i];
+    if (candidate.used && candidate.channel == channel) {
+      slot = &candidate;
+      break;
+    }
+    if (!candidate.used || (oldest->used && candidate.acceptedAt < oldest->acceptedAt)) {
+      oldest = &candidate;
+    }
   }
-  return crc;
+
+  if (slot && now - slot->acceptedAt < LBEAST_SAFETY_SEQ_WINDOW_MS && (int16_t)(sequence - slot->sequence) <= 0) {
+    slot->acceptedAt = now;  // Still retransmitting: keep the history alive
+    return false;            // Duplicate or stale copy
+  }
+
+  if (!slot) slot = oldest;
+  slot->channel = channel;
+  slot->sequence = sequence;
+  slot->acceptedAt = now;
+  slot->used = true;
+  return true;
 }
 
 /**
- * Process incoming packets
- * Call this regularly in your loop()
+ * Echo a safety packet back to its sender as the ACK (the packet already carries a valid CRC)
  */
-void LBEAST_ProcessIncoming() {
-  if (!LBEAST_Initialized) return;
-  
-  int packetSize = LBEAST_UDP.parsePacket();
-  if (packetSize == 0) return;
-  
-  // Read packet
-  uint8_t buffer[256];
-  int len = LBEAST_UDP.read(buffer, 256);
-  
+void LBEAST_SendSafetyAck(const uint8_t* packet, int len) {
+  LBEAST_UDP.beginPacket(LBEAST_UDP.remoteIP(), LBEAST_UDP.remotePort());
+  LBEAST_UDP.write(packet, len);
+  LBEAST_UDP.endPacket();
+}
+
+// Held batches (fire delay > 0), applied in fire-time order (arrival order on ties).
+// If every slot is busy the earliest-due held batch is applied early to free its slot, so
+// batches never overtake one another and nothing is lost; the new batch is still held.
+#ifndef LBEAST_PENDING_BATCHES
+  #define LBEAST_PENDING_BATCHES 4
+#endif
+
+struct LBEASTPendingBatch {
+  unsigned long fireAt;
+  uint32_t arrival;
+  uint8_t count;
+  uint8_t length;
+  uint8_t entries[250];
+  bool used;
+};
+
+LBEASTPendingBatch LBEAST_PendingBatches[LBEAST_PENDING_BATCHES] = {};
+uint32_t LBEAST_PendingArrivals = 0;
+
+/**
+ * Unpack batch entries ([Type][Ch][Value]) into the LBEAST_Handle* functions
+ */
+void LBEAST_DispatchBatch(const uint8_t* entries, int len, uint8_t count) {
+  int offset = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    if (offset + 3 > len) return;
+    uint8_t type = entries[offset];
+    uint8_t channel = entries[offset + 1];
+    const uint8_t* value = &entries[offset + 2];
+
+    if (type == LBEAST_TYPE_BOOL) {
+      LBEAST_DeliverBool(channel, value[0] != 0);
+      offset += 3;
+    } else if (type == LBEAST_TYPE_INT32 || type == LBEAST_TYPE_FLOAT) {
+      if (offset + 6 > len) return;
+      uint32_t bits = (uint32_t)value[0] |
+                     ((uint32_t)value[1] << 8) |
+                     ((uint32_t)value[2] << 16) |
+                     ((uint32_t)value[3] << 24);
+      if (type == LBEAST_TYPE_INT32) {
+        LBEAST_DeliverInt32(channel, (int32_t)bits);
+      } else {
+        float floatValue;
+        memcpy(&floatValue, &bits, sizeof(floatValue));
+        LBEAST_DeliverFloat(channel, floatValue);
+      }
+      offset += 6;
+    } else {
+      Serial.printf("LBEAST: Unsupported batch entry type: %d\n", type);
+      return;  // Entry size unknown, the rest cannot be parsed
+    }
+  }
+}
+
+/**
+ * Held batch that fires first (earliest fire time, then earliest arrival), or nullptr if none
+ */
+LBEASTPendingBatch* LBEAST_EarliestPendingBatch() {
+  LBEASTPendingBatch* earliest = nullptr;
+  for (int i = 0; i < LBEAST_PENDING_BATCHES; i++) {
+    LBEASTPendingBatch& batch = LBEAST_PendingBatches[i];
+    if (!batch.used) continue;
+    if (!earliest) {
+      earliest = &batch;
+      continue;
+    }
+    long sooner = (long)(batch.fireAt - earliest->fireAt);
+    if (sooner < 0 || (sooner == 0 && (int32_t)(batch.arrival - earliest->arrival) < 0)) {
+      earliest = &batch;
+    }
+  }
+  return earliest;
+}
+
+/**
+ * Apply held batches whose fire time has arrived, in fire-time order
+ */
+void LBEAST_ServicePendingBatches() {
+  unsigned long now = millis();
+  LBEASTPendingBatch* batch;
+  while ((batch = LBEAST_EarliestPendingBatch()) != nullptr && (long)(now - batch->fireAt) >= 0) {
+    batch->used = false;
+    LBEAST_DispatchBatch(batch->entries, batch->length, batch->count);
+  }
+}
+
+/**
+ * Validate and dispatch a single packet to the LBEAST_Handle* functions
+ * Separated from socket reads so it can be driven directly in host unit tests.
+ * @return true if the packet was valid and dispatched
+ */
+bool LBEAST_ProcessPacket(uint8_t* buffer, int len) {
   if (len < 5) {
     Serial.println("LBEAST: Packet too small");
-    return;
+    return false;
   }
   
   // Validate start marker
   if (buffer[0] != LBEAST_PACKET_START_MARKER) {
     Serial.printf("LBEAST: Invalid start marker: 0x%02X\n", buffer[0]);
-    return;
+    return false;
   }
   
   // Validate CRC
@@ -172,7 +385,7 @@ void LBEAST_ProcessIncoming() {
   uint8_t calculatedCRC = LBEAST_CalculateCRC(buffer, len - 1);
   if (receivedCRC != calculatedCRC) {
     Serial.println("LBEAST: CRC mismatch");
-    return;
+    return false;
   }
   
   // Parse packet
@@ -181,7 +394,7 @@ void LBEAST_ProcessIncoming() {
   
   switch (type) {
     case LBEAST_TYPE_BOOL:
-      LBEAST_HandleBool(channel, buffer[3] != 0);
+      LBEAST_DeliverBool(channel, buffer[3] != 0);
       break;
       
     case LBEAST_TYPE_INT32:
@@ -190,7 +403,7 @@ void LBEAST_ProcessIncoming() {
                        ((int32_t)buffer[4] << 8) | 
                        ((int32_t)buffer[5] << 16) | 
                        ((int32_t)buffer[6] << 24);
-        LBEAST_HandleInt32(channel, value);
+        LBEAST_DeliverInt32(channel, value);
       }
       break;
       
@@ -200,8 +413,9 @@ void LBEAST_ProcessIncoming() {
                            ((uint32_t)buffer[4] << 8) | 
                            ((uint32_t)buffer[5] << 16) | 
                            ((uint32_t)buffer[6] << 24);
-        float value = *(float*)&intValue;
-        LBEAST_HandleFloat(channel, value);
+        float value;
+        memcpy(&value, &intValue, sizeof(value));
+        LBEAST_DeliverFloat(channel, value);
       }
       break;
       
@@ -212,7 +426,7 @@ void LBEAST_ProcessIncoming() {
           char str[256];
           memcpy(str, &buffer[4], strLen);
           str[strLen] = '\0';
-          LBEAST_HandleString(channel, str, strLen);
+          LBEAST_DeliverString(channel, str, strLen);
         }
       }
       break;
@@ -222,37 +436,99 @@ void LBEAST_ProcessIncoming() {
         uint8_t byteLen = buffer[3];
         if (byteLen > 0 && len >= 5 + byteLen) {
           // Extract bytes (skip length byte at buffer[3])
-          LBEAST_HandleBytes(channel, &buffer[4], byteLen);
+          LBEAST_DeliverBytes(channel, &buffer[4], byteLen);
         }
       }
       break;
       
-    default:
-      Serial.printf("LBEAST: Unknown type: %d\n", type);
+    case LBEAST_TYPE_SAFETY:
+      if (len >= 7) {
+        uint16_t sequence = (uint16_t)buffer[3] | ((uint16_t)buffer[4] << 8);
+        // Act first, then ACK: the ACK tells the server the command has been applied
+        if (LBEAST_SafetyAccept(channel, sequence)) {
+          LBEAST_DeliverBool(channel, buffer[5] != 0);
+        }
+        LBEAST_SendSafetyAck(buffer, len);
+      }
       break;
-  }
-}
-
-// Default handler implementations (override in your sketch)
-__attribute__((weak)) void LBEAST_HandleBool(uint8_t channel, bool value) {
-  Serial.printf("LBEAST: Bool - Ch:%d Val:%s\n", channel, value ? "true" : "false");
-}
+      
+    case LBEAST_TYPE_BATCH:
+      if (len >= 7) {
+        uint16_t fireDelayMs = (uint16_t)buffer[3] | ((uint16_t)buffer[4] << 8);
+        uint8_t count = buffer[5];
+        uint8_t* entries = &buffer[6];
+        int entriesLen = len - 7;  // Minus header and CRC
 
-__attribute__((weak)) void LBEAST_HandleInt32(uint8_t channel, int32_t value) {
-  Serial.printf("LBEAST: Int32 - Ch:%d Val:%d\n", channel, value);
-}
+        LBEASTPendingBatch* slot = nullptr;
+        if (fireDelayMs > 0 && entriesLen <= (int)sizeof(slot->entries)) {
+          for (int i = 0; i < LBEAST_PENDING_BATCHES; i++) {
+            if (!LBEAST_PendingBatches[i].used) {
+              slot = &LBEAST_PendingBatches[i];
+              break;
+            }
+          }
+          if (!slot) {
+            // Table full: the earliest-due batch goes out early, still ahead of this one
+            slot = LBEAST_EarliestPendingBatch();
+            slot->used = false;
+            Serial.printf("LBEAST: Held batch table full, applying the earliest batch %ld ms early\n",
+                          (long)(slot->fireAt - millis()));
+            LBEAST_DispatchBatch(slot->entries, slot->length, slot->count);
+          }
+        }
 
-__attribute__((weak)) void LBEAST_HandleFloat(uint8_t channel, float value) {
-  Serial.printf("LBEAST: Float - Ch:%d Val:%.3f\n", channel, value);
+        if (slot) {
+          slot->fireAt = millis() + fireDelayMs;
+          slot->arrival = LBEAST_PendingArrivals++;
+          slot->count = count;
+          slot->length = (uint8_t)entriesLen;
+          memcpy(slot->entries, entries, entriesLen);
+          slot->used = true;
+        } else {
+          LBEAST_DispatchBatch(entries, entriesLen, count);
+        }
+      }
+      break;
+      
+    default:
+      Serial.printf("LBEAST: Unknown type: %d\n", type);
+      return false;
+  }
+  
+  return true;
 }
 
-__attribute__((weak)) void LBEAST_HandleString(uint8_t channel, const char* str, uint8_t length) {
-  Serial.printf("LBEAST: String - Ch:%d Val:%s\n", channel, str);
-}
+// Upper bound on packets handled per LBEAST_ProcessIncoming() call, so a flood
+// cannot starve the control loop. Override before including this header.
+#ifndef LBEAST_RX_MAX_PACKETS_PER_CALL
+  #define LBEAST_RX_MAX_PACKETS_PER_CALL 16
+#endif
 
-__attribute__((weak)) void LBEAST_HandleBytes(uint8_t channel, uint8_t* data, uint8_t length) {
-  Serial.printf("LBEAST: Bytes - Ch:%d Len:%d\n", channel, length);
-  // Default implementation just logs - override in your sketch to parse struct packets
+/**
+ * Process incoming packets
+ * Drains every queued packet (up to LBEAST_RX_MAX_PACKETS_PER_CALL), not just one,
+ * so commands never wait a whole loop iteration behind each other.
+ * Call this regularly in your loop() or from an LBEASTScheduler idle task.
+ * @return Number of packets read from the socket
+ */
+int LBEAST_ProcessIncoming() {
+  if (!LBEAST_Initialized) return 0;
+  
+  int processed = 0;
+  uint8_t buffer[256];
+  
+  while (processed < LBEAST_RX_MAX_PACKETS_PER_CALL) {
+    int packetSize = LBEAST_UDP.parsePacket();
+    if (packetSize == 0) break;
+    
+    // Read packet
+    int len = LBEAST_UDP.read(buffer, sizeof(buffer));
+    processed++;
+    LBEAST_ProcessPacket(buffer, len);
+  }
+  
+  LBEAST_ServicePendingBatches();
+  return processed;
 }
 
 #endif // LBEAST_WIRELESS_RX_H
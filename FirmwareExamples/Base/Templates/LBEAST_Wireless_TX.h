@@ -35,6 +35,11 @@
 #ifndef LBEAST_WIRELESS_TX_H
 #define LBEAST_WIRELESS_TX_H
 
+// Definitions shared with LBEAST_Wireless_TX.h / LBEAST_Wireless_RX.h. Each header carries its
+// own copy so it stays standalone; the guard lets a sketch that both sends and receives include both.
+#ifndef LBEAST_WIRELESS_COMMON_DEFINED
+#define LBEAST_WIRELESS_COMMON_DEFINED
+
 // Platform detection
 #if defined(ESP32)
   #define LBEAST_PLATFORM_ESP
@@ -59,8 +64,12 @@
   // Jetson Nano - use standard socket libraries
   #include <WiFi.h>
   #include <WiFiUdp.h>
+#elif !defined(ARDUINO)
+  #define LBEAST_PLATFORM_HOST
+  // Linux host build (unit tests, Virtual ECU) - POSIX sockets and mockable clock
+  #include "LBEAST_HostShim.h"
 #else
-  #error "LBEAST_Wireless_TX.h: Platform not supported. Use LBEAST_Serial_TX.h for serial communication."
+  #error "LBEAST wireless templates: Platform not supported. Use LBEAST_Serial_RX.h / LBEAST_Serial_TX.h for serial communication."
 #endif
 
 // Protocol constants
@@ -71,22 +80,38 @@ enum LBEASTDataType {
   LBEAST_TYPE_INT32 = 1,
   LBEAST_TYPE_FLOAT = 2,
   LBEAST_TYPE_STRING = 3,
-  LBEAST_TYPE_BYTES = 4
+  LBEAST_TYPE_BYTES = 4,
+  LBEAST_TYPE_SAFETY = 6,  // [Seq:LE16][Value:1] - acknowledged by echoing the packet back
+  LBEAST_TYPE_BATCH = 7    // [FireDelayMs:LE16][Count:1] then Count x [Type][Ch][Value:1 or 4]
 };
 
-// Global UDP object
+// Global UDP object (one socket for both directions)
 #if defined(LBEAST_PLATFORM_ESP) || defined(LBEAST_PLATFORM_STM32)
 WiFiUDP LBEAST_UDP;
-#elif defined(LBEAST_PLATFORM_RASPBERRY_PI) || defined(LBEAST_PLATFORM_JETSON)
+#elif defined(LBEAST_PLATFORM_RASPBERRY_PI) || defined(LBEAST_PLATFORM_JETSON) || defined(LBEAST_PLATFORM_HOST)
 WiFiUDP LBEAST_UDP;
 #else
 #error "Platform UDP not defined"
 #endif
 
+bool LBEAST_Initialized = false;
+
+/**
+ * Calculate CRC checksum
+ */
+uint8_t LBEAST_CalculateCRC(const uint8_t* data, int length) {
+  uint8_t crc = 0;
+  for (int i = 0; i < length; i++) {
+    crc ^= data[i];
+  }
+  return crc;
+}
+
+#endif // LBEAST_WIRELESS_COMMON_DEFINED
+
 // Configuration
 IPAddress LBEAST_TargetIP(192, 168, 1, 100);
 uint16_t LBEAST_TargetPort = 8888;
-bool LBEAST_Initialized = false;
 
 /**
  * Initialize wireless communication
@@ -119,16 +144,8 @@ void LBEAST_Wireless_Init(const char* ssid, const char* password, IPAddress targ
   Serial.println("LBEAST Wireless TX Ready!");
 }
 
-/**
- * Calculate CRC checksum
- */
-uint8_t LBEAST_CalculateCRC(uint8_t* data, int length) {
-  uint8_t crc = 0;
-  for (int i = 0; i < length; i++) {
-    crc ^= data[i];
-  }
-  return crc;
-}
+// String/bytes payload limit: marker, type, channel, length and CRC must fit the 256-byte packet
+#define LBEAST_TX_MAX_PAYLOAD 251
 
 /**
  * Send bool value
@@ -181,7 +198,8 @@ void LBEAST_SendFloat(uint8_t channel, float value) {
   packet[2] = channel;
   
   // Reinterpret float as uint32 for byte-by-byte transmission
-  uint32_t intValue = *(uint32_t*)&value;
+  uint32_t intValue;
+  memcpy(&intValue, &value, sizeof(intValue));
   packet[3] = (intValue) & 0xFF;
   packet[4] = (intValue >> 8) & 0xFF;
   packet[5] = (intValue >> 16) & 0xFF;
@@ -199,14 +217,14 @@ void LBEAST_SendFloat(uint8_t channel, float value) {
 void LBEAST_SendString(uint8_t channel, const char* str) {
   if (!LBEAST_Initialized) return;
   
-  uint8_t len = strlen(str);
-  if (len > 255) len = 255;
+  size_t len = strlen(str);
+  if (len > LBEAST_TX_MAX_PAYLOAD) len = LBEAST_TX_MAX_PAYLOAD;
   
   uint8_t packet[256];
   packet[0] = LBEAST_PACKET_START_MARKER;
   packet[1] = LBEAST_TYPE_STRING;
   packet[2] = channel;
-  packet[3] = len;
+  packet[3] = (uint8_t)len;
   memcpy(&packet[4], str, len);
   packet[4 + len] = LBEAST_CalculateCRC(packet, 4 + len);
   
@@ -218,9 +236,9 @@ void LBEAST_SendString(uint8_t channel, const char* str) {
 /**
  * Send bytes/struct packet (for struct-based MVC pattern)
  */
-void LBEAST_SendBytes(uint8_t channel, uint8_t* data, uint8_t length) {
+void LBEAST_SendBytes(uint8_t channel, const uint8_t* data, uint8_t length) {
   if (!LBEAST_Initialized) return;
-  if (length > 255) length = 255;
+  if (length > LBEAST_TX_MAX_PAYLOAD) length = LBEAST_TX_MAX_PAYLOAD;
   
   uint8_t packet[256];
   packet[0] = LBEAST_PACKET_START_MARKER;
@@ -24,24 +24,35 @@
  * - Channel 7: Emergency stop (bool, true = stop all systems)
  * - Channel 9: Play session active (bool, true = kart can operate)
  * - Channel 100: FGoKartThrottleState struct (complete throttle state)
+ * - Channel 101: FGoKartThrottleEnvelope struct (timed throttle effect, run locally)
+ * - Channel 102: Clock-sync request (int32 sequence, answered on Channel 102)
  * 
  * Channel Mapping (GoKart ECU → Game Engine):
  * - Channel 310: FGoKartButtonEvents struct (button states, fast updates, default 20 Hz)
  *   * Contains: HornButtonState, HornLEDState, ShieldButtonState, Timestamp
  * - Channel 311: FGoKartThrottleState struct (throttle feedback, slow updates, default 1 Hz)
  *   * Contains: ThrottleInput, ThrottleMultiplier, ThrottleOutput
+ * - Channel 102: FGoKartClockSyncReply struct (sequence + millis() when replying)
+ *
+ * Throttle envelopes:
+ * The server sends each boost/slow effect once, stamped with a start time on this ECU's
+ * millis() clock (it keeps an offset estimate from the clock-sync exchanges). The ramp,
+ * hold and release all run here, so effects start on time under network jitter and end
+ * exactly when they should instead of on the server's next frame.
  * 
  * Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
  */
 
-// NOOP: This is a skeletal stub. Full implementation will include:
-// - LBEAST_Wireless_RX.h for receiving commands
-// - LBEAST_Wireless_TX.h for sending telemetry
+// NOOP: This is a skeletal stub. Command receive (LBEAST_Wireless_RX.h) and the clock-sync
+// reply (LBEAST_Wireless_TX.h) are wired up; full implementation will include:
 // - Throttle signal interception and man-in-the-middle control
 // - Button input handling (Horn, Shield with long-press detection)
 // - LED output control for Horn button
 // - Vehicle telemetry collection and reporting
 
+#include "LBEAST_Wireless_RX.h"
+#include "../Base/Templates/LBEAST_Wireless_TX.h"
+
 // Struct definitions matching Unreal (must match exactly for binary compatibility)
 struct FGoKartButtonEvents {
   bool HornButtonState;      // Horn button pressed = true
@@ -56,6 +67,20 @@ struct FGoKartThrottleState {
   float ThrottleOutput;     // Final throttle output (ThrottleInput * ThrottleMultiplier, clamped 0.0-1.0)
 };
 
+struct FGoKartThrottleEnvelope {
+  float TargetMultiplier;   // Reached at the end of the ramp-in (0.0-2.0)
+  int32_t RampInMs;         // Current -> target (0 = step)
+  int32_t HoldMs;           // At target after the ramp-in (0 = until replaced)
+  int32_t RampOutMs;        // Target -> 1.0 after the hold (0 = step)
+  uint32_t StartAtMs;       // millis() to start at (0 = on receipt)
+  int32_t EffectId;         // Increasing per effect; duplicates and late older copies are ignored
+};
+
+struct FGoKartClockSyncReply {
+  int32_t Sequence;         // From the Channel 102 request
+  uint32_t ECUTimeMs;       // millis() when replying
+};
+
 // =====================================
 // Configuration
 // =====================================
@@ -92,6 +117,12 @@ float throttleInputRaw = 0.0f;  // Raw input from pedal (0.0-1.0)
 float throttleMultiplier = 1.0f; // Multiplier from game engine
 float throttleOutput = 0.0f;     // Final output to motor
 
+// Running throttle envelope
+FGoKartThrottleEnvelope envelope = { 1.0f, 0, 0, 0, 0, 0 };
+bool envelopeActive = false;
+bool envelopeStarted = false;
+float envelopeStartMultiplier = 1.0f; // Multiplier when the envelope took over (ramp-in origin)
+
 // =====================================
 // Setup and Loop
 // =====================================
@@ -107,8 +138,13 @@ void setup() {
 }
 
 void loop() {
+  // Clock-sync requests (Channel 102) are answered from here via LBEAST_HandleInt32()
+  LBEAST_ProcessIncoming();
+
   // NOOP: Will handle:
   // - Receive throttle multiplier from game engine (Channel 0)
+  // - Receive throttle envelopes (Channel 101) -> HandleThrottleEnvelope()
+  // - throttleMultiplier = EvaluateThrottleEnvelope(millis()) every loop
   // - Receive play session state (Channel 9)
   // - Receive emergency stop (Channel 7)
   // - Read throttle input from pedal
@@ -125,10 +161,73 @@ void loop() {
 // Helper Functions (NOOP - to be implemented)
 // =====================================
 
+void LBEAST_HandleInt32(uint8_t channel, int32_t value) {
+  if (channel == 102) {
+    // Channel 102: Clock-sync request (sequence)
+    HandleClockSyncRequest(value);
+  }
+}
+
 void ReadThrottleInput() {
   // NOOP: Will read raw throttle input from pedal (analog or PWM)
 }
 
+void HandleThrottleEnvelope(const FGoKartThrottleEnvelope& received) {
+  // Duplicated or reordered copies of a slightly older effect must not undo a newer one.
+  // A much older id means the server restarted and its ids began again.
+  int32_t age = envelope.EffectId - received.EffectId;
+  if (envelopeActive && age >= 0 && age < 16) {
+    return;
+  }
+  envelope = received;
+  if (envelope.StartAtMs == 0) {
+    envelope.StartAtMs = millis();
+  }
+  envelopeActive = true;
+  envelopeStarted = false;
+}
+
+float EvaluateThrottleEnvelope(uint32_t now) {
+  if (!envelopeActive) {
+    return throttleMultiplier;
+  }
+
+  // Signed difference so the comparison survives millis() wrapping
+  int32_t elapsed = (int32_t)(now - envelope.StartAtMs);
+  if (elapsed < 0) {
+    return throttleMultiplier; // Not started yet - keep the previous effect running
+  }
+  if (!envelopeStarted) {
+    envelopeStartMultiplier = throttleMultiplier;
+    envelopeStarted = true;
+  }
+
+  if (elapsed < envelope.RampInMs) {
+    float t = (float)elapsed / (float)envelope.RampInMs;
+    return envelopeStartMultiplier + (envelope.TargetMultiplier - envelopeStartMultiplier) * t;
+  }
+  elapsed -= envelope.RampInMs;
+
+  if (envelope.HoldMs == 0 || elapsed < envelope.HoldMs) {
+    return envelope.TargetMultiplier;
+  }
+  elapsed -= envelope.HoldMs;
+
+  if (elapsed < envelope.RampOutMs) {
+    float t = (float)elapsed / (float)envelope.RampOutMs;
+    return envelope.TargetMultiplier + (1.0f - envelope.TargetMultiplier) * t;
+  }
+
+  envelopeActive = false;
+  return 1.0f;
+}
+
+void HandleClockSyncRequest(int32_t sequence) {
+  // Reply straight away: the server assumes the stamp sits halfway through its round trip
+  FGoKartClockSyncReply reply = { sequence, (uint32_t)millis() };
+  LBEAST_SendBytes(102, (uint8_t*)&reply, sizeof(FGoKartClockSyncReply));
+}
+
 void ApplyThrottleMultiplier() {
   // NOOP: Will calculate ThrottleOutput = ThrottleInput * ThrottleMultiplier
   // Clamp to 0.0-1.0 range
@@ -81,6 +81,7 @@
 #include "../Base/Templates/LBEAST_Wireless_TX.h"
 #include "../Base/Templates/ActuatorSystem_Controller.h"
 #include "../Base/Templates/ScissorLift_Controller.h"
+#include "../Base/Templates/LBEAST_Scheduler.h"
 
 // Struct definitions matching Unreal (must match exactly for binary compatibility)
 struct FTiltState {
@@ -197,14 +198,19 @@ bool motionInProgress = false;
 
 // Game state management
 bool playSessionActive = false;  // Play session state (controls gun firing authorization)
-unsigned long lastGameStateUpdate = 0;
 const unsigned long GAME_STATE_UPDATE_INTERVAL_MS = 100;  // Send game state to child ECUs at 10 Hz
+const unsigned long POSITION_FEEDBACK_INTERVAL_MS = 100;  // Send position feedback to Unreal at 10 Hz
+const unsigned long CONTROL_LOOP_PERIOD_US = 1000;        // Lift/actuator control loop at 1 kHz
 
 // Telemetry update rate control (server-controlled)
 unsigned long buttonEventUpdateInterval = 50;   // Button events: 20 Hz (50ms) - fast updates
 unsigned long telemetryUpdateInterval = 1000;   // Telemetry: 1 Hz (1000ms) - slow updates
-unsigned long lastButtonEventTime = 0;
-unsigned long lastTelemetryTime = 0;
+
+// Cooperative scheduler (replaces delay() in loop so control runs at 1 kHz
+// while networking and telemetry run at their own rates)
+LBEASTScheduler scheduler;
+int buttonEventTaskId = -1;
+int telemetryTaskId = -1;
 
 // Child ECU state storage (4 stations)
 const uint8_t NUM_GUN_STATIONS = 4;
@@ -335,6 +341,14 @@ void setup() {
   
   motionStartTime = millis();
   
+  // Register scheduler tasks (network receive runs on every pass)
+  scheduler.addIdle("rx", ReceiveTask);
+  scheduler.addPeriodic("control", CONTROL_LOOP_PERIOD_US, ControlTask);
+  scheduler.addPeriodic("game_state", GAME_STATE_UPDATE_INTERVAL_MS * 1000, GameStateTask);
+  scheduler.addPeriodic("feedback", POSITION_FEEDBACK_INTERVAL_MS * 1000, PositionFeedbackTask);
+  buttonEventTaskId = scheduler.addPeriodic("button_events", buttonEventUpdateInterval * 1000, ButtonEventTask);
+  telemetryTaskId = scheduler.addPeriodic("telemetry", telemetryUpdateInterval * 1000, TelemetryTask);
+  
   Serial.println("\nGunship Experience ECU Ready!");
   Serial.println("Waiting for motion commands from Unreal/Unity...\n");
   Serial.println("Channel Mapping:");
@@ -355,43 +369,45 @@ void setup() {
 // =====================================
 
 void loop() {
-  // Process incoming LBEAST commands from game engine
+  scheduler.runOnce();
+}
+
+// =====================================
+// Scheduler Tasks
+// =====================================
+
+void ReceiveTask(void*) {
+  // Process incoming LBEAST commands from game engine (drains all queued packets)
   LBEAST_ProcessIncoming();
   
   // Process incoming telemetry from child ECUs
   ProcessGunECUTelemetry();
-  
+}
+
+void ControlTask(void*) {
   // Update both controllers
   liftController.update();
   actuatorController.update();
-  
+}
+
+void GameStateTask(void*) {
   // Send game state to child ECUs (play session active/inactive)
-  unsigned long currentTime = millis();
-  if (currentTime - lastGameStateUpdate >= GAME_STATE_UPDATE_INTERVAL_MS) {
-    SendGameStateToGunECUs();
-    lastGameStateUpdate = currentTime;
-  }
-  
-  // Send position feedback to Unreal (bidirectional IO) - every 100ms (10 Hz)
-  static unsigned long lastFeedbackTime = 0;
-  if (currentTime - lastFeedbackTime >= 100) {
-    SendPositionFeedback();
-    lastFeedbackTime = currentTime;
-  }
-  
+  SendGameStateToGunECUs();
+}
+
+void PositionFeedbackTask(void*) {
+  // Send position feedback to Unreal (bidirectional IO)
+  SendPositionFeedback();
+}
+
+void ButtonEventTask(void*) {
   // Send button events (fast updates, on change or periodic)
-  if (currentTime - lastButtonEventTime >= buttonEventUpdateInterval) {
-    SendGunButtonEvents();
-    lastButtonEventTime = currentTime;
-  }
-  
+  SendGunButtonEvents();
+}
+
+void TelemetryTask(void*) {
   // Send telemetry (slow updates, periodic)
-  if (currentTime - lastTelemetryTime >= telemetryUpdateInterval) {
-    SendGunTelemetry();
-    lastTelemetryTime = currentTime;
-  }
-  
-  delay(10); // Control loop update rate (~100 Hz)
+  SendGunTelemetry();
 }
 
 // =====================================
@@ -496,10 +512,12 @@ void LBEAST_HandleInt32(uint8_t channel, int32_t value) {
   if (channel == 100) {
     // Channel 100: Button event update interval (ms) - server-controlled
     buttonEventUpdateInterval = max((unsigned long)value, 10UL);  // Minimum 10ms (100 Hz max)
+    scheduler.setPeriod(buttonEventTaskId, buttonEventUpdateInterval * 1000);
     Serial.printf("ECU: Button event update interval set to %lu ms\n", buttonEventUpdateInterval);
   } else if (channel == 101) {
     // Channel 101: Telemetry update interval (ms) - server-controlled
     telemetryUpdateInterval = max((unsigned long)value, 100UL);  // Minimum 100ms (10 Hz max)
+    scheduler.setPeriod(telemetryTaskId, telemetryUpdateInterval * 1000);
     Serial.printf("ECU: Telemetry update interval set to %lu ms\n", telemetryUpdateInterval);
   }
 }
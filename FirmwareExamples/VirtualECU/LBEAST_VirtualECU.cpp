@@ -0,0 +1,860 @@
+/*
+ * LBEAST Virtual ECU Simulator
+ *
+ * Headless Linux command-line simulator that spawns N virtual ECUs on loopback
+ * (or any interface) speaking the exact LBEAST binary protocol, so the server-side
+ * transports (ULBEASTUDPTransport and everything built on it) can be load-tested
+ * without physical ESP32s.
+ *
+ * Each virtual ECU:
+ * - Binds its own UDP port (base port + index), like one physical ECU per IP
+ * - Streams scripted telemetry at a configurable rate per channel
+ * - Applies send jitter, packet loss and reordering
+ * - Counts and authenticates inbound commands (None / HMAC / Encrypted)
+ * - Optionally sends RTT probes and measures round-trip latency from the echo
+ *
+ * An echo mode (--echo) stands in for the server: it reflects every packet
+ * back to its sender, which makes the simulator a self-contained benchmark of
+ * the protocol stack and of the host's UDP path.
+ *
+ * See README.md in this directory for usage and examples.
+ *
+ * Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+ */
+
+#include "LBEAST_VirtualECU_Protocol.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// =====================================
+// Configuration
+// =====================================
+
+struct StreamConfig {
+  uint8_t channel = 0;
+  uint8_t type = LBEAST_TYPE_FLOAT;
+  double rateHz = 10.0;
+  int size = 4;             // Payload size for bytes streams
+  double startSeconds = 0;  // Script offset at which this rate takes effect
+};
+
+struct SimulatorConfig {
+  int ecuCount = 1;
+  std::string serverIP = "127.0.0.1";
+  uint16_t serverPort = 8888;
+  std::string bindIP = "127.0.0.1";
+  uint16_t basePort = 9000;
+  bool replyToSender = false;
+  LBEASTSecurityLevel security = LBEAST_SECURITY_NONE;
+  std::string secret = "CHANGE_ME_IN_PRODUCTION_2025";
+  std::vector<StreamConfig> streams;
+  double jitterMs = 0.0;
+  double lossPercent = 0.0;
+  double reorderPercent = 0.0;
+  double probeHz = 0.0;
+  uint8_t probeChannel = 254;
+  int clockSyncChannel = -1;  // Answer Int32 clock-sync requests on this channel (-1 = off)
+  double durationSeconds = 10.0;
+  double reportIntervalSeconds = 1.0;
+  uint32_t seed = 1;
+  std::string jsonPath;
+  bool echoMode = false;
+  bool quiet = false;
+};
+
+// =====================================
+// Clock
+// =====================================
+
+typedef int64_t TimeNs;
+
+static TimeNs NowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static TimeNs SecondsToNs(double seconds) {
+  return (TimeNs)(seconds * 1e9);
+}
+
+// =====================================
+// Statistics
+// =====================================
+
+struct TrafficStats {
+  uint64_t txPackets = 0;
+  uint64_t txBytes = 0;
+  uint64_t rxPackets = 0;
+  uint64_t rxBytes = 0;
+  uint64_t rxInvalid = 0;
+  uint64_t dropped = 0;
+  uint64_t reordered = 0;
+  uint64_t probesSent = 0;
+  uint64_t probesReceived = 0;
+  uint64_t safetyCommands = 0;
+  uint64_t safetyAcks = 0;
+  uint64_t batchPackets = 0;
+  uint64_t batchCommands = 0;
+  uint64_t clockSyncReplies = 0;
+
+  void Add(const TrafficStats& other) {
+    txPackets += other.txPackets;
+    txBytes += other.txBytes;
+    rxPackets += other.rxPackets;
+    rxBytes += other.rxBytes;
+    rxInvalid += other.rxInvalid;
+    dropped += other.dropped;
+    reordered += other.reordered;
+    probesSent += other.probesSent;
+    probesReceived += other.probesReceived;
+    safetyCommands += other.safetyCommands;
+    safetyAcks += other.safetyAcks;
+    batchPackets += other.batchPackets;
+    batchCommands += other.batchCommands;
+    clockSyncReplies += other.clockSyncReplies;
+  }
+};
+
+struct LatencySamples {
+  std::vector<uint32_t> microseconds;
+
+  void Add(TimeNs rtt) {
+    // Cap memory for very long runs (~4 MB)
+    if (microseconds.size() < 1000000) {
+      microseconds.push_back((uint32_t)(rtt / 1000));
+    }
+  }
+
+  double Percentile(double p) {
+    if (microseconds.empty()) return 0.0;
+    std::sort(microseconds.begin(), microseconds.end());
+    size_t index = (size_t)std::min<double>(microseconds.size() - 1, std::floor(p * (microseconds.size() - 1) + 0.5));
+    return microseconds[index] / 1000.0;
+  }
+};
+
+// =====================================
+// Virtual ECU
+// =====================================
+
+struct StreamState {
+  StreamConfig config;
+  TimeNs nextNominal = 0;  // Grid-aligned schedule (no drift from jitter)
+  TimeNs nextSend = 0;     // Nominal + jitter
+  uint32_t counter = 0;
+  bool active = false;
+};
+
+struct VirtualECU {
+  int index = 0;
+  int fd = -1;
+  sockaddr_in target{};
+  bool haveTarget = false;
+  LBEAST_SecurityContext security;
+  std::vector<StreamState> streams;
+
+  // RTT probes (ring of outstanding send timestamps)
+  static const int PROBE_RING = 256;
+  TimeNs probeSentAt[PROBE_RING] = {};
+  uint32_t probeSeqAt[PROBE_RING] = {};
+  uint32_t nextProbeSeq = 1;
+  TimeNs nextProbe = 0;
+
+  // Reordering: one held packet, released after the next send (or after a short timeout)
+  uint8_t heldPacket[LBEAST_MAX_PACKET_SIZE];
+  int heldLength = 0;
+  TimeNs heldUntil = 0;
+
+  TrafficStats stats;
+  uint64_t commandsByChannel[256] = {};
+
+  // Safety lane: last executed sequence per channel (0 = none; the server never sends 0)
+  uint16_t safetySequence[256] = {};
+};
+
+static volatile sig_atomic_t GStopRequested = 0;
+
+static void HandleSignal(int) {
+  GStopRequested = 1;
+}
+
+static bool ParseAddress(const std::string& ip, uint16_t port, sockaddr_in& out) {
+  memset(&out, 0, sizeof(out));
+  out.sin_family = AF_INET;
+  out.sin_port = htons(port);
+  return inet_pton(AF_INET, ip.c_str(), &out.sin_addr) == 1;
+}
+
+static int OpenSocket(const std::string& bindIP, uint16_t port) {
+  int fd = socket(AF_INET, SOCK_DGRAM, 0);
+  if (fd < 0) return -1;
+
+  int reuse = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+  int bufferSize = 1 << 20;
+  setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &bufferSize, sizeof(bufferSize));
+  setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &bufferSize, sizeof(bufferSize));
+
+  sockaddr_in local;
+  if (!ParseAddress(bindIP, port, local) || bind(fd, (sockaddr*)&local, sizeof(local)) != 0) {
+    close(fd);
+    return -1;
+  }
+
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+  return fd;
+}
+
+static int BuildPayload(StreamState& stream, TimeNs now, uint8_t* out) {
+  uint32_t counter = stream.counter++;
+  switch (stream.config.type) {
+    case LBEAST_TYPE_BOOL:
+      out[0] = (counter & 1) ? 1 : 0;
+      return 1;
+
+    case LBEAST_TYPE_INT32:
+      out[0] = counter & 0xFF;
+      out[1] = (counter >> 8) & 0xFF;
+      out[2] = (counter >> 16) & 0xFF;
+      out[3] = (counter >> 24) & 0xFF;
+      return 4;
+
+    case LBEAST_TYPE_FLOAT: {
+      // Slow sine so recorded telemetry looks like a moving axis
+      float value = (float)std::sin((double)now * 1e-9 * 2.0 * M_PI * 0.25);
+      uint32_t bits;
+      memcpy(&bits, &value, 4);
+      out[0] = bits & 0xFF;
+      out[1] = (bits >> 8) & 0xFF;
+      out[2] = (bits >> 16) & 0xFF;
+      out[3] = (bits >> 24) & 0xFF;
+      return 4;
+    }
+
+    case LBEAST_TYPE_STRING:
+    case LBEAST_TYPE_BYTES:
+    default: {
+      int size = std::min(std::max(stream.config.size, 1), 255);
+      out[0] = (uint8_t)size;
+      memset(&out[1], 0, size);
+      memcpy(&out[1], &counter, std::min(size, 4));
+      return 1 + size;
+    }
+  }
+}
+
+class Simulator {
+public:
+  explicit Simulator(const SimulatorConfig& InConfig)
+    : config(InConfig), rng(InConfig.seed), unit(0.0, 1.0) {}
+
+  bool Initialize() {
+    sockaddr_in server;
+    if (!ParseAddress(config.serverIP, config.serverPort, server)) {
+      fprintf(stderr, "Invalid server address: %s\n", config.serverIP.c_str());
+      return false;
+    }
+
+    TimeNs start = NowNs();
+    ecus.resize(config.ecuCount);
+    for (int i = 0; i < config.ecuCount; i++) {
+      VirtualECU& ecu = ecus[i];
+      ecu.index = i;
+      ecu.fd = OpenSocket(config.bindIP, (uint16_t)(config.basePort + i));
+      if (ecu.fd < 0) {
+        fprintf(stderr, "ECU %d: failed to bind %s:%d (%s)\n", i, config.bindIP.c_str(), config.basePort + i, strerror(errno));
+        return false;
+      }
+      ecu.target = server;
+      ecu.haveTarget = !config.replyToSender;
+      LBEAST_Security_Init(&ecu.security, config.security, config.secret.c_str(), config.seed * 7919u + i + 1);
+
+      for (const StreamConfig& streamConfig : config.streams) {
+        StreamState stream;
+        stream.config = streamConfig;
+        // Stagger ECUs across the first period so 40 ECUs don't fire in lockstep
+        TimeNs period = SecondsToNs(1.0 / std::max(streamConfig.rateHz, 0.001));
+        stream.nextNominal = start + SecondsToNs(streamConfig.startSeconds) + (period * i) / std::max(config.ecuCount, 1);
+        stream.nextSend = stream.nextNominal;
+        stream.active = streamConfig.startSeconds <= 0.0;
+        ecu.streams.push_back(stream);
+      }
+
+      if (config.probeHz > 0.0) {
+        ecu.nextProbe = start + SecondsToNs(1.0 / config.probeHz) * i / std::max(config.ecuCount, 1);
+      }
+    }
+
+    if (!config.quiet) {
+      printf("LBEAST Virtual ECU: %d ECU(s) on %s:%d-%d -> %s:%d (%s)\n",
+        config.ecuCount, config.bindIP.c_str(), config.basePort, config.basePort + config.ecuCount - 1,
+        config.serverIP.c_str(), config.serverPort,
+        config.security == LBEAST_SECURITY_ENCRYPTED ? "AES-128 + HMAC" :
+        config.security == LBEAST_SECURITY_HMAC ? "HMAC" : "CRC");
+    }
+    return true;
+  }
+
+  void Run() {
+    std::vector<pollfd> fds(ecus.size());
+    for (size_t i = 0; i < ecus.size(); i++) {
+      fds[i].fd = ecus[i].fd;
+      fds[i].events = POLLIN;
+    }
+
+    startTime = NowNs();
+    TimeNs endTime = startTime + SecondsToNs(config.durationSeconds);
+    TimeNs nextReport = startTime + SecondsToNs(config.reportIntervalSeconds);
+
+    while (!GStopRequested) {
+      TimeNs now = NowNs();
+      if (now >= endTime) break;
+
+      for (VirtualECU& ecu : ecus) {
+        ServiceTimers(ecu, now);
+      }
+
+      if (now >= nextReport) {
+        Report(now);
+        nextReport += SecondsToNs(config.reportIntervalSeconds);
+      }
+
+      // Sleep until the next deadline or until data arrives
+      TimeNs deadline = std::min(endTime, nextReport);
+      for (const VirtualECU& ecu : ecus) {
+        deadline = std::min(deadline, NextDeadline(ecu));
+      }
+      TimeNs waitNs = std::max<TimeNs>(0, deadline - NowNs());
+      timespec timeout;
+      timeout.tv_sec = waitNs / 1000000000;
+      timeout.tv_nsec = waitNs % 1000000000;
+
+      int ready = ppoll(fds.data(), fds.size(), &timeout, nullptr);
+      if (ready <= 0) continue;
+
+      for (size_t i = 0; i < fds.size(); i++) {
+        if (fds[i].revents & POLLIN) {
+          DrainSocket(ecus[i]);
+        }
+      }
+    }
+
+    Summarize(NowNs());
+  }
+
+  void Shutdown() {
+    for (VirtualECU& ecu : ecus) {
+      if (ecu.fd >= 0) close(ecu.fd);
+      ecu.fd = -1;
+    }
+  }
+
+private:
+  SimulatorConfig config;
+  std::vector<VirtualECU> ecus;
+  std::mt19937 rng;
+  std::uniform_real_distribution<double> unit;
+  TimeNs startTime = 0;
+  TrafficStats lastReported;
+  LatencySamples latency;
+  LatencySamples intervalLatency;
+
+  TimeNs NextDeadline(const VirtualECU& ecu) const {
+    TimeNs deadline = INT64_MAX;
+    for (const StreamState& stream : ecu.streams) {
+      deadline = std::min(deadline, stream.nextSend);
+    }
+    if (config.probeHz > 0.0) deadline = std::min(deadline, ecu.nextProbe);
+    if (ecu.heldLength > 0) deadline = std::min(deadline, ecu.heldUntil);
+    return deadline;
+  }
+
+  TimeNs Jitter() {
+    if (config.jitterMs <= 0.0) return 0;
+    return SecondsToNs((unit(rng) * 2.0 - 1.0) * config.jitterMs / 1000.0);
+  }
+
+  void ServiceTimers(VirtualECU& ecu, TimeNs now) {
+    uint8_t payload[LBEAST_MAX_PACKET_SIZE];
+    uint8_t packet[LBEAST_MAX_PACKET_SIZE];
+
+    for (StreamState& stream : ecu.streams) {
+      while (stream.nextSend <= now) {
+        TimeNs period = SecondsToNs(1.0 / std::max(stream.config.rateHz, 0.001));
+        if (stream.active || ActivateScriptedStream(ecu, stream)) {
+          int payloadLength = BuildPayload(stream, now, payload);
+          int length = LBEAST_BuildPacket(&ecu.security, stream.config.type, stream.config.channel,
+            payload, payloadLength, packet, sizeof(packet));
+          Transmit(ecu, packet, length, now);
+        }
+        stream.nextNominal += period;
+        // Skip missed slots instead of bursting after a stall
+        if (stream.nextNominal < now - period) {
+          stream.nextNominal = now;
+        }
+        stream.nextSend = stream.nextNominal + Jitter();
+      }
+    }
+
+    if (config.probeHz > 0.0 && ecu.nextProbe <= now) {
+      uint32_t seq = ecu.nextProbeSeq++;
+      ecu.probeSentAt[seq % VirtualECU::PROBE_RING] = now;
+      ecu.probeSeqAt[seq % VirtualECU::PROBE_RING] = seq;
+      uint8_t probe[4] = { (uint8_t)(seq & 0xFF), (uint8_t)((seq >> 8) & 0xFF), (uint8_t)((seq >> 16) & 0xFF), (uint8_t)((seq >> 24) & 0xFF) };
+      int length = LBEAST_BuildPacket(&ecu.security, LBEAST_TYPE_INT32, config.probeChannel, probe, 4, packet, sizeof(packet));
+      // Probes bypass loss/reorder so RTT measures the peer, not the impairment model
+      SendRaw(ecu, packet, length);
+      ecu.stats.probesSent++;
+      ecu.nextProbe += SecondsToNs(1.0 / config.probeHz);
+      if (ecu.nextProbe < now) ecu.nextProbe = now;
+    }
+
+    if (ecu.heldLength > 0 && ecu.heldUntil <= now) {
+      SendRaw(ecu, ecu.heldPacket, ecu.heldLength);
+      ecu.heldLength = 0;
+    }
+  }
+
+  bool ActivateScriptedStream(VirtualECU& ecu, StreamState& stream) {
+    // A scripted entry replaces any earlier entry for the same channel once its start time is reached
+    for (StreamState& other : ecu.streams) {
+      if (&other != &stream && other.active && other.config.channel == stream.config.channel) {
+        other.active = false;
+        other.nextSend = INT64_MAX;
+      }
+    }
+    stream.active = true;
+    return true;
+  }
+
+  void Transmit(VirtualECU& ecu, const uint8_t* packet, int length, TimeNs now) {
+    if (length <= 0) return;
+
+    if (config.lossPercent > 0.0 && unit(rng) * 100.0 < config.lossPercent) {
+      ecu.stats.dropped++;
+      return;
+    }
+
+    if (ecu.heldLength == 0 && config.reorderPercent > 0.0 && unit(rng) * 100.0 < config.reorderPercent) {
+      memcpy(ecu.heldPacket, packet, length);
+      ecu.heldLength = length;
+      ecu.heldUntil = now + SecondsToNs(0.020);
+      ecu.stats.reordered++;
+      return;
+    }
+
+    SendRaw(ecu, packet, length);
+
+    // Release the held packet behind the one that overtook it
+    if (ecu.heldLength > 0) {
+      SendRaw(ecu, ecu.heldPacket, ecu.heldLength);
+      ecu.heldLength = 0;
+    }
+  }
+
+  void SendRaw(VirtualECU& ecu, const uint8_t* packet, int length) {
+    if (!ecu.haveTarget) return;
+    ssize_t sent = sendto(ecu.fd, packet, length, 0, (const sockaddr*)&ecu.target, sizeof(ecu.target));
+    if (sent == length) {
+      ecu.stats.txPackets++;
+      ecu.stats.txBytes += length;
+    }
+  }
+
+  void DrainSocket(VirtualECU& ecu) {
+    uint8_t buffer[2048];
+    sockaddr_in sender;
+    socklen_t senderLength = sizeof(sender);
+
+    // Drain everything that is queued, not one datagram per wakeup
+    for (;;) {
+      senderLength = sizeof(sender);
+      ssize_t received = recvfrom(ecu.fd, buffer, sizeof(buffer), 0, (sockaddr*)&sender, &senderLength);
+      if (received <= 0) break;
+
+      TimeNs now = NowNs();
+      ecu.stats.rxPackets++;
+      ecu.stats.rxBytes += received;
+
+      if (config.echoMode) {
+        if (config.lossPercent > 0.0 && unit(rng) * 100.0 < config.lossPercent) {
+          ecu.stats.dropped++;
+          continue;
+        }
+        if (sendto(ecu.fd, buffer, received, 0, (const sockaddr*)&sender, senderLength) == received) {
+          ecu.stats.txPackets++;
+          ecu.stats.txBytes += received;
+        }
+        continue;
+      }
+
+      if (config.replyToSender) {
+        ecu.target = sender;
+        ecu.haveTarget = true;
+      }
+
+      uint8_t type, channel;
+      uint8_t* payload;
+      int payloadLength;
+      if (!LBEAST_ParsePacket(&ecu.security, buffer, (int)received, &type, &channel, &payload, &payloadLength)) {
+        ecu.stats.rxInvalid++;
+        continue;
+      }
+
+      if (config.probeHz > 0.0 && channel == config.probeChannel && type == LBEAST_TYPE_INT32 && payloadLength >= 4) {
+        uint32_t seq = (uint32_t)payload[0] | ((uint32_t)payload[1] << 8) | ((uint32_t)payload[2] << 16) | ((uint32_t)payload[3] << 24);
+        int slot = seq % VirtualECU::PROBE_RING;
+        if (ecu.probeSeqAt[slot] == seq && ecu.probeSentAt[slot] != 0) {
+          latency.Add(now - ecu.probeSentAt[slot]);
+          intervalLatency.Add(now - ecu.probeSentAt[slot]);
+          ecu.probeSentAt[slot] = 0;
+          ecu.stats.probesReceived++;
+        }
+        continue;
+      }
+
+      if (type == LBEAST_TYPE_SAFETY && payloadLength >= 3) {
+        // Execute each sequence once (redundant copies/retransmits), ACK every copy
+        uint16_t seq = (uint16_t)payload[0] | ((uint16_t)payload[1] << 8);
+        if (seq != ecu.safetySequence[channel]) {
+          ecu.safetySequence[channel] = seq;
+          ecu.stats.safetyCommands++;
+          ecu.commandsByChannel[channel]++;
+        }
+        uint8_t ack[LBEAST_MAX_PACKET_SIZE];
+        int length = LBEAST_BuildPacket(&ecu.security, LBEAST_TYPE_SAFETY, channel, payload, 3, ack, sizeof(ack));
+        if (sendto(ecu.fd, ack, length, 0, (const sockaddr*)&sender, senderLength) == length) {
+          ecu.stats.txPackets++;
+          ecu.stats.txBytes += length;
+          ecu.stats.safetyAcks++;
+        }
+        continue;
+      }
+
+      if (channel == config.clockSyncChannel && type == LBEAST_TYPE_INT32 && payloadLength >= 4) {
+        // Reply with [Seq:LE32][ECU ms:LE32]; each ECU "booted" at a different time so offsets differ
+        uint32_t ecuMs = (uint32_t)((now - startTime) / 1000000) + (uint32_t)ecu.index * 1000u;
+        uint8_t reply[8] = { payload[0], payload[1], payload[2], payload[3],
+          (uint8_t)(ecuMs & 0xFF), (uint8_t)((ecuMs >> 8) & 0xFF), (uint8_t)((ecuMs >> 16) & 0xFF), (uint8_t)((ecuMs >> 24) & 0xFF) };
+        uint8_t packet[LBEAST_MAX_PACKET_SIZE];
+        int length = LBEAST_BuildPacket(&ecu.security, LBEAST_TYPE_BYTES, channel, reply, sizeof(reply), packet, sizeof(packet));
+        if (sendto(ecu.fd, packet, length, 0, (const sockaddr*)&sender, senderLength) == length) {
+          ecu.stats.txPackets++;
+          ecu.stats.txBytes += length;
+          ecu.stats.clockSyncReplies++;
+        }
+        continue;
+      }
+
+      if (type == LBEAST_TYPE_BATCH && payloadLength >= 3) {
+        // Count each batched command against its own channel (fire delay is not simulated)
+        uint8_t count = payload[2];
+        int offset = 3;
+        for (uint8_t i = 0; i < count && offset + 3 <= payloadLength; i++) {
+          uint8_t entryType = payload[offset];
+          ecu.commandsByChannel[payload[offset + 1]]++;
+          offset += entryType == LBEAST_TYPE_BOOL ? 3 : 6;
+        }
+        ecu.stats.batchPackets++;
+        ecu.stats.batchCommands += count;
+        continue;
+      }
+
+      ecu.commandsByChannel[channel]++;
+    }
+  }
+
+  TrafficStats Totals() const {
+    TrafficStats total;
+    for (const VirtualECU& ecu : ecus) {
+      total.Add(ecu.stats);
+    }
+    return total;
+  }
+
+  void Report(TimeNs now) {
+    TrafficStats total = Totals();
+    if (!config.quiet) {
+      double interval = config.reportIntervalSeconds;
+      printf("[%7.2fs] tx %8.0f pkt/s %9.1f kB/s | rx %8.0f pkt/s %9.1f kB/s | invalid %llu | rtt p50 %.3f ms p99 %.3f ms\n",
+        (now - startTime) * 1e-9,
+        (total.txPackets - lastReported.txPackets) / interval,
+        (total.txBytes - lastReported.txBytes) / interval / 1024.0,
+        (total.rxPackets - lastReported.rxPackets) / interval,
+        (total.rxBytes - lastReported.rxBytes) / interval / 1024.0,
+        (unsigned long long)total.rxInvalid,
+        intervalLatency.Percentile(0.50), intervalLatency.Percentile(0.99));
+      fflush(stdout);
+    }
+    lastReported = total;
+    intervalLatency.microseconds.clear();
+  }
+
+  void Summarize(TimeNs now) {
+    TrafficStats total = Totals();
+    double elapsed = std::max((now - startTime) * 1e-9, 1e-9);
+    double p50 = latency.Percentile(0.50);
+    double p95 = latency.Percentile(0.95);
+    double p99 = latency.Percentile(0.99);
+    double maxMs = latency.Percentile(1.0);
+
+    printf("\n=== LBEAST Virtual ECU Summary (%.2fs, %d ECU%s, %s mode) ===\n",
+      elapsed, config.ecuCount, config.ecuCount == 1 ? "" : "s", config.echoMode ? "echo" : "ecu");
+    printf("TX: %llu packets (%.0f pkt/s, %.1f kB/s), dropped %llu, reordered %llu\n",
+      (unsigned long long)total.txPackets, total.txPackets / elapsed, total.txBytes / elapsed / 1024.0,
+      (unsigned long long)total.dropped, (unsigned long long)total.reordered);
+    printf("RX: %llu packets (%.0f pkt/s, %.1f kB/s), invalid %llu\n",
+      (unsigned long long)total.rxPackets, total.rxPackets / elapsed, total.rxBytes / elapsed / 1024.0,
+      (unsigned long long)total.rxInvalid);
+    if (total.probesSent > 0) {
+      printf("RTT: %llu/%llu probes answered, p50 %.3f ms, p95 %.3f ms, p99 %.3f ms, max %.3f ms\n",
+        (unsigned long long)total.probesReceived, (unsigned long long)total.probesSent, p50, p95, p99, maxMs);
+    }
+    if (total.safetyAcks > 0) {
+      printf("Safety: %llu commands executed, %llu ACKs sent\n",
+        (unsigned long long)total.safetyCommands, (unsigned long long)total.safetyAcks);
+    }
+    if (total.batchPackets > 0) {
+      printf("Batch: %llu packets carrying %llu commands\n",
+        (unsigned long long)total.batchPackets, (unsigned long long)total.batchCommands);
+    }
+    if (total.clockSyncReplies > 0) {
+      printf("Clock sync: %llu replies\n", (unsigned long long)total.clockSyncReplies);
+    }
+
+    if (config.jsonPath.empty()) return;
+
+    FILE* file = fopen(config.jsonPath.c_str(), "w");
+    if (!file) {
+      fprintf(stderr, "Failed to write %s\n", config.jsonPath.c_str());
+      return;
+    }
+    fprintf(file, "{\n");
+    fprintf(file, "  \"mode\": \"%s\",\n", config.echoMode ? "echo" : "ecu");
+    fprintf(file, "  \"ecus\": %d,\n", config.ecuCount);
+    fprintf(file, "  \"security\": %d,\n", (int)config.security);
+    fprintf(file, "  \"elapsed_s\": %.3f,\n", elapsed);
+    fprintf(file, "  \"tx_packets\": %llu,\n", (unsigned long long)total.txPackets);
+    fprintf(file, "  \"tx_bytes\": %llu,\n", (unsigned long long)total.txBytes);
+    fprintf(file, "  \"rx_packets\": %llu,\n", (unsigned long long)total.rxPackets);
+    fprintf(file, "  \"rx_bytes\": %llu,\n", (unsigned long long)total.rxBytes);
+    fprintf(file, "  \"rx_invalid\": %llu,\n", (unsigned long long)total.rxInvalid);
+    fprintf(file, "  \"dropped\": %llu,\n", (unsigned long long)total.dropped);
+    fprintf(file, "  \"reordered\": %llu,\n", (unsigned long long)total.reordered);
+    fprintf(file, "  \"probes_sent\": %llu,\n", (unsigned long long)total.probesSent);
+    fprintf(file, "  \"probes_received\": %llu,\n", (unsigned long long)total.probesReceived);
+    fprintf(file, "  \"safety_commands\": %llu,\n", (unsigned long long)total.safetyCommands);
+    fprintf(file, "  \"safety_acks\": %llu,\n", (unsigned long long)total.safetyAcks);
+    fprintf(file, "  \"batch_packets\": %llu,\n", (unsigned long long)total.batchPackets);
+    fprintf(file, "  \"batch_commands\": %llu,\n", (unsigned long long)total.batchCommands);
+    fprintf(file, "  \"clock_sync_replies\": %llu,\n", (unsigned long long)total.clockSyncReplies);
+    fprintf(file, "  \"rtt_ms\": { \"p50\": %.4f, \"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f },\n", p50, p95, p99, maxMs);
+    fprintf(file, "  \"per_ecu\": [\n");
+    for (size_t i = 0; i < ecus.size(); i++) {
+      const VirtualECU& ecu = ecus[i];
+      uint64_t commands = 0;
+      for (int ch = 0; ch < 256; ch++) commands += ecu.commandsByChannel[ch];
+      fprintf(file, "    { \"index\": %d, \"port\": %d, \"tx_packets\": %llu, \"rx_packets\": %llu, \"commands\": %llu, \"rx_invalid\": %llu }%s\n",
+        ecu.index, config.basePort + ecu.index,
+        (unsigned long long)ecu.stats.txPackets, (unsigned long long)ecu.stats.rxPackets,
+        (unsigned long long)commands, (unsigned long long)ecu.stats.rxInvalid,
+        i + 1 < ecus.size() ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+    fclose(file);
+  }
+};
+
+// =====================================
+// Command Line
+// =====================================
+
+static void PrintUsage(const char* program) {
+  printf(
+    "Usage: %s [options]\n"
+    "\n"
+    "  --ecus N                Number of virtual ECUs (default 1)\n"
+    "  --server IP:PORT        Telemetry destination / echo listen address (default 127.0.0.1:8888)\n"
+    "  --bind IP               Local bind address for virtual ECUs (default 127.0.0.1)\n"
+    "  --base-port PORT        ECU i listens on PORT+i (default 9000)\n"
+    "  --reply-to-sender       Send telemetry to whoever last sent a command (server-initiated mode)\n"
+    "  --security LEVEL        none | hmac | encrypted (default none)\n"
+    "  --secret STRING         Shared secret (must match FEmbeddedDeviceConfig::SharedSecret)\n"
+    "  --stream CH:TYPE:HZ[:SIZE]\n"
+    "                          Telemetry stream, repeatable. TYPE = bool|int|float|bytes\n"
+    "  --script FILE           Timed stream changes, one '<seconds> CH:TYPE:HZ[:SIZE]' per line\n"
+    "  --jitter MS             Uniform send jitter of +/- MS (default 0)\n"
+    "  --loss PCT              Outbound packet loss percentage (default 0)\n"
+    "  --reorder PCT           Percentage of packets delayed behind the next one (default 0)\n"
+    "  --probe-hz HZ           RTT probe rate per ECU (default 0 = off)\n"
+    "  --probe-channel CH      Channel used for RTT probes (default 254)\n"
+    "  --clock-sync CH         Answer Int32 clock-sync requests on CH with [seq][ECU ms] (GoKart: 102)\n"
+    "  --duration SEC          Run time (default 10)\n"
+    "  --report SEC            Progress report interval (default 1)\n"
+    "  --seed N                Random seed for jitter/loss/reorder/IVs (default 1)\n"
+    "  --json FILE             Write a machine-readable summary\n"
+    "  --echo                  Echo peer mode: listen on --server and reflect every packet\n"
+    "  --quiet                 Only print the final summary\n",
+    program);
+}
+
+static bool ParseStream(const std::string& text, double startSeconds, StreamConfig& out) {
+  char typeName[16] = {};
+  unsigned channel = 0;
+  double rate = 0.0;
+  int size = 4;
+  int fields = sscanf(text.c_str(), "%u:%15[a-z0-9]:%lf:%d", &channel, typeName, &rate, &size);
+  if (fields < 3 || channel > 255 || rate <= 0.0) return false;
+
+  std::string type = typeName;
+  if (type == "bool") out.type = LBEAST_TYPE_BOOL;
+  else if (type == "int" || type == "int32") out.type = LBEAST_TYPE_INT32;
+  else if (type == "float") out.type = LBEAST_TYPE_FLOAT;
+  else if (type == "bytes" || type == "struct") out.type = LBEAST_TYPE_BYTES;
+  else return false;
+
+  out.channel = (uint8_t)channel;
+  out.rateHz = rate;
+  out.size = size;
+  out.startSeconds = startSeconds;
+  return true;
+}
+
+static bool LoadScript(const std::string& path, std::vector<StreamConfig>& streams) {
+  FILE* file = fopen(path.c_str(), "r");
+  if (!file) return false;
+
+  char line[256];
+  int lineNumber = 0;
+  while (fgets(line, sizeof(line), file)) {
+    lineNumber++;
+    if (line[0] == '#' || line[0] == '\n') continue;
+    double at = 0.0;
+    char spec[128] = {};
+    StreamConfig stream;
+    if (sscanf(line, "%lf %127s", &at, spec) != 2 || !ParseStream(spec, at, stream)) {
+      fprintf(stderr, "%s:%d: expected '<seconds> CH:TYPE:HZ[:SIZE]'\n", path.c_str(), lineNumber);
+      fclose(file);
+      return false;
+    }
+    streams.push_back(stream);
+  }
+  fclose(file);
+  return true;
+}
+
+static bool ParseArguments(int argc, char** argv, SimulatorConfig& config) {
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    auto next = [&](const char* name) -> const char* {
+      if (i + 1 >= argc) {
+        fprintf(stderr, "%s requires a value\n", name);
+        exit(2);
+      }
+      return argv[++i];
+    };
+
+    if (arg == "--ecus") config.ecuCount = std::max(1, atoi(next("--ecus")));
+    else if (arg == "--server") {
+      std::string value = next("--server");
+      size_t colon = value.rfind(':');
+      if (colon == std::string::npos) return false;
+      config.serverIP = value.substr(0, colon);
+      config.serverPort = (uint16_t)atoi(value.substr(colon + 1).c_str());
+    }
+    else if (arg == "--bind") config.bindIP = next("--bind");
+    else if (arg == "--base-port") config.basePort = (uint16_t)atoi(next("--base-port"));
+    else if (arg == "--reply-to-sender") config.replyToSender = true;
+    else if (arg == "--security") {
+      std::string level = next("--security");
+      if (level == "none") config.security = LBEAST_SECURITY_NONE;
+      else if (level == "hmac") config.security = LBEAST_SECURITY_HMAC;
+      else if (level == "encrypted") config.security = LBEAST_SECURITY_ENCRYPTED;
+      else return false;
+    }
+    else if (arg == "--secret") config.secret = next("--secret");
+    else if (arg == "--stream") {
+      StreamConfig stream;
+      if (!ParseStream(next("--stream"), 0.0, stream)) return false;
+      config.streams.push_back(stream);
+    }
+    else if (arg == "--script") {
+      if (!LoadScript(next("--script"), config.streams)) return false;
+    }
+    else if (arg == "--jitter") config.jitterMs = atof(next("--jitter"));
+    else if (arg == "--loss") config.lossPercent = atof(next("--loss"));
+    else if (arg == "--reorder") config.reorderPercent = atof(next("--reorder"));
+    else if (arg == "--probe-hz") config.probeHz = atof(next("--probe-hz"));
+    else if (arg == "--probe-channel") config.probeChannel = (uint8_t)atoi(next("--probe-channel"));
+    else if (arg == "--clock-sync") config.clockSyncChannel = atoi(next("--clock-sync")) & 0xFF;
+    else if (arg == "--duration") config.durationSeconds = atof(next("--duration"));
+    else if (arg == "--report") config.reportIntervalSeconds = std::max(0.1, atof(next("--report")));
+    else if (arg == "--seed") config.seed = (uint32_t)strtoul(next("--seed"), nullptr, 10);
+    else if (arg == "--json") config.jsonPath = next("--json");
+    else if (arg == "--echo") config.echoMode = true;
+    else if (arg == "--quiet") config.quiet = true;
+    else if (arg == "--help" || arg == "-h") {
+      PrintUsage(argv[0]);
+      exit(0);
+    }
+    else {
+      fprintf(stderr, "Unknown option: %s\n", arg.c_str());
+      return false;
+    }
+  }
+
+  if (config.echoMode) {
+    // The echo peer is a single socket bound to the server address
+    config.ecuCount = 1;
+    config.bindIP = config.serverIP;
+    config.basePort = config.serverPort;
+    config.streams.clear();
+    config.probeHz = 0.0;
+  }
+  else if (config.streams.empty()) {
+    // Default profile: GunshipExperience_ECU position feedback (FTiltState / FScissorLiftState at 10 Hz)
+    StreamConfig tilt;
+    ParseStream("100:bytes:10:8", 0.0, tilt);
+    StreamConfig lift;
+    ParseStream("101:bytes:10:8", 0.0, lift);
+    config.streams.push_back(tilt);
+    config.streams.push_back(lift);
+  }
+  return true;
+}
+
+int main(int argc, char** argv) {
+  SimulatorConfig config;
+  if (!ParseArguments(argc, argv, config)) {
+    PrintUsage(argv[0]);
+    return 2;
+  }
+
+  signal(SIGINT, HandleSignal);
+  signal(SIGTERM, HandleSignal);
+
+  Simulator simulator(config);
+  if (!simulator.Initialize()) {
+    simulator.Shutdown();
+    return 1;
+  }
+  simulator.Run();
+  simulator.Shutdown();
+  return 0;
+}
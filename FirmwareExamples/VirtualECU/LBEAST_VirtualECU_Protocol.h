@@ -0,0 +1,425 @@
+/*
+ * LBEAST Virtual ECU - Host Protocol Codec
+ *
+ * Host-side (Linux/macOS) implementation of the LBEAST binary protocol used by
+ * the virtual ECU simulator. Mirrors the wire format produced and accepted by
+ * UEmbeddedDeviceController and the LBEAST_Wireless_TX.h / LBEAST_Wireless_RX.h
+ * firmware templates, including the secured formats:
+ *
+ *   None:      [0xAA][Type][Ch][Payload...][CRC:1]
+ *   HMAC:      [0xAA][Type][Ch][Payload...][HMAC:8]
+ *   Encrypted: [0xAA][IV:4][AES-128-CTR(Type|Ch|Payload...)][HMAC:8]
+ *
+ * Key derivation matches UEmbeddedDeviceController::DeriveKeysFromSecret():
+ *   AES key  = SHA1(Secret + "AES128_LBEAST_2025")[0..15]
+ *   HMAC key = SHA1(Secret + "HMAC_LBEAST_2025") (zero-padded to 32 bytes)
+ *   HMAC     = HMAC-SHA1(HMACKey, Packet) truncated to 8 bytes
+ *
+ * CTR counter block (16 bytes): [IV + BlockIdx : LE32][BlockIdx : LE32][0 x 8]
+ *
+ * Self-contained (no OpenSSL / mbedTLS dependency) so it can also be dropped
+ * into ESP32 sketches that want to speak the secured formats.
+ *
+ * Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+ */
+
+#ifndef LBEAST_VIRTUALECU_PROTOCOL_H
+#define LBEAST_VIRTUALECU_PROTOCOL_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Protocol constants
+#define LBEAST_PACKET_START_MARKER 0xAA
+#define LBEAST_HMAC_SIZE 8
+#define LBEAST_MAX_PACKET_SIZE 280
+
+enum LBEASTDataType {
+  LBEAST_TYPE_BOOL = 0,
+  LBEAST_TYPE_INT32 = 1,
+  LBEAST_TYPE_FLOAT = 2,
+  LBEAST_TYPE_STRING = 3,
+  LBEAST_TYPE_BYTES = 4,
+  LBEAST_TYPE_SAFETY = 6,  // [Seq:LE16][Value:1], acknowledged by echoing it back
+  LBEAST_TYPE_BATCH = 7    // [FireDelayMs:LE16][Count:1] then Count x [Type][Ch][Value:1 or 4]
+};
+
+enum LBEASTSecurityLevel {
+  LBEAST_SECURITY_NONE = 0,
+  LBEAST_SECURITY_HMAC = 1,
+  LBEAST_SECURITY_ENCRYPTED = 2
+};
+
+// =====================================
+// SHA-1
+// =====================================
+
+struct LBEAST_SHA1 {
+  uint32_t state[5];
+  uint64_t length;
+  uint8_t block[64];
+  uint32_t blockLen;
+};
+
+static inline uint32_t LBEAST_Rol32(uint32_t value, int bits) {
+  return (value << bits) | (value >> (32 - bits));
+}
+
+static inline void LBEAST_SHA1_Transform(LBEAST_SHA1* ctx, const uint8_t* data) {
+  uint32_t w[80];
+  for (int i = 0; i < 16; i++) {
+    w[i] = ((uint32_t)data[i * 4] << 24) | ((uint32_t)data[i * 4 + 1] << 16) |
+           ((uint32_t)data[i * 4 + 2] << 8) | (uint32_t)data[i * 4 + 3];
+  }
+  for (int i = 16; i < 80; i++) {
+    w[i] = LBEAST_Rol32(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+  }
+
+  uint32_t a = ctx->state[0], b = ctx->state[1], c = ctx->state[2], d = ctx->state[3], e = ctx->state[4];
+  for (int i = 0; i < 80; i++) {
+    uint32_t f, k;
+    if (i < 20)      { f = (b & c) | (~b & d);           k = 0x5A827999; }
+    else if (i < 40) { f = b ^ c ^ d;                    k = 0x6ED9EBA1; }
+    else if (i < 60) { f = (b & c) | (b & d) | (c & d);  k = 0x8F1BBCDC; }
+    else             { f = b ^ c ^ d;                    k = 0xCA62C1D6; }
+    uint32_t temp = LBEAST_Rol32(a, 5) + f + e + k + w[i];
+    e = d;
+    d = c;
+    c = LBEAST_Rol32(b, 30);
+    b = a;
+    a = temp;
+  }
+
+  ctx->state[0] += a;
+  ctx->state[1] += b;
+  ctx->state[2] += c;
+  ctx->state[3] += d;
+  ctx->state[4] += e;
+}
+
+static inline void LBEAST_SHA1_Init(LBEAST_SHA1* ctx) {
+  ctx->state[0] = 0x67452301;
+  ctx->state[1] = 0xEFCDAB89;
+  ctx->state[2] = 0x98BADCFE;
+  ctx->state[3] = 0x10325476;
+  ctx->state[4] = 0xC3D2E1F0;
+  ctx->length = 0;
+  ctx->blockLen = 0;
+}
+
+static inline void LBEAST_SHA1_Update(LBEAST_SHA1* ctx, const uint8_t* data, size_t length) {
+  ctx->length += length;
+  while (length > 0) {
+    uint32_t toCopy = 64 - ctx->blockLen;
+    if (toCopy > length) toCopy = (uint32_t)length;
+    memcpy(ctx->block + ctx->blockLen, data, toCopy);
+    ctx->blockLen += toCopy;
+    data += toCopy;
+    length -= toCopy;
+    if (ctx->blockLen == 64) {
+      LBEAST_SHA1_Transform(ctx, ctx->block);
+      ctx->blockLen = 0;
+    }
+  }
+}
+
+static inline void LBEAST_SHA1_Final(LBEAST_SHA1* ctx, uint8_t out[20]) {
+  uint64_t bitLength = ctx->length * 8;
+  uint8_t pad = 0x80;
+  LBEAST_SHA1_Update(ctx, &pad, 1);
+  pad = 0x00;
+  while (ctx->blockLen != 56) {
+    LBEAST_SHA1_Update(ctx, &pad, 1);
+  }
+  uint8_t lengthBytes[8];
+  for (int i = 0; i < 8; i++) {
+    lengthBytes[i] = (uint8_t)(bitLength >> (56 - i * 8));
+  }
+  LBEAST_SHA1_Update(ctx, lengthBytes, 8);
+  for (int i = 0; i < 5; i++) {
+    out[i * 4] = (uint8_t)(ctx->state[i] >> 24);
+    out[i * 4 + 1] = (uint8_t)(ctx->state[i] >> 16);
+    out[i * 4 + 2] = (uint8_t)(ctx->state[i] >> 8);
+    out[i * 4 + 3] = (uint8_t)(ctx->state[i]);
+  }
+}
+
+// =====================================
+// AES-128 (encrypt direction only - CTR mode never decrypts blocks)
+// =====================================
+
+static const uint8_t LBEAST_AES_SBOX[256] = {
+  0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+  0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+  0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+  0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+  0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+  0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+  0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+  0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+  0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+  0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+  0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+  0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+  0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+  0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+  0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+  0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16
+};
+
+struct LBEAST_AES128 {
+  uint8_t roundKeys[176];
+};
+
+static inline uint8_t LBEAST_AES_XTime(uint8_t x) {
+  return (uint8_t)((x << 1) ^ ((x & 0x80) ? 0x1B : 0x00));
+}
+
+static inline void LBEAST_AES128_Init(LBEAST_AES128* ctx, const uint8_t key[16]) {
+  static const uint8_t rcon[10] = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36 };
+  memcpy(ctx->roundKeys, key, 16);
+  for (int i = 4; i < 44; i++) {
+    uint8_t temp[4];
+    memcpy(temp, &ctx->roundKeys[(i - 1) * 4], 4);
+    if (i % 4 == 0) {
+      uint8_t t = temp[0];
+      temp[0] = LBEAST_AES_SBOX[temp[1]] ^ rcon[i / 4 - 1];
+      temp[1] = LBEAST_AES_SBOX[temp[2]];
+      temp[2] = LBEAST_AES_SBOX[temp[3]];
+      temp[3] = LBEAST_AES_SBOX[t];
+    }
+    for (int j = 0; j < 4; j++) {
+      ctx->roundKeys[i * 4 + j] = ctx->roundKeys[(i - 4) * 4 + j] ^ temp[j];
+    }
+  }
+}
+
+static inline void LBEAST_AES128_EncryptBlock(const LBEAST_AES128* ctx, const uint8_t in[16], uint8_t out[16]) {
+  uint8_t s[16];
+  for (int i = 0; i < 16; i++) s[i] = in[i] ^ ctx->roundKeys[i];
+
+  for (int round = 1; round <= 10; round++) {
+    // SubBytes + ShiftRows (state is column-major: s[col * 4 + row])
+    uint8_t t[16];
+    for (int col = 0; col < 4; col++) {
+      for (int row = 0; row < 4; row++) {
+        t[col * 4 + row] = LBEAST_AES_SBOX[s[((col + row) % 4) * 4 + row]];
+      }
+    }
+    // MixColumns (skipped on final round)
+    if (round != 10) {
+      for (int col = 0; col < 4; col++) {
+        uint8_t* c = &t[col * 4];
+        uint8_t a0 = c[0], a1 = c[1], a2 = c[2], a3 = c[3];
+        uint8_t all = a0 ^ a1 ^ a2 ^ a3;
+        c[0] ^= all ^ LBEAST_AES_XTime(a0 ^ a1);
+        c[1] ^= all ^ LBEAST_AES_XTime(a1 ^ a2);
+        c[2] ^= all ^ LBEAST_AES_XTime(a2 ^ a3);
+        c[3] ^= all ^ LBEAST_AES_XTime(a3 ^ a0);
+      }
+    }
+    // AddRoundKey
+    for (int i = 0; i < 16; i++) s[i] = t[i] ^ ctx->roundKeys[round * 16 + i];
+  }
+
+  memcpy(out, s, 16);
+}
+
+// =====================================
+// LBEAST Security Context
+// =====================================
+
+struct LBEAST_SecurityContext {
+  LBEASTSecurityLevel level;
+  LBEAST_AES128 aes;
+  uint8_t hmacKey[32];
+  uint32_t randomState;
+};
+
+/**
+ * Derive AES/HMAC keys from the shared secret (must match the server's FEmbeddedDeviceConfig::SharedSecret)
+ */
+static inline void LBEAST_Security_Init(LBEAST_SecurityContext* ctx, LBEASTSecurityLevel level, const char* sharedSecret, uint32_t seed) {
+  ctx->level = level;
+  ctx->randomState = seed ? seed : 0x1234567u;
+
+  const char* aesSalt = "AES128_LBEAST_2025";
+  const char* hmacSalt = "HMAC_LBEAST_2025";
+  uint8_t digest[20];
+
+  LBEAST_SHA1 sha;
+  LBEAST_SHA1_Init(&sha);
+  LBEAST_SHA1_Update(&sha, (const uint8_t*)sharedSecret, strlen(sharedSecret));
+  LBEAST_SHA1_Update(&sha, (const uint8_t*)aesSalt, strlen(aesSalt));
+  LBEAST_SHA1_Final(&sha, digest);
+  LBEAST_AES128_Init(&ctx->aes, digest);
+
+  memset(ctx->hmacKey, 0, sizeof(ctx->hmacKey));
+  LBEAST_SHA1_Init(&sha);
+  LBEAST_SHA1_Update(&sha, (const uint8_t*)sharedSecret, strlen(sharedSecret));
+  LBEAST_SHA1_Update(&sha, (const uint8_t*)hmacSalt, strlen(hmacSalt));
+  LBEAST_SHA1_Final(&sha, ctx->hmacKey);
+}
+
+/**
+ * HMAC-SHA1 truncated to 8 bytes
+ */
+static inline void LBEAST_CalculateHMAC(const LBEAST_SecurityContext* ctx, const uint8_t* data, int length, uint8_t out[LBEAST_HMAC_SIZE]) {
+  uint8_t key[64];
+  memset(key, 0, sizeof(key));
+  memcpy(key, ctx->hmacKey, sizeof(ctx->hmacKey));
+
+  uint8_t pad[64];
+  uint8_t innerHash[20];
+  uint8_t outerHash[20];
+  LBEAST_SHA1 sha;
+
+  for (int i = 0; i < 64; i++) pad[i] = key[i] ^ 0x36;
+  LBEAST_SHA1_Init(&sha);
+  LBEAST_SHA1_Update(&sha, pad, 64);
+  LBEAST_SHA1_Update(&sha, data, length);
+  LBEAST_SHA1_Final(&sha, innerHash);
+
+  for (int i = 0; i < 64; i++) pad[i] = key[i] ^ 0x5C;
+  LBEAST_SHA1_Init(&sha);
+  LBEAST_SHA1_Update(&sha, pad, 64);
+  LBEAST_SHA1_Update(&sha, innerHash, 20);
+  LBEAST_SHA1_Final(&sha, outerHash);
+
+  memcpy(out, outerHash, LBEAST_HMAC_SIZE);
+}
+
+/**
+ * AES-128-CTR in place (encrypt and decrypt are the same operation)
+ */
+static inline void LBEAST_CryptCTR(const LBEAST_SecurityContext* ctx, uint8_t* data, int length, uint32_t iv) {
+  for (int blockIdx = 0; blockIdx * 16 < length; blockIdx++) {
+    uint8_t counter[16];
+    uint8_t keystream[16];
+    memset(counter, 0, sizeof(counter));
+    uint32_t current = iv + (uint32_t)blockIdx;
+    counter[0] = current & 0xFF;
+    counter[1] = (current >> 8) & 0xFF;
+    counter[2] = (current >> 16) & 0xFF;
+    counter[3] = (current >> 24) & 0xFF;
+    counter[4] = blockIdx & 0xFF;
+    counter[5] = (blockIdx >> 8) & 0xFF;
+    counter[6] = (blockIdx >> 16) & 0xFF;
+    counter[7] = (blockIdx >> 24) & 0xFF;
+    LBEAST_AES128_EncryptBlock(&ctx->aes, counter, keystream);
+
+    int bytesInBlock = length - blockIdx * 16;
+    if (bytesInBlock > 16) bytesInBlock = 16;
+    for (int i = 0; i < bytesInBlock; i++) {
+      data[blockIdx * 16 + i] ^= keystream[i];
+    }
+  }
+}
+
+static inline uint32_t LBEAST_NextIV(LBEAST_SecurityContext* ctx) {
+  // xorshift32, same generator as UEmbeddedDeviceController::GenerateRandomIV()
+  ctx->randomState ^= ctx->randomState << 13;
+  ctx->randomState ^= ctx->randomState >> 17;
+  ctx->randomState ^= ctx->randomState << 5;
+  return ctx->randomState;
+}
+
+static inline uint8_t LBEAST_CalculateCRC(const uint8_t* data, int length) {
+  uint8_t crc = 0;
+  for (int i = 0; i < length; i++) {
+    crc ^= data[i];
+  }
+  return crc;
+}
+
+// =====================================
+// Packet Building / Parsing
+// =====================================
+
+/**
+ * Build a packet for the given security level
+ * @param payload Type-specific payload (e.g. 4 bytes LE for float, [len][bytes] for string/bytes)
+ * @return Packet length written to out (0 on overflow)
+ */
+static inline int LBEAST_BuildPacket(LBEAST_SecurityContext* ctx, uint8_t type, uint8_t channel,
+                              const uint8_t* payload, int payloadLength, uint8_t* out, int outCapacity) {
+  if (ctx->level == LBEAST_SECURITY_ENCRYPTED) {
+    int length = 1 + 4 + 2 + payloadLength + LBEAST_HMAC_SIZE;
+    if (length > outCapacity) return 0;
+    uint32_t iv = LBEAST_NextIV(ctx);
+    out[0] = LBEAST_PACKET_START_MARKER;
+    out[1] = iv & 0xFF;
+    out[2] = (iv >> 8) & 0xFF;
+    out[3] = (iv >> 16) & 0xFF;
+    out[4] = (iv >> 24) & 0xFF;
+    out[5] = type;
+    out[6] = channel;
+    memcpy(&out[7], payload, payloadLength);
+    LBEAST_CryptCTR(ctx, &out[5], 2 + payloadLength, iv);
+    LBEAST_CalculateHMAC(ctx, out, length - LBEAST_HMAC_SIZE, &out[length - LBEAST_HMAC_SIZE]);
+    return length;
+  }
+
+  int trailer = (ctx->level == LBEAST_SECURITY_HMAC) ? LBEAST_HMAC_SIZE : 1;
+  int length = 3 + payloadLength + trailer;
+  if (length > outCapacity) return 0;
+  out[0] = LBEAST_PACKET_START_MARKER;
+  out[1] = type;
+  out[2] = channel;
+  memcpy(&out[3], payload, payloadLength);
+  if (ctx->level == LBEAST_SECURITY_HMAC) {
+    LBEAST_CalculateHMAC(ctx, out, length - LBEAST_HMAC_SIZE, &out[length - LBEAST_HMAC_SIZE]);
+  } else {
+    out[length - 1] = LBEAST_CalculateCRC(out, length - 1);
+  }
+  return length;
+}
+
+/**
+ * Validate and decode a packet in place
+ * @param outPayload Set to the start of the (decrypted) payload inside data
+ * @return true if the packet is well-formed and authenticated
+ */
+static inline bool LBEAST_ParsePacket(const LBEAST_SecurityContext* ctx, uint8_t* data, int length,
+                               uint8_t* outType, uint8_t* outChannel, uint8_t** outPayload, int* outPayloadLength) {
+  if (length < 1 || data[0] != LBEAST_PACKET_START_MARKER) return false;
+
+  if (ctx->level == LBEAST_SECURITY_ENCRYPTED || ctx->level == LBEAST_SECURITY_HMAC) {
+    int minLength = (ctx->level == LBEAST_SECURITY_ENCRYPTED) ? 15 : 12;
+    if (length < minLength) return false;
+
+    uint8_t expected[LBEAST_HMAC_SIZE];
+    LBEAST_CalculateHMAC(ctx, data, length - LBEAST_HMAC_SIZE, expected);
+    uint8_t diff = 0;
+    for (int i = 0; i < LBEAST_HMAC_SIZE; i++) {
+      diff |= expected[i] ^ data[length - LBEAST_HMAC_SIZE + i];
+    }
+    if (diff != 0) return false;
+
+    if (ctx->level == LBEAST_SECURITY_ENCRYPTED) {
+      uint32_t iv = (uint32_t)data[1] | ((uint32_t)data[2] << 8) | ((uint32_t)data[3] << 16) | ((uint32_t)data[4] << 24);
+      int cipherLength = length - 5 - LBEAST_HMAC_SIZE;
+      LBEAST_CryptCTR(ctx, &data[5], cipherLength, iv);
+      *outType = data[5];
+      *outChannel = data[6];
+      *outPayload = &data[7];
+      *outPayloadLength = cipherLength - 2;
+    } else {
+      *outType = data[1];
+      *outChannel = data[2];
+      *outPayload = &data[3];
+      *outPayloadLength = length - 3 - LBEAST_HMAC_SIZE;
+    }
+    return true;
+  }
+
+  if (length < 5) return false;
+  if (LBEAST_CalculateCRC(data, length - 1) != data[length - 1]) return false;
+  *outType = data[1];
+  *outChannel = data[2];
+  *outPayload = &data[3];
+  *outPayloadLength = length - 4;
+  return true;
+}
+
+#endif // LBEAST_VIRTUALECU_PROTOCOL_H
@@ -8,6 +8,19 @@
 #include "JsonUtilities.h"
 #include "Misc/SecureHash.h"
 #include "Misc/AES.h"
+#include "EmbeddedSystems.h"
+
+DECLARE_CYCLE_STAT(TEXT("EmbeddedDeviceController Tick"), STAT_EmbeddedDeviceController_Tick, STATGROUP_LBEASTEmbeddedSystems);
+DECLARE_CYCLE_STAT(TEXT("Build Binary Packet"), STAT_Embedded_BuildPacket, STATGROUP_LBEASTEmbeddedSystems);
+DECLARE_CYCLE_STAT(TEXT("Parse Binary Packet"), STAT_Embedded_ParseBinaryPacket, STATGROUP_LBEASTEmbeddedSystems);
+DECLARE_CYCLE_STAT(TEXT("Parse JSON Packet"), STAT_Embedded_ParseJSONPacket, STATGROUP_LBEASTEmbeddedSystems);
+DECLARE_CYCLE_STAT(TEXT("AES-128 Encrypt/Decrypt"), STAT_Embedded_AES, STATGROUP_LBEASTEmbeddedSystems);
+DECLARE_CYCLE_STAT(TEXT("HMAC-SHA1"), STAT_Embedded_HMAC, STATGROUP_LBEASTEmbeddedSystems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Device Packets Received"), STAT_Embedded_PacketsReceived, STATGROUP_LBEASTEmbeddedSystems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Device Bytes Received"), STAT_Embedded_BytesReceived, STATGROUP_LBEASTEmbeddedSystems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Device Packets Built"), STAT_Embedded_PacketsBuilt, STATGROUP_LBEASTEmbeddedSystems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Batched Commands"), STAT_Embedded_BatchedCommands, STATGROUP_LBEASTEmbeddedSystems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Batch Packets Sent"), STAT_Embedded_BatchPackets, STATGROUP_LBEASTEmbeddedSystems);
 
 UEmbeddedDeviceController::UEmbeddedDeviceController()
 {
@@ -37,6 +50,7 @@ void UEmbeddedDeviceController::EndPlay(const EEndPlayReason::Type EndPlayReason
 void UEmbeddedDeviceController::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	EMBEDDEDSYSTEMS_SCOPE_CYCLE_COUNTER(STAT_EmbeddedDeviceController_Tick);
 
 	if (!bIsConnected)
 	{
@@ -217,7 +231,7 @@ void UEmbeddedDeviceController::ProcessIncomingData()
 	{
 	case ELBEASTCommProtocol::WiFi:
 	case ELBEASTCommProtocol::Ethernet:
-		ReceiveWiFiData();
+		// NOOP: UDP packets are received by ULBEASTUDPTransport and delivered via HandleReceivedPacket()
 		break;
 
 	case ELBEASTCommProtocol::Serial:
@@ -262,29 +276,26 @@ void UEmbeddedDeviceController::SendWiFiData(const TArray<uint8>& Data)
 	SendUDPData(Data);
 }
 
-void UEmbeddedDeviceController::ReceiveWiFiData()
+void UEmbeddedDeviceController::HandleReceivedPacket(const TArray<uint8>& Data, int32 Length)
 {
-	// Use base class's UDPTransport to get raw packets, then parse with encryption/HMAC support
-	TArray<uint8> ReceivedData;
-	int32 BytesRead = 0;
-	TSharedPtr<FInternetAddr> SenderAddr;
+	// Called by ULBEASTUDPTransport for every received packet (I/O reactor batch or tick drain)
+	UE_LOG(LogTemp, VeryVerbose, TEXT("EmbeddedDeviceController: Received %d bytes"), Length);
+	EMBEDDEDSYSTEMS_INC_COUNTER(STAT_Embedded_PacketsReceived, 1);
+	EMBEDDEDSYSTEMS_INC_COUNTER(STAT_Embedded_BytesReceived, Length);
 
-	// Access protected UDPTransport member from base class
-	if (UDPTransport.ReceiveUDPData(ReceivedData, BytesRead, &SenderAddr))
+	// Parse the received data (with encryption/HMAC support if enabled)
+	if (Config.bDebugMode)
 	{
-		UE_LOG(LogTemp, VeryVerbose, TEXT("EmbeddedDeviceController: Received %d bytes"), BytesRead);
-
-		// Parse the received data (with encryption/HMAC support if enabled)
-		if (Config.bDebugMode)
-		{
-			ParseJSONPacket(ReceivedData, BytesRead);
-		}
-		else
-		{
-			ParseBinaryPacket(ReceivedData, BytesRead);
-		}
+		ParseJSONPacket(Data, Length);
+	}
+	else
+	{
+		ParseBinaryPacket(Data, Length);
+	}
 
-		LastCommTimestamp = GetWorld()->GetTimeSeconds();
+	if (UWorld* World = GetWorld())
+	{
+		LastCommTimestamp = World->GetTimeSeconds();
 	}
 }
 
@@ -293,8 +304,8 @@ void UEmbeddedDeviceController::CheckConnectionHealth()
 	float CurrentTime = GetWorld()->GetTimeSeconds();
 	float TimeSinceLastComm = CurrentTime - LastCommTimestamp;
 
-	// If no communication for 5 seconds, consider connection lost
-	if (TimeSinceLastComm > 5.0f && bIsConnected)
+	// Same timeout the device health service uses (it raises the early warning before this trips)
+	if (HealthConfig.TimeoutSeconds > 0.0f && TimeSinceLastComm > HealthConfig.TimeoutSeconds && bIsConnected)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("EmbeddedDeviceController: Connection timeout - no data received for %.1f seconds"), TimeSinceLastComm);
 		bIsConnected = false;
@@ -422,12 +433,143 @@ void UEmbeddedDeviceController::SendBytes(int32 Channel, const TArray<uint8>& Da
 	SendDataToDevice(Packet);
 }
 
+// =====================================
+// Batched Send API
+// =====================================
+
+void UEmbeddedDeviceController::QueueBool(int32 Channel, bool Value)
+{
+	QueueCommand(ELBEASTDataType::Bool, Channel, Value ? 1u : 0u);
+}
+
+void UEmbeddedDeviceController::QueueInt32(int32 Channel, int32 Value)
+{
+	QueueCommand(ELBEASTDataType::Int32, Channel, static_cast<uint32>(Value));
+}
+
+void UEmbeddedDeviceController::QueueFloat(int32 Channel, float Value)
+{
+	uint32 Bits;
+	FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+	QueueCommand(ELBEASTDataType::Float, Channel, Bits);
+}
+
+void UEmbeddedDeviceController::QueueCommand(ELBEASTDataType Type, int32 Channel, uint32 Bits)
+{
+	// Last write wins within a frame (a handful of entries, linear search is cheapest)
+	for (FQueuedCommand& Queued : QueuedCommands)
+	{
+		if (Queued.Type == Type && Queued.Channel == (uint8)Channel)
+		{
+			Queued.Bits = Bits;
+			return;
+		}
+	}
+
+	QueuedCommands.Add({ Type, (uint8)Channel, Bits });
+}
+
+int32 UEmbeddedDeviceController::FlushQueuedCommands(int32 FireDelayMs, uint8 GroupId)
+{
+	if (QueuedCommands.Num() == 0)
+	{
+		return 0;
+	}
+
+	if (!bIsConnected)
+	{
+		QueuedCommands.Reset();
+		return 0;
+	}
+
+	EMBEDDEDSYSTEMS_INC_COUNTER(STAT_Embedded_BatchedCommands, QueuedCommands.Num());
+	int32 PacketsSent = 0;
+
+	if (Config.bDebugMode)
+	{
+		for (const FQueuedCommand& Queued : QueuedCommands)
+		{
+			switch (Queued.Type)
+			{
+			case ELBEASTDataType::Bool:
+				SendBool(Queued.Channel, Queued.Bits != 0);
+				break;
+			case ELBEASTDataType::Int32:
+				SendInt32(Queued.Channel, static_cast<int32>(Queued.Bits));
+				break;
+			default:
+			{
+				float Value;
+				FMemory::Memcpy(&Value, &Queued.Bits, sizeof(Value));
+				SendFloat(Queued.Channel, Value);
+				break;
+			}
+			}
+			PacketsSent++;
+		}
+		QueuedCommands.Reset();
+		return PacketsSent;
+	}
+
+	const uint16 Delay = (uint16)FMath::Clamp(FireDelayMs, 0, 0xFFFF);
+	TArray<uint8> Payload;
+	Payload.Reserve(MAX_BATCH_PAYLOAD_BYTES + 6);
+
+	auto SendBatch = [&](int32 Count)
+	{
+		Payload[2] = (uint8)Count;
+		SendDataToDevice(BuildBinaryPacket(ELBEASTDataType::Batch, GroupId, Payload));
+		EMBEDDEDSYSTEMS_INC_COUNTER(STAT_Embedded_BatchPackets, 1);
+		PacketsSent++;
+	};
+
+	int32 Count = 0;
+	for (const FQueuedCommand& Queued : QueuedCommands)
+	{
+		const int32 EntrySize = Queued.Type == ELBEASTDataType::Bool ? 3 : 6;
+		if (Count == 0 || Payload.Num() + EntrySize > MAX_BATCH_PAYLOAD_BYTES || Count == 255)
+		{
+			if (Count > 0)
+			{
+				SendBatch(Count);
+			}
+			Payload.Reset();
+			Payload.Add(Delay & 0xFF);
+			Payload.Add((Delay >> 8) & 0xFF);
+			Payload.Add(0); // Count, patched in SendBatch
+			Count = 0;
+		}
+
+		Payload.Add((uint8)Queued.Type);
+		Payload.Add(Queued.Channel);
+		if (Queued.Type == ELBEASTDataType::Bool)
+		{
+			Payload.Add((uint8)Queued.Bits);
+		}
+		else
+		{
+			// Little-endian, same as the single-command packets
+			Payload.Add((Queued.Bits) & 0xFF);
+			Payload.Add((Queued.Bits >> 8) & 0xFF);
+			Payload.Add((Queued.Bits >> 16) & 0xFF);
+			Payload.Add((Queued.Bits >> 24) & 0xFF);
+		}
+		Count++;
+	}
+	SendBatch(Count);
+
+	QueuedCommands.Reset();
+	return PacketsSent;
+}
+
 // =====================================
 // Binary Protocol - Packet Building
 // =====================================
 
 TArray<uint8> UEmbeddedDeviceController::BuildBinaryPacket(ELBEASTDataType Type, int32 Channel, const TArray<uint8>& Payload)
 {
+	EMBEDDEDSYSTEMS_SCOPE_CYCLE_COUNTER(STAT_Embedded_BuildPacket);
+	EMBEDDEDSYSTEMS_INC_COUNTER(STAT_Embedded_PacketsBuilt, 1);
 	TArray<uint8> Packet;
 
 	// Security level determines packet format
@@ -489,6 +631,21 @@ TArray<uint8> UEmbeddedDeviceController::BuildBinaryPacket(ELBEASTDataType Type,
 	return Packet;
 }
 
+TArray<uint8> UEmbeddedDeviceController::BuildDevicePacket(ELBEASTUDPDataType DataType, int32 Channel, const TArray<uint8>& Payload)
+{
+	if (Config.bDebugMode)
+	{
+		if (DataType == ELBEASTUDPDataType::Bool && Payload.Num() > 0)
+		{
+			return BuildJSONPacket(ELBEASTDataType::Bool, Channel, Payload[0] != 0 ? TEXT("true") : TEXT("false"));
+		}
+		return TArray<uint8>();
+	}
+
+	// Both enums mirror the same wire type ids
+	return BuildBinaryPacket((ELBEASTDataType)DataType, Channel, Payload);
+}
+
 TArray<uint8> UEmbeddedDeviceController::BuildJSONPacket(ELBEASTDataType Type, int32 Channel, const FString& ValueString)
 {
 	// Build JSON: {"ch":0,"type":"float","val":3.14}
@@ -520,6 +677,8 @@ TArray<uint8> UEmbeddedDeviceController::BuildJSONPacket(ELBEASTDataType Type, i
 
 void UEmbeddedDeviceController::ParseBinaryPacket(const TArray<uint8>& Data, int32 Length)
 {
+	EMBEDDEDSYSTEMS_SCOPE_CYCLE_COUNTER(STAT_Embedded_ParseBinaryPacket);
+
 	// Validate start marker (common to all formats) - use base class constant
 	if (Length < 1 || Data[0] != ULBEASTUDPTransport::PACKET_START_MARKER)
 	{
@@ -698,6 +857,15 @@ void UEmbeddedDeviceController::ParseBinaryPacket(const TArray<uint8>& Data, int
 		break;
 	}
 
+	case ELBEASTDataType::Safety:
+	{
+		// ECU ACK for a safety lane command: [Sequence:LE16][Value:1]
+		if (PayloadData.Num() < 3) return;
+		const uint16 Sequence = PayloadData[0] | (PayloadData[1] << 8);
+		FLBEASTSafetyLane::Get().Acknowledge(this, Channel, Sequence);
+		break;
+	}
+
 	default:
 		UE_LOG(LogTemp, Warning, TEXT("EmbeddedDeviceController: Unknown data type (%d)"), (int32)Type);
 		break;
@@ -706,6 +874,8 @@ void UEmbeddedDeviceController::ParseBinaryPacket(const TArray<uint8>& Data, int
 
 void UEmbeddedDeviceController::ParseJSONPacket(const TArray<uint8>& Data, int32 Length)
 {
+	EMBEDDEDSYSTEMS_SCOPE_CYCLE_COUNTER(STAT_Embedded_ParseJSONPacket);
+
 	// Convert bytes to string
 	FUTF8ToTCHAR Converter((const ANSICHAR*)Data.GetData(), Length);
 	FString JsonString(Converter.Length(), Converter.Get());
@@ -818,6 +988,8 @@ void UEmbeddedDeviceController::DeriveKeysFromSecret()
 
 TArray<uint8> UEmbeddedDeviceController::EncryptAES128(const TArray<uint8>& Plaintext, uint32 IV) const
 {
+	EMBEDDEDSYSTEMS_SCOPE_CYCLE_COUNTER(STAT_Embedded_AES);
+
 	if (Plaintext.Num() == 0)
 	{
 		return TArray<uint8>();
@@ -875,6 +1047,8 @@ TArray<uint8> UEmbeddedDeviceController::DecryptAES128(const TArray<uint8>& Ciph
 
 TArray<uint8> UEmbeddedDeviceController::CalculateHMAC(const TArray<uint8>& Data) const
 {
+	EMBEDDEDSYSTEMS_SCOPE_CYCLE_COUNTER(STAT_Embedded_HMAC);
+
 	// HMAC-SHA1 (Unreal's FSHA1 doesn't expose HMAC, so we'll implement it)
 	// HMAC(K, m) = H((K' ⊕ opad) || H((K' ⊕ ipad) || m))
 	// Where K' = K padded to block size (64 bytes for SHA-1)
@@ -2,6 +2,8 @@
 
 #include "EmbeddedSystems.h"
 
+LBEAST_DEFINE_TRACE_CHANNEL(LBEASTEmbeddedSystemsChannel);
+
 #define LOCTEXT_NAMESPACE "FEmbeddedSystemsModule"
 
 void FEmbeddedSystemsModule::StartupModule()
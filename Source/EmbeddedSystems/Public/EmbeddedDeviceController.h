@@ -189,7 +189,9 @@ enum class ELBEASTDataType : uint8
 	Float = 2 UMETA(DisplayName = "Float"),
 	String = 3 UMETA(DisplayName = "String"),
 	Bytes = 4 UMETA(DisplayName = "Raw Bytes"),
-	Struct = 5 UMETA(DisplayName = "Struct")
+	Struct = 5 UMETA(DisplayName = "Struct"),
+	Safety = 6 UMETA(DisplayName = "Safety (Acknowledged)"),
+	Batch = 7 UMETA(DisplayName = "Batch (Multiple Commands)")
 };
 
 /**
@@ -206,6 +208,9 @@ class EMBEDDEDSYSTEMS_API UEmbeddedDeviceController : public ULBEASTUDPTransport
 {
 	GENERATED_BODY()
 
+	/** LBEASTBenchmarks times secure packet build/parse and AES/HMAC directly */
+	friend struct FLBEASTBenchmarkAccess;
+
 public:	
 	UEmbeddedDeviceController();
 
@@ -293,6 +298,9 @@ public:
 	 */
 	void SendInt32(int32 Channel, int32 Value);
 
+	/** Telemetry interval commands go through the secured SendInt32 */
+	virtual void SendTelemetryInterval(int32 Channel, int32 IntervalMs) override { SendInt32(Channel, IntervalMs); }
+
 	/**
 	 * Send a float value to device (with encryption/HMAC support)
 	 * @param Channel - Channel/pin number
@@ -329,6 +337,36 @@ public:
 		SendBytes(Channel, Bytes);
 	}
 
+	// =====================================
+	// Batched Send API
+	// =====================================
+	// Queued commands go out together on FlushQueuedCommands() as Batch packets:
+	// [FireDelayMs:LE16][Count:1] then Count x [Type:1][Ch:1][Value:1 or 4]
+	// One datagram and one HMAC/encryption pass cover every command queued that frame.
+	// A later command for the same channel and type replaces the queued one.
+	// Nothing is sent until the owner flushes, normally once per frame after game logic has run.
+
+	/** Queue a boolean command for the next flush */
+	void QueueBool(int32 Channel, bool Value);
+
+	/** Queue an integer command for the next flush */
+	void QueueInt32(int32 Channel, int32 Value);
+
+	/** Queue a float command for the next flush */
+	void QueueFloat(int32 Channel, float Value);
+
+	/** True if commands are waiting for FlushQueuedCommands() */
+	bool HasQueuedCommands() const { return QueuedCommands.Num() > 0; }
+
+	/**
+	 * Send every queued command (split into several Batch packets only if one would overflow the firmware RX buffer)
+	 * JSON debug mode has no batch format, so queued commands are sent one packet each there.
+	 * @param FireDelayMs - Device holds the batch this long after receipt before applying it (0 = apply on receipt)
+	 * @param GroupId - Carried in the packet channel byte so firmware can tell groups apart (0 = ungrouped)
+	 * @return Number of packets sent
+	 */
+	int32 FlushQueuedCommands(int32 FireDelayMs = 0, uint8 GroupId = 0);
+
 	/**
 	 * Get digital input state (button press)
 	 * @param Channel - Channel/pin number
@@ -350,6 +388,9 @@ protected:
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+	/** Parse received UDP packets with encryption/HMAC support (overrides plain CRC parsing) */
+	virtual void HandleReceivedPacket(const TArray<uint8>& Data, int32 Length) override;
+
 private:
 	/** Whether device is initialized and connected */
 	bool bIsConnected = false;
@@ -376,6 +417,23 @@ private:
 	/** Random number generator state */
 	uint32 RandomState;
 
+	/** A command waiting for FlushQueuedCommands() (fixed-size types only, value kept as raw little-endian bits) */
+	struct FQueuedCommand
+	{
+		ELBEASTDataType Type;
+		uint8 Channel;
+		uint32 Bits;
+	};
+
+	/** Commands queued since the last flush */
+	TArray<FQueuedCommand> QueuedCommands;
+
+	/** Batch payloads stay well inside the 256-byte firmware RX buffer once IV/HMAC overhead is added */
+	static constexpr int32 MAX_BATCH_PAYLOAD_BYTES = 200;
+
+	/** Add or replace a queued command */
+	void QueueCommand(ELBEASTDataType Type, int32 Channel, uint32 Bits);
+
 	/**
 	 * Process incoming data from device
 	 */
@@ -406,17 +464,18 @@ private:
 	 */
 	void SendWiFiData(const TArray<uint8>& Data);
 
-	/**
-	 * Receive data via UDP - uses base class
-	 */
-	void ReceiveWiFiData();
-
 	/**
 	 * Build binary packet for transmission (with encryption/HMAC support)
 	 * Overrides base class to add security features
 	 */
 	TArray<uint8> BuildBinaryPacket(ELBEASTDataType Type, int32 Channel, const TArray<uint8>& Payload);
 
+	/**
+	 * Safety lane packets use the configured security level
+	 * JSON debug mode has no safety format, so SendSafetyBool() falls back to a plain bool there.
+	 */
+	virtual TArray<uint8> BuildDevicePacket(ELBEASTUDPDataType DataType, int32 Channel, const TArray<uint8>& Payload) override;
+
 	/**
 	 * Build JSON packet for transmission (debug mode)
 	 */
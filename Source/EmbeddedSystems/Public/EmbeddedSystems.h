@@ -4,6 +4,15 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "LBEASTStats.h"
+
+/** Stats group ("stat LBEASTEmbeddedSystems") and Unreal Insights channel for this module (see LBEASTStats.h) */
+DECLARE_STATS_GROUP(TEXT("LBEAST EmbeddedSystems"), STATGROUP_LBEASTEmbeddedSystems, STATCAT_Advanced);
+LBEAST_DECLARE_TRACE_CHANNEL(LBEASTEmbeddedSystemsChannel, EMBEDDEDSYSTEMS_API);
+
+#define EMBEDDEDSYSTEMS_SCOPE_CYCLE_COUNTER(StatId) LBEAST_SCOPE_CYCLE_COUNTER(StatId, "EmbeddedSystems", LBEASTEmbeddedSystemsChannel)
+#define EMBEDDEDSYSTEMS_INC_COUNTER(StatId, Amount) LBEAST_INC_COUNTER(StatId, "EmbeddedSystems", Amount)
+#define EMBEDDEDSYSTEMS_SET_GAUGE(StatId, Value) LBEAST_SET_GAUGE(StatId, "EmbeddedSystems", Value)
 
 /**
  * Embedded Systems Module
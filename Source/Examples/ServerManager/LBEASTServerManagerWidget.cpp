@@ -6,6 +6,10 @@
 #include "Misc/Paths.h"
 #include "HAL/PlatformProcess.h"
 #include "Misc/FileHelper.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/CoreStyle.h"
+#include "Fonts/FontMeasure.h"
+#include "Framework/Application/SlateApplication.h"
 
 void ULBEASTServerManagerWidget::NativeConstruct()
 {
@@ -80,6 +84,7 @@ void ULBEASTServerManagerWidget::NativeTick(const FGeometry& MyGeometry, float I
 	{
 		StatusPollTimer = 0.0f;
 		PollServerStatus();
+		UpdateServerPerfSamples();
 	}
 
 	// Update uptime if server is running
@@ -511,3 +516,82 @@ TArray<FLBEASTServerInfo> ULBEASTServerManagerWidget::GetDiscoveredServers() con
 	return TArray<FLBEASTServerInfo>();
 }
 
+// =====================================
+// Perf Overlay
+// =====================================
+
+void ULBEASTServerManagerWidget::UpdateServerPerfSamples()
+{
+	ServerPerfSamples.Reset();
+	ServerFrameTimeMs = 0.0f;
+
+	if (!ServerStatus.bIsRunning || !ServerBeacon || !ServerBeacon->IsActive())
+	{
+		return;
+	}
+
+	// OnServerDiscovered only fires once per server; the discovered list is refreshed on every beacon
+	for (const FLBEASTServerInfo& ServerInfo : ServerBeacon->GetDiscoveredServers())
+	{
+		if (ServerInfo.ServerPort == ExpectedServerPort)
+		{
+			ServerPerfSamples = ServerInfo.PerfSamples;
+			ServerFrameTimeMs = ServerInfo.ServerFrameTimeMs;
+			return;
+		}
+	}
+}
+
+FString ULBEASTServerManagerWidget::GetPerfOverlayText() const
+{
+	if (ServerPerfSamples.Num() == 0)
+	{
+		return FString();
+	}
+
+	FString Text = FString::Printf(TEXT("Server frame: %.2f ms"), ServerFrameTimeMs);
+	for (const FLBEASTPerfSample& Sample : ServerPerfSamples)
+	{
+		Text += TEXT("\n");
+		Text += Sample.ToDisplayString();
+	}
+	return Text;
+}
+
+int32 ULBEASTServerManagerWidget::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	int32 MaxLayerId = Super::NativePaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
+
+	if (!bShowPerfOverlay || ServerPerfSamples.Num() == 0)
+	{
+		return MaxLayerId;
+	}
+
+	const FString OverlayText = GetPerfOverlayText();
+	const FSlateFontInfo Font = FCoreStyle::GetDefaultFontStyle("Mono", 9);
+	const FVector2D TextSize = FSlateApplication::Get().GetRenderer()->GetFontMeasureService()->Measure(OverlayText, Font);
+
+	const float Padding = 6.0f;
+	const FVector2D PanelSize = TextSize + FVector2D(Padding * 2.0f, Padding * 2.0f);
+	const FVector2D PanelPosition(AllottedGeometry.GetLocalSize().X - PanelSize.X - Padding, Padding);
+
+	FSlateDrawElement::MakeBox(
+		OutDrawElements,
+		MaxLayerId + 1,
+		AllottedGeometry.ToPaintGeometry(PanelSize, FSlateLayoutTransform(PanelPosition)),
+		FCoreStyle::Get().GetBrush("GenericWhiteBox"),
+		ESlateDrawEffect::None,
+		FLinearColor(0.0f, 0.0f, 0.0f, 0.6f));
+
+	FSlateDrawElement::MakeText(
+		OutDrawElements,
+		MaxLayerId + 2,
+		AllottedGeometry.ToPaintGeometry(TextSize, FSlateLayoutTransform(PanelPosition + FVector2D(Padding, Padding))),
+		OverlayText,
+		Font,
+		ESlateDrawEffect::None,
+		FLinearColor(0.2f, 1.0f, 0.4f));
+
+	return MaxLayerId + 2;
+}
@@ -129,6 +129,8 @@ class EXAMPLES_API ULBEASTServerManagerWidget : public UUserWidget
 public:
 	virtual void NativeConstruct() override;
 	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+	virtual int32 NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
 
 	/** Connection mode (Local or Remote) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Server Manager")
@@ -164,6 +166,24 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Server Manager")
 	FOmniverseStatus OmniverseStatus;
 
+	/** Draw the live server perf overlay (top-right corner, on top of the Blueprint layout) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Server Manager|Perf")
+	bool bShowPerfOverlay = true;
+
+	/** Busiest server perf stats from the latest beacon (see LBEASTStats.h) */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Server Manager|Perf")
+	TArray<FLBEASTPerfSample> ServerPerfSamples;
+
+	/** Server frame time from the latest beacon (ms) */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Server Manager|Perf")
+	float ServerFrameTimeMs = 0.0f;
+
+	/**
+	 * Get the perf overlay as multi-line text (for Blueprint layouts that draw their own panel)
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|Server Manager|Perf")
+	FString GetPerfOverlayText() const;
+
 	/**
 	 * Start the dedicated server with current configuration
 	 */
@@ -255,6 +275,9 @@ protected:
 	UFUNCTION()
 	void OnServerStatusReceived(const struct FLBEASTServerInfo& ServerInfo);
 
+	/** Copy the latest perf stats for our server out of the beacon's discovered list */
+	void UpdateServerPerfSamples();
+
 	/** Timer for status polling */
 	float StatusPollTimer = 0.0f;
 	float StatusPollInterval = 1.0f;
@@ -44,7 +44,8 @@ public class LBEASTAI : ModuleRules
 			{
 				"Slate",
 				"SlateCore",
-				"ImageWrapper"  // For decoding base64 image data from NVIDIA ACE
+				"ImageWrapper",  // For decoding base64 image data from NVIDIA ACE
+				"Sockets"  // For the Docker Engine API (TCP endpoint)
 			}
 		);
 
@@ -2,6 +2,8 @@
 
 #include "AI.h"
 
+LBEAST_DEFINE_TRACE_CHANNEL(LBEASTAIChannel);
+
 #define LOCTEXT_NAMESPACE "FLBEASTAIModule"
 
 void FLBEASTAIModule::StartupModule()
@@ -168,6 +168,12 @@ void UAIGRPCClient::ExecuteASRCall(const FAIASRRequest& Request, TFunction<void(
 #endif // WITH_TURBOLINK
 }
 
+bool UAIGRPCClient::IsTTSSynthesisImplemented() const
+{
+	// Flip once ExecuteTTSCall() issues the real Riva Synthesize call
+	return false;
+}
+
 void UAIGRPCClient::ExecuteTTSCall(const FAITTSRequest& Request, TFunction<void(const FAITTSResponse&)> Callback)
 {
 #if WITH_TURBOLINK
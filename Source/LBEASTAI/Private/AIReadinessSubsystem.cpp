@@ -0,0 +1,482 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "AIReadinessSubsystem.h"
+#include "AI.h"
+#include "AIGRPCClient.h"
+#include "AIHTTPClient.h"
+#include "ASRProviderManager.h"
+#include "LLMProviderManager.h"
+#include "Async/Async.h"
+#include "Dom/JsonObject.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Base64.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("AI Warm-up Requests"), STAT_AIReadiness_Requests, STATGROUP_LBEASTAI);
+
+namespace
+{
+	/** Mono 16-bit PCM WAV of silence (Audio2Face takes a file, not raw PCM) */
+	TArray<uint8> MakeSilentWav(int32 SampleRate, float Seconds)
+	{
+		const uint32 DataBytes = (uint32)(SampleRate * Seconds) * 2;
+		TArray<uint8> Wav;
+		Wav.Reserve(44 + DataBytes);
+
+		auto Append32 = [&Wav](uint32 Value) { Wav.Append(reinterpret_cast<const uint8*>(&Value), 4); };
+		auto Append16 = [&Wav](uint16 Value) { Wav.Append(reinterpret_cast<const uint8*>(&Value), 2); };
+		auto AppendTag = [&Wav](const char* Tag) { Wav.Append(reinterpret_cast<const uint8*>(Tag), 4); };
+
+		AppendTag("RIFF");
+		Append32(36 + DataBytes);
+		AppendTag("WAVE");
+		AppendTag("fmt ");
+		Append32(16);
+		Append16(1);					// PCM
+		Append16(1);					// Mono
+		Append32(SampleRate);
+		Append32(SampleRate * 2);		// Byte rate
+		Append16(2);					// Block align
+		Append16(16);					// Bits per sample
+		AppendTag("data");
+		Append32(DataBytes);
+		Wav.AddZeroed(DataBytes);
+		return Wav;
+	}
+}
+
+UAIReadinessSubsystem* UAIReadinessSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UAIReadinessSubsystem>() : nullptr;
+}
+
+void UAIReadinessSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	WarmupStartSeconds = FPlatformTime::Seconds();
+}
+
+void UAIReadinessSubsystem::Deinitialize()
+{
+	// Results still in flight find no provider and are dropped
+	Providers.Empty();
+	bHasWork = false;
+	Super::Deinitialize();
+}
+
+// =====================================
+// Registration
+// =====================================
+
+void UAIReadinessSubsystem::RegisterProvider(FName ProviderId, EAIProviderKind Kind, FAIWarmupProbe Probe, bool bRequired)
+{
+	if (ProviderId.IsNone() || !Probe)
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (bAIReady)
+	{
+		WarmupStartSeconds = Now;
+	}
+
+	FProvider* Provider = FindProvider(ProviderId);
+	if (!Provider)
+	{
+		Provider = &Providers.AddDefaulted_GetRef();
+	}
+
+	*Provider = FProvider();
+	Provider->Status.ProviderId = ProviderId;
+	Provider->Status.Kind = Kind;
+	Provider->Status.bRequired = bRequired;
+	Provider->Probe = MoveTemp(Probe);
+	Provider->RegisteredSeconds = Now;
+	Provider->NextAttemptSeconds = Now;
+	bHasWork = true;
+
+	UE_LOG(LogTemp, Log, TEXT("AIReadinessSubsystem: Warming up %s (%s%s)"), *ProviderId.ToString(),
+		*UEnum::GetDisplayValueAsText(Kind).ToString(), bRequired ? TEXT("") : TEXT(", optional"));
+
+	OnProviderReadinessChanged.Broadcast(Provider->Status);
+	UpdateAggregate();
+}
+
+void UAIReadinessSubsystem::RegisterLLM(FName ProviderId, ULLMProviderManager* ProviderManager, const FString& ModelName, bool bRequired)
+{
+	if (!ProviderManager)
+	{
+		return;
+	}
+
+	RegisterProvider(ProviderId, EAIProviderKind::LLM, [WeakManager = TWeakObjectPtr<ULLMProviderManager>(ProviderManager), ModelName](FAIWarmupDone Done)
+	{
+		ULLMProviderManager* Manager = WeakManager.Get();
+		if (!Manager)
+		{
+			Done(false, TEXT("LLM provider manager destroyed"));
+			return;
+		}
+
+		// Deterministic and a handful of tokens: loads the weights and KV cache, costs nothing once hot
+		FLLMRequest Request;
+		Request.SystemPrompt = TEXT("You are a readiness check. Answer with one word.");
+		Request.PlayerInput = TEXT("Say ready.");
+		Request.ModelName = ModelName;
+		Request.Temperature = 0.0f;
+		Request.MaxTokens = 4;
+		Manager->RequestResponse(Request, [Done](const FLLMResponse& Response)
+		{
+			Done(Response.bSuccess, Response.ErrorMessage);
+		});
+	}, bRequired);
+}
+
+void UAIReadinessSubsystem::RegisterASR(FName ProviderId, UASRProviderManager* ProviderManager, const FString& LanguageCode, int32 SampleRate, bool bRequired)
+{
+	if (!ProviderManager)
+	{
+		return;
+	}
+
+	RegisterProvider(ProviderId, EAIProviderKind::ASR, [WeakManager = TWeakObjectPtr<UASRProviderManager>(ProviderManager), LanguageCode, SampleRate](FAIWarmupDone Done)
+	{
+		UASRProviderManager* Manager = WeakManager.Get();
+		if (!Manager)
+		{
+			Done(false, TEXT("ASR provider manager destroyed"));
+			return;
+		}
+
+		// Half a second of silence builds the recognition graph; an empty transcript is a success
+		FASRRequest Request;
+		Request.AudioData.SetNumZeroed(SampleRate);
+		Request.SampleRate = SampleRate;
+		Request.LanguageCode = LanguageCode;
+		Request.bUseStreaming = false;
+		Manager->RequestTranscription(Request, [Done](const FASRResponse& Response)
+		{
+			Done(Response.bSuccess, Response.ErrorMessage);
+		});
+	}, bRequired);
+}
+
+void UAIReadinessSubsystem::RegisterTTS(FName ProviderId, UAIGRPCClient* GRPCClient, const FString& VoiceName, const FString& LanguageCode, bool bRequired)
+{
+	if (!GRPCClient)
+	{
+		return;
+	}
+
+	// A stubbed client never returns audio: warming it would hold a required gate shut forever
+	if (!GRPCClient->IsTTSSynthesisImplemented())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AIReadinessSubsystem: Skipping TTS warm-up for %s - gRPC TTS synthesis is not implemented yet"), *ProviderId.ToString());
+		return;
+	}
+
+	RegisterProvider(ProviderId, EAIProviderKind::TTS, [WeakClient = TWeakObjectPtr<UAIGRPCClient>(GRPCClient), VoiceName, LanguageCode](FAIWarmupDone Done)
+	{
+		UAIGRPCClient* Client = WeakClient.Get();
+		if (!Client || !Client->IsInitialized())
+		{
+			Done(false, TEXT("TTS gRPC client not initialized"));
+			return;
+		}
+
+		// Same voice as the show so that voice's model is the one loaded
+		FAITTSRequest Request;
+		Request.Text = TEXT("Ready.");
+		Request.VoiceName = VoiceName;
+		Request.LanguageCode = LanguageCode;
+		Client->RequestTTSSynthesis(Request, [Done](const FAITTSResponse& Response)
+		{
+			const bool bSuccess = Response.AudioData.Num() > 0;
+			Done(bSuccess, bSuccess ? FString() : TEXT("TTS returned no audio"));
+		});
+	}, bRequired);
+}
+
+void UAIReadinessSubsystem::RegisterAudio2Face(FName ProviderId, UAIHTTPClient* HTTPClient, const FString& EndpointURL, bool bRequired)
+{
+	if (!HTTPClient || EndpointURL.IsEmpty())
+	{
+		return;
+	}
+
+	FString URL = EndpointURL;
+	if (!URL.EndsWith(TEXT("/")))
+	{
+		URL += TEXT("/");
+	}
+	URL += TEXT("api/audio2face/convert");
+
+	const FString SilentClip = FBase64::Encode(MakeSilentWav(16000, 0.25f));
+
+	RegisterProvider(ProviderId, EAIProviderKind::Audio2Face, [WeakClient = TWeakObjectPtr<UAIHTTPClient>(HTTPClient), URL, SilentClip](FAIWarmupDone Done)
+	{
+		UAIHTTPClient* Client = WeakClient.Get();
+		if (!Client)
+		{
+			Done(false, TEXT("HTTP client destroyed"));
+			return;
+		}
+
+		TSharedPtr<FJsonObject> RequestJson = MakeShareable(new FJsonObject);
+		RequestJson->SetStringField(TEXT("audio_file"), SilentClip);
+		RequestJson->SetStringField(TEXT("format"), TEXT("wav"));
+		RequestJson->SetBoolField(TEXT("stream"), false);
+
+		Client->PostJSON(URL, RequestJson, TMap<FString, FString>(), [Done](const FAIHTTPResult& Result)
+		{
+			const bool bSuccess = Result.bSuccess && Result.ResponseCode == 200;
+			Done(bSuccess, bSuccess ? FString() : FString::Printf(TEXT("HTTP %d %s"), Result.ResponseCode, *Result.ErrorMessage));
+		});
+	}, bRequired);
+}
+
+void UAIReadinessSubsystem::UnregisterProvider(FName ProviderId)
+{
+	if (Providers.RemoveAll([ProviderId](const FProvider& Provider) { return Provider.Status.ProviderId == ProviderId; }) > 0)
+	{
+		UpdateAggregate();
+	}
+}
+
+FName UAIReadinessSubsystem::MakeProviderId(const UObject* Component, const TCHAR* Kind)
+{
+	if (!Component)
+	{
+		return FName(Kind);
+	}
+
+	const UObject* Outer = Component->GetOuter();
+	return FName(*FString::Printf(TEXT("%s.%s.%s"), Outer ? *Outer->GetName() : TEXT(""), *Component->GetName(), Kind));
+}
+
+void UAIReadinessSubsystem::RestartWarmup()
+{
+	const double Now = FPlatformTime::Seconds();
+	WarmupStartSeconds = Now;
+
+	for (FProvider& Provider : Providers)
+	{
+		Provider.Status.Attempts = 0;
+		Provider.Status.PassesCompleted = 0;
+		Provider.Status.SecondsToReady = 0.0f;
+		Provider.RegisteredSeconds = Now;
+		Provider.NextAttemptSeconds = Now;
+		Provider.RequestToken = 0;
+		SetState(Provider, EAIProviderReadiness::WarmingUp);
+	}
+	bHasWork = Providers.Num() > 0;
+	UpdateAggregate();
+}
+
+bool UAIReadinessSubsystem::GetProviderStatus(FName ProviderId, FAIProviderReadinessStatus& OutStatus) const
+{
+	for (const FProvider& Provider : Providers)
+	{
+		if (Provider.Status.ProviderId == ProviderId)
+		{
+			OutStatus = Provider.Status;
+			return true;
+		}
+	}
+	return false;
+}
+
+TArray<FAIProviderReadinessStatus> UAIReadinessSubsystem::GetAllProviderStatus() const
+{
+	TArray<FAIProviderReadinessStatus> Status;
+	Status.Reserve(Providers.Num());
+	for (const FProvider& Provider : Providers)
+	{
+		Status.Add(Provider.Status);
+	}
+	return Status;
+}
+
+// =====================================
+// Warm-up
+// =====================================
+
+void UAIReadinessSubsystem::Tick(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+	bool bWork = false;
+
+	for (int32 Index = 0; Index < Providers.Num(); Index++)
+	{
+		FProvider& Provider = Providers[Index];
+
+		if (Provider.RequestToken != 0)
+		{
+			if (Now - Provider.RequestStartSeconds > RequestTimeoutSeconds)
+			{
+				HandleResult(Provider.Status.ProviderId, Provider.RequestToken, false, TEXT("Warm-up request timed out"));
+			}
+			bWork = true;
+			continue;
+		}
+
+		if (Provider.Status.State != EAIProviderReadiness::WarmingUp)
+		{
+			continue;
+		}
+
+		// Give up with one error rather than retrying (and letting the client log) forever
+		const bool bTimedOut = Now - Provider.RegisteredSeconds > WarmupTimeoutSeconds;
+		if (bTimedOut || Provider.Status.Attempts >= MaxWarmupAttempts)
+		{
+			UE_LOG(LogTemp, Error, TEXT("AIReadinessSubsystem: %s not ready after %.0fs and %d attempts (last error: %s) - giving up until RestartWarmup()"),
+				*Provider.Status.ProviderId.ToString(), Now - Provider.RegisteredSeconds, Provider.Status.Attempts, *Provider.Status.LastError);
+			SetState(Provider, EAIProviderReadiness::Failed);
+			continue;
+		}
+
+		if (Now >= Provider.NextAttemptSeconds)
+		{
+			IssueRequest(Provider, Now);
+		}
+		bWork = true;
+	}
+
+	bHasWork = bWork;
+}
+
+TStatId UAIReadinessSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAIReadinessSubsystem, STATGROUP_Tickables);
+}
+
+UAIReadinessSubsystem::FProvider* UAIReadinessSubsystem::FindProvider(FName ProviderId)
+{
+	return Providers.FindByPredicate([ProviderId](const FProvider& Provider) { return Provider.Status.ProviderId == ProviderId; });
+}
+
+void UAIReadinessSubsystem::IssueRequest(FProvider& Provider, double NowSeconds)
+{
+	const FName ProviderId = Provider.Status.ProviderId;
+	const uint32 Token = NextRequestToken++;
+	if (NextRequestToken == 0)
+	{
+		NextRequestToken = 1;
+	}
+
+	Provider.RequestToken = Token;
+	Provider.RequestStartSeconds = NowSeconds;
+	Provider.Status.Attempts++;
+	LBEASTAI_INC_COUNTER(STAT_AIReadiness_Requests, 1);
+
+	FAIWarmupDone Done = [WeakThis = TWeakObjectPtr<UAIReadinessSubsystem>(this), ProviderId, Token](bool bSuccess, const FString& Error)
+	{
+		if (IsInGameThread())
+		{
+			if (UAIReadinessSubsystem* This = WeakThis.Get())
+			{
+				This->HandleResult(ProviderId, Token, bSuccess, Error);
+			}
+			return;
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, ProviderId, Token, bSuccess, Error]()
+		{
+			if (UAIReadinessSubsystem* This = WeakThis.Get())
+			{
+				This->HandleResult(ProviderId, Token, bSuccess, Error);
+			}
+		});
+	};
+
+	// Copy: the probe may answer synchronously, and the entry must not be touched after that
+	FAIWarmupProbe Probe = Provider.Probe;
+	Probe(MoveTemp(Done));
+}
+
+void UAIReadinessSubsystem::HandleResult(FName ProviderId, uint32 RequestToken, bool bSuccess, const FString& Error)
+{
+	FProvider* Provider = FindProvider(ProviderId);
+	if (!Provider || Provider->RequestToken != RequestToken)
+	{
+		// Timed out, re-registered or restarted since this request went out
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	const float LatencyMs = (float)((Now - Provider->RequestStartSeconds) * 1000.0);
+	FAIProviderReadinessStatus& Status = Provider->Status;
+	Provider->RequestToken = 0;
+	bHasWork = true;
+
+	if (!bSuccess)
+	{
+		// Ready needs consecutive passes
+		Status.PassesCompleted = 0;
+		Status.LastError = Error;
+		Provider->NextAttemptSeconds = Now + RetryIntervalSeconds;
+		UE_LOG(LogTemp, Verbose, TEXT("AIReadinessSubsystem: %s warm-up request %d failed: %s"), *ProviderId.ToString(), Status.Attempts, *Error);
+		return;
+	}
+
+	Status.PassesCompleted++;
+	if (Status.ColdLatencyMs <= 0.0f)
+	{
+		Status.ColdLatencyMs = LatencyMs;
+	}
+	Status.WarmLatencyMs = LatencyMs;
+	Status.LastError.Reset();
+
+	if (Status.PassesCompleted < WarmupPasses)
+	{
+		Provider->NextAttemptSeconds = Now;
+		return;
+	}
+
+	Status.SecondsToReady = (float)(Now - Provider->RegisteredSeconds);
+	UE_LOG(LogTemp, Log, TEXT("AIReadinessSubsystem: %s ready after %.1fs (cold %.0f ms, warm %.0f ms)"),
+		*ProviderId.ToString(), Status.SecondsToReady, Status.ColdLatencyMs, Status.WarmLatencyMs);
+	SetState(*Provider, EAIProviderReadiness::Ready);
+}
+
+void UAIReadinessSubsystem::SetState(FProvider& Provider, EAIProviderReadiness NewState)
+{
+	if (Provider.Status.State == NewState)
+	{
+		return;
+	}
+
+	Provider.Status.State = NewState;
+	OnProviderReadinessChanged.Broadcast(Provider.Status);
+	UpdateAggregate();
+}
+
+void UAIReadinessSubsystem::UpdateAggregate()
+{
+	bool bReady = true;
+	for (const FProvider& Provider : Providers)
+	{
+		if (Provider.Status.bRequired && Provider.Status.State != EAIProviderReadiness::Ready)
+		{
+			bReady = false;
+			break;
+		}
+	}
+
+	if (bReady == bAIReady)
+	{
+		return;
+	}
+
+	bAIReady = bReady;
+	if (bReady)
+	{
+		UE_LOG(LogTemp, Log, TEXT("AIReadinessSubsystem: AI ready (%d provider(s) warm after %.1fs)"),
+			Providers.Num(), FPlatformTime::Seconds() - WarmupStartSeconds);
+	}
+	OnAIReadyChanged.Broadcast(bReady);
+}
@@ -4,6 +4,10 @@
 #include "AIGRPCClient.h"
 #include "ASRProviderManager.h"
 #include "ContainerManagerDockerCLI.h"
+#include "AIReadinessSubsystem.h"
+#include "AI.h"
+
+DECLARE_CYCLE_STAT(TEXT("AIASRManager Tick"), STAT_AIASRManager_Tick, STATGROUP_LBEASTAI);
 
 UAIASRManager::UAIASRManager()
 {
@@ -24,9 +28,20 @@ void UAIASRManager::BeginPlay()
 	Super::BeginPlay();
 }
 
+void UAIASRManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UAIReadinessSubsystem* Readiness = UAIReadinessSubsystem::Get(this))
+	{
+		Readiness->UnregisterProvider(UAIReadinessSubsystem::MakeProviderId(this, TEXT("ASR")));
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UAIASRManager::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	LBEASTAI_SCOPE_CYCLE_COUNTER(STAT_AIASRManager_Tick);
 
 	if (!bIsInitialized)
 	{
@@ -112,6 +127,14 @@ bool UAIASRManager::InitializeASRManager()
 		return false;
 	}
 
+	if (ASRConfig.bWarmUpOnInitialize)
+	{
+		if (UAIReadinessSubsystem* Readiness = UAIReadinessSubsystem::Get(this))
+		{
+			Readiness->RegisterASR(UAIReadinessSubsystem::MakeProviderId(this, TEXT("ASR")), ASRProviderManager, ASRConfig.LanguageCode);
+		}
+	}
+
 	bIsInitialized = true;
 
 	UE_LOG(LogTemp, Log, TEXT("AIASRManager: Initialized with local ASR: %s (language: %s)"),
@@ -0,0 +1,1585 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "ContainerManagerDockerAPI.h"
+#include "AI.h"
+#include "Async/Async.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Dom/JsonObject.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "IPAddress.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+
+#define LBEAST_DOCKER_UNIX_SOCKET (PLATFORM_LINUX || PLATFORM_MAC)
+#define LBEAST_DOCKER_NAMED_PIPE PLATFORM_WINDOWS
+
+#if LBEAST_DOCKER_UNIX_SOCKET
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#if LBEAST_DOCKER_NAMED_PIPE
+#include "Windows/AllowWindowsPlatformTypes.h"
+#include "Windows/WindowsHWrapper.h"
+#include "Windows/HideWindowsPlatformTypes.h"
+#endif
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Docker API Requests"), STAT_DockerAPI_Requests, STATGROUP_LBEASTAI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Docker Events"), STAT_DockerAPI_Events, STATGROUP_LBEASTAI);
+
+namespace
+{
+	/** Receive slice: how often blocked reads re-check deadlines and stop requests */
+	constexpr int32 ReceiveSliceMs = 250;
+
+	/** Event stream reconnect backoff */
+	constexpr double MinReconnectSeconds = 1.0;
+	constexpr double MaxReconnectSeconds = 30.0;
+
+	/** GET /events filtered to container events: filters={"type":["container"]} */
+	const TCHAR* EventsPath = TEXT("/events?filters=%7B%22type%22%3A%5B%22container%22%5D%7D");
+
+	/** Connect timeout when every instance of the Docker Desktop pipe is busy */
+	constexpr uint32 PipeBusyWaitMs = 2000;
+
+	struct FDockerEndpoint
+	{
+		bool bUnixSocket = false;
+		bool bNamedPipe = false;
+		/** Unix socket path, or Windows pipe path (\\.\pipe\docker_engine) */
+		FString SocketPath;
+		FString Host;
+		int32 Port = 2375;
+	};
+
+	bool ParseDockerHost(const FString& DockerHost, FDockerEndpoint& OutEndpoint, FString& OutError)
+	{
+		if (DockerHost.StartsWith(TEXT("unix://")))
+		{
+#if LBEAST_DOCKER_UNIX_SOCKET
+			OutEndpoint.bUnixSocket = true;
+			OutEndpoint.SocketPath = DockerHost.Mid(7);
+			if (!OutEndpoint.SocketPath.IsEmpty())
+			{
+				return true;
+			}
+#else
+			OutError = FString::Printf(TEXT("Unix sockets are not supported on this platform (%s) - use tcp://host:port"), *DockerHost);
+			return false;
+#endif
+		}
+		else if (DockerHost.StartsWith(TEXT("npipe://")))
+		{
+#if LBEAST_DOCKER_NAMED_PIPE
+			// npipe:////./pipe/docker_engine -> \\.\pipe\docker_engine
+			OutEndpoint.bNamedPipe = true;
+			OutEndpoint.SocketPath = DockerHost.Mid(8).Replace(TEXT("/"), TEXT("\\"));
+			if (OutEndpoint.SocketPath.StartsWith(TEXT("\\\\")))
+			{
+				return true;
+			}
+#else
+			OutError = FString::Printf(TEXT("Named pipes are only supported on Windows (%s) - use unix:///path or tcp://host:port"), *DockerHost);
+			return false;
+#endif
+		}
+		else if (DockerHost.StartsWith(TEXT("tcp://")))
+		{
+			FString HostPort = DockerHost.Mid(6);
+			HostPort.RemoveFromEnd(TEXT("/"));
+			FString PortString;
+			if (HostPort.Split(TEXT(":"), &OutEndpoint.Host, &PortString, ESearchCase::CaseSensitive, ESearchDir::FromEnd))
+			{
+				OutEndpoint.Port = FCString::Atoi(*PortString);
+			}
+			else
+			{
+				OutEndpoint.Host = HostPort;
+			}
+			if (!OutEndpoint.Host.IsEmpty() && OutEndpoint.Port > 0)
+			{
+				return true;
+			}
+		}
+
+		OutError = FString::Printf(TEXT("Unsupported DOCKER_HOST '%s' (expected unix:///path, npipe:////./pipe/name or tcp://host:port)"), *DockerHost);
+		return false;
+	}
+
+	// =====================================
+	// Connection (Unix socket, named pipe or TCP)
+	// =====================================
+
+	class FDockerConnection
+	{
+	public:
+		~FDockerConnection()
+		{
+			Close();
+		}
+
+		bool Open(const FDockerEndpoint& Endpoint, FString& OutError)
+		{
+#if LBEAST_DOCKER_UNIX_SOCKET
+			if (Endpoint.bUnixSocket)
+			{
+				sockaddr_un Address;
+				FMemory::Memzero(Address);
+				Address.sun_family = AF_UNIX;
+				FTCHARToUTF8 Path(*Endpoint.SocketPath);
+				if (Path.Length() >= (int32)sizeof(Address.sun_path))
+				{
+					OutError = FString::Printf(TEXT("Socket path too long: %s"), *Endpoint.SocketPath);
+					return false;
+				}
+				FMemory::Memcpy(Address.sun_path, Path.Get(), Path.Length());
+
+				Fd = socket(AF_UNIX, SOCK_STREAM, 0);
+				if (Fd < 0 || connect(Fd, (const sockaddr*)&Address, sizeof(Address)) != 0)
+				{
+					OutError = FString::Printf(TEXT("Cannot connect to %s (%s)"), *Endpoint.SocketPath, UTF8_TO_TCHAR(strerror(errno)));
+					Close();
+					return false;
+				}
+				return true;
+			}
+#endif
+#if LBEAST_DOCKER_NAMED_PIPE
+			if (Endpoint.bNamedPipe)
+			{
+				for (int32 Attempt = 0; ; Attempt++)
+				{
+					Pipe = CreateFileW(*Endpoint.SocketPath, GENERIC_READ | GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, 0, nullptr);
+					if (Pipe != INVALID_HANDLE_VALUE)
+					{
+						return true;
+					}
+					// All pipe instances busy: wait once for one to free up
+					const DWORD ErrorCode = GetLastError();
+					if (ErrorCode != ERROR_PIPE_BUSY || Attempt > 0 || !WaitNamedPipeW(*Endpoint.SocketPath, PipeBusyWaitMs))
+					{
+						OutError = FString::Printf(TEXT("Cannot connect to %s (error %u) - is Docker Desktop running?"), *Endpoint.SocketPath, (uint32)ErrorCode);
+						return false;
+					}
+				}
+			}
+#endif
+			ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+			if (!SocketSubsystem)
+			{
+				OutError = TEXT("No socket subsystem");
+				return false;
+			}
+
+			FAddressInfoResult Resolved = SocketSubsystem->GetAddressInfo(*Endpoint.Host, nullptr,
+				EAddressInfoFlags::Default, NAME_None, ESocketType::SOCKTYPE_Streaming);
+			if (Resolved.Results.Num() == 0)
+			{
+				OutError = FString::Printf(TEXT("Cannot resolve %s"), *Endpoint.Host);
+				return false;
+			}
+
+			TSharedRef<FInternetAddr> Address = Resolved.Results[0].Address;
+			Address->SetPort(Endpoint.Port);
+			Socket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("LBEAST_DockerAPI"), Address->GetProtocolType());
+			if (!Socket || !Socket->Connect(*Address))
+			{
+				OutError = FString::Printf(TEXT("Cannot connect to %s:%d"), *Endpoint.Host, Endpoint.Port);
+				Close();
+				return false;
+			}
+			return true;
+		}
+
+		bool SendAll(const TArray<uint8>& Data)
+		{
+			int32 Offset = 0;
+			while (Offset < Data.Num())
+			{
+				int32 Sent = 0;
+#if LBEAST_DOCKER_UNIX_SOCKET
+				if (Fd >= 0)
+				{
+					const ssize_t Result = send(Fd, Data.GetData() + Offset, Data.Num() - Offset, MSG_NOSIGNAL);
+					if (Result <= 0)
+					{
+						return false;
+					}
+					Sent = (int32)Result;
+				}
+				else
+#endif
+#if LBEAST_DOCKER_NAMED_PIPE
+				if (Pipe != INVALID_HANDLE_VALUE)
+				{
+					DWORD Written = 0;
+					if (!WriteFile(Pipe, Data.GetData() + Offset, (DWORD)(Data.Num() - Offset), &Written, nullptr) || Written == 0)
+					{
+						return false;
+					}
+					Sent = (int32)Written;
+				}
+				else
+#endif
+				if (!Socket || !Socket->Send(Data.GetData() + Offset, Data.Num() - Offset, Sent) || Sent <= 0)
+				{
+					return false;
+				}
+				Offset += Sent;
+			}
+			return true;
+		}
+
+		/**
+		 * @return Bytes read, 0 if the peer closed, INDEX_NONE on error.
+		 * bOutTimedOut is set (and 0 returned) when nothing arrived within TimeoutMs.
+		 */
+		int32 Receive(uint8* Buffer, int32 Size, int32 TimeoutMs, bool& bOutTimedOut)
+		{
+			bOutTimedOut = false;
+#if LBEAST_DOCKER_UNIX_SOCKET
+			if (Fd >= 0)
+			{
+				pollfd Poll = { Fd, POLLIN, 0 };
+				const int Ready = poll(&Poll, 1, TimeoutMs);
+				if (Ready == 0 || (Ready < 0 && errno == EINTR))
+				{
+					bOutTimedOut = true;
+					return 0;
+				}
+				if (Ready < 0)
+				{
+					return INDEX_NONE;
+				}
+				const ssize_t Result = recv(Fd, Buffer, Size, 0);
+				return Result < 0 ? INDEX_NONE : (int32)Result;
+			}
+#endif
+#if LBEAST_DOCKER_NAMED_PIPE
+			if (Pipe != INVALID_HANDLE_VALUE)
+			{
+				// Synchronous pipe handles have no readiness wait: peek in short sleeps until data or timeout
+				const double Deadline = FPlatformTime::Seconds() + TimeoutMs / 1000.0;
+				for (;;)
+				{
+					DWORD Available = 0;
+					if (!PeekNamedPipe(Pipe, nullptr, 0, nullptr, &Available, nullptr))
+					{
+						// Broken pipe = the daemon closed its end
+						return GetLastError() == ERROR_BROKEN_PIPE ? 0 : INDEX_NONE;
+					}
+					if (Available > 0)
+					{
+						DWORD BytesRead = 0;
+						if (!ReadFile(Pipe, Buffer, FMath::Min<DWORD>(Available, (DWORD)Size), &BytesRead, nullptr))
+						{
+							return GetLastError() == ERROR_BROKEN_PIPE ? 0 : INDEX_NONE;
+						}
+						return (int32)BytesRead;
+					}
+					if (FPlatformTime::Seconds() >= Deadline)
+					{
+						bOutTimedOut = true;
+						return 0;
+					}
+					FPlatformProcess::Sleep(0.002f);
+				}
+			}
+#endif
+			if (!Socket)
+			{
+				return INDEX_NONE;
+			}
+			if (!Socket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromMilliseconds(TimeoutMs)))
+			{
+				bOutTimedOut = true;
+				return 0;
+			}
+			int32 BytesRead = 0;
+			if (!Socket->Recv(Buffer, Size, BytesRead))
+			{
+				return BytesRead > 0 ? BytesRead : 0;
+			}
+			return BytesRead;
+		}
+
+		void Close()
+		{
+#if LBEAST_DOCKER_UNIX_SOCKET
+			if (Fd >= 0)
+			{
+				close(Fd);
+				Fd = -1;
+			}
+#endif
+#if LBEAST_DOCKER_NAMED_PIPE
+			if (Pipe != INVALID_HANDLE_VALUE)
+			{
+				CloseHandle(Pipe);
+				Pipe = INVALID_HANDLE_VALUE;
+			}
+#endif
+			if (Socket)
+			{
+				Socket->Close();
+				ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+				Socket = nullptr;
+			}
+		}
+
+	private:
+#if LBEAST_DOCKER_UNIX_SOCKET
+		int Fd = -1;
+#endif
+#if LBEAST_DOCKER_NAMED_PIPE
+		HANDLE Pipe = INVALID_HANDLE_VALUE;
+#endif
+		FSocket* Socket = nullptr;
+	};
+
+	// =====================================
+	// HTTP/1.1
+	// =====================================
+
+	TArray<uint8> BuildRequest(const TCHAR* Method, const FString& Path, const FString& Body)
+	{
+		FTCHARToUTF8 BodyUtf8(*Body);
+		FString Head = FString::Printf(TEXT("%s %s HTTP/1.1\r\nHost: docker\r\nUser-Agent: LBEAST\r\nConnection: close\r\n"), Method, *Path);
+		if (!Body.IsEmpty())
+		{
+			Head += FString::Printf(TEXT("Content-Type: application/json\r\nContent-Length: %d\r\n"), BodyUtf8.Length());
+		}
+		else if (FCString::Strcmp(Method, TEXT("GET")) != 0)
+		{
+			Head += TEXT("Content-Length: 0\r\n");
+		}
+		Head += TEXT("\r\n");
+
+		FTCHARToUTF8 HeadUtf8(*Head);
+		TArray<uint8> Request;
+		Request.Append(reinterpret_cast<const uint8*>(HeadUtf8.Get()), HeadUtf8.Length());
+		Request.Append(reinterpret_cast<const uint8*>(BodyUtf8.Get()), BodyUtf8.Length());
+		return Request;
+	}
+
+	/**
+	 * Incremental HTTP/1.1 response reader
+	 * Body bytes (Content-Length, chunked or read-until-close) are handed to the callback as they
+	 * arrive, which is what the endless /events stream and image pull progress need.
+	 */
+	class FDockerResponseReader
+	{
+	public:
+		FDockerResponseReader(FDockerConnection& InConnection, double InDeadlineSeconds, const FThreadSafeBool* InStopFlag)
+			: Connection(InConnection)
+			, DeadlineSeconds(InDeadlineSeconds)
+			, StopFlag(InStopFlag)
+		{
+		}
+
+		int32 Status = 0;
+		FString Error;
+
+		bool ReadHeaders()
+		{
+			int32 HeaderEnd;
+			while ((HeaderEnd = FindSequence("\r\n\r\n", 4)) == INDEX_NONE)
+			{
+				if (!ReadMore())
+				{
+					SetErrorIfEmpty(TEXT("Connection closed before response headers"));
+					return false;
+				}
+			}
+
+			const FString Headers(HeaderEnd, reinterpret_cast<const ANSICHAR*>(Buffer.GetData()));
+			Consume(HeaderEnd + 4);
+
+			TArray<FString> Lines;
+			Headers.ParseIntoArrayLines(Lines);
+			if (Lines.Num() == 0)
+			{
+				Error = TEXT("Empty response");
+				return false;
+			}
+
+			FString StatusCode;
+			Lines[0].Split(TEXT(" "), nullptr, &StatusCode);
+			Status = FCString::Atoi(*StatusCode);
+
+			for (int32 Index = 1; Index < Lines.Num(); Index++)
+			{
+				FString Key, Value;
+				if (!Lines[Index].Split(TEXT(":"), &Key, &Value))
+				{
+					continue;
+				}
+				Key.TrimStartAndEndInline();
+				Value.TrimStartAndEndInline();
+				if (Key.Equals(TEXT("Content-Length"), ESearchCase::IgnoreCase))
+				{
+					ContentLength = FCString::Atoi64(*Value);
+				}
+				else if (Key.Equals(TEXT("Transfer-Encoding"), ESearchCase::IgnoreCase) && Value.Contains(TEXT("chunked")))
+				{
+					bChunked = true;
+				}
+			}
+			return Status > 0;
+		}
+
+		/** @param OnBody Return false to stop reading (counts as success) */
+		bool ReadBody(TFunctionRef<bool(const uint8*, int32)> OnBody)
+		{
+			if (bChunked)
+			{
+				for (;;)
+				{
+					int32 LineEnd;
+					while ((LineEnd = FindSequence("\r\n", 2)) == INDEX_NONE)
+					{
+						if (!ReadMore())
+						{
+							SetErrorIfEmpty(TEXT("Truncated chunked response"));
+							return false;
+						}
+					}
+
+					const FString SizeLine(LineEnd, reinterpret_cast<const ANSICHAR*>(Buffer.GetData()));
+					const int32 ChunkSize = (int32)FParse::HexNumber(*SizeLine);
+					Consume(LineEnd + 2);
+					if (ChunkSize <= 0)
+					{
+						return true;
+					}
+
+					while (Buffer.Num() < ChunkSize + 2)
+					{
+						if (!ReadMore())
+						{
+							SetErrorIfEmpty(TEXT("Truncated chunked response"));
+							return false;
+						}
+					}
+					if (!OnBody(Buffer.GetData(), ChunkSize))
+					{
+						return true;
+					}
+					Consume(ChunkSize + 2);
+				}
+			}
+
+			if (ContentLength >= 0)
+			{
+				int64 Remaining = ContentLength;
+				while (Remaining > 0)
+				{
+					if (Buffer.Num() == 0 && !ReadMore())
+					{
+						SetErrorIfEmpty(TEXT("Truncated response body"));
+						return false;
+					}
+					const int32 Take = (int32)FMath::Min<int64>(Buffer.Num(), Remaining);
+					if (!OnBody(Buffer.GetData(), Take))
+					{
+						return true;
+					}
+					Consume(Take);
+					Remaining -= Take;
+				}
+				return true;
+			}
+
+			// Neither length nor chunking: body runs until the daemon closes the connection
+			for (;;)
+			{
+				if (Buffer.Num() > 0)
+				{
+					if (!OnBody(Buffer.GetData(), Buffer.Num()))
+					{
+						return true;
+					}
+					Buffer.Reset();
+				}
+				if (!ReadMore())
+				{
+					return bClosed;
+				}
+			}
+		}
+
+	private:
+		bool ReadMore()
+		{
+			uint8 Temp[16 * 1024];
+			for (;;)
+			{
+				if (StopFlag && *StopFlag)
+				{
+					SetErrorIfEmpty(TEXT("Cancelled"));
+					return false;
+				}
+				if (DeadlineSeconds > 0.0 && FPlatformTime::Seconds() > DeadlineSeconds)
+				{
+					SetErrorIfEmpty(TEXT("Request timed out"));
+					return false;
+				}
+
+				bool bTimedOut = false;
+				const int32 Received = Connection.Receive(Temp, sizeof(Temp), ReceiveSliceMs, bTimedOut);
+				if (bTimedOut)
+				{
+					continue;
+				}
+				if (Received == 0)
+				{
+					bClosed = true;
+					return false;
+				}
+				if (Received < 0)
+				{
+					SetErrorIfEmpty(TEXT("Receive failed"));
+					return false;
+				}
+				Buffer.Append(Temp, Received);
+				return true;
+			}
+		}
+
+		int32 FindSequence(const char* Sequence, int32 Length) const
+		{
+			for (int32 Index = 0; Index + Length <= Buffer.Num(); Index++)
+			{
+				if (FMemory::Memcmp(Buffer.GetData() + Index, Sequence, Length) == 0)
+				{
+					return Index;
+				}
+			}
+			return INDEX_NONE;
+		}
+
+		void Consume(int32 Count)
+		{
+			Buffer.RemoveAt(0, Count, EAllowShrinking::No);
+		}
+
+		void SetErrorIfEmpty(const TCHAR* Message)
+		{
+			if (Error.IsEmpty())
+			{
+				Error = Message;
+			}
+		}
+
+		FDockerConnection& Connection;
+		double DeadlineSeconds;
+		const FThreadSafeBool* StopFlag;
+		TArray<uint8> Buffer;
+		int64 ContentLength = -1;
+		bool bChunked = false;
+		bool bClosed = false;
+	};
+
+	/** Splits a byte stream into newline-terminated UTF-8 lines (JSON messages) */
+	class FDockerLineSplitter
+	{
+	public:
+		void Append(const uint8* Data, int32 Length, TFunctionRef<void(const FString&)> OnLine)
+		{
+			for (int32 Index = 0; Index < Length; Index++)
+			{
+				if (Data[Index] == '\n')
+				{
+					if (Partial.Num() > 0)
+					{
+						FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Partial.GetData()), Partial.Num());
+						OnLine(FString(Converter.Length(), Converter.Get()));
+						Partial.Reset();
+					}
+				}
+				else
+				{
+					Partial.Add(Data[Index]);
+				}
+			}
+		}
+
+	private:
+		TArray<uint8> Partial;
+	};
+
+	struct FDockerResponse
+	{
+		int32 Status = 0;
+		FString Body;
+		FString Error;
+
+		bool IsSuccess() const { return Error.IsEmpty() && Status >= 200 && Status < 300; }
+
+		/** Transport error, Docker's {"message": ...}, or the status code */
+		FString Describe() const
+		{
+			if (!Error.IsEmpty())
+			{
+				return Error;
+			}
+			TSharedPtr<FJsonObject> Json;
+			FString Message;
+			if (FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Body), Json) && Json.IsValid() && Json->TryGetStringField(TEXT("message"), Message))
+			{
+				return FString::Printf(TEXT("%s (HTTP %d)"), *Message, Status);
+			}
+			return FString::Printf(TEXT("HTTP %d"), Status);
+		}
+	};
+
+	FDockerResponse DockerRequest(const FDockerEndpoint& Endpoint, const TCHAR* Method, const FString& Path, const FString& Body, double TimeoutSeconds)
+	{
+		LBEASTAI_INC_COUNTER(STAT_DockerAPI_Requests, 1);
+
+		FDockerResponse Response;
+		FDockerConnection Connection;
+		if (!Connection.Open(Endpoint, Response.Error))
+		{
+			return Response;
+		}
+		if (!Connection.SendAll(BuildRequest(Method, Path, Body)))
+		{
+			Response.Error = TEXT("Send failed");
+			return Response;
+		}
+
+		TArray<uint8> BodyBytes;
+		FDockerResponseReader Reader(Connection, TimeoutSeconds > 0.0 ? FPlatformTime::Seconds() + TimeoutSeconds : 0.0, nullptr);
+		const bool bRead = Reader.ReadHeaders() && Reader.ReadBody([&BodyBytes](const uint8* Data, int32 Length)
+		{
+			BodyBytes.Append(Data, Length);
+			return true;
+		});
+
+		Response.Status = Reader.Status;
+		if (!bRead)
+		{
+			Response.Error = Reader.Error;
+		}
+		FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(BodyBytes.GetData()), BodyBytes.Num());
+		Response.Body = FString(Converter.Length(), Converter.Get());
+		return Response;
+	}
+
+	// =====================================
+	// Docker Operations (worker threads)
+	// =====================================
+
+	EDockerContainerState StateFromDocker(const FString& State)
+	{
+		if (State == TEXT("running") || State == TEXT("restarting"))
+		{
+			return EDockerContainerState::Running;
+		}
+		if (State == TEXT("created"))
+		{
+			return EDockerContainerState::Created;
+		}
+		if (State == TEXT("paused"))
+		{
+			return EDockerContainerState::Paused;
+		}
+		return EDockerContainerState::Stopped;
+	}
+
+	/** @return 1 found, 0 no such container, -1 error */
+	int32 InspectContainer(const FDockerEndpoint& Endpoint, const FString& ContainerName, double TimeoutSeconds, FDockerContainerInfo& OutInfo, FString& OutError)
+	{
+		const FDockerResponse Response = DockerRequest(Endpoint, TEXT("GET"),
+			FString::Printf(TEXT("/containers/%s/json"), *FGenericPlatformHttp::UrlEncode(ContainerName)), FString(), TimeoutSeconds);
+		if (Response.Error.IsEmpty() && Response.Status == 404)
+		{
+			OutInfo.Name = ContainerName;
+			OutInfo.State = EDockerContainerState::Missing;
+			return 0;
+		}
+		if (!Response.IsSuccess())
+		{
+			OutError = Response.Describe();
+			return -1;
+		}
+
+		TSharedPtr<FJsonObject> Json;
+		if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Response.Body), Json) || !Json.IsValid())
+		{
+			OutError = TEXT("Malformed container inspect response");
+			return -1;
+		}
+
+		OutInfo.Name = ContainerName;
+		OutInfo.Id = Json->GetStringField(TEXT("Id"));
+		const TSharedPtr<FJsonObject>* Config = nullptr;
+		if (Json->TryGetObjectField(TEXT("Config"), Config))
+		{
+			(*Config)->TryGetStringField(TEXT("Image"), OutInfo.Image);
+		}
+		const TSharedPtr<FJsonObject>* State = nullptr;
+		if (Json->TryGetObjectField(TEXT("State"), State))
+		{
+			OutInfo.State = StateFromDocker((*State)->GetStringField(TEXT("Status")));
+			const TSharedPtr<FJsonObject>* Health = nullptr;
+			if ((*State)->TryGetObjectField(TEXT("Health"), Health))
+			{
+				(*Health)->TryGetStringField(TEXT("Status"), OutInfo.Health);
+			}
+		}
+		return 1;
+	}
+
+	FString BuildCreateBody(const FContainerConfig& Config)
+	{
+		const FString PortKey = FString::Printf(TEXT("%d/tcp"), Config.ContainerPort);
+
+		TSharedRef<FJsonObject> Body = MakeShared<FJsonObject>();
+		Body->SetStringField(TEXT("Image"), Config.ImageName);
+
+		TArray<TSharedPtr<FJsonValue>> Env;
+		for (const TPair<FString, FString>& Variable : Config.EnvironmentVariables)
+		{
+			Env.Add(MakeShared<FJsonValueString>(Variable.Key + TEXT("=") + Variable.Value));
+		}
+		Body->SetArrayField(TEXT("Env"), Env);
+
+		TSharedRef<FJsonObject> ExposedPorts = MakeShared<FJsonObject>();
+		ExposedPorts->SetObjectField(PortKey, MakeShared<FJsonObject>());
+		Body->SetObjectField(TEXT("ExposedPorts"), ExposedPorts);
+
+		TSharedRef<FJsonObject> HostConfig = MakeShared<FJsonObject>();
+
+		TSharedRef<FJsonObject> Binding = MakeShared<FJsonObject>();
+		Binding->SetStringField(TEXT("HostPort"), FString::FromInt(Config.HostPort));
+		TSharedRef<FJsonObject> PortBindings = MakeShared<FJsonObject>();
+		PortBindings->SetArrayField(PortKey, { MakeShared<FJsonValueObject>(Binding) });
+		HostConfig->SetObjectField(TEXT("PortBindings"), PortBindings);
+
+		TArray<TSharedPtr<FJsonValue>> Binds;
+		for (const TPair<FString, FString>& Volume : Config.VolumeMounts)
+		{
+			Binds.Add(MakeShared<FJsonValueString>(Volume.Key + TEXT(":") + Volume.Value));
+		}
+		HostConfig->SetArrayField(TEXT("Binds"), Binds);
+
+		if (Config.bRequireGPU)
+		{
+			// Equivalent of --gpus all
+			TSharedRef<FJsonObject> DeviceRequest = MakeShared<FJsonObject>();
+			DeviceRequest->SetNumberField(TEXT("Count"), -1);
+			TArray<TSharedPtr<FJsonValue>> Capability = { MakeShared<FJsonValueString>(TEXT("gpu")) };
+			DeviceRequest->SetArrayField(TEXT("Capabilities"), { MakeShared<FJsonValueArray>(Capability) });
+			HostConfig->SetArrayField(TEXT("DeviceRequests"), { MakeShared<FJsonValueObject>(DeviceRequest) });
+		}
+		Body->SetObjectField(TEXT("HostConfig"), HostConfig);
+
+		FString Out;
+		FJsonSerializer::Serialize(Body, TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Out));
+		return Out;
+	}
+
+	/** POST /images/create; streams progress until the pull finishes (no timeout - NIM images are large) */
+	bool PullImage(const FDockerEndpoint& Endpoint, const FString& ImageName, FString& OutError)
+	{
+		// Tag is after the last ':' that follows the last '/' (a registry may have a port)
+		FString Repository = ImageName;
+		FString Tag = TEXT("latest");
+		int32 Colon = INDEX_NONE;
+		int32 Slash = INDEX_NONE;
+		ImageName.FindLastChar(TEXT(':'), Colon);
+		ImageName.FindLastChar(TEXT('/'), Slash);
+		if (Colon != INDEX_NONE && Colon > Slash)
+		{
+			Repository = ImageName.Left(Colon);
+			Tag = ImageName.Mid(Colon + 1);
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("ContainerManagerDockerAPI: Pulling image '%s'..."), *ImageName);
+		LBEASTAI_INC_COUNTER(STAT_DockerAPI_Requests, 1);
+
+		FDockerConnection Connection;
+		if (!Connection.Open(Endpoint, OutError))
+		{
+			return false;
+		}
+		const FString Path = FString::Printf(TEXT("/images/create?fromImage=%s&tag=%s"),
+			*FGenericPlatformHttp::UrlEncode(Repository), *FGenericPlatformHttp::UrlEncode(Tag));
+		if (!Connection.SendAll(BuildRequest(TEXT("POST"), Path, FString())))
+		{
+			OutError = TEXT("Send failed");
+			return false;
+		}
+
+		FDockerResponseReader Reader(Connection, 0.0, nullptr);
+		FDockerLineSplitter Lines;
+		FString PullError;
+		const bool bRead = Reader.ReadHeaders() && Reader.ReadBody([&Lines, &PullError](const uint8* Data, int32 Length)
+		{
+			Lines.Append(Data, Length, [&PullError](const FString& Line)
+			{
+				TSharedPtr<FJsonObject> Json;
+				FString Message;
+				if (Line.Contains(TEXT("\"error\"")) && FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Line), Json)
+					&& Json.IsValid() && Json->TryGetStringField(TEXT("error"), Message))
+				{
+					PullError = Message;
+				}
+			});
+			return true;
+		});
+
+		if (!bRead || Reader.Status != 200 || !PullError.IsEmpty())
+		{
+			OutError = FString::Printf(TEXT("Image pull failed for '%s': %s"), *ImageName,
+				!PullError.IsEmpty() ? *PullError : !Reader.Error.IsEmpty() ? *Reader.Error : *FString::Printf(TEXT("HTTP %d"), Reader.Status));
+			return false;
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("ContainerManagerDockerAPI: Pulled image '%s'"), *ImageName);
+		return true;
+	}
+
+	bool DockerEnsureRunning(const FDockerEndpoint& Endpoint, const FContainerConfig& Config, double TimeoutSeconds, FDockerContainerInfo& OutInfo, FString& OutError)
+	{
+		const FString Name = FGenericPlatformHttp::UrlEncode(Config.ContainerName);
+
+		const int32 Found = InspectContainer(Endpoint, Config.ContainerName, TimeoutSeconds, OutInfo, OutError);
+		if (Found < 0)
+		{
+			return false;
+		}
+
+		if (Found == 0)
+		{
+			const FString CreatePath = FString::Printf(TEXT("/containers/create?name=%s"), *Name);
+			const FString CreateBody = BuildCreateBody(Config);
+			FDockerResponse Create = DockerRequest(Endpoint, TEXT("POST"), CreatePath, CreateBody, TimeoutSeconds);
+			if (Create.Error.IsEmpty() && Create.Status == 404)
+			{
+				// No such image
+				if (!PullImage(Endpoint, Config.ImageName, OutError))
+				{
+					return false;
+				}
+				Create = DockerRequest(Endpoint, TEXT("POST"), CreatePath, CreateBody, TimeoutSeconds);
+			}
+			if (!Create.IsSuccess())
+			{
+				OutError = FString::Printf(TEXT("Create '%s' failed: %s"), *Config.ContainerName, *Create.Describe());
+				return false;
+			}
+			OutInfo.State = EDockerContainerState::Created;
+		}
+
+		if (OutInfo.State != EDockerContainerState::Running)
+		{
+			const TCHAR* Action = OutInfo.State == EDockerContainerState::Paused ? TEXT("unpause") : TEXT("start");
+			const FDockerResponse Start = DockerRequest(Endpoint, TEXT("POST"),
+				FString::Printf(TEXT("/containers/%s/%s"), *Name, Action), FString(), TimeoutSeconds);
+			// 304 = already started
+			if (!Start.IsSuccess() && !(Start.Error.IsEmpty() && Start.Status == 304))
+			{
+				OutError = FString::Printf(TEXT("Start '%s' failed: %s"), *Config.ContainerName, *Start.Describe());
+				return false;
+			}
+		}
+
+		FString InspectError;
+		if (InspectContainer(Endpoint, Config.ContainerName, TimeoutSeconds, OutInfo, InspectError) <= 0)
+		{
+			OutInfo.Name = Config.ContainerName;
+			OutInfo.Image = Config.ImageName;
+			OutInfo.State = EDockerContainerState::Running;
+		}
+		return true;
+	}
+
+	bool DockerListContainers(const FDockerEndpoint& Endpoint, double TimeoutSeconds, TArray<FDockerContainerInfo>& OutContainers, FString& OutError)
+	{
+		const FDockerResponse Response = DockerRequest(Endpoint, TEXT("GET"), TEXT("/containers/json?all=1"), FString(), TimeoutSeconds);
+		if (!Response.IsSuccess())
+		{
+			OutError = Response.Describe();
+			return false;
+		}
+
+		TArray<TSharedPtr<FJsonValue>> Entries;
+		if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Response.Body), Entries))
+		{
+			OutError = TEXT("Malformed container list");
+			return false;
+		}
+
+		for (const TSharedPtr<FJsonValue>& Entry : Entries)
+		{
+			const TSharedPtr<FJsonObject> Json = Entry->AsObject();
+			const TArray<TSharedPtr<FJsonValue>>* Names = nullptr;
+			if (!Json.IsValid() || !Json->TryGetArrayField(TEXT("Names"), Names) || Names->Num() == 0)
+			{
+				continue;
+			}
+
+			FDockerContainerInfo& Info = OutContainers.AddDefaulted_GetRef();
+			Info.Name = (*Names)[0]->AsString();
+			Info.Name.RemoveFromStart(TEXT("/"));
+			Info.Id = Json->GetStringField(TEXT("Id"));
+			Info.Image = Json->GetStringField(TEXT("Image"));
+			Info.State = StateFromDocker(Json->GetStringField(TEXT("State")));
+
+			// Status text: "Up 3 minutes (healthy)"
+			const FString Status = Json->GetStringField(TEXT("Status"));
+			if (Status.Contains(TEXT("(unhealthy)")))
+			{
+				Info.Health = TEXT("unhealthy");
+			}
+			else if (Status.Contains(TEXT("(healthy)")))
+			{
+				Info.Health = TEXT("healthy");
+			}
+			else if (Status.Contains(TEXT("(health: starting)")))
+			{
+				Info.Health = TEXT("starting");
+			}
+		}
+		return true;
+	}
+}
+
+// =====================================
+// Event Stream
+// =====================================
+
+/**
+ * Holds GET /events open on its own thread and forwards container events to the game thread.
+ * Reconnects with backoff; every (re)connect triggers a fresh listing so nothing is missed.
+ */
+class FDockerEventStream : public FRunnable
+{
+public:
+	FDockerEventStream(const FDockerEndpoint& InEndpoint, TWeakObjectPtr<UContainerManagerDockerAPI> InOwner)
+		: Endpoint(InEndpoint)
+		, Owner(InOwner)
+	{
+		WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+		Thread = FRunnableThread::Create(this, TEXT("LBEAST_DockerEvents"), 0, TPri_BelowNormal);
+	}
+
+	virtual ~FDockerEventStream()
+	{
+		if (Thread)
+		{
+			Thread->Kill(true);
+			delete Thread;
+		}
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	}
+
+	virtual uint32 Run() override
+	{
+		double BackoffSeconds = MinReconnectSeconds;
+		bool bAvailable = false;
+
+		while (!bStopRequested)
+		{
+			FDockerConnection Connection;
+			FString Error;
+			if (Connection.Open(Endpoint, Error) && Connection.SendAll(BuildRequest(TEXT("GET"), EventsPath, FString())))
+			{
+				FDockerResponseReader Reader(Connection, 0.0, &bStopRequested);
+				if (Reader.ReadHeaders() && Reader.Status == 200)
+				{
+					bAvailable = true;
+					BackoffSeconds = MinReconnectSeconds;
+					PostAvailability(true);
+
+					FDockerLineSplitter Lines;
+					Reader.ReadBody([this, &Lines](const uint8* Data, int32 Length)
+					{
+						Lines.Append(Data, Length, [this](const FString& Line)
+						{
+							PostEvent(Line);
+						});
+						return !bStopRequested;
+					});
+					Error = Reader.Error.IsEmpty() ? TEXT("Event stream closed") : Reader.Error;
+				}
+				else
+				{
+					Error = Reader.Error.IsEmpty() ? FString::Printf(TEXT("Event stream HTTP %d"), Reader.Status) : Reader.Error;
+				}
+			}
+
+			if (bStopRequested)
+			{
+				break;
+			}
+
+			if (bAvailable)
+			{
+				bAvailable = false;
+				UE_LOG(LogTemp, Warning, TEXT("ContainerManagerDockerAPI: Lost Docker daemon (%s) - reconnecting"), *Error);
+				PostAvailability(false);
+			}
+
+			WakeEvent->Wait(FTimespan::FromSeconds(BackoffSeconds));
+			BackoffSeconds = FMath::Min(BackoffSeconds * 2.0, MaxReconnectSeconds);
+		}
+		return 0;
+	}
+
+	virtual void Stop() override
+	{
+		bStopRequested = true;
+		WakeEvent->Trigger();
+	}
+
+private:
+	void PostAvailability(bool bAvailable)
+	{
+		AsyncTask(ENamedThreads::GameThread, [WeakOwner = Owner, bAvailable]()
+		{
+			if (UContainerManagerDockerAPI* Manager = WeakOwner.Get())
+			{
+				Manager->HandleDaemonAvailability(bAvailable);
+			}
+		});
+	}
+
+	void PostEvent(const FString& Line)
+	{
+		// {"Type":"container","Action":"start","Actor":{"ID":"...","Attributes":{"name":"...","image":"..."}}}
+		TSharedPtr<FJsonObject> Json;
+		if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Line), Json) || !Json.IsValid())
+		{
+			return;
+		}
+
+		FString Action;
+		const TSharedPtr<FJsonObject>* Actor = nullptr;
+		const TSharedPtr<FJsonObject>* Attributes = nullptr;
+		if (!Json->TryGetStringField(TEXT("Action"), Action) || !Json->TryGetObjectField(TEXT("Actor"), Actor)
+			|| !(*Actor)->TryGetObjectField(TEXT("Attributes"), Attributes))
+		{
+			return;
+		}
+
+		FString Name, Image;
+		(*Attributes)->TryGetStringField(TEXT("name"), Name);
+		(*Attributes)->TryGetStringField(TEXT("image"), Image);
+		const FString Id = (*Actor)->GetStringField(TEXT("ID"));
+		LBEASTAI_INC_COUNTER(STAT_DockerAPI_Events, 1);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakOwner = Owner, Name, Id, Image, Action]()
+		{
+			if (UContainerManagerDockerAPI* Manager = WeakOwner.Get())
+			{
+				Manager->HandleContainerEvent(Name, Id, Image, Action);
+			}
+		});
+	}
+
+	FDockerEndpoint Endpoint;
+	TWeakObjectPtr<UContainerManagerDockerAPI> Owner;
+	FRunnableThread* Thread = nullptr;
+	FEvent* WakeEvent = nullptr;
+	FThreadSafeBool bStopRequested;
+};
+
+// =====================================
+// UContainerManagerDockerAPI
+// =====================================
+
+UContainerManagerDockerAPI* UContainerManagerDockerAPI::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UContainerManagerDockerAPI>() : nullptr;
+}
+
+void UContainerManagerDockerAPI::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	FString CommandLineHost;
+	if (FParse::Value(FCommandLine::Get(), TEXT("LBEASTDockerHost="), CommandLineHost))
+	{
+		DockerHost = CommandLineHost;
+	}
+}
+
+void UContainerManagerDockerAPI::Deinitialize()
+{
+	delete EventStream;
+	EventStream = nullptr;
+	Super::Deinitialize();
+}
+
+void UContainerManagerDockerAPI::EnsureConnected()
+{
+	if (EventStream)
+	{
+		return;
+	}
+
+	ResolvedHost = DockerHost;
+	if (ResolvedHost.IsEmpty())
+	{
+		ResolvedHost = FPlatformMisc::GetEnvironmentVariable(TEXT("DOCKER_HOST"));
+	}
+	if (ResolvedHost.IsEmpty())
+	{
+#if LBEAST_DOCKER_UNIX_SOCKET
+		ResolvedHost = TEXT("unix:///var/run/docker.sock");
+#elif LBEAST_DOCKER_NAMED_PIPE
+		// Docker Desktop's default endpoint; needs no "expose daemon on TCP" setting
+		ResolvedHost = TEXT("npipe:////./pipe/docker_engine");
+#else
+		ResolvedHost = TEXT("tcp://127.0.0.1:2375");
+#endif
+	}
+
+	FDockerEndpoint Endpoint;
+	if (!ParseDockerHost(ResolvedHost, Endpoint, LastError))
+	{
+		UE_LOG(LogTemp, Error, TEXT("ContainerManagerDockerAPI: %s"), *LastError);
+		return;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("ContainerManagerDockerAPI: Using Docker Engine API at %s"), *ResolvedHost);
+	EventStream = new FDockerEventStream(Endpoint, this);
+}
+
+// =====================================
+// IContainerManager
+// =====================================
+
+bool UContainerManagerDockerAPI::IsContainerRunning_Implementation(const FString& ContainerName) const
+{
+	const FDockerContainerInfo* Info = Containers.Find(ContainerName);
+	return Info && Info->State == EDockerContainerState::Running;
+}
+
+bool UContainerManagerDockerAPI::StartContainer_Implementation(const FContainerConfig& Config)
+{
+	EnsureContainerRunning(Config);
+	return EventStream != nullptr;
+}
+
+bool UContainerManagerDockerAPI::StopContainer_Implementation(const FString& ContainerName)
+{
+	StopContainerAsync(ContainerName);
+	return EventStream != nullptr;
+}
+
+bool UContainerManagerDockerAPI::RemoveContainer_Implementation(const FString& ContainerName)
+{
+	RemoveContainerAsync(ContainerName);
+	return EventStream != nullptr;
+}
+
+bool UContainerManagerDockerAPI::IsDockerAvailable_Implementation() const
+{
+	const_cast<UContainerManagerDockerAPI*>(this)->EnsureConnected();
+	return bDaemonAvailable;
+}
+
+bool UContainerManagerDockerAPI::GetContainerStatus_Implementation(const FString& ContainerName, bool& bIsRunning, bool& bExists) const
+{
+	const_cast<UContainerManagerDockerAPI*>(this)->EnsureConnected();
+
+	const FDockerContainerInfo* Info = Containers.Find(ContainerName);
+	bExists = Info != nullptr;
+	bIsRunning = Info && Info->State == EDockerContainerState::Running;
+	return bListed;
+}
+
+// =====================================
+// Async API
+// =====================================
+
+void UContainerManagerDockerAPI::EnsureContainerRunning(const FContainerConfig& Config, FOnDockerOperationComplete OnComplete)
+{
+	EnsureConnected();
+
+	FDockerEndpoint Endpoint;
+	FString Error;
+	if (Config.ImageName.IsEmpty() || Config.ContainerName.IsEmpty())
+	{
+		Error = TEXT("Container image or name is empty");
+	}
+	else
+	{
+		ParseDockerHost(ResolvedHost, Endpoint, Error);
+	}
+	if (!Error.IsEmpty())
+	{
+		LastError = Error;
+		OnComplete.ExecuteIfBound(false, Error);
+		return;
+	}
+
+	if (IsContainerRunning_Implementation(Config.ContainerName))
+	{
+		OnComplete.ExecuteIfBound(true, FString());
+		return;
+	}
+
+	PendingOperations++;
+	UE_LOG(LogTemp, Log, TEXT("ContainerManagerDockerAPI: Bringing up container '%s' (%s)"), *Config.ContainerName, *Config.ImageName);
+
+	// Own thread rather than the task pool: an image pull can take minutes
+	const double Timeout = RequestTimeoutSeconds;
+	Async(EAsyncExecution::Thread, [Endpoint, Config, Timeout, WeakThis = TWeakObjectPtr<UContainerManagerDockerAPI>(this), OnComplete]()
+	{
+		FDockerContainerInfo Info;
+		FString WorkError;
+		const bool bSuccess = DockerEnsureRunning(Endpoint, Config, Timeout, Info, WorkError);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, OnComplete, bSuccess, Info, WorkError]()
+		{
+			if (UContainerManagerDockerAPI* This = WeakThis.Get())
+			{
+				This->PendingOperations--;
+				if (bSuccess)
+				{
+					This->ApplyContainerInfo(Info);
+					UE_LOG(LogTemp, Log, TEXT("ContainerManagerDockerAPI: Container '%s' is running"), *Info.Name);
+				}
+				else
+				{
+					This->LastError = WorkError;
+					UE_LOG(LogTemp, Error, TEXT("ContainerManagerDockerAPI: %s"), *WorkError);
+				}
+			}
+			OnComplete.ExecuteIfBound(bSuccess, WorkError);
+		});
+	});
+}
+
+void UContainerManagerDockerAPI::EnsureContainersRunning(const TArray<FContainerConfig>& Configs, FOnDockerOperationComplete OnComplete)
+{
+	if (Configs.Num() == 0)
+	{
+		OnComplete.ExecuteIfBound(true, FString());
+		return;
+	}
+
+	struct FBatch
+	{
+		int32 Remaining = 0;
+		bool bAllSucceeded = true;
+		TArray<FString> Errors;
+		FOnDockerOperationComplete OnComplete;
+	};
+	TSharedRef<FBatch> Batch = MakeShared<FBatch>();
+	Batch->Remaining = Configs.Num();
+	Batch->OnComplete = OnComplete;
+
+	for (const FContainerConfig& Config : Configs)
+	{
+		EnsureContainerRunning(Config, FOnDockerOperationComplete::CreateLambda([Batch](bool bSuccess, const FString& Error)
+		{
+			if (!bSuccess)
+			{
+				Batch->bAllSucceeded = false;
+				Batch->Errors.Add(Error);
+			}
+			if (--Batch->Remaining == 0)
+			{
+				Batch->OnComplete.ExecuteIfBound(Batch->bAllSucceeded, FString::Join(Batch->Errors, TEXT("; ")));
+			}
+		}));
+	}
+}
+
+void UContainerManagerDockerAPI::StopContainerAsync(const FString& ContainerName, FOnDockerOperationComplete OnComplete)
+{
+	EnsureConnected();
+
+	FDockerEndpoint Endpoint;
+	FString Error;
+	if (!ParseDockerHost(ResolvedHost, Endpoint, Error))
+	{
+		OnComplete.ExecuteIfBound(false, Error);
+		return;
+	}
+
+	const double Timeout = RequestTimeoutSeconds + StopGraceSeconds;
+	const int32 Grace = StopGraceSeconds;
+	Async(EAsyncExecution::Thread, [Endpoint, ContainerName, Timeout, Grace, WeakThis = TWeakObjectPtr<UContainerManagerDockerAPI>(this), OnComplete]()
+	{
+		const FDockerResponse Response = DockerRequest(Endpoint, TEXT("POST"),
+			FString::Printf(TEXT("/containers/%s/stop?t=%d"), *FGenericPlatformHttp::UrlEncode(ContainerName), Grace), FString(), Timeout);
+		// 304 = already stopped
+		const bool bSuccess = Response.IsSuccess() || (Response.Error.IsEmpty() && Response.Status == 304);
+		const FString WorkError = bSuccess ? FString() : FString::Printf(TEXT("Stop '%s' failed: %s"), *ContainerName, *Response.Describe());
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, OnComplete, bSuccess, ContainerName, WorkError]()
+		{
+			if (UContainerManagerDockerAPI* This = WeakThis.Get())
+			{
+				if (bSuccess)
+				{
+					FDockerContainerInfo Info;
+					if (const FDockerContainerInfo* Cached = This->Containers.Find(ContainerName))
+					{
+						Info = *Cached;
+					}
+					Info.Name = ContainerName;
+					Info.State = EDockerContainerState::Stopped;
+					This->ApplyContainerInfo(Info);
+					UE_LOG(LogTemp, Log, TEXT("ContainerManagerDockerAPI: Stopped container '%s'"), *ContainerName);
+				}
+				else
+				{
+					This->LastError = WorkError;
+					UE_LOG(LogTemp, Warning, TEXT("ContainerManagerDockerAPI: %s"), *WorkError);
+				}
+			}
+			OnComplete.ExecuteIfBound(bSuccess, WorkError);
+		});
+	});
+}
+
+void UContainerManagerDockerAPI::RemoveContainerAsync(const FString& ContainerName, FOnDockerOperationComplete OnComplete)
+{
+	EnsureConnected();
+
+	FDockerEndpoint Endpoint;
+	FString Error;
+	if (!ParseDockerHost(ResolvedHost, Endpoint, Error))
+	{
+		OnComplete.ExecuteIfBound(false, Error);
+		return;
+	}
+
+	const double Timeout = RequestTimeoutSeconds + StopGraceSeconds;
+	Async(EAsyncExecution::Thread, [Endpoint, ContainerName, Timeout, WeakThis = TWeakObjectPtr<UContainerManagerDockerAPI>(this), OnComplete]()
+	{
+		const FDockerResponse Response = DockerRequest(Endpoint, TEXT("DELETE"),
+			FString::Printf(TEXT("/containers/%s?force=1"), *FGenericPlatformHttp::UrlEncode(ContainerName)), FString(), Timeout);
+		const bool bSuccess = Response.IsSuccess();
+		const FString WorkError = bSuccess ? FString() : FString::Printf(TEXT("Remove '%s' failed: %s"), *ContainerName, *Response.Describe());
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, OnComplete, bSuccess, ContainerName, WorkError]()
+		{
+			if (UContainerManagerDockerAPI* This = WeakThis.Get())
+			{
+				if (bSuccess)
+				{
+					FDockerContainerInfo Info;
+					Info.Name = ContainerName;
+					Info.State = EDockerContainerState::Missing;
+					This->ApplyContainerInfo(Info);
+					UE_LOG(LogTemp, Log, TEXT("ContainerManagerDockerAPI: Removed container '%s'"), *ContainerName);
+				}
+				else
+				{
+					This->LastError = WorkError;
+					UE_LOG(LogTemp, Warning, TEXT("ContainerManagerDockerAPI: %s"), *WorkError);
+				}
+			}
+			OnComplete.ExecuteIfBound(bSuccess, WorkError);
+		});
+	});
+}
+
+void UContainerManagerDockerAPI::RefreshContainers()
+{
+	EnsureConnected();
+
+	FDockerEndpoint Endpoint;
+	FString Error;
+	if (!ParseDockerHost(ResolvedHost, Endpoint, Error))
+	{
+		return;
+	}
+
+	const double Timeout = RequestTimeoutSeconds;
+	Async(EAsyncExecution::ThreadPool, [Endpoint, Timeout, WeakThis = TWeakObjectPtr<UContainerManagerDockerAPI>(this)]()
+	{
+		TArray<FDockerContainerInfo> Listed;
+		FString WorkError;
+		const bool bSuccess = DockerListContainers(Endpoint, Timeout, Listed, WorkError);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, bSuccess, Listed, WorkError]()
+		{
+			if (UContainerManagerDockerAPI* This = WeakThis.Get())
+			{
+				if (bSuccess)
+				{
+					This->ApplyListing(Listed);
+				}
+				else
+				{
+					This->LastError = WorkError;
+					UE_LOG(LogTemp, Warning, TEXT("ContainerManagerDockerAPI: Listing containers failed: %s"), *WorkError);
+				}
+			}
+		});
+	});
+}
+
+bool UContainerManagerDockerAPI::GetContainerInfo(const FString& ContainerName, FDockerContainerInfo& OutInfo) const
+{
+	if (const FDockerContainerInfo* Info = Containers.Find(ContainerName))
+	{
+		OutInfo = *Info;
+		return true;
+	}
+	return false;
+}
+
+// =====================================
+// Cache (game thread)
+// =====================================
+
+void UContainerManagerDockerAPI::ApplyContainerInfo(const FDockerContainerInfo& Info)
+{
+	if (Info.Name.IsEmpty())
+	{
+		return;
+	}
+
+	if (Info.State == EDockerContainerState::Missing)
+	{
+		if (Containers.Remove(Info.Name) > 0)
+		{
+			OnContainerStateChanged.Broadcast(Info.Name, EDockerContainerState::Missing);
+		}
+		return;
+	}
+
+	FDockerContainerInfo& Cached = Containers.FindOrAdd(Info.Name);
+	const EDockerContainerState PreviousState = Cached.State;
+	Cached = Info;
+	if (PreviousState != Info.State)
+	{
+		OnContainerStateChanged.Broadcast(Info.Name, Info.State);
+	}
+}
+
+void UContainerManagerDockerAPI::ApplyListing(const TArray<FDockerContainerInfo>& Listed)
+{
+	TSet<FString> ListedNames;
+	for (const FDockerContainerInfo& Info : Listed)
+	{
+		ListedNames.Add(Info.Name);
+		ApplyContainerInfo(Info);
+	}
+
+	// Containers removed while the event stream was down
+	TArray<FString> Gone;
+	for (const TPair<FString, FDockerContainerInfo>& Entry : Containers)
+	{
+		if (!ListedNames.Contains(Entry.Key))
+		{
+			Gone.Add(Entry.Key);
+		}
+	}
+	for (const FString& Name : Gone)
+	{
+		Containers.Remove(Name);
+		OnContainerStateChanged.Broadcast(Name, EDockerContainerState::Missing);
+	}
+
+	bListed = true;
+}
+
+void UContainerManagerDockerAPI::HandleContainerEvent(const FString& ContainerName, const FString& Id, const FString& Image, const FString& Action)
+{
+	if (ContainerName.IsEmpty())
+	{
+		return;
+	}
+
+	FDockerContainerInfo Info;
+	if (const FDockerContainerInfo* Cached = Containers.Find(ContainerName))
+	{
+		Info = *Cached;
+	}
+	Info.Name = ContainerName;
+	if (!Id.IsEmpty())
+	{
+		Info.Id = Id;
+	}
+	if (!Image.IsEmpty())
+	{
+		Info.Image = Image;
+	}
+
+	if (Action == TEXT("create"))
+	{
+		Info.State = EDockerContainerState::Created;
+	}
+	else if (Action == TEXT("start") || Action == TEXT("restart") || Action == TEXT("unpause"))
+	{
+		Info.State = EDockerContainerState::Running;
+	}
+	else if (Action == TEXT("die") || Action == TEXT("stop"))
+	{
+		Info.State = EDockerContainerState::Stopped;
+		Info.Health.Reset();
+	}
+	else if (Action == TEXT("pause"))
+	{
+		Info.State = EDockerContainerState::Paused;
+	}
+	else if (Action == TEXT("destroy"))
+	{
+		Info.State = EDockerContainerState::Missing;
+	}
+	else if (Action.StartsWith(TEXT("health_status")))
+	{
+		// "health_status: healthy"
+		Action.Split(TEXT(":"), nullptr, &Info.Health);
+		Info.Health.TrimStartAndEndInline();
+	}
+	else
+	{
+		return;
+	}
+
+	ApplyContainerInfo(Info);
+}
+
+void UContainerManagerDockerAPI::HandleDaemonAvailability(bool bAvailable)
+{
+	if (bDaemonAvailable == bAvailable)
+	{
+		return;
+	}
+
+	bDaemonAvailable = bAvailable;
+	if (bAvailable)
+	{
+		UE_LOG(LogTemp, Log, TEXT("ContainerManagerDockerAPI: Connected to Docker daemon (%s)"), *ResolvedHost);
+		// Subscribed first, listed second: nothing can change unseen in between
+		RefreshContainers();
+	}
+	else
+	{
+		LastError = FString::Printf(TEXT("Docker daemon not reachable at %s"), *ResolvedHost);
+	}
+	OnDaemonAvailabilityChanged.Broadcast(bAvailable);
+}
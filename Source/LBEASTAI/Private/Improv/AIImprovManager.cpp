@@ -5,6 +5,12 @@
 #include "AIGRPCClient.h"
 #include "LLMProviderManager.h"
 #include "ContainerManagerDockerCLI.h"
+#include "AIReadinessSubsystem.h"
+#include "ExperienceLoop/ExperienceStateMachine.h"
+#include "HAL/PlatformTime.h"
+#include "AI.h"
+
+DECLARE_CYCLE_STAT(TEXT("AIImprovManager Tick"), STAT_AIImprovManager_Tick, STATGROUP_LBEASTAI);
 
 UAIImprovManager::UAIImprovManager()
 {
@@ -25,11 +31,38 @@ void UAIImprovManager::BeginPlay()
 	Super::BeginPlay();
 }
 
+void UAIImprovManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// The readiness subsystem outlives this component; don't leave the gate waiting on it
+	if (UAIReadinessSubsystem* Readiness = UAIReadinessSubsystem::Get(this))
+	{
+		Readiness->UnregisterProvider(UAIReadinessSubsystem::MakeProviderId(this, TEXT("LLM")));
+		Readiness->UnregisterProvider(UAIReadinessSubsystem::MakeProviderId(this, TEXT("TTS")));
+		Readiness->UnregisterProvider(UAIReadinessSubsystem::MakeProviderId(this, TEXT("Audio2Face")));
+	}
+
+	// Callbacks capture this - none may run after the component is gone
+	if (ULLMRequestScheduler* Scheduler = ULLMRequestScheduler::Get(this))
+	{
+		Scheduler->CancelOwner(this);
+	}
+	LiveLLMRequestId = 0;
+	SetNarrativeStateMachine(nullptr);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UAIImprovManager::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	LBEASTAI_SCOPE_CYCLE_COUNTER(STAT_AIImprovManager_Tick);
 	// Generic improv manager doesn't handle timing
 	// Subclasses should override for experience-specific timing logic
+
+	if (bSpeculationDirty && FPlatformTime::Seconds() >= SpeculationDueSeconds)
+	{
+		UpdateSpeculativeTransitions();
+	}
 }
 
 bool UAIImprovManager::InitializeImprovManager()
@@ -109,6 +142,11 @@ bool UAIImprovManager::InitializeImprovManager()
 		}
 	}
 
+	if (ImprovConfig.bWarmUpOnInitialize)
+	{
+		RegisterWarmupProviders();
+	}
+
 	bIsInitialized = true;
 
 	UE_LOG(LogTemp, Log, TEXT("AIImprovManager: Initialized with local LLM: %s, Local TTS: %s, Local Audio2Face: %s"), 
@@ -118,6 +156,28 @@ bool UAIImprovManager::InitializeImprovManager()
 	return true;
 }
 
+void UAIImprovManager::RegisterWarmupProviders()
+{
+	UAIReadinessSubsystem* Readiness = UAIReadinessSubsystem::Get(this);
+	if (!Readiness)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AIImprovManager: No game instance - skipping model warm-up"));
+		return;
+	}
+
+	Readiness->RegisterLLM(UAIReadinessSubsystem::MakeProviderId(this, TEXT("LLM")), LLMProviderManager, ImprovConfig.LLMModelName);
+
+	if (ImprovConfig.bUseLocalTTS && GRPCClient && GRPCClient->IsInitialized())
+	{
+		Readiness->RegisterTTS(UAIReadinessSubsystem::MakeProviderId(this, TEXT("TTS")), GRPCClient, GetWarmupVoiceName(), TEXT("en-US"));
+	}
+
+	if (ImprovConfig.bUseLocalAudio2Face)
+	{
+		Readiness->RegisterAudio2Face(UAIReadinessSubsystem::MakeProviderId(this, TEXT("Audio2Face")), HTTPClient, ImprovConfig.LocalAudio2FaceEndpointURL);
+	}
+}
+
 FString UAIImprovManager::GenerateImprovResponse(const FString& Input)
 {
 	// Generic implementation - subclasses should override for full async pipeline
@@ -152,6 +212,7 @@ void UAIImprovManager::GenerateAndPlayImprovResponse(const FString& Input, bool
 void UAIImprovManager::ClearConversationHistory()
 {
 	ConversationHistory.Empty();
+	NotifyConversationChanged();
 	UE_LOG(LogTemp, Log, TEXT("AIImprovManager: Conversation history cleared"));
 }
 
@@ -165,10 +226,42 @@ void UAIImprovManager::StopCurrentResponse()
 	bIsGeneratingResponse = false;
 	CurrentInput.Empty();
 	CurrentAIResponse.Empty();
+
+	// Free the slot for whoever speaks next (an answer already generating is discarded)
+	if (LiveLLMRequestId != 0)
+	{
+		if (ULLMRequestScheduler* Scheduler = ULLMRequestScheduler::Get(this))
+		{
+			Scheduler->Cancel(LiveLLMRequestId);
+		}
+		LiveLLMRequestId = 0;
+		bIsLLMRequestPending = false;
+	}
 	
 	UE_LOG(LogTemp, Log, TEXT("AIImprovManager: Stopped current response"));
 }
 
+uint32 UAIImprovManager::SubmitLLMRequest(const FLLMRequest& Request, ELLMRequestPriority Priority, TFunction<void(const FLLMResponse&)> Callback)
+{
+	ULLMRequestScheduler* Scheduler = ULLMRequestScheduler::Get(this);
+	if (!Scheduler)
+	{
+		// No game instance (editor preview) - nothing to share the backend with
+		if (LLMProviderManager)
+		{
+			LLMProviderManager->RequestResponse(Request, MoveTemp(Callback));
+		}
+		return 0;
+	}
+
+	FName StationId = ImprovConfig.StationId;
+	if (StationId.IsNone())
+	{
+		StationId = GetOwner() ? GetOwner()->GetFName() : GetFName();
+	}
+	return Scheduler->Submit(LLMProviderManager, Request, Priority, StationId, this, MoveTemp(Callback));
+}
+
 void UAIImprovManager::RequestLLMResponseAsync(const FString& Input, const FString& SystemPrompt, const TArray<FString>& InConversationHistory)
 {
 	// Phase 11: Build prompt with context for appropriate response size (generic)
@@ -231,8 +324,9 @@ FString UAIImprovManager::BuildImprovPromptWithContext(const FString& Input, boo
 
 FString UAIImprovManager::GetBufferedTransition(FName TargetState) const
 {
+	// Text generated before the last exchange would ignore what the guest just said
 	const FImprovTransition* Transition = BufferedTransitions.Find(TargetState);
-	if (Transition && Transition->bIsReady)
+	if (Transition && Transition->bIsReady && Transition->ConversationHash == ConversationHash)
 	{
 		return Transition->TransitionText;
 	}
@@ -242,7 +336,7 @@ FString UAIImprovManager::GetBufferedTransition(FName TargetState) const
 bool UAIImprovManager::IsTransitionReady(FName TargetState) const
 {
 	const FImprovTransition* Transition = BufferedTransitions.Find(TargetState);
-	return Transition && Transition->bIsReady;
+	return Transition && Transition->bIsReady && Transition->ConversationHash == ConversationHash;
 }
 
 void UAIImprovManager::RequestTransitionSentence(FName FromState, FName ToState, const FString& ContextText)
@@ -253,18 +347,56 @@ void UAIImprovManager::RequestTransitionSentence(FName FromState, FName ToState,
 		return;
 	}
 
+	// Speculation usually got here first: reuse its text, or promote its request if still generating
+	if (FImprovTransition* Existing = BufferedTransitions.Find(ToState))
+	{
+		if (Existing->FromStateName == FromState && Existing->ConversationHash == ConversationHash)
+		{
+			if (Existing->bIsReady)
+			{
+				UE_LOG(LogTemp, Log, TEXT("AIImprovManager: Transition to '%s' already buffered"), *ToState.ToString());
+				return;
+			}
+
+			ULLMRequestScheduler* Scheduler = ULLMRequestScheduler::Get(this);
+			if (Existing->RequestId != 0 && Scheduler && Scheduler->SetPriority(Existing->RequestId, ELLMRequestPriority::Transition))
+			{
+				Existing->bSpeculative = false;
+				UE_LOG(LogTemp, Log, TEXT("AIImprovManager: Transition to '%s' already generating - promoted"), *ToState.ToString());
+				return;
+			}
+		}
+	}
+
+	// Scheduled behind live replies: a queued transition never starts ahead of a guest's answer
+	GenerateTransition(FromState, ToState, ContextText, ELLMRequestPriority::Transition, false);
+}
+
+void UAIImprovManager::GenerateTransition(FName FromState, FName ToState, const FString& ContextText, ELLMRequestPriority Priority, bool bSpeculative)
+{
 	// Build transition prompt using generic context builder
 	FString TransitionPrompt = BuildImprovPromptWithContext(ContextText, true);
 	
-	// Create transition entry (not ready yet)
+	// Create transition entry (not ready yet); a request still generating for this state is superseded
 	FImprovTransition& Transition = BufferedTransitions.FindOrAdd(ToState);
+	if (Transition.RequestId != 0)
+	{
+		if (ULLMRequestScheduler* Scheduler = ULLMRequestScheduler::Get(this))
+		{
+			Scheduler->Cancel(Transition.RequestId);
+		}
+		Transition.RequestId = 0;
+	}
 	Transition.TargetStateName = ToState;
+	Transition.FromStateName = FromState;
+	Transition.ConversationHash = ConversationHash;
+	Transition.bSpeculative = bSpeculative;
 	Transition.bIsReady = false;
 	Transition.GenerationStartTime = GetWorld()->GetTimeSeconds();
 	Transition.TransitionText = TEXT("");
 
-	UE_LOG(LogTemp, Log, TEXT("AIImprovManager: Requesting transition sentence from '%s' to '%s'"), 
-		*FromState.ToString(), *ToState.ToString());
+	UE_LOG(LogTemp, Log, TEXT("AIImprovManager: Requesting %stransition sentence from '%s' to '%s'"), 
+		bSpeculative ? TEXT("speculative ") : TEXT(""), *FromState.ToString(), *ToState.ToString());
 
 	// Request LLM response for transition (generic implementation using default LLM config)
 	FLLMRequest LLMRequest;
@@ -275,26 +407,177 @@ void UAIImprovManager::RequestTransitionSentence(FName FromState, FName ToState,
 	LLMRequest.Temperature = ImprovConfig.LLMTemperature;
 	LLMRequest.MaxTokens = 50;  // Short transitions only
 
-	LLMProviderManager->RequestResponse(LLMRequest, [this, ToState](const FLLMResponse& Response)
+	const uint32 RequestId = SubmitLLMRequest(LLMRequest, Priority, [this, ToState](const FLLMResponse& Response)
 	{
+		FImprovTransition* Transition = BufferedTransitions.Find(ToState);
+		if (!Transition)
+		{
+			return;
+		}
+		Transition->RequestId = 0;
+
 		if (Response.ErrorMessage.IsEmpty() && !Response.ResponseText.IsEmpty())
 		{
-			FImprovTransition* Transition = BufferedTransitions.Find(ToState);
-			if (Transition)
-			{
-				Transition->TransitionText = Response.ResponseText;
-				Transition->bIsReady = true;
-				
-				float GenerationTime = GetWorld()->GetTimeSeconds() - Transition->GenerationStartTime;
-				UE_LOG(LogTemp, Log, TEXT("AIImprovManager: Transition sentence ready for state '%s' (generated in %.2fs): '%s'"), 
-					*ToState.ToString(), GenerationTime, *Response.ResponseText);
-			}
+			Transition->TransitionText = Response.ResponseText;
+			Transition->bIsReady = true;
+			
+			float GenerationTime = GetWorld()->GetTimeSeconds() - Transition->GenerationStartTime;
+			UE_LOG(LogTemp, Log, TEXT("AIImprovManager: Transition sentence ready for state '%s' (generated in %.2fs): '%s'"), 
+				*ToState.ToString(), GenerationTime, *Response.ResponseText);
 		}
 		else
 		{
 			UE_LOG(LogTemp, Error, TEXT("AIImprovManager: Failed to generate transition sentence: %s"), *Response.ErrorMessage);
 		}
+
+		// A speculative slot freed up - fill it with the next stale state
+		if (Transition->bSpeculative && SpeculationStateMachine.IsValid())
+		{
+			bSpeculationDirty = true;
+		}
 	});
+
+	// The provider may have answered synchronously; only track a request that is still out
+	ULLMRequestScheduler* Scheduler = ULLMRequestScheduler::Get(this);
+	if (FImprovTransition* PendingTransition = BufferedTransitions.Find(ToState))
+	{
+		PendingTransition->RequestId = (Scheduler && Scheduler->IsPending(RequestId)) ? RequestId : 0;
+	}
+}
+
+// =====================================
+// Speculative Transitions
+// =====================================
+
+void UAIImprovManager::SetNarrativeStateMachine(UExperienceStateMachine* StateMachine)
+{
+	if (UExperienceStateMachine* Previous = SpeculationStateMachine.Get())
+	{
+		Previous->UnbindStateHandler(SpeculationStateHandle);
+	}
+	SpeculationStateHandle.Reset();
+
+	SpeculationStateMachine = StateMachine;
+	if (StateMachine)
+	{
+		SpeculationStateHandle = StateMachine->BindAnyStateEntered(FOnExperienceStateEntered::CreateUObject(this, &UAIImprovManager::HandleSpeculationStateEntered));
+		RefreshSpeculativeTransitions();
+	}
+}
+
+void UAIImprovManager::RefreshSpeculativeTransitions()
+{
+	bSpeculationDirty = true;
+	SpeculationDueSeconds = FPlatformTime::Seconds();
+}
+
+void UAIImprovManager::HandleSpeculationStateEntered(int32 OldStateIndex, int32 NewStateIndex)
+{
+	// Reachable set changed - the new targets are needed as soon as possible
+	RefreshSpeculativeTransitions();
+}
+
+void UAIImprovManager::NotifyConversationChanged()
+{
+	uint32 NewHash = 0;
+	for (const FString& Entry : ConversationHistory)
+	{
+		NewHash = HashCombine(NewHash, GetTypeHash(Entry));
+	}
+
+	if (NewHash == ConversationHash)
+	{
+		return;
+	}
+	ConversationHash = NewHash;
+
+	// Debounced: the guest usually keeps talking
+	bSpeculationDirty = true;
+	SpeculationDueSeconds = FPlatformTime::Seconds() + ImprovConfig.SpeculativeRefreshDelaySeconds;
+}
+
+FString UAIImprovManager::GetTransitionContextForState(FName TargetState) const
+{
+	const UExperienceStateMachine* StateMachine = SpeculationStateMachine.Get();
+	if (!StateMachine)
+	{
+		return FString();
+	}
+
+	const FExperienceState* State = StateMachine->States.FindByPredicate([TargetState](const FExperienceState& Candidate)
+	{
+		return Candidate.StateName == TargetState;
+	});
+	return State ? State->Description : FString();
+}
+
+void UAIImprovManager::UpdateSpeculativeTransitions()
+{
+	bSpeculationDirty = false;
+
+	UExperienceStateMachine* StateMachine = SpeculationStateMachine.Get();
+	if (!bIsInitialized || !ImprovConfig.bSpeculativeTransitions || !StateMachine || !StateMachine->bIsRunning
+		|| !LLMProviderManager || !LLMProviderManager->IsProviderAvailable())
+	{
+		return;
+	}
+
+	const FName CurrentState = StateMachine->GetCurrentStateName();
+	const TArray<FName> Targets = StateMachine->GetReachableStates(ImprovConfig.bSpeculateOperatorJumps);
+	ULLMRequestScheduler* Scheduler = ULLMRequestScheduler::Get(this);
+
+	// Drop speculation nobody can use any more (left the state, conversation moved on, no longer reachable)
+	int32 SpeculativeInFlight = 0;
+	for (TPair<FName, FImprovTransition>& Pair : BufferedTransitions)
+	{
+		FImprovTransition& Transition = Pair.Value;
+		if (!Transition.bSpeculative || Transition.RequestId == 0)
+		{
+			continue;
+		}
+
+		const bool bStale = Transition.FromStateName != CurrentState || Transition.ConversationHash != ConversationHash
+			|| !Targets.Contains(Pair.Key);
+		if (bStale)
+		{
+			if (Scheduler)
+			{
+				Scheduler->Cancel(Transition.RequestId);
+			}
+			Transition.RequestId = 0;
+		}
+		else
+		{
+			SpeculativeInFlight++;
+		}
+	}
+
+	// Targets are ordered most likely first, so a tight budget covers the advance button
+	for (const FName& Target : Targets)
+	{
+		if (SpeculativeInFlight >= ImprovConfig.MaxSpeculativeTransitions)
+		{
+			// Completions mark speculation dirty again and pick up the rest
+			return;
+		}
+
+		// Already attempted under this state and conversation (ready, generating or failed)
+		const FImprovTransition* Existing = BufferedTransitions.Find(Target);
+		if (Existing && Existing->FromStateName == CurrentState && Existing->ConversationHash == ConversationHash)
+		{
+			continue;
+		}
+
+		const FString ContextText = GetTransitionContextForState(Target);
+		if (ContextText.IsEmpty())
+		{
+			continue;
+		}
+
+		GenerateTransition(CurrentState, Target, ContextText, ELLMRequestPriority::PreBake, true);
+		const FImprovTransition* Issued = BufferedTransitions.Find(Target);
+		SpeculativeInFlight += (Issued && Issued->RequestId != 0) ? 1 : 0;
+	}
 }
 
 void UAIImprovManager::OnTTSConversionComplete(const FString& AudioFilePath, const TArray<uint8>& AudioData)
@@ -3,7 +3,7 @@
 #include "LLMProviderManager.h"
 #include "LLMProviderOllama.h"
 #include "LLMProviderOpenAICompatible.h"
-#include "ContainerManagerDockerCLI.h"
+#include "ContainerManagerDockerAPI.h"
 
 ULLMProviderManager::ULLMProviderManager()
 {
@@ -15,71 +15,31 @@ ULLMProviderManager::ULLMProviderManager()
 
 bool ULLMProviderManager::InitializeProvider(const FString& EndpointURL, ELLMProviderType ProviderType, const FString& ModelName, const FContainerConfig& ContainerConfig, bool bAutoStartContainer)
 {
-	// Auto-start container if requested
+	// Auto-start container if requested (non-blocking: the provider is created now and
+	// requests fail fast until the container is up)
 	if (bAutoStartContainer && !ContainerConfig.ImageName.IsEmpty())
 	{
-		// Create container manager if not already created
+		ContainerManager = UContainerManagerDockerAPI::Get(this);
 		if (!ContainerManager)
 		{
-			ContainerManager = NewObject<UContainerManagerDockerCLI>(this);
-		}
-
-		// Check if Docker is available
-		if (!ContainerManager->IsDockerAvailable())
-		{
-			UE_LOG(LogTemp, Error, TEXT("LLMProviderManager: Docker is not available: %s"), 
-				*ContainerManager->GetLastError());
-			// Continue anyway - container might already be running externally
+			UE_LOG(LogTemp, Warning, TEXT("LLMProviderManager: No game instance (create this manager with an outer in a world) - cannot auto-start container '%s'"), 
+				*ContainerConfig.ContainerName);
 		}
 		else
 		{
-			// Check if container is already running
-			bool bIsRunning = false;
-			bool bExists = false;
-			if (ContainerManager->GetContainerStatus(ContainerConfig.ContainerName, bIsRunning, bExists))
-			{
-				if (!bIsRunning)
-				{
-					// Start container if not running
-					UE_LOG(LogTemp, Log, TEXT("LLMProviderManager: Starting container '%s'..."), 
-						*ContainerConfig.ContainerName);
-					
-					if (!ContainerManager->StartContainer(ContainerConfig))
-					{
-						UE_LOG(LogTemp, Error, TEXT("LLMProviderManager: Failed to start container '%s': %s"), 
-							*ContainerConfig.ContainerName, *ContainerManager->GetLastError());
-						// Continue anyway - container might start later or be managed externally
-					}
-					else
-					{
-						UE_LOG(LogTemp, Log, TEXT("LLMProviderManager: Container '%s' started successfully"), 
-							*ContainerConfig.ContainerName);
-					}
-				}
-				else
-				{
-					UE_LOG(LogTemp, Log, TEXT("LLMProviderManager: Container '%s' is already running"), 
-						*ContainerConfig.ContainerName);
-				}
-			}
-			else
+			const FString ContainerName = ContainerConfig.ContainerName;
+			ContainerManager->EnsureContainerRunning(ContainerConfig, FOnDockerOperationComplete::CreateWeakLambda(this, [ContainerName](bool bSuccess, const FString& Error)
 			{
-				// Container doesn't exist, create and start it
-				UE_LOG(LogTemp, Log, TEXT("LLMProviderManager: Creating and starting container '%s'..."), 
-					*ContainerConfig.ContainerName);
-				
-				if (!ContainerManager->StartContainer(ContainerConfig))
+				if (bSuccess)
 				{
-					UE_LOG(LogTemp, Error, TEXT("LLMProviderManager: Failed to start container '%s': %s"), 
-						*ContainerConfig.ContainerName, *ContainerManager->GetLastError());
-					// Continue anyway - container might start later or be managed externally
+					UE_LOG(LogTemp, Log, TEXT("LLMProviderManager: Container '%s' is running"), *ContainerName);
 				}
 				else
 				{
-					UE_LOG(LogTemp, Log, TEXT("LLMProviderManager: Container '%s' started successfully"), 
-						*ContainerConfig.ContainerName);
+					// Container might be managed externally
+					UE_LOG(LogTemp, Error, TEXT("LLMProviderManager: Failed to start container '%s': %s"), *ContainerName, *Error);
 				}
-			}
+			}));
 		}
 	}
 
@@ -98,6 +58,7 @@ bool ULLMProviderManager::InitializeProvider(const FString& EndpointURL, ELLMPro
 			(int32)ActualProviderType);
 		return false;
 	}
+	CurrentEndpointURL = EndpointURL;
 
 	UE_LOG(LogTemp, Log, TEXT("LLMProviderManager: Initialized provider '%s' with endpoint '%s'"), 
 		*GetCurrentProviderName(), *EndpointURL);
@@ -0,0 +1,492 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "LLMRequestScheduler.h"
+#include "AI.h"
+#include "LLMProviderManager.h"
+#include "Async/Async.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+
+DECLARE_CYCLE_STAT(TEXT("LLM Scheduler Submit"), STAT_LLMScheduler_Submit, STATGROUP_LBEASTAI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("LLM Requests Dispatched"), STAT_LLMScheduler_Dispatched, STATGROUP_LBEASTAI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("LLM Requests Preempted"), STAT_LLMScheduler_Preempted, STATGROUP_LBEASTAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("LLM Requests Queued"), STAT_LLMScheduler_Queued, STATGROUP_LBEASTAI);
+
+ULLMRequestScheduler* ULLMRequestScheduler::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<ULLMRequestScheduler>() : nullptr;
+}
+
+void ULLMRequestScheduler::Deinitialize()
+{
+	// In-flight provider callbacks hold a weak pointer and are dropped
+	Backends.Empty();
+	LastServed.Empty();
+	Super::Deinitialize();
+}
+
+FString ULLMRequestScheduler::GetBackendKey(const ULLMProviderManager* ProviderManager)
+{
+	// Managers pointing at the same server share its slots
+	const FString& EndpointURL = ProviderManager->GetEndpointURL();
+	return EndpointURL.IsEmpty() ? ProviderManager->GetPathName() : EndpointURL;
+}
+
+uint32 ULLMRequestScheduler::Submit(ULLMProviderManager* ProviderManager, const FLLMRequest& Request, ELLMRequestPriority Priority,
+	FName StationId, const UObject* Owner, TFunction<void(const FLLMResponse&)> Callback)
+{
+	LBEASTAI_SCOPE_CYCLE_COUNTER(STAT_LLMScheduler_Submit);
+
+	if (!ProviderManager || !ProviderManager->IsProviderAvailable())
+	{
+		if (Callback)
+		{
+			FLLMResponse ErrorResponse;
+			ErrorResponse.bSuccess = false;
+			ErrorResponse.ErrorMessage = TEXT("No provider is currently active");
+			Callback(ErrorResponse);
+		}
+		return 0;
+	}
+
+	const FString BackendKey = GetBackendKey(ProviderManager);
+	FBackend& Backend = Backends.FindOrAdd(BackendKey);
+
+	// Re-read every submit: the manager may have been hot-swapped to a different provider
+	const int32 ProviderSlots = FMath::Max(ProviderManager->GetMaxConcurrentRequests(), 1);
+	Backend.MaxInFlight = MaxInFlightPerBackend > 0 ? FMath::Min(ProviderSlots, MaxInFlightPerBackend) : ProviderSlots;
+	Backend.bCanAbort = ProviderManager->CanAbortRequests();
+
+	TSharedPtr<FScheduledRequest> Scheduled = MakeShared<FScheduledRequest>();
+	Scheduled->Id = NextRequestId++;
+	if (NextRequestId == 0)
+	{
+		NextRequestId = 1;
+	}
+	Scheduled->Request = Request;
+	Scheduled->Priority = Priority;
+	Scheduled->StationId = StationId;
+	Scheduled->ProviderManager = ProviderManager;
+	Scheduled->Owner = Owner;
+	Scheduled->OwnerKey = Owner;
+	Scheduled->Callback = MoveTemp(Callback);
+	Scheduled->SubmitSeconds = FPlatformTime::Seconds();
+
+	// Background work a station can't keep up with is stale by the time it would run; live replies are never dropped
+	TSharedPtr<FScheduledRequest> Dropped;
+	if (Priority != ELLMRequestPriority::LiveReply)
+	{
+		int32 OldestIndex = INDEX_NONE;
+		int32 Count = 0;
+		for (int32 Index = 0; Index < Backend.Queue.Num(); Index++)
+		{
+			const FScheduledRequest& Queued = *Backend.Queue[Index];
+			if (Queued.StationId == StationId && Queued.Priority == Priority)
+			{
+				OldestIndex = Count == 0 ? Index : OldestIndex;
+				Count++;
+			}
+		}
+
+		if (Count >= MaxQueuedPerStation && OldestIndex != INDEX_NONE)
+		{
+			Dropped = Backend.Queue[OldestIndex];
+			Backend.Queue.RemoveAt(OldestIndex);
+			Cancelled++;
+			UE_LOG(LogTemp, Warning, TEXT("LLMRequestScheduler: Station '%s' queue full - dropped request %u"),
+				*StationId.ToString(), Dropped->Id);
+		}
+	}
+
+	const uint32 RequestId = Scheduled->Id;
+	Backend.Queue.Add(MoveTemp(Scheduled));
+
+	Pump(BackendKey);
+
+	// Last: the callback may submit again
+	if (Dropped && Dropped->Callback && (!Dropped->OwnerKey || Dropped->Owner.IsValid()))
+	{
+		FLLMResponse DroppedResponse;
+		DroppedResponse.bSuccess = false;
+		DroppedResponse.ErrorMessage = TEXT("Request dropped: station queue full");
+		Dropped->Callback(DroppedResponse);
+	}
+	return RequestId;
+}
+
+int32 ULLMRequestScheduler::CountInFlight(const FBackend& Backend, FName StationId) const
+{
+	int32 Count = 0;
+	for (const TSharedPtr<FScheduledRequest>& InFlight : Backend.InFlight)
+	{
+		Count += InFlight->StationId == StationId ? 1 : 0;
+	}
+	return Count;
+}
+
+int32 ULLMRequestScheduler::SelectNext(const FBackend& Backend) const
+{
+	const int32 FreeSlots = Backend.MaxInFlight - Backend.InFlight.Num();
+	if (FreeSlots <= 0)
+	{
+		return INDEX_NONE;
+	}
+
+	// Keep the last slot(s) for live replies - a single-slot backend can't reserve anything
+	const int32 Reserved = FMath::Clamp(ReservedLiveSlots, 0, Backend.MaxInFlight - 1);
+	const bool bLiveOnly = FreeSlots <= Reserved;
+
+	for (uint8 PriorityValue = (uint8)ELLMRequestPriority::LiveReply; PriorityValue <= (uint8)ELLMRequestPriority::PreBake; PriorityValue++)
+	{
+		const ELLMRequestPriority Priority = (ELLMRequestPriority)PriorityValue;
+		if (bLiveOnly && Priority != ELLMRequestPriority::LiveReply)
+		{
+			break;
+		}
+
+		// Fewest in flight, then served longest ago; queue order breaks the remaining ties
+		int32 BestIndex = INDEX_NONE;
+		int32 BestInFlight = MAX_int32;
+		uint64 BestLastServed = MAX_uint64;
+		for (int32 Index = 0; Index < Backend.Queue.Num(); Index++)
+		{
+			const FScheduledRequest& Candidate = *Backend.Queue[Index];
+			if (Candidate.Priority != Priority)
+			{
+				continue;
+			}
+
+			const int32 StationInFlight = CountInFlight(Backend, Candidate.StationId);
+			const uint64* StationLastServed = LastServed.Find(Candidate.StationId);
+			const uint64 LastServedSequence = StationLastServed ? *StationLastServed : 0;
+			if (StationInFlight < BestInFlight || (StationInFlight == BestInFlight && LastServedSequence < BestLastServed))
+			{
+				BestIndex = Index;
+				BestInFlight = StationInFlight;
+				BestLastServed = LastServedSequence;
+			}
+		}
+
+		if (BestIndex != INDEX_NONE)
+		{
+			return BestIndex;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+bool ULLMRequestScheduler::PreemptForLiveReply(FBackend& Backend)
+{
+	// A request the provider cannot stop keeps generating on the server: taking it out of InFlight would
+	// oversubscribe the backend and the live reply would still wait behind it
+	if (!bPreemptForLiveReplies || !Backend.bCanAbort || Backend.InFlight.Num() < Backend.MaxInFlight
+		|| !Backend.Queue.ContainsByPredicate([](const TSharedPtr<FScheduledRequest>& Queued) { return Queued->Priority == ELLMRequestPriority::LiveReply; }))
+	{
+		return false;
+	}
+
+	// Cancelled requests first (nobody wants the answer), then the lowest priority, then the most
+	// recently started (least generation thrown away)
+	int32 VictimIndex = INDEX_NONE;
+	for (int32 Index = 0; Index < Backend.InFlight.Num(); Index++)
+	{
+		const FScheduledRequest& Candidate = *Backend.InFlight[Index];
+		if (Candidate.Priority == ELLMRequestPriority::LiveReply && !Candidate.bCancelled)
+		{
+			continue;
+		}
+		if (VictimIndex == INDEX_NONE)
+		{
+			VictimIndex = Index;
+			continue;
+		}
+
+		const FScheduledRequest& Victim = *Backend.InFlight[VictimIndex];
+		if (Candidate.bCancelled != Victim.bCancelled)
+		{
+			VictimIndex = Candidate.bCancelled ? Index : VictimIndex;
+		}
+		else if (Candidate.Priority != Victim.Priority)
+		{
+			VictimIndex = Candidate.Priority > Victim.Priority ? Index : VictimIndex;
+		}
+		else if (Candidate.DispatchSeconds > Victim.DispatchSeconds)
+		{
+			VictimIndex = Index;
+		}
+	}
+	if (VictimIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	TSharedPtr<FScheduledRequest> Victim = Backend.InFlight[VictimIndex];
+	Backend.InFlight.RemoveAt(VictimIndex);
+	if (ULLMProviderManager* ProviderManager = Victim->ProviderManager.Get())
+	{
+		ProviderManager->AbortRequest(Victim->Id);
+	}
+
+	if (!Victim->bCancelled)
+	{
+		// Front of the queue: first in line for its class once the live reply is served
+		Backend.Queue.Insert(Victim, 0);
+		Preempted++;
+		LBEASTAI_INC_COUNTER(STAT_LLMScheduler_Preempted, 1);
+		UE_LOG(LogTemp, Verbose, TEXT("LLMRequestScheduler: Preempted request %u (station '%s') for a live reply"),
+			Victim->Id, *Victim->StationId.ToString());
+	}
+	return true;
+}
+
+void ULLMRequestScheduler::Pump(const FString& BackendKey)
+{
+	// Providers may answer synchronously (errors, stubs); the outer loop picks up the freed slot
+	FBackend* Backend = Backends.Find(BackendKey);
+	if (!Backend || Backend->bPumping)
+	{
+		return;
+	}
+	Backend->bPumping = true;
+
+	while (true)
+	{
+		// Re-find every pass: a callback may have submitted to a new backend and grown the map
+		Backend = Backends.Find(BackendKey);
+		if (!Backend)
+		{
+			return;
+		}
+
+		int32 Index = SelectNext(*Backend);
+		if (Index == INDEX_NONE && PreemptForLiveReply(*Backend))
+		{
+			Index = SelectNext(*Backend);
+		}
+		if (Index == INDEX_NONE)
+		{
+			break;
+		}
+
+		TSharedPtr<FScheduledRequest> Scheduled = Backend->Queue[Index];
+		Backend->Queue.RemoveAt(Index);
+
+		ULLMProviderManager* ProviderManager = Scheduled->ProviderManager.Get();
+		if (!ProviderManager)
+		{
+			// Owner tore its provider manager down with the request still queued
+			Cancelled++;
+			continue;
+		}
+
+		Scheduled->DispatchSeconds = FPlatformTime::Seconds();
+		LastServed.Add(Scheduled->StationId, ++DispatchSequence);
+		if (Scheduled->Priority == ELLMRequestPriority::LiveReply)
+		{
+			LiveQueueWaitMs.Add((float)((Scheduled->DispatchSeconds - Scheduled->SubmitSeconds) * 1000.0));
+		}
+		Backend->InFlight.Add(Scheduled);
+		LBEASTAI_INC_COUNTER(STAT_LLMScheduler_Dispatched, 1);
+
+		TWeakObjectPtr<ULLMRequestScheduler> WeakThis(this);
+		const uint32 RequestId = Scheduled->Id;
+		const uint32 Dispatch = ++Scheduled->Dispatches;
+		Scheduled->Request.RequestTag = RequestId;
+		ProviderManager->RequestResponse(Scheduled->Request, [WeakThis, BackendKey, RequestId, Dispatch](const FLLMResponse& Response)
+		{
+			if (IsInGameThread())
+			{
+				if (ULLMRequestScheduler* Scheduler = WeakThis.Get())
+				{
+					Scheduler->HandleResponse(BackendKey, RequestId, Dispatch, Response);
+				}
+				return;
+			}
+
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, BackendKey, RequestId, Dispatch, Response]()
+			{
+				if (ULLMRequestScheduler* Scheduler = WeakThis.Get())
+				{
+					Scheduler->HandleResponse(BackendKey, RequestId, Dispatch, Response);
+				}
+			});
+		});
+	}
+
+	Backend->bPumping = false;
+
+	int32 QueuedTotal = 0;
+	for (const TPair<FString, FBackend>& Pair : Backends)
+	{
+		QueuedTotal += Pair.Value.Queue.Num();
+	}
+	LBEASTAI_SET_GAUGE(STAT_LLMScheduler_Queued, QueuedTotal);
+}
+
+void ULLMRequestScheduler::HandleResponse(const FString& BackendKey, uint32 RequestId, uint32 Dispatch, const FLLMResponse& Response)
+{
+	FBackend* Backend = Backends.Find(BackendKey);
+	if (!Backend)
+	{
+		return;
+	}
+
+	// A preempted dispatch is no longer in flight (or has been dispatched again): drop its answer
+	const int32 Index = Backend->InFlight.IndexOfByPredicate([RequestId, Dispatch](const TSharedPtr<FScheduledRequest>& InFlight)
+	{
+		return InFlight->Id == RequestId && InFlight->Dispatches == Dispatch;
+	});
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	TSharedPtr<FScheduledRequest> Scheduled = Backend->InFlight[Index];
+	Backend->InFlight.RemoveAt(Index);
+
+	// Start the next request before running the callback (which may be slow or submit more work)
+	Pump(BackendKey);
+
+	const bool bOwnerAlive = !Scheduled->OwnerKey || Scheduled->Owner.IsValid();
+	if (Scheduled->bCancelled || !bOwnerAlive || !Scheduled->Callback)
+	{
+		return;
+	}
+
+	LatencyMs[(uint8)Scheduled->Priority].Add((float)((FPlatformTime::Seconds() - Scheduled->SubmitSeconds) * 1000.0));
+	Completed++;
+	Scheduled->Callback(Response);
+}
+
+bool ULLMRequestScheduler::Cancel(uint32 RequestId)
+{
+	if (RequestId == 0)
+	{
+		return false;
+	}
+
+	for (TPair<FString, FBackend>& Pair : Backends)
+	{
+		FBackend& Backend = Pair.Value;
+		const int32 QueuedIndex = Backend.Queue.IndexOfByPredicate([RequestId](const TSharedPtr<FScheduledRequest>& Queued)
+		{
+			return Queued->Id == RequestId;
+		});
+		if (QueuedIndex != INDEX_NONE)
+		{
+			Backend.Queue.RemoveAt(QueuedIndex);
+			Cancelled++;
+			return true;
+		}
+
+		for (TSharedPtr<FScheduledRequest>& InFlight : Backend.InFlight)
+		{
+			if (InFlight->Id == RequestId && !InFlight->bCancelled)
+			{
+				// Keeps its slot until the backend answers; the answer is discarded
+				InFlight->bCancelled = true;
+				InFlight->Callback = nullptr;
+				Cancelled++;
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+int32 ULLMRequestScheduler::CancelOwner(const UObject* Owner)
+{
+	if (!Owner)
+	{
+		return 0;
+	}
+
+	int32 Removed = 0;
+	for (TPair<FString, FBackend>& Pair : Backends)
+	{
+		FBackend& Backend = Pair.Value;
+		Removed += Backend.Queue.RemoveAll([Owner](const TSharedPtr<FScheduledRequest>& Queued)
+		{
+			return Queued->OwnerKey == Owner;
+		});
+
+		for (TSharedPtr<FScheduledRequest>& InFlight : Backend.InFlight)
+		{
+			if (InFlight->OwnerKey == Owner && !InFlight->bCancelled)
+			{
+				InFlight->bCancelled = true;
+				InFlight->Callback = nullptr;
+				Removed++;
+			}
+		}
+	}
+
+	Cancelled += Removed;
+	return Removed;
+}
+
+bool ULLMRequestScheduler::IsPending(uint32 RequestId) const
+{
+	for (const TPair<FString, FBackend>& Pair : Backends)
+	{
+		auto Matches = [RequestId](const TSharedPtr<FScheduledRequest>& Scheduled)
+		{
+			return Scheduled->Id == RequestId && !Scheduled->bCancelled;
+		};
+		if (Pair.Value.Queue.ContainsByPredicate(Matches) || Pair.Value.InFlight.ContainsByPredicate(Matches))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ULLMRequestScheduler::SetPriority(uint32 RequestId, ELLMRequestPriority Priority)
+{
+	for (TPair<FString, FBackend>& Pair : Backends)
+	{
+		FBackend& Backend = Pair.Value;
+		for (TSharedPtr<FScheduledRequest>& Queued : Backend.Queue)
+		{
+			if (Queued->Id == RequestId)
+			{
+				Queued->Priority = Priority;
+				const FString BackendKey = Pair.Key;
+				Pump(BackendKey);
+				return true;
+			}
+		}
+
+		if (Backend.InFlight.ContainsByPredicate([RequestId](const TSharedPtr<FScheduledRequest>& InFlight)
+		{
+			return InFlight->Id == RequestId && !InFlight->bCancelled;
+		}))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+FLLMSchedulerStats ULLMRequestScheduler::GetStats() const
+{
+	FLLMSchedulerStats Stats;
+	for (const TPair<FString, FBackend>& Pair : Backends)
+	{
+		Stats.Queued += Pair.Value.Queue.Num();
+		Stats.InFlight += Pair.Value.InFlight.Num();
+	}
+	Stats.Completed = Completed;
+	Stats.Cancelled = Cancelled;
+	Stats.Preempted = Preempted;
+	Stats.LiveQueueWaitP95Ms = LiveQueueWaitMs.GetPercentile(0.95f);
+	Stats.LiveLatencyP50Ms = LatencyMs[(uint8)ELLMRequestPriority::LiveReply].GetPercentile(0.5f);
+	Stats.LiveLatencyP95Ms = LatencyMs[(uint8)ELLMRequestPriority::LiveReply].GetPercentile(0.95f);
+	Stats.TransitionLatencyP95Ms = LatencyMs[(uint8)ELLMRequestPriority::Transition].GetPercentile(0.95f);
+	Stats.PreBakeLatencyP95Ms = LatencyMs[(uint8)ELLMRequestPriority::PreBake].GetPercentile(0.95f);
+	return Stats;
+}
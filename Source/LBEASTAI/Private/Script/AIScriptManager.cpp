@@ -2,6 +2,9 @@
 
 #include "Script/AIScriptManager.h"
 #include "AIHTTPClient.h"
+#include "AI.h"
+
+DECLARE_CYCLE_STAT(TEXT("AIScriptManager Tick"), STAT_AIScriptManager_Tick, STATGROUP_LBEASTAI);
 
 UAIScriptManager::UAIScriptManager()
 {
@@ -24,6 +27,7 @@ void UAIScriptManager::BeginPlay()
 void UAIScriptManager::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	LBEASTAI_SCOPE_CYCLE_COUNTER(STAT_AIScriptManager_Tick);
 	// Generic script manager doesn't handle playback timing
 	// Subclasses should override for experience-specific playback logic
 }
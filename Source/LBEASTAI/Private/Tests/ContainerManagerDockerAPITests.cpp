@@ -0,0 +1,725 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "Misc/AutomationTest.h"
+#include "ContainerManagerDockerAPI.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Misc/ScopeLock.h"
+#include "IPAddress.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/Package.h"
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	constexpr EAutomationTestFlags DockerTestFlags = EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter;
+
+	/** Upper bound for any single wait; the stub answers in milliseconds, reconnects take ~1 s */
+	constexpr double WaitTimeoutSeconds = 10.0;
+
+	// =====================================
+	// Stub Docker Engine
+	// =====================================
+
+	/**
+	 * Minimal Docker Engine API on 127.0.0.1 (tcp://, so it works on every platform).
+	 * Serves the endpoints UContainerManagerDockerAPI uses from an in-memory container table
+	 * and emits the matching /events lines, one request per connection like the real daemon
+	 * with "Connection: close".
+	 */
+	class FDockerStubServer : public FRunnable
+	{
+	public:
+		struct FStubContainer
+		{
+			FString Id;
+			FString Image;
+			/** Docker state string: created, running, paused, exited */
+			FString State;
+		};
+
+		~FDockerStubServer()
+		{
+			if (Thread)
+			{
+				Thread->Kill(true);
+				delete Thread;
+			}
+			for (FSocket* Client : EventClients)
+			{
+				CloseSocket(Client);
+			}
+			CloseSocket(ListenSocket);
+		}
+
+		bool Start()
+		{
+			ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+			TSharedRef<FInternetAddr> Address = SocketSubsystem->CreateInternetAddr();
+			Address->SetLoopbackAddress();
+			Address->SetPort(0);
+
+			ListenSocket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("LBEAST_DockerStub"), Address->GetProtocolType());
+			if (!ListenSocket || !ListenSocket->Bind(*Address) || !ListenSocket->Listen(16))
+			{
+				return false;
+			}
+			Port = ListenSocket->GetPortNo();
+			Thread = FRunnableThread::Create(this, TEXT("LBEAST_DockerStub"));
+			return Thread != nullptr;
+		}
+
+		FString GetDockerHost() const
+		{
+			return FString::Printf(TEXT("tcp://127.0.0.1:%d"), Port);
+		}
+
+		void AddImage(const FString& Image)
+		{
+			FScopeLock Lock(&Mutex);
+			Images.Add(Image);
+		}
+
+		void AddContainer(const FString& Name, const FString& Image, const FString& State)
+		{
+			FScopeLock Lock(&Mutex);
+			Images.Add(Image);
+			Containers.Add(Name, { FString::Printf(TEXT("stub%04d"), ++NextId), Image, State });
+		}
+
+		/** Change state the way the daemon would (e.g. a crash) and emit the event */
+		void SetContainerState(const FString& Name, const FString& State, const FString& Action)
+		{
+			FScopeLock Lock(&Mutex);
+			if (FStubContainer* Container = Containers.Find(Name))
+			{
+				Container->State = State;
+				QueueEvent(Name, *Container, Action);
+			}
+		}
+
+		/** Remove a container without an event, then drop the /events streams (daemon restart) */
+		void RemoveContainerSilentlyAndRestart(const FString& Name)
+		{
+			FScopeLock Lock(&Mutex);
+			Containers.Remove(Name);
+			bDropEventClients = true;
+		}
+
+		bool GetContainerState(const FString& Name, FString& OutState) const
+		{
+			FScopeLock Lock(&Mutex);
+			const FStubContainer* Container = Containers.Find(Name);
+			if (Container)
+			{
+				OutState = Container->State;
+			}
+			return Container != nullptr;
+		}
+
+		/** Requests received whose "METHOD /path" (query stripped) starts with Prefix */
+		int32 CountRequests(const FString& Prefix) const
+		{
+			FScopeLock Lock(&Mutex);
+			int32 Count = 0;
+			for (const FString& Request : RequestLog)
+			{
+				Count += Request.StartsWith(Prefix) ? 1 : 0;
+			}
+			return Count;
+		}
+
+		int32 GetEventClientCount() const
+		{
+			return EventClientCount;
+		}
+
+		virtual uint32 Run() override
+		{
+			while (!bStopRequested)
+			{
+				bool bPending = false;
+				if (ListenSocket->WaitForPendingConnection(bPending, FTimespan::FromMilliseconds(10)) && bPending)
+				{
+					if (FSocket* Client = ListenSocket->Accept(TEXT("LBEAST_DockerStubClient")))
+					{
+						ServeClient(Client);
+					}
+				}
+				FlushEvents();
+			}
+			return 0;
+		}
+
+		virtual void Stop() override
+		{
+			bStopRequested = true;
+		}
+
+	private:
+		void ServeClient(FSocket* Client)
+		{
+			FString Method, Path, Query, Body;
+			if (!ReadRequest(Client, Method, Path, Query, Body))
+			{
+				CloseSocket(Client);
+				return;
+			}
+
+			FScopeLock Lock(&Mutex);
+			RequestLog.Add(Method + TEXT(" ") + Path);
+
+			TArray<FString> Segments;
+			Path.ParseIntoArray(Segments, TEXT("/"));
+			for (FString& Segment : Segments)
+			{
+				Segment = FGenericPlatformHttp::UrlDecode(Segment);
+			}
+
+			if (Method == TEXT("GET") && Path == TEXT("/events"))
+			{
+				SendText(Client, TEXT("HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nTransfer-Encoding: chunked\r\n\r\n"));
+				EventClients.Add(Client);
+				EventClientCount = EventClients.Num();
+				return;
+			}
+
+			if (Method == TEXT("GET") && Path == TEXT("/containers/json"))
+			{
+				TArray<FString> Entries;
+				for (const TPair<FString, FStubContainer>& Entry : Containers)
+				{
+					Entries.Add(FString::Printf(TEXT("{\"Id\":\"%s\",\"Names\":[\"/%s\"],\"Image\":\"%s\",\"State\":\"%s\",\"Status\":\"%s\"}"),
+						*Entry.Value.Id, *Entry.Key, *Entry.Value.Image, *Entry.Value.State,
+						Entry.Value.State == TEXT("running") ? TEXT("Up 1 second") : TEXT("Exited (0) 1 second ago")));
+				}
+				Respond(Client, 200, TEXT("[") + FString::Join(Entries, TEXT(",")) + TEXT("]"));
+			}
+			else if (Method == TEXT("POST") && Path == TEXT("/containers/create"))
+			{
+				const FString Name = GetQueryValue(Query, TEXT("name"));
+				FString Image;
+				const int32 ImageStart = Body.Find(TEXT("\"Image\":\""));
+				if (ImageStart != INDEX_NONE)
+				{
+					Image = Body.Mid(ImageStart + 9);
+					Image.LeftInline(Image.Find(TEXT("\"")));
+				}
+
+				if (Containers.Contains(Name))
+				{
+					Respond(Client, 409, TEXT("{\"message\":\"Conflict. The container name is already in use\"}"));
+				}
+				else if (!Images.Contains(Image))
+				{
+					Respond(Client, 404, FString::Printf(TEXT("{\"message\":\"No such image: %s\"}"), *Image));
+				}
+				else
+				{
+					FStubContainer& Container = Containers.Add(Name, { FString::Printf(TEXT("stub%04d"), ++NextId), Image, TEXT("created") });
+					QueueEvent(Name, Container, TEXT("create"));
+					Respond(Client, 201, FString::Printf(TEXT("{\"Id\":\"%s\",\"Warnings\":[]}"), *Container.Id));
+				}
+			}
+			else if (Method == TEXT("POST") && Path == TEXT("/images/create"))
+			{
+				Images.Add(GetQueryValue(Query, TEXT("fromImage")) + TEXT(":") + GetQueryValue(Query, TEXT("tag")));
+				// Progress lines, chunked like the real daemon
+				SendText(Client, TEXT("HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nTransfer-Encoding: chunked\r\n\r\n"));
+				SendChunk(Client, TEXT("{\"status\":\"Pulling fs layer\"}\n"));
+				SendChunk(Client, TEXT("{\"status\":\"Download complete\"}\n"));
+				SendText(Client, TEXT("0\r\n\r\n"));
+			}
+			else if (Segments.Num() >= 2 && Segments[0] == TEXT("containers"))
+			{
+				ServeContainer(Client, Method, Segments);
+			}
+			else
+			{
+				Respond(Client, 404, TEXT("{\"message\":\"page not found\"}"));
+			}
+
+			CloseSocket(Client);
+		}
+
+		/** /containers/{name}[/json|/start|/unpause|/stop] */
+		void ServeContainer(FSocket* Client, const FString& Method, const TArray<FString>& Segments)
+		{
+			const FString& Name = Segments[1];
+			FStubContainer* Container = Containers.Find(Name);
+			if (!Container)
+			{
+				Respond(Client, 404, FString::Printf(TEXT("{\"message\":\"No such container: %s\"}"), *Name));
+				return;
+			}
+
+			const FString Action = Segments.Num() > 2 ? Segments[2] : FString();
+			if (Method == TEXT("GET") && Action == TEXT("json"))
+			{
+				Respond(Client, 200, FString::Printf(TEXT("{\"Id\":\"%s\",\"Name\":\"/%s\",\"Config\":{\"Image\":\"%s\"},\"State\":{\"Status\":\"%s\"}}"),
+					*Container->Id, *Name, *Container->Image, *Container->State));
+			}
+			else if (Method == TEXT("POST") && (Action == TEXT("start") || Action == TEXT("unpause")))
+			{
+				if (Container->State == TEXT("running"))
+				{
+					Respond(Client, 304, FString());
+					return;
+				}
+				Container->State = TEXT("running");
+				QueueEvent(Name, *Container, Action);
+				Respond(Client, 204, FString());
+			}
+			else if (Method == TEXT("POST") && Action == TEXT("stop"))
+			{
+				if (Container->State != TEXT("running"))
+				{
+					Respond(Client, 304, FString());
+					return;
+				}
+				Container->State = TEXT("exited");
+				QueueEvent(Name, *Container, TEXT("die"));
+				QueueEvent(Name, *Container, TEXT("stop"));
+				Respond(Client, 204, FString());
+			}
+			else if (Method == TEXT("DELETE") && Action.IsEmpty())
+			{
+				const FStubContainer Removed = *Container;
+				Containers.Remove(Name);
+				QueueEvent(Name, Removed, TEXT("destroy"));
+				Respond(Client, 204, FString());
+			}
+			else
+			{
+				Respond(Client, 404, TEXT("{\"message\":\"page not found\"}"));
+			}
+		}
+
+		bool ReadRequest(FSocket* Client, FString& OutMethod, FString& OutPath, FString& OutQuery, FString& OutBody)
+		{
+			TArray<uint8> Buffer;
+			int32 HeaderEnd = INDEX_NONE;
+			int64 ContentLength = 0;
+			const double Deadline = FPlatformTime::Seconds() + 2.0;
+			while (FPlatformTime::Seconds() < Deadline)
+			{
+				if (HeaderEnd == INDEX_NONE)
+				{
+					for (int32 Index = 0; Index + 4 <= Buffer.Num(); Index++)
+					{
+						if (FMemory::Memcmp(Buffer.GetData() + Index, "\r\n\r\n", 4) == 0)
+						{
+							HeaderEnd = Index;
+							const FString Headers(HeaderEnd, reinterpret_cast<const ANSICHAR*>(Buffer.GetData()));
+							const int32 LengthAt = Headers.Find(TEXT("Content-Length:"), ESearchCase::IgnoreCase);
+							if (LengthAt != INDEX_NONE)
+							{
+								ContentLength = FCString::Atoi64(*Headers.Mid(LengthAt + 15));
+							}
+
+							FString RequestLine, Target;
+							Headers.Split(TEXT("\r\n"), &RequestLine, nullptr);
+							RequestLine.Split(TEXT(" "), &OutMethod, &Target);
+							Target.Split(TEXT(" "), &Target, nullptr);
+							if (!Target.Split(TEXT("?"), &OutPath, &OutQuery))
+							{
+								OutPath = Target;
+							}
+							break;
+						}
+					}
+				}
+				if (HeaderEnd != INDEX_NONE && Buffer.Num() >= HeaderEnd + 4 + ContentLength)
+				{
+					FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Buffer.GetData() + HeaderEnd + 4), (int32)ContentLength);
+					OutBody = FString(Converter.Length(), Converter.Get());
+					return true;
+				}
+
+				uint8 Temp[4096];
+				int32 BytesRead = 0;
+				if (!Client->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromMilliseconds(100)))
+				{
+					continue;
+				}
+				if (!Client->Recv(Temp, sizeof(Temp), BytesRead) || BytesRead <= 0)
+				{
+					return false;
+				}
+				Buffer.Append(Temp, BytesRead);
+			}
+			return false;
+		}
+
+		static FString GetQueryValue(const FString& Query, const FString& Key)
+		{
+			TArray<FString> Pairs;
+			Query.ParseIntoArray(Pairs, TEXT("&"));
+			for (const FString& Pair : Pairs)
+			{
+				FString PairKey, Value;
+				if (Pair.Split(TEXT("="), &PairKey, &Value) && PairKey == Key)
+				{
+					return FGenericPlatformHttp::UrlDecode(Value);
+				}
+			}
+			return FString();
+		}
+
+		void Respond(FSocket* Client, int32 Status, const FString& Body)
+		{
+			FTCHARToUTF8 BodyUtf8(*Body);
+			SendText(Client, FString::Printf(TEXT("HTTP/1.1 %d Stub\r\nContent-Type: application/json\r\nContent-Length: %d\r\nConnection: close\r\n\r\n"),
+				Status, BodyUtf8.Length()) + Body);
+		}
+
+		void SendChunk(FSocket* Client, const FString& Data)
+		{
+			FTCHARToUTF8 DataUtf8(*Data);
+			SendText(Client, FString::Printf(TEXT("%x\r\n"), DataUtf8.Length()) + Data + TEXT("\r\n"));
+		}
+
+		static bool SendText(FSocket* Client, const FString& Text)
+		{
+			FTCHARToUTF8 Utf8(*Text);
+			int32 Offset = 0;
+			while (Offset < Utf8.Length())
+			{
+				int32 Sent = 0;
+				if (!Client->Send(reinterpret_cast<const uint8*>(Utf8.Get()) + Offset, Utf8.Length() - Offset, Sent) || Sent <= 0)
+				{
+					return false;
+				}
+				Offset += Sent;
+			}
+			return true;
+		}
+
+		/** Caller holds Mutex */
+		void QueueEvent(const FString& Name, const FStubContainer& Container, const FString& Action)
+		{
+			PendingEvents.Add(FString::Printf(TEXT("{\"Type\":\"container\",\"Action\":\"%s\",\"Actor\":{\"ID\":\"%s\",\"Attributes\":{\"name\":\"%s\",\"image\":\"%s\"}}}\n"),
+				*Action, *Container.Id, *Name, *Container.Image));
+		}
+
+		void FlushEvents()
+		{
+			FScopeLock Lock(&Mutex);
+			if (bDropEventClients)
+			{
+				bDropEventClients = false;
+				PendingEvents.Reset();
+				for (FSocket* Client : EventClients)
+				{
+					CloseSocket(Client);
+				}
+				EventClients.Reset();
+				EventClientCount = 0;
+				return;
+			}
+
+			for (const FString& Event : PendingEvents)
+			{
+				for (FSocket* Client : EventClients)
+				{
+					SendChunk(Client, Event);
+				}
+			}
+			PendingEvents.Reset();
+		}
+
+		static void CloseSocket(FSocket* Socket)
+		{
+			if (Socket)
+			{
+				Socket->Close();
+				ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+			}
+		}
+
+		FSocket* ListenSocket = nullptr;
+		FRunnableThread* Thread = nullptr;
+		int32 Port = 0;
+		FThreadSafeBool bStopRequested;
+
+		mutable FCriticalSection Mutex;
+		TMap<FString, FStubContainer> Containers;
+		TSet<FString> Images;
+		TArray<FString> RequestLog;
+		TArray<FString> PendingEvents;
+		int32 NextId = 0;
+		bool bDropEventClients = false;
+
+		/** Stub thread only */
+		TArray<FSocket*> EventClients;
+		std::atomic<int32> EventClientCount{ 0 };
+	};
+
+	// =====================================
+	// Test helpers
+	// =====================================
+
+	/** Last completed operation; shared so a late callback after a timed-out test stays safe */
+	struct FDockerOperationResult
+	{
+		bool bComplete = false;
+		bool bSuccess = false;
+		FString Error;
+	};
+
+	struct FDockerTestContext
+	{
+		TUniquePtr<FDockerStubServer> Stub;
+		TStrongObjectPtr<UContainerManagerDockerAPI> Manager;
+		TSharedRef<FDockerOperationResult> Result = MakeShared<FDockerOperationResult>();
+
+		FOnDockerOperationComplete MakeCallback()
+		{
+			Result->bComplete = false;
+			return FOnDockerOperationComplete::CreateLambda([Result = Result](bool bSuccess, const FString& Error)
+			{
+				Result->bComplete = true;
+				Result->bSuccess = bSuccess;
+				Result->Error = Error;
+			});
+		}
+
+		~FDockerTestContext()
+		{
+			if (Manager)
+			{
+				Manager->Deinitialize();
+			}
+		}
+	};
+
+	TSharedRef<FDockerTestContext> MakeDockerTestContext(FAutomationTestBase& Test)
+	{
+		TSharedRef<FDockerTestContext> Context = MakeShared<FDockerTestContext>();
+		Context->Stub = MakeUnique<FDockerStubServer>();
+		Test.TestTrue(TEXT("Stub Docker daemon listening"), Context->Stub->Start());
+		Context->Manager.Reset(NewObject<UContainerManagerDockerAPI>(GetTransientPackage()));
+		Context->Manager->DockerHost = Context->Stub->GetDockerHost();
+		return Context;
+	}
+
+	FContainerConfig MakeConfig(const FString& Name, const FString& Image)
+	{
+		FContainerConfig Config;
+		Config.ContainerName = Name;
+		Config.ImageName = Image;
+		Config.HostPort = 8000;
+		Config.ContainerPort = 8000;
+		Config.bRequireGPU = false;
+		return Config;
+	}
+
+	/** Latent step: wait (pumping the game thread) until Condition holds, or fail after WaitTimeoutSeconds */
+	void WaitUntil(FAutomationTestBase* Test, const FString& Description, TFunction<bool()> Condition)
+	{
+		TSharedRef<double> Deadline = MakeShared<double>(0.0);
+		ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([Test, Description, Condition, Deadline]()
+		{
+			if (*Deadline == 0.0)
+			{
+				*Deadline = FPlatformTime::Seconds() + WaitTimeoutSeconds;
+			}
+			if (Condition())
+			{
+				return true;
+			}
+			if (FPlatformTime::Seconds() > *Deadline)
+			{
+				Test->AddError(FString::Printf(TEXT("Timed out waiting for: %s"), *Description));
+				return true;
+			}
+			return false;
+		}));
+	}
+
+	void ThenDo(TFunction<void()> Step)
+	{
+		ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([Step]()
+		{
+			Step();
+			return true;
+		}));
+	}
+}
+
+// =====================================
+// Tests
+// =====================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FContainerManagerDockerAPIBringUpTest, "LBEAST.AI.DockerAPI.BringUp", DockerTestFlags)
+
+bool FContainerManagerDockerAPIBringUpTest::RunTest(const FString& Parameters)
+{
+	TSharedRef<FDockerTestContext> Context = MakeDockerTestContext(*this);
+
+	// One container to create, one stopped, one whose image must be pulled first
+	Context->Stub->AddImage(TEXT("lbeast/llm:1"));
+	Context->Stub->AddContainer(TEXT("lbeast-asr"), TEXT("lbeast/asr:1"), TEXT("exited"));
+
+	Context->Manager->EnsureContainersRunning({
+		MakeConfig(TEXT("lbeast-llm"), TEXT("lbeast/llm:1")),
+		MakeConfig(TEXT("lbeast-asr"), TEXT("lbeast/asr:1")),
+		MakeConfig(TEXT("lbeast-tts"), TEXT("registry.local:5000/lbeast/tts:2")) },
+		Context->MakeCallback());
+	TestEqual(TEXT("Requests run in parallel"), Context->Manager->GetPendingOperationCount(), 3);
+
+	WaitUntil(this, TEXT("bring-up complete"), [Context]() { return Context->Result->bComplete; });
+	ThenDo([this, Context]()
+	{
+		TestTrue(TEXT("Bring-up succeeded"), Context->Result->bSuccess);
+		TestEqual(TEXT("Bring-up error"), Context->Result->Error, FString());
+		TestEqual(TEXT("No pending operations"), Context->Manager->GetPendingOperationCount(), 0);
+		TestEqual(TEXT("Only the missing image was pulled"), Context->Stub->CountRequests(TEXT("POST /images/create")), 1);
+
+		for (const TCHAR* Name : { TEXT("lbeast-llm"), TEXT("lbeast-asr"), TEXT("lbeast-tts") })
+		{
+			FString State;
+			TestTrue(FString::Printf(TEXT("%s exists on daemon"), Name), Context->Stub->GetContainerState(Name, State));
+			TestEqual(FString::Printf(TEXT("%s running on daemon"), Name), State, FString(TEXT("running")));
+			TestTrue(FString::Printf(TEXT("%s running in cache"), Name), IContainerManager::Execute_IsContainerRunning(Context->Manager.Get(), Name));
+		}
+
+		// Already running: answered from the cache without another request
+		const int32 InspectsBefore = Context->Stub->CountRequests(TEXT("GET /containers/lbeast-llm/json"));
+		Context->Manager->EnsureContainerRunning(MakeConfig(TEXT("lbeast-llm"), TEXT("lbeast/llm:1")), Context->MakeCallback());
+		TestTrue(TEXT("Running container completes immediately"), Context->Result->bComplete && Context->Result->bSuccess);
+		TestEqual(TEXT("No request for a cached running container"), Context->Stub->CountRequests(TEXT("GET /containers/lbeast-llm/json")), InspectsBefore);
+
+		Context->Manager->StopContainerAsync(TEXT("lbeast-llm"), Context->MakeCallback());
+	});
+
+	WaitUntil(this, TEXT("stop complete"), [Context]() { return Context->Result->bComplete; });
+	ThenDo([this, Context]()
+	{
+		TestTrue(TEXT("Stop succeeded"), Context->Result->bSuccess);
+		FDockerContainerInfo Info;
+		TestTrue(TEXT("Stopped container cached"), Context->Manager->GetContainerInfo(TEXT("lbeast-llm"), Info));
+		TestTrue(TEXT("Stopped state"), Info.State == EDockerContainerState::Stopped);
+
+		Context->Manager->RemoveContainerAsync(TEXT("lbeast-llm"), Context->MakeCallback());
+	});
+
+	WaitUntil(this, TEXT("remove complete"), [Context]() { return Context->Result->bComplete; });
+	ThenDo([this, Context]()
+	{
+		TestTrue(TEXT("Remove succeeded"), Context->Result->bSuccess);
+		FString State;
+		TestFalse(TEXT("Removed on daemon"), Context->Stub->GetContainerState(TEXT("lbeast-llm"), State));
+		FDockerContainerInfo Info;
+		TestFalse(TEXT("Removed from cache"), Context->Manager->GetContainerInfo(TEXT("lbeast-llm"), Info));
+	});
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FContainerManagerDockerAPIEventStreamTest, "LBEAST.AI.DockerAPI.EventStream", DockerTestFlags)
+
+bool FContainerManagerDockerAPIEventStreamTest::RunTest(const FString& Parameters)
+{
+	TSharedRef<FDockerTestContext> Context = MakeDockerTestContext(*this);
+	Context->Stub->AddContainer(TEXT("lbeast-llm"), TEXT("lbeast/llm:1"), TEXT("running"));
+	Context->Stub->AddContainer(TEXT("lbeast-asr"), TEXT("lbeast/asr:1"), TEXT("running"));
+
+	// First query connects the event stream and lists once
+	bool bIsRunning = false;
+	bool bExists = false;
+	TestFalse(TEXT("Not listed before connecting"), IContainerManager::Execute_GetContainerStatus(Context->Manager.Get(), TEXT("lbeast-llm"), bIsRunning, bExists));
+
+	WaitUntil(this, TEXT("initial listing"), [Context]()
+	{
+		bool bRunning = false;
+		bool bFound = false;
+		return IContainerManager::Execute_GetContainerStatus(Context->Manager.Get(), TEXT("lbeast-llm"), bRunning, bFound) && bRunning;
+	});
+	ThenDo([this, Context]()
+	{
+		TestTrue(TEXT("Daemon available"), IContainerManager::Execute_IsDockerAvailable(Context->Manager.Get()));
+		TestEqual(TEXT("Listed once"), Context->Stub->CountRequests(TEXT("GET /containers/json")), 1);
+
+		// Crash reported by the daemon, no polling involved
+		Context->Stub->SetContainerState(TEXT("lbeast-asr"), TEXT("exited"), TEXT("die"));
+	});
+
+	WaitUntil(this, TEXT("die event applied"), [Context]()
+	{
+		return !IContainerManager::Execute_IsContainerRunning(Context->Manager.Get(), TEXT("lbeast-asr"));
+	});
+	ThenDo([this, Context]()
+	{
+		TestEqual(TEXT("No relisting for events"), Context->Stub->CountRequests(TEXT("GET /containers/json")), 1);
+
+		// Daemon restarts and loses a container while the stream is down: relisted on reconnect
+		AddExpectedError(TEXT("Lost Docker daemon"), EAutomationExpectedErrorFlags::Contains, 1);
+		Context->Stub->RemoveContainerSilentlyAndRestart(TEXT("lbeast-llm"));
+	});
+
+	WaitUntil(this, TEXT("relist after reconnect"), [Context]()
+	{
+		FDockerContainerInfo Info;
+		return !Context->Manager->GetContainerInfo(TEXT("lbeast-llm"), Info);
+	});
+	ThenDo([this, Context]()
+	{
+		TestEqual(TEXT("Relisted once on reconnect"), Context->Stub->CountRequests(TEXT("GET /containers/json")), 2);
+		TestEqual(TEXT("Event stream reconnected"), Context->Stub->GetEventClientCount(), 1);
+		FDockerContainerInfo Info;
+		TestTrue(TEXT("Surviving container still cached"), Context->Manager->GetContainerInfo(TEXT("lbeast-asr"), Info));
+		TestTrue(TEXT("Surviving container state"), Info.State == EDockerContainerState::Stopped);
+	});
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FContainerManagerDockerAPIErrorsTest, "LBEAST.AI.DockerAPI.Errors", DockerTestFlags)
+
+bool FContainerManagerDockerAPIErrorsTest::RunTest(const FString& Parameters)
+{
+	// Bad endpoint: fails immediately, without a request
+	{
+		TStrongObjectPtr<UContainerManagerDockerAPI> Manager(NewObject<UContainerManagerDockerAPI>(GetTransientPackage()));
+		Manager->DockerHost = TEXT("ftp://docker");
+		AddExpectedError(TEXT("Unsupported DOCKER_HOST"), EAutomationExpectedErrorFlags::Contains, 1);
+
+		bool bCalled = false;
+		bool bResult = true;
+		Manager->EnsureContainerRunning(MakeConfig(TEXT("lbeast-llm"), TEXT("lbeast/llm:1")),
+			FOnDockerOperationComplete::CreateLambda([&bCalled, &bResult](bool bSuccess, const FString& Error)
+			{
+				bCalled = true;
+				bResult = bSuccess;
+			}));
+		TestTrue(TEXT("Bad endpoint completes synchronously"), bCalled);
+		TestFalse(TEXT("Bad endpoint fails"), bResult);
+		TestTrue(TEXT("Bad endpoint error"), Manager->GetLastError().Contains(TEXT("Unsupported DOCKER_HOST")));
+		Manager->Deinitialize();
+	}
+
+	// Daemon rejects a request: the error carries the daemon's message
+	TSharedRef<FDockerTestContext> Context = MakeDockerTestContext(*this);
+	Context->Stub->AddContainer(TEXT("lbeast-llm"), TEXT("lbeast/llm:1"), TEXT("exited"));
+	Context->Manager->StopContainerAsync(TEXT("lbeast-missing"), Context->MakeCallback());
+	AddExpectedError(TEXT("No such container"), EAutomationExpectedErrorFlags::Contains, 1);
+
+	WaitUntil(this, TEXT("stop of missing container"), [Context]() { return Context->Result->bComplete; });
+	ThenDo([this, Context]()
+	{
+		TestFalse(TEXT("Stop of missing container fails"), Context->Result->bSuccess);
+		TestTrue(TEXT("Daemon message surfaced"), Context->Result->Error.Contains(TEXT("No such container")) && Context->Result->Error.Contains(TEXT("404")));
+	});
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -4,8 +4,17 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "LBEASTStats.h"
 #include "AIAPI.h"  // For LBEASTAI_API macro
 
+/** Stats group ("stat LBEASTAI") and Unreal Insights channel for this module (see LBEASTStats.h) */
+DECLARE_STATS_GROUP(TEXT("LBEAST AI"), STATGROUP_LBEASTAI, STATCAT_Advanced);
+LBEAST_DECLARE_TRACE_CHANNEL(LBEASTAIChannel, LBEASTAI_API);
+
+#define LBEASTAI_SCOPE_CYCLE_COUNTER(StatId) LBEAST_SCOPE_CYCLE_COUNTER(StatId, "AI", LBEASTAIChannel)
+#define LBEASTAI_INC_COUNTER(StatId, Amount) LBEAST_INC_COUNTER(StatId, "AI", Amount)
+#define LBEASTAI_SET_GAUGE(StatId, Value) LBEAST_SET_GAUGE(StatId, "AI", Value)
+
 /**
  * LBEASTAI Module
  * 
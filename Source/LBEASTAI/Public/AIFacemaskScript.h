@@ -118,6 +118,14 @@ struct FAIFacemaskScriptLine
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LBEAST|ACE Script")
 	float EstimatedDuration = 0.0f;
 
+	/** Length of the pre-baked audio in samples (0 if the server only reported a duration) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LBEAST|ACE Script")
+	int64 PreBakedSampleCount = 0;
+
+	/** Sample rate of the pre-baked audio in Hz */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LBEAST|ACE Script")
+	int32 PreBakedSampleRate = 0;
+
 	/** Whether this script line has been pre-baked (TTS + Audio-to-Face processed) */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LBEAST|ACE Script")
 	bool bIsPreBaked = false;
@@ -144,6 +152,14 @@ struct FAIFacemaskScriptLine
 		// Generate unique ID for this script line
 		ScriptLineID = FGuid::NewGuid().ToString();
 	}
+
+	/** Playback length in seconds - exact when the sample count is known, otherwise the estimate */
+	double GetPlaybackDuration() const
+	{
+		return (PreBakedSampleCount > 0 && PreBakedSampleRate > 0)
+			? static_cast<double>(PreBakedSampleCount) / PreBakedSampleRate
+			: EstimatedDuration;
+	}
 };
 
 /**
@@ -234,6 +234,13 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "gRPC")
 	bool IsInitialized() const { return bIsInitialized; }
 
+	/**
+	 * Whether RequestTTSSynthesis() can return audio.
+	 * False while the Riva TTS call is a stub (with or without TurboLink): every request answers with no audio.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "gRPC")
+	bool IsTTSSynthesisImplemented() const;
+
 	/**
 	 * Get current server address
 	 */
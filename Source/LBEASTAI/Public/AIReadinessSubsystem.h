@@ -0,0 +1,219 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "AIReadinessSubsystem.generated.h"
+
+class ULLMProviderManager;
+class UASRProviderManager;
+class UAIGRPCClient;
+class UAIHTTPClient;
+
+/**
+ * Kind of AI provider being warmed up
+ */
+UENUM(BlueprintType)
+enum class EAIProviderKind : uint8
+{
+	LLM			UMETA(DisplayName = "LLM"),
+	ASR			UMETA(DisplayName = "ASR"),
+	TTS			UMETA(DisplayName = "TTS"),
+	Audio2Face	UMETA(DisplayName = "Audio2Face"),
+	Custom		UMETA(DisplayName = "Custom")
+};
+
+/**
+ * Warm-up state of one provider
+ */
+UENUM(BlueprintType)
+enum class EAIProviderReadiness : uint8
+{
+	/** Warm-up requests in progress (or retrying while the service comes up) */
+	WarmingUp	UMETA(DisplayName = "Warming Up"),
+
+	/** All warm-up passes answered - the model is loaded and hot */
+	Ready		UMETA(DisplayName = "Ready"),
+
+	/** Not ready within WarmupTimeoutSeconds or MaxWarmupAttempts. No longer retried until RestartWarmup(). */
+	Failed		UMETA(DisplayName = "Failed")
+};
+
+/**
+ * Readiness of one registered provider
+ */
+USTRUCT(BlueprintType)
+struct LBEASTAI_API FAIProviderReadinessStatus
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Readiness")
+	FName ProviderId;
+
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Readiness")
+	EAIProviderKind Kind = EAIProviderKind::Custom;
+
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Readiness")
+	EAIProviderReadiness State = EAIProviderReadiness::WarmingUp;
+
+	/** Whether this provider holds back the aggregate "AI ready" gate */
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Readiness")
+	bool bRequired = true;
+
+	/** Warm-up requests issued (including failed retries) */
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Readiness")
+	int32 Attempts = 0;
+
+	/** Consecutive successful warm-up requests */
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Readiness")
+	int32 PassesCompleted = 0;
+
+	/** Latency of the first successful request (model load / graph build included) */
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Readiness")
+	float ColdLatencyMs = 0.0f;
+
+	/** Latency of the last successful request (what a guest will see) */
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Readiness")
+	float WarmLatencyMs = 0.0f;
+
+	/** Registration to Ready */
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Readiness")
+	float SecondsToReady = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Readiness")
+	FString LastError;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAIProviderReadinessChanged, const FAIProviderReadinessStatus&, Status);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAIReadyChanged, bool, bReady);
+
+/** Result of one warm-up request. May be called from any thread, exactly once. */
+using FAIWarmupDone = TFunction<void(bool bSuccess, const FString& Error)>;
+
+/** Issues one warm-up request against a provider and reports through Done */
+using FAIWarmupProbe = TFunction<void(FAIWarmupDone Done)>;
+
+/**
+ * AI Readiness Subsystem
+ *
+ * Warms up every configured AI provider at venue startup so the first guest interaction
+ * hits hot models instead of paying for cold LLM weights, the first ASR graph build or
+ * the first TTS voice load.
+ *
+ * Providers register a warm-up probe (a short prompt, half a second of silence, a one-word
+ * phrase). All probes run in parallel; each provider repeats its probe until WarmupPasses
+ * consecutive requests succeed, retrying while its container is still starting. The
+ * aggregate gate IsAIReady() is true once every required provider is Ready, and
+ * ALBEASTExperienceBase exposes it to experiences and the Command Console.
+ *
+ * UAIImprovManager and UAIASRManager register their providers on initialize.
+ */
+UCLASS()
+class LBEASTAI_API UAIReadinessSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	static UAIReadinessSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Register a provider and start warming it up (replaces an existing registration with the same id)
+	 * @param bRequired If false the provider is warmed and reported but does not hold back IsAIReady()
+	 */
+	void RegisterProvider(FName ProviderId, EAIProviderKind Kind, FAIWarmupProbe Probe, bool bRequired = true);
+
+	/** Warm up an LLM with a short deterministic prompt */
+	void RegisterLLM(FName ProviderId, ULLMProviderManager* ProviderManager, const FString& ModelName, bool bRequired = true);
+
+	/** Warm up ASR with half a second of 16-bit silence */
+	void RegisterASR(FName ProviderId, UASRProviderManager* ProviderManager, const FString& LanguageCode, int32 SampleRate = 48000, bool bRequired = true);
+
+	/** Warm up TTS by synthesizing a one-word phrase with the voice the experience uses (skipped while the gRPC TTS call is a stub) */
+	void RegisterTTS(FName ProviderId, UAIGRPCClient* GRPCClient, const FString& VoiceName, const FString& LanguageCode, bool bRequired = true);
+
+	/** Warm up Audio2Face by converting a short silent clip */
+	void RegisterAudio2Face(FName ProviderId, UAIHTTPClient* HTTPClient, const FString& EndpointURL, bool bRequired = true);
+
+	UFUNCTION(BlueprintCallable, Category = "AI|Readiness")
+	void UnregisterProvider(FName ProviderId);
+
+	/** Provider id unique to a component: "Outer.Component.Kind" */
+	static FName MakeProviderId(const UObject* Component, const TCHAR* Kind);
+
+	/** Warm every provider up again (e.g. after hot-swapping a model) */
+	UFUNCTION(BlueprintCallable, Category = "AI|Readiness")
+	void RestartWarmup();
+
+	/** Aggregate gate: every required provider is Ready (true when nothing is registered) */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AI|Readiness")
+	bool IsAIReady() const { return bAIReady; }
+
+	UFUNCTION(BlueprintCallable, Category = "AI|Readiness")
+	bool GetProviderStatus(FName ProviderId, FAIProviderReadinessStatus& OutStatus) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AI|Readiness")
+	TArray<FAIProviderReadinessStatus> GetAllProviderStatus() const;
+
+	/** Consecutive successful requests before a provider counts as Ready (first loads, the rest confirm it is hot) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Readiness", meta = (ClampMin = "1", ClampMax = "5"))
+	int32 WarmupPasses = 2;
+
+	/** Delay before retrying a failed warm-up request (service or container still starting) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Readiness", meta = (ClampMin = "0.1"))
+	float RetryIntervalSeconds = 2.0f;
+
+	/** A request that has not answered in this time counts as failed */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Readiness", meta = (ClampMin = "1.0"))
+	float RequestTimeoutSeconds = 60.0f;
+
+	/** Provider is reported Failed if not Ready this long after registration (NIM model loads take minutes) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Readiness", meta = (ClampMin = "1.0"))
+	float WarmupTimeoutSeconds = 300.0f;
+
+	/** Provider is reported Failed after this many warm-up requests without reaching Ready */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Readiness", meta = (ClampMin = "1"))
+	int32 MaxWarmupAttempts = 150;
+
+	UPROPERTY(BlueprintAssignable, Category = "AI|Readiness")
+	FOnAIProviderReadinessChanged OnProviderReadinessChanged;
+
+	/** Fired when the aggregate gate opens or closes */
+	UPROPERTY(BlueprintAssignable, Category = "AI|Readiness")
+	FOnAIReadyChanged OnAIReadyChanged;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Conditional; }
+	virtual bool IsTickable() const override { return !IsTemplate() && bHasWork; }
+	virtual bool IsTickableWhenPaused() const override { return true; }
+
+private:
+	struct FProvider
+	{
+		FAIProviderReadinessStatus Status;
+		FAIWarmupProbe Probe;
+		double RegisteredSeconds = 0.0;
+		double NextAttemptSeconds = 0.0;
+		double RequestStartSeconds = 0.0;
+		/** Identifies the request in flight (0 = none); stale results are dropped */
+		uint32 RequestToken = 0;
+	};
+
+	FProvider* FindProvider(FName ProviderId);
+	void IssueRequest(FProvider& Provider, double NowSeconds);
+	void HandleResult(FName ProviderId, uint32 RequestToken, bool bSuccess, const FString& Error);
+	void SetState(FProvider& Provider, EAIProviderReadiness NewState);
+	void UpdateAggregate();
+
+	TArray<FProvider> Providers;
+	uint32 NextRequestToken = 1;
+	bool bAIReady = true;
+	bool bHasWork = false;
+	double WarmupStartSeconds = 0.0;
+};
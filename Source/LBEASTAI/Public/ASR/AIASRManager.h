@@ -65,6 +65,10 @@ struct LBEASTAI_API FAIASRConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|ASR|Container")
 	FContainerConfig ContainerConfig;
 
+	/** Warm up the ASR model on initialize so the first utterance doesn't pay for the graph build (UAIReadinessSubsystem) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|ASR")
+	bool bWarmUpOnInitialize = true;
+
 	FAIASRConfig()
 		: bEnableASR(true)
 		, LocalASREndpointURL(TEXT("localhost:50051"))
@@ -73,6 +77,7 @@ struct LBEASTAI_API FAIASRConfig
 		, MinAudioDuration(0.5f)
 		, MaxAudioDuration(10.0f)
 		, bAutoStartContainer(false)
+		, bWarmUpOnInitialize(true)
 	{}
 };
 
@@ -106,6 +111,9 @@ class LBEASTAI_API UAIASRManager : public UActorComponent, public IVOIPAudioVisi
 {
 	GENERATED_BODY()
 
+	/** LBEASTBenchmarks times ConvertPCMFloatToBytes() */
+	friend struct FLBEASTBenchmarkAccess;
+
 public:
 	UAIASRManager();
 
@@ -155,6 +163,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	/** Whether the ASR manager is initialized */
@@ -107,7 +107,7 @@ public:
 	 * @param InDefaultEndpointURL The default endpoint URL for auto-detection.
 	 * @param InDefaultProviderType The default provider type if not auto-detecting.
 	 * @param ContainerConfig Optional container config for auto-start (if bAutoStartContainer is true).
-	 * @param bAutoStartContainer Whether to auto-start container if not running.
+	 * @param bAutoStartContainer Whether to auto-start container if not running (async, does not block).
 	 * @return True if initialization is successful.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "ASR Provider")
@@ -210,9 +210,9 @@ private:
 	 */
 	EASRProviderType AutoDetectProviderType(const FString& EndpointURL) const;
 
-	/** Container manager for auto-starting containers (optional) */
+	/** Container manager for auto-starting containers (game instance subsystem, optional) */
 	UPROPERTY()
-	TObjectPtr<class UContainerManagerDockerCLI> ContainerManager;
+	TObjectPtr<class UContainerManagerDockerAPI> ContainerManager;
 
 	void HandleCallbackProxyFinished(UASRTranscriptionCallbackProxy* Proxy);
 };
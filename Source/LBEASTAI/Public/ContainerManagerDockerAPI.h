@@ -0,0 +1,184 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "IContainerManager.h"
+#include "ContainerManagerDockerAPI.generated.h"
+
+/**
+ * @brief Container state as last reported by the Docker daemon.
+ */
+UENUM(BlueprintType)
+enum class EDockerContainerState : uint8
+{
+	/** Not listed yet (daemon not reached) */
+	Unknown UMETA(DisplayName = "Unknown"),
+	/** No container with this name */
+	Missing UMETA(DisplayName = "Missing"),
+	Created UMETA(DisplayName = "Created"),
+	Running UMETA(DisplayName = "Running"),
+	Paused UMETA(DisplayName = "Paused"),
+	/** Exited / stopped */
+	Stopped UMETA(DisplayName = "Stopped")
+};
+
+/**
+ * @brief Cached container information.
+ */
+USTRUCT(BlueprintType)
+struct LBEASTAI_API FDockerContainerInfo
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Container Manager")
+	FString Name;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Container Manager")
+	FString Id;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Container Manager")
+	FString Image;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Container Manager")
+	EDockerContainerState State = EDockerContainerState::Unknown;
+
+	/** Docker health check status ("healthy", "unhealthy", "starting"), empty if the image has none */
+	UPROPERTY(BlueprintReadOnly, Category = "Container Manager")
+	FString Health;
+};
+
+/** Completion of an async Docker operation (game thread) */
+DECLARE_DELEGATE_TwoParams(FOnDockerOperationComplete, bool /*bSuccess*/, const FString& /*Error*/);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnDockerContainerStateChanged, const FString&, ContainerName, EDockerContainerState, State);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDockerDaemonAvailabilityChanged, bool, bAvailable);
+
+/**
+ * @brief Docker Engine API container manager (async, non-blocking).
+ *
+ * Talks to the Docker Engine REST API directly instead of shelling out to the Docker CLI:
+ * - Linux/macOS: Unix socket at `/var/run/docker.sock`
+ * - Windows: Docker Desktop's named pipe `npipe:////./pipe/docker_engine`
+ * - Override with the DOCKER_HOST environment variable or `-LBEASTDockerHost=` (unix:///path, npipe:////./pipe/name
+ *   or tcp://host:port), e.g. to point at a local stub server
+ *
+ * Every request runs off the game thread; results come back through FOnDockerOperationComplete
+ * on the game thread. Container state is cached: one listing when the manager first connects,
+ * then kept current from the daemon's `/events` stream (no polling). The IContainerManager
+ * queries are answered from that cache and never block.
+ *
+ * EnsureContainerRunning() creates (pulling the image if needed), starts or leaves alone a container;
+ * several calls run in parallel, so the whole AI stack can come up while the level loads.
+ */
+UCLASS()
+class LBEASTAI_API UContainerManagerDockerAPI : public UGameInstanceSubsystem, public IContainerManager
+{
+	GENERATED_BODY()
+
+public:
+	static UContainerManagerDockerAPI* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// =====================================
+	// IContainerManager (cached, non-blocking)
+	// =====================================
+
+	virtual bool IsContainerRunning_Implementation(const FString& ContainerName) const override;
+	/** Queues EnsureContainerRunning(); returns false only if the request could not be issued */
+	virtual bool StartContainer_Implementation(const FContainerConfig& Config) override;
+	/** Queues StopContainerAsync() */
+	virtual bool StopContainer_Implementation(const FString& ContainerName) override;
+	/** Queues RemoveContainerAsync() */
+	virtual bool RemoveContainer_Implementation(const FString& ContainerName) override;
+	virtual bool IsDockerAvailable_Implementation() const override;
+	/** @return False until the first listing has arrived */
+	virtual bool GetContainerStatus_Implementation(const FString& ContainerName, bool& bIsRunning, bool& bExists) const override;
+
+	// =====================================
+	// Async API
+	// =====================================
+
+	/**
+	 * @brief Make sure a container is running: start it if stopped, create it (pulling the image if missing) if absent.
+	 * @param Config Container configuration.
+	 * @param OnComplete Called on the game thread once the container is running or the attempt failed.
+	 */
+	void EnsureContainerRunning(const FContainerConfig& Config, FOnDockerOperationComplete OnComplete = FOnDockerOperationComplete());
+
+	/**
+	 * @brief EnsureContainerRunning() for several containers at once (in parallel).
+	 * @param OnComplete Called once all have finished; bSuccess is false if any failed (errors joined).
+	 */
+	void EnsureContainersRunning(const TArray<FContainerConfig>& Configs, FOnDockerOperationComplete OnComplete = FOnDockerOperationComplete());
+
+	void StopContainerAsync(const FString& ContainerName, FOnDockerOperationComplete OnComplete = FOnDockerOperationComplete());
+
+	/** Force-removes the container (stops it first if running) */
+	void RemoveContainerAsync(const FString& ContainerName, FOnDockerOperationComplete OnComplete = FOnDockerOperationComplete());
+
+	/** Re-list all containers (normally not needed - the event stream keeps the cache current) */
+	UFUNCTION(BlueprintCallable, Category = "Container Manager")
+	void RefreshContainers();
+
+	/**
+	 * @brief Cached information for a container.
+	 * @return False if the container is not in the cache.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Container Manager")
+	bool GetContainerInfo(const FString& ContainerName, FDockerContainerInfo& OutInfo) const;
+
+	/** @brief Containers with an EnsureContainerRunning() in flight. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Container Manager")
+	int32 GetPendingOperationCount() const { return PendingOperations; }
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Container Manager")
+	FString GetLastError() const { return LastError; }
+
+	/** Docker daemon address (unix:///var/run/docker.sock, npipe:////./pipe/docker_engine or tcp://host:port). Read on first connect. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Container Manager")
+	FString DockerHost;
+
+	/** Timeout for ordinary API requests (seconds); image pulls are not bounded by it */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Container Manager")
+	float RequestTimeoutSeconds = 15.0f;
+
+	/** Grace period Docker gives a container to exit on stop before killing it (seconds) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Container Manager")
+	int32 StopGraceSeconds = 10;
+
+	/** Fired when a cached container changes state (from the event stream or a listing) */
+	UPROPERTY(BlueprintAssignable, Category = "Container Manager")
+	FOnDockerContainerStateChanged OnContainerStateChanged;
+
+	/** Fired when the event stream connects to or loses the daemon */
+	UPROPERTY(BlueprintAssignable, Category = "Container Manager")
+	FOnDockerDaemonAvailabilityChanged OnDaemonAvailabilityChanged;
+
+private:
+	friend class FDockerEventStream;
+
+	/** Start the event stream (first use) */
+	void EnsureConnected();
+
+	/** Game-thread sinks for worker results */
+	void ApplyContainerInfo(const FDockerContainerInfo& Info);
+	void ApplyListing(const TArray<FDockerContainerInfo>& Containers);
+	void HandleContainerEvent(const FString& ContainerName, const FString& Id, const FString& Image, const FString& Action);
+	void HandleDaemonAvailability(bool bAvailable);
+
+	/** Resolved DockerHost */
+	FString ResolvedHost;
+
+	TMap<FString, FDockerContainerInfo> Containers;
+	bool bListed = false;
+	bool bDaemonAvailable = false;
+	int32 PendingOperations = 0;
+	FString LastError;
+
+	/** Event stream reader (owns its thread) */
+	class FDockerEventStream* EventStream = nullptr;
+};
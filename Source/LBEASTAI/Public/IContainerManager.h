@@ -53,8 +53,11 @@ struct FContainerConfig
  * @brief Interface for container management.
  * Enables starting, stopping, and monitoring Docker containers from Unreal Engine.
  * 
- * **Docker CLI Approach:**
- * Uses Docker CLI commands (not HTTP API) for simplicity and security:
+ * **Implementations:**
+ * - UContainerManagerDockerAPI: Docker Engine API over the local socket, async and cached (used by the provider managers)
+ * - UContainerManagerDockerCLI: synchronous Docker CLI commands (blocks the calling thread)
+ *
+ * Both stay local to the machine:
  * - No TLS required (local socket/pipe communication)
  * - No network exposure (local Docker daemon only)
  * - No authentication setup (Docker daemon handles permissions)
@@ -39,6 +39,9 @@ struct LBEASTAI_API FLLMRequest
 	UPROPERTY(BlueprintReadWrite, Category = "LLM")
 	int32 MaxTokens = 150;
 
+	/** Set by ULLMRequestScheduler to identify the request to ILLMProvider::AbortRequest() (0 = untagged) */
+	uint32 RequestTag = 0;
+
 	FLLMRequest()
 		: Temperature(0.7f)
 		, MaxTokens(150)
@@ -145,5 +148,26 @@ public:
 	 * Get supported model names (for discovery)
 	 */
 	virtual TArray<FString> GetSupportedModels() const = 0;
+
+	/**
+	 * Requests the backend can serve at once (ULLMRequestScheduler's in-flight limit)
+	 * Servers with continuous batching (vLLM, NIM) batch concurrent requests on the GPU.
+	 */
+	virtual int32 GetMaxConcurrentRequests() const { return 1; }
+
+	/**
+	 * Whether AbortRequest() really stops generation on the backend
+	 * ULLMRequestScheduler only preempts in-flight work for a live reply when this is true; otherwise the
+	 * aborted request would keep its server slot and the live reply would still wait behind it.
+	 */
+	virtual bool CanAbortRequests() const { return false; }
+
+	/**
+	 * Stop generating the request submitted with this FLLMRequest::RequestTag, without calling its callback
+	 * Providers that implement it return true from CanAbortRequests(). HTTP providers should keep the
+	 * IHttpRequest per RequestTag and call CancelRequest() (closing the connection stops generation on Ollama,
+	 * vLLM and NIM). The default does nothing.
+	 */
+	virtual void AbortRequest(uint32 RequestTag) {}
 };
 
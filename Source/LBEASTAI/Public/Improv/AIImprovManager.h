@@ -7,6 +7,7 @@
 #include "AIHTTPClient.h"
 #include "AIGRPCClient.h"
 #include "LLMProviderManager.h"
+#include "LLMRequestScheduler.h"
 #include "IContainerManager.h"
 #include "AIImprovManager.generated.h"
 
@@ -14,6 +15,7 @@
 class UAIHTTPClient;
 class UAIGRPCClient;
 class ULLMProviderManager;
+class UExperienceStateMachine;
 
 /**
  * Generic configuration for improvised responses
@@ -95,6 +97,33 @@ struct LBEASTAI_API FAIImprovConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Improv")
 	FString LocalAudio2FaceEndpointURL;
 
+	/** Warm up the LLM, TTS and Audio2Face on initialize so the first guest hits hot models (UAIReadinessSubsystem) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Improv")
+	bool bWarmUpOnInitialize = true;
+
+	/** Station this manager speaks for - LLM requests are shared fairly between stations (empty = owning actor's name) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Improv")
+	FName StationId;
+
+	/**
+	 * Pre-generate transitions to every state reachable from the current one (see SetNarrativeStateMachine)
+	 * Regenerated in the background, at pre-bake priority, whenever the conversation or the state changes.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Improv|Transition")
+	bool bSpeculativeTransitions = true;
+
+	/** Also pre-generate transitions to states only reachable by an operator jump (one request per state) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Improv|Transition")
+	bool bSpeculateOperatorJumps = false;
+
+	/** Speculative requests in flight at once (budget per manager) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Improv|Transition", meta = (ClampMin = "1", ClampMax = "16"))
+	int32 MaxSpeculativeTransitions = 2;
+
+	/** Wait this long after a conversation change before regenerating (a live exchange changes it twice) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Improv|Transition", meta = (ClampMin = "0.0"))
+	float SpeculativeRefreshDelaySeconds = 1.0f;
+
 	FAIImprovConfig()
 		: bEnableImprov(true)
 		, LocalLLMEndpointURL(TEXT("http://localhost:8000"))
@@ -108,6 +137,11 @@ struct LBEASTAI_API FAIImprovConfig
 		, LocalTTSEndpointURL(TEXT("http://localhost:50051"))
 		, bUseLocalAudio2Face(true)
 		, LocalAudio2FaceEndpointURL(TEXT("http://localhost:8000"))
+		, bWarmUpOnInitialize(true)
+		, bSpeculativeTransitions(true)
+		, bSpeculateOperatorJumps(false)
+		, MaxSpeculativeTransitions(2)
+		, SpeculativeRefreshDelaySeconds(1.0f)
 	{}
 };
 
@@ -211,10 +245,34 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AI|Improv")
 	virtual void StopCurrentResponse();
 
+	/**
+	 * Narrative state machine whose reachable states get speculative transitions (bSpeculativeTransitions)
+	 * @param StateMachine - nullptr stops speculation
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AI|Improv|Transition")
+	void SetNarrativeStateMachine(UExperienceStateMachine* StateMachine);
+
+	/**
+	 * Regenerate stale speculative transitions on the next tick
+	 * Called automatically on state and conversation changes.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AI|Improv|Transition")
+	void RefreshSpeculativeTransitions();
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+	/**
+	 * Register the LLM, TTS and Audio2Face providers with UAIReadinessSubsystem for warm-up
+	 * Subclasses can override to warm up additional providers
+	 */
+	virtual void RegisterWarmupProviders();
+
+	/** Voice for the TTS warm-up - subclasses return the voice they speak with */
+	virtual FString GetWarmupVoiceName() const { return FString(); }
+
 	/** Whether the improv manager is initialized */
 	bool bIsInitialized = false;
 
@@ -227,6 +285,47 @@ protected:
 	/** Current AI response being generated/played */
 	FString CurrentAIResponse;
 
+	/**
+	 * Send an LLM request through the shared ULLMRequestScheduler (directly to the provider if there is none)
+	 * Requests are cancelled when this component ends play.
+	 * @return Scheduler request id (0 if sent directly or failed immediately)
+	 */
+	uint32 SubmitLLMRequest(const FLLMRequest& Request, ELLMRequestPriority Priority, TFunction<void(const FLLMResponse&)> Callback);
+
+	/** Scheduler id of the live reply being generated (0 = none) */
+	uint32 LiveLLMRequestId = 0;
+
+	/**
+	 * Call after changing ConversationHistory - stales buffered transitions and schedules regeneration
+	 */
+	void NotifyConversationChanged();
+
+	/**
+	 * Text the transition into TargetState should lead to (default: the state's description)
+	 * Subclasses return the state's scripted line. Empty skips speculation for the state.
+	 */
+	virtual FString GetTransitionContextForState(FName TargetState) const;
+
+	/** Start (or restart) generating the transition into ToState */
+	void GenerateTransition(FName FromState, FName ToState, const FString& ContextText, ELLMRequestPriority Priority, bool bSpeculative);
+
+	/** Issue speculative requests for stale reachable states within budget (tick) */
+	void UpdateSpeculativeTransitions();
+
+	void HandleSpeculationStateEntered(int32 OldStateIndex, int32 NewStateIndex);
+
+	/** State machine driving speculation */
+	TWeakObjectPtr<UExperienceStateMachine> SpeculationStateMachine;
+
+	/** Any-state handler registered on SpeculationStateMachine */
+	FDelegateHandle SpeculationStateHandle;
+
+	/** Hash of ConversationHistory - transitions generated under another hash are stale */
+	uint32 ConversationHash = 0;
+
+	bool bSpeculationDirty = false;
+	double SpeculationDueSeconds = 0.0;
+
 	/**
 	 * Request LLM response asynchronously
 	 */
@@ -316,6 +415,14 @@ protected:
 		FName TargetStateName;
 		bool bIsReady = false;
 		float GenerationStartTime = 0.0f;
+		/** Scheduler request generating this transition (0 = none) */
+		uint32 RequestId = 0;
+		/** State the transition leads out of */
+		FName FromStateName;
+		/** ConversationHash the text was generated under */
+		uint32 ConversationHash = 0;
+		/** Generated ahead of time rather than requested */
+		bool bSpeculative = false;
 	};
 
 	/** Phase 11: Buffered transitions by target state (generic) - protected so subclasses can access */
@@ -89,7 +89,7 @@ public:
 	 * @param ProviderType - Provider type (or AutoDetect)
 	 * @param ModelName - Model name/ID
 	 * @param ContainerConfig - Optional container config for auto-start (if bAutoStartContainer is true)
-	 * @param bAutoStartContainer - Whether to auto-start container if not running
+	 * @param bAutoStartContainer - Whether to auto-start container if not running (async, does not block)
 	 * @return true if initialization successful
 	 */
 	UFUNCTION(BlueprintCallable, Category = "LLM Provider")
@@ -137,6 +137,32 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LLM Provider")
 	bool IsProviderAvailable() const;
 
+	/**
+	 * Endpoint URL of the current provider (identifies the backend to ULLMRequestScheduler)
+	 */
+	const FString& GetEndpointURL() const { return CurrentEndpointURL; }
+
+	/**
+	 * Concurrent requests the current provider serves (1 if none)
+	 */
+	int32 GetMaxConcurrentRequests() const { return CurrentProvider ? CurrentProvider->GetMaxConcurrentRequests() : 1; }
+
+	/**
+	 * Whether the current provider can stop requests mid-generation (see ILLMProvider::CanAbortRequests)
+	 */
+	bool CanAbortRequests() const { return CurrentProvider && CurrentProvider->CanAbortRequests(); }
+
+	/**
+	 * Stop a request on the current provider (see ILLMProvider::AbortRequest)
+	 */
+	void AbortRequest(uint32 RequestTag)
+	{
+		if (CurrentProvider)
+		{
+			CurrentProvider->AbortRequest(RequestTag);
+		}
+	}
+
 	/**
 	 * Register custom provider (for extensibility)
 	 * @param Provider - Custom provider implementing ILLMProvider
@@ -158,6 +184,9 @@ private:
 	/** Current LLM provider */
 	ILLMProvider* CurrentProvider = nullptr;
 
+	/** Endpoint URL the current provider was initialized with */
+	FString CurrentEndpointURL;
+
 	/** Ollama provider instance */
 	UPROPERTY()
 	TObjectPtr<class ULLMProviderOllama> OllamaProvider;
@@ -170,8 +199,8 @@ private:
 	UPROPERTY()
 	TScriptInterface<ILLMProvider> CustomProvider;
 
-	/** Container manager for auto-starting containers (optional) */
+	/** Container manager for auto-starting containers (game instance subsystem, optional) */
 	UPROPERTY()
-	TObjectPtr<class UContainerManagerDockerCLI> ContainerManager;
+	TObjectPtr<class UContainerManagerDockerAPI> ContainerManager;
 };
 
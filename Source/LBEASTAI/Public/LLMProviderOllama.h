@@ -25,6 +25,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LLM Provider")
 	FString EndpointURL;
 
+	/** Match the server's OLLAMA_NUM_PARALLEL (Ollama answers one request at a time by default) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LLM Provider", meta = (ClampMin = "1"))
+	int32 MaxConcurrentRequests = 1;
+
 	/** Initialize provider */
 	UFUNCTION(BlueprintCallable, Category = "LLM Provider")
 	void Initialize(const FString& InEndpointURL);
@@ -34,6 +38,7 @@ public:
 	virtual bool IsAvailable() const override;
 	virtual FString GetProviderName() const override { return TEXT("Ollama"); }
 	virtual TArray<FString> GetSupportedModels() const override;
+	virtual int32 GetMaxConcurrentRequests() const override { return MaxConcurrentRequests; }
 
 private:
 	class UAIHTTPClient* HTTPClient;
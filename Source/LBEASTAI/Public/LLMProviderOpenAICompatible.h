@@ -40,6 +40,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LLM Provider")
 	FString APIKey;
 
+	/** Concurrent requests the server batches (vLLM/NIM continuous batching; 1 for servers that don't batch) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LLM Provider", meta = (ClampMin = "1"))
+	int32 MaxConcurrentRequests = 4;
+
 	/** Initialize provider */
 	UFUNCTION(BlueprintCallable, Category = "LLM Provider")
 	void Initialize(const FString& InEndpointURL, const FString& InAPIKey = TEXT(""));
@@ -49,6 +53,7 @@ public:
 	virtual bool IsAvailable() const override;
 	virtual FString GetProviderName() const override { return TEXT("OpenAI-Compatible"); }
 	virtual TArray<FString> GetSupportedModels() const override;
+	virtual int32 GetMaxConcurrentRequests() const override { return MaxConcurrentRequests; }
 
 private:
 	class UAIHTTPClient* HTTPClient;
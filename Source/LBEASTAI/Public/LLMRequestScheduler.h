@@ -0,0 +1,201 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "ILLMProvider.h"
+#include "Health/LBEASTDeviceHealth.h"
+#include "LLMRequestScheduler.generated.h"
+
+class ULLMProviderManager;
+
+/**
+ * Priority class of a scheduled LLM request (lower value is served first)
+ */
+UENUM(BlueprintType)
+enum class ELLMRequestPriority : uint8
+{
+	/** A guest is waiting for the answer */
+	LiveReply	UMETA(DisplayName = "Live Reply"),
+
+	/** Transition buffer for the next narrative state (needed within seconds) */
+	Transition	UMETA(DisplayName = "Transition"),
+
+	/** Speculative or pre-baked content (needed eventually) */
+	PreBake		UMETA(DisplayName = "Pre-Bake")
+};
+
+/**
+ * Scheduler counters and latency percentiles (queue wait + generation, ms)
+ */
+USTRUCT(BlueprintType)
+struct LBEASTAI_API FLLMSchedulerStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "LLM Scheduler")
+	int32 Queued = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LLM Scheduler")
+	int32 InFlight = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LLM Scheduler")
+	int32 Completed = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LLM Scheduler")
+	int32 Cancelled = 0;
+
+	/** Background requests pulled off a busy backend (and requeued) to start a live reply */
+	UPROPERTY(BlueprintReadOnly, Category = "LLM Scheduler")
+	int32 Preempted = 0;
+
+	/** Time live replies spent waiting for a slot */
+	UPROPERTY(BlueprintReadOnly, Category = "LLM Scheduler")
+	float LiveQueueWaitP95Ms = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LLM Scheduler")
+	float LiveLatencyP50Ms = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LLM Scheduler")
+	float LiveLatencyP95Ms = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LLM Scheduler")
+	float TransitionLatencyP95Ms = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LLM Scheduler")
+	float PreBakeLatencyP95Ms = 0.0f;
+};
+
+/**
+ * LLM Request Scheduler
+ *
+ * Shares LLM backends between every improv manager in the process. Without it each station
+ * sends its requests as soon as they arise, and a transition being generated for one actor
+ * delays a guest's reply on another.
+ *
+ * Requests are grouped by backend (endpoint URL), so managers pointing at the same server
+ * share its slots:
+ * - Strict priority: LiveReply, then Transition, then PreBake
+ * - Per-station fairness inside a priority: the station with the fewest requests in flight
+ *   (then the one served longest ago) goes first
+ * - In-flight limit per backend from ILLMProvider::GetMaxConcurrentRequests() (capped by
+ *   MaxInFlightPerBackend). Backends with continuous batching (vLLM, NIM) report several
+ *   slots and batch the concurrent requests on the GPU; Ollama reports one.
+ * - ReservedLiveSlots of those are never given to Transition/PreBake work, so a live reply
+ *   starts immediately instead of queueing behind background generation
+ * - A live reply that still finds every slot busy (always the case on a single-slot backend
+ *   such as Ollama) preempts the most recently started background request, but only if the
+ *   provider can stop it (ILLMProvider::CanAbortRequests): it is aborted and goes back to the
+ *   front of its queue. Otherwise the live reply waits for the next free slot.
+ *
+ * Cancelled requests never call back; a cancelled request already in flight still occupies
+ * its slot until the backend answers, unless a live reply preempts it on a provider that can abort.
+ *
+ * Game thread only. Provider callbacks arriving on other threads are marshalled back.
+ */
+UCLASS()
+class LBEASTAI_API ULLMRequestScheduler : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static ULLMRequestScheduler* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * Queue a request
+	 * @param ProviderManager - Manager whose current provider serves the request
+	 * @param StationId - Fairness key (one per actor/station)
+	 * @param Owner - Cancelled together by CancelOwner(); callbacks are dropped once it is destroyed
+	 * @return Request id for Cancel(), 0 if the request failed immediately (callback already called)
+	 */
+	uint32 Submit(ULLMProviderManager* ProviderManager, const FLLMRequest& Request, ELLMRequestPriority Priority,
+		FName StationId, const UObject* Owner, TFunction<void(const FLLMResponse&)> Callback);
+
+	/** Cancel a queued or in-flight request; its callback will not be called */
+	bool Cancel(uint32 RequestId);
+
+	/** Cancel every request submitted by Owner (call from EndPlay) */
+	int32 CancelOwner(const UObject* Owner);
+
+	bool IsPending(uint32 RequestId) const;
+
+	/**
+	 * Move a queued request to another priority class (e.g. a speculative request that is now needed)
+	 * @return True if the request is queued or already in flight
+	 */
+	bool SetPriority(uint32 RequestId, ELLMRequestPriority Priority);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LLM Scheduler")
+	FLLMSchedulerStats GetStats() const;
+
+	/** Upper bound on concurrent requests per backend (0 = whatever the provider reports) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LLM Scheduler", meta = (ClampMin = "0"))
+	int32 MaxInFlightPerBackend = 0;
+
+	/** Slots per backend only LiveReply requests may use (ignored for single-slot backends, which rely on preemption when the provider can abort) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LLM Scheduler", meta = (ClampMin = "0"))
+	int32 ReservedLiveSlots = 1;
+
+	/** Abort and requeue in-flight Transition/PreBake work when a live reply finds no free slot (providers that can abort only) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LLM Scheduler")
+	bool bPreemptForLiveReplies = true;
+
+	/** Queued requests per station and priority beyond which the oldest Transition/PreBake request is dropped */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LLM Scheduler", meta = (ClampMin = "1"))
+	int32 MaxQueuedPerStation = 8;
+
+private:
+	struct FScheduledRequest
+	{
+		uint32 Id = 0;
+		FLLMRequest Request;
+		ELLMRequestPriority Priority = ELLMRequestPriority::LiveReply;
+		FName StationId;
+		TWeakObjectPtr<ULLMProviderManager> ProviderManager;
+		TWeakObjectPtr<const UObject> Owner;
+		const UObject* OwnerKey = nullptr;
+		TFunction<void(const FLLMResponse&)> Callback;
+		double SubmitSeconds = 0.0;
+		double DispatchSeconds = 0.0;
+		/** Times dispatched; an answer from a preempted earlier dispatch carries a stale value and is dropped */
+		uint32 Dispatches = 0;
+		bool bCancelled = false;
+	};
+
+	struct FBackend
+	{
+		/** Queued requests, submission order */
+		TArray<TSharedPtr<FScheduledRequest>> Queue;
+		TArray<TSharedPtr<FScheduledRequest>> InFlight;
+		int32 MaxInFlight = 1;
+		/** Provider can stop in-flight requests (ILLMProvider::CanAbortRequests), so preemption frees a server slot */
+		bool bCanAbort = false;
+		/** Pump() re-entry guard (providers may answer synchronously) */
+		bool bPumping = false;
+	};
+
+	static FString GetBackendKey(const ULLMProviderManager* ProviderManager);
+
+	/** Start queued requests while the backend has free slots */
+	void Pump(const FString& BackendKey);
+	int32 SelectNext(const FBackend& Backend) const;
+	/** Free a slot for a queued live reply; false if nothing can be preempted */
+	bool PreemptForLiveReply(FBackend& Backend);
+	void HandleResponse(const FString& BackendKey, uint32 RequestId, uint32 Dispatch, const FLLMResponse& Response);
+	int32 CountInFlight(const FBackend& Backend, FName StationId) const;
+
+	TMap<FString, FBackend> Backends;
+	/** Station -> dispatch sequence of its last served request (fairness tie-break) */
+	TMap<FName, uint64> LastServed;
+	uint64 DispatchSequence = 0;
+	uint32 NextRequestId = 1;
+
+	int32 Completed = 0;
+	int32 Cancelled = 0;
+	int32 Preempted = 0;
+	FLBEASTRollingPercentile LiveQueueWaitMs;
+	FLBEASTRollingPercentile LatencyMs[3];
+};
@@ -0,0 +1,45 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+using UnrealBuildTool;
+
+public class LBEASTBenchmarks : ModuleRules
+{
+	public LBEASTBenchmarks(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+		
+		PublicIncludePaths.AddRange(
+			new string[] {
+			}
+		);
+				
+		
+		PrivateIncludePaths.AddRange(
+			new string[] {
+			}
+		);
+			
+		
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"Engine"
+			}
+		);
+			
+		
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Json",
+				"LBEASTCore",
+				"EmbeddedSystems",
+				"ProLighting",
+				"ProAudio",
+				"LBEASTAI"
+			}
+		);
+	}
+}
@@ -0,0 +1,72 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Networking/LBEASTUDPTransport.h"
+#include "EmbeddedDeviceController.h"
+#include "ProAudioController.h"
+#include "ASR/AIASRManager.h"
+
+/**
+ * Friend accessor for the code paths under benchmark
+ *
+ * The packet, crypto and conversion functions are private to their components; each of
+ * those classes declares this struct a friend so the benchmarks can call them directly,
+ * without sockets, worlds or actors.
+ */
+struct FLBEASTBenchmarkAccess
+{
+	// Plain LBEAST format: [0xAA][Type][Ch][Payload][CRC]
+
+	static TArray<uint8> BuildPlainPacket(ULBEASTUDPTransport& Transport, ELBEASTUDPDataType Type, int32 Channel, const TArray<uint8>& Payload)
+	{
+		return Transport.BuildBinaryPacket(Type, Channel, Payload);
+	}
+
+	static void ParsePlainPacket(ULBEASTUDPTransport& Transport, const TArray<uint8>& Packet)
+	{
+		Transport.ParseBinaryPacket(Packet, Packet.Num());
+	}
+
+	// Embedded device formats (CRC, HMAC, AES-128-CTR + HMAC)
+
+	static void ConfigureSecurity(UEmbeddedDeviceController& Device, ELBEASTSecurityLevel SecurityLevel)
+	{
+		Device.Config.bDebugMode = false;
+		Device.Config.SecurityLevel = SecurityLevel;
+		Device.DeriveKeysFromSecret();
+	}
+
+	static TArray<uint8> BuildDevicePacket(UEmbeddedDeviceController& Device, ELBEASTDataType Type, int32 Channel, const TArray<uint8>& Payload)
+	{
+		return Device.BuildBinaryPacket(Type, Channel, Payload);
+	}
+
+	static void ParseDevicePacket(UEmbeddedDeviceController& Device, const TArray<uint8>& Packet)
+	{
+		Device.ParseBinaryPacket(Packet, Packet.Num());
+	}
+
+	static TArray<uint8> CalculateHMAC(const UEmbeddedDeviceController& Device, const TArray<uint8>& Data)
+	{
+		return Device.CalculateHMAC(Data);
+	}
+
+	static TArray<uint8> EncryptAES128(const UEmbeddedDeviceController& Device, const TArray<uint8>& Plaintext, uint32 IV)
+	{
+		return Device.EncryptAES128(Plaintext, IV);
+	}
+
+	// Audio / console
+
+	static TArray<uint8> ConvertPCMFloatToBytes(const UAIASRManager& Manager, const TArray<float>& Audio, int32 SampleRate)
+	{
+		return Manager.ConvertPCMFloatToBytes(Audio, SampleRate);
+	}
+
+	static FString BuildOSCPath(const UProAudioController& Controller, const FString& Command, int32 Channel, int32 Bus = -1)
+	{
+		return Controller.BuildOSCPath(Command, Channel, Bus);
+	}
+};
@@ -0,0 +1,99 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "LBEASTBenchmarkCommandlet.h"
+#include "LBEASTBenchmarks.h"
+#include "LBEASTBenchmarkRunner.h"
+#include "LBEASTBenchmarkSuites.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+#include "Misc/Parse.h"
+
+ULBEASTBenchmarkCommandlet::ULBEASTBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 ULBEASTBenchmarkCommandlet::Main(const FString& Params)
+{
+	FLBEASTBenchmarkRunner Runner;
+	RegisterLBEASTMicroBenchmarks(Runner);
+	RegisterLBEASTScenarioBenchmarks(Runner);
+
+	if (FParse::Param(*Params, TEXT("list")))
+	{
+		for (const FLBEASTBenchmarkDefinition& Definition : Runner.GetDefinitions())
+		{
+			UE_LOG(LogLBEASTBenchmarks, Display, TEXT("%-44s [%s] %s"), *Definition.Name, *Definition.Category, *Definition.Description);
+		}
+		return 0;
+	}
+
+	TArray<FString> Filters;
+	FString FilterList;
+	if (FParse::Value(*Params, TEXT("filter="), FilterList))
+	{
+		FilterList.ParseIntoArray(Filters, TEXT(","), true);
+	}
+
+	int32 Samples = Runner.Samples;
+	if (FParse::Value(*Params, TEXT("samples="), Samples))
+	{
+		Runner.Samples = FMath::Max(Samples, 1);
+	}
+
+	FString OutputPath;
+	if (!FParse::Value(*Params, TEXT("output="), OutputPath))
+	{
+		OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmarks"),
+			FString::Printf(TEXT("LBEASTBenchmarks-%s.json"), *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S"))));
+	}
+
+	UE_LOG(LogLBEASTBenchmarks, Display, TEXT("LBEASTBenchmarkCommandlet: Running %s (%d samples each)"),
+		Filters.Num() > 0 ? *FilterList : TEXT("all benchmarks"), Runner.Samples);
+
+	if (Runner.Run(Filters) == 0)
+	{
+		UE_LOG(LogLBEASTBenchmarks, Error, TEXT("LBEASTBenchmarkCommandlet: No benchmark matches '%s'"), *FilterList);
+		return 2;
+	}
+
+	if (!Runner.WriteJSON(OutputPath))
+	{
+		UE_LOG(LogLBEASTBenchmarks, Error, TEXT("LBEASTBenchmarkCommandlet: Could not write %s"), *OutputPath);
+		return 2;
+	}
+	UE_LOG(LogLBEASTBenchmarks, Display, TEXT("LBEASTBenchmarkCommandlet: Results written to %s"), *OutputPath);
+
+	FString BaselinePath;
+	if (!FParse::Value(*Params, TEXT("baseline="), BaselinePath))
+	{
+		return 0;
+	}
+
+	float Tolerance = 0.10f;
+	FParse::Value(*Params, TEXT("tolerance="), Tolerance);
+
+	TArray<FString> Regressions;
+	if (!Runner.CompareToBaseline(BaselinePath, Tolerance, Regressions))
+	{
+		return 2;
+	}
+
+	for (const FString& Regression : Regressions)
+	{
+		UE_LOG(LogLBEASTBenchmarks, Error, TEXT("LBEASTBenchmarkCommandlet: Regression %s"), *Regression);
+	}
+
+	if (Regressions.Num() > 0)
+	{
+		UE_LOG(LogLBEASTBenchmarks, Error, TEXT("LBEASTBenchmarkCommandlet: %d benchmark(s) slower than baseline by more than %.0f%%"),
+			Regressions.Num(), Tolerance * 100.0f);
+		return 1;
+	}
+
+	UE_LOG(LogLBEASTBenchmarks, Display, TEXT("LBEASTBenchmarkCommandlet: No regressions vs. %s"), *BaselinePath);
+	return 0;
+}
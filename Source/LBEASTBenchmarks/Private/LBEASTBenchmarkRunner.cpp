@@ -0,0 +1,184 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "LBEASTBenchmarkRunner.h"
+#include "LBEASTBenchmarks.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+#include "Misc/FileHelper.h"
+#include "Misc/DateTime.h"
+#include "Misc/App.h"
+#include "Misc/EngineVersion.h"
+#include "HAL/PlatformMisc.h"
+
+volatile int64 FLBEASTBenchmarkContext::Sink = 0;
+
+// =====================================
+// FLBEASTBenchmarkContext
+// =====================================
+
+void FLBEASTBenchmarkContext::Finish(TArray<double>& NsPerOp, int64 OpsPerSample, int64 BytesPerOp)
+{
+	if (NsPerOp.Num() == 0)
+	{
+		return;
+	}
+
+	NsPerOp.Sort();
+
+	double Sum = 0.0;
+	for (double Value : NsPerOp)
+	{
+		Sum += Value;
+	}
+
+	const int32 Count = NsPerOp.Num();
+	Result.OpsPerSample = OpsPerSample;
+	Result.Samples = Count;
+	Result.MinNs = NsPerOp[0];
+	Result.MaxNs = NsPerOp[Count - 1];
+	Result.MedianNs = NsPerOp[Count / 2];
+	Result.MeanNs = Sum / Count;
+	Result.P99Ns = NsPerOp[FMath::Min(Count - 1, (int32)FMath::CeilToInt(Count * 0.99) - 1)];
+	Result.OpsPerSecond = Result.MedianNs > 0.0 ? 1e9 / Result.MedianNs : 0.0;
+	Result.BytesPerSecond = BytesPerOp > 0 ? Result.OpsPerSecond * (double)BytesPerOp : 0.0;
+}
+
+// =====================================
+// FLBEASTBenchmarkRunner
+// =====================================
+
+void FLBEASTBenchmarkRunner::Add(const FString& Name, const FString& Category, const FString& Description, TFunction<void(FLBEASTBenchmarkContext&)> Body)
+{
+	FLBEASTBenchmarkDefinition& Definition = Definitions.AddDefaulted_GetRef();
+	Definition.Name = Name;
+	Definition.Category = Category;
+	Definition.Description = Description;
+	Definition.Body = MoveTemp(Body);
+}
+
+int32 FLBEASTBenchmarkRunner::Run(const TArray<FString>& Filters)
+{
+	Results.Reset();
+
+	for (const FLBEASTBenchmarkDefinition& Definition : Definitions)
+	{
+		if (Filters.Num() > 0 && !Filters.ContainsByPredicate([&Definition](const FString& Filter) { return Definition.Name.Contains(Filter); }))
+		{
+			continue;
+		}
+
+		FLBEASTBenchmarkResult& Result = Results.AddDefaulted_GetRef();
+		Result.Name = Definition.Name;
+		Result.Category = Definition.Category;
+
+		FLBEASTBenchmarkContext Context(Result, Samples, MinSampleSeconds);
+		Definition.Body(Context);
+
+		UE_LOG(LogLBEASTBenchmarks, Display, TEXT("%-44s median %10.1f ns  p99 %10.1f ns  (%.0f %s/s)"),
+			*Result.Name, Result.MedianNs, Result.P99Ns, Result.OpsPerSecond, *Result.Unit);
+	}
+
+	return Results.Num();
+}
+
+bool FLBEASTBenchmarkRunner::WriteJSON(const FString& Path) const
+{
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("schema"), TEXT("lbeast-benchmark/1"));
+	Root->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+	Root->SetStringField(TEXT("platform"), FPlatformProperties::IniPlatformName());
+	Root->SetStringField(TEXT("cpu"), FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+	Root->SetNumberField(TEXT("cores"), FPlatformMisc::NumberOfCores());
+	Root->SetStringField(TEXT("buildConfiguration"), LexToString(FApp::GetBuildConfiguration()));
+	Root->SetStringField(TEXT("engineVersion"), FEngineVersion::Current().ToString());
+	Root->SetNumberField(TEXT("samples"), Samples);
+
+	TArray<TSharedPtr<FJsonValue>> ResultValues;
+	for (const FLBEASTBenchmarkResult& Result : Results)
+	{
+		TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+		Entry->SetStringField(TEXT("name"), Result.Name);
+		Entry->SetStringField(TEXT("category"), Result.Category);
+		Entry->SetStringField(TEXT("unit"), Result.Unit);
+		Entry->SetNumberField(TEXT("opsPerSample"), (double)Result.OpsPerSample);
+		Entry->SetNumberField(TEXT("samples"), Result.Samples);
+		Entry->SetNumberField(TEXT("minNs"), Result.MinNs);
+		Entry->SetNumberField(TEXT("medianNs"), Result.MedianNs);
+		Entry->SetNumberField(TEXT("meanNs"), Result.MeanNs);
+		Entry->SetNumberField(TEXT("p99Ns"), Result.P99Ns);
+		Entry->SetNumberField(TEXT("maxNs"), Result.MaxNs);
+		Entry->SetNumberField(TEXT("opsPerSecond"), Result.OpsPerSecond);
+		Entry->SetNumberField(TEXT("bytesPerSecond"), Result.BytesPerSecond);
+
+		TSharedRef<FJsonObject> Metrics = MakeShared<FJsonObject>();
+		for (const TPair<FString, double>& Metric : Result.Metrics)
+		{
+			Metrics->SetNumberField(Metric.Key, Metric.Value);
+		}
+		Entry->SetObjectField(TEXT("metrics"), Metrics);
+
+		ResultValues.Add(MakeShared<FJsonValueObject>(Entry));
+	}
+	Root->SetArrayField(TEXT("results"), ResultValues);
+
+	FString Output;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	if (!FJsonSerializer::Serialize(Root, Writer))
+	{
+		return false;
+	}
+
+	return FFileHelper::SaveStringToFile(Output, *Path);
+}
+
+bool FLBEASTBenchmarkRunner::CompareToBaseline(const FString& BaselinePath, double Tolerance, TArray<FString>& OutRegressions) const
+{
+	FString BaselineText;
+	if (!FFileHelper::LoadFileToString(BaselineText, *BaselinePath))
+	{
+		UE_LOG(LogLBEASTBenchmarks, Error, TEXT("LBEASTBenchmarkRunner: Could not read baseline %s"), *BaselinePath);
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Baseline;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(BaselineText);
+	if (!FJsonSerializer::Deserialize(Reader, Baseline) || !Baseline.IsValid())
+	{
+		UE_LOG(LogLBEASTBenchmarks, Error, TEXT("LBEASTBenchmarkRunner: Baseline %s is not valid JSON"), *BaselinePath);
+		return false;
+	}
+
+	TMap<FString, double> BaselineMedians;
+	const TArray<TSharedPtr<FJsonValue>>* BaselineResults = nullptr;
+	if (Baseline->TryGetArrayField(TEXT("results"), BaselineResults))
+	{
+		for (const TSharedPtr<FJsonValue>& Value : *BaselineResults)
+		{
+			const TSharedPtr<FJsonObject>* Entry = nullptr;
+			if (Value.IsValid() && Value->TryGetObject(Entry))
+			{
+				BaselineMedians.Add((*Entry)->GetStringField(TEXT("name")), (*Entry)->GetNumberField(TEXT("medianNs")));
+			}
+		}
+	}
+
+	for (const FLBEASTBenchmarkResult& Result : Results)
+	{
+		const double* BaselineMedian = BaselineMedians.Find(Result.Name);
+		if (!BaselineMedian || *BaselineMedian <= 0.0)
+		{
+			continue;
+		}
+
+		const double Ratio = Result.MedianNs / *BaselineMedian;
+		if (Ratio > 1.0 + Tolerance)
+		{
+			OutRegressions.Add(FString::Printf(TEXT("%s: %.1f ns -> %.1f ns (+%.1f%%)"),
+				*Result.Name, *BaselineMedian, Result.MedianNs, (Ratio - 1.0) * 100.0));
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,13 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FLBEASTBenchmarkRunner;
+
+/** Single code paths: packet codecs, crypto, DMX buffers, fades, XR serialization, ASR, OSC */
+void RegisterLBEASTMicroBenchmarks(FLBEASTBenchmarkRunner& Runner);
+
+/** Whole-venue frames built from the micro paths (ECUs + DMX universes + VR players) */
+void RegisterLBEASTScenarioBenchmarks(FLBEASTBenchmarkRunner& Runner);
@@ -0,0 +1,21 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "LBEASTBenchmarks.h"
+
+DEFINE_LOG_CATEGORY(LogLBEASTBenchmarks);
+
+#define LOCTEXT_NAMESPACE "FLBEASTBenchmarksModule"
+
+void FLBEASTBenchmarksModule::StartupModule()
+{
+	UE_LOG(LogLBEASTBenchmarks, Log, TEXT("LBEASTBenchmarks module started!"));
+}
+
+void FLBEASTBenchmarksModule::ShutdownModule()
+{
+	UE_LOG(LogLBEASTBenchmarks, Log, TEXT("LBEASTBenchmarks module shut down!"));
+}
+
+#undef LOCTEXT_NAMESPACE
+	
+IMPLEMENT_MODULE(FLBEASTBenchmarksModule, LBEASTBenchmarks)
@@ -0,0 +1,319 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "LBEASTBenchmarkSuites.h"
+#include "LBEASTBenchmarkRunner.h"
+#include "LBEASTBenchmarkAccess.h"
+#include "UniverseBuffer.h"
+#include "FadeEngine.h"
+#include "VRPlayerTransport/XRReplicatedData.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	TArray<uint8> MakeFloatPayload(float Value)
+	{
+		TArray<uint8> Payload;
+		Payload.SetNumUninitialized(sizeof(float));
+		FMemory::Memcpy(Payload.GetData(), &Value, sizeof(float));
+		return Payload;
+	}
+
+	TArray<uint8> MakeBytes(int32 Count)
+	{
+		TArray<uint8> Bytes;
+		Bytes.SetNumUninitialized(Count);
+		for (int32 i = 0; i < Count; i++)
+		{
+			Bytes[i] = (uint8)(i * 31 + 7);
+		}
+		return Bytes;
+	}
+
+	const TCHAR* SecurityName(ELBEASTSecurityLevel Level)
+	{
+		switch (Level)
+		{
+			case ELBEASTSecurityLevel::None: return TEXT("CRC");
+			case ELBEASTSecurityLevel::HMAC: return TEXT("HMAC");
+			case ELBEASTSecurityLevel::Encrypted: return TEXT("Encrypted");
+			default: return TEXT("Other");
+		}
+	}
+
+	void RegisterPacketBenchmarks(FLBEASTBenchmarkRunner& Runner)
+	{
+		Runner.Add(TEXT("Packet.Plain.Encode"), TEXT("micro"), TEXT("ULBEASTUDPTransport: build one float packet"),
+			[](FLBEASTBenchmarkContext& Context)
+			{
+				TStrongObjectPtr<UEmbeddedDeviceController> Device(NewObject<UEmbeddedDeviceController>(GetTransientPackage()));
+				ULBEASTUDPTransport& Transport = *Device;
+				const TArray<uint8> Payload = MakeFloatPayload(0.5f);
+				const int64 PacketBytes = FLBEASTBenchmarkAccess::BuildPlainPacket(Transport, ELBEASTUDPDataType::Float, 10, Payload).Num();
+
+				Context.SetUnit(TEXT("packet"));
+				Context.Measure([&]()
+				{
+					FLBEASTBenchmarkContext::Consume(FLBEASTBenchmarkAccess::BuildPlainPacket(Transport, ELBEASTUDPDataType::Float, 10, Payload).Num());
+				}, PacketBytes);
+			});
+
+		Runner.Add(TEXT("Packet.Plain.Decode"), TEXT("micro"), TEXT("ULBEASTUDPTransport: validate and dispatch one float packet"),
+			[](FLBEASTBenchmarkContext& Context)
+			{
+				TStrongObjectPtr<UEmbeddedDeviceController> Device(NewObject<UEmbeddedDeviceController>(GetTransientPackage()));
+				ULBEASTUDPTransport& Transport = *Device;
+				const TArray<uint8> Packet = FLBEASTBenchmarkAccess::BuildPlainPacket(Transport, ELBEASTUDPDataType::Float, 10, MakeFloatPayload(0.5f));
+
+				Context.SetUnit(TEXT("packet"));
+				Context.Measure([&]()
+				{
+					FLBEASTBenchmarkAccess::ParsePlainPacket(Transport, Packet);
+				}, Packet.Num());
+			});
+
+		for (ELBEASTSecurityLevel Level : { ELBEASTSecurityLevel::None, ELBEASTSecurityLevel::HMAC, ELBEASTSecurityLevel::Encrypted })
+		{
+			Runner.Add(FString::Printf(TEXT("Packet.Device.%s.Encode"), SecurityName(Level)), TEXT("micro"),
+				TEXT("UEmbeddedDeviceController: build one float packet"),
+				[Level](FLBEASTBenchmarkContext& Context)
+				{
+					TStrongObjectPtr<UEmbeddedDeviceController> Device(NewObject<UEmbeddedDeviceController>(GetTransientPackage()));
+					FLBEASTBenchmarkAccess::ConfigureSecurity(*Device, Level);
+					const TArray<uint8> Payload = MakeFloatPayload(0.5f);
+					const int64 PacketBytes = FLBEASTBenchmarkAccess::BuildDevicePacket(*Device, ELBEASTDataType::Float, 10, Payload).Num();
+
+					Context.SetUnit(TEXT("packet"));
+					Context.Measure([&]()
+					{
+						FLBEASTBenchmarkContext::Consume(FLBEASTBenchmarkAccess::BuildDevicePacket(*Device, ELBEASTDataType::Float, 10, Payload).Num());
+					}, PacketBytes);
+				});
+
+			Runner.Add(FString::Printf(TEXT("Packet.Device.%s.Decode"), SecurityName(Level)), TEXT("micro"),
+				TEXT("UEmbeddedDeviceController: authenticate, decrypt and dispatch one float packet"),
+				[Level](FLBEASTBenchmarkContext& Context)
+				{
+					TStrongObjectPtr<UEmbeddedDeviceController> Device(NewObject<UEmbeddedDeviceController>(GetTransientPackage()));
+					FLBEASTBenchmarkAccess::ConfigureSecurity(*Device, Level);
+					const TArray<uint8> Packet = FLBEASTBenchmarkAccess::BuildDevicePacket(*Device, ELBEASTDataType::Float, 10, MakeFloatPayload(0.5f));
+
+					Context.SetUnit(TEXT("packet"));
+					Context.Measure([&]()
+					{
+						FLBEASTBenchmarkAccess::ParseDevicePacket(*Device, Packet);
+					}, Packet.Num());
+				});
+		}
+	}
+
+	void RegisterCryptoBenchmarks(FLBEASTBenchmarkRunner& Runner)
+	{
+		// 64 B is a typical telemetry frame, 1 KB a struct/bytes payload
+		for (int32 Size : { 64, 1024 })
+		{
+			Runner.Add(FString::Printf(TEXT("Crypto.HMAC.%dB"), Size), TEXT("micro"), TEXT("HMAC-SHA1 over the device auth key"),
+				[Size](FLBEASTBenchmarkContext& Context)
+				{
+					TStrongObjectPtr<UEmbeddedDeviceController> Device(NewObject<UEmbeddedDeviceController>(GetTransientPackage()));
+					FLBEASTBenchmarkAccess::ConfigureSecurity(*Device, ELBEASTSecurityLevel::HMAC);
+					const TArray<uint8> Data = MakeBytes(Size);
+
+					Context.SetUnit(TEXT("block"));
+					Context.Measure([&]()
+					{
+						FLBEASTBenchmarkContext::Consume(FLBEASTBenchmarkAccess::CalculateHMAC(*Device, Data).Num());
+					}, Size);
+				});
+
+			Runner.Add(FString::Printf(TEXT("Crypto.AES128CTR.%dB"), Size), TEXT("micro"), TEXT("AES-128-CTR with the device encryption key"),
+				[Size](FLBEASTBenchmarkContext& Context)
+				{
+					TStrongObjectPtr<UEmbeddedDeviceController> Device(NewObject<UEmbeddedDeviceController>(GetTransientPackage()));
+					FLBEASTBenchmarkAccess::ConfigureSecurity(*Device, ELBEASTSecurityLevel::Encrypted);
+					const TArray<uint8> Data = MakeBytes(Size);
+					uint32 IV = 1;
+
+					Context.SetUnit(TEXT("block"));
+					Context.Measure([&]()
+					{
+						FLBEASTBenchmarkContext::Consume(FLBEASTBenchmarkAccess::EncryptAES128(*Device, Data, IV++).Num());
+					}, Size);
+				});
+		}
+	}
+
+	void RegisterLightingBenchmarks(FLBEASTBenchmarkRunner& Runner)
+	{
+		Runner.Add(TEXT("DMX.UniverseBuffer.SetChannel"), TEXT("micro"), TEXT("One channel write, cycling across 32 universes"),
+			[](FLBEASTBenchmarkContext& Context)
+			{
+				FUniverseBuffer Buffer;
+				for (int32 Universe = 0; Universe < 32; Universe++)
+				{
+					Buffer.EnsureUniverse(Universe);
+				}
+				uint32 Counter = 0;
+
+				Context.SetUnit(TEXT("channel"));
+				Context.Measure([&]()
+				{
+					const uint32 Index = Counter++;
+					Buffer.SetChannel((Index >> 9) & 31, (Index & 511) + 1, (uint8)Index);
+				}, 1);
+			});
+
+		Runner.Add(TEXT("DMX.UniverseBuffer.FullUniverse"), TEXT("micro"), TEXT("Write all 512 channels of one universe"),
+			[](FLBEASTBenchmarkContext& Context)
+			{
+				FUniverseBuffer Buffer;
+				int32 Universe = 0;
+
+				Context.SetUnit(TEXT("universe"));
+				Context.Measure([&]()
+				{
+					Universe = (Universe + 1) & 31;
+					for (int32 Channel = 1; Channel <= 512; Channel++)
+					{
+						Buffer.SetChannel(Universe, Channel, (uint8)Channel);
+					}
+				}, 512);
+			});
+
+		Runner.Add(TEXT("DMX.FadeEngine.Tick1024"), TEXT("micro"), TEXT("One fade engine tick with 1024 active fades"),
+			[](FLBEASTBenchmarkContext& Context)
+			{
+				constexpr int32 FadeCount = 1024;
+				FFadeEngine Engine;
+				for (int32 Id = 0; Id < FadeCount; Id++)
+				{
+					// Long enough that no fade completes while measuring
+					Engine.StartFade(Id, 0.0f, 1.0f, 1.0e6f);
+				}
+				float Sum = 0.0f;
+
+				Context.SetUnit(TEXT("tick"));
+				Context.SetMetric(TEXT("activeFades"), FadeCount);
+				Context.Measure([&]()
+				{
+					Engine.Tick(1.0f / 90.0f, [&Sum](int32 Id, float Intensity) { Sum += Intensity; });
+				});
+				FLBEASTBenchmarkContext::Consume((int64)Sum);
+			});
+	}
+
+	void FillXRData(FLBEASTXRReplicatedData& Data, float Time)
+	{
+		Data.HMDPosition = FVector(100.0f * FMath::Sin(Time), 50.0f, 170.0f);
+		Data.HMDRotation = FRotator(0.0f, Time * 10.0f, 0.0f);
+		Data.bIsHMDTracked = true;
+		for (FReplicatedHandData* Hand : { &Data.LeftHand, &Data.RightHand })
+		{
+			Hand->bIsHandTrackingActive = true;
+			for (FReplicatedHandKeypoint* Keypoint : { &Hand->Wrist, &Hand->HandCenter, &Hand->ThumbTip, &Hand->IndexTip, &Hand->MiddleTip, &Hand->RingTip, &Hand->LittleTip })
+			{
+				*Keypoint = FReplicatedHandKeypoint(Data.HMDPosition + FVector(20.0f, 0.0f, -30.0f), Data.HMDRotation, true, 1.0f);
+			}
+		}
+		Data.ServerTimeStamp = Time;
+	}
+
+	void RegisterXRBenchmarks(FLBEASTBenchmarkRunner& Runner)
+	{
+		Runner.Add(TEXT("XR.ReplicatedData.Serialize"), TEXT("micro"), TEXT("Serialize one player's HMD + hand keypoints"),
+			[](FLBEASTBenchmarkContext& Context)
+			{
+				FLBEASTXRReplicatedData Data;
+				FillXRData(Data, 1.0f);
+				TArray<uint8> Bytes;
+				auto Serialize = [&]()
+				{
+					Bytes.Reset();
+					FMemoryWriter Writer(Bytes);
+					FLBEASTXRReplicatedData::StaticStruct()->SerializeBin(Writer, &Data);
+				};
+				Serialize();
+				const int64 SerializedBytes = Bytes.Num();
+
+				Context.SetUnit(TEXT("player"));
+				Context.SetMetric(TEXT("bytesPerPlayer"), (double)SerializedBytes);
+				Context.Measure(Serialize, SerializedBytes);
+			});
+
+		Runner.Add(TEXT("XR.ReplicatedData.Deserialize"), TEXT("micro"), TEXT("Deserialize one player's HMD + hand keypoints"),
+			[](FLBEASTBenchmarkContext& Context)
+			{
+				FLBEASTXRReplicatedData Source;
+				FillXRData(Source, 1.0f);
+				TArray<uint8> Bytes;
+				{
+					FMemoryWriter Writer(Bytes);
+					FLBEASTXRReplicatedData::StaticStruct()->SerializeBin(Writer, &Source);
+				}
+				FLBEASTXRReplicatedData Target;
+
+				Context.SetUnit(TEXT("player"));
+				Context.Measure([&]()
+				{
+					FMemoryReader Reader(Bytes);
+					FLBEASTXRReplicatedData::StaticStruct()->SerializeBin(Reader, &Target);
+				}, Bytes.Num());
+				FLBEASTBenchmarkContext::Consume((int64)Target.ServerTimeStamp);
+			});
+	}
+
+	void RegisterAudioBenchmarks(FLBEASTBenchmarkRunner& Runner)
+	{
+		// 20 ms is one VOIP/mic frame at 16 kHz, 1 s is a full ASR utterance chunk
+		for (int32 SampleCount : { 320, 16000 })
+		{
+			Runner.Add(FString::Printf(TEXT("ASR.PCMFloatToInt16.%d"), SampleCount), TEXT("micro"), TEXT("Convert float mic audio to 16-bit PCM for ASR"),
+				[SampleCount](FLBEASTBenchmarkContext& Context)
+				{
+					TStrongObjectPtr<UAIASRManager> Manager(NewObject<UAIASRManager>(GetTransientPackage()));
+					TArray<float> Audio;
+					Audio.SetNumUninitialized(SampleCount);
+					for (int32 i = 0; i < SampleCount; i++)
+					{
+						Audio[i] = FMath::Sin(i * 0.05f) * 0.8f;
+					}
+
+					Context.SetUnit(TEXT("buffer"));
+					Context.Measure([&]()
+					{
+						FLBEASTBenchmarkContext::Consume(FLBEASTBenchmarkAccess::ConvertPCMFloatToBytes(*Manager, Audio, 16000).Num());
+					}, SampleCount * (int64)sizeof(float));
+				});
+		}
+
+		for (ELBEASTProAudioConsole Console : { ELBEASTProAudioConsole::BehringerX32, ELBEASTProAudioConsole::YamahaCL })
+		{
+			const FString ConsoleName = StaticEnum<ELBEASTProAudioConsole>()->GetNameStringByValue((int64)Console);
+			Runner.Add(FString::Printf(TEXT("OSC.BuildPath.%s"), *ConsoleName), TEXT("micro"), TEXT("Build one fader OSC address"),
+				[Console](FLBEASTBenchmarkContext& Context)
+				{
+					TStrongObjectPtr<UProAudioController> Controller(NewObject<UProAudioController>(GetTransientPackage()));
+					Controller->Config.ConsoleType = Console;
+					int32 Channel = 0;
+
+					Context.SetUnit(TEXT("path"));
+					Context.Measure([&]()
+					{
+						Channel = (Channel % 32) + 1;
+						FLBEASTBenchmarkContext::Consume(FLBEASTBenchmarkAccess::BuildOSCPath(*Controller, TEXT("fader"), Channel).Len());
+					});
+				});
+		}
+	}
+}
+
+void RegisterLBEASTMicroBenchmarks(FLBEASTBenchmarkRunner& Runner)
+{
+	RegisterPacketBenchmarks(Runner);
+	RegisterCryptoBenchmarks(Runner);
+	RegisterLightingBenchmarks(Runner);
+	RegisterXRBenchmarks(Runner);
+	RegisterAudioBenchmarks(Runner);
+}
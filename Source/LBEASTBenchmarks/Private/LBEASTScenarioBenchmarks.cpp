@@ -0,0 +1,193 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "LBEASTBenchmarkSuites.h"
+#include "LBEASTBenchmarkRunner.h"
+#include "LBEASTBenchmarkAccess.h"
+#include "UniverseBuffer.h"
+#include "FadeEngine.h"
+#include "VRPlayerTransport/XRReplicatedData.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	constexpr double FrameRateHz = 90.0;
+	constexpr int32 FramesPerRun = 900;
+
+	/**
+	 * Server-side work for one frame of a large venue, without sockets:
+	 * - every ECU's telemetry is decoded and a couple of commands are encoded
+	 * - every DMX universe is faded, written and packed into an Art-Net sized frame
+	 * - every VR player's pose is serialized once and decoded once per other player
+	 */
+	class FVenueFrameScenario
+	{
+	public:
+		FVenueFrameScenario(int32 InECUCount, int32 InTelemetryPerECU, int32 InCommandsPerECU, int32 InUniverseCount, int32 InPlayerCount)
+			: TelemetryPerECU(InTelemetryPerECU)
+			, CommandsPerECU(InCommandsPerECU)
+			, UniverseCount(InUniverseCount)
+		{
+			for (int32 i = 0; i < InECUCount; i++)
+			{
+				TStrongObjectPtr<UEmbeddedDeviceController>& Device = Devices.Emplace_GetRef(NewObject<UEmbeddedDeviceController>(GetTransientPackage()));
+				FLBEASTBenchmarkAccess::ConfigureSecurity(*Device, ELBEASTSecurityLevel::Encrypted);
+
+				TArray<uint8> Payload;
+				Payload.SetNumUninitialized(sizeof(float));
+				const float Value = (float)i;
+				FMemory::Memcpy(Payload.GetData(), &Value, sizeof(float));
+				Telemetry.Add(FLBEASTBenchmarkAccess::BuildDevicePacket(*Device, ELBEASTDataType::Float, 100, Payload));
+			}
+			CommandPayload.SetNumZeroed(sizeof(float));
+
+			// 42 fixtures x 12 channels per universe, every fixture mid-fade
+			for (int32 Universe = 0; Universe < UniverseCount; Universe++)
+			{
+				Lighting.EnsureUniverse(Universe);
+				for (int32 Fixture = 0; Fixture < FixturesPerUniverse; Fixture++)
+				{
+					Fades.StartFade(Universe * FixturesPerUniverse + Fixture, 0.0f, 1.0f, 1.0e6f);
+				}
+			}
+			ArtNetFrame.SetNumZeroed(18 + 512);
+
+			Players.SetNum(InPlayerCount);
+			PlayerBytes.SetNum(InPlayerCount);
+			for (TArray<uint8>& Bytes : PlayerBytes)
+			{
+				Bytes.Reserve(1024);
+			}
+		}
+
+		void RunFrame()
+		{
+			FrameIndex++;
+
+			// ECUs
+			for (int32 i = 0; i < Devices.Num(); i++)
+			{
+				UEmbeddedDeviceController& Device = *Devices[i];
+				for (int32 t = 0; t < TelemetryPerECU; t++)
+				{
+					FLBEASTBenchmarkAccess::ParseDevicePacket(Device, Telemetry[i]);
+				}
+				for (int32 c = 0; c < CommandsPerECU; c++)
+				{
+					FLBEASTBenchmarkContext::Consume(FLBEASTBenchmarkAccess::BuildDevicePacket(Device, ELBEASTDataType::Float, c, CommandPayload).Num());
+				}
+			}
+
+			// Lighting
+			Fades.Tick(1.0f / (float)FrameRateHz, [this](int32 Id, float Intensity)
+			{
+				const int32 Universe = Id / FixturesPerUniverse;
+				const int32 FirstChannel = (Id % FixturesPerUniverse) * ChannelsPerFixture + 1;
+				const uint8 Level = (uint8)FMath::RoundToInt(Intensity * 255.0f);
+				for (int32 Channel = 0; Channel < ChannelsPerFixture; Channel++)
+				{
+					Lighting.SetChannel(Universe, FirstChannel + Channel, Level);
+				}
+			});
+			for (int32 Universe = 0; Universe < UniverseCount; Universe++)
+			{
+				if (const TArray<uint8>* Data = Lighting.GetUniverse(Universe))
+				{
+					FMemory::Memcpy(ArtNetFrame.GetData() + 18, Data->GetData(), 512);
+					FLBEASTBenchmarkContext::Consume(ArtNetFrame[18 + (FrameIndex & 511)]);
+				}
+			}
+
+			// VR players
+			const float Time = FrameIndex / (float)FrameRateHz;
+			for (int32 Player = 0; Player < Players.Num(); Player++)
+			{
+				FLBEASTXRReplicatedData& Data = Players[Player];
+				Data.HMDPosition = FVector(Player * 100.0f, FMath::Sin(Time) * 50.0f, 170.0f);
+				Data.HMDRotation = FRotator(0.0f, Time * 30.0f, 0.0f);
+				Data.bIsHMDTracked = true;
+				Data.ServerTimeStamp = Time;
+
+				PlayerBytes[Player].Reset();
+				FMemoryWriter Writer(PlayerBytes[Player]);
+				FLBEASTXRReplicatedData::StaticStruct()->SerializeBin(Writer, &Data);
+			}
+			for (int32 Receiver = 0; Receiver < Players.Num(); Receiver++)
+			{
+				for (int32 Player = 0; Player < Players.Num(); Player++)
+				{
+					if (Player != Receiver)
+					{
+						FMemoryReader Reader(PlayerBytes[Player]);
+						FLBEASTXRReplicatedData::StaticStruct()->SerializeBin(Reader, &RemoteScratch);
+					}
+				}
+			}
+		}
+
+		int32 GetPacketsPerFrame() const { return Devices.Num() * (TelemetryPerECU + CommandsPerECU); }
+
+	private:
+		static constexpr int32 FixturesPerUniverse = 42;
+		static constexpr int32 ChannelsPerFixture = 12;
+
+		int32 TelemetryPerECU;
+		int32 CommandsPerECU;
+		int32 UniverseCount;
+		uint32 FrameIndex = 0;
+
+		TArray<TStrongObjectPtr<UEmbeddedDeviceController>> Devices;
+		TArray<TArray<uint8>> Telemetry;
+		TArray<uint8> CommandPayload;
+
+		FUniverseBuffer Lighting;
+		FFadeEngine Fades;
+		TArray<uint8> ArtNetFrame;
+
+		TArray<FLBEASTXRReplicatedData> Players;
+		TArray<TArray<uint8>> PlayerBytes;
+		FLBEASTXRReplicatedData RemoteScratch;
+	};
+
+	void ReportFrameBudget(FLBEASTBenchmarkContext& Context, const FVenueFrameScenario& Scenario)
+	{
+		const double BudgetNs = 1e9 / FrameRateHz;
+		const FLBEASTBenchmarkResult& Result = Context.GetResult();
+		Context.SetMetric(TEXT("frameBudgetMs"), BudgetNs / 1e6);
+		Context.SetMetric(TEXT("medianBudgetPercent"), Result.MedianNs / BudgetNs * 100.0);
+		Context.SetMetric(TEXT("p99BudgetPercent"), Result.P99Ns / BudgetNs * 100.0);
+		Context.SetMetric(TEXT("packetsPerFrame"), Scenario.GetPacketsPerFrame());
+	}
+
+	void AddVenueScenario(FLBEASTBenchmarkRunner& Runner, const FString& Name, const FString& Description,
+		int32 ECUCount, int32 TelemetryPerECU, int32 CommandsPerECU, int32 UniverseCount, int32 PlayerCount)
+	{
+		Runner.Add(Name, TEXT("scenario"), Description,
+			[=](FLBEASTBenchmarkContext& Context)
+			{
+				FVenueFrameScenario Scenario(ECUCount, TelemetryPerECU, CommandsPerECU, UniverseCount, PlayerCount);
+
+				Context.SetUnit(TEXT("frame"));
+				Context.SetMetric(TEXT("ecus"), ECUCount);
+				Context.SetMetric(TEXT("universes"), UniverseCount);
+				Context.SetMetric(TEXT("vrPlayers"), PlayerCount);
+				Context.MeasureEach([&Scenario]() { Scenario.RunFrame(); }, FramesPerRun);
+				ReportFrameBudget(Context, Scenario);
+			});
+	}
+}
+
+void RegisterLBEASTScenarioBenchmarks(FLBEASTBenchmarkRunner& Runner)
+{
+	// Large venue at 90 Hz: ECUs report at ~360 Hz and take ~180 commands/s each
+	AddVenueScenario(Runner, TEXT("Scenario.Venue.40ECU_32Universe_12VR"),
+		TEXT("40 encrypted ECUs, 32 faded DMX universes and 12 VR players per 90 Hz frame"),
+		40, 4, 2, 32, 12);
+
+	// Same venue with ECUs streaming telemetry at 1 kHz (11 packets each per frame)
+	AddVenueScenario(Runner, TEXT("Scenario.ECUFlood.40ECU_1kHz"),
+		TEXT("40 encrypted ECUs streaming at 1 kHz alongside the venue lighting and VR load"),
+		40, 11, 2, 32, 12);
+}
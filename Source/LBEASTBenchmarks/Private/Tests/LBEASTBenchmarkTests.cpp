@@ -0,0 +1,229 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "Misc/AutomationTest.h"
+#include "LBEASTBenchmarkRunner.h"
+#include "LBEASTBenchmarkSuites.h"
+#include "LBEASTBenchmarkAccess.h"
+#include "UniverseBuffer.h"
+#include "FadeEngine.h"
+#include "FixtureRegistry.h"
+#include "VRPlayerTransport/XRReplicatedData.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	constexpr EAutomationTestFlags QuickTestFlags = EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter;
+	constexpr EAutomationTestFlags PerfTestFlags = EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter;
+
+	TArray<uint8> MakeFloatPayload(float Value)
+	{
+		TArray<uint8> Payload;
+		Payload.SetNumUninitialized(sizeof(float));
+		FMemory::Memcpy(Payload.GetData(), &Value, sizeof(float));
+		return Payload;
+	}
+
+	/** Runner tuned for correctness checks rather than stable timings */
+	void ConfigureQuickRunner(FLBEASTBenchmarkRunner& Runner)
+	{
+		Runner.Samples = 2;
+		Runner.MinSampleSeconds = 0.0001;
+	}
+}
+
+// =====================================
+// Code paths under benchmark
+// =====================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLBEASTDevicePacketRoundTripTest, "LBEAST.Benchmarks.DevicePacketRoundTrip", QuickTestFlags)
+
+bool FLBEASTDevicePacketRoundTripTest::RunTest(const FString& Parameters)
+{
+	for (ELBEASTSecurityLevel Level : { ELBEASTSecurityLevel::None, ELBEASTSecurityLevel::HMAC, ELBEASTSecurityLevel::Encrypted })
+	{
+		TStrongObjectPtr<UEmbeddedDeviceController> Device(NewObject<UEmbeddedDeviceController>(GetTransientPackage()));
+		FLBEASTBenchmarkAccess::ConfigureSecurity(*Device, Level);
+
+		const TArray<uint8> Packet = FLBEASTBenchmarkAccess::BuildDevicePacket(*Device, ELBEASTDataType::Float, 10, MakeFloatPayload(0.5f));
+		FLBEASTBenchmarkAccess::ParseDevicePacket(*Device, Packet);
+		TestEqual(FString::Printf(TEXT("Security %d: decoded value"), (int32)Level), Device->GetInputValue(10), 0.5f);
+
+		if (Level == ELBEASTSecurityLevel::None)
+		{
+			continue;
+		}
+
+		// A flipped payload bit must fail authentication and leave the cached value alone
+		TArray<uint8> Tampered = FLBEASTBenchmarkAccess::BuildDevicePacket(*Device, ELBEASTDataType::Float, 10, MakeFloatPayload(0.25f));
+		Tampered[Tampered.Num() - 9] ^= 0x01;
+		AddExpectedError(TEXT("HMAC validation failed"), EAutomationExpectedErrorFlags::Contains, 1);
+		FLBEASTBenchmarkAccess::ParseDevicePacket(*Device, Tampered);
+		TestEqual(FString::Printf(TEXT("Security %d: tampered packet rejected"), (int32)Level), Device->GetInputValue(10), 0.5f);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLBEASTBenchmarkedPathsTest, "LBEAST.Benchmarks.BenchmarkedPaths", QuickTestFlags)
+
+bool FLBEASTBenchmarkedPathsTest::RunTest(const FString& Parameters)
+{
+	// Universe buffer: writes land on the addressed universe/channel only
+	FUniverseBuffer Buffer;
+	Buffer.SetChannel(3, 1, 11);
+	Buffer.SetChannel(3, 512, 22);
+	Buffer.SetChannel(3, 513, 33);
+	TestEqual(TEXT("Universe channel 1"), Buffer.GetChannel(3, 1), (uint8)11);
+	TestEqual(TEXT("Universe channel 512"), Buffer.GetChannel(3, 512), (uint8)22);
+	TestEqual(TEXT("Other universe untouched"), Buffer.GetChannel(4, 1), (uint8)0);
+
+	// Fade engine: reaches the target after its duration and then drops the fade
+	FFadeEngine Engine;
+	Engine.StartFade(7, 0.0f, 1.0f, 1.0f);
+	float LastIntensity = 0.0f;
+	int32 Updates = 0;
+	for (int32 Frame = 0; Frame < 91; Frame++)
+	{
+		Engine.Tick(1.0f / 90.0f, [&](int32 Id, float Intensity) { LastIntensity = Intensity; Updates++; });
+	}
+	TestEqual(TEXT("Fade reaches target"), LastIntensity, 1.0f);
+	const int32 UpdatesAtEnd = Updates;
+	Engine.Tick(1.0f / 90.0f, [&](int32 Id, float Intensity) { Updates++; });
+	TestEqual(TEXT("Finished fade removed"), Updates, UpdatesAtEnd);
+
+	// Fixture registry: one-by-one registration keeps patch order; every change bumps the serial at once
+	FFixtureRegistry Registry;
+	for (int32 Id : { 3, 1, 2 })
+	{
+		FLBEASTDMXFixture Fixture;
+		Fixture.VirtualFixtureID = Id;
+		Fixture.FixtureType = ELBEASTDMXFixtureType::Dimmable;
+		Fixture.Universe = 0;
+		Fixture.DMXChannel = 100 - Id * 10;
+		Fixture.ChannelCount = 1;
+		Fixture.Groups.Add(Id == 2 ? FName(TEXT("Stage")) : FName(TEXT("House")));
+		Registry.Register(Fixture);
+	}
+	TestEqual(TEXT("Registry order"), Registry.GetIDs()[0], 3);
+	TestEqual(TEXT("Registry index"), Registry.IndexOf(1), 2);
+	TArray<FFixtureSpan> Spans;
+	FLBEASTFixtureQuery StageQuery;
+	StageQuery.Groups.Add(TEXT("Stage"));
+	Registry.Query(StageQuery, Spans);
+	TestTrue(TEXT("Group index follows inserts"), Spans.Num() == 1 && Spans[0].First == 1 && Spans[0].Num == 1);
+	const uint32 SerialBefore = Registry.GetSerial();
+	Registry.Relocate(2, 200);
+	TestNotEqual(TEXT("Relocate bumps serial"), Registry.GetSerial(), SerialBefore);
+	Registry.Unregister(3);
+	TestEqual(TEXT("Index after unregister"), Registry.IndexOf(2), 1);
+
+	// XR replicated data: serialize/deserialize round trip
+	FLBEASTXRReplicatedData Source;
+	Source.HMDPosition = FVector(100.0f, 50.0f, 170.0f);
+	Source.bIsHMDTracked = true;
+	Source.RightHand.IndexTip = FReplicatedHandKeypoint(FVector(120.0f, 50.0f, 140.0f), FRotator::ZeroRotator, true, 1.0f);
+	Source.ServerTimeStamp = 12.5f;
+	TArray<uint8> Bytes;
+	{
+		FMemoryWriter Writer(Bytes);
+		FLBEASTXRReplicatedData::StaticStruct()->SerializeBin(Writer, &Source);
+	}
+	FLBEASTXRReplicatedData Target;
+	{
+		FMemoryReader Reader(Bytes);
+		FLBEASTXRReplicatedData::StaticStruct()->SerializeBin(Reader, &Target);
+	}
+	TestEqual(TEXT("XR HMD position"), Target.HMDPosition, Source.HMDPosition);
+	TestEqual(TEXT("XR index tip"), Target.RightHand.IndexTip.Position, Source.RightHand.IndexTip.Position);
+	TestEqual(TEXT("XR timestamp"), Target.ServerTimeStamp, Source.ServerTimeStamp);
+
+	// ASR PCM: 16-bit little-endian, clamped
+	TStrongObjectPtr<UAIASRManager> Manager(NewObject<UAIASRManager>(GetTransientPackage()));
+	const TArray<uint8> PCM = FLBEASTBenchmarkAccess::ConvertPCMFloatToBytes(*Manager, { 0.0f, 1.0f, -2.0f }, 16000);
+	if (TestEqual(TEXT("PCM byte count"), PCM.Num(), 6))
+	{
+		TestEqual(TEXT("PCM silence"), (int16)(PCM[0] | (PCM[1] << 8)), (int16)0);
+		TestEqual(TEXT("PCM full scale"), (int16)(PCM[2] | (PCM[3] << 8)), (int16)32767);
+		TestTrue(TEXT("PCM clamps negative overflow"), (int16)(PCM[4] | (PCM[5] << 8)) <= -32767);
+	}
+
+	// OSC path: X32 fader addresses are 1-based, zero padded
+	TStrongObjectPtr<UProAudioController> Controller(NewObject<UProAudioController>(GetTransientPackage()));
+	Controller->Config.ConsoleType = ELBEASTProAudioConsole::BehringerX32;
+	TestEqual(TEXT("X32 fader path"), FLBEASTBenchmarkAccess::BuildOSCPath(*Controller, TEXT("fader"), 5), FString(TEXT("/ch/05/mix/fader")));
+
+	return true;
+}
+
+// =====================================
+// Runner
+// =====================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLBEASTBenchmarkBaselineTest, "LBEAST.Benchmarks.Baseline", QuickTestFlags)
+
+bool FLBEASTBenchmarkBaselineTest::RunTest(const FString& Parameters)
+{
+	FLBEASTBenchmarkRunner Runner;
+	ConfigureQuickRunner(Runner);
+	RegisterLBEASTMicroBenchmarks(Runner);
+	if (!TestEqual(TEXT("Filtered run"), Runner.Run({ TEXT("DMX.UniverseBuffer.SetChannel") }), 1))
+	{
+		return false;
+	}
+
+	const FString Directory = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("LBEASTBenchmarks"));
+	const FString CurrentPath = FPaths::Combine(Directory, TEXT("current.json"));
+	TestTrue(TEXT("JSON written"), Runner.WriteJSON(CurrentPath));
+
+	FString Json;
+	TestTrue(TEXT("JSON readable"), FFileHelper::LoadFileToString(Json, *CurrentPath));
+	TestTrue(TEXT("JSON schema"), Json.Contains(TEXT("\"lbeast-benchmark/1\"")));
+
+	// Against itself: identical medians, no regression
+	TArray<FString> Regressions;
+	TestTrue(TEXT("Self baseline read"), Runner.CompareToBaseline(CurrentPath, 0.10, Regressions));
+	TestEqual(TEXT("No regressions vs. self"), Regressions.Num(), 0);
+
+	// Against an impossibly fast baseline: one regression
+	const FString FastPath = FPaths::Combine(Directory, TEXT("fast.json"));
+	FFileHelper::SaveStringToFile(TEXT("{\"schema\":\"lbeast-benchmark/1\",\"results\":[{\"name\":\"DMX.UniverseBuffer.SetChannel\",\"medianNs\":0.000001}]}"), *FastPath);
+	Regressions.Reset();
+	TestTrue(TEXT("Fast baseline read"), Runner.CompareToBaseline(FastPath, 0.10, Regressions));
+	TestEqual(TEXT("Regression vs. fast baseline"), Regressions.Num(), 1);
+
+	// Missing baseline is an error, not "no regressions"
+	AddExpectedError(TEXT("Could not read baseline"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse(TEXT("Missing baseline"), Runner.CompareToBaseline(FPaths::Combine(Directory, TEXT("missing.json")), 0.10, Regressions));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLBEASTBenchmarkSuitesTest, "LBEAST.Benchmarks.Suites", PerfTestFlags)
+
+bool FLBEASTBenchmarkSuitesTest::RunTest(const FString& Parameters)
+{
+	// Every registered benchmark runs to completion and reports a timing
+	FLBEASTBenchmarkRunner Runner;
+	ConfigureQuickRunner(Runner);
+	RegisterLBEASTMicroBenchmarks(Runner);
+	RegisterLBEASTScenarioBenchmarks(Runner);
+
+	TestEqual(TEXT("All benchmarks ran"), Runner.Run({}), Runner.GetDefinitions().Num());
+	for (const FLBEASTBenchmarkResult& Result : Runner.GetResults())
+	{
+		TestTrue(FString::Printf(TEXT("%s: samples"), *Result.Name), Result.Samples > 0);
+		TestTrue(FString::Printf(TEXT("%s: median"), *Result.Name), Result.MedianNs > 0.0);
+		TestTrue(FString::Printf(TEXT("%s: ordering"), *Result.Name), Result.MinNs <= Result.MedianNs && Result.MedianNs <= Result.MaxNs);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
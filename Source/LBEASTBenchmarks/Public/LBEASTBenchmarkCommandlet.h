@@ -0,0 +1,34 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "LBEASTBenchmarkCommandlet.generated.h"
+
+/**
+ * LBEAST Benchmark Commandlet
+ * 
+ * Runs the LBEAST benchmark suite headless and writes the results as JSON.
+ * 
+ * Usage:
+ *   UnrealEditor-Cmd MyProject.uproject -run=LBEASTBenchmark -nullrhi -unattended
+ *       [-filter=Packet,Scenario]    Only run benchmarks whose name contains one of these
+ *       [-samples=30]                Samples per benchmark
+ *       [-output=Path.json]          Default: Saved/Benchmarks/LBEASTBenchmarks-<timestamp>.json
+ *       [-baseline=Path.json]        Compare medians against a previous run
+ *       [-tolerance=0.10]            Allowed slowdown vs. baseline before failing
+ *       [-list]                      Print the available benchmarks and exit
+ * 
+ * Exit codes: 0 = OK, 1 = regression vs. baseline, 2 = error (bad baseline, could not write output)
+ */
+UCLASS()
+class LBEASTBENCHMARKS_API ULBEASTBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	ULBEASTBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,195 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+
+/**
+ * Result of one benchmark
+ * All timings are per operation (one packet, one frame, ...) in nanoseconds.
+ */
+struct LBEASTBENCHMARKS_API FLBEASTBenchmarkResult
+{
+	/** Benchmark name (e.g. "Packet.Decode.Encrypted") */
+	FString Name;
+
+	/** "micro" or "scenario" */
+	FString Category;
+
+	/** What one operation is ("packet", "frame", ...) */
+	FString Unit = TEXT("op");
+
+	/** Operations timed per sample, and number of samples */
+	int64 OpsPerSample = 0;
+	int32 Samples = 0;
+
+	double MinNs = 0.0;
+	double MedianNs = 0.0;
+	double MeanNs = 0.0;
+	double P99Ns = 0.0;
+	double MaxNs = 0.0;
+
+	/** Derived from the median */
+	double OpsPerSecond = 0.0;
+
+	/** Payload throughput (0 when the benchmark doesn't report bytes) */
+	double BytesPerSecond = 0.0;
+
+	/** Benchmark-specific values (e.g. frame budget used) */
+	TMap<FString, double> Metrics;
+};
+
+/**
+ * Measurement context passed to each benchmark body
+ */
+class LBEASTBENCHMARKS_API FLBEASTBenchmarkContext
+{
+public:
+	FLBEASTBenchmarkContext(FLBEASTBenchmarkResult& InResult, int32 InSamples, double InMinSampleSeconds)
+		: Result(InResult)
+		, Samples(FMath::Max(InSamples, 1))
+		, MinSampleSeconds(InMinSampleSeconds)
+	{
+	}
+
+	/**
+	 * Time a cheap operation. Ops are batched so each sample lasts at least MinSampleSeconds,
+	 * which keeps timer resolution out of the result.
+	 * @param Op - Called once per operation
+	 * @param BytesPerOp - Payload bytes per operation (for throughput), 0 if not meaningful
+	 */
+	template <typename OpType>
+	void Measure(OpType&& Op, int64 BytesPerOp = 0)
+	{
+		// Warm up caches and calibrate the batch size
+		int64 Batch = 1;
+		for (;;)
+		{
+			const uint64 Start = FPlatformTime::Cycles64();
+			for (int64 i = 0; i < Batch; i++)
+			{
+				Op();
+			}
+			const double Seconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - Start);
+			if (Seconds >= MinSampleSeconds || Batch >= (int64(1) << 30))
+			{
+				break;
+			}
+			Batch *= 2;
+		}
+
+		TArray<double> NsPerOp;
+		NsPerOp.Reserve(Samples);
+		for (int32 Sample = 0; Sample < Samples; Sample++)
+		{
+			const uint64 Start = FPlatformTime::Cycles64();
+			for (int64 i = 0; i < Batch; i++)
+			{
+				Op();
+			}
+			NsPerOp.Add(FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - Start) * 1e9 / (double)Batch);
+		}
+
+		Finish(NsPerOp, Batch, BytesPerOp);
+	}
+
+	/**
+	 * Time an expensive operation (e.g. one simulated frame) individually, so P99/max
+	 * reflect real spikes instead of batch averages.
+	 */
+	template <typename OpType>
+	void MeasureEach(OpType&& Op, int32 Iterations, int64 BytesPerOp = 0)
+	{
+		// Warm up
+		for (int32 i = 0; i < FMath::Min(Iterations, 8); i++)
+		{
+			Op();
+		}
+
+		TArray<double> NsPerOp;
+		NsPerOp.Reserve(Iterations);
+		for (int32 i = 0; i < Iterations; i++)
+		{
+			const uint64 Start = FPlatformTime::Cycles64();
+			Op();
+			NsPerOp.Add(FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - Start) * 1e9);
+		}
+
+		Finish(NsPerOp, 1, BytesPerOp);
+	}
+
+	/** Name what one operation is (reported in JSON) */
+	void SetUnit(const FString& Unit) { Result.Unit = Unit; }
+
+	/** Attach a benchmark-specific value to the result */
+	void SetMetric(const FString& Name, double Value) { Result.Metrics.Add(Name, Value); }
+
+	/** Keep a value alive so the optimizer can't discard the work that produced it */
+	static void Consume(int64 Value) { Sink = Sink + Value; }
+
+	const FLBEASTBenchmarkResult& GetResult() const { return Result; }
+
+private:
+	void Finish(TArray<double>& NsPerOp, int64 OpsPerSample, int64 BytesPerOp);
+
+	FLBEASTBenchmarkResult& Result;
+	int32 Samples;
+	double MinSampleSeconds;
+
+	static volatile int64 Sink;
+};
+
+/**
+ * One registered benchmark
+ */
+struct LBEASTBENCHMARKS_API FLBEASTBenchmarkDefinition
+{
+	FString Name;
+	FString Category;
+	FString Description;
+	TFunction<void(FLBEASTBenchmarkContext&)> Body;
+};
+
+/**
+ * LBEAST Benchmark Runner (Non-UObject)
+ *
+ * Holds the registered benchmarks, runs a filtered subset, writes JSON and compares
+ * against a baseline file. Used by ULBEASTBenchmarkCommandlet.
+ */
+class LBEASTBENCHMARKS_API FLBEASTBenchmarkRunner
+{
+public:
+	/** Register a benchmark */
+	void Add(const FString& Name, const FString& Category, const FString& Description, TFunction<void(FLBEASTBenchmarkContext&)> Body);
+
+	/**
+	 * Run every benchmark whose name contains one of Filters (all when empty)
+	 * @return Number of benchmarks run
+	 */
+	int32 Run(const TArray<FString>& Filters);
+
+	const TArray<FLBEASTBenchmarkDefinition>& GetDefinitions() const { return Definitions; }
+	const TArray<FLBEASTBenchmarkResult>& GetResults() const { return Results; }
+
+	/** Write results as JSON (schema "lbeast-benchmark/1") */
+	bool WriteJSON(const FString& Path) const;
+
+	/**
+	 * Compare median timings against a previous JSON result
+	 * @param Tolerance - Allowed slowdown (0.10 = 10%)
+	 * @param OutRegressions - Human-readable description of every regression
+	 * @return False if the baseline could not be read
+	 */
+	bool CompareToBaseline(const FString& BaselinePath, double Tolerance, TArray<FString>& OutRegressions) const;
+
+	/** Samples per benchmark */
+	int32 Samples = 30;
+
+	/** Minimum duration of one Measure() sample */
+	double MinSampleSeconds = 0.002;
+
+private:
+	TArray<FLBEASTBenchmarkDefinition> Definitions;
+	TArray<FLBEASTBenchmarkResult> Results;
+};
@@ -0,0 +1,26 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogLBEASTBenchmarks, Log, All);
+
+/**
+ * LBEAST Benchmarks Module
+ * 
+ * Headless performance benchmarks for the performance-sensitive parts of LBEAST:
+ * - Microbenchmarks (packet encode/decode, HMAC/AES, DMX buffers, fades, XR serialization, ASR PCM, OSC paths)
+ * - Venue scenarios (many ECUs + DMX universes + replicated VR players in one frame)
+ * 
+ * Run with the LBEASTBenchmark commandlet; results are written as JSON and can be
+ * compared against a saved baseline to catch regressions before they reach the venue.
+ */
+class FLBEASTBenchmarksModule : public IModuleInterface
+{
+public:
+	/** IModuleInterface implementation */
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+};
@@ -1,5 +1,6 @@
 // Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
 
+using System.IO;
 using UnrealBuildTool;
 
 public class LBEASTCore : ModuleRules
@@ -16,7 +17,8 @@ public class LBEASTCore : ModuleRules
 		
 		PrivateIncludePaths.AddRange(
 			new string[] {
-				// ... add other private include paths required here ...
+				// BSDSockets/SocketsBSD.h: LBEASTIOReactor waits on the native handles behind FSocket
+				Path.Combine(EngineDirectory, "Source/Runtime/Sockets/Private"),
 			}
 		);
 			
@@ -1,6 +1,10 @@
 // Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
 
 #include "ExperienceLoop/ExperienceStateMachine.h"
+#include "LBEASTCore.h"
+
+DECLARE_CYCLE_STAT(TEXT("Experience State Dispatch"), STAT_ExperienceStateMachine_Dispatch, STATGROUP_LBEASTCore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Experience State Handlers Run"), STAT_ExperienceStateMachine_Handlers, STATGROUP_LBEASTCore);
 
 UExperienceStateMachine::UExperienceStateMachine()
 {
@@ -14,6 +18,11 @@ void UExperienceStateMachine::Initialize(const TArray<FExperienceState>& InState
 	CurrentStateIndex = 0;
 	bIsRunning = false;
 
+	// Indices now refer to different states, so per-state bindings no longer mean anything
+	EnterHandlers.Reset();
+	PendingBindings.RemoveAll([](const TPair<int32, FStateHandler>& Pending) { return Pending.Key != INDEX_NONE; });
+	RebuildStateIndex();
+
 	if (States.Num() > 0)
 	{
 		UE_LOG(LogTemp, Log, TEXT("ExperienceStateMachine: Initialized with %d states"), States.Num());
@@ -35,10 +44,9 @@ void UExperienceStateMachine::StartExperience()
 	CurrentStateIndex = 0;
 	bIsRunning = true;
 
-	FName InitialState = States[0].StateName;
-	UE_LOG(LogTemp, Log, TEXT("ExperienceStateMachine: Started at state '%s'"), *InitialState.ToString());
+	UE_LOG(LogTemp, Log, TEXT("ExperienceStateMachine: Started at state '%s'"), *States[0].StateName.ToString());
 	
-	BroadcastStateChange(NAME_None, InitialState);
+	BroadcastStateChange(INDEX_NONE);
 }
 
 bool UExperienceStateMachine::AdvanceState()
@@ -55,14 +63,12 @@ bool UExperienceStateMachine::AdvanceState()
 		return false;
 	}
 
-	FName OldState = GetCurrentStateName();
-	CurrentStateIndex++;
-	FName NewState = GetCurrentStateName();
+	const int32 OldStateIndex = CurrentStateIndex++;
 
 	UE_LOG(LogTemp, Log, TEXT("ExperienceStateMachine: Advanced from '%s' to '%s' (Index %d)"), 
-		*OldState.ToString(), *NewState.ToString(), CurrentStateIndex);
+		*States[OldStateIndex].StateName.ToString(), *GetCurrentStateName().ToString(), CurrentStateIndex);
 
-	BroadcastStateChange(OldState, NewState);
+	BroadcastStateChange(OldStateIndex);
 	return true;
 }
 
@@ -80,25 +86,21 @@ bool UExperienceStateMachine::RetreatState()
 		return false;
 	}
 
-	FName OldState = GetCurrentStateName();
-	CurrentStateIndex--;
-	FName NewState = GetCurrentStateName();
+	const int32 OldStateIndex = CurrentStateIndex--;
 
 	UE_LOG(LogTemp, Log, TEXT("ExperienceStateMachine: Retreated from '%s' to '%s' (Index %d)"), 
-		*OldState.ToString(), *NewState.ToString(), CurrentStateIndex);
+		*States[OldStateIndex].StateName.ToString(), *GetCurrentStateName().ToString(), CurrentStateIndex);
 
-	BroadcastStateChange(OldState, NewState);
+	BroadcastStateChange(OldStateIndex);
 	return true;
 }
 
 bool UExperienceStateMachine::JumpToState(FName StateName)
 {
-	for (int32 i = 0; i < States.Num(); i++)
+	const int32 StateIndex = FindStateIndex(StateName);
+	if (StateIndex != INDEX_NONE)
 	{
-		if (States[i].StateName == StateName)
-		{
-			return JumpToStateIndex(i);
-		}
+		return JumpToStateIndex(StateIndex);
 	}
 
 	UE_LOG(LogTemp, Warning, TEXT("ExperienceStateMachine: State '%s' not found"), *StateName.ToString());
@@ -113,14 +115,14 @@ bool UExperienceStateMachine::JumpToStateIndex(int32 StateIndex)
 		return false;
 	}
 
-	FName OldState = GetCurrentStateName();
+	const int32 OldStateIndex = CurrentStateIndex;
+	const FName OldState = GetCurrentStateName();
 	CurrentStateIndex = StateIndex;
-	FName NewState = GetCurrentStateName();
 
 	UE_LOG(LogTemp, Log, TEXT("ExperienceStateMachine: Jumped from '%s' to '%s' (Index %d)"), 
-		*OldState.ToString(), *NewState.ToString(), CurrentStateIndex);
+		*OldState.ToString(), *GetCurrentStateName().ToString(), CurrentStateIndex);
 
-	BroadcastStateChange(OldState, NewState);
+	BroadcastStateChange(OldStateIndex);
 	return true;
 }
 
@@ -178,17 +180,46 @@ bool UExperienceStateMachine::CanRetreat() const
 	return States[CurrentStateIndex].bCanSkipBackward;
 }
 
+TArray<FName> UExperienceStateMachine::GetReachableStates(bool bIncludeJumps) const
+{
+	TArray<FName> Reachable;
+	if (!States.IsValidIndex(CurrentStateIndex))
+	{
+		return Reachable;
+	}
+
+	// Most likely first: the actor's advance button, then retreat, then operator jumps
+	if (CanAdvance())
+	{
+		Reachable.Add(States[CurrentStateIndex + 1].StateName);
+	}
+	if (CanRetreat())
+	{
+		Reachable.Add(States[CurrentStateIndex - 1].StateName);
+	}
+	if (bIncludeJumps)
+	{
+		for (int32 i = 0; i < States.Num(); i++)
+		{
+			if (i != CurrentStateIndex)
+			{
+				Reachable.AddUnique(States[i].StateName);
+			}
+		}
+	}
+	return Reachable;
+}
+
 void UExperienceStateMachine::ResetExperience()
 {
-	FName OldState = GetCurrentStateName();
+	const int32 OldStateIndex = CurrentStateIndex;
 	CurrentStateIndex = 0;
-	FName NewState = GetCurrentStateName();
 
-	UE_LOG(LogTemp, Log, TEXT("ExperienceStateMachine: Reset to initial state '%s'"), *NewState.ToString());
+	UE_LOG(LogTemp, Log, TEXT("ExperienceStateMachine: Reset to initial state '%s'"), *GetCurrentStateName().ToString());
 
 	if (bIsRunning)
 	{
-		BroadcastStateChange(OldState, NewState);
+		BroadcastStateChange(OldStateIndex);
 	}
 }
 
@@ -198,10 +229,209 @@ void UExperienceStateMachine::StopExperience()
 	UE_LOG(LogTemp, Log, TEXT("ExperienceStateMachine: Experience stopped at state '%s'"), *GetCurrentStateName().ToString());
 }
 
-void UExperienceStateMachine::BroadcastStateChange(FName OldState, FName NewState)
+// =====================================
+// State-Indexed Dispatch
+// =====================================
+
+void UExperienceStateMachine::RebuildStateIndex()
+{
+	StateIndexByName.Reset();
+	StateIndexByName.Reserve(States.Num());
+	for (int32 i = 0; i < States.Num(); i++)
+	{
+		// First occurrence wins, matching the old linear search in JumpToState
+		if (!StateIndexByName.Contains(States[i].StateName))
+		{
+			StateIndexByName.Add(States[i].StateName, i);
+		}
+	}
+
+	EnterHandlers.SetNum(States.Num());
+}
+
+int32 UExperienceStateMachine::FindStateIndex(FName StateName) const
+{
+	// States is editable from Blueprint/defaults without going through Initialize()
+	if (StateIndexByName.Num() == 0 && States.Num() > 0)
+	{
+		return States.IndexOfByPredicate([StateName](const FExperienceState& State) { return State.StateName == StateName; });
+	}
+
+	const int32* Index = StateIndexByName.Find(StateName);
+	return Index ? *Index : INDEX_NONE;
+}
+
+FDelegateHandle UExperienceStateMachine::BindStateEntered(int32 StateIndex, FOnExperienceStateEntered Handler)
+{
+	if (!States.IsValidIndex(StateIndex))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ExperienceStateMachine: Cannot bind handler to invalid state index %d"), StateIndex);
+		return FDelegateHandle();
+	}
+
+	return AddHandler(StateIndex, MoveTemp(Handler));
+}
+
+FDelegateHandle UExperienceStateMachine::BindAnyStateEntered(FOnExperienceStateEntered Handler)
 {
-	OnStateChanged.Broadcast(OldState, NewState, CurrentStateIndex);
+	return AddHandler(INDEX_NONE, MoveTemp(Handler));
 }
 
+FDelegateHandle UExperienceStateMachine::AddHandler(int32 StateIndex, FOnExperienceStateEntered&& Handler)
+{
+	if (!Handler.IsBound())
+	{
+		return FDelegateHandle();
+	}
 
+	FStateHandler Entry;
+	Entry.Handle = FDelegateHandle(FDelegateHandle::GenerateNewHandle);
+	Entry.Delegate = MoveTemp(Handler);
+	const FDelegateHandle Handle = Entry.Handle;
+
+	// Appending while a list is being walked could reallocate it under the running handler
+	if (DispatchDepth > 0)
+	{
+		PendingBindings.Emplace(StateIndex, MoveTemp(Entry));
+		return Handle;
+	}
 
+	if (StateIndex == INDEX_NONE)
+	{
+		AnyStateHandlers.Add(MoveTemp(Entry));
+	}
+	else
+	{
+		if (EnterHandlers.Num() != States.Num())
+		{
+			RebuildStateIndex();
+		}
+		EnterHandlers[StateIndex].Add(MoveTemp(Entry));
+	}
+	return Handle;
+}
+
+void UExperienceStateMachine::UnbindStateHandler(FDelegateHandle Handle)
+{
+	if (Handle.IsValid())
+	{
+		RemoveHandlers([Handle](const FStateHandler& Entry) { return Entry.Handle == Handle; });
+	}
+}
+
+void UExperienceStateMachine::UnbindStateHandlers(const void* Object)
+{
+	if (Object)
+	{
+		RemoveHandlers([Object](const FStateHandler& Entry) { return Entry.Delegate.IsBoundToObject(Object); });
+	}
+}
+
+void UExperienceStateMachine::RemoveHandlers(TFunctionRef<bool(const FStateHandler&)> Predicate)
+{
+	PendingBindings.RemoveAll([&Predicate](const TPair<int32, FStateHandler>& Pending) { return Predicate(Pending.Value); });
+
+	// A running handler may be the one unbinding itself, so never touch the lists mid-dispatch
+	auto RemoveFrom = [this, &Predicate](TArray<FStateHandler>& List)
+	{
+		if (DispatchDepth == 0)
+		{
+			List.RemoveAll(Predicate);
+			return;
+		}
+		for (FStateHandler& Entry : List)
+		{
+			if (!Entry.bRemoved && Predicate(Entry))
+			{
+				Entry.bRemoved = true;
+				bNeedsCompaction = true;
+			}
+		}
+	};
+
+	RemoveFrom(AnyStateHandlers);
+	for (TArray<FStateHandler>& List : EnterHandlers)
+	{
+		RemoveFrom(List);
+	}
+}
+
+void UExperienceStateMachine::CompactHandlers()
+{
+	if (bNeedsCompaction)
+	{
+		auto IsRemoved = [](const FStateHandler& Entry) { return Entry.bRemoved; };
+		AnyStateHandlers.RemoveAll(IsRemoved);
+		for (TArray<FStateHandler>& List : EnterHandlers)
+		{
+			List.RemoveAll(IsRemoved);
+		}
+		bNeedsCompaction = false;
+	}
+
+	if (PendingBindings.Num() > 0)
+	{
+		TArray<TPair<int32, FStateHandler>> Pending = MoveTemp(PendingBindings);
+		PendingBindings.Reset();
+		for (TPair<int32, FStateHandler>& Binding : Pending)
+		{
+			if (Binding.Key == INDEX_NONE)
+			{
+				AnyStateHandlers.Add(MoveTemp(Binding.Value));
+			}
+			else if (EnterHandlers.IsValidIndex(Binding.Key))
+			{
+				EnterHandlers[Binding.Key].Add(MoveTemp(Binding.Value));
+			}
+		}
+	}
+}
+
+void UExperienceStateMachine::BroadcastStateChange(int32 OldStateIndex)
+{
+	LBEASTCORE_SCOPE_CYCLE_COUNTER(STAT_ExperienceStateMachine_Dispatch);
+	const int32 NewStateIndex = CurrentStateIndex;
+
+	DispatchDepth++;
+
+	// Only the entered state's list runs - no per-subscriber name lookups
+	int32 HandlersRun = 0;
+	if (EnterHandlers.IsValidIndex(NewStateIndex))
+	{
+		const int32 Count = EnterHandlers[NewStateIndex].Num();
+		// A handler may re-Initialize() the machine, which empties the per-state lists
+		for (int32 i = 0; i < Count && EnterHandlers.IsValidIndex(NewStateIndex) && EnterHandlers[NewStateIndex].IsValidIndex(i); i++)
+		{
+			const FStateHandler& Entry = EnterHandlers[NewStateIndex][i];
+			if (!Entry.bRemoved && Entry.Delegate.ExecuteIfBound(OldStateIndex, NewStateIndex))
+			{
+				HandlersRun++;
+			}
+		}
+	}
+
+	const int32 AnyCount = AnyStateHandlers.Num();
+	for (int32 i = 0; i < AnyCount; i++)
+	{
+		const FStateHandler& Entry = AnyStateHandlers[i];
+		if (!Entry.bRemoved && Entry.Delegate.ExecuteIfBound(OldStateIndex, NewStateIndex))
+		{
+			HandlersRun++;
+		}
+	}
+
+	DispatchDepth--;
+	if (DispatchDepth == 0)
+	{
+		CompactHandlers();
+	}
+	LBEASTCORE_INC_COUNTER(STAT_ExperienceStateMachine_Handlers, HandlersRun);
+
+	// Blueprint listeners still get names; skip building them when nobody is listening
+	if (OnStateChanged.IsBound())
+	{
+		const FName OldState = States.IsValidIndex(OldStateIndex) ? States[OldStateIndex].StateName : NAME_None;
+		const FName NewState = States.IsValidIndex(NewStateIndex) ? States[NewStateIndex].StateName : NAME_None;
+		OnStateChanged.Broadcast(OldState, NewState, NewStateIndex);
+	}
+}
@@ -0,0 +1,897 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "Health/LBEASTDeviceHealth.h"
+#include "LBEASTCore.h"
+#include "Algo/BinarySearch.h"
+#include "Common/TcpSocketBuilder.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/IPv4/IPv4Address.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+
+DECLARE_CYCLE_STAT(TEXT("Device Health Tick"), STAT_LBEASTHealth_Tick, STATGROUP_LBEASTCore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Metrics Scrapes"), STAT_LBEASTHealth_MetricsScrapes, STATGROUP_LBEASTCore);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Unhealthy Devices"), STAT_LBEASTHealth_UnhealthyDevices, STATGROUP_LBEASTCore);
+
+namespace
+{
+	/** Sequence jumps larger than this are a device restart, not loss */
+	constexpr int64 MaxSequenceGap = 1000;
+
+	/** Interval samples needed before the early warning adapts to the device's own rate */
+	constexpr int32 MinIntervalSamples = 8;
+
+	/** Floor for the adaptive early warning so frame hitches on fast devices don't flap it */
+	constexpr double MinWarningSeconds = 0.25;
+
+	/** Samples (plus the open interval) that make up LossPercent */
+	constexpr int32 LossWindowSamples = 10;
+
+	constexpr int32 MaxMetricsConnections = 16;
+	constexpr int32 MaxMetricsRequestBytes = 8 * 1024;
+	constexpr double MetricsRequestTimeoutSeconds = 2.0;
+
+	const TCHAR* StateToString(ELBEASTDeviceHealthState State)
+	{
+		switch (State)
+		{
+		case ELBEASTDeviceHealthState::Healthy:		return TEXT("Healthy");
+		case ELBEASTDeviceHealthState::Degraded:	return TEXT("Degraded");
+		case ELBEASTDeviceHealthState::Stale:		return TEXT("Stale");
+		case ELBEASTDeviceHealthState::TimedOut:	return TEXT("TimedOut");
+		default:									return TEXT("Unknown");
+		}
+	}
+
+	/** Prometheus label value escaping (backslash, double quote, newline) */
+	FString EscapeLabel(const FString& Value)
+	{
+		return Value.Replace(TEXT("\\"), TEXT("\\\\")).Replace(TEXT("\""), TEXT("\\\"")).Replace(TEXT("\n"), TEXT("\\n"));
+	}
+
+	void AppendFamily(FString& Out, const TCHAR* Name, const TCHAR* Type, const TCHAR* Help)
+	{
+		Out += FString::Printf(TEXT("# HELP %s %s\n# TYPE %s %s\n"), Name, Help, Name, Type);
+	}
+}
+
+// =====================================
+// FLBEASTRollingPercentile
+// =====================================
+
+FLBEASTRollingPercentile::FLBEASTRollingPercentile(int32 InWindowSize)
+	: WindowSize(FMath::Max(InWindowSize, 1))
+{
+	Ring.Reserve(WindowSize);
+	Sorted.Reserve(WindowSize);
+}
+
+void FLBEASTRollingPercentile::Add(float Value)
+{
+	if (!FMath::IsFinite(Value))
+	{
+		return;
+	}
+
+	if (Ring.Num() < WindowSize)
+	{
+		Ring.Add(Value);
+	}
+	else
+	{
+		// Evict the oldest value from both views
+		const float Oldest = Ring[RingHead];
+		Ring[RingHead] = Value;
+		RingHead = (RingHead + 1) % WindowSize;
+
+		const int32 OldestIndex = Algo::LowerBound(Sorted, Oldest);
+		if (Sorted.IsValidIndex(OldestIndex))
+		{
+			Sorted.RemoveAt(OldestIndex, 1, EAllowShrinking::No);
+		}
+		Sum -= Oldest;
+	}
+
+	Sorted.Insert(Value, Algo::UpperBound(Sorted, Value));
+	Sum += Value;
+}
+
+void FLBEASTRollingPercentile::Reset()
+{
+	Ring.Reset();
+	Sorted.Reset();
+	RingHead = 0;
+	Sum = 0.0;
+}
+
+float FLBEASTRollingPercentile::GetPercentile(float Fraction) const
+{
+	if (Sorted.Num() == 0)
+	{
+		return 0.0f;
+	}
+
+	// Linear interpolation between the closest ranks
+	const float Position = FMath::Clamp(Fraction, 0.0f, 1.0f) * (Sorted.Num() - 1);
+	const int32 Lower = FMath::FloorToInt32(Position);
+	const int32 Upper = FMath::Min(Lower + 1, Sorted.Num() - 1);
+	return FMath::Lerp(Sorted[Lower], Sorted[Upper], Position - Lower);
+}
+
+// =====================================
+// FLBEASTDeviceHealthRegistry
+// =====================================
+
+FLBEASTDeviceHealthRegistry& FLBEASTDeviceHealthRegistry::Get()
+{
+	static FLBEASTDeviceHealthRegistry Instance;
+	return Instance;
+}
+
+FLBEASTDeviceHealthRegistry::FLBEASTDeviceHealthRegistry()
+{
+	StartSeconds = FPlatformTime::Seconds();
+}
+
+int32 FLBEASTDeviceHealthRegistry::RegisterDevice(const FString& Name, const FString& Kind, const FLBEASTDeviceHealthConfig& Config)
+{
+	check(IsInGameThread());
+
+	// Names are Prometheus series identities; keep them unique
+	FString UniqueName = Name;
+	for (int32 Suffix = 2; Devices.ContainsByPredicate([&UniqueName](const FDevice& Device) { return Device.bActive && Device.Name == UniqueName; }); Suffix++)
+	{
+		UniqueName = FString::Printf(TEXT("%s #%d"), *Name, Suffix);
+	}
+
+	const int32 Index = FreeSlots.Num() > 0 ? FreeSlots.Pop(EAllowShrinking::No) : Devices.AddDefaulted();
+	checkf(Index < (1 << HandleIndexBits), TEXT("LBEASTDeviceHealth: more than %d concurrent devices"), 1 << HandleIndexBits);
+	FDevice& Device = Devices[Index];
+	Device.Name = UniqueName;
+	Device.Kind = Kind;
+	Device.Config = Config;
+	Device.bActive = true;
+	Device.RegisteredSeconds = FPlatformTime::Seconds();
+	Device.History.Reserve(HistorySize);
+
+	UE_LOG(LogTemp, Log, TEXT("LBEASTDeviceHealth: Registered '%s' (%s)"), *Device.Name, *Device.Kind);
+	return MakeHandle(Index, Device.Generation);
+}
+
+void FLBEASTDeviceHealthRegistry::UnregisterDevice(int32 Handle)
+{
+	check(IsInGameThread());
+
+	if (FDevice* Device = FindDevice(Handle))
+	{
+		UE_LOG(LogTemp, Log, TEXT("LBEASTDeviceHealth: Unregistered '%s'"), *Device->Name);
+
+		// Reuse the slot under a new generation so stale handles can never alias a newer device
+		const uint16 NextGeneration = (uint16)((Device->Generation + 1) & 0x7FFF);
+		*Device = FDevice();
+		Device->Generation = NextGeneration;
+		FreeSlots.Add(Handle & ((1 << HandleIndexBits) - 1));
+	}
+}
+
+FLBEASTDeviceHealthRegistry::FDevice* FLBEASTDeviceHealthRegistry::FindDevice(int32 Handle)
+{
+	return const_cast<FDevice*>(static_cast<const FLBEASTDeviceHealthRegistry*>(this)->FindDevice(Handle));
+}
+
+const FLBEASTDeviceHealthRegistry::FDevice* FLBEASTDeviceHealthRegistry::FindDevice(int32 Handle) const
+{
+	if (Handle < 0)
+	{
+		return nullptr;
+	}
+	const int32 Index = Handle & ((1 << HandleIndexBits) - 1);
+	if (!Devices.IsValidIndex(Index))
+	{
+		return nullptr;
+	}
+	const FDevice& Device = Devices[Index];
+	return Device.bActive && MakeHandle(Index, Device.Generation) == Handle ? &Device : nullptr;
+}
+
+void FLBEASTDeviceHealthRegistry::ReportPacket(int32 Handle, double ReceiveTimeSeconds, int64 Sequence, double SenderTimeSeconds)
+{
+	FDevice* Device = FindDevice(Handle);
+	if (!Device)
+	{
+		return;
+	}
+
+	const double Now = ReceiveTimeSeconds > 0.0 ? ReceiveTimeSeconds : FPlatformTime::Seconds();
+	const bool bHasPrevious = Device->LastSeenSeconds > 0.0;
+	const double Interarrival = bHasPrevious ? FMath::Max(Now - Device->LastSeenSeconds, 0.0) : -1.0;
+	const bool bHasSenderDelta = bHasPrevious && SenderTimeSeconds >= 0.0 && Device->PreviousSenderSeconds >= 0.0;
+
+	// Treat a gap longer than the timeout as a reconnect rather than a burst of loss
+	const bool bReconnect = bHasPrevious && Device->Config.TimeoutSeconds > 0.0f && Interarrival >= Device->Config.TimeoutSeconds;
+
+	// Loss
+	int64 Lost = 0;
+	if (Sequence >= 0)
+	{
+		const int64 Gap = Device->NextSequence >= 0 ? Sequence - Device->NextSequence : 0;
+		if (Gap >= 0 || Gap < -MaxSequenceGap)
+		{
+			Lost = (Gap > 0 && Gap <= MaxSequenceGap) ? Gap : 0;
+			Device->NextSequence = Sequence + 1;
+		}
+		else if (Device->PacketsLost > 0)
+		{
+			// Late arrival of a packet already counted as lost
+			Lost = -1;
+		}
+	}
+	else if (bHasPrevious && !bReconnect && Device->Config.ExpectedIntervalSeconds > 0.0f)
+	{
+		const double Elapsed = bHasSenderDelta ? SenderTimeSeconds - Device->PreviousSenderSeconds : Interarrival;
+		Lost = FMath::Clamp<int64>(FMath::RoundToInt64(Elapsed / Device->Config.ExpectedIntervalSeconds) - 1, 0, MaxSequenceGap);
+	}
+	Device->PacketsLost += Lost;
+	Device->IntervalLost += (int32)Lost;
+
+	// Interarrival jitter (RFC 3550 6.4.1)
+	if (bHasPrevious && !bReconnect)
+	{
+		// Transit-time difference with sender timestamps, interarrival variation without
+		if (bHasSenderDelta || Device->PreviousInterarrival >= 0.0)
+		{
+			const double Deviation = bHasSenderDelta
+				? Interarrival - (SenderTimeSeconds - Device->PreviousSenderSeconds)
+				: Interarrival - Device->PreviousInterarrival;
+			Device->JitterSeconds += (FMath::Abs(Deviation) - Device->JitterSeconds) / 16.0;
+		}
+		Device->Interval.Add((float)(Interarrival * 1000.0));
+	}
+
+	Device->PreviousInterarrival = bReconnect ? -1.0 : Interarrival;
+	Device->PreviousSenderSeconds = SenderTimeSeconds;
+	Device->LastSeenSeconds = Now;
+	Device->PacketsReceived++;
+	Device->IntervalReceived++;
+}
+
+void FLBEASTDeviceHealthRegistry::ReportRoundTrip(int32 Handle, float RttMs)
+{
+	if (FDevice* Device = FindDevice(Handle))
+	{
+		if (FMath::IsFinite(RttMs) && RttMs >= 0.0f)
+		{
+			Device->Rtt.Add(RttMs);
+			Device->RttCount++;
+			Device->RttSumMs += RttMs;
+		}
+	}
+}
+
+void FLBEASTDeviceHealthRegistry::ReportTemperature(int32 Handle, FName Sensor, float Celsius)
+{
+	if (FDevice* Device = FindDevice(Handle))
+	{
+		Device->Temperatures.Add(Sensor, Celsius);
+	}
+}
+
+void FLBEASTDeviceHealthRegistry::SetCondition(int32 Handle, FName Condition, bool bActive)
+{
+	if (FDevice* Device = FindDevice(Handle))
+	{
+		if (bActive)
+		{
+			Device->Conditions.AddUnique(Condition);
+		}
+		else
+		{
+			Device->Conditions.Remove(Condition);
+		}
+	}
+}
+
+void FLBEASTDeviceHealthRegistry::SetLinkUp(int32 Handle, bool bLinkUp)
+{
+	if (FDevice* Device = FindDevice(Handle))
+	{
+		Device->bLinkUp = bLinkUp;
+	}
+}
+
+void FLBEASTDeviceHealthRegistry::Tick(double NowSeconds)
+{
+	LBEASTCORE_SCOPE_CYCLE_COUNTER(STAT_LBEASTHealth_Tick);
+
+	if (NowSeconds >= NextEvaluateSeconds)
+	{
+		NextEvaluateSeconds = NowSeconds + EvaluateIntervalSeconds;
+
+		int32 Unhealthy = 0;
+
+		// Index loop: listeners may register devices while we broadcast
+		for (int32 Handle = 0; Handle < Devices.Num(); Handle++)
+		{
+			if (!Devices[Handle].bActive)
+			{
+				continue;
+			}
+
+			const ELBEASTDeviceHealthState PreviousState = Devices[Handle].State;
+			if (Evaluate(Devices[Handle], NowSeconds))
+			{
+				FLBEASTDeviceHealthStatus Status;
+				FillStatus(Devices[Handle], NowSeconds, Status);
+				HealthChanged.Broadcast(Status, PreviousState);
+			}
+
+			if (Devices[Handle].bActive && Devices[Handle].State != ELBEASTDeviceHealthState::Healthy)
+			{
+				Unhealthy++;
+			}
+		}
+
+		LBEASTCORE_SET_GAUGE(STAT_LBEASTHealth_UnhealthyDevices, Unhealthy);
+	}
+
+	if (NowSeconds >= NextSampleSeconds)
+	{
+		NextSampleSeconds = NowSeconds + SampleIntervalSeconds;
+		for (FDevice& Device : Devices)
+		{
+			if (Device.bActive)
+			{
+				TakeSample(Device, NowSeconds);
+			}
+		}
+	}
+}
+
+bool FLBEASTDeviceHealthRegistry::Evaluate(FDevice& Device, double NowSeconds)
+{
+	const FLBEASTDeviceHealthConfig& Config = Device.Config;
+	const bool bSeen = Device.LastSeenSeconds > 0.0;
+	const double Silence = NowSeconds - (bSeen ? Device.LastSeenSeconds : Device.RegisteredSeconds);
+
+	// Warn after a few missed packets at the device's usual rate, never later than the configured fraction
+	double WarningAfter = Config.TimeoutSeconds * Config.EarlyWarningFraction;
+	if (Device.Interval.Num() >= MinIntervalSamples)
+	{
+		const double UsualInterval = Device.Interval.GetPercentile(0.99f) / 1000.0;
+		WarningAfter = FMath::Min(WarningAfter, FMath::Max(UsualInterval * Config.MissedIntervalsWarning, MinWarningSeconds));
+	}
+
+	ELBEASTDeviceHealthState NewState = ELBEASTDeviceHealthState::Healthy;
+	FString Reason;
+
+	if (!Device.bLinkUp)
+	{
+		NewState = ELBEASTDeviceHealthState::TimedOut;
+		Reason = TEXT("Link down");
+	}
+	else if (Config.TimeoutSeconds > 0.0f && Silence >= Config.TimeoutSeconds)
+	{
+		NewState = ELBEASTDeviceHealthState::TimedOut;
+		Reason = bSeen ? FString::Printf(TEXT("No data for %.1fs"), Silence) : TEXT("Never responded");
+	}
+	else if (!bSeen)
+	{
+		NewState = ELBEASTDeviceHealthState::Unknown;
+	}
+	else if (Config.TimeoutSeconds > 0.0f && Silence >= WarningAfter)
+	{
+		NewState = ELBEASTDeviceHealthState::Stale;
+		Reason = FString::Printf(TEXT("No data for %.2fs (timeout %.1fs)"), Silence, Config.TimeoutSeconds);
+	}
+	else
+	{
+		TArray<FString> Problems;
+		for (const FName& Condition : Device.Conditions)
+		{
+			Problems.Add(Condition.ToString());
+		}
+
+		const float LossPercent = GetRecentLossPercent(Device);
+		if (Config.MaxLossPercent > 0.0f && LossPercent > Config.MaxLossPercent)
+		{
+			Problems.Add(FString::Printf(TEXT("Loss %.1f%%"), LossPercent));
+		}
+
+		const float JitterMs = (float)(Device.JitterSeconds * 1000.0);
+		if (Config.MaxJitterMs > 0.0f && JitterMs > Config.MaxJitterMs)
+		{
+			Problems.Add(FString::Printf(TEXT("Jitter %.1fms"), JitterMs));
+		}
+
+		const float RttP95Ms = Device.Rtt.GetPercentile(0.95f);
+		if (Config.MaxRttMs > 0.0f && RttP95Ms > Config.MaxRttMs)
+		{
+			Problems.Add(FString::Printf(TEXT("RTT p95 %.1fms"), RttP95Ms));
+		}
+
+		const float MaxTemperature = GetMaxTemperature(Device);
+		if (Config.MaxTemperatureC > 0.0f && MaxTemperature > Config.MaxTemperatureC)
+		{
+			Problems.Add(FString::Printf(TEXT("Temperature %.1fC"), MaxTemperature));
+		}
+
+		if (Problems.Num() > 0)
+		{
+			NewState = ELBEASTDeviceHealthState::Degraded;
+			Reason = FString::Join(Problems, TEXT("; "));
+		}
+	}
+
+	Device.Reason = Reason;
+	if (NewState == Device.State)
+	{
+		return false;
+	}
+
+	if (NewState == ELBEASTDeviceHealthState::Healthy)
+	{
+		UE_LOG(LogTemp, Log, TEXT("LBEASTDeviceHealth: '%s' %s -> Healthy"), *Device.Name, StateToString(Device.State));
+	}
+	else if (NewState != ELBEASTDeviceHealthState::Unknown)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("LBEASTDeviceHealth: '%s' %s -> %s (%s)"), *Device.Name, StateToString(Device.State), StateToString(NewState), *Reason);
+	}
+
+	Device.State = NewState;
+	return true;
+}
+
+void FLBEASTDeviceHealthRegistry::TakeSample(FDevice& Device, double NowSeconds)
+{
+	FLBEASTDeviceHealthSample Sample;
+	Sample.TimeSeconds = (float)(NowSeconds - StartSeconds);
+	Sample.PacketsReceived = Device.IntervalReceived;
+	Sample.PacketsLost = FMath::Max(Device.IntervalLost, 0);
+	Sample.RttP50Ms = Device.Rtt.GetPercentile(0.5f);
+	Sample.JitterMs = (float)(Device.JitterSeconds * 1000.0);
+	Sample.MaxTemperatureC = GetMaxTemperature(Device);
+	Sample.SecondsSinceSeen = Device.LastSeenSeconds > 0.0 ? (float)(NowSeconds - Device.LastSeenSeconds) : -1.0f;
+	Sample.State = Device.State;
+
+	if (Device.History.Num() < HistorySize)
+	{
+		Device.History.Add(Sample);
+	}
+	else if (HistorySize > 0)
+	{
+		Device.History[Device.HistoryHead] = Sample;
+		Device.HistoryHead = (Device.HistoryHead + 1) % HistorySize;
+	}
+
+	Device.IntervalReceived = 0;
+	Device.IntervalLost = 0;
+}
+
+float FLBEASTDeviceHealthRegistry::GetRecentLossPercent(const FDevice& Device) const
+{
+	int64 Received = Device.IntervalReceived;
+	int64 Lost = FMath::Max(Device.IntervalLost, 0);
+
+	const int32 Count = Device.History.Num();
+	const int32 Newest = Count < HistorySize ? Count - 1 : (Device.HistoryHead - 1 + Count) % Count;
+	for (int32 i = 0; i < FMath::Min(Count, LossWindowSamples); i++)
+	{
+		const FLBEASTDeviceHealthSample& Sample = Device.History[(Newest - i + Count) % Count];
+		Received += Sample.PacketsReceived;
+		Lost += Sample.PacketsLost;
+	}
+
+	return Received + Lost > 0 ? (float)(100.0 * Lost / (Received + Lost)) : 0.0f;
+}
+
+float FLBEASTDeviceHealthRegistry::GetMaxTemperature(const FDevice& Device) const
+{
+	float Max = 0.0f;
+	for (const TPair<FName, float>& Temperature : Device.Temperatures)
+	{
+		Max = FMath::Max(Max, Temperature.Value);
+	}
+	return Max;
+}
+
+void FLBEASTDeviceHealthRegistry::FillStatus(const FDevice& Device, double NowSeconds, FLBEASTDeviceHealthStatus& OutStatus) const
+{
+	OutStatus.DeviceName = Device.Name;
+	OutStatus.Kind = Device.Kind;
+	OutStatus.State = Device.State;
+	OutStatus.Reason = Device.Reason;
+	OutStatus.SecondsSinceSeen = Device.LastSeenSeconds > 0.0 ? (float)(NowSeconds - Device.LastSeenSeconds) : -1.0f;
+	OutStatus.PacketsReceived = Device.PacketsReceived;
+	OutStatus.PacketsLost = FMath::Max<int64>(Device.PacketsLost, 0);
+	OutStatus.LossPercent = GetRecentLossPercent(Device);
+	OutStatus.JitterMs = (float)(Device.JitterSeconds * 1000.0);
+	OutStatus.RttP50Ms = Device.Rtt.GetPercentile(0.5f);
+	OutStatus.RttP95Ms = Device.Rtt.GetPercentile(0.95f);
+	OutStatus.RttP99Ms = Device.Rtt.GetPercentile(0.99f);
+	OutStatus.IntervalP50Ms = Device.Interval.GetPercentile(0.5f);
+	OutStatus.IntervalP99Ms = Device.Interval.GetPercentile(0.99f);
+	OutStatus.Temperatures = Device.Temperatures;
+	OutStatus.ActiveConditions = Device.Conditions;
+}
+
+bool FLBEASTDeviceHealthRegistry::GetStatus(int32 Handle, FLBEASTDeviceHealthStatus& OutStatus) const
+{
+	if (const FDevice* Device = FindDevice(Handle))
+	{
+		FillStatus(*Device, FPlatformTime::Seconds(), OutStatus);
+		return true;
+	}
+	return false;
+}
+
+bool FLBEASTDeviceHealthRegistry::FindStatus(const FString& Name, FLBEASTDeviceHealthStatus& OutStatus) const
+{
+	for (const FDevice& Device : Devices)
+	{
+		if (Device.bActive && Device.Name == Name)
+		{
+			FillStatus(Device, FPlatformTime::Seconds(), OutStatus);
+			return true;
+		}
+	}
+	return false;
+}
+
+void FLBEASTDeviceHealthRegistry::GetAllStatus(TArray<FLBEASTDeviceHealthStatus>& OutStatus) const
+{
+	const double Now = FPlatformTime::Seconds();
+	OutStatus.Reset();
+	for (const FDevice& Device : Devices)
+	{
+		if (Device.bActive)
+		{
+			FillStatus(Device, Now, OutStatus.AddDefaulted_GetRef());
+		}
+	}
+}
+
+bool FLBEASTDeviceHealthRegistry::GetHistory(const FString& Name, TArray<FLBEASTDeviceHealthSample>& OutSamples) const
+{
+	OutSamples.Reset();
+	for (const FDevice& Device : Devices)
+	{
+		if (Device.bActive && Device.Name == Name)
+		{
+			const int32 Count = Device.History.Num();
+			const int32 Oldest = Count < HistorySize ? 0 : Device.HistoryHead;
+			OutSamples.Reserve(Count);
+			for (int32 i = 0; i < Count; i++)
+			{
+				OutSamples.Add(Device.History[(Oldest + i) % Count]);
+			}
+			return true;
+		}
+	}
+	return false;
+}
+
+FString FLBEASTDeviceHealthRegistry::ExportPrometheus() const
+{
+	const double Now = FPlatformTime::Seconds();
+
+	TArray<const FDevice*> Active;
+	TArray<FString> Labels;
+	for (const FDevice& Device : Devices)
+	{
+		if (Device.bActive)
+		{
+			Active.Add(&Device);
+			Labels.Add(FString::Printf(TEXT("device=\"%s\",kind=\"%s\""), *EscapeLabel(Device.Name), *EscapeLabel(Device.Kind)));
+		}
+	}
+
+	FString Out;
+	Out.Reserve(1024 + Active.Num() * 1024);
+
+	AppendFamily(Out, TEXT("lbeast_device_up"), TEXT("gauge"), TEXT("1 if the device is Healthy or Degraded"));
+	for (int32 i = 0; i < Active.Num(); i++)
+	{
+		const bool bUp = Active[i]->State == ELBEASTDeviceHealthState::Healthy || Active[i]->State == ELBEASTDeviceHealthState::Degraded;
+		Out += FString::Printf(TEXT("lbeast_device_up{%s} %d\n"), *Labels[i], bUp ? 1 : 0);
+	}
+
+	AppendFamily(Out, TEXT("lbeast_device_health_state"), TEXT("gauge"), TEXT("0 Unknown, 1 Healthy, 2 Degraded, 3 Stale, 4 TimedOut"));
+	for (int32 i = 0; i < Active.Num(); i++)
+	{
+		Out += FString::Printf(TEXT("lbeast_device_health_state{%s} %d\n"), *Labels[i], (int32)Active[i]->State);
+	}
+
+	AppendFamily(Out, TEXT("lbeast_device_last_seen_seconds"), TEXT("gauge"), TEXT("Seconds since the last packet (-1 if never seen)"));
+	for (int32 i = 0; i < Active.Num(); i++)
+	{
+		const double SinceSeen = Active[i]->LastSeenSeconds > 0.0 ? Now - Active[i]->LastSeenSeconds : -1.0;
+		Out += FString::Printf(TEXT("lbeast_device_last_seen_seconds{%s} %.3f\n"), *Labels[i], SinceSeen);
+	}
+
+	AppendFamily(Out, TEXT("lbeast_device_packets_received_total"), TEXT("counter"), TEXT("Packets received"));
+	for (int32 i = 0; i < Active.Num(); i++)
+	{
+		Out += FString::Printf(TEXT("lbeast_device_packets_received_total{%s} %lld\n"), *Labels[i], Active[i]->PacketsReceived);
+	}
+
+	AppendFamily(Out, TEXT("lbeast_device_packets_lost_total"), TEXT("counter"), TEXT("Packets detected missing (sequence or timing gaps)"));
+	for (int32 i = 0; i < Active.Num(); i++)
+	{
+		Out += FString::Printf(TEXT("lbeast_device_packets_lost_total{%s} %lld\n"), *Labels[i], FMath::Max<int64>(Active[i]->PacketsLost, 0));
+	}
+
+	AppendFamily(Out, TEXT("lbeast_device_packet_loss_ratio"), TEXT("gauge"), TEXT("Recent packet loss (0-1)"));
+	for (int32 i = 0; i < Active.Num(); i++)
+	{
+		Out += FString::Printf(TEXT("lbeast_device_packet_loss_ratio{%s} %.4f\n"), *Labels[i], GetRecentLossPercent(*Active[i]) / 100.0f);
+	}
+
+	AppendFamily(Out, TEXT("lbeast_device_jitter_seconds"), TEXT("gauge"), TEXT("RFC 3550 interarrival jitter"));
+	for (int32 i = 0; i < Active.Num(); i++)
+	{
+		Out += FString::Printf(TEXT("lbeast_device_jitter_seconds{%s} %.6f\n"), *Labels[i], Active[i]->JitterSeconds);
+	}
+
+	AppendFamily(Out, TEXT("lbeast_device_rtt_seconds"), TEXT("summary"), TEXT("Request/reply round trip time"));
+	for (int32 i = 0; i < Active.Num(); i++)
+	{
+		const FDevice& Device = *Active[i];
+		if (Device.RttCount == 0)
+		{
+			continue;
+		}
+		for (const float Quantile : { 0.5f, 0.95f, 0.99f })
+		{
+			Out += FString::Printf(TEXT("lbeast_device_rtt_seconds{%s,quantile=\"%g\"} %.6f\n"), *Labels[i], Quantile, Device.Rtt.GetPercentile(Quantile) / 1000.0f);
+		}
+		Out += FString::Printf(TEXT("lbeast_device_rtt_seconds_sum{%s} %.6f\n"), *Labels[i], Device.RttSumMs / 1000.0);
+		Out += FString::Printf(TEXT("lbeast_device_rtt_seconds_count{%s} %lld\n"), *Labels[i], Device.RttCount);
+	}
+
+	AppendFamily(Out, TEXT("lbeast_device_temperature_celsius"), TEXT("gauge"), TEXT("Latest temperature reading per sensor"));
+	for (int32 i = 0; i < Active.Num(); i++)
+	{
+		for (const TPair<FName, float>& Temperature : Active[i]->Temperatures)
+		{
+			Out += FString::Printf(TEXT("lbeast_device_temperature_celsius{%s,sensor=\"%s\"} %.2f\n"), *Labels[i], *EscapeLabel(Temperature.Key.ToString()), Temperature.Value);
+		}
+	}
+
+	AppendFamily(Out, TEXT("lbeast_device_condition_active"), TEXT("gauge"), TEXT("Fault conditions currently reported by the device"));
+	for (int32 i = 0; i < Active.Num(); i++)
+	{
+		for (const FName& Condition : Active[i]->Conditions)
+		{
+			Out += FString::Printf(TEXT("lbeast_device_condition_active{%s,condition=\"%s\"} 1\n"), *Labels[i], *EscapeLabel(Condition.ToString()));
+		}
+	}
+
+	return Out;
+}
+
+// =====================================
+// ULBEASTDeviceHealthSubsystem
+// =====================================
+
+ULBEASTDeviceHealthSubsystem* ULBEASTDeviceHealthSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<ULBEASTDeviceHealthSubsystem>() : nullptr;
+}
+
+void ULBEASTDeviceHealthSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	HealthChangedHandle = FLBEASTDeviceHealthRegistry::Get().OnHealthChanged().AddUObject(this, &ULBEASTDeviceHealthSubsystem::HandleHealthChanged);
+
+	FParse::Value(FCommandLine::Get(), TEXT("LBEASTMetricsPort="), MetricsPort);
+	if (MetricsPort > 0)
+	{
+		StartMetricsEndpoint();
+	}
+}
+
+void ULBEASTDeviceHealthSubsystem::Deinitialize()
+{
+	FLBEASTDeviceHealthRegistry::Get().OnHealthChanged().Remove(HealthChangedHandle);
+	StopMetricsEndpoint();
+
+	Super::Deinitialize();
+}
+
+TArray<FLBEASTDeviceHealthStatus> ULBEASTDeviceHealthSubsystem::GetAllDeviceHealth() const
+{
+	TArray<FLBEASTDeviceHealthStatus> Status;
+	FLBEASTDeviceHealthRegistry::Get().GetAllStatus(Status);
+	return Status;
+}
+
+bool ULBEASTDeviceHealthSubsystem::GetDeviceHealth(const FString& DeviceName, FLBEASTDeviceHealthStatus& OutStatus) const
+{
+	return FLBEASTDeviceHealthRegistry::Get().FindStatus(DeviceName, OutStatus);
+}
+
+TArray<FLBEASTDeviceHealthSample> ULBEASTDeviceHealthSubsystem::GetDeviceHistory(const FString& DeviceName) const
+{
+	TArray<FLBEASTDeviceHealthSample> Samples;
+	FLBEASTDeviceHealthRegistry::Get().GetHistory(DeviceName, Samples);
+	return Samples;
+}
+
+void ULBEASTDeviceHealthSubsystem::HandleHealthChanged(const FLBEASTDeviceHealthStatus& Status, ELBEASTDeviceHealthState PreviousState)
+{
+	OnDeviceHealthChanged.Broadcast(Status, PreviousState);
+
+	if (Status.State == ELBEASTDeviceHealthState::Degraded || Status.State == ELBEASTDeviceHealthState::Stale)
+	{
+		OnDeviceHealthWarning.Broadcast(Status.DeviceName, Status.Reason);
+	}
+}
+
+void ULBEASTDeviceHealthSubsystem::Tick(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	// Every game instance ticks the shared registry; it only does work when due
+	FLBEASTDeviceHealthRegistry::Get().Tick(Now);
+
+	if (MetricsListenSocket)
+	{
+		ServiceMetricsEndpoint(Now);
+	}
+}
+
+TStatId ULBEASTDeviceHealthSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(ULBEASTDeviceHealthSubsystem, STATGROUP_Tickables);
+}
+
+bool ULBEASTDeviceHealthSubsystem::StartMetricsEndpoint()
+{
+	const FIPv4Address BindAddress = bMetricsOnAllInterfaces ? FIPv4Address::Any : FIPv4Address(127, 0, 0, 1);
+
+	MetricsListenSocket = FTcpSocketBuilder(TEXT("LBEAST_Metrics"))
+		.AsReusable()
+		.AsNonBlocking()
+		.BoundToAddress(BindAddress)
+		.BoundToPort(MetricsPort)
+		.Listening(8)
+		.Build();
+
+	if (!MetricsListenSocket)
+	{
+		// Expected for the second game instance in multi-client PIE
+		UE_LOG(LogTemp, Warning, TEXT("LBEASTDeviceHealth: Could not listen for metrics on port %d"), MetricsPort);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("LBEASTDeviceHealth: Serving Prometheus metrics on http://%s:%d/metrics"), *BindAddress.ToString(), MetricsPort);
+	return true;
+}
+
+void ULBEASTDeviceHealthSubsystem::StopMetricsEndpoint()
+{
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+
+	for (FMetricsConnection& Connection : MetricsConnections)
+	{
+		Connection.Socket->Close();
+		SocketSubsystem->DestroySocket(Connection.Socket);
+	}
+	MetricsConnections.Empty();
+
+	if (MetricsListenSocket)
+	{
+		MetricsListenSocket->Close();
+		SocketSubsystem->DestroySocket(MetricsListenSocket);
+		MetricsListenSocket = nullptr;
+	}
+}
+
+void ULBEASTDeviceHealthSubsystem::ServiceMetricsEndpoint(double NowSeconds)
+{
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+
+	bool bPending = false;
+	while (MetricsConnections.Num() < MaxMetricsConnections && MetricsListenSocket->HasPendingConnection(bPending) && bPending)
+	{
+		FSocket* Client = MetricsListenSocket->Accept(TEXT("LBEAST_MetricsClient"));
+		if (!Client)
+		{
+			break;
+		}
+		Client->SetNonBlocking(true);
+
+		FMetricsConnection& Connection = MetricsConnections.AddDefaulted_GetRef();
+		Connection.Socket = Client;
+		Connection.DeadlineSeconds = NowSeconds + MetricsRequestTimeoutSeconds;
+	}
+
+	for (int32 i = MetricsConnections.Num() - 1; i >= 0; i--)
+	{
+		FMetricsConnection& Connection = MetricsConnections[i];
+		if (ServiceMetricsConnection(Connection, NowSeconds) || NowSeconds > Connection.DeadlineSeconds)
+		{
+			Connection.Socket->Close();
+			SocketSubsystem->DestroySocket(Connection.Socket);
+			MetricsConnections.RemoveAtSwap(i);
+		}
+	}
+}
+
+bool ULBEASTDeviceHealthSubsystem::ServiceMetricsConnection(FMetricsConnection& Connection, double NowSeconds)
+{
+	if (!Connection.bResponding)
+	{
+		uint32 PendingBytes = 0;
+		while (Connection.Socket->HasPendingData(PendingBytes) && PendingBytes > 0)
+		{
+			uint8 Chunk[1024];
+			int32 BytesRead = 0;
+			if (!Connection.Socket->Recv(Chunk, sizeof(Chunk), BytesRead) || BytesRead <= 0)
+			{
+				break;
+			}
+			Connection.Request.Append(Chunk, BytesRead);
+			if (Connection.Request.Num() > MaxMetricsRequestBytes)
+			{
+				return true;
+			}
+		}
+
+		// Wait for the end of the request headers
+		const FUTF8ToTCHAR Converted((const ANSICHAR*)Connection.Request.GetData(), Connection.Request.Num());
+		const FString Request(Converted.Length(), Converted.Get());
+		if (!Request.Contains(TEXT("\r\n\r\n")))
+		{
+			return false;
+		}
+
+		const bool bMetrics = Request.StartsWith(TEXT("GET /metrics ")) || Request.StartsWith(TEXT("GET /metrics?"));
+		const FString Body = bMetrics ? FLBEASTDeviceHealthRegistry::Get().ExportPrometheus() : FString(TEXT("Not Found\n"));
+		const FTCHARToUTF8 BodyUtf8(*Body);
+
+		const FString Header = FString::Printf(TEXT("HTTP/1.1 %s\r\nContent-Type: %s\r\nContent-Length: %d\r\nConnection: close\r\n\r\n"),
+			bMetrics ? TEXT("200 OK") : TEXT("404 Not Found"),
+			bMetrics ? TEXT("text/plain; version=0.0.4; charset=utf-8") : TEXT("text/plain; charset=utf-8"),
+			BodyUtf8.Length());
+		const FTCHARToUTF8 HeaderUtf8(*Header);
+
+		Connection.Response.Reset(HeaderUtf8.Length() + BodyUtf8.Length());
+		Connection.Response.Append((const uint8*)HeaderUtf8.Get(), HeaderUtf8.Length());
+		Connection.Response.Append((const uint8*)BodyUtf8.Get(), BodyUtf8.Length());
+		Connection.ResponseBytesSent = 0;
+		Connection.bResponding = true;
+
+		// A slow scraper gets a fresh timeout to drain the response
+		Connection.DeadlineSeconds = NowSeconds + MetricsRequestTimeoutSeconds;
+
+		if (bMetrics)
+		{
+			LBEASTCORE_INC_COUNTER(STAT_LBEASTHealth_MetricsScrapes, 1);
+		}
+	}
+
+	// Non-blocking: send what the socket takes now and keep the rest for the next tick
+	while (Connection.ResponseBytesSent < Connection.Response.Num())
+	{
+		int32 BytesSent = 0;
+		if (!Connection.Socket->Send(Connection.Response.GetData() + Connection.ResponseBytesSent, Connection.Response.Num() - Connection.ResponseBytesSent, BytesSent))
+		{
+			// Would-block leaves the connection open; anything else drops it
+			return ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode() != SE_EWOULDBLOCK;
+		}
+		if (BytesSent <= 0)
+		{
+			return false;
+		}
+		Connection.ResponseBytesSent += BytesSent;
+	}
+	return true;
+}
@@ -3,6 +3,9 @@
 #include "Input/LBEASTInputAdapter.h"
 #include "LBEASTEmbeddedDeviceInterface.h"
 #include "Net/UnrealNetwork.h"
+#include "LBEASTCore.h"
+
+DECLARE_CYCLE_STAT(TEXT("LBEASTInputAdapter Tick"), STAT_LBEASTInputAdapter_Tick, STATGROUP_LBEASTCore);
 
 ULBEASTInputAdapter::ULBEASTInputAdapter()
 {
@@ -31,6 +34,7 @@ void ULBEASTInputAdapter::BeginPlay()
 void ULBEASTInputAdapter::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	LBEASTCORE_SCOPE_CYCLE_COUNTER(STAT_LBEASTInputAdapter_Tick);
 
 	// Only process input on authority (server or listen server host)
 	if (GetOwner()->HasAuthority())
@@ -1,6 +1,9 @@
 // Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
 
 #include "LBEASTCore.h"
+#include "Networking/LBEASTSafetyLane.h"
+
+LBEAST_DEFINE_TRACE_CHANNEL(LBEASTCoreChannel);
 
 #define LOCTEXT_NAMESPACE "FLBEASTCoreModule"
 
@@ -14,6 +17,7 @@ void FLBEASTCoreModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FLBEASTSafetyLane::Get().Shutdown();
 	UE_LOG(LogTemp, Log, TEXT("LBEAST Core Module: Shutdown"));
 }
 
@@ -11,6 +11,10 @@
 #include "GameFramework/Actor.h"
 #include "HeadMountedDisplayTypes.h"
 #include "Features/IModularFeatures.h"
+#include "LBEASTCore.h"
+
+DECLARE_CYCLE_STAT(TEXT("LBEASTHandGestureRecognizer Tick"), STAT_LBEASTHandGestureRecognizer_Tick, STATGROUP_LBEASTCore);
+DECLARE_CYCLE_STAT(TEXT("Detect Hand Gesture"), STAT_LBEASTHandGesture_Detect, STATGROUP_LBEASTCore);
 
 ULBEASTHandGestureRecognizer::ULBEASTHandGestureRecognizer()
 {
@@ -42,6 +46,7 @@ void ULBEASTHandGestureRecognizer::BeginPlay()
 void ULBEASTHandGestureRecognizer::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	LBEASTCORE_SCOPE_CYCLE_COUNTER(STAT_LBEASTHandGestureRecognizer_Tick);
 
 	UpdateTimer += DeltaTime;
 	float UpdateInterval = 1.0f / UpdateRate;
@@ -300,6 +305,8 @@ void ULBEASTHandGestureRecognizer::UpdateGestureRecognition(float DeltaTime)
 
 ELBEASTHandGesture ULBEASTHandGestureRecognizer::DetectGesture(bool bLeftHand) const
 {
+	LBEASTCORE_SCOPE_CYCLE_COUNTER(STAT_LBEASTHandGesture_Detect);
+
 	// For now, just detect fist vs open hand
 	// Future: Add more gesture recognition (pointing, thumbs up, peace sign, etc.)
 	
@@ -0,0 +1,153 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "LBEASTStats.h"
+
+std::atomic<FLBEASTPerfStat*> FLBEASTPerfStat::Head{nullptr};
+
+namespace
+{
+	TArray<FLBEASTPerfSample> LatestSamples;
+	double LastSampleSeconds = 0.0;
+}
+
+FString FLBEASTPerfSample::ToDisplayString() const
+{
+	switch (Type)
+	{
+		case ELBEASTPerfStatType::Timer:
+			return FString::Printf(TEXT("%-36s %7.0f/s  avg %6.3f ms  max %6.3f ms"), *Name, Rate, AverageMs, MaxMs);
+		case ELBEASTPerfStatType::Counter:
+			return FString::Printf(TEXT("%-36s %9.0f/s"), *Name, Rate);
+		case ELBEASTPerfStatType::Gauge:
+		default:
+			return FString::Printf(TEXT("%-36s %9.0f"), *Name, Rate);
+	}
+}
+
+FLBEASTPerfStat::FLBEASTPerfStat(const TCHAR* InName, const TCHAR* InGroup, ELBEASTPerfStatType InType)
+	: Name(InName)
+	, Group(InGroup)
+	, Type(InType)
+{
+	// Lock-free push; stats are never unregistered (they are statics)
+	FLBEASTPerfStat* OldHead = Head.load(std::memory_order_relaxed);
+	do
+	{
+		Next = OldHead;
+	}
+	while (!Head.compare_exchange_weak(OldHead, this, std::memory_order_release, std::memory_order_relaxed));
+}
+
+const TArray<FLBEASTPerfSample>& FLBEASTPerfStat::Sample(double MinWindowSeconds)
+{
+	check(IsInGameThread());
+
+	const double Now = FPlatformTime::Seconds();
+	const double Window = Now - LastSampleSeconds;
+	if (LastSampleSeconds > 0.0 && Window < MinWindowSeconds)
+	{
+		return LatestSamples;
+	}
+
+	const bool bFirstSample = LastSampleSeconds <= 0.0;
+	LastSampleSeconds = Now;
+	LatestSamples.Reset();
+
+	// The same stat can be instrumented at more than one site; merge by name
+	TMap<FString, int32> IndexByName;
+
+	for (FLBEASTPerfStat* Stat = Head.load(std::memory_order_acquire); Stat; Stat = Stat->Next)
+	{
+		const uint64 Calls = Stat->Calls.load(std::memory_order_relaxed);
+		const uint64 TotalCycles = Stat->TotalCycles.load(std::memory_order_relaxed);
+		const uint64 MaxCycles = Stat->MaxCycles.exchange(0, std::memory_order_relaxed);
+		const int64 Value = Stat->Value.load(std::memory_order_relaxed);
+
+		const uint64 DeltaCalls = Calls - Stat->LastCalls;
+		const uint64 DeltaCycles = TotalCycles - Stat->LastTotalCycles;
+		const int64 DeltaValue = Value - Stat->LastValue;
+		Stat->LastCalls = Calls;
+		Stat->LastTotalCycles = TotalCycles;
+		Stat->LastValue = Value;
+
+		if (bFirstSample)
+		{
+			// No window yet; just establish the baseline
+			continue;
+		}
+
+		FString StatName = Stat->Name;
+		StatName.RemoveFromStart(TEXT("STAT_"));
+
+		FLBEASTPerfSample* Entry = nullptr;
+		if (const int32* ExistingIndex = IndexByName.Find(StatName))
+		{
+			Entry = &LatestSamples[*ExistingIndex];
+		}
+		else
+		{
+			const int32 NewIndex = LatestSamples.AddDefaulted();
+			Entry = &LatestSamples[NewIndex];
+			Entry->Name = StatName;
+			Entry->Group = Stat->Group;
+			Entry->Type = Stat->Type;
+			IndexByName.Add(MoveTemp(StatName), NewIndex);
+		}
+
+		switch (Stat->Type)
+		{
+			case ELBEASTPerfStatType::Timer:
+			{
+				// Accumulate totals in AverageMs, then divide by calls below
+				const double TotalMs = FPlatformTime::ToMilliseconds64(DeltaCycles);
+				Entry->AverageMs += (float)TotalMs;
+				Entry->Rate += (float)((double)DeltaCalls / Window);
+				Entry->MaxMs = FMath::Max(Entry->MaxMs, (float)FPlatformTime::ToMilliseconds64(MaxCycles));
+				break;
+			}
+			case ELBEASTPerfStatType::Counter:
+				Entry->Rate += (float)((double)DeltaValue / Window);
+				break;
+			case ELBEASTPerfStatType::Gauge:
+				Entry->Rate += (float)Value;
+				break;
+		}
+	}
+
+	for (FLBEASTPerfSample& Entry : LatestSamples)
+	{
+		if (Entry.Type == ELBEASTPerfStatType::Timer)
+		{
+			const double CallsInWindow = (double)Entry.Rate * Window;
+			Entry.AverageMs = CallsInWindow > 0.0 ? (float)(Entry.AverageMs / CallsInWindow) : 0.0f;
+		}
+	}
+
+	return LatestSamples;
+}
+
+void FLBEASTPerfStat::GetTopSamples(int32 MaxSamples, TArray<FLBEASTPerfSample>& OutSamples, double MinWindowSeconds)
+{
+	OutSamples = Sample(MinWindowSeconds);
+
+	OutSamples.Sort([](const FLBEASTPerfSample& A, const FLBEASTPerfSample& B)
+	{
+		// Timers first (ranked by time spent per second), then counters/gauges by rate
+		const bool bATimer = A.Type == ELBEASTPerfStatType::Timer;
+		const bool bBTimer = B.Type == ELBEASTPerfStatType::Timer;
+		if (bATimer != bBTimer)
+		{
+			return bATimer;
+		}
+		if (bATimer)
+		{
+			return A.AverageMs * A.Rate > B.AverageMs * B.Rate;
+		}
+		return A.Rate > B.Rate;
+	});
+
+	if (MaxSamples >= 0 && OutSamples.Num() > MaxSamples)
+	{
+		OutSamples.SetNum(MaxSamples);
+	}
+}
@@ -10,6 +10,8 @@
 #include "JsonUtilities.h"
 #include "Net/UnrealNetwork.h"
 
+DECLARE_CYCLE_STAT(TEXT("LBEASTWorldPositionCalibrator Tick"), STAT_LBEASTWorldPositionCalibrator_Tick, STATGROUP_LBEASTCore);
+
 ULBEASTWorldPositionCalibrator::ULBEASTWorldPositionCalibrator()
 {
 	PrimaryComponentTick.bCanEverTick = true;
@@ -65,6 +67,7 @@ void ULBEASTWorldPositionCalibrator::BeginPlay()
 void ULBEASTWorldPositionCalibrator::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	LBEASTCORE_SCOPE_CYCLE_COUNTER(STAT_LBEASTWorldPositionCalibrator_Tick);
 	// NOOP: Will handle continuous calibration updates while trigger is held
 }
 
@@ -0,0 +1,738 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "Networking/LBEASTIOReactor.h"
+#include "LBEASTCore.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+#include "Common/UdpSocketBuilder.h"
+
+#if PLATFORM_LINUX
+#include <errno.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#endif
+
+#if PLATFORM_HAS_BSD_SOCKETS
+// FSocket keeps its descriptor private; every socket the platform subsystem creates here is an FSocketBSD
+#include "BSDSockets/SocketsBSD.h"
+#define LBEAST_IOREACTOR_SELECT !PLATFORM_LINUX
+#else
+#define LBEAST_IOREACTOR_SELECT 0
+#endif
+
+DECLARE_CYCLE_STAT(TEXT("IO Reactor Service Pass"), STAT_LBEASTIOReactor_ServicePass, STATGROUP_LBEASTCore);
+DECLARE_CYCLE_STAT(TEXT("IO Reactor Dispatch"), STAT_LBEASTIOReactor_Dispatch, STATGROUP_LBEASTCore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("IO Reactor Datagrams Received"), STAT_LBEASTIOReactor_DatagramsReceived, STATGROUP_LBEASTCore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("IO Reactor Bytes Received"), STAT_LBEASTIOReactor_BytesReceived, STATGROUP_LBEASTCore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("IO Reactor Datagrams Dropped"), STAT_LBEASTIOReactor_DatagramsDropped, STATGROUP_LBEASTCore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("IO Reactor Heap Allocations"), STAT_LBEASTIOReactor_HeapAllocations, STATGROUP_LBEASTCore);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("IO Reactor Queue Depth"), STAT_LBEASTIOReactor_QueueDepth, STATGROUP_LBEASTCore);
+
+namespace
+{
+	/** Longest single wait (registration changes and shutdown wake the thread early) */
+	constexpr int32 MaxIdleWaitMs = 100;
+
+	/** Largest datagram read from any source */
+	constexpr int32 MaxDatagramSize = 65536;
+
+	/** Max datagrams read from one source per pass, so one busy source can't starve the rest */
+	constexpr int32 MaxDatagramsPerSourcePerPass = 256;
+
+	/** Smoothing factor for the average hand-off latency */
+	constexpr double LatencySmoothing = 0.05;
+
+#if PLATFORM_LINUX
+	/** epoll user data of the wake eventfd (sources use their handle) */
+	constexpr uint64 WakeEventTag = MAX_uint64;
+#endif
+
+#if PLATFORM_HAS_BSD_SOCKETS
+	SOCKET GetNativeSocket(FSocket* Socket)
+	{
+		return static_cast<FSocketBSD*>(Socket)->GetNativeSocket();
+	}
+#endif
+}
+
+// =====================================
+// FLBEASTIOReactor
+// =====================================
+
+FLBEASTIOReactor::FLBEASTIOReactor()
+{
+}
+
+FLBEASTIOReactor::~FLBEASTIOReactor()
+{
+	Shutdown();
+}
+
+bool FLBEASTIOReactor::Start()
+{
+	if (IOThread)
+	{
+		return true;
+	}
+
+#if PLATFORM_LINUX
+	EpollFd = epoll_create1(EPOLL_CLOEXEC);
+	WakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (EpollFd < 0 || WakeFd < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("LBEASTIOReactor: Failed to create epoll/eventfd (%d)"), errno);
+		Shutdown();
+		return false;
+	}
+	struct epoll_event WakeEventDesc;
+	WakeEventDesc.events = EPOLLIN;
+	WakeEventDesc.data.u64 = WakeEventTag;
+	epoll_ctl(EpollFd, EPOLL_CTL_ADD, WakeFd, &WakeEventDesc);
+#elif LBEAST_IOREACTOR_SELECT
+	WakeSocket = FUdpSocketBuilder(TEXT("LBEAST_IOReactorWake"))
+		.AsNonBlocking()
+		.BoundToAddress(FIPv4Address(127, 0, 0, 1))
+		.BoundToPort(0)
+		.Build();
+	if (!WakeSocket)
+	{
+		UE_LOG(LogTemp, Error, TEXT("LBEASTIOReactor: Failed to create wake socket"));
+		Shutdown();
+		return false;
+	}
+	WakeAddress = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
+	WakeSocket->GetAddress(*WakeAddress);
+#else
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+#endif
+
+	bStopRequested = false;
+	IOThread = FRunnableThread::Create(this, TEXT("LBEAST_IOReactor"), 0, TPri_AboveNormal);
+	if (!IOThread)
+	{
+		UE_LOG(LogTemp, Error, TEXT("LBEASTIOReactor: Failed to create I/O thread"));
+		Shutdown();
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("LBEASTIOReactor: Started"));
+	return true;
+}
+
+void FLBEASTIOReactor::Shutdown()
+{
+	if (IOThread)
+	{
+		// Kill() calls Stop(), which wakes the thread
+		IOThread->Kill(true);
+		delete IOThread;
+		IOThread = nullptr;
+		UE_LOG(LogTemp, Log, TEXT("LBEASTIOReactor: Stopped"));
+	}
+
+	{
+		FScopeLock Lock(&SourcesLock);
+		Sources.Reset();
+	}
+
+#if PLATFORM_LINUX
+	if (EpollFd >= 0)
+	{
+		close(EpollFd);
+		EpollFd = -1;
+	}
+	if (WakeFd >= 0)
+	{
+		close(WakeFd);
+		WakeFd = -1;
+	}
+#endif
+
+	if (WakeSocket)
+	{
+		WakeSocket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(WakeSocket);
+		WakeSocket = nullptr;
+	}
+	WakeAddress.Reset();
+
+	if (WakeEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+}
+
+int32 FLBEASTIOReactor::RegisterSocket(FSocket* Socket, FOnLBEASTIODatagrams Handler, const FString& DebugName)
+{
+	if (!Socket || !Handler.IsBound())
+	{
+		return -1;
+	}
+
+	Socket->SetNonBlocking(true);
+
+	TSharedPtr<FSource> Source = MakeShared<FSource>();
+	Source->DebugName = DebugName;
+	Source->Socket = Socket;
+	Source->Handler = MoveTemp(Handler);
+	Source->ReceiveAddress = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
+
+	const int32 Handle = AddSource(Source);
+	UE_LOG(LogTemp, Verbose, TEXT("LBEASTIOReactor: Registered socket %s (handle %d)"), *DebugName, Handle);
+	return Handle;
+}
+
+int32 FLBEASTIOReactor::RegisterReadableSocket(FSocket* Socket, FOnLBEASTIOReadable Handler, const FString& DebugName)
+{
+	if (!Socket || !Handler.IsBound())
+	{
+		return -1;
+	}
+
+	Socket->SetNonBlocking(true);
+
+	TSharedPtr<FSource> Source = MakeShared<FSource>();
+	Source->DebugName = DebugName;
+	Source->Socket = Socket;
+	Source->ReadableHandler = MoveTemp(Handler);
+
+	const int32 Handle = AddSource(Source);
+	UE_LOG(LogTemp, Verbose, TEXT("LBEASTIOReactor: Watching socket %s (handle %d)"), *DebugName, Handle);
+	return Handle;
+}
+
+int32 FLBEASTIOReactor::RegisterDescriptor(int32 NativeDescriptor, FOnLBEASTIODatagrams Handler, const FString& DebugName)
+{
+#if PLATFORM_LINUX
+	if (NativeDescriptor < 0 || !Handler.IsBound())
+	{
+		return -1;
+	}
+
+	TSharedPtr<FSource> Source = MakeShared<FSource>();
+	Source->DebugName = DebugName;
+	Source->NativeDescriptor = NativeDescriptor;
+	Source->Handler = MoveTemp(Handler);
+
+	const int32 Handle = AddSource(Source);
+	UE_LOG(LogTemp, Verbose, TEXT("LBEASTIOReactor: Registered descriptor %s (handle %d)"), *DebugName, Handle);
+	return Handle;
+#else
+	UE_LOG(LogTemp, Warning, TEXT("LBEASTIOReactor: Native descriptors are only supported on Linux (%s)"), *DebugName);
+	return -1;
+#endif
+}
+
+int32 FLBEASTIOReactor::AddSource(const TSharedPtr<FSource>& Source)
+{
+	{
+		FScopeLock Lock(&SourcesLock);
+		Source->Handle = NextHandle++;
+
+#if PLATFORM_LINUX
+		const int32 Descriptor = Source->Socket ? (int32)GetNativeSocket(Source->Socket) : Source->NativeDescriptor;
+		struct epoll_event EventDesc;
+		EventDesc.events = EPOLLIN;
+		EventDesc.data.u64 = (uint64)Source->Handle;
+		if (EpollFd < 0 || epoll_ctl(EpollFd, EPOLL_CTL_ADD, Descriptor, &EventDesc) != 0)
+		{
+			UE_LOG(LogTemp, Error, TEXT("LBEASTIOReactor: epoll_ctl failed for %s (%d)"), *Source->DebugName, errno);
+			return -1;
+		}
+#elif LBEAST_IOREACTOR_SELECT
+		if (Sources.Num() + 1 >= FD_SETSIZE)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("LBEASTIOReactor: More than %d sockets; %s is drained every pass instead of waited on"),
+				FD_SETSIZE - 1, *Source->DebugName);
+		}
+#endif
+
+		Sources.Add(Source);
+	}
+
+	WakeIOThread();
+	return Source->Handle;
+}
+
+void FLBEASTIOReactor::Unregister(int32 Handle)
+{
+	// Blocks until any in-flight I/O pass finishes, so the caller can destroy the socket afterwards
+	FScopeLock Lock(&SourcesLock);
+	for (int32 i = 0; i < Sources.Num(); i++)
+	{
+		if (Sources[i]->Handle == Handle)
+		{
+#if PLATFORM_LINUX
+			if (EpollFd >= 0)
+			{
+				const FSource& Source = *Sources[i];
+				const int32 Descriptor = Source.Socket ? (int32)GetNativeSocket(Source.Socket) : Source.NativeDescriptor;
+				epoll_ctl(EpollFd, EPOLL_CTL_DEL, Descriptor, nullptr);
+			}
+#endif
+			Sources.RemoveAt(i);
+			return;
+		}
+	}
+}
+
+void FLBEASTIOReactor::SetWatched(FSource& Source, bool bWatched)
+{
+	Source.bArmed = bWatched;
+
+#if PLATFORM_LINUX
+	if (EpollFd >= 0)
+	{
+		const int32 Descriptor = Source.Socket ? (int32)GetNativeSocket(Source.Socket) : Source.NativeDescriptor;
+		struct epoll_event EventDesc;
+		EventDesc.events = bWatched ? EPOLLIN : 0;
+		EventDesc.data.u64 = (uint64)Source.Handle;
+		epoll_ctl(EpollFd, EPOLL_CTL_MOD, Descriptor, &EventDesc);
+	}
+#else
+	if (bWatched)
+	{
+		// The select() set is rebuilt on every wait
+		WakeIOThread();
+	}
+#endif
+}
+
+void FLBEASTIOReactor::DispatchPending()
+{
+	LBEASTCORE_SCOPE_CYCLE_COUNTER(STAT_LBEASTIOReactor_Dispatch);
+
+	TArray<TSharedPtr<FSource>> Snapshot;
+	{
+		FScopeLock Lock(&SourcesLock);
+		Snapshot = Sources;
+	}
+
+	// One lock per frame: move every inbox out, then run handlers without holding it
+	TArray<TSharedPtr<FSource>, TInlineAllocator<8>> Readable;
+	{
+		FScopeLock Lock(&InboxLock);
+		for (const TSharedPtr<FSource>& Source : Snapshot)
+		{
+			Source->Delivering.Reset();
+			Swap(Source->Inbox, Source->Delivering);
+			if (Source->bReadablePending)
+			{
+				Source->bReadablePending = false;
+				Readable.Add(Source);
+			}
+		}
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	int32 Delivered = 0;
+	for (const TSharedPtr<FSource>& Source : Snapshot)
+	{
+		if (Source->Delivering.Num() == 0)
+		{
+			continue;
+		}
+
+		for (const FLBEASTIODatagram& Datagram : Source->Delivering)
+		{
+			const double Latency = Now - Datagram.ReceiveTimeSeconds;
+			AverageHandOffLatencySeconds += (Latency - AverageHandOffLatencySeconds) * LatencySmoothing;
+			MaxHandOffLatencySeconds = FMath::Max(MaxHandOffLatencySeconds, Latency);
+		}
+		Delivered += Source->Delivering.Num();
+
+		Source->Handler.ExecuteIfBound(Source->Delivering);
+	}
+	LastFrameDatagrams = Delivered;
+	LBEASTCORE_SET_GAUGE(STAT_LBEASTIOReactor_QueueDepth, Delivered);
+
+	for (const TSharedPtr<FSource>& Source : Readable)
+	{
+		Source->ReadableHandler.ExecuteIfBound();
+
+		// Watch again unless the handler unregistered it (its socket may already be gone)
+		FScopeLock Lock(&SourcesLock);
+		if (Sources.Contains(Source))
+		{
+			SetWatched(*Source, true);
+		}
+	}
+}
+
+FLBEASTIOReactorStats FLBEASTIOReactor::GetStats() const
+{
+	FLBEASTIOReactorStats Stats;
+	{
+		FScopeLock Lock(&SourcesLock);
+		Stats.RegisteredSources = Sources.Num();
+	}
+	{
+		FScopeLock Lock(&InboxLock);
+		Stats.DatagramsReceived = DatagramsReceived;
+		Stats.DatagramsDropped = DatagramsDropped;
+	}
+	Stats.LastFrameDatagrams = LastFrameDatagrams;
+	Stats.AverageHandOffLatencyMs = (float)(AverageHandOffLatencySeconds * 1000.0);
+	Stats.MaxHandOffLatencyMs = (float)(MaxHandOffLatencySeconds * 1000.0);
+	return Stats;
+}
+
+void FLBEASTIOReactor::ResetStats()
+{
+	{
+		FScopeLock Lock(&InboxLock);
+		DatagramsDropped = 0;
+	}
+	MaxHandOffLatencySeconds = 0.0;
+}
+
+uint32 FLBEASTIOReactor::Run()
+{
+	if (ReceiveScratch.Num() != MaxDatagramSize)
+	{
+		ReceiveScratch.SetNumUninitialized(MaxDatagramSize);
+	}
+
+	while (!bStopRequested)
+	{
+		// Readiness is level-triggered, so a source left with data after its per-pass cap is reported again at once
+		WaitForReadiness();
+		ServiceSources();
+	}
+	return 0;
+}
+
+void FLBEASTIOReactor::Stop()
+{
+	bStopRequested = true;
+	WakeIOThread();
+}
+
+int32 FLBEASTIOReactor::ServiceSources()
+{
+	if (ReadyHandles.Num() == 0)
+	{
+		return 0;
+	}
+
+	LBEASTCORE_SCOPE_CYCLE_COUNTER(STAT_LBEASTIOReactor_ServicePass);
+
+	FScopeLock Lock(&SourcesLock);
+	int32 Total = 0;
+	for (const TSharedPtr<FSource>& Source : Sources)
+	{
+		// A source unregistered since the wait is simply no longer in Sources
+		if (!ReadyHandles.Contains(Source->Handle))
+		{
+			continue;
+		}
+
+		if (Source->ReadableHandler.IsBound())
+		{
+			if (Source->bArmed)
+			{
+				SetWatched(*Source, false);
+				FScopeLock InboxScope(&InboxLock);
+				Source->bReadablePending = true;
+			}
+			continue;
+		}
+
+		Total += DrainSource(*Source);
+	}
+	return Total;
+}
+
+int32 FLBEASTIOReactor::DrainSource(FSource& Source)
+{
+	// Read into a local batch first so InboxLock is taken once per source per pass
+	TArray<FLBEASTIODatagram, TInlineAllocator<16>> Batch;
+
+	for (int32 Count = 0; Count < MaxDatagramsPerSourcePerPass; Count++)
+	{
+		int32 BytesRead = 0;
+		bool bNewSender = false;
+
+		if (Source.Socket)
+		{
+			if (!Source.Socket->RecvFrom(ReceiveScratch.GetData(), ReceiveScratch.Num(), BytesRead, *Source.ReceiveAddress) || BytesRead <= 0)
+			{
+				break;
+			}
+
+			// Devices usually talk from one address: keep handing out the same sender until it changes
+			if (!Source.LastSender.IsValid() || !(*Source.LastSender == *Source.ReceiveAddress))
+			{
+				Source.LastSender = Source.ReceiveAddress->Clone();
+				bNewSender = true;
+			}
+		}
+#if PLATFORM_LINUX
+		else if (Source.NativeDescriptor >= 0)
+		{
+			const ssize_t Received = recv(Source.NativeDescriptor, ReceiveScratch.GetData(), ReceiveScratch.Num(), MSG_DONTWAIT);
+			if (Received <= 0)
+			{
+				break;
+			}
+			BytesRead = (int32)Received;
+		}
+#endif
+		else
+		{
+			break;
+		}
+
+		// Counts what the I/O thread actually mallocs per datagram: the payload buffer, plus the address clone on a sender change
+		LBEASTCORE_INC_COUNTER(STAT_LBEASTIOReactor_BytesReceived, BytesRead);
+		LBEASTCORE_INC_COUNTER(STAT_LBEASTIOReactor_HeapAllocations, bNewSender ? 2 : 1);
+
+		FLBEASTIODatagram& Datagram = Batch.AddDefaulted_GetRef();
+		Datagram.Data.Append(ReceiveScratch.GetData(), BytesRead);
+		if (Source.Socket)
+		{
+			Datagram.Sender = Source.LastSender;
+		}
+		Datagram.ReceiveTimeSeconds = FPlatformTime::Seconds();
+	}
+
+	if (Batch.Num() == 0)
+	{
+		return 0;
+	}
+
+	LBEASTCORE_INC_COUNTER(STAT_LBEASTIOReactor_DatagramsReceived, Batch.Num());
+
+	FScopeLock Lock(&InboxLock);
+	DatagramsReceived += Batch.Num();
+	for (FLBEASTIODatagram& Datagram : Batch)
+	{
+		if (Source.Inbox.Num() >= MaxInboxSize)
+		{
+			// Game thread isn't keeping up; drop newest rather than grow without bound
+			DatagramsDropped++;
+			LBEASTCORE_INC_COUNTER(STAT_LBEASTIOReactor_DatagramsDropped, 1);
+			continue;
+		}
+		Source.Inbox.Add(MoveTemp(Datagram));
+	}
+	return Batch.Num();
+}
+
+void FLBEASTIOReactor::WaitForReadiness()
+{
+	ReadyHandles.Reset();
+
+#if PLATFORM_LINUX
+	struct epoll_event Events[64];
+	const int32 Ready = epoll_wait(EpollFd, Events, UE_ARRAY_COUNT(Events), MaxIdleWaitMs);
+	for (int32 i = 0; i < Ready; i++)
+	{
+		if (Events[i].data.u64 == WakeEventTag)
+		{
+			uint64 WakeCount = 0;
+			ssize_t Ignored = read(WakeFd, &WakeCount, sizeof(WakeCount));
+			(void)Ignored;
+		}
+		else
+		{
+			ReadyHandles.Add((int32)Events[i].data.u64);
+		}
+	}
+#elif LBEAST_IOREACTOR_SELECT
+	fd_set ReadSet;
+	FD_ZERO(&ReadSet);
+	const SOCKET WakeNative = GetNativeSocket(WakeSocket);
+	FD_SET(WakeNative, &ReadSet);
+	SOCKET MaxNative = WakeNative;
+	int32 TimeoutMs = MaxIdleWaitMs;
+
+	// Build the set without holding SourcesLock across the wait; a socket unregistered meanwhile
+	// only produces a failed or spurious wake, since results are matched back by handle
+	TArray<TPair<int32, SOCKET>, TInlineAllocator<32>> Watched;
+	{
+		FScopeLock Lock(&SourcesLock);
+		for (const TSharedPtr<FSource>& Source : Sources)
+		{
+			if (!Source->Socket || !Source->bArmed)
+			{
+				continue;
+			}
+			if (Watched.Num() + 1 >= FD_SETSIZE)
+			{
+				// Past the select() limit: drain every pass on a short timeout
+				ReadyHandles.Add(Source->Handle);
+				TimeoutMs = FallbackPollMs;
+				continue;
+			}
+			const SOCKET Native = GetNativeSocket(Source->Socket);
+			FD_SET(Native, &ReadSet);
+			MaxNative = FMath::Max(MaxNative, Native);
+			Watched.Emplace(Source->Handle, Native);
+		}
+	}
+
+	struct timeval Timeout;
+	Timeout.tv_sec = 0;
+	Timeout.tv_usec = TimeoutMs * 1000;
+	const int32 Ready = select((int32)MaxNative + 1, &ReadSet, nullptr, nullptr, &Timeout);
+	if (Ready <= 0)
+	{
+		return;
+	}
+
+	if (FD_ISSET(WakeNative, &ReadSet))
+	{
+		uint8 WakeBytes[64];
+		int32 BytesRead = 0;
+		while (WakeSocket->Recv(WakeBytes, sizeof(WakeBytes), BytesRead) && BytesRead > 0)
+		{
+		}
+	}
+	for (const TPair<int32, SOCKET>& Entry : Watched)
+	{
+		if (FD_ISSET(Entry.Value, &ReadSet))
+		{
+			ReadyHandles.Add(Entry.Key);
+		}
+	}
+#else
+	// No descriptor to wait on: pass over every source at a fixed interval
+	if (WakeEvent)
+	{
+		WakeEvent->Wait(FMath::Max(FallbackPollMs, 1));
+	}
+
+	FScopeLock Lock(&SourcesLock);
+	for (const TSharedPtr<FSource>& Source : Sources)
+	{
+		if (Source->ReadableHandler.IsBound())
+		{
+			if (Source->bArmed && Source->Socket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::Zero()))
+			{
+				ReadyHandles.Add(Source->Handle);
+			}
+			continue;
+		}
+		ReadyHandles.Add(Source->Handle);
+	}
+#endif
+}
+
+void FLBEASTIOReactor::WakeIOThread()
+{
+#if PLATFORM_LINUX
+	if (WakeFd >= 0)
+	{
+		const uint64 One = 1;
+		ssize_t Ignored = write(WakeFd, &One, sizeof(One));
+		(void)Ignored;
+	}
+#elif LBEAST_IOREACTOR_SELECT
+	if (WakeSocket && WakeAddress.IsValid())
+	{
+		const uint8 One = 1;
+		int32 BytesSent = 0;
+		WakeSocket->SendTo(&One, 1, BytesSent, *WakeAddress);
+	}
+#else
+	if (WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+#endif
+}
+
+// =====================================
+// ULBEASTIOReactorSubsystem
+// =====================================
+
+ULBEASTIOReactorSubsystem* ULBEASTIOReactorSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<ULBEASTIOReactorSubsystem>() : nullptr;
+}
+
+void ULBEASTIOReactorSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Reactor = MakeUnique<FLBEASTIOReactor>();
+	if (!Reactor->Start())
+	{
+		UE_LOG(LogTemp, Error, TEXT("LBEASTIOReactorSubsystem: Reactor failed to start - transports will poll their own sockets"));
+		Reactor.Reset();
+	}
+}
+
+void ULBEASTIOReactorSubsystem::Deinitialize()
+{
+	if (Reactor.IsValid())
+	{
+		Reactor->Shutdown();
+		Reactor.Reset();
+	}
+
+	Super::Deinitialize();
+}
+
+int32 ULBEASTIOReactorSubsystem::RegisterSocket(FSocket* Socket, FOnLBEASTIODatagrams Handler, const FString& DebugName)
+{
+	return Reactor.IsValid() ? Reactor->RegisterSocket(Socket, MoveTemp(Handler), DebugName) : -1;
+}
+
+int32 ULBEASTIOReactorSubsystem::RegisterDescriptor(int32 NativeDescriptor, FOnLBEASTIODatagrams Handler, const FString& DebugName)
+{
+	return Reactor.IsValid() ? Reactor->RegisterDescriptor(NativeDescriptor, MoveTemp(Handler), DebugName) : -1;
+}
+
+int32 ULBEASTIOReactorSubsystem::RegisterReadableSocket(FSocket* Socket, FOnLBEASTIOReadable Handler, const FString& DebugName)
+{
+	return Reactor.IsValid() ? Reactor->RegisterReadableSocket(Socket, MoveTemp(Handler), DebugName) : -1;
+}
+
+void ULBEASTIOReactorSubsystem::Unregister(int32 Handle)
+{
+	if (Reactor.IsValid() && Handle >= 0)
+	{
+		Reactor->Unregister(Handle);
+	}
+}
+
+FLBEASTIOReactorStats ULBEASTIOReactorSubsystem::GetReactorStats() const
+{
+	return Reactor.IsValid() ? Reactor->GetStats() : FLBEASTIOReactorStats();
+}
+
+void ULBEASTIOReactorSubsystem::ResetReactorStats()
+{
+	if (Reactor.IsValid())
+	{
+		Reactor->ResetStats();
+	}
+}
+
+void ULBEASTIOReactorSubsystem::Tick(float DeltaTime)
+{
+	if (Reactor.IsValid())
+	{
+		Reactor->DispatchPending();
+	}
+}
+
+TStatId ULBEASTIOReactorSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(ULBEASTIOReactorSubsystem, STATGROUP_Tickables);
+}
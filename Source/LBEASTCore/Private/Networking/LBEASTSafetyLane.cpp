@@ -0,0 +1,282 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "Networking/LBEASTSafetyLane.h"
+#include "Networking/LBEASTSessionCapture.h"
+#include "LBEASTCore.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/RunnableThread.h"
+#include "IPAddress.h"
+#include "Sockets.h"
+
+DECLARE_CYCLE_STAT(TEXT("Safety Lane Submit"), STAT_LBEASTSafety_Submit, STATGROUP_LBEASTCore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Safety Commands Sent"), STAT_LBEASTSafety_Sent, STATGROUP_LBEASTCore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Safety Retransmits"), STAT_LBEASTSafety_Retransmits, STATGROUP_LBEASTCore);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Safety Commands Pending"), STAT_LBEASTSafety_Pending, STATGROUP_LBEASTCore);
+
+namespace
+{
+	/** Thread wait when nothing is pending (Submit wakes it early) */
+	constexpr double IdleWaitSeconds = 1.0;
+}
+
+FLBEASTSafetyLane& FLBEASTSafetyLane::Get()
+{
+	static FLBEASTSafetyLane Instance;
+	return Instance;
+}
+
+FLBEASTSafetyLane::FLBEASTSafetyLane()
+{
+}
+
+FLBEASTSafetyLane::~FLBEASTSafetyLane()
+{
+	Shutdown();
+}
+
+uint16 FLBEASTSafetyLane::AllocateSequence()
+{
+	FScopeLock ScopeLock(&Lock);
+	const uint16 Sequence = NextSequence++;
+	if (NextSequence == 0)
+	{
+		NextSequence = 1;
+	}
+	return Sequence;
+}
+
+bool FLBEASTSafetyLane::Submit(FLBEASTSafetyCommand&& Command)
+{
+	LBEASTCORE_SCOPE_CYCLE_COUNTER(STAT_LBEASTSafety_Submit);
+
+	if (!Command.Socket || !Command.RemoteAddress.IsValid() || Command.Packet.Num() == 0)
+	{
+		return false;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+
+	// First copy before any bookkeeping: this is the latency the lane exists to bound
+	const bool bSent = SendCopy(Command);
+	const double WireSeconds = FPlatformTime::Seconds();
+	for (int32 Copy = 1; Copy < Command.Config.RedundantCopies; Copy++)
+	{
+		SendCopy(Command);
+	}
+
+	const float LatencyUs = (float)((WireSeconds - Command.CallSeconds) * 1e6);
+	CallToWireUs.Add(LatencyUs);
+	CallToWireMaxUs = FMath::Max(CallToWireMaxUs, LatencyUs);
+	CommandsSent++;
+	LBEASTCORE_INC_COUNTER(STAT_LBEASTSafety_Sent, 1);
+
+	// A newer command on the same channel supersedes the pending one
+	Pending.RemoveAll([&Command](const FPending& Entry)
+	{
+		return Entry.Command.Owner == Command.Owner && Entry.Command.Channel == Command.Channel;
+	});
+
+	FPending& Entry = Pending.AddDefaulted_GetRef();
+	Entry.IntervalSeconds = FMath::Max(Command.Config.RetransmitIntervalMs, 1) / 1000.0;
+	Entry.NextSendSeconds = WireSeconds + Entry.IntervalSeconds;
+	Entry.Command = MoveTemp(Command);
+	LBEASTCORE_SET_GAUGE(STAT_LBEASTSafety_Pending, Pending.Num());
+
+	EnsureThread();
+	if (WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+
+	if (!bSent)
+	{
+		UE_LOG(LogTemp, Error, TEXT("LBEASTSafetyLane: Socket refused safety command (Ch:%d Seq:%d) - retransmitting"),
+			Entry.Command.Channel, Entry.Command.Sequence);
+	}
+	return bSent;
+}
+
+void FLBEASTSafetyLane::Acknowledge(const void* Owner, int32 Channel, uint16 Sequence)
+{
+	int32 HealthHandle = -1;
+	float AckMs = 0.0f;
+	{
+		FScopeLock ScopeLock(&Lock);
+		const int32 Index = Pending.IndexOfByPredicate([Owner, Channel, Sequence](const FPending& Entry)
+		{
+			return Entry.Command.Owner == Owner && Entry.Command.Channel == Channel && Entry.Command.Sequence == Sequence;
+		});
+		if (Index == INDEX_NONE)
+		{
+			// Duplicate ACK (redundant copies each get one) or superseded command
+			return;
+		}
+
+		AckMs = (float)((FPlatformTime::Seconds() - Pending[Index].Command.CallSeconds) * 1000.0);
+		HealthHandle = Pending[Index].Command.HealthHandle;
+		AckLatencyMs.Add(AckMs);
+		CommandsAcked++;
+		Pending.RemoveAtSwap(Index);
+		LBEASTCORE_SET_GAUGE(STAT_LBEASTSafety_Pending, Pending.Num());
+	}
+
+	FLBEASTDeviceHealthRegistry::Get().ReportRoundTrip(HealthHandle, AckMs);
+	UE_LOG(LogTemp, Log, TEXT("LBEASTSafetyLane: Safety command acknowledged (Ch:%d Seq:%d) in %.2f ms"), Channel, Sequence, AckMs);
+}
+
+void FLBEASTSafetyLane::CancelOwner(const void* Owner)
+{
+	FScopeLock ScopeLock(&Lock);
+	const int32 Removed = Pending.RemoveAll([Owner](const FPending& Entry)
+	{
+		return Entry.Command.Owner == Owner;
+	});
+	if (Removed > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("LBEASTSafetyLane: Transport shut down with %d unacknowledged safety command(s)"), Removed);
+		CommandsUnacked += Removed;
+		LBEASTCORE_SET_GAUGE(STAT_LBEASTSafety_Pending, Pending.Num());
+	}
+}
+
+bool FLBEASTSafetyLane::IsPending(const void* Owner, int32 Channel) const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Pending.ContainsByPredicate([Owner, Channel](const FPending& Entry)
+	{
+		return Entry.Command.Owner == Owner && Entry.Command.Channel == Channel;
+	});
+}
+
+FLBEASTSafetyLaneStats FLBEASTSafetyLane::GetStats() const
+{
+	FScopeLock ScopeLock(&Lock);
+	FLBEASTSafetyLaneStats Stats;
+	Stats.CommandsSent = CommandsSent;
+	Stats.CommandsAcked = CommandsAcked;
+	Stats.CommandsUnacked = CommandsUnacked;
+	Stats.CommandsPending = Pending.Num();
+	Stats.Retransmits = Retransmits;
+	Stats.CallToWireP50Us = CallToWireUs.GetPercentile(0.5f);
+	Stats.CallToWireP99Us = CallToWireUs.GetPercentile(0.99f);
+	Stats.CallToWireMaxUs = CallToWireMaxUs;
+	Stats.AckLatencyP50Ms = AckLatencyMs.GetPercentile(0.5f);
+	Stats.AckLatencyP99Ms = AckLatencyMs.GetPercentile(0.99f);
+	return Stats;
+}
+
+bool FLBEASTSafetyLane::SendCopy(const FLBEASTSafetyCommand& Command)
+{
+	int32 BytesSent = 0;
+	const bool bSent = Command.Socket->SendTo(Command.Packet.GetData(), Command.Packet.Num(), BytesSent, *Command.RemoteAddress)
+		&& BytesSent == Command.Packet.Num();
+	if (bSent)
+	{
+		FLBEASTSessionCapture::Get().Record(Command.CaptureSource, ELBEASTCaptureDirection::Outbound, 0,
+			Command.Packet.GetData(), Command.Packet.Num());
+	}
+	return bSent;
+}
+
+// =====================================
+// Retransmit Thread
+// =====================================
+
+void FLBEASTSafetyLane::EnsureThread()
+{
+	if (Thread)
+	{
+		return;
+	}
+
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	bStopRequested = false;
+	Thread = FRunnableThread::Create(this, TEXT("LBEAST_SafetyLane"), 0, TPri_Highest);
+	if (!Thread)
+	{
+		// Redundant first copies already went out; only retransmission is lost
+		UE_LOG(LogTemp, Error, TEXT("LBEASTSafetyLane: Failed to create retransmit thread"));
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+}
+
+void FLBEASTSafetyLane::Shutdown()
+{
+	if (Thread)
+	{
+		Thread->Kill(true);
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	if (WakeEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	Pending.Empty();
+}
+
+uint32 FLBEASTSafetyLane::Run()
+{
+	while (!bStopRequested)
+	{
+		double WaitSeconds;
+		{
+			FScopeLock ScopeLock(&Lock);
+			WaitSeconds = ServicePending(FPlatformTime::Seconds());
+		}
+
+		const uint32 WaitMs = (uint32)FMath::Clamp(FMath::CeilToInt(WaitSeconds * 1000.0), 1, (int32)(IdleWaitSeconds * 1000.0));
+		WakeEvent->Wait(WaitMs);
+	}
+	return 0;
+}
+
+void FLBEASTSafetyLane::Stop()
+{
+	bStopRequested = true;
+	if (WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+double FLBEASTSafetyLane::ServicePending(double NowSeconds)
+{
+	double NextDeadline = NowSeconds + IdleWaitSeconds;
+
+	for (int32 Index = Pending.Num() - 1; Index >= 0; Index--)
+	{
+		FPending& Entry = Pending[Index];
+		const FLBEASTSafetyCommand& Command = Entry.Command;
+
+		if (NowSeconds - Command.CallSeconds >= Command.Config.GiveUpSeconds)
+		{
+			UE_LOG(LogTemp, Error, TEXT("LBEASTSafetyLane: Safety command NOT acknowledged after %.1fs (Ch:%d Seq:%d) - check the ECU and the hardware E-stop"),
+				Command.Config.GiveUpSeconds, Command.Channel, Command.Sequence);
+			CommandsUnacked++;
+			Pending.RemoveAtSwap(Index);
+			continue;
+		}
+
+		if (Entry.NextSendSeconds <= NowSeconds)
+		{
+			SendCopy(Command);
+			Retransmits++;
+			LBEASTCORE_INC_COUNTER(STAT_LBEASTSafety_Retransmits, 1);
+			Entry.IntervalSeconds = FMath::Min(Entry.IntervalSeconds * 2.0, FMath::Max(Command.Config.MaxRetransmitIntervalMs, 1) / 1000.0);
+			Entry.NextSendSeconds = NowSeconds + Entry.IntervalSeconds;
+		}
+
+		NextDeadline = FMath::Min(NextDeadline, Entry.NextSendSeconds);
+	}
+
+	LBEASTCORE_SET_GAUGE(STAT_LBEASTSafety_Pending, Pending.Num());
+	return NextDeadline - NowSeconds;
+}
@@ -1,9 +1,15 @@
 // Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
 
 #include "Networking/LBEASTServerBeacon.h"
+#include "Networking/LBEASTIOReactor.h"
+#include "Networking/LBEASTSessionCapture.h"
 #include "Serialization/BufferArchive.h"
 #include "Serialization/MemoryReader.h"
 #include "Common/UdpSocketBuilder.h"
+#include "Misc/App.h"
+#include "LBEASTCore.h"
+
+DECLARE_CYCLE_STAT(TEXT("LBEASTServerBeacon Tick"), STAT_LBEASTServerBeacon_Tick, STATGROUP_LBEASTCore);
 
 // Magic number to identify LBEAST beacon packets
 static const uint32 LBEAST_BEACON_MAGIC = 0x4C424541;  // "LBEA" in hex
@@ -41,6 +47,7 @@ bool ULBEASTServerBeacon::StartServerBroadcast(const FLBEASTServerInfo& ServerIn
 	bIsActive = true;
 	bIsServerMode = true;
 	TimeSinceLastBroadcast = 0.0f;
+	CaptureSource = FLBEASTSessionCapture::Get().RegisterSource(FString::Printf(TEXT("Beacon Server :%d"), BroadcastPort));
 
 	UE_LOG(LogTemp, Log, TEXT("LBEASTServerBeacon: Started broadcasting as server '%s' (%s) on port %d"), 
 		*CurrentServerInfo.ServerName, *CurrentServerInfo.ExperienceType, BroadcastPort);
@@ -67,6 +74,19 @@ bool ULBEASTServerBeacon::StartClientDiscovery()
 
 	bIsActive = true;
 	bIsServerMode = false;
+	CaptureSource = FLBEASTSessionCapture::Get().RegisterSource(FString::Printf(TEXT("Beacon Client :%d"), BroadcastPort),
+		FOnLBEASTCaptureReplay::CreateUObject(this, &ULBEASTServerBeacon::HandleCaptureReplay));
+
+	if (ULBEASTIOReactorSubsystem* Reactor = ULBEASTIOReactorSubsystem::Get(this))
+	{
+		IOReactorHandle = Reactor->RegisterSocket(ListenSocket,
+			FOnLBEASTIODatagrams::CreateUObject(this, &ULBEASTServerBeacon::HandleIOReactorDatagrams),
+			TEXT("ServerBeacon"));
+		if (IOReactorHandle >= 0)
+		{
+			IOReactor = Reactor;
+		}
+	}
 
 	UE_LOG(LogTemp, Log, TEXT("LBEASTServerBeacon: Started listening for servers on port %d"), BroadcastPort);
 
@@ -81,6 +101,8 @@ void ULBEASTServerBeacon::Stop()
 	}
 
 	CleanupSockets();
+	FLBEASTSessionCapture::Get().UnregisterSource(CaptureSource);
+	CaptureSource = -1;
 
 	bIsActive = false;
 	DiscoveredServers.Empty();
@@ -122,6 +144,8 @@ void ULBEASTServerBeacon::UpdateServerInfo(const FLBEASTServerInfo& NewServerInf
 
 void ULBEASTServerBeacon::Tick(float DeltaTime)
 {
+	LBEASTCORE_SCOPE_CYCLE_COUNTER(STAT_LBEASTServerBeacon_Tick);
+
 	if (!bIsActive)
 	{
 		return;
@@ -139,8 +163,11 @@ void ULBEASTServerBeacon::Tick(float DeltaTime)
 	}
 	else
 	{
-		// Receive packets from servers
-		ReceivePackets();
+		// Receive packets from servers (delivered by the I/O reactor when registered)
+		if (IOReactorHandle < 0)
+		{
+			ReceivePackets();
+		}
 
 		// Check for server timeouts
 		CheckServerTimeouts();
@@ -178,6 +205,27 @@ TArray<uint8> ULBEASTServerBeacon::SerializeServerInfo(const FLBEASTServerInfo&
 	Writer << ServerVersion;
 	Writer << bAcceptingConnections;
 
+	// Optional perf block. Appended after the v1 fields so older readers simply ignore it.
+	float ServerFrameTimeMs = ServerInfo.ServerFrameTimeMs;
+	int32 NumPerfSamples = ServerInfo.PerfSamples.Num();
+	Writer << ServerFrameTimeMs;
+	Writer << NumPerfSamples;
+	for (const FLBEASTPerfSample& Sample : ServerInfo.PerfSamples)
+	{
+		FString Name = Sample.Name;
+		FString Group = Sample.Group;
+		uint8 Type = (uint8)Sample.Type;
+		float Rate = Sample.Rate;
+		float AverageMs = Sample.AverageMs;
+		float MaxMs = Sample.MaxMs;
+		Writer << Name;
+		Writer << Group;
+		Writer << Type;
+		Writer << Rate;
+		Writer << AverageMs;
+		Writer << MaxMs;
+	}
+
 	return TArray<uint8>(Writer.GetData(), Writer.Num());
 }
 
@@ -219,6 +267,32 @@ bool ULBEASTServerBeacon::DeserializeServerInfo(const TArray<uint8>& Data, FLBEA
 	Reader << OutServerInfo.ServerVersion;
 	Reader << OutServerInfo.bAcceptingConnections;
 
+	// Optional perf block (absent from servers that predate it)
+	OutServerInfo.PerfSamples.Reset();
+	if (!Reader.AtEnd())
+	{
+		int32 NumPerfSamples = 0;
+		Reader << OutServerInfo.ServerFrameTimeMs;
+		Reader << NumPerfSamples;
+		if (NumPerfSamples < 0 || NumPerfSamples > 64)
+		{
+			return false;
+		}
+
+		OutServerInfo.PerfSamples.SetNum(NumPerfSamples);
+		for (FLBEASTPerfSample& Sample : OutServerInfo.PerfSamples)
+		{
+			uint8 Type = 0;
+			Reader << Sample.Name;
+			Reader << Sample.Group;
+			Reader << Type;
+			Reader << Sample.Rate;
+			Reader << Sample.AverageMs;
+			Reader << Sample.MaxMs;
+			Sample.Type = (ELBEASTPerfStatType)FMath::Min<uint8>(Type, (uint8)ELBEASTPerfStatType::Gauge);
+		}
+	}
+
 	OutServerInfo.LastBeaconTime = FPlatformTime::Seconds();
 
 	return !Reader.IsError();
@@ -234,6 +308,17 @@ void ULBEASTServerBeacon::SendBroadcast()
 	// Update timestamp
 	CurrentServerInfo.LastBeaconTime = FPlatformTime::Seconds();
 
+	if (bBroadcastPerfStats)
+	{
+		CurrentServerInfo.ServerFrameTimeMs = (float)(FApp::GetDeltaTime() * 1000.0);
+		FLBEASTPerfStat::GetTopSamples(MaxBroadcastPerfStats, CurrentServerInfo.PerfSamples);
+	}
+	else
+	{
+		CurrentServerInfo.ServerFrameTimeMs = 0.0f;
+		CurrentServerInfo.PerfSamples.Reset();
+	}
+
 	// Serialize server info
 	TArray<uint8> Data = SerializeServerInfo(CurrentServerInfo);
 
@@ -245,6 +330,7 @@ void ULBEASTServerBeacon::SendBroadcast()
 	// Send broadcast
 	int32 BytesSent = 0;
 	BroadcastSocket->SendTo(Data.GetData(), Data.Num(), BytesSent, *BroadcastAddr);
+	FLBEASTSessionCapture::Get().Record(CaptureSource, ELBEASTCaptureDirection::Outbound, MAX_uint32, Data.GetData(), Data.Num());
 
 	if (BytesSent != Data.Num())
 	{
@@ -261,35 +347,63 @@ void ULBEASTServerBeacon::ReceivePackets()
 	}
 
 	TSharedRef<FInternetAddr> Sender = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
-	uint8 Buffer[1024];
+	uint8 Buffer[2048];
 	int32 BytesRead = 0;
 
 	while (ListenSocket->RecvFrom(Buffer, sizeof(Buffer), BytesRead, *Sender))
 	{
 		if (BytesRead > 0)
 		{
-			TArray<uint8> Data(Buffer, BytesRead);
-			FLBEASTServerInfo ServerInfo;
+			uint32 SenderIP = 0;
+			Sender->GetIp(SenderIP);
+			FLBEASTSessionCapture::Get().Record(CaptureSource, ELBEASTCaptureDirection::Inbound, SenderIP, Buffer, BytesRead);
+			HandleBeaconPacket(TArray<uint8>(Buffer, BytesRead), Sender->ToString(false));
+		}
+	}
+}
 
-			if (DeserializeServerInfo(Data, ServerInfo))
-			{
-				// Override ServerIP with actual sender IP (more reliable than self-reported)
-				ServerInfo.ServerIP = Sender->ToString(false);
+void ULBEASTServerBeacon::HandleIOReactorDatagrams(const TArray<FLBEASTIODatagram>& Datagrams)
+{
+	for (const FLBEASTIODatagram& Datagram : Datagrams)
+	{
+		if (Datagram.Sender.IsValid())
+		{
+			uint32 SenderIP = 0;
+			Datagram.Sender->GetIp(SenderIP);
+			FLBEASTSessionCapture::Get().Record(CaptureSource, ELBEASTCaptureDirection::Inbound, SenderIP, Datagram.Data.GetData(), Datagram.Data.Num(), Datagram.ReceiveTimeSeconds);
+			HandleBeaconPacket(Datagram.Data, Datagram.Sender->ToString(false));
+		}
+	}
+}
 
-				bool bIsNewServer = !DiscoveredServers.Contains(ServerInfo.ServerIP);
+void ULBEASTServerBeacon::HandleCaptureReplay(uint32 Address, const TArray<uint8>& Data)
+{
+	// Address is the sender's IPv4 address, so replayed servers keep their original keys
+	HandleBeaconPacket(Data, FIPv4Address(Address).ToString());
+}
 
-				// Update or add server
-				DiscoveredServers.Add(ServerInfo.ServerIP, ServerInfo);
+void ULBEASTServerBeacon::HandleBeaconPacket(const TArray<uint8>& Data, const FString& SenderIP)
+{
+	FLBEASTServerInfo ServerInfo;
+	if (!DeserializeServerInfo(Data, ServerInfo))
+	{
+		return;
+	}
 
-				if (bIsNewServer)
-				{
-					UE_LOG(LogTemp, Log, TEXT("LBEASTServerBeacon: Discovered server '%s' (%s) at %s:%d"), 
-						*ServerInfo.ServerName, *ServerInfo.ExperienceType, *ServerInfo.ServerIP, ServerInfo.ServerPort);
+	// Override ServerIP with actual sender IP (more reliable than self-reported)
+	ServerInfo.ServerIP = SenderIP;
 
-					OnServerDiscovered.Broadcast(ServerInfo);
-				}
-			}
-		}
+	bool bIsNewServer = !DiscoveredServers.Contains(ServerInfo.ServerIP);
+
+	// Update or add server
+	DiscoveredServers.Add(ServerInfo.ServerIP, ServerInfo);
+
+	if (bIsNewServer)
+	{
+		UE_LOG(LogTemp, Log, TEXT("LBEASTServerBeacon: Discovered server '%s' (%s) at %s:%d"), 
+			*ServerInfo.ServerName, *ServerInfo.ExperienceType, *ServerInfo.ServerIP, ServerInfo.ServerPort);
+
+		OnServerDiscovered.Broadcast(ServerInfo);
 	}
 }
 
@@ -370,6 +484,17 @@ bool ULBEASTServerBeacon::CreateListenSocket()
 
 void ULBEASTServerBeacon::CleanupSockets()
 {
+	// The reactor must stop reading the listen socket before it is destroyed
+	if (IOReactorHandle >= 0)
+	{
+		if (ULBEASTIOReactorSubsystem* Reactor = IOReactor.Get())
+		{
+			Reactor->Unregister(IOReactorHandle);
+		}
+	}
+	IOReactorHandle = -1;
+	IOReactor.Reset();
+
 	if (BroadcastSocket)
 	{
 		BroadcastSocket->Close();
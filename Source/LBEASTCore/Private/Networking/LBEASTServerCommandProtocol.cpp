@@ -1,12 +1,17 @@
 // Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
 
 #include "Networking/LBEASTServerCommandProtocol.h"
+#include "Networking/LBEASTSessionCapture.h"
+#include "Networking/LBEASTIOReactor.h"
 #include "Common/UdpSocketBuilder.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 #include "Serialization/JsonReader.h"
 #include "Dom/JsonObject.h"
 #include "HAL/PlatformProcess.h"
+#include "LBEASTCore.h"
+
+DECLARE_CYCLE_STAT(TEXT("LBEASTServerCommandProtocol Tick"), STAT_LBEASTServerCommandProtocol_Tick, STATGROUP_LBEASTCore);
 
 ULBEASTServerCommandProtocol::ULBEASTServerCommandProtocol()
 {
@@ -41,6 +46,8 @@ bool ULBEASTServerCommandProtocol::InitializeClient(const FString& ServerIP, int
 
 	bIsActive = true;
 	NextSequenceNumber = 0;
+	ClientReactorHandle = RegisterWithIOReactor(CommandSocket, false);
+	ClientCaptureSource = FLBEASTSessionCapture::Get().RegisterSource(FString::Printf(TEXT("Command Client %s:%d"), *TargetServerIP, TargetServerPort));
 
 	UE_LOG(LogTemp, Log, TEXT("LBEASTServerCommandProtocol: Client initialized (target: %s:%d)"), 
 		*TargetServerIP, TargetServerPort);
@@ -59,6 +66,8 @@ void ULBEASTServerCommandProtocol::ShutdownClient()
 	CleanupSocket(CommandSocket);
 	RemoteServerAddr.Reset();
 	bIsActive = false;
+	FLBEASTSessionCapture::Get().UnregisterSource(ClientCaptureSource);
+	ClientCaptureSource = -1;
 
 	UE_LOG(LogTemp, Log, TEXT("LBEASTServerCommandProtocol: Client shutdown"));
 	OnClientShutdown.Broadcast(TEXT("Client shutdown"));
@@ -121,6 +130,9 @@ bool ULBEASTServerCommandProtocol::StartListening()
 	}
 
 	bIsListening = true;
+	ListenReactorHandle = RegisterWithIOReactor(ListenSocket, true);
+	ListenCaptureSource = FLBEASTSessionCapture::Get().RegisterSource(FString::Printf(TEXT("Command Server :%d"), CommandPort),
+		FOnLBEASTCaptureReplay::CreateUObject(this, &ULBEASTServerCommandProtocol::HandleCaptureReplay));
 
 	UE_LOG(LogTemp, Log, TEXT("LBEASTServerCommandProtocol: Started listening on port %d"), CommandPort);
 	OnServerStarted.Broadcast(FString::Printf(TEXT("Listening on port %d"), CommandPort));
@@ -136,6 +148,8 @@ void ULBEASTServerCommandProtocol::StopListening()
 
 	CleanupSocket(ListenSocket);
 	bIsListening = false;
+	FLBEASTSessionCapture::Get().UnregisterSource(ListenCaptureSource);
+	ListenCaptureSource = -1;
 
 	UE_LOG(LogTemp, Log, TEXT("LBEASTServerCommandProtocol: Stopped listening"));
 	OnServerStopped.Broadcast(TEXT("Stopped listening"));
@@ -143,7 +157,10 @@ void ULBEASTServerCommandProtocol::StopListening()
 
 void ULBEASTServerCommandProtocol::Tick(float DeltaTime)
 {
-	if (!bIsListening || !ListenSocket)
+	LBEASTCORE_SCOPE_CYCLE_COUNTER(STAT_LBEASTServerCommandProtocol_Tick);
+
+	// Reactor-registered sockets are delivered in batches by ULBEASTIOReactorSubsystem
+	if (!bIsListening || !ListenSocket || ListenReactorHandle >= 0)
 	{
 		return;
 	}
@@ -153,7 +170,7 @@ void ULBEASTServerCommandProtocol::Tick(float DeltaTime)
 
 void ULBEASTServerCommandProtocol::TickClient(float DeltaTime)
 {
-	if (!bIsActive || !CommandSocket)
+	if (!bIsActive || !CommandSocket || ClientReactorHandle >= 0)
 	{
 		return;
 	}
@@ -163,16 +180,59 @@ void ULBEASTServerCommandProtocol::TickClient(float DeltaTime)
 	TSharedPtr<FInternetAddr> Sender;
 	if (ReceiveUDPData(CommandSocket, ReceivedData, Sender))
 	{
-		// Deserialize response
-		FString JsonString;
-		JsonString.AppendChars((TCHAR*)ReceivedData.GetData(), ReceivedData.Num());
-		
-		FLBEASTServerResponseMessage Response;
-		if (DeserializeResponse(JsonString, Response))
-		{
-			UE_LOG(LogTemp, Verbose, TEXT("LBEASTServerCommandProtocol: Received response: %s"), *Response.Message);
-			// Could broadcast response via delegate if needed
-		}
+		HandleResponsePacket(ReceivedData);
+	}
+}
+
+void ULBEASTServerCommandProtocol::HandleResponsePacket(const TArray<uint8>& ReceivedData)
+{
+	// Deserialize response
+	FString JsonString;
+	JsonString.AppendChars((TCHAR*)ReceivedData.GetData(), ReceivedData.Num());
+	
+	FLBEASTServerResponseMessage Response;
+	if (DeserializeResponse(JsonString, Response))
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("LBEASTServerCommandProtocol: Received response: %s"), *Response.Message);
+		// Could broadcast response via delegate if needed
+	}
+}
+
+int32 ULBEASTServerCommandProtocol::RegisterWithIOReactor(FSocket* Socket, bool bListenSocket)
+{
+	ULBEASTIOReactorSubsystem* Reactor = ULBEASTIOReactorSubsystem::Get(this);
+	if (!Reactor || !Socket)
+	{
+		return -1;
+	}
+
+	const int32 Handle = Reactor->RegisterSocket(Socket,
+		bListenSocket
+			? FOnLBEASTIODatagrams::CreateUObject(this, &ULBEASTServerCommandProtocol::HandleListenDatagrams)
+			: FOnLBEASTIODatagrams::CreateUObject(this, &ULBEASTServerCommandProtocol::HandleClientDatagrams),
+		bListenSocket ? TEXT("CommandServer") : TEXT("CommandClient"));
+	if (Handle >= 0)
+	{
+		IOReactor = Reactor;
+	}
+	return Handle;
+}
+
+void ULBEASTServerCommandProtocol::HandleListenDatagrams(const TArray<FLBEASTIODatagram>& Datagrams)
+{
+	for (const FLBEASTIODatagram& Datagram : Datagrams)
+	{
+		FLBEASTSessionCapture::Get().Record(ListenCaptureSource, ELBEASTCaptureDirection::Inbound, 0, Datagram.Data.GetData(), Datagram.Data.Num());
+		HandleCommandPacket(Datagram.Data, Datagram.Sender);
+	}
+}
+
+void ULBEASTServerCommandProtocol::HandleClientDatagrams(const TArray<FLBEASTIODatagram>& Datagrams)
+{
+	for (const FLBEASTIODatagram& Datagram : Datagrams)
+	{
+		FLBEASTSessionCapture::Get().Record(ClientCaptureSource, ELBEASTCaptureDirection::Inbound, 0, Datagram.Data.GetData(), Datagram.Data.Num());
+		HandleResponsePacket(Datagram.Data);
 	}
 }
 
@@ -258,62 +318,72 @@ void ULBEASTServerCommandProtocol::ProcessIncomingCommands()
 	
 	while (ReceiveUDPData(ListenSocket, ReceivedData, Sender))
 	{
-		if (ReceivedData.Num() == 0)
-		{
-			continue;
-		}
+		HandleCommandPacket(ReceivedData, Sender);
+		ReceivedData.Reset();
+	}
+}
 
-		// Convert to string
-		FString JsonString;
-		JsonString.AppendChars((TCHAR*)ReceivedData.GetData(), ReceivedData.Num());
+void ULBEASTServerCommandProtocol::HandleCommandPacket(const TArray<uint8>& ReceivedData, TSharedPtr<FInternetAddr> Sender)
+{
+	if (ReceivedData.Num() == 0)
+	{
+		return;
+	}
+
+	// Convert to string
+	FString JsonString;
+	JsonString.AppendChars((TCHAR*)ReceivedData.GetData(), ReceivedData.Num());
 
-		// Deserialize command
-		FLBEASTServerCommandMessage Command;
-		if (DeserializeCommand(JsonString, Command))
+	// Deserialize command
+	FLBEASTServerCommandMessage Command;
+	if (DeserializeCommand(JsonString, Command))
+	{
+		// Validate authentication if enabled
+		if (bEnableAuthentication)
 		{
-			// Validate authentication if enabled
-			if (bEnableAuthentication)
+			if (!ValidateAuthToken(Command))
 			{
-				if (!ValidateAuthToken(Command))
+				UE_LOG(LogTemp, Warning, TEXT("LBEASTServerCommandProtocol: Authentication failed for command %d from %s"), 
+					(uint8)Command.Command, 
+					Sender.IsValid() ? *Sender->ToString(false) : TEXT("unknown"));
+				
+				// Send authentication failure response
+				if (Sender.IsValid())
 				{
-					UE_LOG(LogTemp, Warning, TEXT("LBEASTServerCommandProtocol: Authentication failed for command %d from %s"), 
-						(uint8)Command.Command, 
-						Sender.IsValid() ? *Sender->ToString(false) : TEXT("unknown"));
-					
-					// Send authentication failure response
-					if (Sender.IsValid())
-					{
-						FLBEASTServerResponseMessage AuthFailureResponse(false, TEXT("Authentication failed"));
-						SendResponse(AuthFailureResponse, Sender.ToSharedRef());
-					}
-					continue;
+					FLBEASTServerResponseMessage AuthFailureResponse(false, TEXT("Authentication failed"));
+					SendResponse(AuthFailureResponse, Sender.ToSharedRef());
 				}
+				return;
 			}
+		}
 
-			UE_LOG(LogTemp, Verbose, TEXT("LBEASTServerCommandProtocol: Received command %d (seq: %d) from %s"), 
-				(uint8)Command.Command, Command.SequenceNumber, 
-				Sender.IsValid() ? *Sender->ToString(false) : TEXT("unknown"));
-
-			// Store sender address for response
-			LastSenderAddress = Sender;
+		UE_LOG(LogTemp, Verbose, TEXT("LBEASTServerCommandProtocol: Received command %d (seq: %d) from %s"), 
+			(uint8)Command.Command, Command.SequenceNumber, 
+			Sender.IsValid() ? *Sender->ToString(false) : TEXT("unknown"));
 
-			// Broadcast command to handlers - they can request response via SendResponse using GetLastSenderAddress()
-			OnCommandReceived.Broadcast(Command, this);
-			
-			// Clear sender address after delegate (handlers should use GetLastSenderAddress() during delegate execution)
-			// We'll keep it for now in case handler needs it later
+		// Store sender address for response
+		LastSenderAddress = Sender;
 
-			// Optionally send response back (fire-and-forget mode doesn't need this)
-			// For request-response mode, we could send a response here
-		}
-		else
-		{
-			UE_LOG(LogTemp, Warning, TEXT("LBEASTServerCommandProtocol: Failed to deserialize command from %s"), 
-				Sender.IsValid() ? *Sender->ToString(false) : TEXT("unknown"));
-		}
+		// Broadcast command to handlers - they can request response via SendResponse using GetLastSenderAddress()
+		OnCommandReceived.Broadcast(Command, this);
+		
+		// Clear sender address after delegate (handlers should use GetLastSenderAddress() during delegate execution)
+		// We'll keep it for now in case handler needs it later
 
-		ReceivedData.Reset();
+		// Optionally send response back (fire-and-forget mode doesn't need this)
+		// For request-response mode, we could send a response here
 	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("LBEASTServerCommandProtocol: Failed to deserialize command from %s"), 
+			Sender.IsValid() ? *Sender->ToString(false) : TEXT("unknown"));
+	}
+}
+
+void ULBEASTServerCommandProtocol::HandleCaptureReplay(uint32 Address, const TArray<uint8>& Data)
+{
+	// No sender: replayed commands run through the handlers but never get a response
+	HandleCommandPacket(Data, nullptr);
 }
 
 FString ULBEASTServerCommandProtocol::SerializeCommand(const FLBEASTServerCommandMessage& Command) const
@@ -414,6 +484,7 @@ bool ULBEASTServerCommandProtocol::SendUDPData(FSocket* Socket, const TArray<uin
 		return false;
 	}
 
+	FLBEASTSessionCapture::Get().Record(GetCaptureSource(Socket), ELBEASTCaptureDirection::Outbound, 0, Data.GetData(), Data.Num());
 	return true;
 }
 
@@ -444,6 +515,7 @@ bool ULBEASTServerCommandProtocol::ReceiveUDPData(FSocket* Socket, TArray<uint8>
 		if (BytesRead > 0 && BytesRead <= (int32)DataSize)
 		{
 			OutData.SetNum(BytesRead);
+			FLBEASTSessionCapture::Get().Record(GetCaptureSource(Socket), ELBEASTCaptureDirection::Inbound, 0, OutData.GetData(), BytesRead);
 			return true;
 		}
 	}
@@ -461,6 +533,17 @@ void ULBEASTServerCommandProtocol::CleanupSockets()
 
 void ULBEASTServerCommandProtocol::CleanupSocket(FSocket*& Socket)
 {
+	// The reactor must stop reading the socket before it is destroyed
+	int32& ReactorHandle = (&Socket == &ListenSocket) ? ListenReactorHandle : ClientReactorHandle;
+	if (ReactorHandle >= 0)
+	{
+		if (ULBEASTIOReactorSubsystem* Reactor = IOReactor.Get())
+		{
+			Reactor->Unregister(ReactorHandle);
+		}
+		ReactorHandle = -1;
+	}
+
 	if (Socket)
 	{
 		Socket->Close();
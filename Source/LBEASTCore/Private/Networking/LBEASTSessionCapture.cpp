@@ -0,0 +1,804 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "Networking/LBEASTSessionCapture.h"
+#include "LBEASTCore.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/Event.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+DECLARE_CYCLE_STAT(TEXT("Capture Write"), STAT_LBEASTCapture_Write, STATGROUP_LBEASTCore);
+DECLARE_CYCLE_STAT(TEXT("Capture Replay Tick"), STAT_LBEASTCapture_ReplayTick, STATGROUP_LBEASTCore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Capture Records Dropped"), STAT_LBEASTCapture_RecordsDropped, STATGROUP_LBEASTCore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Capture Frames Replayed"), STAT_LBEASTCapture_FramesReplayed, STATGROUP_LBEASTCore);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Capture Queue Depth"), STAT_LBEASTCapture_QueueDepth, STATGROUP_LBEASTCore);
+
+// The file format is defined as little-endian and written with raw copies
+static_assert(PLATFORM_LITTLE_ENDIAN, "LBEAST capture files assume a little-endian host");
+
+namespace
+{
+	const ANSICHAR CaptureMagic[8] = { 'L', 'B', 'E', 'A', 'S', 'T', 'S', 'C' };
+
+	/** Write buffer size at which the writer goes to disk mid-drain */
+	constexpr int32 WriteBufferFlushBytes = 64 * 1024;
+
+	/** Writer thread wait between drains (producers never signal, to keep Record() cheap) */
+	constexpr uint32 WriterWaitMs = 5;
+
+	/** Index record payload: previous index offset, records written, records dropped */
+	constexpr int32 IndexPayloadSize = 24;
+
+	template <typename T>
+	void AppendRaw(TArray<uint8>& Buffer, const T& Value)
+	{
+		Buffer.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+	}
+
+	template <typename T>
+	T ReadRaw(const uint8* Data)
+	{
+		T Value;
+		FMemory::Memcpy(&Value, Data, sizeof(T));
+		return Value;
+	}
+
+	FString DecodeUTF8(const TArray<uint8>& Data)
+	{
+		FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Data.GetData()), Data.Num());
+		return FString(Converter.Length(), Converter.Get());
+	}
+}
+
+// =====================================
+// FLBEASTSessionCapture
+// =====================================
+
+FLBEASTSessionCapture& FLBEASTSessionCapture::Get()
+{
+	static FLBEASTSessionCapture Instance;
+	return Instance;
+}
+
+FLBEASTSessionCapture::FLBEASTSessionCapture()
+{
+}
+
+FLBEASTSessionCapture::~FLBEASTSessionCapture()
+{
+	StopRecording();
+}
+
+int32 FLBEASTSessionCapture::RegisterSource(const FString& Name, FOnLBEASTCaptureReplay ReplayHandler)
+{
+	FScopeLock Lock(&SourcesLock);
+
+	auto IsNameActive = [this](const FString& Candidate)
+	{
+		return Sources.ContainsByPredicate([&Candidate](const FSource& Source) { return Source.bActive && Source.Name == Candidate; });
+	};
+
+	FString UniqueName = Name;
+	for (int32 Suffix = 2; IsNameActive(UniqueName); Suffix++)
+	{
+		UniqueName = FString::Printf(TEXT("%s#%d"), *Name, Suffix);
+	}
+
+	int32 SourceId = Sources.IndexOfByPredicate([&UniqueName](const FSource& Source) { return !Source.bActive && Source.Name == UniqueName; });
+	if (SourceId == INDEX_NONE)
+	{
+		if (Sources.Num() > MAX_uint16)
+		{
+			UE_LOG(LogTemp, Error, TEXT("LBEASTSessionCapture: Too many capture sources, %s will not be recorded"), *UniqueName);
+			return -1;
+		}
+		SourceId = Sources.AddDefaulted();
+		Sources[SourceId].Name = UniqueName;
+	}
+
+	FSource& Source = Sources[SourceId];
+	Source.ReplayHandler = MoveTemp(ReplayHandler);
+	Source.bActive = true;
+
+	if (IsRecording())
+	{
+		EnqueueSourceRecord(SourceId);
+	}
+	return SourceId;
+}
+
+void FLBEASTSessionCapture::SetReplayHandler(int32 SourceId, FOnLBEASTCaptureReplay ReplayHandler)
+{
+	FScopeLock Lock(&SourcesLock);
+	if (Sources.IsValidIndex(SourceId))
+	{
+		Sources[SourceId].ReplayHandler = MoveTemp(ReplayHandler);
+	}
+}
+
+void FLBEASTSessionCapture::UnregisterSource(int32 SourceId)
+{
+	FScopeLock Lock(&SourcesLock);
+	if (Sources.IsValidIndex(SourceId))
+	{
+		Sources[SourceId].bActive = false;
+		Sources[SourceId].ReplayHandler.Unbind();
+	}
+}
+
+bool FLBEASTSessionCapture::ReplayToSource(const FString& Name, uint32 Address, const TArray<uint8>& Data)
+{
+	FOnLBEASTCaptureReplay Handler;
+	{
+		FScopeLock Lock(&SourcesLock);
+		const FSource* Source = Sources.FindByPredicate([&Name](const FSource& Candidate) { return Candidate.bActive && Candidate.Name == Name; });
+		if (!Source || !Source->ReplayHandler.IsBound())
+		{
+			return false;
+		}
+		Handler = Source->ReplayHandler;
+	}
+
+	// Run outside the lock; handlers may register or unregister sources
+	return Handler.ExecuteIfBound(Address, Data);
+}
+
+void FLBEASTSessionCapture::AddMarker(const FString& Text)
+{
+	if (!IsRecording())
+	{
+		return;
+	}
+
+	FTCHARToUTF8 Converter(*Text);
+	EnqueueRecord(ELBEASTCaptureRecordType::Marker, ELBEASTCaptureDirection::Inbound, 0, 0,
+		reinterpret_cast<const uint8*>(Converter.Get()), Converter.Length(), 0.0);
+}
+
+void FLBEASTSessionCapture::EnqueueRecord(ELBEASTCaptureRecordType Type, ELBEASTCaptureDirection Direction, int32 SourceId, uint32 Address, const uint8* Data, int32 Length, double TimestampSeconds)
+{
+	if (QueuedRecords.fetch_add(1, std::memory_order_relaxed) >= MaxQueuedRecords)
+	{
+		// Writer can't keep up (slow disk); never block a transport thread
+		QueuedRecords.fetch_sub(1, std::memory_order_relaxed);
+		RecordsDropped.fetch_add(1, std::memory_order_relaxed);
+		LBEASTCORE_INC_COUNTER(STAT_LBEASTCapture_RecordsDropped, 1);
+		return;
+	}
+
+	FPendingRecord Pending;
+	Pending.Type = Type;
+	Pending.Direction = Direction;
+	Pending.SourceId = (uint16)SourceId;
+	Pending.Address = Address;
+	Pending.TimestampSeconds = TimestampSeconds > 0.0 ? TimestampSeconds : FPlatformTime::Seconds();
+	if (Length > 0 && Data)
+	{
+		Pending.Data.Append(Data, Length);
+	}
+	Queue.Enqueue(MoveTemp(Pending));
+}
+
+void FLBEASTSessionCapture::EnqueueSourceRecord(int32 SourceId)
+{
+	FTCHARToUTF8 Converter(*Sources[SourceId].Name);
+	EnqueueRecord(ELBEASTCaptureRecordType::Source, ELBEASTCaptureDirection::Inbound, SourceId, 0,
+		reinterpret_cast<const uint8*>(Converter.Get()), Converter.Length(), 0.0);
+}
+
+bool FLBEASTSessionCapture::StartRecording(const FString& FilePath)
+{
+	if (IsRecording())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("LBEASTSessionCapture: Already recording to %s"), *RecordingPath);
+		return false;
+	}
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(FilePath));
+	File = PlatformFile.OpenWrite(*FilePath, false, false);
+	if (!File)
+	{
+		UE_LOG(LogTemp, Error, TEXT("LBEASTSessionCapture: Could not create %s"), *FilePath);
+		return false;
+	}
+
+	// Anything left over from a racing producer after the last StopRecording()
+	Queue.Empty();
+	QueuedRecords.store(0, std::memory_order_relaxed);
+	RecordsWritten.store(0, std::memory_order_relaxed);
+	BytesWritten.store(0, std::memory_order_relaxed);
+	RecordsDropped.store(0, std::memory_order_relaxed);
+
+	RecordingPath = FilePath;
+	StartSeconds = FPlatformTime::Seconds();
+	LastFlushSeconds = StartSeconds;
+	FileOffset = 0;
+	PreviousIndexOffset = 0;
+	NextIndexMicros = 0;
+
+	WriteBuffer.Reset();
+	WriteBuffer.Append(reinterpret_cast<const uint8*>(CaptureMagic), sizeof(CaptureMagic));
+	AppendRaw(WriteBuffer, FileVersion);
+	AppendRaw(WriteBuffer, (uint32)HeaderSize);
+	AppendRaw(WriteBuffer, FDateTime::UtcNow().GetTicks());
+	AppendRaw(WriteBuffer, (uint64)0);
+	FlushWriteBuffer();
+
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	bStopRequested = false;
+	WriterThread = FRunnableThread::Create(this, TEXT("LBEAST_CaptureWriter"), 0, TPri_BelowNormal);
+	if (!WriterThread)
+	{
+		UE_LOG(LogTemp, Error, TEXT("LBEASTSessionCapture: Failed to create writer thread"));
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+		delete File;
+		File = nullptr;
+		return false;
+	}
+
+	{
+		// Name every existing source first; RegisterSource() names the ones that appear later
+		FScopeLock Lock(&SourcesLock);
+		for (int32 SourceId = 0; SourceId < Sources.Num(); SourceId++)
+		{
+			if (Sources[SourceId].bActive)
+			{
+				EnqueueSourceRecord(SourceId);
+			}
+		}
+		bRecording.store(true, std::memory_order_release);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("LBEASTSessionCapture: Recording to %s"), *RecordingPath);
+	return true;
+}
+
+void FLBEASTSessionCapture::StopRecording()
+{
+	if (!File)
+	{
+		return;
+	}
+
+	bRecording.store(false, std::memory_order_release);
+
+	if (WriterThread)
+	{
+		// Kill() calls Stop(), which wakes the thread for a last drain
+		WriterThread->Kill(true);
+		delete WriterThread;
+		WriterThread = nullptr;
+	}
+
+	// Writer is gone; finish on this thread
+	DrainQueue();
+	AppendIndex((uint64)FMath::Max(0.0, (FPlatformTime::Seconds() - StartSeconds) * 1e6));
+	FlushWriteBuffer();
+	File->Flush();
+	delete File;
+	File = nullptr;
+
+	if (WakeEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("LBEASTSessionCapture: Stopped recording %s (%lld records, %lld bytes, %lld dropped)"),
+		*RecordingPath, GetRecordsWritten(), GetBytesWritten(), GetRecordsDropped());
+}
+
+uint32 FLBEASTSessionCapture::Run()
+{
+	while (!bStopRequested)
+	{
+		DrainQueue();
+		WakeEvent->Wait(WriterWaitMs);
+	}
+	DrainQueue();
+	return 0;
+}
+
+void FLBEASTSessionCapture::Stop()
+{
+	bStopRequested = true;
+	if (WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+void FLBEASTSessionCapture::DrainQueue()
+{
+	LBEASTCORE_SCOPE_CYCLE_COUNTER(STAT_LBEASTCapture_Write);
+	LBEASTCORE_SET_GAUGE(STAT_LBEASTCapture_QueueDepth, QueuedRecords.load(std::memory_order_relaxed));
+
+	FPendingRecord Pending;
+	while (Queue.Dequeue(Pending))
+	{
+		QueuedRecords.fetch_sub(1, std::memory_order_relaxed);
+
+		const uint64 TimeMicros = (uint64)FMath::Max(0.0, (Pending.TimestampSeconds - StartSeconds) * 1e6);
+		if (TimeMicros >= NextIndexMicros)
+		{
+			AppendIndex(TimeMicros);
+		}
+
+		AppendRecord(Pending.Type, Pending.Direction, Pending.SourceId, Pending.Address, TimeMicros, Pending.Data.GetData(), Pending.Data.Num());
+		if (WriteBuffer.Num() >= WriteBufferFlushBytes)
+		{
+			FlushWriteBuffer();
+		}
+	}
+	FlushWriteBuffer();
+
+	const double Now = FPlatformTime::Seconds();
+	if (File && Now - LastFlushSeconds >= FlushIntervalSeconds)
+	{
+		File->Flush();
+		LastFlushSeconds = Now;
+	}
+}
+
+void FLBEASTSessionCapture::AppendRecord(ELBEASTCaptureRecordType Type, ELBEASTCaptureDirection Direction, uint16 SourceId, uint32 Address, uint64 TimeMicros, const uint8* Data, int32 Length)
+{
+	AppendRaw(WriteBuffer, (uint8)Type);
+	AppendRaw(WriteBuffer, (uint8)Direction);
+	AppendRaw(WriteBuffer, SourceId);
+	AppendRaw(WriteBuffer, Address);
+	AppendRaw(WriteBuffer, (uint32)Length);
+	AppendRaw(WriteBuffer, TimeMicros);
+	if (Length > 0)
+	{
+		WriteBuffer.Append(Data, Length);
+	}
+	RecordsWritten.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FLBEASTSessionCapture::AppendIndex(uint64 TimeMicros)
+{
+	const uint64 IndexOffset = FileOffset + WriteBuffer.Num();
+
+	uint8 Payload[IndexPayloadSize];
+	const uint64 Written = (uint64)RecordsWritten.load(std::memory_order_relaxed);
+	const uint64 Dropped = (uint64)RecordsDropped.load(std::memory_order_relaxed);
+	FMemory::Memcpy(Payload, &PreviousIndexOffset, 8);
+	FMemory::Memcpy(Payload + 8, &Written, 8);
+	FMemory::Memcpy(Payload + 16, &Dropped, 8);
+	AppendRecord(ELBEASTCaptureRecordType::Index, ELBEASTCaptureDirection::Inbound, 0, 0, TimeMicros, Payload, IndexPayloadSize);
+
+	PreviousIndexOffset = IndexOffset;
+	NextIndexMicros = TimeMicros + (uint64)(FMath::Max(IndexIntervalSeconds, 0.01) * 1e6);
+}
+
+void FLBEASTSessionCapture::FlushWriteBuffer()
+{
+	if (File && WriteBuffer.Num() > 0)
+	{
+		File->Write(WriteBuffer.GetData(), WriteBuffer.Num());
+		FileOffset += WriteBuffer.Num();
+		BytesWritten.fetch_add(WriteBuffer.Num(), std::memory_order_relaxed);
+	}
+	WriteBuffer.Reset();
+}
+
+// =====================================
+// FLBEASTCaptureReader
+// =====================================
+
+FLBEASTCaptureReader::~FLBEASTCaptureReader()
+{
+	Close();
+}
+
+bool FLBEASTCaptureReader::Open(const FString& FilePath, FString& OutError)
+{
+	Close();
+
+	Reader.Reset(IFileManager::Get().CreateFileReader(*FilePath));
+	if (!Reader.IsValid())
+	{
+		OutError = FString::Printf(TEXT("Could not open %s"), *FilePath);
+		return false;
+	}
+
+	FileSize = Reader->TotalSize();
+	uint8 Header[FLBEASTSessionCapture::HeaderSize];
+	if (FileSize < FLBEASTSessionCapture::HeaderSize)
+	{
+		OutError = FString::Printf(TEXT("%s is too small to be a capture file"), *FilePath);
+		Close();
+		return false;
+	}
+	Reader->Serialize(Header, sizeof(Header));
+
+	const uint32 Version = ReadRaw<uint32>(Header + 8);
+	const uint32 HeaderSize = ReadRaw<uint32>(Header + 12);
+	if (FMemory::Memcmp(Header, CaptureMagic, sizeof(CaptureMagic)) != 0 || Version == 0 || Version > FLBEASTSessionCapture::FileVersion
+		|| HeaderSize < (uint32)FLBEASTSessionCapture::HeaderSize || HeaderSize > (uint64)FileSize)
+	{
+		OutError = FString::Printf(TEXT("%s is not a supported LBEAST capture file"), *FilePath);
+		Close();
+		return false;
+	}
+	StartTimeUtc = FDateTime(ReadRaw<int64>(Header + 16));
+
+	// One pass over the record headers; stop at a truncated tail
+	Reader->Seek(HeaderSize);
+	int64 ValidEnd = HeaderSize;
+	ELBEASTCaptureRecordType Type;
+	ELBEASTCaptureDirection Direction;
+	uint16 SourceId;
+	uint32 Address;
+	uint32 Length;
+	uint64 TimeMicros;
+	while (ReadRecordHeader(Type, Direction, SourceId, Address, Length, TimeMicros))
+	{
+		const int64 RecordOffset = Reader->Tell() - FLBEASTSessionCapture::RecordHeaderSize;
+		const int64 PayloadEnd = Reader->Tell() + Length;
+		if (PayloadEnd > FileSize)
+		{
+			break;
+		}
+
+		const double TimeSeconds = TimeMicros * 1e-6;
+		switch (Type)
+		{
+			case ELBEASTCaptureRecordType::Source:
+			{
+				TArray<uint8> NameBytes;
+				NameBytes.SetNumUninitialized(Length);
+				Reader->Serialize(NameBytes.GetData(), Length);
+				SourceNames.Add(SourceId, DecodeUTF8(NameBytes));
+				break;
+			}
+			case ELBEASTCaptureRecordType::Index:
+				IndexEntries.Add({ TimeSeconds, RecordOffset });
+				break;
+			case ELBEASTCaptureRecordType::Frame:
+				FrameCount++;
+				DurationSeconds = FMath::Max(DurationSeconds, TimeSeconds);
+				break;
+			default:
+				break;
+		}
+
+		Reader->Seek(PayloadEnd);
+		ValidEnd = PayloadEnd;
+	}
+
+	if (ValidEnd < FileSize)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("LBEASTCaptureReader: %s ends with %lld bytes of incomplete record (recording was interrupted)"),
+			*FilePath, FileSize - ValidEnd);
+	}
+	FileSize = ValidEnd;
+
+	Reader->Seek(HeaderSize);
+	return true;
+}
+
+void FLBEASTCaptureReader::Close()
+{
+	Reader.Reset();
+	FileSize = 0;
+	DurationSeconds = 0.0;
+	FrameCount = 0;
+	SourceNames.Reset();
+	IndexEntries.Reset();
+}
+
+bool FLBEASTCaptureReader::ReadRecordHeader(ELBEASTCaptureRecordType& OutType, ELBEASTCaptureDirection& OutDirection, uint16& OutSourceId, uint32& OutAddress, uint32& OutLength, uint64& OutTimeMicros)
+{
+	if (!Reader.IsValid() || Reader->Tell() + FLBEASTSessionCapture::RecordHeaderSize > FileSize)
+	{
+		return false;
+	}
+
+	uint8 Header[FLBEASTSessionCapture::RecordHeaderSize];
+	Reader->Serialize(Header, sizeof(Header));
+	OutType = (ELBEASTCaptureRecordType)Header[0];
+	OutDirection = (ELBEASTCaptureDirection)Header[1];
+	OutSourceId = ReadRaw<uint16>(Header + 2);
+	OutAddress = ReadRaw<uint32>(Header + 4);
+	OutLength = ReadRaw<uint32>(Header + 8);
+	OutTimeMicros = ReadRaw<uint64>(Header + 12);
+	return true;
+}
+
+bool FLBEASTCaptureReader::ReadNext(FLBEASTCaptureRecord& OutRecord)
+{
+	uint32 Length = 0;
+	uint64 TimeMicros = 0;
+	if (!ReadRecordHeader(OutRecord.Type, OutRecord.Direction, OutRecord.SourceId, OutRecord.Address, Length, TimeMicros)
+		|| Reader->Tell() + Length > FileSize)
+	{
+		return false;
+	}
+
+	OutRecord.TimeSeconds = TimeMicros * 1e-6;
+	OutRecord.Data.SetNumUninitialized(Length, EAllowShrinking::No);
+	if (Length > 0)
+	{
+		Reader->Serialize(OutRecord.Data.GetData(), Length);
+	}
+	return true;
+}
+
+void FLBEASTCaptureReader::SeekToTime(double TimeSeconds)
+{
+	if (!Reader.IsValid())
+	{
+		return;
+	}
+
+	int64 Offset = FLBEASTSessionCapture::HeaderSize;
+	for (const FIndexEntry& Entry : IndexEntries)
+	{
+		if (Entry.TimeSeconds > TimeSeconds)
+		{
+			break;
+		}
+		Offset = Entry.Offset;
+	}
+	Reader->Seek(Offset);
+}
+
+FString FLBEASTCaptureReader::GetSourceName(uint16 SourceId) const
+{
+	const FString* Name = SourceNames.Find(SourceId);
+	return Name ? *Name : FString();
+}
+
+// =====================================
+// ULBEASTSessionCaptureSubsystem
+// =====================================
+
+ULBEASTSessionCaptureSubsystem* ULBEASTSessionCaptureSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<ULBEASTSessionCaptureSubsystem>() : nullptr;
+}
+
+void ULBEASTSessionCaptureSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	FString Path;
+	if (FParse::Value(FCommandLine::Get(), TEXT("LBEASTCapture="), Path))
+	{
+		StartRecording(Path);
+	}
+	else if (FParse::Param(FCommandLine::Get(), TEXT("LBEASTCapture")))
+	{
+		StartRecording();
+	}
+
+	if (FParse::Value(FCommandLine::Get(), TEXT("LBEASTReplay="), Path))
+	{
+		float Rate = 1.0f;
+		float Delay = 2.0f;
+		FParse::Value(FCommandLine::Get(), TEXT("LBEASTReplayRate="), Rate);
+		FParse::Value(FCommandLine::Get(), TEXT("LBEASTReplayDelay="), Delay);
+		if (StartReplay(Path, Rate))
+		{
+			ReplayDelaySeconds = FMath::Max(Delay, 0.0f);
+		}
+	}
+}
+
+void ULBEASTSessionCaptureSubsystem::Deinitialize()
+{
+	StopReplay();
+	if (bOwnsRecording)
+	{
+		StopRecording();
+	}
+
+	Super::Deinitialize();
+}
+
+bool ULBEASTSessionCaptureSubsystem::StartRecording(const FString& FilePath)
+{
+	const FString Path = !FilePath.IsEmpty() ? FilePath : FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Captures"),
+		FString::Printf(TEXT("Session-%s.lbcap"), *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S"))));
+
+	bOwnsRecording = FLBEASTSessionCapture::Get().StartRecording(Path);
+	return bOwnsRecording;
+}
+
+void ULBEASTSessionCaptureSubsystem::StopRecording()
+{
+	FLBEASTSessionCapture::Get().StopRecording();
+	bOwnsRecording = false;
+}
+
+void ULBEASTSessionCaptureSubsystem::AddMarker(const FString& Text)
+{
+	FLBEASTSessionCapture::Get().AddMarker(Text);
+}
+
+bool ULBEASTSessionCaptureSubsystem::IsRecording() const
+{
+	return FLBEASTSessionCapture::Get().IsRecording();
+}
+
+bool ULBEASTSessionCaptureSubsystem::StartReplay(const FString& FilePath, float PlaybackRate, float StartOffsetSeconds, bool bLoop)
+{
+	StopReplay();
+
+	TUniquePtr<FLBEASTCaptureReader> Reader = MakeUnique<FLBEASTCaptureReader>();
+	FString Error;
+	if (!Reader->Open(FilePath, Error))
+	{
+		UE_LOG(LogTemp, Error, TEXT("LBEASTSessionCaptureSubsystem: %s"), *Error);
+		return false;
+	}
+
+	ReplayStartOffsetSeconds = FMath::Max(StartOffsetSeconds, 0.0f);
+	Reader->SeekToTime(ReplayStartOffsetSeconds);
+
+	UE_LOG(LogTemp, Log, TEXT("LBEASTSessionCaptureSubsystem: Replaying %s (recorded %s, %.1f s, %lld frames, %d sources) at %.2fx"),
+		*FilePath, *Reader->GetStartTimeUtc().ToString(), Reader->GetDurationSeconds(), Reader->GetFrameCount(),
+		Reader->GetSources().Num(), PlaybackRate);
+
+	ReplayReader = MoveTemp(Reader);
+	ReplayPath = FilePath;
+	ReplayRate = FMath::Max(PlaybackRate, 0.0f);
+	ReplayClockSeconds = ReplayStartOffsetSeconds;
+	bReplayLoop = bLoop;
+	ReplayDelaySeconds = 0.0f;
+	bHasPendingRecord = false;
+	FramesReplayed = 0;
+	FramesUnmatched = 0;
+	UnmatchedSources.Reset();
+	return true;
+}
+
+void ULBEASTSessionCaptureSubsystem::StopReplay()
+{
+	if (ReplayReader.IsValid())
+	{
+		UE_LOG(LogTemp, Log, TEXT("LBEASTSessionCaptureSubsystem: Replay stopped (%lld frames replayed, %lld unmatched)"),
+			FramesReplayed, FramesUnmatched);
+		ReplayReader.Reset();
+	}
+	bHasPendingRecord = false;
+}
+
+FLBEASTSessionCaptureStats ULBEASTSessionCaptureSubsystem::GetCaptureStats() const
+{
+	const FLBEASTSessionCapture& Capture = FLBEASTSessionCapture::Get();
+
+	FLBEASTSessionCaptureStats Stats;
+	Stats.bRecording = Capture.IsRecording();
+	Stats.RecordingPath = Capture.GetRecordingPath();
+	Stats.RecordsWritten = Capture.GetRecordsWritten();
+	Stats.BytesWritten = Capture.GetBytesWritten();
+	Stats.RecordsDropped = Capture.GetRecordsDropped();
+	Stats.bReplaying = ReplayReader.IsValid();
+	Stats.ReplayPath = ReplayPath;
+	Stats.ReplayPositionSeconds = (float)ReplayClockSeconds;
+	Stats.ReplayDurationSeconds = ReplayReader.IsValid() ? (float)ReplayReader->GetDurationSeconds() : 0.0f;
+	Stats.FramesReplayed = FramesReplayed;
+	Stats.FramesUnmatched = FramesUnmatched;
+	return Stats;
+}
+
+void ULBEASTSessionCaptureSubsystem::Tick(float DeltaTime)
+{
+	LBEASTCORE_SCOPE_CYCLE_COUNTER(STAT_LBEASTCapture_ReplayTick);
+
+	if (!ReplayReader.IsValid())
+	{
+		return;
+	}
+
+	if (ReplayDelaySeconds > 0.0f)
+	{
+		ReplayDelaySeconds -= DeltaTime;
+		return;
+	}
+
+	const bool bUnpaced = ReplayRate <= 0.0f;
+	if (!bUnpaced)
+	{
+		ReplayClockSeconds += DeltaTime * ReplayRate;
+	}
+
+	for (int32 Dispatched = 0; Dispatched < MaxReplayRecordsPerTick; Dispatched++)
+	{
+		if (!bHasPendingRecord)
+		{
+			if (!ReplayReader->ReadNext(PendingRecord))
+			{
+				if (bReplayLoop)
+				{
+					ReplayReader->SeekToTime(ReplayStartOffsetSeconds);
+					ReplayClockSeconds = ReplayStartOffsetSeconds;
+					return;
+				}
+
+				UE_LOG(LogTemp, Log, TEXT("LBEASTSessionCaptureSubsystem: Reached end of %s"), *ReplayPath);
+				StopReplay();
+				OnReplayFinished.Broadcast();
+				return;
+			}
+			bHasPendingRecord = true;
+		}
+
+		if (!bUnpaced && PendingRecord.TimeSeconds > ReplayClockSeconds)
+		{
+			return;
+		}
+
+		bHasPendingRecord = false;
+		if (PendingRecord.TimeSeconds < ReplayStartOffsetSeconds)
+		{
+			// Between the index checkpoint and the requested start
+			continue;
+		}
+
+		ReplayClockSeconds = FMath::Max(ReplayClockSeconds, PendingRecord.TimeSeconds);
+		DispatchReplayRecord(PendingRecord);
+	}
+}
+
+void ULBEASTSessionCaptureSubsystem::DispatchReplayRecord(const FLBEASTCaptureRecord& Record)
+{
+	switch (Record.Type)
+	{
+		case ELBEASTCaptureRecordType::Frame:
+		{
+			if (Record.Direction != ELBEASTCaptureDirection::Inbound)
+			{
+				return;
+			}
+
+			const FString SourceName = ReplayReader->GetSourceName(Record.SourceId);
+			if (FLBEASTSessionCapture::Get().ReplayToSource(SourceName, Record.Address, Record.Data))
+			{
+				FramesReplayed++;
+				LBEASTCORE_INC_COUNTER(STAT_LBEASTCapture_FramesReplayed, 1);
+			}
+			else
+			{
+				FramesUnmatched++;
+				if (!UnmatchedSources.Contains(SourceName))
+				{
+					UnmatchedSources.Add(SourceName);
+					UE_LOG(LogTemp, Warning, TEXT("LBEASTSessionCaptureSubsystem: No live transport for source '%s' - its frames are skipped"), *SourceName);
+				}
+			}
+			break;
+		}
+
+		case ELBEASTCaptureRecordType::Marker:
+		{
+			const FString Text = DecodeUTF8(Record.Data);
+			UE_LOG(LogTemp, Display, TEXT("LBEASTSessionCaptureSubsystem: Marker at %.3f s: %s"), Record.TimeSeconds, *Text);
+			OnReplayMarker.Broadcast(Text, (float)Record.TimeSeconds);
+			break;
+		}
+
+		default:
+			break;
+	}
+}
+
+TStatId ULBEASTSessionCaptureSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(ULBEASTSessionCaptureSubsystem, STATGROUP_Tickables);
+}
@@ -0,0 +1,584 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "Networking/LBEASTSocketCANTransport.h"
+#include "Networking/LBEASTSessionCapture.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+#include "LBEASTCore.h"
+
+#if PLATFORM_LINUX
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <net/if.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#endif
+
+DECLARE_CYCLE_STAT(TEXT("SocketCAN Transmit"), STAT_LBEASTSocketCAN_Transmit, STATGROUP_LBEASTCore);
+DECLARE_CYCLE_STAT(TEXT("SocketCAN Receive"), STAT_LBEASTSocketCAN_Receive, STATGROUP_LBEASTCore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("CAN Frames Sent"), STAT_LBEASTSocketCAN_FramesSent, STATGROUP_LBEASTCore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("CAN Frames Received"), STAT_LBEASTSocketCAN_FramesReceived, STATGROUP_LBEASTCore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("CAN Frames Dropped"), STAT_LBEASTSocketCAN_FramesDropped, STATGROUP_LBEASTCore);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("CAN Receive Queue Depth"), STAT_LBEASTSocketCAN_QueueDepth, STATGROUP_LBEASTCore);
+
+namespace
+{
+	/** Upper bound on how long the I/O thread sleeps when nothing is scheduled */
+	constexpr double MaxIdleWaitSeconds = 0.05;
+
+	/** Largest batch the I/O thread will allocate on its stack */
+	constexpr int32 MaxBatchSize = 64;
+
+	/** Capture address flag bits (same layout as Linux can_id, so captures read the same on any platform) */
+	constexpr uint32 CaptureExtendedFlag = 0x80000000;
+	constexpr uint32 CaptureRemoteFlag = 0x40000000;
+	constexpr uint32 CaptureErrorFlag = 0x20000000;
+	constexpr uint32 CaptureIdMask = 0x1FFFFFFF;
+
+	uint32 EncodeCaptureAddress(const FLBEASTCANFrame& Frame)
+	{
+		return (Frame.CanId & CaptureIdMask)
+			| (Frame.bExtended ? CaptureExtendedFlag : 0)
+			| (Frame.bRemote ? CaptureRemoteFlag : 0)
+			| (Frame.bError ? CaptureErrorFlag : 0);
+	}
+}
+
+FLBEASTSocketCANTransport::FLBEASTSocketCANTransport(const FLBEASTSocketCANConfig& InConfig)
+	: Config(InConfig)
+{
+	Config.BatchSize = FMath::Clamp(Config.BatchSize, 1, MaxBatchSize);
+	Config.MaxQueuedFrames = FMath::Max(Config.MaxQueuedFrames, 1);
+
+	// Registered for the transport's lifetime so a capture can be replayed on a box without the bus
+	CaptureSource = FLBEASTSessionCapture::Get().RegisterSource(FString::Printf(TEXT("CAN %s"), *Config.InterfaceName),
+		FOnLBEASTCaptureReplay::CreateRaw(this, &FLBEASTSocketCANTransport::HandleCaptureReplay));
+}
+
+FLBEASTSocketCANTransport::~FLBEASTSocketCANTransport()
+{
+	FLBEASTSessionCapture::Get().UnregisterSource(CaptureSource);
+	Shutdown();
+}
+
+bool FLBEASTSocketCANTransport::Initialize()
+{
+#if PLATFORM_LINUX
+	if (bConnected)
+	{
+		return true;
+	}
+
+	SocketFd = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+	if (SocketFd < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("SocketCANTransport: Failed to create CAN socket (%s)"), UTF8_TO_TCHAR(strerror(errno)));
+		return false;
+	}
+
+	// Resolve interface index
+	struct ifreq InterfaceRequest;
+	FMemory::Memzero(InterfaceRequest);
+	FCStringAnsi::Strncpy(InterfaceRequest.ifr_name, TCHAR_TO_UTF8(*Config.InterfaceName), IFNAMSIZ);
+	if (ioctl(SocketFd, SIOCGIFINDEX, &InterfaceRequest) < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("SocketCANTransport: Interface %s not found (%s)"), *Config.InterfaceName, UTF8_TO_TCHAR(strerror(errno)));
+		Shutdown();
+		return false;
+	}
+
+	// Kernel-side ID filters (cheaper than filtering on the game thread). The mask covers the ID and
+	// frame format only, so remote frames for a matching ID still arrive.
+	if (Config.Filters.Num() > 0)
+	{
+		TArray<struct can_filter> KernelFilters;
+		for (const FLBEASTCANFilter& Filter : Config.Filters)
+		{
+			struct can_filter& KernelFilter = KernelFilters.AddZeroed_GetRef();
+			KernelFilter.can_id = Filter.bExtended ? ((Filter.Id & CAN_EFF_MASK) | CAN_EFF_FLAG) : (Filter.Id & CAN_SFF_MASK);
+			KernelFilter.can_mask = Filter.bExtended ? ((Filter.Mask & CAN_EFF_MASK) | CAN_EFF_FLAG) : ((Filter.Mask & CAN_SFF_MASK) | CAN_EFF_FLAG);
+		}
+		setsockopt(SocketFd, SOL_CAN_RAW, CAN_RAW_FILTER, KernelFilters.GetData(), KernelFilters.Num() * sizeof(struct can_filter));
+	}
+
+	if (Config.bReceiveErrorFrames)
+	{
+		can_err_mask_t ErrorMask = CAN_ERR_MASK;
+		setsockopt(SocketFd, SOL_CAN_RAW, CAN_RAW_ERR_FILTER, &ErrorMask, sizeof(ErrorMask));
+	}
+
+	if (Config.bReceiveOwnFrames)
+	{
+		int32 Enable = 1;
+		setsockopt(SocketFd, SOL_CAN_RAW, CAN_RAW_RECV_OWN_MSGS, &Enable, sizeof(Enable));
+	}
+
+	int32 EnableTimestamps = 1;
+	setsockopt(SocketFd, SOL_SOCKET, SO_TIMESTAMPNS, &EnableTimestamps, sizeof(EnableTimestamps));
+
+	struct sockaddr_can Address;
+	FMemory::Memzero(Address);
+	Address.can_family = AF_CAN;
+	Address.can_ifindex = InterfaceRequest.ifr_ifindex;
+	if (bind(SocketFd, (struct sockaddr*)&Address, sizeof(Address)) < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("SocketCANTransport: Failed to bind to %s (%s)"), *Config.InterfaceName, UTF8_TO_TCHAR(strerror(errno)));
+		Shutdown();
+		return false;
+	}
+
+	fcntl(SocketFd, F_SETFL, fcntl(SocketFd, F_GETFL, 0) | O_NONBLOCK);
+
+	WakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (WakeFd < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("SocketCANTransport: Failed to create wake eventfd (%s)"), UTF8_TO_TCHAR(strerror(errno)));
+		Shutdown();
+		return false;
+	}
+
+	bStopRequested = false;
+	bConnected = true;
+
+	IOThread = FRunnableThread::Create(this, *FString::Printf(TEXT("LBEAST_SocketCAN_%s"), *Config.InterfaceName), 0, TPri_AboveNormal);
+	if (!IOThread)
+	{
+		UE_LOG(LogTemp, Error, TEXT("SocketCANTransport: Failed to create I/O thread"));
+		Shutdown();
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("SocketCANTransport: Connected to %s (%d filters, batch %d)"), *Config.InterfaceName, Config.Filters.Num(), Config.BatchSize);
+	return true;
+#else
+	UE_LOG(LogTemp, Error, TEXT("SocketCANTransport: SocketCAN is only available on Linux"));
+	return false;
+#endif
+}
+
+void FLBEASTSocketCANTransport::Shutdown()
+{
+	bConnected = false;
+
+	if (IOThread)
+	{
+		// Kill() calls Stop(), which wakes the thread out of poll()
+		IOThread->Kill(true);
+		delete IOThread;
+		IOThread = nullptr;
+	}
+
+#if PLATFORM_LINUX
+	if (SocketFd >= 0)
+	{
+		close(SocketFd);
+		SocketFd = -1;
+		UE_LOG(LogTemp, Log, TEXT("SocketCANTransport: %s closed"), *Config.InterfaceName);
+	}
+	if (WakeFd >= 0)
+	{
+		close(WakeFd);
+		WakeFd = -1;
+	}
+#endif
+
+	TransmitQueue.Empty();
+	ReceiveQueue.Empty();
+	ReceiveQueueDepth.Reset();
+	ReplayFrames.Reset();
+
+	FScopeLock Lock(&CyclicLock);
+	CyclicFrames.Reset();
+}
+
+bool FLBEASTSocketCANTransport::Send(uint32 Address, const uint8* Data, int32 Length)
+{
+	if (Length < 0 || Length > 8 || (Length > 0 && !Data))
+	{
+		return false;
+	}
+
+	FLBEASTCANFrame Frame;
+	Frame.CanId = Address;
+	Frame.bExtended = Address > 0x7FF;
+	Frame.Length = (uint8)Length;
+	if (Length > 0)
+	{
+		FMemory::Memcpy(Frame.Data, Data, Length);
+	}
+	return SendFrame(Frame);
+}
+
+bool FLBEASTSocketCANTransport::SendFrame(const FLBEASTCANFrame& Frame)
+{
+	if (!bConnected || Frame.Length > 8)
+	{
+		return false;
+	}
+
+	TransmitQueue.Enqueue(Frame);
+	WakeIOThread();
+	return true;
+}
+
+int32 FLBEASTSocketCANTransport::Receive(TArray<FLBEASTTransportFrame>& OutFrames, int32 MaxFrames)
+{
+	LBEASTCORE_SET_GAUGE(STAT_LBEASTSocketCAN_QueueDepth, ReceiveQueueDepth.GetValue());
+
+	auto AddFrame = [&OutFrames](const FLBEASTCANFrame& Frame)
+	{
+		FLBEASTTransportFrame& Out = OutFrames.AddDefaulted_GetRef();
+		Out.Address = Frame.CanId;
+		Out.Data.Append(Frame.Data, Frame.Length);
+		Out.TimestampSeconds = Frame.TimestampSeconds;
+	};
+
+	int32 Count = 0;
+	if (ReplayFrames.Num() > 0)
+	{
+		Count = FMath::Min(ReplayFrames.Num(), MaxFrames);
+		for (int32 i = 0; i < Count; i++)
+		{
+			AddFrame(ReplayFrames[i]);
+		}
+		ReplayFrames.RemoveAt(0, Count, EAllowShrinking::No);
+	}
+
+	FLBEASTCANFrame Frame;
+	while (Count < MaxFrames && ReceiveQueue.Dequeue(Frame))
+	{
+		ReceiveQueueDepth.Decrement();
+		AddFrame(Frame);
+		Count++;
+	}
+	return Count;
+}
+
+int32 FLBEASTSocketCANTransport::ReceiveFrames(TArray<FLBEASTCANFrame>& OutFrames, int32 MaxFrames)
+{
+	LBEASTCORE_SET_GAUGE(STAT_LBEASTSocketCAN_QueueDepth, ReceiveQueueDepth.GetValue());
+
+	int32 Count = 0;
+	if (ReplayFrames.Num() > 0)
+	{
+		Count = FMath::Min(ReplayFrames.Num(), MaxFrames);
+		OutFrames.Append(ReplayFrames.GetData(), Count);
+		ReplayFrames.RemoveAt(0, Count, EAllowShrinking::No);
+	}
+
+	FLBEASTCANFrame Frame;
+	while (Count < MaxFrames && ReceiveQueue.Dequeue(Frame))
+	{
+		ReceiveQueueDepth.Decrement();
+		OutFrames.Add(Frame);
+		Count++;
+	}
+	return Count;
+}
+
+void FLBEASTSocketCANTransport::HandleCaptureReplay(uint32 Address, const TArray<uint8>& Data)
+{
+	if (ReplayFrames.Num() >= Config.MaxQueuedFrames)
+	{
+		FramesDropped.Increment();
+		return;
+	}
+
+	FLBEASTCANFrame& Frame = ReplayFrames.AddDefaulted_GetRef();
+	Frame.bExtended = (Address & CaptureExtendedFlag) != 0;
+	Frame.bRemote = (Address & CaptureRemoteFlag) != 0;
+	Frame.bError = (Address & CaptureErrorFlag) != 0;
+	Frame.CanId = Address & CaptureIdMask;
+	Frame.Length = (uint8)FMath::Min(Data.Num(), 8);
+	FMemory::Memcpy(Frame.Data, Data.GetData(), Frame.Length);
+	Frame.TimestampSeconds = FPlatformTime::Seconds();
+}
+
+int32 FLBEASTSocketCANTransport::AddCyclicFrame(const FLBEASTCANFrame& Frame, float IntervalMs)
+{
+	if (IntervalMs <= 0.0f || Frame.Length > 8)
+	{
+		return -1;
+	}
+
+	FScopeLock Lock(&CyclicLock);
+	FCyclicEntry& Entry = CyclicFrames.AddDefaulted_GetRef();
+	Entry.Handle = NextCyclicHandle++;
+	Entry.Frame = Frame;
+	Entry.IntervalSeconds = IntervalMs / 1000.0;
+	Entry.NextDueSeconds = FPlatformTime::Seconds();
+	WakeIOThread();
+	return Entry.Handle;
+}
+
+bool FLBEASTSocketCANTransport::UpdateCyclicFrame(int32 Handle, const FLBEASTCANFrame& Frame)
+{
+	if (Frame.Length > 8)
+	{
+		return false;
+	}
+
+	FScopeLock Lock(&CyclicLock);
+	for (FCyclicEntry& Entry : CyclicFrames)
+	{
+		if (Entry.Handle == Handle)
+		{
+			Entry.Frame = Frame;
+			return true;
+		}
+	}
+	return false;
+}
+
+void FLBEASTSocketCANTransport::RemoveCyclicFrame(int32 Handle)
+{
+	FScopeLock Lock(&CyclicLock);
+	CyclicFrames.RemoveAll([Handle](const FCyclicEntry& Entry) { return Entry.Handle == Handle; });
+}
+
+uint32 FLBEASTSocketCANTransport::Run()
+{
+#if PLATFORM_LINUX
+	struct pollfd PollFds[2];
+	PollFds[0].fd = SocketFd;
+	PollFds[0].events = POLLIN;
+	PollFds[1].fd = WakeFd;
+	PollFds[1].events = POLLIN;
+
+	while (!bStopRequested)
+	{
+		const int32 TimeoutMs = FMath::CeilToInt(GetCyclicWaitSeconds() * 1000.0);
+		const int32 Ready = poll(PollFds, 2, TimeoutMs);
+		if (Ready < 0 && errno != EINTR)
+		{
+			UE_LOG(LogTemp, Error, TEXT("SocketCANTransport: poll() failed (%s)"), UTF8_TO_TCHAR(strerror(errno)));
+			break;
+		}
+
+		if (Ready > 0 && (PollFds[1].revents & POLLIN))
+		{
+			uint64 WakeCount = 0;
+			ssize_t Ignored = read(WakeFd, &WakeCount, sizeof(WakeCount));
+			(void)Ignored;
+		}
+
+		if (Ready > 0 && (PollFds[0].revents & POLLIN))
+		{
+			DrainReceive();
+		}
+
+		FlushTransmit();
+	}
+#endif
+	return 0;
+}
+
+void FLBEASTSocketCANTransport::Stop()
+{
+	bStopRequested = true;
+	WakeIOThread();
+}
+
+void FLBEASTSocketCANTransport::WakeIOThread()
+{
+#if PLATFORM_LINUX
+	if (WakeFd >= 0)
+	{
+		const uint64 One = 1;
+		ssize_t Ignored = write(WakeFd, &One, sizeof(One));
+		(void)Ignored;
+	}
+#endif
+}
+
+double FLBEASTSocketCANTransport::GetCyclicWaitSeconds() const
+{
+	FScopeLock Lock(&CyclicLock);
+	const double Now = FPlatformTime::Seconds();
+	double Wait = MaxIdleWaitSeconds;
+	for (const FCyclicEntry& Entry : CyclicFrames)
+	{
+		Wait = FMath::Min(Wait, Entry.NextDueSeconds - Now);
+	}
+	return FMath::Max(Wait, 0.0);
+}
+
+void FLBEASTSocketCANTransport::FlushTransmit()
+{
+#if PLATFORM_LINUX
+	LBEASTCORE_SCOPE_CYCLE_COUNTER(STAT_LBEASTSocketCAN_Transmit);
+
+	struct can_frame Frames[MaxBatchSize];
+	struct mmsghdr Messages[MaxBatchSize];
+	struct iovec Vectors[MaxBatchSize];
+	int32 Count = 0;
+
+	auto SendBatch = [&]()
+	{
+		int32 Offset = 0;
+		while (Offset < Count)
+		{
+			const int32 Sent = sendmmsg(SocketFd, Messages + Offset, Count - Offset, 0);
+			if (Sent <= 0)
+			{
+				// ENOBUFS/EAGAIN: TX queue full - drop the rest of this batch rather than stall the thread
+				SendErrors.Add(Count - Offset);
+				break;
+			}
+			FramesSent.Add(Sent);
+			LBEASTCORE_INC_COUNTER(STAT_LBEASTSocketCAN_FramesSent, Sent);
+			Offset += Sent;
+		}
+		Count = 0;
+	};
+
+	auto AddFrame = [&](const FLBEASTCANFrame& Source)
+	{
+		struct can_frame& Frame = Frames[Count];
+		FMemory::Memzero(Frame);
+		Frame.can_id = Source.bExtended ? ((Source.CanId & CAN_EFF_MASK) | CAN_EFF_FLAG) : (Source.CanId & CAN_SFF_MASK);
+		if (Source.bRemote)
+		{
+			Frame.can_id |= CAN_RTR_FLAG;
+		}
+		Frame.can_dlc = Source.Length;
+		FMemory::Memcpy(Frame.data, Source.Data, Source.Length);
+		FLBEASTSessionCapture::Get().Record(CaptureSource, ELBEASTCaptureDirection::Outbound, EncodeCaptureAddress(Source), Source.Data, Source.Length);
+
+		Vectors[Count].iov_base = &Frame;
+		Vectors[Count].iov_len = sizeof(struct can_frame);
+		FMemory::Memzero(Messages[Count]);
+		Messages[Count].msg_hdr.msg_iov = &Vectors[Count];
+		Messages[Count].msg_hdr.msg_iovlen = 1;
+
+		if (++Count == Config.BatchSize)
+		{
+			SendBatch();
+		}
+	};
+
+	// Due cyclic frames first (keepalives must not starve behind a burst of commands)
+	{
+		FScopeLock Lock(&CyclicLock);
+		const double Now = FPlatformTime::Seconds();
+		for (FCyclicEntry& Entry : CyclicFrames)
+		{
+			if (Now >= Entry.NextDueSeconds)
+			{
+				AddFrame(Entry.Frame);
+				// Phase-locked schedule; skip missed slots instead of bursting
+				Entry.NextDueSeconds += Entry.IntervalSeconds;
+				if (Entry.NextDueSeconds < Now)
+				{
+					Entry.NextDueSeconds = Now + Entry.IntervalSeconds;
+				}
+			}
+		}
+	}
+
+	FLBEASTCANFrame Queued;
+	while (TransmitQueue.Dequeue(Queued))
+	{
+		AddFrame(Queued);
+	}
+
+	if (Count > 0)
+	{
+		SendBatch();
+	}
+#endif
+}
+
+void FLBEASTSocketCANTransport::DrainReceive()
+{
+#if PLATFORM_LINUX
+	LBEASTCORE_SCOPE_CYCLE_COUNTER(STAT_LBEASTSocketCAN_Receive);
+
+	struct can_frame Frames[MaxBatchSize];
+	struct mmsghdr Messages[MaxBatchSize];
+	struct iovec Vectors[MaxBatchSize];
+	uint8 Control[MaxBatchSize][CMSG_SPACE(sizeof(struct timespec))];
+
+	const int32 BatchSize = Config.BatchSize;
+	for (;;)
+	{
+		for (int32 i = 0; i < BatchSize; i++)
+		{
+			Vectors[i].iov_base = &Frames[i];
+			Vectors[i].iov_len = sizeof(struct can_frame);
+			FMemory::Memzero(Messages[i]);
+			Messages[i].msg_hdr.msg_iov = &Vectors[i];
+			Messages[i].msg_hdr.msg_iovlen = 1;
+			Messages[i].msg_hdr.msg_control = Control[i];
+			Messages[i].msg_hdr.msg_controllen = sizeof(Control[i]);
+		}
+
+		const int32 Received = recvmmsg(SocketFd, Messages, BatchSize, MSG_DONTWAIT, nullptr);
+		if (Received <= 0)
+		{
+			return;
+		}
+		LBEASTCORE_INC_COUNTER(STAT_LBEASTSocketCAN_FramesReceived, Received);
+
+		// Map kernel CLOCK_REALTIME stamps onto the FPlatformTime timebase once per batch
+		struct timespec RealNow;
+		clock_gettime(CLOCK_REALTIME, &RealNow);
+		const double RealNowSeconds = RealNow.tv_sec + RealNow.tv_nsec * 1e-9;
+		const double PlatformNowSeconds = FPlatformTime::Seconds();
+
+		for (int32 i = 0; i < Received; i++)
+		{
+			if (Messages[i].msg_len < sizeof(struct can_frame))
+			{
+				continue;
+			}
+
+			const struct can_frame& Source = Frames[i];
+			FLBEASTCANFrame Frame;
+			Frame.bExtended = (Source.can_id & CAN_EFF_FLAG) != 0;
+			Frame.bRemote = (Source.can_id & CAN_RTR_FLAG) != 0;
+			Frame.bError = (Source.can_id & CAN_ERR_FLAG) != 0;
+			Frame.CanId = Source.can_id & (Frame.bExtended ? CAN_EFF_MASK : CAN_SFF_MASK);
+			Frame.Length = FMath::Min<uint8>(Source.can_dlc, 8);
+			FMemory::Memcpy(Frame.Data, Source.data, Frame.Length);
+			Frame.TimestampSeconds = PlatformNowSeconds;
+
+			for (struct cmsghdr* Header = CMSG_FIRSTHDR(&Messages[i].msg_hdr); Header; Header = CMSG_NXTHDR(&Messages[i].msg_hdr, Header))
+			{
+				if (Header->cmsg_level == SOL_SOCKET && Header->cmsg_type == SCM_TIMESTAMPNS)
+				{
+					struct timespec Stamp;
+					FMemory::Memcpy(&Stamp, CMSG_DATA(Header), sizeof(Stamp));
+					const double AgeSeconds = RealNowSeconds - (Stamp.tv_sec + Stamp.tv_nsec * 1e-9);
+					Frame.TimestampSeconds = PlatformNowSeconds - FMath::Max(AgeSeconds, 0.0);
+				}
+			}
+
+			FramesReceived.Increment();
+			FLBEASTSessionCapture::Get().Record(CaptureSource, ELBEASTCaptureDirection::Inbound, EncodeCaptureAddress(Frame), Frame.Data, Frame.Length, Frame.TimestampSeconds);
+			if (ReceiveQueueDepth.GetValue() >= Config.MaxQueuedFrames)
+			{
+				// Game thread isn't draining; drop newest rather than grow without bound
+				FramesDropped.Increment();
+				LBEASTCORE_INC_COUNTER(STAT_LBEASTSocketCAN_FramesDropped, 1);
+				continue;
+			}
+			ReceiveQueue.Enqueue(Frame);
+			ReceiveQueueDepth.Increment();
+		}
+
+		if (Received < BatchSize)
+		{
+			return;
+		}
+	}
+#endif
+}
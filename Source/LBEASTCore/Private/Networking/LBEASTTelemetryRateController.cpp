@@ -0,0 +1,330 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "Networking/LBEASTTelemetryRateController.h"
+#include "Networking/LBEASTUDPTransport.h"
+#include "Networking/LBEASTIOReactor.h"
+#include "LBEASTCore.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+
+DECLARE_CYCLE_STAT(TEXT("Telemetry Rate Plan"), STAT_LBEASTTelemetryRate_Plan, STATGROUP_LBEASTCore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Telemetry Interval Commands"), STAT_LBEASTTelemetryRate_Commands, STATGROUP_LBEASTCore);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Throttled Telemetry Streams"), STAT_LBEASTTelemetryRate_Throttled, STATGROUP_LBEASTCore);
+
+namespace
+{
+	/** Re-send only when the planned interval moves this far from the commanded one */
+	constexpr float ResendTolerance = 0.1f;
+
+	/** Budget multiplier applied per plan while the reactor is dropping datagrams, and its floor */
+	constexpr float DropBackoff = 0.75f;
+	constexpr float MinBudgetScale = 0.1f;
+
+	/** Budget recovery per plan once drops stop */
+	constexpr float BudgetRecovery = 0.05f;
+
+	struct FPlannedStream
+	{
+		const FLBEASTTelemetryStream* Stream = nullptr;
+		int32* PlannedIntervalMs = nullptr;
+		float DesiredIntervalMs = 0.0f;
+	};
+
+	float StretchedInterval(const FPlannedStream& Planned, float Factor)
+	{
+		const float MinMs = (float)FMath::Max(Planned.Stream->MinIntervalMs, 1);
+		const float MaxMs = FMath::Max((float)Planned.Stream->MaxIntervalMs, MinMs);
+		return FMath::Clamp(Planned.DesiredIntervalMs * Factor, MinMs, MaxMs);
+	}
+
+	/** Packets/s the streams produce with every interval stretched by Factor */
+	float TierRate(const TArray<FPlannedStream>& Tier, float Factor)
+	{
+		float Rate = 0.0f;
+		for (const FPlannedStream& Planned : Tier)
+		{
+			Rate += 1000.0f / StretchedInterval(Planned, Factor);
+		}
+		return Rate;
+	}
+
+	/** Smallest stretch factor >= 1 that fits the tier in AvailableRate (intervals are clamped, so bisect) */
+	float SolveStretch(const TArray<FPlannedStream>& Tier, float AvailableRate)
+	{
+		if (TierRate(Tier, 1.0f) <= AvailableRate)
+		{
+			return 1.0f;
+		}
+
+		float Low = 1.0f;
+		float High = 1000.0f;
+		for (int32 Iteration = 0; Iteration < 24; Iteration++)
+		{
+			const float Mid = 0.5f * (Low + High);
+			if (TierRate(Tier, Mid) <= AvailableRate)
+			{
+				High = Mid;
+			}
+			else
+			{
+				Low = Mid;
+			}
+		}
+		return High;
+	}
+
+	void ApplyStretch(TArray<FPlannedStream>& Tier, float Factor)
+	{
+		for (FPlannedStream& Planned : Tier)
+		{
+			*Planned.PlannedIntervalMs = FMath::RoundToInt32(StretchedInterval(Planned, Factor));
+		}
+	}
+}
+
+ULBEASTTelemetryRateSubsystem* ULBEASTTelemetryRateSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<ULBEASTTelemetryRateSubsystem>() : nullptr;
+}
+
+void ULBEASTTelemetryRateSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	FParse::Value(FCommandLine::Get(), TEXT("LBEASTPacketBudget="), GlobalPacketBudget);
+	GlobalPacketBudget = FMath::Max(GlobalPacketBudget, 1.0f);
+}
+
+void ULBEASTTelemetryRateSubsystem::Deinitialize()
+{
+	Registrations.Empty();
+	Super::Deinitialize();
+}
+
+void ULBEASTTelemetryRateSubsystem::RegisterTransport(ULBEASTUDPTransport* Transport)
+{
+	if (!Transport)
+	{
+		return;
+	}
+
+	// Re-registration (reconnect) starts over so every interval is re-sent
+	UnregisterTransport(Transport);
+
+	FRegistration& Registration = Registrations.AddDefaulted_GetRef();
+	Registration.Transport = Transport;
+	Registration.Streams.SetNum(Transport->TelemetryStreams.Num());
+
+	UE_LOG(LogTemp, Log, TEXT("LBEASTTelemetryRate: Managing %d stream(s) on %s"), Registration.Streams.Num(), *Transport->GetName());
+	RequestReplan();
+}
+
+void ULBEASTTelemetryRateSubsystem::UnregisterTransport(ULBEASTUDPTransport* Transport)
+{
+	Registrations.RemoveAllSwap([Transport](const FRegistration& Registration)
+	{
+		return !Registration.Transport.IsValid() || Registration.Transport.Get() == Transport;
+	});
+}
+
+void ULBEASTTelemetryRateSubsystem::Tick(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+	if (Now < NextPlanSeconds && !bReplanRequested)
+	{
+		return;
+	}
+
+	LBEASTCORE_SCOPE_CYCLE_COUNTER(STAT_LBEASTTelemetryRate_Plan);
+
+	// Session changes re-plan immediately but only measure on the regular cadence
+	if (Now >= NextPlanSeconds)
+	{
+		NextPlanSeconds = Now + PlanIntervalSeconds;
+		MeasureLoad(Now);
+	}
+	bReplanRequested = false;
+
+	Plan();
+	Apply(Now);
+}
+
+TStatId ULBEASTTelemetryRateSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(ULBEASTTelemetryRateSubsystem, STATGROUP_Tickables);
+}
+
+void ULBEASTTelemetryRateSubsystem::MeasureLoad(double NowSeconds)
+{
+	// The I/O reactor sees every hardware socket; without it, count what the managed transports received
+	int64 Received = 0;
+	int64 Dropped = 0;
+	if (const ULBEASTIOReactorSubsystem* Reactor = ULBEASTIOReactorSubsystem::Get(this))
+	{
+		const FLBEASTIOReactorStats ReactorStats = Reactor->GetReactorStats();
+		Received = ReactorStats.DatagramsReceived;
+		Dropped = ReactorStats.DatagramsDropped;
+	}
+	if (Received == 0)
+	{
+		for (const FRegistration& Registration : Registrations)
+		{
+			if (const ULBEASTUDPTransport* Transport = Registration.Transport.Get())
+			{
+				Received += Transport->GetPacketsReceivedTotal();
+			}
+		}
+	}
+
+	const double Elapsed = NowSeconds - LastMeasureSeconds;
+	if (LastReceived >= 0 && Elapsed > 0.0 && Received >= LastReceived)
+	{
+		const float Rate = (float)((Received - LastReceived) / Elapsed);
+		Stats.ReceivePacketsPerSecond = FMath::Lerp(Stats.ReceivePacketsPerSecond, Rate, 0.5f);
+	}
+
+	// Dropped datagrams mean the receive path is saturated below the configured budget
+	if (Dropped > LastDropped && LastReceived >= 0)
+	{
+		BudgetScale = FMath::Max(BudgetScale * DropBackoff, MinBudgetScale);
+		UE_LOG(LogTemp, Warning, TEXT("LBEASTTelemetryRate: %lld datagrams dropped; packet budget reduced to %.0f/s"),
+			Dropped - LastDropped, GlobalPacketBudget * BudgetScale);
+	}
+	else
+	{
+		BudgetScale = FMath::Min(BudgetScale + BudgetRecovery, 1.0f);
+	}
+
+	LastReceived = Received;
+	LastDropped = Dropped;
+	LastMeasureSeconds = NowSeconds;
+}
+
+void ULBEASTTelemetryRateSubsystem::Plan()
+{
+	TArray<FPlannedStream> ActiveTier;
+	TArray<FPlannedStream> IdleTier;
+	float CommandedRate = 0.0f;
+	int32 TransportCount = 0;
+
+	for (FRegistration& Registration : Registrations)
+	{
+		const ULBEASTUDPTransport* Transport = Registration.Transport.Get();
+		if (!Transport || Transport->TelemetryStreams.Num() != Registration.Streams.Num())
+		{
+			continue;
+		}
+		TransportCount++;
+
+		for (int32 i = 0; i < Registration.Streams.Num(); i++)
+		{
+			const FLBEASTTelemetryStream& Stream = Transport->TelemetryStreams[i];
+			FStreamState& State = Registration.Streams[i];
+
+			FPlannedStream Planned;
+			Planned.Stream = &Stream;
+			Planned.PlannedIntervalMs = &State.PlannedIntervalMs;
+			Planned.DesiredIntervalMs = (float)FMath::Max(Transport->IsTelemetrySessionActive() ? Stream.ActiveIntervalMs : Stream.IdleIntervalMs, 1);
+			(Transport->IsTelemetrySessionActive() ? ActiveTier : IdleTier).Add(Planned);
+
+			// ECUs that haven't been commanded yet run at roughly their idle rate
+			CommandedRate += 1000.0f / (float)FMath::Max(State.CommandedIntervalMs > 0 ? State.CommandedIntervalMs : Stream.IdleIntervalMs, 1);
+		}
+	}
+
+	// Whatever we measure beyond what the managed streams send is load we can't control
+	const float Budget = GlobalPacketBudget * BudgetScale;
+	const float UnmanagedRate = FMath::Max(Stats.ReceivePacketsPerSecond - CommandedRate, 0.0f);
+	const float Available = FMath::Max(Budget - UnmanagedRate, 0.0f);
+
+	// Idle streams give way first; active streams are only slowed once idle ones are at their slowest
+	const float ActiveDesired = TierRate(ActiveTier, 1.0f);
+	const float IdleFloor = TierRate(IdleTier, TNumericLimits<float>::Max());
+	if (ActiveDesired + IdleFloor <= Available)
+	{
+		ApplyStretch(ActiveTier, 1.0f);
+		ApplyStretch(IdleTier, SolveStretch(IdleTier, Available - ActiveDesired));
+	}
+	else
+	{
+		ApplyStretch(IdleTier, TNumericLimits<float>::Max());
+		ApplyStretch(ActiveTier, SolveStretch(ActiveTier, Available - IdleFloor));
+	}
+
+	int32 Throttled = 0;
+	float PlannedRate = 0.0f;
+	for (const TArray<FPlannedStream>* Tier : { &ActiveTier, &IdleTier })
+	{
+		for (const FPlannedStream& Planned : *Tier)
+		{
+			PlannedRate += 1000.0f / (float)FMath::Max(*Planned.PlannedIntervalMs, 1);
+			if (*Planned.PlannedIntervalMs > FMath::RoundToInt32(Planned.DesiredIntervalMs))
+			{
+				Throttled++;
+			}
+		}
+	}
+
+	if (Throttled > 0 && Stats.ThrottledStreams == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("LBEASTTelemetryRate: Throttling %d stream(s) to fit %.0f packets/s (%.0f/s unmanaged)"),
+			Throttled, Budget, UnmanagedRate);
+	}
+
+	Stats.Transports = TransportCount;
+	Stats.Streams = ActiveTier.Num() + IdleTier.Num();
+	Stats.ThrottledStreams = Throttled;
+	Stats.ManagedPacketsPerSecond = PlannedRate;
+	Stats.EffectiveBudget = Budget;
+	LBEASTCORE_SET_GAUGE(STAT_LBEASTTelemetryRate_Throttled, Throttled);
+}
+
+void ULBEASTTelemetryRateSubsystem::Apply(double NowSeconds)
+{
+	for (FRegistration& Registration : Registrations)
+	{
+		ULBEASTUDPTransport* Transport = Registration.Transport.Get();
+		if (!Transport || !Transport->IsUDPConnected() || Transport->TelemetryStreams.Num() != Registration.Streams.Num())
+		{
+			continue;
+		}
+
+		const bool bRefresh = NowSeconds >= Registration.NextRefreshSeconds;
+		if (bRefresh)
+		{
+			Registration.NextRefreshSeconds = NowSeconds + RefreshIntervalSeconds;
+		}
+
+		for (int32 i = 0; i < Registration.Streams.Num(); i++)
+		{
+			FStreamState& State = Registration.Streams[i];
+			if (State.PlannedIntervalMs <= 0)
+			{
+				continue;
+			}
+
+			const bool bChanged = State.CommandedIntervalMs <= 0
+				|| FMath::Abs(State.PlannedIntervalMs - State.CommandedIntervalMs) > State.CommandedIntervalMs * ResendTolerance;
+			if (!bChanged && !bRefresh)
+			{
+				continue;
+			}
+
+			const FLBEASTTelemetryStream& Stream = Transport->TelemetryStreams[i];
+			if (bChanged)
+			{
+				UE_LOG(LogTemp, Log, TEXT("LBEASTTelemetryRate: %s %s -> %d ms (Ch%d)"),
+					*Transport->GetName(), *Stream.StreamName.ToString(), State.PlannedIntervalMs, Stream.IntervalChannel);
+			}
+
+			Transport->SendTelemetryInterval(Stream.IntervalChannel, State.PlannedIntervalMs);
+			State.CommandedIntervalMs = State.PlannedIntervalMs;
+			LBEASTCORE_INC_COUNTER(STAT_LBEASTTelemetryRate_Commands, 1);
+		}
+	}
+}
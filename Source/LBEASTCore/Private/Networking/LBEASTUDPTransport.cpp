@@ -1,7 +1,18 @@
 // Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
 
 #include "Networking/LBEASTUDPTransport.h"
+#include "Networking/LBEASTSessionCapture.h"
+#include "GameFramework/Actor.h"
 #include "IPAddress.h"
+#include "LBEASTCore.h"
+
+DECLARE_CYCLE_STAT(TEXT("UDP Transport Tick"), STAT_LBEASTUDP_Tick, STATGROUP_LBEASTCore);
+DECLARE_CYCLE_STAT(TEXT("UDP Parse Packet"), STAT_LBEASTUDP_ParsePacket, STATGROUP_LBEASTCore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("UDP Packets Received"), STAT_LBEASTUDP_PacketsReceived, STATGROUP_LBEASTCore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("UDP Bytes Received"), STAT_LBEASTUDP_BytesReceived, STATGROUP_LBEASTCore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("UDP Packets Sent"), STAT_LBEASTUDP_PacketsSent, STATGROUP_LBEASTCore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("UDP Bytes Sent"), STAT_LBEASTUDP_BytesSent, STATGROUP_LBEASTCore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("UDP Packets Built"), STAT_LBEASTUDP_PacketsBuilt, STATGROUP_LBEASTCore);
 
 ULBEASTUDPTransport::ULBEASTUDPTransport()
 {
@@ -27,8 +38,10 @@ void ULBEASTUDPTransport::EndPlay(const EEndPlayReason::Type EndPlayReason)
 void ULBEASTUDPTransport::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	LBEASTCORE_SCOPE_CYCLE_COUNTER(STAT_LBEASTUDP_Tick);
 
-	if (IsUDPConnected())
+	// Reactor-registered sockets are delivered in batches by ULBEASTIOReactorSubsystem
+	if (IsUDPConnected() && IOReactorHandle < 0)
 	{
 		ProcessIncomingUDPData();
 	}
@@ -39,19 +52,146 @@ bool ULBEASTUDPTransport::InitializeUDPConnection(const FString& RemoteIP, int32
 	UE_LOG(LogTemp, Log, TEXT("LBEASTUDPTransport: Initializing UDP connection to %s:%d"), *RemoteIP, RemotePort);
 
 	// Use base transport for socket management
-	return UDPTransport.InitializeUDPConnection(RemoteIP, RemotePort, SocketName, false);
+	UnregisterFromIOReactor();
+	if (!UDPTransport.InitializeUDPConnection(RemoteIP, RemotePort, SocketName, false))
+	{
+		return false;
+	}
+
+	FLBEASTSessionCapture::Get().SetReplayHandler(UDPTransport.GetCaptureSource(),
+		FOnLBEASTCaptureReplay::CreateUObject(this, &ULBEASTUDPTransport::HandleCaptureReplay));
+
+	FLBEASTDeviceHealthRegistry& Health = FLBEASTDeviceHealthRegistry::Get();
+	Health.UnregisterDevice(HealthHandle);
+	const AActor* Owner = GetOwner();
+	HealthHandle = Health.RegisterDevice(
+		FString::Printf(TEXT("%s.%s (%s:%d)"), Owner ? *Owner->GetName() : TEXT("None"), *GetName(), *RemoteIP, RemotePort),
+		TEXT("udp"), HealthConfig);
+
+	if (TelemetryStreams.Num() > 0)
+	{
+		if (ULBEASTTelemetryRateSubsystem* RateSubsystem = ULBEASTTelemetryRateSubsystem::Get(this))
+		{
+			RateSubsystem->RegisterTransport(this);
+			TelemetryRate = RateSubsystem;
+		}
+	}
+
+	RegisterWithIOReactor();
+	return true;
 }
 
 void ULBEASTUDPTransport::ShutdownUDPConnection()
 {
+	// Unregister first: the reactor and the safety lane must stop using the socket before it is destroyed
+	UnregisterFromIOReactor();
+	FLBEASTSafetyLane::Get().CancelOwner(this);
 	UDPTransport.ShutdownUDPConnection();
 
+	FLBEASTDeviceHealthRegistry::Get().UnregisterDevice(HealthHandle);
+	HealthHandle = -1;
+
+	if (ULBEASTTelemetryRateSubsystem* RateSubsystem = TelemetryRate.Get())
+	{
+		RateSubsystem->UnregisterTransport(this);
+	}
+	TelemetryRate.Reset();
+
 	ReceivedFloatCache.Empty();
 	ReceivedBoolCache.Empty();
 	ReceivedInt32Cache.Empty();
 	ReceivedBytesCache.Empty();
 }
 
+void ULBEASTUDPTransport::SetTelemetrySessionActive(bool bActive)
+{
+	if (bTelemetrySessionActive == bActive)
+	{
+		return;
+	}
+
+	bTelemetrySessionActive = bActive;
+	if (ULBEASTTelemetryRateSubsystem* RateSubsystem = TelemetryRate.Get())
+	{
+		RateSubsystem->RequestReplan();
+	}
+}
+
+void ULBEASTUDPTransport::SendTelemetryInterval(int32 Channel, int32 IntervalMs)
+{
+	SendInt32(Channel, IntervalMs);
+}
+
+// =====================================
+// Safety Lane
+// =====================================
+
+bool ULBEASTUDPTransport::SendSafetyBool(int32 Channel, bool Value)
+{
+	const double CallSeconds = FPlatformTime::Seconds();
+	if (!IsUDPConnected())
+	{
+		UE_LOG(LogTemp, Error, TEXT("LBEASTUDPTransport: Cannot send safety command (Ch:%d) - UDP not connected"), Channel);
+		return false;
+	}
+
+	FLBEASTSafetyLane& SafetyLane = FLBEASTSafetyLane::Get();
+	const uint16 Sequence = SafetyLane.AllocateSequence();
+
+	// Safety payload: [Sequence:LE16][Value:1]
+	TArray<uint8> Payload;
+	Payload.Add(Sequence & 0xFF);
+	Payload.Add((Sequence >> 8) & 0xFF);
+	Payload.Add(Value ? 1 : 0);
+
+	FLBEASTSafetyCommand Command;
+	Command.Owner = this;
+	Command.Socket = UDPTransport.GetSocket();
+	Command.RemoteAddress = UDPTransport.GetRemoteAddress();
+	Command.Packet = BuildDevicePacket(ELBEASTUDPDataType::Safety, Channel, Payload);
+	Command.Channel = Channel;
+	Command.Sequence = Sequence;
+	Command.CallSeconds = CallSeconds;
+	Command.CaptureSource = UDPTransport.GetCaptureSource();
+	Command.HealthHandle = HealthHandle;
+	Command.Config = SafetyLaneConfig;
+
+	bool bSent = false;
+	if (Command.Packet.Num() > 0)
+	{
+		bSent = SafetyLane.Submit(MoveTemp(Command));
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("LBEASTUDPTransport: Device format cannot carry safety packets - sending plain bool only (Ch:%d)"), Channel);
+	}
+
+	if (SafetyLaneConfig.bSendLegacyBool || !bSent)
+	{
+		TArray<uint8> LegacyPayload;
+		LegacyPayload.Add(Value ? 1 : 0);
+		SendUDPData(BuildDevicePacket(ELBEASTUDPDataType::Bool, Channel, LegacyPayload));
+	}
+
+	return bSent;
+}
+
+bool ULBEASTUDPTransport::IsSafetyCommandPending(int32 Channel) const
+{
+	return FLBEASTSafetyLane::Get().IsPending(this, Channel);
+}
+
+FLBEASTSafetyLaneStats ULBEASTUDPTransport::GetSafetyLaneStats()
+{
+	return FLBEASTSafetyLane::Get().GetStats();
+}
+
+float ULBEASTUDPTransport::GetRoundTripP50Ms() const
+{
+	FLBEASTDeviceHealthStatus Status;
+	return HealthHandle >= 0 && FLBEASTDeviceHealthRegistry::Get().GetStatus(HealthHandle, Status) ? Status.RttP50Ms : 0.0f;
+}
+
 // =====================================
 // Channel-Based Send API Implementation
 // =====================================
@@ -184,6 +324,8 @@ TArray<uint8> ULBEASTUDPTransport::GetReceivedBytes(int32 Channel) const
 
 void ULBEASTUDPTransport::SendUDPData(const TArray<uint8>& Data)
 {
+	LBEASTCORE_INC_COUNTER(STAT_LBEASTUDP_PacketsSent, 1);
+	LBEASTCORE_INC_COUNTER(STAT_LBEASTUDP_BytesSent, Data.Num());
 	UDPTransport.SendUDPData(Data);
 }
 
@@ -193,10 +335,20 @@ void ULBEASTUDPTransport::ReceiveUDPData()
 	int32 BytesRead = 0;
 	TSharedPtr<FInternetAddr> SenderAddr;
 
-	if (UDPTransport.ReceiveUDPData(ReceivedData, BytesRead, &SenderAddr))
+	// Drain everything queued since last tick (bounded so a flood can't stall the frame)
+	for (int32 PacketCount = 0; PacketCount < MAX_PACKETS_PER_TICK; PacketCount++)
 	{
+		if (!UDPTransport.ReceiveUDPData(ReceivedData, BytesRead, &SenderAddr))
+		{
+			break;
+		}
+
 		UE_LOG(LogTemp, VeryVerbose, TEXT("LBEASTUDPTransport: Received %d bytes"), BytesRead);
-		ParseBinaryPacket(ReceivedData, BytesRead);
+		LBEASTCORE_INC_COUNTER(STAT_LBEASTUDP_PacketsReceived, 1);
+		LBEASTCORE_INC_COUNTER(STAT_LBEASTUDP_BytesReceived, BytesRead);
+		FLBEASTDeviceHealthRegistry::Get().ReportPacket(HealthHandle);
+		PacketsReceivedTotal++;
+		HandleReceivedPacket(ReceivedData, BytesRead);
 	}
 }
 
@@ -205,12 +357,85 @@ void ULBEASTUDPTransport::ProcessIncomingUDPData()
 	ReceiveUDPData();
 }
 
+void ULBEASTUDPTransport::HandleReceivedPacket(const TArray<uint8>& Data, int32 Length)
+{
+	ParseBinaryPacket(Data, Length);
+}
+
+void ULBEASTUDPTransport::RegisterWithIOReactor()
+{
+	if (!bUseIOReactor || !UDPTransport.GetSocket())
+	{
+		return;
+	}
+
+	ULBEASTIOReactorSubsystem* Reactor = ULBEASTIOReactorSubsystem::Get(this);
+	if (!Reactor)
+	{
+		// No game instance (e.g. editor preview) - fall back to polling from TickComponent
+		return;
+	}
+
+	IOReactorHandle = Reactor->RegisterSocket(
+		UDPTransport.GetSocket(),
+		FOnLBEASTIODatagrams::CreateUObject(this, &ULBEASTUDPTransport::HandleIOReactorDatagrams),
+		GetName());
+
+	if (IOReactorHandle >= 0)
+	{
+		IOReactor = Reactor;
+	}
+}
+
+void ULBEASTUDPTransport::UnregisterFromIOReactor()
+{
+	if (IOReactorHandle >= 0)
+	{
+		if (ULBEASTIOReactorSubsystem* Reactor = IOReactor.Get())
+		{
+			Reactor->Unregister(IOReactorHandle);
+		}
+	}
+
+	IOReactorHandle = -1;
+	IOReactor.Reset();
+}
+
+void ULBEASTUDPTransport::HandleIOReactorDatagrams(const TArray<FLBEASTIODatagram>& Datagrams)
+{
+	FLBEASTSessionCapture& Capture = FLBEASTSessionCapture::Get();
+	FLBEASTDeviceHealthRegistry& Health = FLBEASTDeviceHealthRegistry::Get();
+	for (const FLBEASTIODatagram& Datagram : Datagrams)
+	{
+		Capture.Record(UDPTransport.GetCaptureSource(), ELBEASTCaptureDirection::Inbound, 0,
+			Datagram.Data.GetData(), Datagram.Data.Num(), Datagram.ReceiveTimeSeconds);
+		UE_LOG(LogTemp, VeryVerbose, TEXT("LBEASTUDPTransport: Received %d bytes"), Datagram.Data.Num());
+		LBEASTCORE_INC_COUNTER(STAT_LBEASTUDP_PacketsReceived, 1);
+		LBEASTCORE_INC_COUNTER(STAT_LBEASTUDP_BytesReceived, Datagram.Data.Num());
+		Health.ReportPacket(HealthHandle, Datagram.ReceiveTimeSeconds);
+		PacketsReceivedTotal++;
+		HandleReceivedPacket(Datagram.Data, Datagram.Data.Num());
+	}
+}
+
+void ULBEASTUDPTransport::HandleCaptureReplay(uint32 Address, const TArray<uint8>& Data)
+{
+	FLBEASTDeviceHealthRegistry::Get().ReportPacket(HealthHandle);
+	HandleReceivedPacket(Data, Data.Num());
+}
+
 // =====================================
 // LBEAST Binary Protocol Implementation
 // =====================================
 
+TArray<uint8> ULBEASTUDPTransport::BuildDevicePacket(ELBEASTUDPDataType DataType, int32 Channel, const TArray<uint8>& Payload)
+{
+	return BuildBinaryPacket(DataType, Channel, Payload);
+}
+
 TArray<uint8> ULBEASTUDPTransport::BuildBinaryPacket(ELBEASTUDPDataType DataType, int32 Channel, const TArray<uint8>& Payload)
 {
+	LBEASTCORE_INC_COUNTER(STAT_LBEASTUDP_PacketsBuilt, 1);
 	TArray<uint8> Packet;
 
 	// Simple LBEAST format: [0xAA][Type][Ch][Payload][CRC:1]
@@ -230,6 +455,8 @@ TArray<uint8> ULBEASTUDPTransport::BuildBinaryPacket(ELBEASTUDPDataType DataType
 
 void ULBEASTUDPTransport::ParseBinaryPacket(const TArray<uint8>& Data, int32 Length)
 {
+	LBEASTCORE_SCOPE_CYCLE_COUNTER(STAT_LBEASTUDP_ParsePacket);
+
 	// Validate start marker
 	if (Length < 1 || Data[0] != PACKET_START_MARKER)
 	{
@@ -333,6 +560,14 @@ void ULBEASTUDPTransport::ParseBinaryPacket(const TArray<uint8>& Data, int32 Len
 		break;
 	}
 
+	case 6: // Safety ACK (ECU echoes [Sequence:LE16][Value:1])
+	{
+		if (PayloadData.Num() < 3) return;
+		const uint16 Sequence = PayloadData[0] | (PayloadData[1] << 8);
+		FLBEASTSafetyLane::Get().Acknowledge(this, Channel, Sequence);
+		break;
+	}
+
 	default:
 		UE_LOG(LogTemp, Warning, TEXT("LBEASTUDPTransport: Unknown data type (%d)"), DataType);
 		break;
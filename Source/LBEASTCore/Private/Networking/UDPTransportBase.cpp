@@ -1,6 +1,7 @@
 // Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
 
 #include "Networking/UDPTransportBase.h"
+#include "Networking/LBEASTSessionCapture.h"
 #include "IPAddress.h"
 
 FUDPTransportBase::FUDPTransportBase()
@@ -58,6 +59,8 @@ bool FUDPTransportBase::InitializeUDPConnection(const FString& RemoteIP, int32 R
 		return false;
 	}
 
+	CaptureSource = FLBEASTSessionCapture::Get().RegisterSource(FString::Printf(TEXT("UDP %s %s:%d"), *SocketName, *RemoteIP, RemotePort));
+
 	UE_LOG(LogTemp, Log, TEXT("UDPTransportBase: UDP socket created successfully (%s:%d)"), *RemoteIP, RemotePort);
 	return true;
 }
@@ -70,6 +73,8 @@ void FUDPTransportBase::ShutdownUDPConnection()
 		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(UDPSocket);
 		UDPSocket = nullptr;
 		RemoteAddress.Reset();
+		FLBEASTSessionCapture::Get().UnregisterSource(CaptureSource);
+		CaptureSource = -1;
 		UE_LOG(LogTemp, Log, TEXT("UDPTransportBase: UDP connection closed"));
 	}
 }
@@ -91,6 +96,7 @@ bool FUDPTransportBase::SendUDPData(const TArray<uint8>& Data)
 		return false;
 	}
 
+	FLBEASTSessionCapture::Get().Record(CaptureSource, ELBEASTCaptureDirection::Outbound, 0, Data.GetData(), Data.Num());
 	return true;
 }
 
@@ -121,6 +127,7 @@ bool FUDPTransportBase::ReceiveUDPData(TArray<uint8>& OutData, int32& OutBytesRe
 	{
 		// Resize output array to actual bytes read
 		OutData.SetNum(OutBytesRead);
+		FLBEASTSessionCapture::Get().Record(CaptureSource, ELBEASTCaptureDirection::Inbound, 0, OutData.GetData(), OutBytesRead);
 
 		// Optionally return sender address
 		if (OutSenderAddr)
@@ -0,0 +1,799 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "ShowControl/LBEASTShowTimeline.h"
+#include "LBEASTCore.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+
+DECLARE_CYCLE_STAT(TEXT("Show Timeline Game Thread Dispatch"), STAT_LBEASTShowTimeline_Dispatch, STATGROUP_LBEASTCore);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Show Cues Executed (Game Thread)"), STAT_LBEASTShowTimeline_GameThreadCues, STATGROUP_LBEASTCore);
+
+namespace
+{
+	/** Scheduler wait when stopped, paused or past the last cue (transport calls wake it early) */
+	constexpr uint32 MaxIdleWaitMs = 100;
+
+	/** The scheduler stops sleeping this long before a deadline and yields instead (OS sleeps overshoot by ~1 ms) */
+	constexpr double SpinWindowSeconds = 0.002;
+
+	/** Suffixes tried by MakeUniqueTrackName before giving up */
+	constexpr int32 MaxTrackNameSuffix = 64;
+
+	/** Track backed by a function, dropped once its owner is destroyed */
+	class FLBEASTFunctionShowTrack : public ILBEASTShowTrack
+	{
+	public:
+		FLBEASTFunctionShowTrack(const UObject* InOwner, TFunction<void(const FLBEASTShowCue&, double)> InHandler, bool bInThreadSafe)
+			: Owner(InOwner)
+			, Handler(MoveTemp(InHandler))
+			, bThreadSafe(bInThreadSafe)
+		{}
+
+		virtual void ExecuteCue(const FLBEASTShowCue& Cue, double LateSeconds) override
+		{
+			// Thread-safe liveness test when running on the scheduler thread; the owner keeps
+			// itself alive past this point by unregistering (which waits for us) before it dies
+			if (Owner.IsValid(false, bThreadSafe) && Handler)
+			{
+				Handler(Cue, LateSeconds);
+			}
+		}
+
+		virtual bool IsThreadSafe() const override { return bThreadSafe; }
+
+	private:
+		TWeakObjectPtr<const UObject> Owner;
+		TFunction<void(const FLBEASTShowCue&, double)> Handler;
+		bool bThreadSafe = false;
+	};
+}
+
+// =====================================
+// FLBEASTShowTimeline
+// =====================================
+
+FLBEASTShowTimeline::FLBEASTShowTimeline()
+	: ReleaseErrorUs(512)
+	, GameThreadLatencyMs(512)
+{
+	RehearsalEntry = MakeShared<FTrackEntry, ESPMode::ThreadSafe>();
+	RehearsalEntry->Name = TEXT("Rehearsal");
+	RehearsalEntry->bActive = true;
+}
+
+FLBEASTShowTimeline::~FLBEASTShowTimeline()
+{
+	Shutdown();
+}
+
+bool FLBEASTShowTimeline::Start()
+{
+	if (Thread)
+	{
+		return true;
+	}
+
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	bStopRequested = false;
+	Thread = FRunnableThread::Create(this, TEXT("LBEAST_ShowTimeline"), 0, TPri_Highest);
+	if (!Thread)
+	{
+		UE_LOG(LogTemp, Error, TEXT("LBEASTShowTimeline: Failed to create scheduler thread"));
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+		return false;
+	}
+	return true;
+}
+
+void FLBEASTShowTimeline::Shutdown()
+{
+	if (Thread)
+	{
+		Thread->Kill(true);
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	if (WakeEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+
+	FScopeLock ScopeLock(&StateLock);
+	bPlaying = false;
+	Program.Reset();
+	Tracks.Empty();
+}
+
+void FLBEASTShowTimeline::WakeScheduler()
+{
+	if (WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+// =====================================
+// Tracks and Programs
+// =====================================
+
+bool FLBEASTShowTimeline::CanReplaceLocked(const FTrackEntry& Entry, const UObject* Owner)
+{
+	// Same owner (including both unowned), or an owner that has since been destroyed
+	return Entry.Owner == TWeakObjectPtr<const UObject>(Owner)
+		|| (!Entry.Owner.IsExplicitlyNull() && !Entry.Owner.IsValid());
+}
+
+bool FLBEASTShowTimeline::RegisterTrack(FName TrackName, TSharedRef<ILBEASTShowTrack, ESPMode::ThreadSafe> Track, const UObject* Owner)
+{
+	TSharedPtr<FTrackEntry, ESPMode::ThreadSafe> Entry = MakeShared<FTrackEntry, ESPMode::ThreadSafe>();
+	Entry->Name = TrackName;
+	Entry->Track = Track;
+	Entry->Owner = Owner;
+	Entry->bThreadSafe = Track->IsThreadSafe();
+	Entry->bActive = true;
+
+	TSharedPtr<FTrackEntry, ESPMode::ThreadSafe> Replaced;
+	{
+		FScopeLock ScopeLock(&StateLock);
+		if (const TSharedPtr<FTrackEntry, ESPMode::ThreadSafe>* Existing = Tracks.Find(TrackName))
+		{
+			if (!CanReplaceLocked(**Existing, Owner))
+			{
+				const UObject* ExistingOwner = (*Existing)->Owner.Get();
+				UE_LOG(LogTemp, Warning, TEXT("LBEASTShowTimeline: Track '%s' is already registered by %s; not replaced"),
+					*TrackName.ToString(), ExistingOwner ? *ExistingOwner->GetName() : TEXT("another caller"));
+				return false;
+			}
+			Replaced = *Existing;
+			Replaced->bActive = false;
+		}
+		Tracks.Add(TrackName, Entry);
+		CompileLocked();
+	}
+
+	if (Replaced.IsValid())
+	{
+		// Wait out a scheduler-thread cue already inside the old track
+		FScopeLock ExecuteScope(&Replaced->ExecuteLock);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("LBEASTShowTimeline: Registered track '%s'%s%s"), *TrackName.ToString(),
+		Entry->bThreadSafe ? TEXT(" (scheduler thread)") : TEXT(""), Replaced.IsValid() ? TEXT(", replacing the previous one") : TEXT(""));
+	return true;
+}
+
+bool FLBEASTShowTimeline::UnregisterTrack(FName TrackName, const UObject* Owner)
+{
+	TSharedPtr<FTrackEntry, ESPMode::ThreadSafe> Entry;
+	{
+		FScopeLock ScopeLock(&StateLock);
+		const TSharedPtr<FTrackEntry, ESPMode::ThreadSafe>* Existing = Tracks.Find(TrackName);
+		if (!Existing)
+		{
+			return false;
+		}
+		if (!CanReplaceLocked(**Existing, Owner))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("LBEASTShowTimeline: Track '%s' belongs to another owner; not unregistered"), *TrackName.ToString());
+			return false;
+		}
+
+		Entry = *Existing;
+		Tracks.Remove(TrackName);
+		Entry->bActive = false;
+		CompileLocked();
+	}
+
+	// The caller may destroy what the track points at as soon as this returns
+	FScopeLock ExecuteScope(&Entry->ExecuteLock);
+	return true;
+}
+
+FName FLBEASTShowTimeline::MakeUniqueTrackName(FName BaseName, const UObject* Owner) const
+{
+	FScopeLock ScopeLock(&StateLock);
+	FName Candidate = BaseName;
+	for (int32 Suffix = 1; Suffix <= MaxTrackNameSuffix; Suffix++)
+	{
+		const TSharedPtr<FTrackEntry, ESPMode::ThreadSafe>* Existing = Tracks.Find(Candidate);
+		if (!Existing || CanReplaceLocked(**Existing, Owner))
+		{
+			return Candidate;
+		}
+		Candidate = FName(*FString::Printf(TEXT("%s_%d"), *BaseName.ToString(), Suffix));
+	}
+	return BaseName;
+}
+
+void FLBEASTShowTimeline::Load(const FLBEASTCueList& CueList)
+{
+	FScopeLock ScopeLock(&StateLock);
+
+	LoadedCues = CueList.Cues;
+	// Stable: cues at the same time fire in the order they were authored
+	Algo::StableSortBy(LoadedCues, &FLBEASTShowCue::TimeSeconds);
+
+	CompileLocked();
+
+	bPlaying = false;
+	ShowSecondsAtPlay = 0.0;
+	TransportSerial++;
+	bFinished = false;
+
+	int32 Unrouted = 0;
+	for (const FCompiledEvent& Event : Program->Events)
+	{
+		Unrouted += Event.Entry.IsValid() ? 0 : 1;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("LBEASTShowTimeline: Loaded cue list '%s' (%d cues, %.2fs, %d on unregistered tracks)"),
+		*CueList.Name.ToString(), LoadedCues.Num(), Program->Duration, Unrouted);
+
+	WakeScheduler();
+}
+
+void FLBEASTShowTimeline::CompileLocked()
+{
+	TSharedPtr<FProgram, ESPMode::ThreadSafe> Compiled = MakeShared<FProgram, ESPMode::ThreadSafe>();
+	Compiled->Events.Reserve(LoadedCues.Num());
+
+	// Same order as LoadedCues, so the scheduler's cursors stay valid across a re-compile
+	for (const FLBEASTShowCue& Cue : LoadedCues)
+	{
+		FCompiledEvent& Event = Compiled->Events.AddDefaulted_GetRef();
+		Event.Cue = Cue;
+		if (const TSharedPtr<FTrackEntry, ESPMode::ThreadSafe>* Entry = Tracks.Find(Cue.Track))
+		{
+			Event.Entry = *Entry;
+		}
+		Compiled->Duration = FMath::Max(Compiled->Duration, Cue.TimeSeconds + Cue.DurationSeconds);
+	}
+
+	Program = Compiled;
+}
+
+TArray<FLBEASTShowCue> FLBEASTShowTimeline::GetCompiledCues() const
+{
+	FScopeLock ScopeLock(&StateLock);
+	return LoadedCues;
+}
+
+double FLBEASTShowTimeline::GetDuration() const
+{
+	FScopeLock ScopeLock(&StateLock);
+	return Program.IsValid() ? Program->Duration : 0.0;
+}
+
+// =====================================
+// Transport
+// =====================================
+
+void FLBEASTShowTimeline::Play(double FromSeconds)
+{
+	{
+		FScopeLock ScopeLock(&StateLock);
+		ShowSecondsAtPlay = FMath::Max(0.0, FromSeconds);
+		PlayPlatformSeconds = FPlatformTime::Seconds();
+		bPlaying = true;
+		TransportSerial++;
+		bFinished = false;
+	}
+	WakeScheduler();
+}
+
+void FLBEASTShowTimeline::Resume()
+{
+	{
+		FScopeLock ScopeLock(&StateLock);
+		if (bPlaying)
+		{
+			return;
+		}
+		PlayPlatformSeconds = FPlatformTime::Seconds();
+		bPlaying = true;
+	}
+	WakeScheduler();
+}
+
+void FLBEASTShowTimeline::Pause()
+{
+	FScopeLock ScopeLock(&StateLock);
+	if (bPlaying)
+	{
+		ShowSecondsAtPlay = ShowTimeLocked(FPlatformTime::Seconds());
+		bPlaying = false;
+	}
+}
+
+void FLBEASTShowTimeline::StopPlayback()
+{
+	{
+		FScopeLock ScopeLock(&StateLock);
+		bPlaying = false;
+		ShowSecondsAtPlay = 0.0;
+		TransportSerial++;
+		bFinished = false;
+	}
+	WakeScheduler();
+}
+
+void FLBEASTShowTimeline::Seek(double ShowSeconds)
+{
+	{
+		FScopeLock ScopeLock(&StateLock);
+		ShowSecondsAtPlay = FMath::Max(0.0, ShowSeconds);
+		PlayPlatformSeconds = FPlatformTime::Seconds();
+		TransportSerial++;
+		bFinished = false;
+	}
+	WakeScheduler();
+}
+
+double FLBEASTShowTimeline::ShowTimeLocked(double NowPlatformSeconds) const
+{
+	return bPlaying ? ShowSecondsAtPlay + (NowPlatformSeconds - PlayPlatformSeconds) : ShowSecondsAtPlay;
+}
+
+double FLBEASTShowTimeline::GetShowTime() const
+{
+	FScopeLock ScopeLock(&StateLock);
+	return ShowTimeLocked(FPlatformTime::Seconds());
+}
+
+bool FLBEASTShowTimeline::IsPlaying() const
+{
+	FScopeLock ScopeLock(&StateLock);
+	return bPlaying;
+}
+
+bool FLBEASTShowTimeline::IsFinished() const
+{
+	return bFinished.load();
+}
+
+// =====================================
+// Scheduler Thread
+// =====================================
+
+uint32 FLBEASTShowTimeline::Run()
+{
+	uint32 SeenSerial = MAX_uint32;
+
+	while (!bStopRequested)
+	{
+		FProgramPtr Current;
+		bool bIsPlaying = false;
+		double NowShowSeconds = 0.0;
+		double NowPlatformSeconds = 0.0;
+		{
+			FScopeLock ScopeLock(&StateLock);
+			Current = Program;
+			bIsPlaying = bPlaying;
+			NowPlatformSeconds = FPlatformTime::Seconds();
+			NowShowSeconds = ShowTimeLocked(NowPlatformSeconds);
+
+			if (SeenSerial != TransportSerial)
+			{
+				// Load/Play/Seek/Stop: cues before the new position are skipped
+				SeenSerial = TransportSerial;
+				NextEventIndex = Current.IsValid()
+					? Algo::LowerBoundBy(Current->Events, ShowSecondsAtPlay, [](const FCompiledEvent& Event) { return Event.Cue.TimeSeconds; })
+					: 0;
+				NextPrefetchIndex = NextEventIndex;
+			}
+		}
+
+		if (!bIsPlaying || !Current.IsValid())
+		{
+			WakeEvent->Wait(MaxIdleWaitMs);
+			continue;
+		}
+
+		const TArray<FCompiledEvent>& Events = Current->Events;
+		const double Lookahead = LookaheadSeconds.load();
+
+		while (NextPrefetchIndex < Events.Num() && Events[NextPrefetchIndex].Cue.TimeSeconds <= NowShowSeconds + Lookahead)
+		{
+			if (NextPrefetchIndex >= NextEventIndex)
+			{
+				Release(Events[NextPrefetchIndex], true, NowShowSeconds, NowPlatformSeconds);
+			}
+			NextPrefetchIndex++;
+		}
+
+		while (NextEventIndex < Events.Num() && Events[NextEventIndex].Cue.TimeSeconds <= NowShowSeconds)
+		{
+			Release(Events[NextEventIndex], false, NowShowSeconds, NowPlatformSeconds);
+			NextEventIndex++;
+		}
+		NextPrefetchIndex = FMath::Max(NextPrefetchIndex, NextEventIndex);
+
+		if (NextEventIndex >= Events.Num())
+		{
+			bFinished = true;
+			WakeEvent->Wait(MaxIdleWaitMs);
+			continue;
+		}
+
+		// Sleep until shortly before the next release, then yield until it is due
+		double Deadline = Events[NextEventIndex].Cue.TimeSeconds;
+		if (NextPrefetchIndex < Events.Num())
+		{
+			Deadline = FMath::Min(Deadline, Events[NextPrefetchIndex].Cue.TimeSeconds - Lookahead);
+		}
+
+		const double WaitSeconds = Deadline - NowShowSeconds;
+		if (WaitSeconds > SpinWindowSeconds)
+		{
+			const uint32 WaitMs = (uint32)FMath::Clamp(FMath::FloorToInt((WaitSeconds - SpinWindowSeconds) * 1000.0), 1, (int32)MaxIdleWaitMs);
+			WakeEvent->Wait(WaitMs);
+		}
+		else if (WaitSeconds > 0.0)
+		{
+			FPlatformProcess::YieldThread();
+		}
+	}
+	return 0;
+}
+
+void FLBEASTShowTimeline::Stop()
+{
+	bStopRequested = true;
+	WakeScheduler();
+}
+
+void FLBEASTShowTimeline::Release(const FCompiledEvent& Event, bool bPrefetch, double NowShowSeconds, double NowPlatformSeconds)
+{
+	if (bRehearsal)
+	{
+		if (!bPrefetch)
+		{
+			RehearsalEntry->Released.Enqueue({ Event.Cue, false });
+		}
+	}
+	else if (!Event.Entry.IsValid() || !Event.Entry->bActive)
+	{
+		if (!bPrefetch)
+		{
+			FScopeLock ScopeLock(&StatsLock);
+			CuesUnrouted++;
+		}
+		return;
+	}
+	else if (Event.Entry->bThreadSafe)
+	{
+		FScopeLock ExecuteScope(&Event.Entry->ExecuteLock);
+		if (!Event.Entry->bActive)
+		{
+			// Unregistered while we waited
+			return;
+		}
+
+		if (bPrefetch)
+		{
+			Event.Entry->Track->PrefetchCue(Event.Cue);
+		}
+		else
+		{
+			// Measured as the track starts, so earlier cues in this batch count against this one
+			const double ExecuteShowSeconds = NowShowSeconds + (FPlatformTime::Seconds() - NowPlatformSeconds);
+			const double LateSeconds = FMath::Max(0.0, ExecuteShowSeconds - Event.Cue.TimeSeconds);
+			Event.Entry->Track->ExecuteCue(Event.Cue, LateSeconds);
+
+			FScopeLock ScopeLock(&StatsLock);
+			ReleaseErrorUs.Add((float)(LateSeconds * 1000000.0));
+		}
+	}
+	else
+	{
+		// Lateness is measured when DispatchGameThread() runs the cue
+		Event.Entry->Released.Enqueue({ Event.Cue, bPrefetch });
+	}
+
+	if (!bPrefetch)
+	{
+		FScopeLock ScopeLock(&StatsLock);
+		CuesDispatched++;
+	}
+}
+
+// =====================================
+// Game Thread
+// =====================================
+
+void FLBEASTShowTimeline::DispatchGameThread()
+{
+	LBEASTCORE_SCOPE_CYCLE_COUNTER(STAT_LBEASTShowTimeline_Dispatch);
+
+	DispatchEntries.Reset();
+	{
+		FScopeLock ScopeLock(&StateLock);
+		Tracks.GenerateValueArray(DispatchEntries);
+	}
+
+	// One clock sample, advanced per cue, so each cue's lateness includes the cues run before it
+	double BaseShowSeconds = 0.0;
+	double BasePlatformSeconds = 0.0;
+	{
+		FScopeLock ScopeLock(&StateLock);
+		BasePlatformSeconds = FPlatformTime::Seconds();
+		BaseShowSeconds = ShowTimeLocked(BasePlatformSeconds);
+	}
+	auto LatenessOf = [BaseShowSeconds, BasePlatformSeconds](const FLBEASTShowCue& Cue)
+	{
+		return FMath::Max(0.0, BaseShowSeconds + (FPlatformTime::Seconds() - BasePlatformSeconds) - Cue.TimeSeconds);
+	};
+
+	FReleasedCue Released;
+	int32 Executed = 0;
+
+	for (const TSharedPtr<FTrackEntry, ESPMode::ThreadSafe>& Entry : DispatchEntries)
+	{
+		while (Entry->Released.Dequeue(Released))
+		{
+			if (!Entry->bActive || !Entry->Track.IsValid())
+			{
+				continue;
+			}
+
+			if (Released.bPrefetch)
+			{
+				Entry->Track->PrefetchCue(Released.Cue);
+				continue;
+			}
+
+			const double LateSeconds = LatenessOf(Released.Cue);
+			Entry->Track->ExecuteCue(Released.Cue, LateSeconds);
+			Executed++;
+
+			FScopeLock ScopeLock(&StatsLock);
+			GameThreadLatencyMs.Add((float)(LateSeconds * 1000.0));
+		}
+	}
+
+	while (RehearsalEntry->Released.Dequeue(Released))
+	{
+		const double LateSeconds = LatenessOf(Released.Cue);
+		if (OnRehearsedCue)
+		{
+			OnRehearsedCue(Released.Cue, LateSeconds);
+		}
+
+		FScopeLock ScopeLock(&StatsLock);
+		GameThreadLatencyMs.Add((float)(LateSeconds * 1000.0));
+	}
+
+	LBEASTCORE_INC_COUNTER(STAT_LBEASTShowTimeline_GameThreadCues, Executed);
+}
+
+int32 FLBEASTShowTimeline::ReplayRange(double FromSeconds, double ToSeconds)
+{
+	FProgramPtr Current;
+	{
+		FScopeLock ScopeLock(&StateLock);
+		Current = Program;
+	}
+	if (!Current.IsValid())
+	{
+		return 0;
+	}
+
+	const TArray<FCompiledEvent>& Events = Current->Events;
+	int32 Executed = 0;
+	for (int32 Index = Algo::LowerBoundBy(Events, FromSeconds, [](const FCompiledEvent& Event) { return Event.Cue.TimeSeconds; });
+		Index < Events.Num() && Events[Index].Cue.TimeSeconds < ToSeconds; Index++)
+	{
+		const FCompiledEvent& Event = Events[Index];
+		if (bRehearsal)
+		{
+			if (OnRehearsedCue)
+			{
+				OnRehearsedCue(Event.Cue, 0.0);
+			}
+		}
+		else if (Event.Entry.IsValid() && Event.Entry->bActive)
+		{
+			// Serialised with a live scheduler thread that may be running the same track
+			FScopeLock ExecuteScope(&Event.Entry->ExecuteLock);
+			Event.Entry->Track->ExecuteCue(Event.Cue, 0.0);
+		}
+		else
+		{
+			continue;
+		}
+		Executed++;
+	}
+	return Executed;
+}
+
+FLBEASTShowTimelineStats FLBEASTShowTimeline::GetStats() const
+{
+	FScopeLock ScopeLock(&StatsLock);
+	FLBEASTShowTimelineStats Stats;
+	Stats.CuesDispatched = CuesDispatched;
+	Stats.CuesUnrouted = CuesUnrouted;
+	Stats.ReleaseErrorP50Us = ReleaseErrorUs.GetPercentile(0.5f);
+	Stats.ReleaseErrorP99Us = ReleaseErrorUs.GetPercentile(0.99f);
+	Stats.GameThreadLatencyP95Ms = GameThreadLatencyMs.GetPercentile(0.95f);
+	return Stats;
+}
+
+// =====================================
+// ULBEASTShowControlSubsystem
+// =====================================
+
+ULBEASTShowControlSubsystem* ULBEASTShowControlSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<ULBEASTShowControlSubsystem>() : nullptr;
+}
+
+void ULBEASTShowControlSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Timeline = MakeUnique<FLBEASTShowTimeline>();
+	Timeline->SetLookahead(LookaheadSeconds);
+	Timeline->OnRehearsedCue = [this](const FLBEASTShowCue& Cue, double LateSeconds)
+	{
+		OnCueRehearsed.Broadcast(Cue, (float)LateSeconds);
+	};
+
+	if (!Timeline->Start())
+	{
+		Timeline.Reset();
+	}
+}
+
+void ULBEASTShowControlSubsystem::Deinitialize()
+{
+	if (Timeline.IsValid())
+	{
+		Timeline->Shutdown();
+		Timeline.Reset();
+	}
+
+	Super::Deinitialize();
+}
+
+bool ULBEASTShowControlSubsystem::RegisterTrack(FName TrackName, TSharedRef<ILBEASTShowTrack, ESPMode::ThreadSafe> Track, const UObject* Owner)
+{
+	return Timeline.IsValid() && Timeline->RegisterTrack(TrackName, Track, Owner);
+}
+
+FName ULBEASTShowControlSubsystem::RegisterTrack(FName TrackName, const UObject* Owner, TFunction<void(const FLBEASTShowCue&, double)> Handler, bool bRunOnSchedulerThread)
+{
+	if (!Timeline.IsValid())
+	{
+		return NAME_None;
+	}
+
+	const FName UniqueName = Timeline->MakeUniqueTrackName(TrackName, Owner);
+	if (UniqueName != TrackName)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("LBEASTShowControlSubsystem: Track '%s' is taken; %s registered as '%s'"),
+			*TrackName.ToString(), Owner ? *Owner->GetName() : TEXT("caller"), *UniqueName.ToString());
+	}
+
+	const TSharedRef<ILBEASTShowTrack, ESPMode::ThreadSafe> Track = MakeShared<FLBEASTFunctionShowTrack, ESPMode::ThreadSafe>(Owner, MoveTemp(Handler), bRunOnSchedulerThread);
+	return Timeline->RegisterTrack(UniqueName, Track, Owner) ? UniqueName : NAME_None;
+}
+
+bool ULBEASTShowControlSubsystem::UnregisterTrack(FName TrackName, const UObject* Owner)
+{
+	return Timeline.IsValid() && Timeline->UnregisterTrack(TrackName, Owner);
+}
+
+void ULBEASTShowControlSubsystem::LoadCueList(const FLBEASTCueList& CueList)
+{
+	if (Timeline.IsValid())
+	{
+		Timeline->Load(CueList);
+		bFinishReported = true;
+	}
+}
+
+void ULBEASTShowControlSubsystem::PlayShow(double FromSeconds)
+{
+	if (Timeline.IsValid())
+	{
+		Timeline->Play(FromSeconds);
+		bFinishReported = false;
+	}
+}
+
+void ULBEASTShowControlSubsystem::PauseShow()
+{
+	if (Timeline.IsValid())
+	{
+		Timeline->Pause();
+	}
+}
+
+void ULBEASTShowControlSubsystem::ResumeShow()
+{
+	if (Timeline.IsValid())
+	{
+		Timeline->Resume();
+	}
+}
+
+void ULBEASTShowControlSubsystem::StopShow()
+{
+	if (Timeline.IsValid())
+	{
+		Timeline->StopPlayback();
+		bFinishReported = true;
+	}
+}
+
+void ULBEASTShowControlSubsystem::SeekShow(double ShowSeconds)
+{
+	if (Timeline.IsValid())
+	{
+		Timeline->Seek(ShowSeconds);
+		bFinishReported = !Timeline->IsPlaying();
+	}
+}
+
+double ULBEASTShowControlSubsystem::GetShowTime() const
+{
+	return Timeline.IsValid() ? Timeline->GetShowTime() : 0.0;
+}
+
+bool ULBEASTShowControlSubsystem::IsShowPlaying() const
+{
+	return Timeline.IsValid() && Timeline->IsPlaying();
+}
+
+int32 ULBEASTShowControlSubsystem::ReplayRange(double FromSeconds, double ToSeconds)
+{
+	return Timeline.IsValid() ? Timeline->ReplayRange(FromSeconds, ToSeconds) : 0;
+}
+
+FLBEASTShowTimelineStats ULBEASTShowControlSubsystem::GetShowStats() const
+{
+	return Timeline.IsValid() ? Timeline->GetStats() : FLBEASTShowTimelineStats();
+}
+
+void ULBEASTShowControlSubsystem::SetRehearsal(bool bInRehearsal)
+{
+	if (Timeline.IsValid())
+	{
+		Timeline->SetRehearsal(bInRehearsal);
+		UE_LOG(LogTemp, Log, TEXT("LBEASTShowControlSubsystem: Rehearsal %s"), bInRehearsal ? TEXT("on - tracks will not receive cues") : TEXT("off"));
+	}
+}
+
+void ULBEASTShowControlSubsystem::Tick(float DeltaTime)
+{
+	if (!Timeline.IsValid())
+	{
+		return;
+	}
+
+	Timeline->SetLookahead(LookaheadSeconds);
+	Timeline->DispatchGameThread();
+
+	if (!bFinishReported && Timeline->IsFinished())
+	{
+		bFinishReported = true;
+		OnShowFinished.Broadcast();
+	}
+}
+
+TStatId ULBEASTShowControlSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(ULBEASTShowControlSubsystem, STATGROUP_Tickables);
+}
@@ -11,6 +11,10 @@
 #include "HeadMountedDisplayTypes.h"
 #include "Features/IModularFeatures.h"
 #include "Net/UnrealNetwork.h"
+#include "LBEASTCore.h"
+
+DECLARE_CYCLE_STAT(TEXT("LBEASTVRPlayerReplicationComponent Tick"), STAT_LBEASTVRPlayerReplicationComponent_Tick, STATGROUP_LBEASTCore);
+DECLARE_CYCLE_STAT(TEXT("Capture And Replicate XR Data"), STAT_LBEASTVRPlayer_CaptureXRData, STATGROUP_LBEASTCore);
 
 ULBEASTVRPlayerReplicationComponent::ULBEASTVRPlayerReplicationComponent()
 {
@@ -57,6 +61,7 @@ void ULBEASTVRPlayerReplicationComponent::BeginPlay()
 void ULBEASTVRPlayerReplicationComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	LBEASTCORE_SCOPE_CYCLE_COUNTER(STAT_LBEASTVRPlayerReplicationComponent_Tick);
 
 	if (!bEnableReplication)
 	{
@@ -126,6 +131,8 @@ bool ULBEASTVRPlayerReplicationComponent::IsLocalPlayer() const
 
 void ULBEASTVRPlayerReplicationComponent::CaptureAndReplicateXRData()
 {
+	LBEASTCORE_SCOPE_CYCLE_COUNTER(STAT_LBEASTVRPlayer_CaptureXRData);
+
 	// Only capture on local player's client
 	if (!bIsLocalPlayer)
 	{
@@ -54,6 +54,12 @@ struct FExperienceState
  */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnExperienceStateChanged, FName, OldState, FName, NewState, int32, NewStateIndex);
 
+/**
+ * Native state-entry handler (C++ only)
+ * Receives state indices only - OldStateIndex is INDEX_NONE when the experience starts.
+ */
+DECLARE_DELEGATE_TwoParams(FOnExperienceStateEntered, int32 /*OldStateIndex*/, int32 /*NewStateIndex*/);
+
 /**
  * Experience Loop State Machine
  * 
@@ -65,7 +71,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnExperienceStateChanged, FName,
  * Usage:
  * - Define states in your experience template
  * - Map embedded system buttons to AdvanceState/RetreatState
- * - Subscribe to OnStateChanged to trigger game events
+ * - C++: resolve state names once with FindStateIndex() and register per-state handlers with
+ *   BindStateEntered(); a transition then runs only the handlers of the state it enters
+ * - Blueprint: subscribe to OnStateChanged (names are only built when it has listeners)
  */
 UCLASS(BlueprintType, Blueprintable)
 class LBEASTCORE_API UExperienceStateMachine : public UObject
@@ -153,6 +161,13 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|Experience Loop")
 	bool CanRetreat() const;
 
+	/**
+	 * States one button press away from the current state (next if it can advance, previous if it can retreat)
+	 * @param bIncludeJumps - Also include every other state (JumpToState can reach any of them)
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|Experience Loop")
+	TArray<FName> GetReachableStates(bool bIncludeJumps = false) const;
+
 	/**
 	 * Reset to the first state
 	 */
@@ -165,8 +180,65 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "LBEAST|Experience Loop")
 	void StopExperience();
 
+	// =====================================
+	// State-Indexed Dispatch (C++ only)
+	// =====================================
+
+	/** Resolve a state name to its index (do this once when binding, not per transition) */
+	int32 FindStateIndex(FName StateName) const;
+
+	/**
+	 * Run Handler whenever StateIndex is entered
+	 * Initialize() clears per-state bindings because indices change meaning - bind after it.
+	 * Safe to call from inside a handler (takes effect from the next transition).
+	 */
+	FDelegateHandle BindStateEntered(int32 StateIndex, FOnExperienceStateEntered Handler);
+
+	/** Run Handler on every transition (subscribers that react to any change, e.g. HUD refresh) */
+	FDelegateHandle BindAnyStateEntered(FOnExperienceStateEntered Handler);
+
+	/** Remove one binding */
+	void UnbindStateHandler(FDelegateHandle Handle);
+
+	/** Remove every binding (per-state and any-state) whose delegate is bound to Object */
+	void UnbindStateHandlers(const void* Object);
+
 private:
-	void BroadcastStateChange(FName OldState, FName NewState);
+	/** One native binding in a dispatch list */
+	struct FStateHandler
+	{
+		FDelegateHandle Handle;
+		FOnExperienceStateEntered Delegate;
+
+		/** Unbound while a dispatch was running; skipped, then removed once it finishes */
+		bool bRemoved = false;
+	};
+
+	/** Per-state dispatch table (index = state index, kept the same length as States) */
+	TArray<TArray<FStateHandler>> EnterHandlers;
+
+	/** Handlers run on every transition */
+	TArray<FStateHandler> AnyStateHandlers;
+
+	/** Bindings made while handlers are running (appended after the dispatch finishes) */
+	TArray<TPair<int32, FStateHandler>> PendingBindings;
+
+	/** State name -> index, built by Initialize() */
+	TMap<FName, int32> StateIndexByName;
+
+	/** Nesting depth of BroadcastStateChange (handlers may trigger further transitions) */
+	int32 DispatchDepth = 0;
+
+	/** Set when entries were flagged bRemoved during a dispatch */
+	bool bNeedsCompaction = false;
+
+	/** Rebuild the name index and size the dispatch table to States */
+	void RebuildStateIndex();
+
+	FDelegateHandle AddHandler(int32 StateIndex, FOnExperienceStateEntered&& Handler);
+	void RemoveHandlers(TFunctionRef<bool(const FStateHandler&)> Predicate);
+	void CompactHandlers();
+	void BroadcastStateChange(int32 OldStateIndex);
 };
 
 
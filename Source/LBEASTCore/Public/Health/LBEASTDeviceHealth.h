@@ -0,0 +1,435 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "LBEASTDeviceHealth.generated.h"
+
+class FSocket;
+
+/**
+ * Health state of a device, worst last
+ */
+UENUM(BlueprintType)
+enum class ELBEASTDeviceHealthState : uint8
+{
+	/** Registered but never heard from */
+	Unknown		UMETA(DisplayName = "Unknown"),
+
+	Healthy		UMETA(DisplayName = "Healthy"),
+
+	/** Talking, but loss/jitter/RTT/temperature over a threshold or a fault condition is active */
+	Degraded	UMETA(DisplayName = "Degraded"),
+
+	/** Early warning: silent for longer than usual, not yet timed out */
+	Stale		UMETA(DisplayName = "Stale"),
+
+	/** Silent past its timeout, or its link is down */
+	TimedOut	UMETA(DisplayName = "Timed Out")
+};
+
+/**
+ * Per-device health thresholds
+ */
+USTRUCT(BlueprintType)
+struct LBEASTCORE_API FLBEASTDeviceHealthConfig
+{
+	GENERATED_BODY()
+
+	/** Silence after which the device is TimedOut (0 = event-driven device, never times out) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Health")
+	float TimeoutSeconds = 5.0f;
+
+	/** Stale warning at this fraction of TimeoutSeconds at the latest */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Health", meta = (ClampMin = "0.05", ClampMax = "1.0"))
+	float EarlyWarningFraction = 0.5f;
+
+	/**
+	 * Stale warning after this many of the device's usual (p99) packet intervals of silence,
+	 * if that is sooner than EarlyWarningFraction. A 100 Hz ECU warns after ~0.25 s, not 2.5 s.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Health")
+	float MissedIntervalsWarning = 3.0f;
+
+	/**
+	 * Nominal send interval for devices without sequence numbers (0 = unknown).
+	 * Used to count missed packets from sender timestamps or arrival gaps.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Health")
+	float ExpectedIntervalSeconds = 0.0f;
+
+	/** Degraded above this packet loss over the last 10 samples (0 = off) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Health")
+	float MaxLossPercent = 5.0f;
+
+	/** Degraded above this interarrival jitter (0 = off) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Health")
+	float MaxJitterMs = 0.0f;
+
+	/** Degraded when p95 RTT exceeds this (0 = off) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Health")
+	float MaxRttMs = 0.0f;
+
+	/** Degraded when any temperature sensor exceeds this (0 = off) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Health")
+	float MaxTemperatureC = 0.0f;
+};
+
+/**
+ * One point of a device's health time series (one per sample interval)
+ */
+USTRUCT(BlueprintType)
+struct LBEASTCORE_API FLBEASTDeviceHealthSample
+{
+	GENERATED_BODY()
+
+	/** Seconds since the health service started */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	float TimeSeconds = 0.0f;
+
+	/** Packets received during the interval */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	int32 PacketsReceived = 0;
+
+	/** Packets detected missing during the interval */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	int32 PacketsLost = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	float RttP50Ms = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	float JitterMs = 0.0f;
+
+	/** Hottest sensor (0 if the device reports none) */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	float MaxTemperatureC = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	float SecondsSinceSeen = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	ELBEASTDeviceHealthState State = ELBEASTDeviceHealthState::Unknown;
+};
+
+/**
+ * Current health of one device
+ */
+USTRUCT(BlueprintType)
+struct LBEASTCORE_API FLBEASTDeviceHealthStatus
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	FString DeviceName;
+
+	/** Device family ("udp", "artnet", "rf433", "gunship", ...) */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	FString Kind;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	ELBEASTDeviceHealthState State = ELBEASTDeviceHealthState::Unknown;
+
+	/** Why the device is not Healthy (empty when Healthy) */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	FString Reason;
+
+	/** -1 if never seen */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	float SecondsSinceSeen = -1.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	int64 PacketsReceived = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	int64 PacketsLost = 0;
+
+	/** Loss over the last 10 samples */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	float LossPercent = 0.0f;
+
+	/** RFC 3550 interarrival jitter */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	float JitterMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	float RttP50Ms = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	float RttP95Ms = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	float RttP99Ms = 0.0f;
+
+	/** Typical (p50) time between packets */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	float IntervalP50Ms = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	float IntervalP99Ms = 0.0f;
+
+	/** Latest reading per sensor */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	TMap<FName, float> Temperatures;
+
+	/** Fault conditions currently reported by the device (e.g. "Station2.ThermalShutdown") */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Health")
+	TArray<FName> ActiveConditions;
+};
+
+/**
+ * Rolling percentile over the last N values
+ *
+ * Keeps the window both in arrival order (ring) and sorted, so Add() is a binary search
+ * plus one small memmove and any percentile is an O(1) lookup.
+ */
+class LBEASTCORE_API FLBEASTRollingPercentile
+{
+public:
+	explicit FLBEASTRollingPercentile(int32 InWindowSize = 256);
+
+	void Add(float Value);
+	void Reset();
+
+	/** @param Fraction - 0.5 for the median, 0.99 for p99. Returns 0 when empty. */
+	float GetPercentile(float Fraction) const;
+
+	float GetMean() const { return Sorted.Num() > 0 ? (float)(Sum / Sorted.Num()) : 0.0f; }
+	int32 Num() const { return Sorted.Num(); }
+
+private:
+	int32 WindowSize;
+	TArray<float> Ring;
+	int32 RingHead = 0;
+	TArray<float> Sorted;
+	double Sum = 0.0;
+};
+
+/** Native health change notification (game thread) */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnLBEASTDeviceHealthChangedNative, const FLBEASTDeviceHealthStatus& /*Status*/, ELBEASTDeviceHealthState /*PreviousState*/);
+
+/**
+ * LBEAST Device Health Registry (Non-UObject, process-wide, game thread)
+ *
+ * Central health bookkeeping for every connected device. Transports and device managers
+ * register a device and report what they observe (packets, sequence numbers, RTT,
+ * temperatures, fault conditions); the registry derives loss, jitter, rolling percentiles
+ * and a health state, keeps a time series per device and exports it all in Prometheus
+ * text format. ULBEASTDeviceHealthSubsystem ticks it and serves the metrics endpoint.
+ *
+ * Loss is counted from sequence gaps when the device sends sequence numbers, otherwise from
+ * sender-timestamp or arrival gaps against ExpectedIntervalSeconds.
+ */
+class LBEASTCORE_API FLBEASTDeviceHealthRegistry
+{
+public:
+	static FLBEASTDeviceHealthRegistry& Get();
+
+	/**
+	 * Register a device
+	 * @param Name - Unique, stable display name (used as the Prometheus "device" label)
+	 * @param Kind - Device family for grouping ("udp", "artnet", ...)
+	 * @return Device handle
+	 */
+	int32 RegisterDevice(const FString& Name, const FString& Kind, const FLBEASTDeviceHealthConfig& Config = FLBEASTDeviceHealthConfig());
+	void UnregisterDevice(int32 Handle);
+
+	/**
+	 * Report a received packet
+	 * @param ReceiveTimeSeconds - FPlatformTime::Seconds() at receipt (0 = now)
+	 * @param Sequence - Device sequence number, if the protocol has one (-1 = none)
+	 * @param SenderTimeSeconds - Device-side send time in any timebase (-1 = none); improves jitter and loss accuracy
+	 */
+	void ReportPacket(int32 Handle, double ReceiveTimeSeconds = 0.0, int64 Sequence = -1, double SenderTimeSeconds = -1.0);
+
+	/** Report a measured round trip (request -> reply) */
+	void ReportRoundTrip(int32 Handle, float RttMs);
+
+	/** Report a temperature reading */
+	void ReportTemperature(int32 Handle, FName Sensor, float Celsius);
+
+	/** Raise or clear a named fault condition; any active condition makes the device Degraded */
+	void SetCondition(int32 Handle, FName Condition, bool bActive);
+
+	/** Link state for devices with a local connection (USB dongle, serial port); down = TimedOut */
+	void SetLinkUp(int32 Handle, bool bLinkUp);
+
+	/**
+	 * Re-evaluate states and take time-series samples when due (idempotent; safe to call every frame)
+	 */
+	void Tick(double NowSeconds);
+
+	bool GetStatus(int32 Handle, FLBEASTDeviceHealthStatus& OutStatus) const;
+	bool FindStatus(const FString& Name, FLBEASTDeviceHealthStatus& OutStatus) const;
+	void GetAllStatus(TArray<FLBEASTDeviceHealthStatus>& OutStatus) const;
+
+	/** Time series, oldest first */
+	bool GetHistory(const FString& Name, TArray<FLBEASTDeviceHealthSample>& OutSamples) const;
+
+	/** Prometheus text exposition format (version 0.0.4) */
+	FString ExportPrometheus() const;
+
+	FOnLBEASTDeviceHealthChangedNative& OnHealthChanged() { return HealthChanged; }
+
+	/** Seconds between time-series samples */
+	double SampleIntervalSeconds = 1.0;
+
+	/** Samples kept per device (300 = 5 minutes at 1 s) */
+	int32 HistorySize = 300;
+
+	/** Seconds between state evaluations (early warnings need better than 1 s resolution) */
+	double EvaluateIntervalSeconds = 0.1;
+
+private:
+	FLBEASTDeviceHealthRegistry();
+
+	struct FDevice
+	{
+		FString Name;
+		FString Kind;
+		FLBEASTDeviceHealthConfig Config;
+		bool bActive = false;
+
+		/** Bumped when the slot is freed, so handles to the previous occupant stop resolving */
+		uint16 Generation = 0;
+		bool bLinkUp = true;
+		double RegisteredSeconds = 0.0;
+
+		// Arrival bookkeeping
+		double LastSeenSeconds = 0.0;
+		double PreviousSenderSeconds = -1.0;
+		double PreviousInterarrival = -1.0;
+		int64 NextSequence = -1;
+		double JitterSeconds = 0.0;
+		int64 PacketsReceived = 0;
+		int64 PacketsLost = 0;
+
+		// Since the last sample
+		int32 IntervalReceived = 0;
+		int32 IntervalLost = 0;
+
+		FLBEASTRollingPercentile Rtt;
+		int64 RttCount = 0;
+		double RttSumMs = 0.0;
+		FLBEASTRollingPercentile Interval;
+		TMap<FName, float> Temperatures;
+		TArray<FName> Conditions;
+
+		TArray<FLBEASTDeviceHealthSample> History;
+		int32 HistoryHead = 0;
+
+		ELBEASTDeviceHealthState State = ELBEASTDeviceHealthState::Unknown;
+		FString Reason;
+
+		FDevice() : Rtt(256), Interval(128) {}
+	};
+
+	FDevice* FindDevice(int32 Handle);
+	const FDevice* FindDevice(int32 Handle) const;
+
+	/** Handles are (Generation << HandleIndexBits) | slot index */
+	static constexpr int32 HandleIndexBits = 16;
+	static int32 MakeHandle(int32 Index, uint16 Generation) { return ((int32)(Generation & 0x7FFF) << HandleIndexBits) | Index; }
+
+	/** @return True if the state changed */
+	bool Evaluate(FDevice& Device, double NowSeconds);
+	void TakeSample(FDevice& Device, double NowSeconds);
+	float GetRecentLossPercent(const FDevice& Device) const;
+	float GetMaxTemperature(const FDevice& Device) const;
+	void FillStatus(const FDevice& Device, double NowSeconds, FLBEASTDeviceHealthStatus& OutStatus) const;
+
+	TArray<FDevice> Devices;
+
+	/** Slots freed by UnregisterDevice, reused before Devices grows (transports re-register on every reconnect) */
+	TArray<int32> FreeSlots;
+
+	double StartSeconds = 0.0;
+	double NextSampleSeconds = 0.0;
+	double NextEvaluateSeconds = 0.0;
+	FOnLBEASTDeviceHealthChangedNative HealthChanged;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLBEASTDeviceHealthChanged, const FLBEASTDeviceHealthStatus&, Status, ELBEASTDeviceHealthState, PreviousState);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLBEASTDeviceHealthWarning, const FString&, DeviceName, const FString&, Reason);
+
+/**
+ * LBEAST Device Health Subsystem
+ *
+ * Ticks FLBEASTDeviceHealthRegistry, relays its state changes to Blueprint and serves
+ * GET /metrics in Prometheus text format for Grafana/alerting on the venue network.
+ *
+ * Command line:
+ *   -LBEASTMetricsPort=9464     Metrics port (0 = disabled)
+ */
+UCLASS()
+class LBEASTCORE_API ULBEASTDeviceHealthSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	static ULBEASTDeviceHealthSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|Health")
+	TArray<FLBEASTDeviceHealthStatus> GetAllDeviceHealth() const;
+
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|Health")
+	bool GetDeviceHealth(const FString& DeviceName, FLBEASTDeviceHealthStatus& OutStatus) const;
+
+	/** Time series for a device, oldest first (for ops dashboards/graphs) */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|Health")
+	TArray<FLBEASTDeviceHealthSample> GetDeviceHistory(const FString& DeviceName) const;
+
+	/** Fired on every state change (including recovery to Healthy) */
+	UPROPERTY(BlueprintAssignable, Category = "LBEAST|Health")
+	FOnLBEASTDeviceHealthChanged OnDeviceHealthChanged;
+
+	/** Fired when a device turns Degraded or Stale - before it times out */
+	UPROPERTY(BlueprintAssignable, Category = "LBEAST|Health")
+	FOnLBEASTDeviceHealthWarning OnDeviceHealthWarning;
+
+	/** Metrics endpoint port (0 = disabled). Takes effect on Initialize. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "LBEAST|Health")
+	int32 MetricsPort = 9464;
+
+	/** Listen on all interfaces instead of loopback only (for a Prometheus server elsewhere on the venue network) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "LBEAST|Health")
+	bool bMetricsOnAllInterfaces = false;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Always; }
+	virtual bool IsTickableWhenPaused() const override { return true; }
+
+private:
+	struct FMetricsConnection
+	{
+		FSocket* Socket = nullptr;
+		TArray<uint8> Request;
+
+		/** Header + body once the request is complete; sent across ticks as the socket accepts it */
+		TArray<uint8> Response;
+		int32 ResponseBytesSent = 0;
+		bool bResponding = false;
+
+		double DeadlineSeconds = 0.0;
+	};
+
+	void HandleHealthChanged(const FLBEASTDeviceHealthStatus& Status, ELBEASTDeviceHealthState PreviousState);
+
+	bool StartMetricsEndpoint();
+	void StopMetricsEndpoint();
+	void ServiceMetricsEndpoint(double NowSeconds);
+
+	/** @return True once the connection is done (response fully sent, or failed) */
+	bool ServiceMetricsConnection(FMetricsConnection& Connection, double NowSeconds);
+
+	FDelegateHandle HealthChangedHandle;
+	FSocket* MetricsListenSocket = nullptr;
+	TArray<FMetricsConnection> MetricsConnections;
+};
@@ -4,6 +4,15 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "LBEASTStats.h"
+
+/** Stats group ("stat LBEASTCore") and Unreal Insights channel for this module (see LBEASTStats.h) */
+DECLARE_STATS_GROUP(TEXT("LBEAST Core"), STATGROUP_LBEASTCore, STATCAT_Advanced);
+LBEAST_DECLARE_TRACE_CHANNEL(LBEASTCoreChannel, LBEASTCORE_API);
+
+#define LBEASTCORE_SCOPE_CYCLE_COUNTER(StatId) LBEAST_SCOPE_CYCLE_COUNTER(StatId, "Core", LBEASTCoreChannel)
+#define LBEASTCORE_INC_COUNTER(StatId, Amount) LBEAST_INC_COUNTER(StatId, "Core", Amount)
+#define LBEASTCORE_SET_GAUGE(StatId, Value) LBEAST_SET_GAUGE(StatId, "Core", Value)
 
 /**
  * LBEAST Core Module
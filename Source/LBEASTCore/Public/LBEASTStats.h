@@ -0,0 +1,236 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include <atomic>
+#include "LBEASTStats.generated.h"
+
+/**
+ * LBEAST Performance Instrumentation
+ *
+ * Every LBEAST module declares its own stats group and Unreal Insights channel in its
+ * module header, e.g. for ProLighting:
+ *
+ *   DECLARE_STATS_GROUP(TEXT("LBEAST ProLighting"), STATGROUP_LBEASTProLighting, STATCAT_Advanced);
+ *   LBEAST_DECLARE_TRACE_CHANNEL(LBEASTProLightingChannel, PROLIGHTING_API);
+ *
+ * Hot paths then use the LBEAST_* macros below, which feed three consumers at once:
+ * - "stat LBEASTProLighting" (Unreal stats system, editor and development builds)
+ * - Unreal Insights CPU timeline (enable with -trace=cpu,LBEASTProLightingChannel)
+ * - The in-process LBEAST registry, which keeps working in shipping builds and is
+ *   what the server beacon publishes to the Server Manager perf overlay
+ *
+ * Usage (in a .cpp):
+ *   DECLARE_CYCLE_STAT(TEXT("Flush DMX Universe"), STAT_ProLighting_FlushDMX, STATGROUP_LBEASTProLighting);
+ *   DECLARE_DWORD_COUNTER_STAT(TEXT("DMX Bytes Sent"), STAT_ProLighting_DMXBytes, STATGROUP_LBEASTProLighting);
+ *
+ *   void UProLightingController::FlushDMXUniverse(int32 Universe)
+ *   {
+ *       LBEAST_SCOPE_CYCLE_COUNTER(STAT_ProLighting_FlushDMX, "ProLighting", LBEASTProLightingChannel);
+ *       LBEAST_INC_COUNTER(STAT_ProLighting_DMXBytes, "ProLighting", 512);
+ *   }
+ *
+ * Define LBEAST_PERF_STATS=0 to compile the registry out (stats/trace are unaffected).
+ */
+
+#ifndef LBEAST_PERF_STATS
+#define LBEAST_PERF_STATS 1
+#endif
+
+/**
+ * Kind of value an LBEAST perf stat tracks
+ */
+UENUM(BlueprintType)
+enum class ELBEASTPerfStatType : uint8
+{
+	/** Scoped timer (calls/s, average and max ms) */
+	Timer		UMETA(DisplayName = "Timer"),
+
+	/** Monotonic counter such as packets or bytes (reported per second) */
+	Counter		UMETA(DisplayName = "Counter"),
+
+	/** Instantaneous value such as a queue depth */
+	Gauge		UMETA(DisplayName = "Gauge")
+};
+
+/**
+ * One stat as seen over the last sample window
+ */
+USTRUCT(BlueprintType)
+struct LBEASTCORE_API FLBEASTPerfSample
+{
+	GENERATED_BODY()
+
+	/** Stat name without the STAT_ prefix (e.g. "ProLighting_FlushDMX") */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Perf")
+	FString Name;
+
+	/** Owning module (e.g. "ProLighting") */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Perf")
+	FString Group;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Perf")
+	ELBEASTPerfStatType Type = ELBEASTPerfStatType::Timer;
+
+	/** Timer: calls per second. Counter: increments per second. Gauge: current value. */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Perf")
+	float Rate = 0.0f;
+
+	/** Timer only: average time per call (ms) */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Perf")
+	float AverageMs = 0.0f;
+
+	/** Timer only: worst call in the window (ms) */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Perf")
+	float MaxMs = 0.0f;
+
+	/** Human-readable one-line summary (for overlays and logs) */
+	FString ToDisplayString() const;
+};
+
+/**
+ * One registered LBEAST perf stat (Non-UObject)
+ *
+ * Instances are function-local statics created by the LBEAST_* macros and link themselves
+ * into a global list on first use. Updates are lock-free atomics, so any thread may
+ * record (I/O threads, webhook threads, the game thread).
+ */
+class LBEASTCORE_API FLBEASTPerfStat
+{
+public:
+	FLBEASTPerfStat(const TCHAR* InName, const TCHAR* InGroup, ELBEASTPerfStatType InType);
+
+	/** Record one timed call */
+	void AddTiming(uint64 Cycles)
+	{
+		Calls.fetch_add(1, std::memory_order_relaxed);
+		TotalCycles.fetch_add(Cycles, std::memory_order_relaxed);
+		uint64 PrevMax = MaxCycles.load(std::memory_order_relaxed);
+		while (Cycles > PrevMax && !MaxCycles.compare_exchange_weak(PrevMax, Cycles, std::memory_order_relaxed)) {}
+	}
+
+	/** Add to a counter */
+	void Add(int64 Amount) { Value.fetch_add(Amount, std::memory_order_relaxed); }
+
+	/** Set a gauge */
+	void Set(int64 NewValue) { Value.store(NewValue, std::memory_order_relaxed); }
+
+	const TCHAR* GetName() const { return Name; }
+	const TCHAR* GetGroup() const { return Group; }
+	ELBEASTPerfStatType GetType() const { return Type; }
+
+	/**
+	 * Snapshot every registered stat over the window since the previous snapshot.
+	 * Windows shorter than MinWindowSeconds return the cached previous snapshot, so several
+	 * consumers (beacon, overlay, logging) can poll without stealing each other's window.
+	 * Game thread only.
+	 */
+	static const TArray<FLBEASTPerfSample>& Sample(double MinWindowSeconds = 0.5);
+
+	/**
+	 * The busiest stats from the latest snapshot: timers by total time, then counters
+	 * and gauges by rate. Used to keep beacon packets small.
+	 */
+	static void GetTopSamples(int32 MaxSamples, TArray<FLBEASTPerfSample>& OutSamples, double MinWindowSeconds = 0.5);
+
+private:
+	const TCHAR* Name;
+	const TCHAR* Group;
+	ELBEASTPerfStatType Type;
+
+	std::atomic<uint64> Calls{0};
+	std::atomic<uint64> TotalCycles{0};
+	std::atomic<uint64> MaxCycles{0};
+	std::atomic<int64> Value{0};
+
+	/** Values at the previous snapshot (sampling thread only) */
+	uint64 LastCalls = 0;
+	uint64 LastTotalCycles = 0;
+	int64 LastValue = 0;
+
+	/** Intrusive registry list (append-only) */
+	FLBEASTPerfStat* Next = nullptr;
+	static std::atomic<FLBEASTPerfStat*> Head;
+};
+
+/**
+ * RAII timer for FLBEASTPerfStat
+ */
+struct FLBEASTPerfScope
+{
+	explicit FLBEASTPerfScope(FLBEASTPerfStat& InStat)
+		: Stat(InStat)
+		, StartCycles(FPlatformTime::Cycles64())
+	{
+	}
+
+	~FLBEASTPerfScope()
+	{
+		Stat.AddTiming(FPlatformTime::Cycles64() - StartCycles);
+	}
+
+private:
+	FLBEASTPerfStat& Stat;
+	uint64 StartCycles;
+};
+
+// =====================================
+// Trace channels
+// =====================================
+
+#if UE_TRACE_ENABLED
+#define LBEAST_DECLARE_TRACE_CHANNEL(ChannelName, ModuleApi) UE_TRACE_CHANNEL_EXTERN(ChannelName, ModuleApi)
+#define LBEAST_DEFINE_TRACE_CHANNEL(ChannelName) UE_TRACE_CHANNEL_DEFINE(ChannelName)
+#else
+#define LBEAST_DECLARE_TRACE_CHANNEL(ChannelName, ModuleApi)
+#define LBEAST_DEFINE_TRACE_CHANNEL(ChannelName)
+#endif
+
+#if CPUPROFILERTRACE_ENABLED
+#define LBEAST_TRACE_SCOPE(StatId, Channel) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(#StatId, Channel)
+#else
+#define LBEAST_TRACE_SCOPE(StatId, Channel)
+#endif
+
+// =====================================
+// Registry
+// =====================================
+
+#if LBEAST_PERF_STATS
+#define LBEAST_PERF_STAT_INSTANCE(StatId, GroupName, StatType) \
+	[]() -> FLBEASTPerfStat& { static FLBEASTPerfStat Instance(TEXT(#StatId), TEXT(GroupName), StatType); return Instance; }()
+#define LBEAST_PERF_SCOPE(StatId, GroupName) \
+	FLBEASTPerfScope PREPROCESSOR_JOIN(LBEASTPerfScope_, __LINE__)(LBEAST_PERF_STAT_INSTANCE(StatId, GroupName, ELBEASTPerfStatType::Timer))
+#define LBEAST_PERF_ADD(StatId, GroupName, Amount) \
+	LBEAST_PERF_STAT_INSTANCE(StatId, GroupName, ELBEASTPerfStatType::Counter).Add((int64)(Amount))
+#define LBEAST_PERF_SET(StatId, GroupName, NewValue) \
+	LBEAST_PERF_STAT_INSTANCE(StatId, GroupName, ELBEASTPerfStatType::Gauge).Set((int64)(NewValue))
+#else
+#define LBEAST_PERF_SCOPE(StatId, GroupName)
+#define LBEAST_PERF_ADD(StatId, GroupName, Amount)
+#define LBEAST_PERF_SET(StatId, GroupName, NewValue)
+#endif
+
+// =====================================
+// Instrumentation macros
+// =====================================
+
+/** Time the enclosing scope (DECLARE_CYCLE_STAT) */
+#define LBEAST_SCOPE_CYCLE_COUNTER(StatId, GroupName, Channel) \
+	SCOPE_CYCLE_COUNTER(StatId); \
+	LBEAST_TRACE_SCOPE(StatId, Channel); \
+	LBEAST_PERF_SCOPE(StatId, GroupName)
+
+/** Add to a counter such as packets or bytes (DECLARE_DWORD_COUNTER_STAT) */
+#define LBEAST_INC_COUNTER(StatId, GroupName, Amount) \
+	INC_DWORD_STAT_BY(StatId, Amount); \
+	LBEAST_PERF_ADD(StatId, GroupName, Amount)
+
+/** Set a gauge such as a queue depth (DECLARE_DWORD_ACCUMULATOR_STAT) */
+#define LBEAST_SET_GAUGE(StatId, GroupName, NewValue) \
+	SET_DWORD_STAT(StatId, NewValue); \
+	LBEAST_PERF_SET(StatId, GroupName, NewValue)
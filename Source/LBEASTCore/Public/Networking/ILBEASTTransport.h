@@ -0,0 +1,63 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Hardware transport frame
+ *
+ * One unit of data on a hardware link: a UDP datagram, a CAN frame, etc.
+ * Address meaning is transport-specific (CAN ID for SocketCAN, channel for LBEAST UDP).
+ */
+struct LBEASTCORE_API FLBEASTTransportFrame
+{
+	/** Transport-specific address (e.g. CAN ID) */
+	uint32 Address = 0;
+
+	/** Frame payload */
+	TArray<uint8> Data;
+
+	/** Receive timestamp in seconds (FPlatformTime::Seconds() timebase, 0 if unavailable) */
+	double TimestampSeconds = 0.0;
+};
+
+/**
+ * ILBEASTTransport - Interface for non-UObject hardware transports
+ *
+ * Provides a polymorphic interface for links that move raw frames between the
+ * server and hardware, independent of the LBEAST channel protocol:
+ * - SocketCAN: Direct CAN bus access from a Linux server (FLBEASTSocketCANTransport)
+ * - Future: serial, EtherCAT, etc.
+ *
+ * Implementations must be safe to call from the game thread. Receive() never blocks.
+ */
+class LBEASTCORE_API ILBEASTTransport
+{
+public:
+	virtual ~ILBEASTTransport() = default;
+
+	virtual bool Initialize() = 0;
+	virtual void Shutdown() = 0;
+	virtual bool IsConnected() const = 0;
+
+	/**
+	 * Queue a frame for transmission
+	 * @param Address - Transport-specific address (e.g. CAN ID)
+	 * @param Data - Payload bytes
+	 * @param Length - Payload length
+	 * @return True if the frame was accepted
+	 */
+	virtual bool Send(uint32 Address, const uint8* Data, int32 Length) = 0;
+
+	/**
+	 * Drain received frames (non-blocking)
+	 * @param OutFrames - Received frames are appended here
+	 * @param MaxFrames - Upper bound on frames returned by this call
+	 * @return Number of frames appended
+	 */
+	virtual int32 Receive(TArray<FLBEASTTransportFrame>& OutFrames, int32 MaxFrames = 64) = 0;
+
+	/** Human-readable transport name (for logs) */
+	virtual FString GetTransportName() const = 0;
+};
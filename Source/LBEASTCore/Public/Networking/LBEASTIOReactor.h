@@ -0,0 +1,279 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include <atomic>
+#include "LBEASTIOReactor.generated.h"
+
+class FSocket;
+class FInternetAddr;
+class FRunnableThread;
+class FEvent;
+
+/**
+ * One datagram read by the I/O thread
+ */
+struct LBEASTCORE_API FLBEASTIODatagram
+{
+	TArray<uint8> Data;
+
+	/** Sender address (null for native descriptors such as SocketCAN) */
+	TSharedPtr<FInternetAddr> Sender;
+
+	/** When the I/O thread read the datagram (FPlatformTime::Seconds()) */
+	double ReceiveTimeSeconds = 0.0;
+};
+
+/** Called on the game thread once per frame with every datagram received for a source since the last frame */
+DECLARE_DELEGATE_OneParam(FOnLBEASTIODatagrams, const TArray<FLBEASTIODatagram>& /*Datagrams*/);
+
+/** Called on the game thread once per frame when a readiness-only source (e.g. a TCP listen socket) became readable */
+DECLARE_DELEGATE(FOnLBEASTIOReadable);
+
+/**
+ * I/O reactor statistics
+ */
+USTRUCT(BlueprintType)
+struct LBEASTCORE_API FLBEASTIOReactorStats
+{
+	GENERATED_BODY()
+
+	/** Number of registered sockets/descriptors */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|IO")
+	int32 RegisteredSources = 0;
+
+	/** Datagrams read by the I/O thread since startup */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|IO")
+	int64 DatagramsReceived = 0;
+
+	/** Datagrams discarded because a source's inbox was full */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|IO")
+	int64 DatagramsDropped = 0;
+
+	/** Datagrams handed to the game thread in the last frame */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|IO")
+	int32 LastFrameDatagrams = 0;
+
+	/** Smoothed receive -> game-thread dispatch latency (ms) */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|IO")
+	float AverageHandOffLatencyMs = 0.0f;
+
+	/** Worst receive -> game-thread dispatch latency since the last ResetStats() (ms) */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|IO")
+	float MaxHandOffLatencyMs = 0.0f;
+};
+
+/**
+ * LBEAST I/O Reactor (Non-UObject)
+ *
+ * Services every registered socket from one I/O thread and hands the results to the
+ * game thread in a single batch per frame, instead of each transport polling its own
+ * socket (one packet per tick) from its own tick.
+ *
+ * Readiness: the thread sleeps in one wait across every source and only reads the ones
+ * that became readable.
+ * - Linux: epoll over FSocket handles, native descriptors (SocketCAN, raw sockets) and a wake eventfd
+ * - Other BSD-socket platforms: select() over FSocket handles and a loopback wake socket
+ * - Platforms without BSD sockets: sources are drained every FallbackPollMs
+ *
+ * Datagram sources are read on the I/O thread. Readable sources (RegisterReadableSocket)
+ * are only watched: the game thread is told once per frame and does the accept/read itself,
+ * and the source is not watched again until that handler has run.
+ *
+ * A pass holds SourcesLock, so once Unregister() returns the I/O thread no longer
+ * touches that socket and the caller may destroy it.
+ *
+ * All public methods are game-thread safe. Handlers always run on the game thread
+ * from DispatchPending().
+ */
+class LBEASTCORE_API FLBEASTIOReactor : public FRunnable
+{
+public:
+	FLBEASTIOReactor();
+	virtual ~FLBEASTIOReactor();
+
+	/** Start the I/O thread */
+	bool Start();
+
+	/** Stop the I/O thread and drop all sources */
+	void Shutdown();
+
+	/**
+	 * Register a non-blocking UDP socket (caller keeps ownership; Unregister before destroying it)
+	 * @return Source handle, or -1 on failure
+	 */
+	int32 RegisterSocket(FSocket* Socket, FOnLBEASTIODatagrams Handler, const FString& DebugName);
+
+	/**
+	 * Register a native descriptor (Linux only, e.g. a SocketCAN or raw socket fd)
+	 * @return Source handle, or -1 on failure / unsupported platform
+	 */
+	int32 RegisterDescriptor(int32 NativeDescriptor, FOnLBEASTIODatagrams Handler, const FString& DebugName);
+
+	/**
+	 * Watch a socket for readability without reading it (TCP listen/stream sockets)
+	 * The handler should accept/read everything available; the socket is watched again after it returns.
+	 * @return Source handle, or -1 on failure
+	 */
+	int32 RegisterReadableSocket(FSocket* Socket, FOnLBEASTIOReadable Handler, const FString& DebugName);
+
+	/** Remove a source. Pending datagrams for it are discarded. */
+	void Unregister(int32 Handle);
+
+	/** Deliver everything received since the last call (game thread, once per frame) */
+	void DispatchPending();
+
+	FLBEASTIOReactorStats GetStats() const;
+	void ResetStats();
+
+	/** Max datagrams buffered per source between frames */
+	int32 MaxInboxSize = 1024;
+
+	/** Interval between passes on platforms without BSD sockets (no readiness wait available) */
+	int32 FallbackPollMs = 5;
+
+	// FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	struct FSource
+	{
+		int32 Handle = -1;
+		FString DebugName;
+		FSocket* Socket = nullptr;
+		int32 NativeDescriptor = -1;
+		FOnLBEASTIODatagrams Handler;
+
+		/** Readiness-only source (RegisterReadableSocket) */
+		FOnLBEASTIOReadable ReadableHandler;
+
+		/** False while a readable notification waits for the game thread */
+		std::atomic<bool> bArmed{true};
+
+		/** Set by the I/O thread for readiness-only sources (guarded by InboxLock) */
+		bool bReadablePending = false;
+
+		/** RecvFrom target, reused for every datagram (I/O thread only) */
+		TSharedPtr<FInternetAddr> ReceiveAddress;
+
+		/** Shared by consecutive datagrams from the same sender; replaced only when the sender changes */
+		TSharedPtr<FInternetAddr> LastSender;
+
+		/** Filled by the I/O thread (guarded by InboxLock) */
+		TArray<FLBEASTIODatagram> Inbox;
+
+		/** Swapped with Inbox on the game thread */
+		TArray<FLBEASTIODatagram> Delivering;
+	};
+
+	/** Add a source and start watching it */
+	int32 AddSource(const TSharedPtr<FSource>& Source);
+
+	/** Read the sources in ReadyHandles (all of them on the fallback platforms); returns datagrams read */
+	int32 ServiceSources();
+
+	/** Drain one source into its inbox */
+	int32 DrainSource(FSource& Source);
+
+	/** Block until a source is readable or the thread is woken; fills ReadyHandles */
+	void WaitForReadiness();
+
+	/** Start or stop watching a source (epoll registration on Linux, the select() set elsewhere) */
+	void SetWatched(FSource& Source, bool bWatched);
+
+	void WakeIOThread();
+
+	TArray<TSharedPtr<FSource>> Sources;
+	mutable FCriticalSection SourcesLock;
+
+	/** Guards every source's Inbox; taken once per I/O pass and once per frame */
+	mutable FCriticalSection InboxLock;
+
+	int32 NextHandle = 0;
+
+	/** Receive buffer (I/O thread only) */
+	TArray<uint8> ReceiveScratch;
+
+	/** Sources reported readable by the last wait (I/O thread only) */
+	TArray<int32> ReadyHandles;
+
+	FRunnableThread* IOThread = nullptr;
+	FThreadSafeBool bStopRequested;
+
+	/** Wakes the I/O thread on registration changes and shutdown */
+	FEvent* WakeEvent = nullptr;
+	int32 EpollFd = -1;
+	int32 WakeFd = -1;
+
+	/** select() platforms: loopback socket the wait includes, written to by WakeIOThread() */
+	FSocket* WakeSocket = nullptr;
+	TSharedPtr<FInternetAddr> WakeAddress;
+
+	/** I/O thread counters (guarded by InboxLock) */
+	int64 DatagramsReceived = 0;
+	int64 DatagramsDropped = 0;
+
+	/** Game thread hand-off stats */
+	int32 LastFrameDatagrams = 0;
+	double AverageHandOffLatencySeconds = 0.0;
+	double MaxHandOffLatencySeconds = 0.0;
+};
+
+/**
+ * LBEAST I/O Reactor Subsystem
+ *
+ * Owns the game instance's FLBEASTIOReactor and dispatches its batches once per frame.
+ * Transports look it up with ULBEASTIOReactorSubsystem::Get(this) and register their
+ * sockets; ULBEASTUDPTransport does this automatically (see bUseIOReactor).
+ */
+UCLASS()
+class LBEASTCORE_API ULBEASTIOReactorSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Find the reactor for an object's game instance (nullptr if unavailable) */
+	static ULBEASTIOReactorSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** @see FLBEASTIOReactor::RegisterSocket */
+	int32 RegisterSocket(FSocket* Socket, FOnLBEASTIODatagrams Handler, const FString& DebugName);
+
+	/** @see FLBEASTIOReactor::RegisterDescriptor */
+	int32 RegisterDescriptor(int32 NativeDescriptor, FOnLBEASTIODatagrams Handler, const FString& DebugName);
+
+	/** @see FLBEASTIOReactor::RegisterReadableSocket */
+	int32 RegisterReadableSocket(FSocket* Socket, FOnLBEASTIOReadable Handler, const FString& DebugName);
+
+	/** @see FLBEASTIOReactor::Unregister */
+	void Unregister(int32 Handle);
+
+	/** Get I/O statistics (sources, throughput, hand-off latency) */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|IO")
+	FLBEASTIOReactorStats GetReactorStats() const;
+
+	/** Reset max latency and drop counters */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|IO")
+	void ResetReactorStats();
+
+	/** Direct access for non-UObject transports */
+	FLBEASTIOReactor* GetReactor() const { return Reactor.Get(); }
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return Reactor.IsValid(); }
+	virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Conditional; }
+	virtual bool IsTickableWhenPaused() const override { return true; }
+
+private:
+	TUniquePtr<FLBEASTIOReactor> Reactor;
+};
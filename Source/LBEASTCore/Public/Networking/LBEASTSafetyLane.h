@@ -0,0 +1,207 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Health/LBEASTDeviceHealth.h"
+#include "LBEASTSafetyLane.generated.h"
+
+class FSocket;
+class FInternetAddr;
+class FRunnableThread;
+class FEvent;
+
+/**
+ * Delivery settings for safety commands sent by one transport
+ */
+USTRUCT(BlueprintType)
+struct LBEASTCORE_API FLBEASTSafetyLaneConfig
+{
+	GENERATED_BODY()
+
+	/** Copies put on the wire immediately, back to back (covers single-packet loss without waiting for a retransmit) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Safety", meta = (ClampMin = "1", ClampMax = "8"))
+	int32 RedundantCopies = 3;
+
+	/** First retransmit delay while unacknowledged (doubles per retransmit up to MaxRetransmitIntervalMs) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Safety", meta = (ClampMin = "1"))
+	int32 RetransmitIntervalMs = 20;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Safety", meta = (ClampMin = "1"))
+	int32 MaxRetransmitIntervalMs = 200;
+
+	/**
+	 * Stop retransmitting and log an error if no ACK arrives within this time.
+	 * Capped at the firmware's LBEAST_SAFETY_SEQ_WINDOW_MS (6 s) so a late retransmit can't act twice.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Safety", meta = (ClampMin = "0.1", ClampMax = "6.0"))
+	float GiveUpSeconds = 5.0f;
+
+	/**
+	 * Also send one plain Bool packet on the same channel, so ECU firmware that predates
+	 * the Safety packet type still acts on the command
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Safety")
+	bool bSendLegacyBool = true;
+};
+
+/**
+ * Safety lane statistics (process-wide)
+ */
+USTRUCT(BlueprintType)
+struct LBEASTCORE_API FLBEASTSafetyLaneStats
+{
+	GENERATED_BODY()
+
+	/** Commands submitted */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Safety")
+	int32 CommandsSent = 0;
+
+	/** Commands the ECU acknowledged */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Safety")
+	int32 CommandsAcked = 0;
+
+	/** Commands given up on after GiveUpSeconds without an ACK */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Safety")
+	int32 CommandsUnacked = 0;
+
+	/** Commands currently waiting for an ACK */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Safety")
+	int32 CommandsPending = 0;
+
+	/** Retransmissions (redundant first copies not included) */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Safety")
+	int32 Retransmits = 0;
+
+	/** API call to first copy handed to the socket (microseconds, rolling window) */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Safety")
+	float CallToWireP50Us = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Safety")
+	float CallToWireP99Us = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Safety")
+	float CallToWireMaxUs = 0.0f;
+
+	/** API call to ACK processed on the game thread (milliseconds, rolling window) */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Safety")
+	float AckLatencyP50Ms = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Safety")
+	float AckLatencyP99Ms = 0.0f;
+};
+
+/**
+ * One safety command ready for the wire
+ */
+struct FLBEASTSafetyCommand
+{
+	/** Transport that owns the socket (used to match ACKs and to cancel on shutdown) */
+	const void* Owner = nullptr;
+
+	FSocket* Socket = nullptr;
+	TSharedPtr<FInternetAddr> RemoteAddress;
+
+	/** Complete packet in the device's wire format (already secured if the device uses HMAC/encryption) */
+	TArray<uint8> Packet;
+
+	int32 Channel = 0;
+	uint16 Sequence = 0;
+
+	/** FPlatformTime::Seconds() when the caller asked for the command */
+	double CallSeconds = 0.0;
+
+	/** FLBEASTSessionCapture source id (-1 = not captured) */
+	int32 CaptureSource = -1;
+
+	/** FLBEASTDeviceHealthRegistry handle the ACK round trip is reported to (-1 = none) */
+	int32 HealthHandle = -1;
+
+	FLBEASTSafetyLaneConfig Config;
+};
+
+/**
+ * LBEAST Safety Lane (Non-UObject, process-wide)
+ *
+ * Priority path for safety-critical commands (emergency stop). Submit() puts the packet
+ * on the wire from the calling thread straight away - no send queue, no frame wait - and
+ * repeats it RedundantCopies times. A dedicated thread then retransmits with backoff
+ * until the ECU acknowledges the sequence number or GiveUpSeconds runs out. A newer
+ * command on the same channel supersedes a pending one.
+ *
+ * Wire format (ELBEASTUDPDataType::Safety): payload [Sequence:LE16][Value:1]. The ECU
+ * executes each sequence number once and echoes the same packet back as the ACK.
+ *
+ * This is delivery assurance for the software path only. The hardware E-stop chain stays
+ * the primary safety system (see FirmwareExamples/ESTOP_&_Safety_Considerations.md).
+ */
+class LBEASTCORE_API FLBEASTSafetyLane : public FRunnable
+{
+public:
+	static FLBEASTSafetyLane& Get();
+
+	FLBEASTSafetyLane();
+	virtual ~FLBEASTSafetyLane();
+
+	/** Next sequence number (never 0, so firmware can use 0 as "none seen") */
+	uint16 AllocateSequence();
+
+	/**
+	 * Send now and keep retransmitting until acknowledged (thread-safe)
+	 * @return True if the first copy reached the socket
+	 */
+	bool Submit(FLBEASTSafetyCommand&& Command);
+
+	/** ECU ACK for (Owner, Channel, Sequence); call from the receive path (game thread) */
+	void Acknowledge(const void* Owner, int32 Channel, uint16 Sequence);
+
+	/** Drop every pending command for a transport. Must be called before its socket is destroyed. */
+	void CancelOwner(const void* Owner);
+
+	/** True while a command on this channel is waiting for an ACK */
+	bool IsPending(const void* Owner, int32 Channel) const;
+
+	FLBEASTSafetyLaneStats GetStats() const;
+
+	/** Stop the retransmit thread (module shutdown) */
+	void Shutdown();
+
+	// FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	struct FPending
+	{
+		FLBEASTSafetyCommand Command;
+		double NextSendSeconds = 0.0;
+		double IntervalSeconds = 0.0;
+	};
+
+	/** Send one copy; returns false if the socket refused it. Caller holds Lock. */
+	bool SendCopy(const FLBEASTSafetyCommand& Command);
+
+	void EnsureThread();
+
+	/** Retransmit due commands, expire old ones; returns seconds until the next deadline */
+	double ServicePending(double NowSeconds);
+
+	mutable FCriticalSection Lock;
+	TArray<FPending> Pending;
+
+	FRunnableThread* Thread = nullptr;
+	FEvent* WakeEvent = nullptr;
+	FThreadSafeBool bStopRequested;
+
+	uint16 NextSequence = 1;
+
+	int32 CommandsSent = 0;
+	int32 CommandsAcked = 0;
+	int32 CommandsUnacked = 0;
+	int32 Retransmits = 0;
+	FLBEASTRollingPercentile CallToWireUs;
+	FLBEASTRollingPercentile AckLatencyMs;
+	float CallToWireMaxUs = 0.0f;
+};
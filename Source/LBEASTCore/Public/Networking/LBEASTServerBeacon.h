@@ -7,8 +7,12 @@
 #include "Sockets.h"
 #include "SocketSubsystem.h"
 #include "Interfaces/IPv4/IPv4Address.h"
+#include "LBEASTStats.h"
 #include "LBEASTServerBeacon.generated.h"
 
+class ULBEASTIOReactorSubsystem;
+struct FLBEASTIODatagram;
+
 /**
  * Server information broadcast over LAN
  */
@@ -55,6 +59,14 @@ struct FLBEASTServerInfo
 	/** Is this server accepting new connections? */
 	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Networking")
 	bool bAcceptingConnections = true;
+
+	/** Server game thread frame time when the beacon was sent (ms, 0 if not reported) */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Networking")
+	float ServerFrameTimeMs = 0.0f;
+
+	/** Busiest LBEAST perf stats on the server (empty if the server doesn't publish them) */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Networking")
+	TArray<FLBEASTPerfSample> PerfSamples;
 };
 
 /**
@@ -102,6 +114,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Networking")
 	float ServerTimeout = 10.0f;
 
+	/** Server mode: append the busiest LBEAST perf stats to each broadcast (for the Server Manager overlay) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Networking")
+	bool bBroadcastPerfStats = true;
+
+	/** Max perf stats per broadcast (keeps the packet within one Ethernet frame) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Networking", meta = (ClampMin = "0", ClampMax = "16"))
+	int32 MaxBroadcastPerfStats = 12;
+
 	/** Fired when a new server is discovered */
 	UPROPERTY(BlueprintAssignable, Category = "LBEAST|Networking")
 	FOnServerDiscovered OnServerDiscovered;
@@ -161,6 +181,13 @@ public:
 private:
 	FSocket* BroadcastSocket = nullptr;
 	FSocket* ListenSocket = nullptr;
+
+	/** Client mode: beacons arrive through the I/O reactor when one is available (ReceivePackets() polls otherwise) */
+	TWeakObjectPtr<ULBEASTIOReactorSubsystem> IOReactor;
+	int32 IOReactorHandle = -1;
+
+	/** FLBEASTSessionCapture source id (Address = peer IPv4) */
+	int32 CaptureSource = -1;
 	
 	bool bIsActive = false;
 	bool bIsServerMode = false;
@@ -182,6 +209,15 @@ private:
 	/** Receive and process incoming packets */
 	void ReceivePackets();
 
+	/** Process one beacon packet */
+	void HandleBeaconPacket(const TArray<uint8>& Data, const FString& SenderIP);
+
+	/** I/O reactor batch callback (game thread) */
+	void HandleIOReactorDatagrams(const TArray<FLBEASTIODatagram>& Datagrams);
+
+	/** Session replay callback (client mode) */
+	void HandleCaptureReplay(uint32 Address, const TArray<uint8>& Data);
+
 	/** Check for server timeouts */
 	void CheckServerTimeouts();
 
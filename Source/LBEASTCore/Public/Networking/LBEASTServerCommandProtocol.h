@@ -9,6 +9,9 @@
 #include "Interfaces/IPv4/IPv4Address.h"
 #include "LBEASTServerCommandProtocol.generated.h"
 
+class ULBEASTIOReactorSubsystem;
+struct FLBEASTIODatagram;
+
 /**
  * Server command types that can be sent from Command Console to Server Manager
  */
@@ -267,6 +270,15 @@ protected:
 	/** Last sender address (for sending responses to commands) */
 	TSharedPtr<FInternetAddr> LastSenderAddress;
 
+	/** FLBEASTSessionCapture source ids for the listen and client sockets */
+	int32 ListenCaptureSource = -1;
+	int32 ClientCaptureSource = -1;
+
+	/** I/O reactor registrations; sockets are polled from Tick()/TickClient() when there is no reactor */
+	TWeakObjectPtr<ULBEASTIOReactorSubsystem> IOReactor;
+	int32 ListenReactorHandle = -1;
+	int32 ClientReactorHandle = -1;
+
 	/** Create UDP socket for sending commands (client mode) */
 	bool CreateClientSocket();
 
@@ -276,6 +288,24 @@ protected:
 	/** Process incoming command packets (server mode) */
 	void ProcessIncomingCommands();
 
+	/** Deserialize, authenticate and broadcast one command packet (Sender may be null for replayed packets) */
+	void HandleCommandPacket(const TArray<uint8>& ReceivedData, TSharedPtr<FInternetAddr> Sender);
+
+	/** Deserialize and log one response packet (client mode) */
+	void HandleResponsePacket(const TArray<uint8>& ReceivedData);
+
+	/** Register a socket with the game instance's I/O reactor; returns the handle or -1 */
+	int32 RegisterWithIOReactor(FSocket* Socket, bool bListenSocket);
+
+	/** I/O reactor batch callbacks (game thread) */
+	void HandleListenDatagrams(const TArray<FLBEASTIODatagram>& Datagrams);
+	void HandleClientDatagrams(const TArray<FLBEASTIODatagram>& Datagrams);
+
+	/** Session replay callback for the listen socket */
+	void HandleCaptureReplay(uint32 Address, const TArray<uint8>& Data);
+
+	int32 GetCaptureSource(const FSocket* Socket) const { return Socket == ListenSocket ? ListenCaptureSource : ClientCaptureSource; }
+
 	/** Serialize command message to JSON */
 	FString SerializeCommand(const FLBEASTServerCommandMessage& Command) const;
 
@@ -0,0 +1,433 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Containers/Queue.h"
+#include <atomic>
+#include "LBEASTSessionCapture.generated.h"
+
+class FArchive;
+class IFileHandle;
+class FRunnableThread;
+class FEvent;
+
+/**
+ * Direction of a captured frame, seen from this server
+ */
+UENUM(BlueprintType)
+enum class ELBEASTCaptureDirection : uint8
+{
+	Inbound		UMETA(DisplayName = "Inbound"),
+	Outbound	UMETA(DisplayName = "Outbound")
+};
+
+/**
+ * Record kinds in a capture file
+ */
+enum class ELBEASTCaptureRecordType : uint8
+{
+	/** Source id -> name (payload: UTF-8 name) */
+	Source = 1,
+
+	/** One frame on the wire (payload: frame bytes) */
+	Frame = 2,
+
+	/** Operator/code annotation (payload: UTF-8 text) */
+	Marker = 3,
+
+	/** Seek checkpoint (payload: see FLBEASTSessionCapture) */
+	Index = 4
+};
+
+/**
+ * One record read back from a capture file
+ */
+struct LBEASTCORE_API FLBEASTCaptureRecord
+{
+	ELBEASTCaptureRecordType Type = ELBEASTCaptureRecordType::Frame;
+	ELBEASTCaptureDirection Direction = ELBEASTCaptureDirection::Inbound;
+
+	/** Source id as written by the recording process (resolve with FLBEASTCaptureReader::GetSourceName) */
+	uint16 SourceId = 0;
+
+	/** Transport-specific address (CAN ID for SocketCAN, 0 for UDP) */
+	uint32 Address = 0;
+
+	/** Seconds since the start of the recording */
+	double TimeSeconds = 0.0;
+
+	TArray<uint8> Data;
+};
+
+/** Delivers a replayed inbound frame to a live transport (game thread) */
+DECLARE_DELEGATE_TwoParams(FOnLBEASTCaptureReplay, uint32 /*Address*/, const TArray<uint8>& /*Data*/);
+
+/**
+ * LBEAST Session Capture (Non-UObject, process-wide)
+ *
+ * Every LBEAST transport registers itself here as a named capture source and reports
+ * each frame it sends or receives. While a recording is running, frames are pushed onto a
+ * lock-free queue and written by a dedicated writer thread to an append-only binary log;
+ * when no recording is running, Record() is a single relaxed atomic load.
+ *
+ * Sources also register a replay handler, which ULBEASTSessionCaptureSubsystem uses to
+ * feed recorded inbound frames back into the same transport (matched by source name).
+ *
+ * File format (little-endian):
+ *   Header:  "LBEASTSC" | uint32 Version | uint32 HeaderSize | int64 StartUtcTicks | uint64 Reserved
+ *   Record:  uint8 Type | uint8 Direction | uint16 SourceId | uint32 Address | uint32 Length | uint64 TimeMicros | Payload[Length]
+ *
+ * An Index record is written before the first record of every IndexIntervalSeconds window
+ * (payload: uint64 PreviousIndexOffset | uint64 RecordsWritten | uint64 RecordsDropped), so a
+ * reader can seek to any time without replaying from the start. A truncated tail (crash,
+ * power loss) only loses the records after the last complete one.
+ */
+class LBEASTCORE_API FLBEASTSessionCapture : public FRunnable
+{
+public:
+	static FLBEASTSessionCapture& Get();
+
+	FLBEASTSessionCapture();
+	virtual ~FLBEASTSessionCapture();
+
+	// =====================================
+	// Sources
+	// =====================================
+
+	/**
+	 * Register a capture source (thread-safe)
+	 * @param Name - Stable name used to match sources between recording and replay (e.g. "UDP 192.168.1.50:8888").
+	 *               A name already in use gets a "#2", "#3", ... suffix.
+	 * @param ReplayHandler - Receives replayed inbound frames for this source (optional)
+	 * @return Source id (>= 0)
+	 */
+	int32 RegisterSource(const FString& Name, FOnLBEASTCaptureReplay ReplayHandler = FOnLBEASTCaptureReplay());
+
+	/** Set or replace a source's replay handler */
+	void SetReplayHandler(int32 SourceId, FOnLBEASTCaptureReplay ReplayHandler);
+
+	/** Remove a source; its id is reused if the same name registers again */
+	void UnregisterSource(int32 SourceId);
+
+	/**
+	 * Deliver a replayed inbound frame to the live source with this name (game thread)
+	 * @return False if no live source with a replay handler matches
+	 */
+	bool ReplayToSource(const FString& Name, uint32 Address, const TArray<uint8>& Data);
+
+	// =====================================
+	// Recording
+	// =====================================
+
+	/**
+	 * Report one frame. Cheap no-op unless a recording is running. Any thread.
+	 * @param TimestampSeconds - When the frame was sent/received (FPlatformTime::Seconds()); 0 = now
+	 */
+	FORCEINLINE void Record(int32 SourceId, ELBEASTCaptureDirection Direction, uint32 Address, const uint8* Data, int32 Length, double TimestampSeconds = 0.0)
+	{
+		if (SourceId >= 0 && bRecording.load(std::memory_order_relaxed))
+		{
+			EnqueueRecord(ELBEASTCaptureRecordType::Frame, Direction, SourceId, Address, Data, Length, TimestampSeconds);
+		}
+	}
+
+	/** Add an annotation to the recording (e.g. "Door 3 unlock requested") */
+	void AddMarker(const FString& Text);
+
+	/**
+	 * Start writing a new capture file
+	 * @return False if already recording or the file can't be created
+	 */
+	bool StartRecording(const FString& FilePath);
+
+	/** Flush everything queued, write a final index and close the file */
+	void StopRecording();
+
+	bool IsRecording() const { return bRecording.load(std::memory_order_relaxed); }
+	const FString& GetRecordingPath() const { return RecordingPath; }
+
+	int64 GetRecordsWritten() const { return RecordsWritten.load(std::memory_order_relaxed); }
+	int64 GetBytesWritten() const { return BytesWritten.load(std::memory_order_relaxed); }
+	int64 GetRecordsDropped() const { return RecordsDropped.load(std::memory_order_relaxed); }
+
+	/** Records buffered for the writer before new ones are dropped (producers never block) */
+	int32 MaxQueuedRecords = 65536;
+
+	/** Seconds between index records */
+	double IndexIntervalSeconds = 1.0;
+
+	/** Seconds between file flushes (bounds what a crash can lose) */
+	double FlushIntervalSeconds = 1.0;
+
+	// FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+	static constexpr uint32 FileVersion = 1;
+	static constexpr int32 HeaderSize = 32;
+	static constexpr int32 RecordHeaderSize = 20;
+
+private:
+	struct FPendingRecord
+	{
+		ELBEASTCaptureRecordType Type = ELBEASTCaptureRecordType::Frame;
+		ELBEASTCaptureDirection Direction = ELBEASTCaptureDirection::Inbound;
+		uint16 SourceId = 0;
+		uint32 Address = 0;
+		double TimestampSeconds = 0.0;
+
+		/** Hardware frames are small; only large ones (DMX, JSON) touch the heap */
+		TArray<uint8, TInlineAllocator<64>> Data;
+	};
+
+	struct FSource
+	{
+		FString Name;
+		FOnLBEASTCaptureReplay ReplayHandler;
+		bool bActive = false;
+	};
+
+	void EnqueueRecord(ELBEASTCaptureRecordType Type, ELBEASTCaptureDirection Direction, int32 SourceId, uint32 Address, const uint8* Data, int32 Length, double TimestampSeconds);
+
+	/** Queue a Source record (caller holds SourcesLock) */
+	void EnqueueSourceRecord(int32 SourceId);
+
+	/** Writer thread: move queued records into the write buffer and onto disk */
+	void DrainQueue();
+	void AppendRecord(ELBEASTCaptureRecordType Type, ELBEASTCaptureDirection Direction, uint16 SourceId, uint32 Address, uint64 TimeMicros, const uint8* Data, int32 Length);
+	void AppendIndex(uint64 TimeMicros);
+	void FlushWriteBuffer();
+
+	// Sources
+	TArray<FSource> Sources;
+	mutable FCriticalSection SourcesLock;
+
+	// Producer side
+	std::atomic<bool> bRecording{false};
+	TQueue<FPendingRecord, EQueueMode::Mpsc> Queue;
+	std::atomic<int32> QueuedRecords{0};
+
+	// Writer side (writer thread, or the game thread once the writer has stopped)
+	IFileHandle* File = nullptr;
+	FString RecordingPath;
+	double StartSeconds = 0.0;
+	TArray<uint8> WriteBuffer;
+	uint64 FileOffset = 0;
+	uint64 PreviousIndexOffset = 0;
+	uint64 NextIndexMicros = 0;
+	double LastFlushSeconds = 0.0;
+
+	std::atomic<int64> RecordsWritten{0};
+	std::atomic<int64> BytesWritten{0};
+	std::atomic<int64> RecordsDropped{0};
+
+	FRunnableThread* WriterThread = nullptr;
+	FThreadSafeBool bStopRequested;
+	FEvent* WakeEvent = nullptr;
+};
+
+/**
+ * Capture file reader (Non-UObject)
+ *
+ * Open() scans record headers once (payloads are skipped) to collect source names,
+ * index checkpoints and the duration; ReadNext() then streams records in file order.
+ */
+class LBEASTCORE_API FLBEASTCaptureReader
+{
+public:
+	~FLBEASTCaptureReader();
+
+	/** @return False (with OutError) if the file is missing or not a capture file */
+	bool Open(const FString& FilePath, FString& OutError);
+	void Close();
+
+	/** Read the next record (false at end of file or at a truncated tail) */
+	bool ReadNext(FLBEASTCaptureRecord& OutRecord);
+
+	/** Position at the last index checkpoint at or before TimeSeconds */
+	void SeekToTime(double TimeSeconds);
+
+	/** Name the recording process gave a source id (empty if unknown) */
+	FString GetSourceName(uint16 SourceId) const;
+
+	double GetDurationSeconds() const { return DurationSeconds; }
+	int64 GetFrameCount() const { return FrameCount; }
+	FDateTime GetStartTimeUtc() const { return StartTimeUtc; }
+	const TMap<uint16, FString>& GetSources() const { return SourceNames; }
+
+private:
+	struct FIndexEntry
+	{
+		double TimeSeconds = 0.0;
+		int64 Offset = 0;
+	};
+
+	bool ReadRecordHeader(ELBEASTCaptureRecordType& OutType, ELBEASTCaptureDirection& OutDirection, uint16& OutSourceId, uint32& OutAddress, uint32& OutLength, uint64& OutTimeMicros);
+
+	TUniquePtr<FArchive> Reader;
+	int64 FileSize = 0;
+	FDateTime StartTimeUtc;
+	double DurationSeconds = 0.0;
+	int64 FrameCount = 0;
+	TMap<uint16, FString> SourceNames;
+	TArray<FIndexEntry> IndexEntries;
+};
+
+/**
+ * Session capture statistics
+ */
+USTRUCT(BlueprintType)
+struct LBEASTCORE_API FLBEASTSessionCaptureStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Capture")
+	bool bRecording = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Capture")
+	FString RecordingPath;
+
+	/** Records written to the current/last recording */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Capture")
+	int64 RecordsWritten = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Capture")
+	int64 BytesWritten = 0;
+
+	/** Records lost because the writer fell behind */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Capture")
+	int64 RecordsDropped = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Capture")
+	bool bReplaying = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Capture")
+	FString ReplayPath;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Capture")
+	float ReplayPositionSeconds = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Capture")
+	float ReplayDurationSeconds = 0.0f;
+
+	/** Inbound frames delivered to live transports */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Capture")
+	int64 FramesReplayed = 0;
+
+	/** Inbound frames whose source has no live transport in this session */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Capture")
+	int64 FramesUnmatched = 0;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLBEASTReplayMarker, const FString&, Text, float, TimeSeconds);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnLBEASTReplayFinished);
+
+/**
+ * LBEAST Session Capture Subsystem
+ *
+ * Blueprint/command-line front end for FLBEASTSessionCapture, and the replay clock.
+ *
+ * Command line:
+ *   -LBEASTCapture[=Path]           Record from startup (default: Saved/Captures/Session-<timestamp>.lbcap)
+ *   -LBEASTReplay=Path              Replay a capture from startup
+ *   -LBEASTReplayRate=2.0           Replay speed (0 = as fast as possible)
+ *   -LBEASTReplayDelay=2.0          Seconds to wait before replaying, so transports opened in BeginPlay can register
+ *
+ * Replay feeds recorded inbound frames into the live transports with the same source
+ * names (same experience, same device IPs/interfaces), so a production incident can be
+ * reproduced and profiled on a dev box with no hardware attached. Outbound frames are
+ * skipped; the code under test produces its own.
+ */
+UCLASS()
+class LBEASTCORE_API ULBEASTSessionCaptureSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	static ULBEASTSessionCaptureSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Start recording every LBEAST transport
+	 * @param FilePath - Capture file; empty = Saved/Captures/Session-<timestamp>.lbcap
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|Capture")
+	bool StartRecording(const FString& FilePath = TEXT(""));
+
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|Capture")
+	void StopRecording();
+
+	/** Annotate the recording (e.g. from experience code when a cue fires) */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|Capture")
+	void AddMarker(const FString& Text);
+
+	/**
+	 * Replay a capture into the live transports
+	 * @param PlaybackRate - 1 = original timing, 2 = twice as fast, 0 = as fast as possible
+	 * @param StartOffsetSeconds - Skip to this point (uses the file's index checkpoints)
+	 * @param bLoop - Restart at the end instead of stopping
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|Capture")
+	bool StartReplay(const FString& FilePath, float PlaybackRate = 1.0f, float StartOffsetSeconds = 0.0f, bool bLoop = false);
+
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|Capture")
+	void StopReplay();
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|Capture")
+	bool IsRecording() const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|Capture")
+	bool IsReplaying() const { return ReplayReader.IsValid(); }
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|Capture")
+	FLBEASTSessionCaptureStats GetCaptureStats() const;
+
+	/** Fired when replay reaches a marker record */
+	UPROPERTY(BlueprintAssignable, Category = "LBEAST|Capture")
+	FOnLBEASTReplayMarker OnReplayMarker;
+
+	/** Fired when a non-looping replay reaches the end of the file */
+	UPROPERTY(BlueprintAssignable, Category = "LBEAST|Capture")
+	FOnLBEASTReplayFinished OnReplayFinished;
+
+	/** Upper bound on records dispatched per frame (keeps fast replays from stalling a frame) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Capture")
+	int32 MaxReplayRecordsPerTick = 4096;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return ReplayReader.IsValid(); }
+	virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Conditional; }
+	virtual bool IsTickableWhenPaused() const override { return true; }
+
+private:
+	void DispatchReplayRecord(const FLBEASTCaptureRecord& Record);
+
+	/** True if this subsystem started the running recording (and should stop it) */
+	bool bOwnsRecording = false;
+
+	TUniquePtr<FLBEASTCaptureReader> ReplayReader;
+	FString ReplayPath;
+	FLBEASTCaptureRecord PendingRecord;
+	bool bHasPendingRecord = false;
+	double ReplayClockSeconds = 0.0;
+	double ReplayStartOffsetSeconds = 0.0;
+	float ReplayRate = 1.0f;
+	bool bReplayLoop = false;
+
+	/** Wall-clock seconds left before the replay clock starts */
+	float ReplayDelaySeconds = 0.0f;
+	int64 FramesReplayed = 0;
+	int64 FramesUnmatched = 0;
+
+	/** Sources already reported as unmatched (log once per source) */
+	TSet<FString> UnmatchedSources;
+};
@@ -0,0 +1,210 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter64.h"
+#include "Containers/Queue.h"
+#include "Networking/ILBEASTTransport.h"
+
+class FRunnableThread;
+
+/**
+ * Classic CAN frame (8-byte payload)
+ * Fixed size so frames move between threads without heap allocation.
+ */
+struct LBEASTCORE_API FLBEASTCANFrame
+{
+	/** 11-bit standard or 29-bit extended identifier */
+	uint32 CanId = 0;
+
+	/** True for 29-bit extended identifiers */
+	bool bExtended = false;
+
+	/** True for remote transmission requests */
+	bool bRemote = false;
+
+	/** True for error frames (only received when bReceiveErrorFrames is set) */
+	bool bError = false;
+
+	/** Payload length (0-8) */
+	uint8 Length = 0;
+
+	/** Payload */
+	uint8 Data[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+
+	/** Kernel receive timestamp in seconds (FPlatformTime::Seconds() timebase) */
+	double TimestampSeconds = 0.0;
+};
+
+/**
+ * CAN receive filter
+ * A frame passes when (ReceivedId & Mask) == (Id & Mask). No filters = receive everything.
+ */
+struct LBEASTCORE_API FLBEASTCANFilter
+{
+	uint32 Id = 0;
+	uint32 Mask = 0x7FF;
+	bool bExtended = false;
+
+	FLBEASTCANFilter() = default;
+	FLBEASTCANFilter(uint32 InId, uint32 InMask, bool bInExtended = false)
+		: Id(InId), Mask(InMask), bExtended(bInExtended) {}
+};
+
+/**
+ * SocketCAN transport configuration
+ */
+struct LBEASTCORE_API FLBEASTSocketCANConfig
+{
+	/** CAN interface name ("can0" for hardware, "vcan0" for testing) */
+	FString InterfaceName = TEXT("can0");
+
+	/** Kernel-side receive filters (empty = receive all frames) */
+	TArray<FLBEASTCANFilter> Filters;
+
+	/** Deliver bus error frames to Receive() */
+	bool bReceiveErrorFrames = false;
+
+	/** Receive our own transmitted frames (useful for loopback tests on vcan) */
+	bool bReceiveOwnFrames = false;
+
+	/** Max frames per sendmmsg/recvmmsg call */
+	int32 BatchSize = 32;
+
+	/** Max frames buffered for the game thread before new frames are dropped */
+	int32 MaxQueuedFrames = 4096;
+};
+
+/**
+ * SocketCAN Transport (Linux only)
+ *
+ * Talks to CAN devices (scissor lifts, servo drives) directly from the Linux server,
+ * removing the microcontroller that would otherwise relay UDP to CAN.
+ *
+ * A dedicated I/O thread owns the socket:
+ * - Batched sendmmsg()/recvmmsg() (one syscall per batch, not per frame)
+ * - Kernel receive timestamps (SO_TIMESTAMPNS) on every frame
+ * - Cyclic transmission (e.g. joystick keepalives) scheduled on the I/O thread,
+ *   so keepalives keep flowing even if the game thread hitches
+ *
+ * Frames cross threads through lock-free queues; the game thread calls Send*()
+ * and Receive*() without blocking.
+ *
+ * Test against a virtual bus:
+ *   sudo modprobe vcan && sudo ip link add dev vcan0 type vcan && sudo ip link set up vcan0
+ *   candump vcan0
+ *
+ * On non-Linux platforms Initialize() logs an error and returns false.
+ */
+class LBEASTCORE_API FLBEASTSocketCANTransport : public ILBEASTTransport, public FRunnable
+{
+public:
+	explicit FLBEASTSocketCANTransport(const FLBEASTSocketCANConfig& InConfig);
+	virtual ~FLBEASTSocketCANTransport();
+
+	// ILBEASTTransport
+	virtual bool Initialize() override;
+	virtual void Shutdown() override;
+	virtual bool IsConnected() const override { return bConnected; }
+	virtual bool Send(uint32 Address, const uint8* Data, int32 Length) override;
+	virtual int32 Receive(TArray<FLBEASTTransportFrame>& OutFrames, int32 MaxFrames = 64) override;
+	virtual FString GetTransportName() const override { return FString::Printf(TEXT("SocketCAN(%s)"), *Config.InterfaceName); }
+
+	/**
+	 * Queue a CAN frame for transmission (non-blocking)
+	 * @return False if not connected or the frame is invalid
+	 */
+	bool SendFrame(const FLBEASTCANFrame& Frame);
+
+	/**
+	 * Drain received CAN frames (non-blocking)
+	 * @return Number of frames appended to OutFrames
+	 */
+	int32 ReceiveFrames(TArray<FLBEASTCANFrame>& OutFrames, int32 MaxFrames = 64);
+
+	/**
+	 * Start transmitting a frame every IntervalMs on the I/O thread
+	 * @return Handle for UpdateCyclicFrame/RemoveCyclicFrame, or -1 on failure
+	 */
+	int32 AddCyclicFrame(const FLBEASTCANFrame& Frame, float IntervalMs);
+
+	/**
+	 * Replace the payload of a cyclic frame (e.g. new joystick values); keeps its schedule
+	 */
+	bool UpdateCyclicFrame(int32 Handle, const FLBEASTCANFrame& Frame);
+
+	/** Stop a cyclic frame */
+	void RemoveCyclicFrame(int32 Handle);
+
+	/** Transmit/receive counters (thread-safe) */
+	int64 GetFramesSent() const { return FramesSent.GetValue(); }
+	int64 GetFramesReceived() const { return FramesReceived.GetValue(); }
+	int64 GetFramesDropped() const { return FramesDropped.GetValue(); }
+	int64 GetSendErrors() const { return SendErrors.GetValue(); }
+
+	const FLBEASTSocketCANConfig& GetConfig() const { return Config; }
+
+	// FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	struct FCyclicEntry
+	{
+		int32 Handle = -1;
+		FLBEASTCANFrame Frame;
+		double IntervalSeconds = 0.0;
+		double NextDueSeconds = 0.0;
+	};
+
+	/** Send everything queued by the game thread plus due cyclic frames */
+	void FlushTransmit();
+
+	/** Read all available frames in batches */
+	void DrainReceive();
+
+	/** Seconds until the next cyclic frame is due (capped) */
+	double GetCyclicWaitSeconds() const;
+
+	/** Wake the I/O thread so queued frames go out immediately */
+	void WakeIOThread();
+
+	/** Session replay callback (game thread) */
+	void HandleCaptureReplay(uint32 Address, const TArray<uint8>& Data);
+
+	FLBEASTSocketCANConfig Config;
+
+	/** SocketCAN raw socket, and eventfd used to wake the I/O thread */
+	int32 SocketFd = -1;
+	int32 WakeFd = -1;
+
+	FRunnableThread* IOThread = nullptr;
+	FThreadSafeBool bStopRequested;
+	FThreadSafeBool bConnected;
+
+	/** Game thread -> I/O thread (multiple producers allowed) */
+	TQueue<FLBEASTCANFrame, EQueueMode::Mpsc> TransmitQueue;
+
+	/** I/O thread -> game thread */
+	TQueue<FLBEASTCANFrame, EQueueMode::Spsc> ReceiveQueue;
+	FThreadSafeCounter64 ReceiveQueueDepth;
+
+	/** Replayed frames, delivered ahead of the receive queue (game thread only) */
+	TArray<FLBEASTCANFrame> ReplayFrames;
+
+	/** FLBEASTSessionCapture source id */
+	int32 CaptureSource = -1;
+
+	/** Cyclic frames (guarded by CyclicLock) */
+	TArray<FCyclicEntry> CyclicFrames;
+	mutable FCriticalSection CyclicLock;
+	int32 NextCyclicHandle = 0;
+
+	FThreadSafeCounter64 FramesSent;
+	FThreadSafeCounter64 FramesReceived;
+	FThreadSafeCounter64 FramesDropped;
+	FThreadSafeCounter64 SendErrors;
+};
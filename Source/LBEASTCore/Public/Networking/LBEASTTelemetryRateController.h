@@ -0,0 +1,164 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "LBEASTTelemetryRateController.generated.h"
+
+class ULBEASTUDPTransport;
+
+/**
+ * One server-controllable ECU telemetry stream
+ *
+ * The ECU exposes an int32 "update interval (ms)" channel for the stream
+ * (e.g. Gunship: Channel 100 = button events, Channel 101 = gun telemetry).
+ */
+USTRUCT(BlueprintType)
+struct LBEASTCORE_API FLBEASTTelemetryStream
+{
+	GENERATED_BODY()
+
+	/** Display name for logs and stats */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Telemetry Rate")
+	FName StreamName;
+
+	/** Channel the ECU accepts the interval on (int32, milliseconds) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Telemetry Rate")
+	int32 IntervalChannel = 100;
+
+	/** Interval while a play session is active */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Telemetry Rate", meta = (ClampMin = "1"))
+	int32 ActiveIntervalMs = 50;
+
+	/** Interval while idle / in attract mode */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Telemetry Rate", meta = (ClampMin = "1"))
+	int32 IdleIntervalMs = 500;
+
+	/** Fastest interval the firmware accepts */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Telemetry Rate", meta = (ClampMin = "1"))
+	int32 MinIntervalMs = 10;
+
+	/** Slowest interval the budget may throttle the stream to */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Telemetry Rate", meta = (ClampMin = "1"))
+	int32 MaxIntervalMs = 2000;
+};
+
+/**
+ * Telemetry rate controller statistics
+ */
+USTRUCT(BlueprintType)
+struct LBEASTCORE_API FLBEASTTelemetryRateStats
+{
+	GENERATED_BODY()
+
+	/** Registered transports / streams */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Telemetry Rate")
+	int32 Transports = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Telemetry Rate")
+	int32 Streams = 0;
+
+	/** Streams currently slower than their Active/Idle interval because of the budget */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Telemetry Rate")
+	int32 ThrottledStreams = 0;
+
+	/** Measured server receive rate (packets/s) */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Telemetry Rate")
+	float ReceivePacketsPerSecond = 0.0f;
+
+	/** Rate the managed streams are commanded to (packets/s) */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Telemetry Rate")
+	float ManagedPacketsPerSecond = 0.0f;
+
+	/** Packet budget after backing off for receive drops (packets/s) */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Telemetry Rate")
+	float EffectiveBudget = 0.0f;
+};
+
+/**
+ * LBEAST Telemetry Rate Subsystem
+ *
+ * Commands ECU telemetry intervals for every ULBEASTUDPTransport that declares
+ * TelemetryStreams. Streams run at their active interval while the transport's play
+ * session is active and drop to the idle interval otherwise. The sum across all ECUs is
+ * held under GlobalPacketBudget: idle streams are slowed first, then active streams.
+ * Traffic the controller doesn't manage is measured and subtracted from the budget,
+ * and receive drops in the I/O reactor shrink it until they stop.
+ *
+ * Command line:
+ *   -LBEASTPacketBudget=2000    Global receive budget (packets/s)
+ */
+UCLASS()
+class LBEASTCORE_API ULBEASTTelemetryRateSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	static ULBEASTTelemetryRateSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Called by ULBEASTUDPTransport on connect/disconnect */
+	void RegisterTransport(ULBEASTUDPTransport* Transport);
+	void UnregisterTransport(ULBEASTUDPTransport* Transport);
+
+	/** Re-plan on the next tick (play session changed, streams edited) */
+	void RequestReplan() { bReplanRequested = true; }
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|Telemetry Rate")
+	FLBEASTTelemetryRateStats GetTelemetryRateStats() const { return Stats; }
+
+	/** Total receive budget across all managed ECUs plus unmanaged traffic (packets/s) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Telemetry Rate", meta = (ClampMin = "1.0"))
+	float GlobalPacketBudget = 2000.0f;
+
+	/** Seconds between load measurements and re-plans */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Telemetry Rate")
+	float PlanIntervalSeconds = 1.0f;
+
+	/** Re-send unchanged intervals this often (UDP commands can be lost; ECUs reboot) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Telemetry Rate")
+	float RefreshIntervalSeconds = 10.0f;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Always; }
+	virtual bool IsTickableWhenPaused() const override { return true; }
+
+private:
+	struct FStreamState
+	{
+		/** Interval last sent to the ECU (0 = never) */
+		int32 CommandedIntervalMs = 0;
+
+		/** Interval the current plan wants */
+		int32 PlannedIntervalMs = 0;
+	};
+
+	struct FRegistration
+	{
+		TWeakObjectPtr<ULBEASTUDPTransport> Transport;
+		TArray<FStreamState> Streams;
+		double NextRefreshSeconds = 0.0;
+	};
+
+	void MeasureLoad(double NowSeconds);
+	void Plan();
+	void Apply(double NowSeconds);
+
+	TArray<FRegistration> Registrations;
+	FLBEASTTelemetryRateStats Stats;
+
+	double NextPlanSeconds = 0.0;
+	bool bReplanRequested = false;
+
+	// Load measurement
+	double LastMeasureSeconds = 0.0;
+	int64 LastReceived = -1;
+	int64 LastDropped = 0;
+	float BudgetScale = 1.0f;
+};
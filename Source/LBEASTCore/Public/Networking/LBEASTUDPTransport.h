@@ -5,6 +5,10 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Networking/UDPTransportBase.h"
+#include "Networking/LBEASTIOReactor.h"
+#include "Networking/LBEASTTelemetryRateController.h"
+#include "Networking/LBEASTSafetyLane.h"
+#include "Health/LBEASTDeviceHealth.h"
 #include "LBEASTUDPTransport.generated.h"
 
 /**
@@ -18,7 +22,9 @@ enum class ELBEASTUDPDataType : uint8
 	Float = 2 UMETA(DisplayName = "Float"),
 	String = 3 UMETA(DisplayName = "String"),
 	Bytes = 4 UMETA(DisplayName = "Raw Bytes"),
-	Struct = 5 UMETA(DisplayName = "Struct")
+	Struct = 5 UMETA(DisplayName = "Struct"),
+	Safety = 6 UMETA(DisplayName = "Safety (Acknowledged)"),
+	Batch = 7 UMETA(DisplayName = "Batch (Multiple Commands)")
 };
 
 /**
@@ -43,6 +49,9 @@ class LBEASTCORE_API ULBEASTUDPTransport : public UActorComponent
 {
 	GENERATED_BODY()
 
+	/** LBEASTBenchmarks times the plain CRC packet format directly */
+	friend struct FLBEASTBenchmarkAccess;
+
 public:
 	ULBEASTUDPTransport();
 	virtual ~ULBEASTUDPTransport();
@@ -69,6 +78,79 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "LBEAST|UDP")
 	bool IsUDPConnected() const { return UDPTransport.IsUDPConnected(); }
 
+	/**
+	 * Receive through the game instance's I/O reactor (ULBEASTIOReactorSubsystem) instead of polling
+	 * the socket from TickComponent. Takes effect on the next InitializeUDPConnection().
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|UDP")
+	bool bUseIOReactor = true;
+
+	/**
+	 * Health thresholds for this device in the device health service (ULBEASTDeviceHealthSubsystem).
+	 * Takes effect on the next InitializeUDPConnection().
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|UDP|Health")
+	FLBEASTDeviceHealthConfig HealthConfig;
+
+	/**
+	 * ECU telemetry streams whose update interval the server controls (ULBEASTTelemetryRateSubsystem).
+	 * Leave empty for ECUs with fixed rates. Takes effect on the next InitializeUDPConnection().
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|UDP|Telemetry Rate")
+	TArray<FLBEASTTelemetryStream> TelemetryStreams;
+
+	/**
+	 * Run TelemetryStreams at their active intervals (play session) or idle intervals (idle/attract)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|UDP|Telemetry Rate")
+	void SetTelemetrySessionActive(bool bActive);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|UDP|Telemetry Rate")
+	bool IsTelemetrySessionActive() const { return bTelemetrySessionActive; }
+
+	/** Packets received since the transport was created (before validation) */
+	int64 GetPacketsReceivedTotal() const { return PacketsReceivedTotal; }
+
+	/**
+	 * Send a telemetry interval command to the ECU
+	 * Default sends a plain int32 packet; override for secured devices.
+	 */
+	virtual void SendTelemetryInterval(int32 Channel, int32 IntervalMs);
+
+	// =====================================
+	// Safety Lane
+	// =====================================
+
+	/** Delivery settings for SendSafetyBool() */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|UDP|Safety")
+	FLBEASTSafetyLaneConfig SafetyLaneConfig;
+
+	/**
+	 * Send a safety-critical boolean (e.g. emergency stop) through FLBEASTSafetyLane
+	 * Goes on the wire immediately and redundantly, bypassing the I/O reactor and any batching,
+	 * and is retransmitted until the ECU acknowledges it.
+	 * @param Channel - Channel number (system-specific mapping, e.g. 7 = emergency stop)
+	 * @param Value - Boolean value to send
+	 * @return True if the first copy reached the socket
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|UDP|Safety")
+	bool SendSafetyBool(int32 Channel, bool Value);
+
+	/** True while a safety command on this channel is waiting for the ECU's ACK */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|UDP|Safety")
+	bool IsSafetyCommandPending(int32 Channel) const;
+
+	/** Safety lane delivery and latency statistics (all transports) */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|UDP|Safety")
+	static FLBEASTSafetyLaneStats GetSafetyLaneStats();
+
+	/**
+	 * Median round trip to this device (ms), measured from safety lane ACKs
+	 * @return 0 if not connected or nothing has been acknowledged yet
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|UDP|Health")
+	float GetRoundTripP50Ms() const;
+
 	// =====================================
 	// Channel-Based Send API (Primitive Types)
 	// =====================================
@@ -201,11 +283,17 @@ protected:
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	/**
-	 * Process incoming UDP data (called from TickComponent)
+	 * Process incoming UDP data (called from TickComponent when not using the I/O reactor)
 	 * Override this if you need custom processing before packet parsing
 	 */
 	virtual void ProcessIncomingUDPData();
 
+	/**
+	 * Handle one received packet (from the I/O reactor batch or the tick drain)
+	 * Default parses the LBEAST binary protocol. Override for secured/custom formats.
+	 */
+	virtual void HandleReceivedPacket(const TArray<uint8>& Data, int32 Length);
+
 protected:
 	/** Base UDP transport (handles raw socket management) */
 	FUDPTransportBase UDPTransport;
@@ -219,6 +307,21 @@ protected:
 	/** Protocol start marker (LBEAST binary protocol) - accessible to subclasses */
 	static constexpr uint8 PACKET_START_MARKER = 0xAA;
 
+	/** Upper bound on packets drained per tick when polling without the I/O reactor */
+	static constexpr int32 MAX_PACKETS_PER_TICK = 64;
+
+	/** I/O reactor registration (-1 = polling from TickComponent) */
+	TWeakObjectPtr<ULBEASTIOReactorSubsystem> IOReactor;
+	int32 IOReactorHandle = -1;
+
+	/** Device health registration (-1 = not connected) */
+	int32 HealthHandle = -1;
+
+	/** Telemetry rate control registration (null = rates not managed) */
+	TWeakObjectPtr<ULBEASTTelemetryRateSubsystem> TelemetryRate;
+	bool bTelemetrySessionActive = false;
+	int64 PacketsReceivedTotal = 0;
+
 protected:
 	/**
 	 * Send data via UDP to remote device (uses base transport)
@@ -228,10 +331,27 @@ protected:
 
 	/**
 	 * Receive data via UDP from remote device (non-blocking, uses base transport)
-	 * Protected so subclasses can receive raw packets for custom parsing
+	 * Drains up to MAX_PACKETS_PER_TICK packets into HandleReceivedPacket()
 	 */
 	void ReceiveUDPData();
 
+	/** Register/unregister the socket with the I/O reactor */
+	void RegisterWithIOReactor();
+	void UnregisterFromIOReactor();
+
+	/** I/O reactor batch callback (game thread, once per frame) */
+	void HandleIOReactorDatagrams(const TArray<FLBEASTIODatagram>& Datagrams);
+
+	/** Session replay callback: a recorded datagram goes through the normal receive path */
+	void HandleCaptureReplay(uint32 Address, const TArray<uint8>& Data);
+
+	/**
+	 * Build a packet in the wire format the device expects
+	 * Default is the plain CRC format (BuildBinaryPacket); override for secured devices.
+	 * Returning an empty array means the format cannot carry this type.
+	 */
+	virtual TArray<uint8> BuildDevicePacket(ELBEASTUDPDataType DataType, int32 Channel, const TArray<uint8>& Payload);
+
 	/**
 	 * Build LBEAST binary packet: [0xAA][Type][Ch][Payload][CRC]
 	 */
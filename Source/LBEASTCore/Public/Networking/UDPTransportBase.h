@@ -84,12 +84,21 @@ public:
 	 */
 	FSocket* GetSocket() const { return UDPSocket; }
 
+	/**
+	 * Session capture source id for this socket (-1 when not connected)
+	 * Paths that read the socket directly (e.g. the I/O reactor) report to FLBEASTSessionCapture with it.
+	 */
+	int32 GetCaptureSource() const { return CaptureSource; }
+
 protected:
 	/** UDP Socket for communication */
 	FSocket* UDPSocket = nullptr;
 
 	/** Remote address for UDP communication */
 	TSharedPtr<FInternetAddr> RemoteAddress;
+
+	/** FLBEASTSessionCapture source id */
+	int32 CaptureSource = -1;
 };
 
 
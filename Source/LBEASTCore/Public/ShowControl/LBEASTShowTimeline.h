@@ -0,0 +1,429 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Containers/Queue.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "Health/LBEASTDeviceHealth.h"
+#include <atomic>
+#include "LBEASTShowTimeline.generated.h"
+
+class FRunnableThread;
+class FEvent;
+
+/**
+ * One timed command on a show track
+ *
+ * Fields are interpreted by the track the cue is addressed to, e.g. the lighting track
+ * reads TargetIndex as a VirtualFixtureID and Value as intensity, the audio track reads
+ * TargetIndex as a console channel and Value as fader level.
+ */
+USTRUCT(BlueprintType)
+struct LBEASTCORE_API FLBEASTShowCue
+{
+	GENERATED_BODY()
+
+	/** Show time the cue fires at (seconds from the start of the cue list) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Show Control", meta = (ClampMin = "0.0"))
+	double TimeSeconds = 0.0;
+
+	/** Track (registered subsystem) that executes the cue, e.g. "Lighting", "Audio", "Motion", "Props" */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Show Control")
+	FName Track;
+
+	/** Track-specific command, e.g. "Fade", "Fader", "Tilt", "Action" */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Show Control")
+	FName Command;
+
+	/** Numeric target (fixture ID, channel, prop index) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Show Control")
+	int32 TargetIndex = 0;
+
+	/** Named target (actuator ID, bus name) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Show Control")
+	FName TargetName;
+
+	/** Primary value (intensity, level, action value) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Show Control")
+	float Value = 0.0f;
+
+	/** Secondary values (color, tilt/offset) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Show Control")
+	FVector Vector = FVector::ZeroVector;
+
+	/** Fade/move time where the command has one */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Show Control", meta = (ClampMin = "0.0"))
+	float DurationSeconds = 0.0f;
+};
+
+/**
+ * Named list of cues (any order - sorted when loaded)
+ */
+USTRUCT(BlueprintType)
+struct LBEASTCORE_API FLBEASTCueList
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Show Control")
+	FName Name;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Show Control")
+	TArray<FLBEASTShowCue> Cues;
+};
+
+/**
+ * Show timeline statistics
+ */
+USTRUCT(BlueprintType)
+struct LBEASTCORE_API FLBEASTShowTimelineStats
+{
+	GENERATED_BODY()
+
+	/** Cues handed to their track (or to the rehearsal event) */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Show Control")
+	int32 CuesDispatched = 0;
+
+	/** Cues addressed to a track that is not registered */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Show Control")
+	int32 CuesUnrouted = 0;
+
+	/** Cue time to the start of ExecuteCue for scheduler-thread tracks (microseconds, rolling window) */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Show Control")
+	float ReleaseErrorP50Us = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Show Control")
+	float ReleaseErrorP99Us = 0.0f;
+
+	/**
+	 * Cue time to the start of ExecuteCue for game-thread tracks and rehearsal (milliseconds,
+	 * rolling window). Up to one frame plus the subsystem's place in the tick order.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "LBEAST|Show Control")
+	float GameThreadLatencyP95Ms = 0.0f;
+};
+
+/**
+ * A subsystem that executes show cues (lighting, audio console, motion platform, props)
+ */
+class LBEASTCORE_API ILBEASTShowTrack
+{
+public:
+	virtual ~ILBEASTShowTrack() = default;
+
+	/**
+	 * Execute a cue
+	 * @param LateSeconds - How long after its show time the cue is being executed; fades and moves
+	 *                      can shorten themselves by this much to land on time
+	 */
+	virtual void ExecuteCue(const FLBEASTShowCue& Cue, double LateSeconds) = 0;
+
+	/** The cue fires within the lookahead window (load media, pre-position, warm a connection) */
+	virtual void PrefetchCue(const FLBEASTShowCue& Cue) {}
+
+	/**
+	 * True if ExecuteCue/PrefetchCue may run on the scheduler thread (sub-millisecond lateness).
+	 * Otherwise cues go through the track's queue and run on the game thread when the show
+	 * control subsystem ticks, which adds up to a frame (~11 ms at 90 Hz, ~33 ms at 30 Hz);
+	 * FLBEASTShowTimelineStats::GameThreadLatencyP95Ms reports what a venue actually sees.
+	 */
+	virtual bool IsThreadSafe() const { return false; }
+};
+
+/**
+ * LBEAST Show Timeline (Non-UObject)
+ *
+ * Plays a compiled cue list against one clock. Load() sorts the cues into an immutable
+ * event array with each cue's track already resolved. A scheduler thread sleeps until just
+ * before the next event, spins the last two milliseconds, and releases each cue on time:
+ * - Thread-safe tracks execute on the scheduler thread
+ * - Other tracks get the cue through a lock-free single-producer queue, drained on the game
+ *   thread by DispatchGameThread() together with the cue's lateness (frame-granular)
+ * Cues within LookaheadSeconds are prefetched ahead of time through the same paths.
+ *
+ * The clock is platform time, so cue timing does not depend on the frame rate.
+ */
+class LBEASTCORE_API FLBEASTShowTimeline : public FRunnable
+{
+public:
+	FLBEASTShowTimeline();
+	virtual ~FLBEASTShowTimeline();
+
+	bool Start();
+	void Shutdown();
+
+	/**
+	 * Register a track under a name (game thread). The loaded program is re-resolved, so tracks
+	 * may register before or after Load().
+	 * @param Owner - Who may replace or unregister the track (nullptr = anyone without an owner)
+	 * @return False if the name is held by a different, still-alive owner (the track is not added)
+	 */
+	bool RegisterTrack(FName TrackName, TSharedRef<ILBEASTShowTrack, ESPMode::ThreadSafe> Track, const UObject* Owner = nullptr);
+
+	/**
+	 * Remove a track; cues already queued for it are discarded. Returns once the scheduler
+	 * thread is no longer inside the track's ExecuteCue (game thread).
+	 * @return False if the name is not registered or belongs to a different owner
+	 */
+	bool UnregisterTrack(FName TrackName, const UObject* Owner = nullptr);
+
+	/** BaseName if it is free (or already Owner's), otherwise the first free BaseName_1, BaseName_2, ... */
+	FName MakeUniqueTrackName(FName BaseName, const UObject* Owner) const;
+
+	/** Compile a cue list and make it the current program (stops playback) */
+	void Load(const FLBEASTCueList& CueList);
+
+	/** Start playing from a show time */
+	void Play(double FromSeconds);
+
+	/** Continue from where Pause() stopped */
+	void Resume();
+
+	void Pause();
+	void StopPlayback();
+
+	/** Jump to a show time; cues before it are skipped, not replayed */
+	void Seek(double ShowSeconds);
+
+	double GetShowTime() const;
+	bool IsPlaying() const;
+
+	/** True once every cue of the current program has been released */
+	bool IsFinished() const;
+
+	double GetDuration() const;
+
+	/** When set, cues are not sent to tracks; they are reported through OnRehearsedCue instead */
+	void SetRehearsal(bool bInRehearsal) { bRehearsal = bInRehearsal; }
+	bool IsRehearsal() const { return bRehearsal; }
+
+	void SetLookahead(double InLookaheadSeconds) { LookaheadSeconds.store(FMath::Max(0.0, InLookaheadSeconds)); }
+
+	/** Run game-thread cues released since the last call (game thread, once per frame) */
+	void DispatchGameThread();
+
+	/**
+	 * Execute the cues in [FromSeconds, ToSeconds) of the loaded program immediately, in show
+	 * order, without the scheduler (game thread). Offline replay for simulators and tests.
+	 * @return Number of cues executed
+	 */
+	int32 ReplayRange(double FromSeconds, double ToSeconds);
+
+	/** Sorted copy of the loaded program's cues (what Play() would fire, in order) */
+	TArray<FLBEASTShowCue> GetCompiledCues() const;
+
+	FLBEASTShowTimelineStats GetStats() const;
+
+	/** Native: cue released while rehearsing (game thread) */
+	TFunction<void(const FLBEASTShowCue&, double /*LateSeconds*/)> OnRehearsedCue;
+
+	// FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	/** Copy of the cue, so a Load() before the game thread drains cannot invalidate it */
+	struct FReleasedCue
+	{
+		FLBEASTShowCue Cue;
+		/** Prefetch notice instead of execution */
+		bool bPrefetch = false;
+	};
+
+	struct FTrackEntry
+	{
+		FName Name;
+		TSharedPtr<ILBEASTShowTrack, ESPMode::ThreadSafe> Track;
+		/** Null for tracks registered without an owner */
+		TWeakObjectPtr<const UObject> Owner;
+		bool bThreadSafe = false;
+		/** Cleared on unregister; the scheduler skips the entry from then on */
+		FThreadSafeBool bActive;
+		/** Held by the scheduler thread around ExecuteCue/PrefetchCue of thread-safe tracks */
+		FCriticalSection ExecuteLock;
+		/** Scheduler thread -> game thread */
+		TQueue<FReleasedCue, EQueueMode::Spsc> Released;
+	};
+
+	struct FCompiledEvent
+	{
+		FLBEASTShowCue Cue;
+		/** Resolved at compile time (nullptr = track not registered when loaded) */
+		TSharedPtr<FTrackEntry, ESPMode::ThreadSafe> Entry;
+	};
+
+	/** Immutable once built; swapped whole by Load() and track (un)registration */
+	struct FProgram
+	{
+		/** Sorted by time; equal times keep cue list order */
+		TArray<FCompiledEvent> Events;
+		double Duration = 0.0;
+	};
+
+	using FProgramPtr = TSharedPtr<const FProgram, ESPMode::ThreadSafe>;
+
+	/** Build a program from LoadedCues and the current tracks. Caller holds StateLock. */
+	void CompileLocked();
+
+	/** Clock reading for the current transport state. Caller holds StateLock. */
+	double ShowTimeLocked(double NowPlatformSeconds) const;
+
+	/** True if Owner may replace or remove Entry. Caller holds StateLock. */
+	static bool CanReplaceLocked(const FTrackEntry& Entry, const UObject* Owner);
+
+	/**
+	 * Hand one event to its track (scheduler thread)
+	 * @param NowPlatformSeconds - Platform time NowShowSeconds was read at, so lateness can be
+	 *                             measured when the track actually runs
+	 */
+	void Release(const FCompiledEvent& Event, bool bPrefetch, double NowShowSeconds, double NowPlatformSeconds);
+
+	void WakeScheduler();
+
+	/** Guards the program pointer, transport state, the track map and LoadedCues */
+	mutable FCriticalSection StateLock;
+	FProgramPtr Program;
+	TMap<FName, TSharedPtr<FTrackEntry, ESPMode::ThreadSafe>> Tracks;
+	TArray<FLBEASTShowCue> LoadedCues;
+
+	/** Queue for cues released while rehearsing */
+	TSharedPtr<FTrackEntry, ESPMode::ThreadSafe> RehearsalEntry;
+
+	/** Game thread scratch for DispatchGameThread() */
+	TArray<TSharedPtr<FTrackEntry, ESPMode::ThreadSafe>> DispatchEntries;
+
+	bool bPlaying = false;
+	/** Show time at PlayPlatformSeconds (or the paused show time) */
+	double ShowSecondsAtPlay = 0.0;
+	double PlayPlatformSeconds = 0.0;
+	/** Bumped by Load/Play/Seek/Stop so the scheduler re-seeks its cursors */
+	uint32 TransportSerial = 0;
+
+	/** Scheduler thread cursors */
+	int32 NextEventIndex = 0;
+	int32 NextPrefetchIndex = 0;
+	std::atomic<bool> bFinished{false};
+
+	std::atomic<double> LookaheadSeconds{0.25};
+	std::atomic<bool> bRehearsal{false};
+
+	FRunnableThread* Thread = nullptr;
+	FEvent* WakeEvent = nullptr;
+	FThreadSafeBool bStopRequested;
+
+	/** Stats (guarded by StatsLock) */
+	mutable FCriticalSection StatsLock;
+	int32 CuesDispatched = 0;
+	int32 CuesUnrouted = 0;
+	FLBEASTRollingPercentile ReleaseErrorUs;
+	FLBEASTRollingPercentile GameThreadLatencyMs;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLBEASTShowCueRehearsed, const FLBEASTShowCue&, Cue, float, LateSeconds);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnLBEASTShowFinished);
+
+/**
+ * LBEAST Show Control Subsystem
+ *
+ * Owns the game instance's show timeline. Controllers register themselves as tracks
+ * (UProLightingController as "Lighting", UProAudioController as "Audio",
+ * UHapticPlatformController as "Motion", AEscapeRoomExperience as "Props" by default; a second
+ * instance with the same name registers as "Lighting_1" and so on), then an experience loads a
+ * cue list and plays it:
+ *
+ *   ULBEASTShowControlSubsystem* Show = ULBEASTShowControlSubsystem::Get(this);
+ *   Show->LoadCueList(OpeningCues);
+ *   Show->PlayShow(0.0f);
+ *
+ * With bRehearsal set, cues are reported through OnCueRehearsed and no hardware moves.
+ */
+UCLASS()
+class LBEASTCORE_API ULBEASTShowControlSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	static ULBEASTShowControlSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** @see FLBEASTShowTimeline::RegisterTrack */
+	bool RegisterTrack(FName TrackName, TSharedRef<ILBEASTShowTrack, ESPMode::ThreadSafe> Track, const UObject* Owner = nullptr);
+
+	/**
+	 * Register a track backed by a function and owned by Owner; cues are dropped once Owner is
+	 * destroyed. If another owner already holds TrackName the track is registered as
+	 * TrackName_1, TrackName_2, ... (logged) so several controllers with the default name can
+	 * coexist; cue lists address the extra instances by those names.
+	 * @param bRunOnSchedulerThread - Handler is thread-safe and runs on the scheduler thread
+	 *                                (sub-millisecond lateness) instead of the next game tick
+	 * @return Name the track was registered under (NAME_None if the subsystem has no timeline)
+	 */
+	FName RegisterTrack(FName TrackName, const UObject* Owner, TFunction<void(const FLBEASTShowCue&, double)> Handler, bool bRunOnSchedulerThread = false);
+
+	/** @see FLBEASTShowTimeline::UnregisterTrack */
+	bool UnregisterTrack(FName TrackName, const UObject* Owner = nullptr);
+
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|Show Control")
+	void LoadCueList(const FLBEASTCueList& CueList);
+
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|Show Control")
+	void PlayShow(double FromSeconds = 0.0);
+
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|Show Control")
+	void PauseShow();
+
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|Show Control")
+	void ResumeShow();
+
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|Show Control")
+	void StopShow();
+
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|Show Control")
+	void SeekShow(double ShowSeconds);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|Show Control")
+	double GetShowTime() const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|Show Control")
+	bool IsShowPlaying() const;
+
+	/** @see FLBEASTShowTimeline::ReplayRange */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|Show Control")
+	int32 ReplayRange(double FromSeconds, double ToSeconds);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|Show Control")
+	FLBEASTShowTimelineStats GetShowStats() const;
+
+	/** Report cues through OnCueRehearsed instead of sending them to tracks */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|Show Control")
+	void SetRehearsal(bool bInRehearsal);
+
+	/** How far ahead tracks are asked to prefetch upcoming cues */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Show Control", meta = (ClampMin = "0.0"))
+	float LookaheadSeconds = 0.25f;
+
+	UPROPERTY(BlueprintAssignable, Category = "LBEAST|Show Control")
+	FOnLBEASTShowCueRehearsed OnCueRehearsed;
+
+	/** Every cue of the loaded list has fired */
+	UPROPERTY(BlueprintAssignable, Category = "LBEAST|Show Control")
+	FOnLBEASTShowFinished OnShowFinished;
+
+	FLBEASTShowTimeline* GetTimeline() const { return Timeline.Get(); }
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return Timeline.IsValid(); }
+	virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Conditional; }
+	virtual bool IsTickableWhenPaused() const override { return true; }
+
+private:
+	TUniquePtr<FLBEASTShowTimeline> Timeline;
+	bool bFinishReported = true;
+};
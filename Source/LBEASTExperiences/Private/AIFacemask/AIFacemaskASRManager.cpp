@@ -2,6 +2,9 @@
 
 #include "AIFacemask/AIFacemaskASRManager.h"
 #include "AIFacemask/AIFacemaskImprovManager.h"
+#include "LBEASTExperiences.h"
+
+DECLARE_CYCLE_STAT(TEXT("AIFacemaskASRManager Tick"), STAT_AIFacemaskASRManager_Tick, STATGROUP_LBEASTExperiences);
 
 UAIFacemaskASRManager::UAIFacemaskASRManager()
 {
@@ -32,6 +35,7 @@ void UAIFacemaskASRManager::BeginPlay()
 void UAIFacemaskASRManager::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	LBEASTEXPERIENCES_SCOPE_CYCLE_COUNTER(STAT_AIFacemaskASRManager_Tick);
 	// Base class handles all timing logic (voice activity detection, etc.)
 	// No facemask-specific timing needed
 }
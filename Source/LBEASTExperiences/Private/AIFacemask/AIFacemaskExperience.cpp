@@ -9,6 +9,9 @@
 #include "AIFacemask/AIFacemaskASRManager.h"
 #include "ExperienceLoop/ExperienceStateMachine.h"
 #include "Networking/LBEASTServerBeacon.h"
+#include "LBEASTExperiences.h"
+
+DECLARE_CYCLE_STAT(TEXT("AIFacemaskExperience Tick"), STAT_AIFacemaskExperience_Tick, STATGROUP_LBEASTExperiences);
 
 AAIFacemaskExperience::AAIFacemaskExperience()
 {
@@ -31,6 +34,9 @@ AAIFacemaskExperience::AAIFacemaskExperience()
 	// This provides the narrative state progression that triggers automated AI facemask performances
 	bUseNarrativeStateMachine = true;
 
+	// First guest interaction is the AI character talking - don't admit guests to cold models
+	bRequireAIReady = true;
+
 	// Configure for multiplayer with dedicated server (REQUIRED for AI processing offload)
 	bMultiplayerEnabled = true;
 	ServerMode = ELBEASTServerMode::DedicatedServer;
@@ -99,7 +105,6 @@ bool AAIFacemaskExperience::InitializeExperienceImpl()
 		DefaultStates.Add(FExperienceState(FName("Credits"), TEXT("End credits")));
 
 		NarrativeStateMachine->Initialize(DefaultStates);
-		NarrativeStateMachine->StartExperience();
 		
 		UE_LOG(LogTemp, Log, TEXT("AIFacemaskExperience: Narrative state machine initialized with %d states"), DefaultStates.Num());
 	}
@@ -113,6 +118,10 @@ bool AAIFacemaskExperience::InitializeExperienceImpl()
 		if (ScriptManager->InitializeScriptManager(AIServerBaseURL))
 		{
 			UE_LOG(LogTemp, Log, TEXT("AIFacemaskExperience: Script Manager initialized"));
+
+			// State changes come from the live actor's wireless trigger buttons; each one triggers the
+			// state's pre-baked performance and tells the improv manager to buffer a transition
+			ScriptManager->BindToStateMachine(NarrativeStateMachine);
 		}
 		else
 		{
@@ -126,6 +135,9 @@ bool AAIFacemaskExperience::InitializeExperienceImpl()
 		if (ImprovManager->InitializeImprovManager())
 		{
 			UE_LOG(LogTemp, Log, TEXT("AIFacemaskExperience: Improv Manager initialized (local LLM + TTS + Audio2Face)"));
+
+			// Keep transitions to the neighbouring states generated before the actor presses the button
+			ImprovManager->SetNarrativeStateMachine(NarrativeStateMachine);
 		}
 		else
 		{
@@ -176,6 +188,13 @@ bool AAIFacemaskExperience::InitializeExperienceImpl()
 		}
 	}
 
+	// Start the narrative only after the script/improv managers and the HUD are bound, so the entry
+	// into the first state (Intro) triggers its script like every later state does
+	if (NarrativeStateMachine && bUseNarrativeStateMachine)
+	{
+		NarrativeStateMachine->StartExperience();
+	}
+
 	// Initialize Server Beacon for automatic discovery/connection
 	if (ServerBeacon)
 	{
@@ -251,6 +270,7 @@ void AAIFacemaskExperience::ShutdownExperienceImpl()
 void AAIFacemaskExperience::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
+	LBEASTEXPERIENCES_SCOPE_CYCLE_COUNTER(STAT_AIFacemaskExperience_Tick);
 
 	// Tick server beacon for broadcasts/discovery
 	if (ServerBeacon && ServerBeacon->IsActive())
@@ -306,31 +326,20 @@ void AAIFacemaskExperience::ProcessEmbeddedSystemInput()
 		RetreatExperienceInternal();
 	}
 
-	// Store current states for next frame (edge detection)
-	for (int32 i = 0; i < 4; i++)
+	// Held state for HUD feedback - only reported when it changes
+	const bool bForwardHeld = CurrentButtonStates[0] || CurrentButtonStates[2];
+	const bool bBackwardHeld = CurrentButtonStates[1] || CurrentButtonStates[3];
+	if (bForwardHeld != (PreviousEmbeddedButtonStates[0] || PreviousEmbeddedButtonStates[2]) ||
+	    bBackwardHeld != (PreviousEmbeddedButtonStates[1] || PreviousEmbeddedButtonStates[3]))
 	{
-		PreviousEmbeddedButtonStates[i] = CurrentButtonStates[i];
+		OnWristButtonsChanged.Broadcast(bForwardHeld, bBackwardHeld);
 	}
-}
 
-void AAIFacemaskExperience::OnNarrativeStateChanged(FName OldState, FName NewState, int32 NewStateIndex)
-{
-	// Note: OnNarrativeStateChanged is a BlueprintImplementableEvent in the base class,
-	// so we can't call Super::. This C++ implementation handles AI facemask-specific logic.
-	// Blueprint can still override this if needed.
-	
-	UE_LOG(LogTemp, Log, TEXT("AIFacemaskExperience: Narrative state changed from '%s' to '%s' (Index: %d)"), 
-		*OldState.ToString(), *NewState.ToString(), NewStateIndex);
-	
-	// State changes are triggered by live actor's wireless trigger buttons
-	// Each state change triggers automated AI facemask performances via NVIDIA ACE
-	// Trigger script for the new state (if script manager is available and auto-trigger is enabled)
-	if (ScriptManager && ScriptManager->bAutoTriggerOnStateChange)
+	// Store current states for next frame (edge detection)
+	for (int32 i = 0; i < 4; i++)
 	{
-		ScriptManager->HandleNarrativeStateChanged(OldState, NewState, NewStateIndex);
+		PreviousEmbeddedButtonStates[i] = CurrentButtonStates[i];
 	}
-	
-	// Override this function in Blueprint to trigger additional game events based on state changes
 }
 
 void AAIFacemaskExperience::RequestAdvanceExperience()
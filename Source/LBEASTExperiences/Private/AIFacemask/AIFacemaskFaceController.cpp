@@ -14,6 +14,11 @@
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Misc/Base64.h"
 #include "Serialization/BulkData.h"
+#include "LBEASTExperiences.h"
+
+DECLARE_CYCLE_STAT(TEXT("AIFacemaskFaceController Tick"), STAT_AIFacemaskFaceController_Tick, STATGROUP_LBEASTExperiences);
+DECLARE_CYCLE_STAT(TEXT("Apply Blend Shapes"), STAT_AIFacemask_ApplyBlendShapes, STATGROUP_LBEASTExperiences);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Blend Shape Weights Applied"), STAT_AIFacemask_BlendShapeWeights, STATGROUP_LBEASTExperiences);
 
 UAIFacemaskFaceController::UAIFacemaskFaceController()
 {
@@ -55,6 +60,7 @@ void UAIFacemaskFaceController::EndPlay(const EEndPlayReason::Type EndPlayReason
 void UAIFacemaskFaceController::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	LBEASTEXPERIENCES_SCOPE_CYCLE_COUNTER(STAT_AIFacemaskFaceController_Tick);
 
 	// WebSocket handles incoming messages asynchronously via callbacks
 	// No polling needed here - messages are processed in OnWebSocketMessageReceived()
@@ -112,6 +118,9 @@ void UAIFacemaskFaceController::ReceiveFacialAnimationData(const FFacialAnimatio
 
 void UAIFacemaskFaceController::ApplyBlendShapesToMesh(const TMap<FName, float>& BlendShapeWeights)
 {
+	LBEASTEXPERIENCES_SCOPE_CYCLE_COUNTER(STAT_AIFacemask_ApplyBlendShapes);
+	LBEASTEXPERIENCES_INC_COUNTER(STAT_AIFacemask_BlendShapeWeights, BlendShapeWeights.Num());
+
 	if (!Config.TargetMesh)
 	{
 		return;
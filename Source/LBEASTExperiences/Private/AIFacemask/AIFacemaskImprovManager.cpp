@@ -12,6 +12,9 @@
 #include "Misc/Paths.h"
 #include "HAL/PlatformFilemanager.h"
 #include "Misc/Base64.h"
+#include "LBEASTExperiences.h"
+
+DECLARE_CYCLE_STAT(TEXT("AIFacemaskImprovManager Tick"), STAT_AIFacemaskImprovManager_Tick, STATGROUP_LBEASTExperiences);
 
 UAIFacemaskImprovManager::UAIFacemaskImprovManager()
 {
@@ -49,6 +52,7 @@ void UAIFacemaskImprovManager::BeginPlay()
 void UAIFacemaskImprovManager::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	LBEASTEXPERIENCES_SCOPE_CYCLE_COUNTER(STAT_AIFacemaskImprovManager_Tick);
 	// Base class handles async operation tracking
 	// No facemask-specific timing needed
 }
@@ -73,6 +77,7 @@ void UAIFacemaskImprovManager::GenerateAndPlayImprovResponse(const FString& Inpu
 {
 	// Call base class which handles the async pipeline
 	Super::GenerateAndPlayImprovResponse(Input, bAsync);
+	OnResponseStateChanged.Broadcast();
 	
 	// Facemask-specific logic can be added here if needed
 	// The base class will call RequestLLMResponseAsync, which we override below
@@ -81,6 +86,7 @@ void UAIFacemaskImprovManager::GenerateAndPlayImprovResponse(const FString& Inpu
 void UAIFacemaskImprovManager::StopCurrentResponse()
 {
 	Super::StopCurrentResponse();
+	OnResponseStateChanged.Broadcast();
 	
 	// Stop face controller streaming if needed
 	if (FaceController && FaceController->IsConnected())
@@ -100,6 +106,7 @@ void UAIFacemaskImprovManager::RequestLLMResponseAsync(const FString& Input, con
 	{
 		UE_LOG(LogTemp, Error, TEXT("UAIFacemaskImprovManager: Cannot request LLM - provider manager not available"));
 		bIsGeneratingResponse = false;
+		OnResponseStateChanged.Broadcast();
 		return;
 	}
 
@@ -116,10 +123,11 @@ void UAIFacemaskImprovManager::RequestLLMResponseAsync(const FString& Input, con
 
 	UE_LOG(LogTemp, Log, TEXT("UAIFacemaskImprovManager: Requesting LLM response via provider manager (model: %s)"), *LLMRequest.ModelName);
 
-	// Request response via provider manager (handles Ollama, OpenAI-compatible, etc.)
-	LLMProviderManager->RequestResponse(LLMRequest, [this, Input](const FLLMResponse& Response)
+	// Live reply: served ahead of transition/pre-bake work from every station sharing the LLM
+	LiveLLMRequestId = SubmitLLMRequest(LLMRequest, ELLMRequestPriority::LiveReply, [this, Input](const FLLMResponse& Response)
 	{
 		bIsLLMRequestPending = false;
+		LiveLLMRequestId = 0;
 
 		if (Response.ErrorMessage.IsEmpty() && !Response.ResponseText.IsEmpty())
 		{
@@ -134,6 +142,7 @@ void UAIFacemaskImprovManager::RequestLLMResponseAsync(const FString& Input, con
 			{
 				ConversationHistory.RemoveAt(0, ConversationHistory.Num() - MaxConversationHistory * 2);
 			}
+			NotifyConversationChanged();
 
 			// Broadcast response generated event
 			OnImprovResponseGenerated.Broadcast(Input, Response.ResponseText);
@@ -143,6 +152,7 @@ void UAIFacemaskImprovManager::RequestLLMResponseAsync(const FString& Input, con
 
 			// Mark response as queued (will be marked as spoken when face animation starts)
 			CurrentAIResponseState = EImprovResponseState::Queued;
+			OnResponseStateChanged.Broadcast();
 
 			// Trigger TTS pipeline (which will trigger Audio2Face automatically)
 			if (ImprovConfig.bUseLocalTTS)
@@ -159,6 +169,7 @@ void UAIFacemaskImprovManager::RequestLLMResponseAsync(const FString& Input, con
 		{
 			UE_LOG(LogTemp, Error, TEXT("UAIFacemaskImprovManager: LLM request failed: %s"), *Response.ErrorMessage);
 			bIsGeneratingResponse = false;
+			OnResponseStateChanged.Broadcast();
 		}
 	});
 }
@@ -369,6 +380,7 @@ void UAIFacemaskImprovManager::OnAudio2FaceConversionComplete(bool bSuccess)
 	}
 	
 	bIsGeneratingResponse = false;
+	OnResponseStateChanged.Broadcast();
 }
 
 FString UAIFacemaskImprovManager::GetVoiceNameString(ELBEASTACEVoiceType VoiceType) const
@@ -388,36 +400,48 @@ FString UAIFacemaskImprovManager::GetVoiceNameString(ELBEASTACEVoiceType VoiceTy
 	}
 }
 
+FString UAIFacemaskImprovManager::GetTransitionContextForState(FName TargetState) const
+{
+	// The transition leads into the state's scripted opening line
+	if (ScriptManager)
+	{
+		const FAIFacemaskScript Script = ScriptManager->GetScriptForState(TargetState);
+		if (Script.ScriptLines.Num() > 0)
+		{
+			return Script.ScriptLines[0].TextPrompt;
+		}
+	}
+	return Super::GetTransitionContextForState(TargetState);
+}
+
 void UAIFacemaskImprovManager::MarkCurrentResponseAsSpoken()
 {
 	if (CurrentAIResponseState == EImprovResponseState::Queued)
 	{
 		CurrentAIResponseState = EImprovResponseState::Spoken;
+		OnResponseStateChanged.Broadcast();
 		UE_LOG(LogTemp, Log, TEXT("UAIFacemaskImprovManager: Marked current response as spoken (face animation started)"));
 	}
 }
 
 void UAIFacemaskImprovManager::NotifyNarrativeStateChanged(FName OldState, FName NewState, int32 NewStateIndex)
 {
-	if (!ScriptManager)
+	// Only scenario A below acts on a transition, and only while improv is active
+	if (!ScriptManager || !bIsGeneratingResponse)
 	{
 		return;
 	}
 
-	// Phase 11: Check if current state's sentence has been spoken
-	FAIFacemaskScript NewStateScript = ScriptManager->GetScriptForState(NewState);
-	bool bCurrentStateSpoken = false;
-	if (NewStateScript.ScriptLines.Num() > 0)
-	{
-		bCurrentStateSpoken = NewStateScript.ScriptLines[0].bHasBeenSpoken;
-	}
+	// Phase 11: Check if current state's sentence has been spoken (read in place - no script copy per transition)
+	const FAIFacemaskScript* NewStateScript = ScriptManager->ScriptCollection.GetScriptForState(NewState);
+	const FAIFacemaskScriptLine* FirstLine = (NewStateScript && NewStateScript->ScriptLines.Num() > 0) ? &NewStateScript->ScriptLines[0] : nullptr;
+	const bool bCurrentStateSpoken = FirstLine && FirstLine->bHasBeenSpoken;
 
 	// Phase 11: Scenario A - Current state's sentence NOT spoken, improv active
 	// Action: LLM immediately starts calculating transition sentence
-	if (!bCurrentStateSpoken && bIsGeneratingResponse)
+	if (!bCurrentStateSpoken)
 	{
-		FString ContextText = NewStateScript.ScriptLines.Num() > 0 ? NewStateScript.ScriptLines[0].TextPrompt : TEXT("");
-		RequestTransitionSentence(OldState, NewState, ContextText);
+		RequestTransitionSentence(OldState, NewState, FirstLine ? FirstLine->TextPrompt : FString());
 	}
 
 	// Phase 11: Scenario B - Current state's sentence ALREADY spoken, improv begins
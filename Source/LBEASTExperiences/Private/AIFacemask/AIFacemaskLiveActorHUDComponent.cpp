@@ -5,6 +5,7 @@
 #include "AIFacemask/AIFacemaskScriptManager.h"
 #include "AIFacemask/AIFacemaskImprovManager.h"
 #include "AIFacemask/AIFacemaskExperience.h"
+#include "ExperienceLoop/ExperienceStateMachine.h"
 #include "Components/WidgetComponent.h"
 #include "Components/TextBlock.h"
 #include "Components/Image.h"
@@ -17,11 +18,26 @@
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
 #include "Styling/CoreStyle.h"
+#include "LBEASTExperiences.h"
+
+DECLARE_CYCLE_STAT(TEXT("AIFacemaskLiveActorHUDComponent Tick"), STAT_AIFacemaskLiveActorHUDComponent_Tick, STATGROUP_LBEASTExperiences);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Live Actor HUD Widget Updates"), STAT_AIFacemaskLiveActorHUD_WidgetUpdates, STATGROUP_LBEASTExperiences);
+
+namespace HUDDirty
+{
+	constexpr uint8 Narrative = 1 << 0;
+	constexpr uint8 Improv = 1 << 1;
+	constexpr uint8 Transition = 1 << 2;
+	constexpr uint8 Arrows = 1 << 3;
+	constexpr uint8 StateInfo = 1 << 4;
+	constexpr uint8 All = Narrative | Improv | Transition | Arrows | StateInfo;
+}
 
 UAIFacemaskLiveActorHUDComponent::UAIFacemaskLiveActorHUDComponent()
 {
+	// Ticks only while elements are dirty (see MarkDirty)
 	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.bStartWithTickEnabled = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 	
 	bIsInitialized = false;
 	bIsVisible = true;
@@ -61,6 +77,8 @@ void UAIFacemaskLiveActorHUDComponent::BeginPlay()
 
 void UAIFacemaskLiveActorHUDComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	UnbindEvents();
+
 	// Clean up widget component
 	if (WidgetComponent)
 	{
@@ -74,14 +92,15 @@ void UAIFacemaskLiveActorHUDComponent::EndPlay(const EEndPlayReason::Type EndPla
 void UAIFacemaskLiveActorHUDComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	LBEASTEXPERIENCES_SCOPE_CYCLE_COUNTER(STAT_AIFacemaskLiveActorHUDComponent_Tick);
 
-	if (!bIsInitialized || !bIsVisible)
+	if (bIsInitialized && bIsVisible)
 	{
-		return;
+		FlushDirty();
 	}
 
-	// Update HUD display every frame (or on-demand via events)
-	UpdateHUDDisplay();
+	// Nothing pending - sleep until the next event
+	SetComponentTickEnabled(false);
 }
 
 bool UAIFacemaskLiveActorHUDComponent::InitializeHUD(UAIFacemaskScriptManager* InScriptManager, UAIFacemaskImprovManager* InImprovManager)
@@ -107,6 +126,8 @@ bool UAIFacemaskLiveActorHUDComponent::InitializeHUD(UAIFacemaskScriptManager* I
 	if (WidgetComponent && HUDWidget)
 	{
 		bIsInitialized = true;
+		BindEvents();
+		MarkDirty(HUDDirty::All);
 		UE_LOG(LogTemp, Log, TEXT("UAIFacemaskLiveActorHUDComponent: Initialized successfully"));
 		return true;
 	}
@@ -119,33 +140,169 @@ bool UAIFacemaskLiveActorHUDComponent::InitializeHUD(UAIFacemaskScriptManager* I
 
 void UAIFacemaskLiveActorHUDComponent::UpdateHUDDisplay()
 {
-	if (!bIsInitialized || !HUDWidget)
+	DirtyMask |= HUDDirty::All;
+	FlushDirty();
+}
+
+void UAIFacemaskLiveActorHUDComponent::MarkDirty(uint8 Flags)
+{
+	DirtyMask |= Flags;
+	if (bIsInitialized && !IsComponentTickEnabled())
+	{
+		// Tick interval is the throttle: a burst of events costs one flush
+		PrimaryComponentTick.TickInterval = 1.0f / FMath::Max(MaxUpdateRateHz, 1.0f);
+		SetComponentTickEnabled(true);
+	}
+}
+
+void UAIFacemaskLiveActorHUDComponent::FlushDirty()
+{
+	if (!bIsInitialized || !HUDWidget || DirtyMask == 0)
 	{
 		return;
 	}
 
-	// Get current state from managers
-	FString NarrativeTargetSentence;
-	bool bNarrativeTargetSpoken = false;
-	FName CurrentStateName = NAME_None;
-	int32 CurrentStateIndex = -1;
-	
-	GetCurrentStateFromScriptManager(NarrativeTargetSentence, bNarrativeTargetSpoken, CurrentStateName, CurrentStateIndex);
-
-	FString ImprovResponse;
-	bool bImprovResponseSpoken = false;
-	FString BufferedTransition;
-	bool bTransitionSpoken = false;
-	GetCurrentStateFromImprovManager(ImprovResponse, bImprovResponseSpoken, BufferedTransition, bTransitionSpoken);
-
-	bool bForwardPressed = false;
-	bool bBackwardPressed = false;
-	GetButtonPressStates(bForwardPressed, bBackwardPressed);
-
-	// Update HUD display directly (all logic is in component now)
-	UpdateTextDisplay(ImprovResponse, bImprovResponseSpoken, NarrativeTargetSentence, bNarrativeTargetSpoken, BufferedTransition, bTransitionSpoken);
-	UpdateArrowButtons(bForwardPressed, bBackwardPressed);
-	UpdateStateInfo(CurrentStateName, CurrentStateIndex);
+	// Hidden HUD keeps its dirty flags until it is shown again
+	if (!bIsVisible)
+	{
+		return;
+	}
+
+	const uint8 Flags = DirtyMask;
+	DirtyMask = 0;
+
+	if (Flags & (HUDDirty::Narrative | HUDDirty::StateInfo))
+	{
+		FString NarrativeTargetSentence;
+		bool bNarrativeTargetSpoken = false;
+		FName CurrentStateName = NAME_None;
+		int32 CurrentStateIndex = -1;
+		GetCurrentStateFromScriptManager(NarrativeTargetSentence, bNarrativeTargetSpoken, CurrentStateName, CurrentStateIndex);
+
+		if (Flags & HUDDirty::Narrative)
+		{
+			UpdateTextLine(HUDWidget->NarrativeTargetTextBlock, NarrativeTargetSentence, bNarrativeTargetSpoken, NarrativeCache);
+		}
+		if (Flags & HUDDirty::StateInfo)
+		{
+			UpdateStateInfo(CurrentStateName, CurrentStateIndex);
+		}
+	}
+
+	if (Flags & (HUDDirty::Improv | HUDDirty::Transition))
+	{
+		FString ImprovResponse;
+		bool bImprovResponseSpoken = false;
+		FString BufferedTransition;
+		bool bTransitionSpoken = false;
+		GetCurrentStateFromImprovManager(ImprovResponse, bImprovResponseSpoken, BufferedTransition, bTransitionSpoken);
+
+		if (Flags & HUDDirty::Improv)
+		{
+			UpdateTextLine(HUDWidget->ImprovResponseTextBlock, ImprovResponse, bImprovResponseSpoken, ImprovCache);
+		}
+		if (Flags & HUDDirty::Transition)
+		{
+			UpdateTextLine(HUDWidget->TransitionTextBlock, BufferedTransition, bTransitionSpoken, TransitionCache);
+		}
+	}
+
+	if (Flags & HUDDirty::Arrows)
+	{
+		UpdateArrowButtons(bForwardButtonPressed, bBackwardButtonPressed);
+	}
+}
+
+// =====================================
+// Event Subscriptions
+// =====================================
+
+void UAIFacemaskLiveActorHUDComponent::BindEvents()
+{
+	if (ScriptManager)
+	{
+		ScriptManager->OnScriptStarted.AddUniqueDynamic(this, &UAIFacemaskLiveActorHUDComponent::HandleScriptStarted);
+		ScriptManager->OnScriptLineStarted.AddUniqueDynamic(this, &UAIFacemaskLiveActorHUDComponent::HandleScriptLineStarted);
+		ScriptManager->OnScriptFinished.AddUniqueDynamic(this, &UAIFacemaskLiveActorHUDComponent::HandleScriptFinished);
+	}
+
+	if (ImprovManager && !ImprovStateHandle.IsValid())
+	{
+		ImprovStateHandle = ImprovManager->OnResponseStateChanged.AddUObject(this, &UAIFacemaskLiveActorHUDComponent::HandleImprovResponseStateChanged);
+	}
+
+	if (AAIFacemaskExperience* Experience = Cast<AAIFacemaskExperience>(GetOwner()))
+	{
+		UExperienceStateMachine* StateMachine = Experience->GetNarrativeStateMachine();
+		if (StateMachine && !NarrativeStateHandle.IsValid())
+		{
+			NarrativeStateHandle = StateMachine->BindAnyStateEntered(FOnExperienceStateEntered::CreateUObject(this, &UAIFacemaskLiveActorHUDComponent::HandleNarrativeStateEntered));
+		}
+		if (!WristButtonsHandle.IsValid())
+		{
+			WristButtonsHandle = Experience->OnWristButtonsChanged.AddUObject(this, &UAIFacemaskLiveActorHUDComponent::HandleWristButtonsChanged);
+		}
+	}
+}
+
+void UAIFacemaskLiveActorHUDComponent::UnbindEvents()
+{
+	if (ScriptManager)
+	{
+		ScriptManager->OnScriptStarted.RemoveDynamic(this, &UAIFacemaskLiveActorHUDComponent::HandleScriptStarted);
+		ScriptManager->OnScriptLineStarted.RemoveDynamic(this, &UAIFacemaskLiveActorHUDComponent::HandleScriptLineStarted);
+		ScriptManager->OnScriptFinished.RemoveDynamic(this, &UAIFacemaskLiveActorHUDComponent::HandleScriptFinished);
+	}
+
+	if (ImprovManager)
+	{
+		ImprovManager->OnResponseStateChanged.Remove(ImprovStateHandle);
+	}
+	ImprovStateHandle.Reset();
+
+	if (AAIFacemaskExperience* Experience = Cast<AAIFacemaskExperience>(GetOwner()))
+	{
+		if (UExperienceStateMachine* StateMachine = Experience->GetNarrativeStateMachine())
+		{
+			StateMachine->UnbindStateHandler(NarrativeStateHandle);
+		}
+		Experience->OnWristButtonsChanged.Remove(WristButtonsHandle);
+	}
+	NarrativeStateHandle.Reset();
+	WristButtonsHandle.Reset();
+}
+
+void UAIFacemaskLiveActorHUDComponent::HandleScriptStarted(FName StateName, const FAIFacemaskScript& Script)
+{
+	MarkDirty(HUDDirty::Narrative);
+}
+
+void UAIFacemaskLiveActorHUDComponent::HandleScriptLineStarted(FName StateName, int32 LineIndex, const FAIFacemaskScriptLine& ScriptLine)
+{
+	// The previous line was just marked spoken, and the target sentence moved on
+	MarkDirty(HUDDirty::Narrative);
+}
+
+void UAIFacemaskLiveActorHUDComponent::HandleScriptFinished(FName StateName, const FAIFacemaskScript& Script)
+{
+	MarkDirty(HUDDirty::Narrative);
+}
+
+void UAIFacemaskLiveActorHUDComponent::HandleNarrativeStateEntered(int32 OldStateIndex, int32 NewStateIndex)
+{
+	MarkDirty(HUDDirty::StateInfo | HUDDirty::Narrative | HUDDirty::Transition);
+}
+
+void UAIFacemaskLiveActorHUDComponent::HandleImprovResponseStateChanged()
+{
+	MarkDirty(HUDDirty::Improv);
+}
+
+void UAIFacemaskLiveActorHUDComponent::HandleWristButtonsChanged(bool bForwardPressed, bool bBackwardPressed)
+{
+	bForwardButtonPressed = bForwardPressed;
+	bBackwardButtonPressed = bBackwardPressed;
+	MarkDirty(HUDDirty::Arrows);
 }
 
 void UAIFacemaskLiveActorHUDComponent::SetHUDVisible(bool bVisible)
@@ -156,6 +313,12 @@ void UAIFacemaskLiveActorHUDComponent::SetHUDVisible(bool bVisible)
 	{
 		WidgetComponent->SetVisibility(bVisible);
 	}
+
+	// Flushes whatever changed while hidden
+	if (bVisible && DirtyMask != 0)
+	{
+		MarkDirty(DirtyMask);
+	}
 }
 
 void UAIFacemaskLiveActorHUDComponent::CreateWidgetComponent()
@@ -281,8 +444,8 @@ void UAIFacemaskLiveActorHUDComponent::GetCurrentStateFromScriptManager(
 	if (AAIFacemaskExperience* Experience = Cast<AAIFacemaskExperience>(Owner))
 	{
 		OutStateName = Experience->GetCurrentExperienceState();
-		// TODO: Get state index from experience base
-		OutStateIndex = 0;  // Placeholder
+		const UExperienceStateMachine* StateMachine = Experience->GetNarrativeStateMachine();
+		OutStateIndex = StateMachine ? StateMachine->CurrentStateIndex : 0;
 	}
 
 	// Get current script and its target sentence
@@ -323,20 +486,6 @@ void UAIFacemaskLiveActorHUDComponent::GetCurrentStateFromImprovManager(
 	OutbTransitionSpoken = false;  // Placeholder - will be implemented in Phase 11
 }
 
-void UAIFacemaskLiveActorHUDComponent::GetButtonPressStates(
-	bool& OutbForwardPressed,
-	bool& OutbBackwardPressed) const
-{
-	// Get button states from embedded system or VR controllers
-	AActor* Owner = GetOwner();
-	if (AAIFacemaskExperience* Experience = Cast<AAIFacemaskExperience>(Owner))
-	{
-		// TODO: Query embedded system controller for button states
-		// For now, return false (no buttons pressed)
-		OutbForwardPressed = false;
-		OutbBackwardPressed = false;
-	}
-}
 
 void UAIFacemaskLiveActorHUDComponent::CreateWidgetElements()
 {
@@ -470,66 +619,41 @@ void UAIFacemaskLiveActorHUDComponent::CreateWidgetElements()
 	UE_LOG(LogTemp, Log, TEXT("UAIFacemaskLiveActorHUDComponent: Widget elements created successfully"));
 }
 
-void UAIFacemaskLiveActorHUDComponent::UpdateTextDisplay(
-	const FString& CurrentImprovResponse,
-	bool bImprovResponseSpoken,
-	const FString& CurrentNarrativeTargetSentence,
-	bool bNarrativeTargetSpoken,
-	const FString& BufferedTransitionText,
-	bool bTransitionSpoken)
+void UAIFacemaskLiveActorHUDComponent::UpdateTextLine(UTextBlock* TextBlock, const FString& Text, bool bSpoken, FHUDLineCache& Cache)
 {
-	if (!HUDWidget)
+	if (!HUDWidget || !TextBlock)
 	{
 		return;
 	}
 
-	// Update narrative target text (top priority - always shown if present)
-	if (HUDWidget->NarrativeTargetTextBlock)
+	// SetText invalidates layout and re-shapes the string - skip it when nothing changed
+	if (Cache.bValid && Cache.bSpoken == bSpoken && Cache.Text.Equals(Text, ESearchCase::CaseSensitive))
 	{
-		if (!CurrentNarrativeTargetSentence.IsEmpty())
-		{
-			HUDWidget->NarrativeTargetTextBlock->SetText(FText::FromString(CurrentNarrativeTargetSentence));
-			FLinearColor TextColor = bNarrativeTargetSpoken ? HUDWidget->SpokenTextColor : HUDWidget->QueuedTextColor;
-			HUDWidget->NarrativeTargetTextBlock->SetColorAndOpacity(TextColor);
-			HUDWidget->NarrativeTargetTextBlock->SetVisibility(ESlateVisibility::Visible);
-		}
-		else
-		{
-			HUDWidget->NarrativeTargetTextBlock->SetVisibility(ESlateVisibility::Collapsed);
-		}
+		return;
 	}
 
-	// Update improv response text (second priority)
-	if (HUDWidget->ImprovResponseTextBlock)
+	const bool bWasShown = Cache.bValid && !Cache.Text.IsEmpty();
+	if (!Text.IsEmpty())
 	{
-		if (!CurrentImprovResponse.IsEmpty())
+		if (!Cache.bValid || !Cache.Text.Equals(Text, ESearchCase::CaseSensitive))
 		{
-			HUDWidget->ImprovResponseTextBlock->SetText(FText::FromString(CurrentImprovResponse));
-			FLinearColor TextColor = bImprovResponseSpoken ? HUDWidget->SpokenTextColor : HUDWidget->QueuedTextColor;
-			HUDWidget->ImprovResponseTextBlock->SetColorAndOpacity(TextColor);
-			HUDWidget->ImprovResponseTextBlock->SetVisibility(ESlateVisibility::Visible);
+			TextBlock->SetText(FText::FromString(Text));
 		}
-		else
+		TextBlock->SetColorAndOpacity(bSpoken ? HUDWidget->SpokenTextColor : HUDWidget->QueuedTextColor);
+		if (!bWasShown)
 		{
-			HUDWidget->ImprovResponseTextBlock->SetVisibility(ESlateVisibility::Collapsed);
+			TextBlock->SetVisibility(ESlateVisibility::Visible);
 		}
 	}
-
-	// Update transition text (third priority)
-	if (HUDWidget->TransitionTextBlock)
+	else if (bWasShown || !Cache.bValid)
 	{
-		if (!BufferedTransitionText.IsEmpty())
-		{
-			HUDWidget->TransitionTextBlock->SetText(FText::FromString(BufferedTransitionText));
-			FLinearColor TextColor = bTransitionSpoken ? HUDWidget->SpokenTextColor : HUDWidget->QueuedTextColor;
-			HUDWidget->TransitionTextBlock->SetColorAndOpacity(TextColor);
-			HUDWidget->TransitionTextBlock->SetVisibility(ESlateVisibility::Visible);
-		}
-		else
-		{
-			HUDWidget->TransitionTextBlock->SetVisibility(ESlateVisibility::Collapsed);
-		}
+		TextBlock->SetVisibility(ESlateVisibility::Collapsed);
 	}
+
+	Cache.Text = Text;
+	Cache.bSpoken = bSpoken;
+	Cache.bValid = true;
+	LBEASTEXPERIENCES_INC_COUNTER(STAT_AIFacemaskLiveActorHUD_WidgetUpdates, 1);
 }
 
 void UAIFacemaskLiveActorHUDComponent::UpdateArrowButtons(bool bForwardPressed, bool bBackwardPressed)
@@ -539,6 +663,15 @@ void UAIFacemaskLiveActorHUDComponent::UpdateArrowButtons(bool bForwardPressed,
 		return;
 	}
 
+	if (bArrowsValid && bShownForwardPressed == bForwardPressed && bShownBackwardPressed == bBackwardPressed)
+	{
+		return;
+	}
+	bArrowsValid = true;
+	bShownForwardPressed = bForwardPressed;
+	bShownBackwardPressed = bBackwardPressed;
+	LBEASTEXPERIENCES_INC_COUNTER(STAT_AIFacemaskLiveActorHUD_WidgetUpdates, 1);
+
 	// Update forward arrow visual feedback
 	if (HUDWidget->ForwardArrowImage)
 	{
@@ -561,6 +694,14 @@ void UAIFacemaskLiveActorHUDComponent::UpdateStateInfo(FName CurrentStateName, i
 		return;
 	}
 
+	if (ShownStateName == CurrentStateName && ShownStateIndex == CurrentStateIndex)
+	{
+		return;
+	}
+	ShownStateName = CurrentStateName;
+	ShownStateIndex = CurrentStateIndex;
+	LBEASTEXPERIENCES_INC_COUNTER(STAT_AIFacemaskLiveActorHUD_WidgetUpdates, 1);
+
 	// Format state info string
 	FString StateInfoString = FString::Printf(TEXT("State: %s (%d)"), *CurrentStateName.ToString(), CurrentStateIndex);
 	HUDWidget->StateInfoTextBlock->SetText(FText::FromString(StateInfoString));
@@ -3,18 +3,169 @@
 #include "AIFacemask/AIFacemaskScriptManager.h"
 #include "AIFacemask/AIFacemaskFaceController.h"
 #include "AIFacemask/AIFacemaskImprovManager.h"
+#include "ExperienceLoop/ExperienceStateMachine.h"
 #include "LBEASTAI/Public/AIHTTPClient.h"
 #include "Json.h"
 #include "JsonUtilities.h"
+#include "AudioDevice.h"
+#include "ISubmixBufferListener.h"
+#include "Containers/Queue.h"
+#include "LBEASTExperiences.h"
+#include <atomic>
+
+DECLARE_CYCLE_STAT(TEXT("AIFacemaskScriptManager Tick"), STAT_AIFacemaskScriptManager_Tick, STATGROUP_LBEASTExperiences);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Script Line Boundaries"), STAT_AIFacemaskScriptManager_LineBoundaries, STATGROUP_LBEASTExperiences);
+
+// =====================================
+// Script Clock
+// =====================================
+
+/**
+ * Line boundary scheduler driven by the audio render clock.
+ *
+ * The game thread schedules absolute boundary times. The audio render thread checks them once
+ * per main-submix buffer and queues every boundary that falls inside the buffer, stamped with its
+ * scheduled clock time, for the game thread to consume. Scheduled times never depend on when a
+ * tick happened to run, so errors do not accumulate from line to line.
+ *
+ * Without an audio device the game thread polls the same logic against platform time.
+ */
+class FAIFacemaskScriptClock : public ISubmixBufferListener
+{
+public:
+	struct FBoundary
+	{
+		uint32 Generation = 0;
+		/** Line that ends at this boundary (INDEX_NONE = end of the script start delay) */
+		int32 LineIndex = INDEX_NONE;
+		double ClockSeconds = 0.0;
+	};
+
+	explicit FAIFacemaskScriptClock(bool bInAudioDriven)
+		: bAudioDriven(bInAudioDriven)
+	{}
+
+	bool IsAudioDriven() const { return bAudioDriven; }
+
+	/** Game thread */
+	void Schedule(int32 LineIndex, double ClockSeconds)
+	{
+		FBoundary Boundary;
+		Boundary.Generation = Generation.load();
+		Boundary.LineIndex = LineIndex;
+		Boundary.ClockSeconds = ClockSeconds;
+		ScheduleQueue.Enqueue(Boundary);
+	}
+
+	/** Game thread: invalidate everything scheduled or queued so far */
+	void Reset()
+	{
+		Generation.fetch_add(1);
+	}
+
+	uint32 GetGeneration() const { return Generation.load(); }
+
+	/** Game thread */
+	bool PopBoundary(FBoundary& OutBoundary)
+	{
+		return FiredQueue.Dequeue(OutBoundary);
+	}
+
+	/** Game thread: drive the schedule from platform time when there is no audio render thread */
+	void Poll()
+	{
+		if (!bAudioDriven)
+		{
+			Process(FPlatformTime::Seconds());
+		}
+	}
+
+	double Now() const
+	{
+		if (!bAudioDriven)
+		{
+			return FPlatformTime::Seconds();
+		}
+
+		// The audio clock only moves once per buffer - interpolate within the current one
+		const double Since = FPlatformTime::Seconds() - LastBufferPlatformSeconds.load();
+		return LastBufferClock.load() + FMath::Clamp(Since, 0.0, LastBufferSeconds.load());
+	}
+
+	// ISubmixBufferListener (audio render thread)
+	virtual void OnNewSubmixBuffer(const USoundSubmix* OwningSubmix, float* AudioData, int32 NumSamples, int32 NumChannels, const int32 SampleRate, double AudioClock) override
+	{
+		const double BufferSeconds = (NumChannels > 0 && SampleRate > 0)
+			? static_cast<double>(NumSamples / NumChannels) / SampleRate
+			: 0.0;
+
+		LastBufferClock.store(AudioClock);
+		LastBufferSeconds.store(BufferSeconds);
+		LastBufferPlatformSeconds.store(FPlatformTime::Seconds());
+
+		// AudioClock is the start of this buffer; anything before its end is rendered now
+		Process(AudioClock + BufferSeconds);
+	}
+
+	virtual const FString& GetListenerName() const override
+	{
+		static const FString ListenerName(TEXT("AIFacemaskScriptClock"));
+		return ListenerName;
+	}
+
+private:
+	/** Single consumer: the audio render thread, or the game thread when not audio driven */
+	void Process(double HorizonSeconds)
+	{
+		FBoundary Incoming;
+		while (ScheduleQueue.Dequeue(Incoming))
+		{
+			Pending.Add(Incoming);
+		}
+
+		const uint32 CurrentGeneration = Generation.load();
+		for (int32 Index = 0; Index < Pending.Num();)
+		{
+			const FBoundary& Boundary = Pending[Index];
+			if (Boundary.Generation != CurrentGeneration)
+			{
+				Pending.RemoveAtSwap(Index);
+			}
+			else if (Boundary.ClockSeconds <= HorizonSeconds)
+			{
+				FiredQueue.Enqueue(Boundary);
+				Pending.RemoveAtSwap(Index);
+			}
+			else
+			{
+				++Index;
+			}
+		}
+	}
+
+	const bool bAudioDriven;
+	std::atomic<uint32> Generation{1};
+	std::atomic<double> LastBufferClock{0.0};
+	std::atomic<double> LastBufferSeconds{0.0};
+	std::atomic<double> LastBufferPlatformSeconds{0.0};
+
+	TQueue<FBoundary, EQueueMode::Spsc> ScheduleQueue;
+	TQueue<FBoundary, EQueueMode::Spsc> FiredQueue;
+	/** Owned by the consumer thread */
+	TArray<FBoundary> Pending;
+};
+
+// =====================================
+// Script Manager
+// =====================================
 
 UAIFacemaskScriptManager::UAIFacemaskScriptManager()
 {
 	// Initialize facemask-specific members
 	CurrentScriptLineIndex = -1;
-	ScriptPlaybackTimer = 0.0f;
-	CurrentScriptLineStartTime = 0.0f;
+	CurrentLineStartClock = 0.0;
+	PendingLineStartClock = -1.0;
 	bWaitingForStartDelay = false;
-	StartDelayTimer = 0.0f;
 }
 
 void UAIFacemaskScriptManager::BeginPlay()
@@ -31,54 +182,135 @@ void UAIFacemaskScriptManager::BeginPlay()
 			UE_LOG(LogTemp, Warning, TEXT("UAIFacemaskScriptManager: No UAIFacemaskFaceController found on owner actor"));
 		}
 	}
+
+	StartScriptClock();
 }
 
-void UAIFacemaskScriptManager::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UAIFacemaskScriptManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	BindToStateMachine(nullptr);
+	StopScriptClock();
+	Super::EndPlay(EndPlayReason);
+}
 
-	if (!bIsInitialized || !bIsPlayingScript)
+void UAIFacemaskScriptManager::StartScriptClock()
+{
+	if (ScriptClock.IsValid())
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	FAudioDevice* AudioDevice = World ? World->GetAudioDeviceRaw() : nullptr;
+	ScriptClock = MakeShared<FAIFacemaskScriptClock>(AudioDevice != nullptr);
+
+	if (AudioDevice)
+	{
+		AudioDevice->RegisterSubmixBufferListener(ScriptClock.ToSharedRef(), AudioDevice->GetMainSubmixObject());
+		UE_LOG(LogTemp, Log, TEXT("UAIFacemaskScriptManager: Script line timing follows the audio render clock"));
+	}
+	else
+	{
+		UE_LOG(LogTemp, Log, TEXT("UAIFacemaskScriptManager: No audio device - script line timing follows platform time"));
+	}
+}
+
+void UAIFacemaskScriptManager::StopScriptClock()
+{
+	if (!ScriptClock.IsValid())
 	{
 		return;
 	}
 
-	// Handle start delay
-	if (bWaitingForStartDelay)
+	ScriptClock->Reset();
+	if (ScriptClock->IsAudioDriven())
 	{
-		StartDelayTimer += DeltaTime;
-		if (StartDelayTimer >= CurrentScript.StartDelay)
+		UWorld* World = GetWorld();
+		if (FAudioDevice* AudioDevice = World ? World->GetAudioDeviceRaw() : nullptr)
 		{
-			bWaitingForStartDelay = false;
-			StartDelayTimer = 0.0f;
-			// Start playing first script line
-			if (CurrentScript.ScriptLines.Num() > 0)
-			{
-				StartScriptLine(0);
-			}
+			AudioDevice->UnregisterSubmixBufferListener(ScriptClock.ToSharedRef(), AudioDevice->GetMainSubmixObject());
 		}
+	}
+	ScriptClock.Reset();
+}
+
+double UAIFacemaskScriptManager::GetScriptClockSeconds() const
+{
+	return ScriptClock.IsValid() ? ScriptClock->Now() : FPlatformTime::Seconds();
+}
+
+double UAIFacemaskScriptManager::GetLineDuration(int32 LineIndex) const
+{
+	if (!CurrentScript.ScriptLines.IsValidIndex(LineIndex))
+	{
+		return 0.0;
+	}
+
+	// Pre-bake results land in the collection; CurrentScript may have been copied before they arrived
+	const FAIFacemaskScript* CollectionScript = ScriptCollection.GetScriptForState(CurrentScript.AssociatedStateName);
+	if (CollectionScript && CollectionScript->ScriptLines.IsValidIndex(LineIndex) && CollectionScript->ScriptLines[LineIndex].bIsPreBaked)
+	{
+		return CollectionScript->ScriptLines[LineIndex].GetPlaybackDuration();
+	}
+	return CurrentScript.ScriptLines[LineIndex].GetPlaybackDuration();
+}
+
+void UAIFacemaskScriptManager::DispatchLineBoundaries()
+{
+	if (!ScriptClock.IsValid())
+	{
 		return;
 	}
 
-	// Handle script line playback
-	if (CurrentScriptLineIndex >= 0 && CurrentScriptLineIndex < CurrentScript.ScriptLines.Num())
+	ScriptClock->Poll();
+
+	FAIFacemaskScriptClock::FBoundary Boundary;
+	while (ScriptClock->PopBoundary(Boundary))
 	{
-		const FAIFacemaskScriptLine& CurrentLine = CurrentScript.ScriptLines[CurrentScriptLineIndex];
-		
-		ScriptPlaybackTimer += DeltaTime;
-		
-		// Check if current line has finished (if we have duration estimate)
-		if (CurrentLine.EstimatedDuration > 0.0f)
+		// Handlers below may stop or restart the script, which bumps the generation
+		if (!bIsPlayingScript || Boundary.Generation != ScriptClock->GetGeneration())
+		{
+			continue;
+		}
+
+		LBEASTEXPERIENCES_INC_COUNTER(STAT_AIFacemaskScriptManager_LineBoundaries, 1);
+		UE_LOG(LogTemp, Verbose, TEXT("UAIFacemaskScriptManager: Line boundary %d dispatched %.1f ms after its clock time"),
+			Boundary.LineIndex, (GetScriptClockSeconds() - Boundary.ClockSeconds) * 1000.0);
+
+		// The next line starts exactly at this boundary, however late this tick is
+		PendingLineStartClock = Boundary.ClockSeconds;
+		if (Boundary.LineIndex == INDEX_NONE)
 		{
-			float ElapsedTime = ScriptPlaybackTimer - CurrentScriptLineStartTime;
-			if (ElapsedTime >= CurrentLine.EstimatedDuration)
+			if (bWaitingForStartDelay)
 			{
-				// Advance to next line or finish script
-				AdvanceToNextScriptLine();
+				bWaitingForStartDelay = false;
+				if (CurrentScript.ScriptLines.Num() > 0)
+				{
+					StartScriptLine(0);
+				}
 			}
 		}
-		// If no duration estimate, we rely on ACE server to signal completion
-		// (This would require additional integration with ACE server callbacks)
+		else if (Boundary.LineIndex == CurrentScriptLineIndex)
+		{
+			AdvanceToNextScriptLine();
+		}
+		PendingLineStartClock = -1.0;
+	}
+}
+
+void UAIFacemaskScriptManager::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	LBEASTEXPERIENCES_SCOPE_CYCLE_COUNTER(STAT_AIFacemaskScriptManager_Tick);
+
+	if (!bIsInitialized || !bIsPlayingScript)
+	{
+		return;
 	}
+
+	// Line changes come from the script clock; a line without a known duration
+	// waits for the ACE server to signal completion
+	DispatchLineBoundaries();
 }
 
 bool UAIFacemaskScriptManager::InitializeScriptManager(const FString& InAIServerBaseURL)
@@ -101,10 +333,12 @@ void UAIFacemaskScriptManager::StopCurrentScript()
 	FName CurrentStateName = CurrentScript.AssociatedStateName;
 	
 	CurrentScriptLineIndex = -1;
-	ScriptPlaybackTimer = 0.0f;
-	CurrentScriptLineStartTime = 0.0f;
+	CurrentLineStartClock = 0.0;
 	bWaitingForStartDelay = false;
-	StartDelayTimer = 0.0f;
+	if (ScriptClock.IsValid())
+	{
+		ScriptClock->Reset();
+	}
 
 	UE_LOG(LogTemp, Log, TEXT("UAIFacemaskScriptManager: Stopped script for state '%s'"), *CurrentStateName.ToString());
 	
@@ -161,10 +395,14 @@ bool UAIFacemaskScriptManager::TriggerScriptForState(FName StateName)
 	// Start playing the script
 	CurrentScript = *Script;
 	CurrentScriptLineIndex = -1;
-	ScriptPlaybackTimer = 0.0f;
 	bIsPlayingScript = true;
-	bWaitingForStartDelay = (CurrentScript.StartDelay > 0.0f);
-	StartDelayTimer = 0.0f;
+
+	// The first line starts on the clock once the start delay has elapsed (immediately if none)
+	StartScriptClock();
+	ScriptClock->Reset();
+	bWaitingForStartDelay = true;
+	CurrentLineStartClock = GetScriptClockSeconds();
+	ScriptClock->Schedule(INDEX_NONE, CurrentLineStartClock + CurrentScript.StartDelay);
 
 	// Broadcast script started event
 	OnScriptStarted.Broadcast(StateName, CurrentScript);
@@ -237,6 +475,70 @@ void UAIFacemaskScriptManager::HandleNarrativeStateChanged(FName OldState, FName
 	}
 }
 
+void UAIFacemaskScriptManager::BindToStateMachine(UExperienceStateMachine* StateMachine)
+{
+	if (UExperienceStateMachine* Previous = BoundStateMachine.Get())
+	{
+		Previous->UnbindStateHandlers(this);
+	}
+
+	BoundStateMachine = StateMachine;
+	BoundImprovManager = nullptr;
+
+	if (!StateMachine)
+	{
+		return;
+	}
+
+	if (AActor* Owner = GetOwner())
+	{
+		BoundImprovManager = Owner->FindComponentByClass<UAIFacemaskImprovManager>();
+	}
+
+	if (BoundImprovManager)
+	{
+		StateMachine->BindAnyStateEntered(FOnExperienceStateEntered::CreateUObject(this, &UAIFacemaskScriptManager::HandleImprovStateEntered));
+	}
+
+	int32 ScriptStates = 0;
+	for (const TPair<FName, FAIFacemaskScript>& Entry : ScriptCollection.ScriptsByState)
+	{
+		const int32 StateIndex = StateMachine->FindStateIndex(Entry.Key);
+		if (StateIndex == INDEX_NONE)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("UAIFacemaskScriptManager: Script for '%s' has no matching narrative state"), *Entry.Key.ToString());
+			continue;
+		}
+
+		StateMachine->BindStateEntered(StateIndex,
+			FOnExperienceStateEntered::CreateUObject(this, &UAIFacemaskScriptManager::HandleScriptStateEntered, Entry.Key));
+		ScriptStates++;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("UAIFacemaskScriptManager: Bound to narrative state machine (%d scripted states)"), ScriptStates);
+}
+
+void UAIFacemaskScriptManager::HandleScriptStateEntered(int32 OldStateIndex, int32 NewStateIndex, FName StateName)
+{
+	if (bAutoTriggerOnStateChange)
+	{
+		UE_LOG(LogTemp, Log, TEXT("UAIFacemaskScriptManager: Narrative state changed to '%s', triggering script..."), *StateName.ToString());
+		TriggerScriptForState(StateName);
+	}
+}
+
+void UAIFacemaskScriptManager::HandleImprovStateEntered(int32 OldStateIndex, int32 NewStateIndex)
+{
+	UExperienceStateMachine* StateMachine = BoundStateMachine.Get();
+	if (!StateMachine || !BoundImprovManager || !StateMachine->States.IsValidIndex(NewStateIndex))
+	{
+		return;
+	}
+
+	const FName OldState = StateMachine->States.IsValidIndex(OldStateIndex) ? StateMachine->States[OldStateIndex].StateName : NAME_None;
+	BoundImprovManager->NotifyNarrativeStateChanged(OldState, StateMachine->States[NewStateIndex].StateName, NewStateIndex);
+}
+
 void UAIFacemaskScriptManager::RequestScriptPlayback(FName ScriptID)
 {
 	// Map to state name and call facemask-specific version
@@ -274,13 +576,21 @@ void UAIFacemaskScriptManager::StartScriptLine(int32 LineIndex)
 	{
 		UE_LOG(LogTemp, Log, TEXT("UAIFacemaskScriptManager: Script line %d for state '%s' has already been spoken, skipping playback"), 
 			LineIndex, *CurrentScript.AssociatedStateName.ToString());
-		// Skip to next line or finish script
+		// Skip to next line or finish script (the next line inherits this line's start time)
+		CurrentScriptLineIndex = LineIndex;
 		AdvanceToNextScriptLine();
 		return;
 	}
 
 	CurrentScriptLineIndex = LineIndex;
-	CurrentScriptLineStartTime = ScriptPlaybackTimer;
+	CurrentLineStartClock = (PendingLineStartClock >= 0.0) ? PendingLineStartClock : GetScriptClockSeconds();
+
+	// Schedule the end of this line from its start boundary, not from the tick that sees it
+	const double LineDuration = GetLineDuration(LineIndex);
+	if (LineDuration > 0.0 && ScriptClock.IsValid())
+	{
+		ScriptClock->Schedule(LineIndex, CurrentLineStartClock + LineDuration);
+	}
 
 	UE_LOG(LogTemp, Log, TEXT("UAIFacemaskScriptManager: Started script line %d: '%s'"), 
 		LineIndex, *ScriptLine.TextPrompt);
@@ -324,7 +634,12 @@ void UAIFacemaskScriptManager::AdvanceToNextScriptLine()
 	else
 	{
 		// Check if script should loop
-		if (CurrentScript.bLoopScript)
+		// Lines are never re-spoken, so only loop while one is still unspoken
+		const bool bHasUnspokenLine = CurrentScript.ScriptLines.ContainsByPredicate([](const FAIFacemaskScriptLine& Line)
+		{
+			return !Line.bHasBeenSpoken;
+		});
+		if (CurrentScript.bLoopScript && bHasUnspokenLine)
 		{
 			// Loop back to first line
 			StartScriptLine(0);
@@ -342,8 +657,10 @@ void UAIFacemaskScriptManager::FinishCurrentScript()
 	FName StateName = CurrentScript.AssociatedStateName;
 	
 	CurrentScriptLineIndex = -1;
-	ScriptPlaybackTimer = 0.0f;
-	CurrentScriptLineStartTime = 0.0f;
+	if (ScriptClock.IsValid())
+	{
+		ScriptClock->Reset();
+	}
 
 	UE_LOG(LogTemp, Log, TEXT("UAIFacemaskScriptManager: Finished script for state '%s'"), *StateName.ToString());
 
@@ -465,6 +782,12 @@ void UAIFacemaskScriptManager::PreBakeScriptLineRecursive(const FAIFacemaskScrip
 		if (MutableScript)
 		{
 			MutableScript->bIsFullyPreBaked = true;
+			double TotalDuration = 0.0;
+			for (const FAIFacemaskScriptLine& Line : MutableScript->ScriptLines)
+			{
+				TotalDuration += Line.GetPlaybackDuration();
+			}
+			MutableScript->TotalEstimatedDuration = static_cast<float>(TotalDuration);
 		}
 		
 		UE_LOG(LogTemp, Log, TEXT("UAIFacemaskScriptManager: Pre-baking complete for script (State: %s)"), *StateName.ToString());
@@ -479,7 +802,7 @@ void UAIFacemaskScriptManager::PreBakeScriptLineRecursive(const FAIFacemaskScrip
 	
 	// Step 1: Request TTS conversion (capture ScriptLine by value for nested lambda)
 	const FAIFacemaskScriptLine CapturedScriptLine = ScriptLine;
-	RequestTTSConversion(CapturedScriptLine, [this, Script, LineIndex, CapturedScriptLine](const FString& AudioFilePath, float Duration)
+	RequestTTSConversion(CapturedScriptLine, [this, Script, LineIndex, CapturedScriptLine](const FString& AudioFilePath, float Duration, int64 SampleCount, int32 SampleRate)
 	{
 		if (AudioFilePath.IsEmpty())
 		{
@@ -496,6 +819,8 @@ void UAIFacemaskScriptManager::PreBakeScriptLineRecursive(const FAIFacemaskScrip
 			FAIFacemaskScriptLine& MutableLine = MutableScript->ScriptLines[LineIndex];
 			MutableLine.PreBakedAudioPath = AudioFilePath;
 			MutableLine.EstimatedDuration = Duration;
+			MutableLine.PreBakedSampleCount = SampleCount;
+			MutableLine.PreBakedSampleRate = SampleRate;
 			MutableLine.bIsPreBaked = true;
 		}
 
@@ -513,14 +838,14 @@ void UAIFacemaskScriptManager::PreBakeScriptLineRecursive(const FAIFacemaskScrip
 	});
 }
 
-void UAIFacemaskScriptManager::RequestTTSConversion(const FAIFacemaskScriptLine& ScriptLine, TFunction<void(const FString& AudioFilePath, float Duration)> Callback)
+void UAIFacemaskScriptManager::RequestTTSConversion(const FAIFacemaskScriptLine& ScriptLine, TFunction<void(const FString& AudioFilePath, float Duration, int64 SampleCount, int32 SampleRate)> Callback)
 {
 	if (!HTTPClient || ACEServerBaseURL.IsEmpty())
 	{
 		UE_LOG(LogTemp, Error, TEXT("UAIFacemaskScriptManager: Cannot request TTS - HTTP client or server URL not configured"));
 		if (Callback)
 		{
-			Callback(TEXT(""), 0.0f);
+			Callback(TEXT(""), 0.0f, 0, 0);
 		}
 		return;
 	}
@@ -550,6 +875,8 @@ void UAIFacemaskScriptManager::RequestTTSConversion(const FAIFacemaskScriptLine&
 	{
 		FString AudioFilePath;
 		float Duration = 0.0f;
+		int64 SampleCount = 0;
+		int32 SampleRate = 0;
 		
 		if (Result.bSuccess && Result.ResponseCode == 200)
 		{
@@ -565,9 +892,15 @@ void UAIFacemaskScriptManager::RequestTTSConversion(const FAIFacemaskScriptLine&
 				{
 					Duration = ResponseJson->GetNumberField(TEXT("duration"));
 				}
+				// Exact length of the rendered audio; "duration" may be rounded or estimated
+				if (ResponseJson->HasField(TEXT("sample_count")) && ResponseJson->HasField(TEXT("sample_rate")))
+				{
+					SampleCount = static_cast<int64>(ResponseJson->GetNumberField(TEXT("sample_count")));
+					SampleRate = static_cast<int32>(ResponseJson->GetNumberField(TEXT("sample_rate")));
+				}
 				
-				UE_LOG(LogTemp, Log, TEXT("UAIFacemaskScriptManager: TTS conversion successful (Audio: %s, Duration: %.2fs)"), 
-					*AudioFilePath, Duration);
+				UE_LOG(LogTemp, Log, TEXT("UAIFacemaskScriptManager: TTS conversion successful (Audio: %s, Duration: %.2fs, Samples: %lld @ %d Hz)"), 
+					*AudioFilePath, Duration, SampleCount, SampleRate);
 			}
 		}
 		else
@@ -578,7 +911,7 @@ void UAIFacemaskScriptManager::RequestTTSConversion(const FAIFacemaskScriptLine&
 		
 		if (Callback)
 		{
-			Callback(AudioFilePath, Duration);
+			Callback(AudioFilePath, Duration, SampleCount, SampleRate);
 		}
 	});
 }
@@ -2,13 +2,17 @@
 
 #include "EscapeRoomExperience.h"
 #include "EmbeddedDeviceController.h"
+#include "EscapeRoomPropOrchestrator.h"
 #include "ExperienceLoop/ExperienceStateMachine.h"
+#include "ShowControl/LBEASTShowTimeline.h"
 
 AEscapeRoomExperience::AEscapeRoomExperience()
 {
 	// Enable narrative state machine by default for escape rooms
 	bUseNarrativeStateMachine = true;
 
+	PropOrchestrator = CreateDefaultSubobject<UEscapeRoomPropOrchestrator>(TEXT("PropOrchestrator"));
+
 	// Initialize arrays
 	DoorUnlockStates.SetNum(NumberOfDoors);
 	PropSensorValues.SetNum(NumberOfProps);
@@ -58,6 +62,20 @@ bool AEscapeRoomExperience::InitializeExperienceImpl()
 
 		NarrativeStateMachine->Initialize(DefaultStates);
 		UE_LOG(LogTemp, Log, TEXT("EscapeRoomExperience: Narrative state machine initialized with %d states"), DefaultStates.Num());
+
+		RebindStateDoors();
+	}
+
+	// Timed prop cues from the show timeline
+	if (!PropShowTrackName.IsNone())
+	{
+		if (ULBEASTShowControlSubsystem* ShowControl = ULBEASTShowControlSubsystem::Get(this))
+		{
+			RegisteredShowTrackName = ShowControl->RegisterTrack(PropShowTrackName, this, [this](const FLBEASTShowCue& Cue, double LateSeconds)
+			{
+				ExecutePropShowCue(Cue, LateSeconds);
+			});
+		}
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("EscapeRoomExperience: Initialization complete"));
@@ -66,6 +84,21 @@ bool AEscapeRoomExperience::InitializeExperienceImpl()
 
 void AEscapeRoomExperience::ShutdownExperienceImpl()
 {
+	if (!RegisteredShowTrackName.IsNone())
+	{
+		if (ULBEASTShowControlSubsystem* ShowControl = ULBEASTShowControlSubsystem::Get(this))
+		{
+			ShowControl->UnregisterTrack(RegisteredShowTrackName, this);
+		}
+		RegisteredShowTrackName = NAME_None;
+	}
+
+	// Send anything still queued this frame (e.g. a final unlock) before the sockets close
+	if (PropOrchestrator)
+	{
+		PropOrchestrator->Flush();
+	}
+
 	// Disconnect embedded devices
 	if (DoorController)
 	{
@@ -142,6 +175,25 @@ void AEscapeRoomExperience::InitializeEmbeddedDevices()
 			UE_LOG(LogTemp, Warning, TEXT("EscapeRoomExperience: Failed to initialize prop controller"));
 		}
 	}
+
+	// Route door and prop commands through the orchestrator so a frame's commands share one packet per device
+	if (PropOrchestrator)
+	{
+		PropOrchestrator->ClearDevices();
+		DoorDeviceIndex = PropOrchestrator->RegisterDevice(DoorController);
+		PropDeviceIndex = PropOrchestrator->RegisterDevice(NumberOfProps > 0 ? PropController.Get() : nullptr);
+
+		// Default binding: prop N is channel N on the prop controller (keep any bindings set in the editor)
+		if (PropOrchestrator->PropBindings.Num() == 0 && PropDeviceIndex != INDEX_NONE)
+		{
+			PropOrchestrator->PropBindings.SetNum(NumberOfProps);
+			for (int32 i = 0; i < NumberOfProps; i++)
+			{
+				PropOrchestrator->PropBindings[i].DeviceIndex = PropDeviceIndex;
+				PropOrchestrator->PropBindings[i].Channel = i;
+			}
+		}
+	}
 }
 
 bool AEscapeRoomExperience::UnlockDoor(int32 DoorIndex)
@@ -162,7 +214,11 @@ bool AEscapeRoomExperience::UnlockDoor(int32 DoorIndex)
 	// Note: This sends the command to the firmware. For unlock confirmation callback,
 	// bind to OnDoorUnlockConfirmed delegate. The firmware will send back confirmation
 	// when the door actually unlocks, which triggers OnDoorStateChanged and fires OnDoorUnlockConfirmed.
-	DoorController->SendBool(DoorIndex, true);
+	// Queued: goes out at end of frame in the same packet as any other door command this frame.
+	if (!PropOrchestrator || !PropOrchestrator->QueueDeviceBool(DoorDeviceIndex, DoorIndex, true))
+	{
+		DoorController->SendBool(DoorIndex, true);
+	}
 	
 	UE_LOG(LogTemp, Log, TEXT("EscapeRoomExperience: Unlock command sent to door %d"), DoorIndex);
 	return true;
@@ -183,7 +239,10 @@ bool AEscapeRoomExperience::LockDoor(int32 DoorIndex)
 	}
 
 	// Send lock command (bool false = lock)
-	DoorController->SendBool(DoorIndex, false);
+	if (!PropOrchestrator || !PropOrchestrator->QueueDeviceBool(DoorDeviceIndex, DoorIndex, false))
+	{
+		DoorController->SendBool(DoorIndex, false);
+	}
 	
 	UE_LOG(LogTemp, Log, TEXT("EscapeRoomExperience: Lock command sent to door %d"), DoorIndex);
 	return true;
@@ -213,13 +272,53 @@ bool AEscapeRoomExperience::TriggerPropAction(int32 PropIndex, float ActionValue
 		return false;
 	}
 
-	// Send action command (float 0.0-1.0 for intensity/position)
-	PropController->SendFloat(PropIndex, FMath::Clamp(ActionValue, 0.0f, 1.0f));
+	// Send action command (float 0.0-1.0 for intensity/position), batched with the rest of this frame's prop commands
+	const float Value = FMath::Clamp(ActionValue, 0.0f, 1.0f);
+	if (!PropOrchestrator)
+	{
+		PropController->SendFloat(PropIndex, Value);
+	}
+	else if (!PropOrchestrator->QueuePropFloat(PropIndex, Value))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("EscapeRoomExperience: Prop %d is not bound to a connected device"), PropIndex);
+		return false;
+	}
 	
 	UE_LOG(LogTemp, Log, TEXT("EscapeRoomExperience: Prop action triggered on prop %d (value: %.2f)"), PropIndex, ActionValue);
 	return true;
 }
 
+int32 AEscapeRoomExperience::TriggerPropGroup(const TArray<int32>& PropIndices, float ActionValue)
+{
+	if (!PropOrchestrator)
+	{
+		int32 Triggered = 0;
+		for (int32 PropIndex : PropIndices)
+		{
+			Triggered += TriggerPropAction(PropIndex, ActionValue) ? 1 : 0;
+		}
+		return Triggered;
+	}
+
+	const int32 Queued = PropOrchestrator->TriggerPropGroup(PropIndices, FMath::Clamp(ActionValue, 0.0f, 1.0f));
+	UE_LOG(LogTemp, Log, TEXT("EscapeRoomExperience: Prop group triggered (%d/%d props, value: %.2f)"), Queued, PropIndices.Num(), ActionValue);
+	return Queued;
+}
+
+void AEscapeRoomExperience::ExecutePropShowCue(const FLBEASTShowCue& Cue, double LateSeconds)
+{
+	static const FName ActionCommand(TEXT("Action"));
+
+	if (Cue.Command == ActionCommand)
+	{
+		TriggerPropAction(Cue.TargetIndex, Cue.Value);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("EscapeRoomExperience: Unknown prop show cue command '%s'"), *Cue.Command.ToString());
+	}
+}
+
 float AEscapeRoomExperience::ReadPropSensor(int32 PropIndex) const
 {
 	if (PropIndex < 0 || PropIndex >= PropSensorValues.Num())
@@ -235,22 +334,35 @@ FName AEscapeRoomExperience::GetCurrentPuzzleState() const
 	return GetCurrentNarrativeState();
 }
 
-void AEscapeRoomExperience::OnNarrativeStateChanged(FName OldState, FName NewState, int32 NewStateIndex)
+void AEscapeRoomExperience::RebindStateDoors()
 {
-	// Note: OnNarrativeStateChanged is a BlueprintImplementableEvent in the base class,
-	// so we can't call Super::. This C++ implementation handles the door unlocking logic.
-	// Blueprint can still override this if needed.
+	if (!NarrativeStateMachine)
+	{
+		return;
+	}
+
+	NarrativeStateMachine->UnbindStateHandlers(this);
 
-	UE_LOG(LogTemp, Log, TEXT("EscapeRoomExperience: Narrative state changed from %s to %s"), 
-		*OldState.ToString(), *NewState.ToString());
+	for (const TPair<FName, int32>& Mapping : StateToDoorMapping)
+	{
+		const int32 StateIndex = NarrativeStateMachine->FindStateIndex(Mapping.Key);
+		if (StateIndex == INDEX_NONE)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("EscapeRoomExperience: Door %d is mapped to unknown state '%s'"), Mapping.Value, *Mapping.Key.ToString());
+			continue;
+		}
 
-	// Check if this state maps to a door
-	int32 DoorIndex = GetDoorIndexForState(NewState);
+		NarrativeStateMachine->BindStateEntered(StateIndex,
+			FOnExperienceStateEntered::CreateUObject(this, &AEscapeRoomExperience::HandleDoorStateEntered, Mapping.Value));
+	}
+}
+
+void AEscapeRoomExperience::HandleDoorStateEntered(int32 OldStateIndex, int32 NewStateIndex, int32 DoorIndex)
+{
 	if (DoorIndex >= 0 && DoorIndex < NumberOfDoors)
 	{
 		UnlockDoor(DoorIndex);
-		UE_LOG(LogTemp, Log, TEXT("EscapeRoomExperience: Automatically unlocked door %d for state %s"), 
-			DoorIndex, *NewState.ToString());
+		UE_LOG(LogTemp, Log, TEXT("EscapeRoomExperience: Automatically unlocked door %d for state index %d"), DoorIndex, NewStateIndex);
 	}
 }
 
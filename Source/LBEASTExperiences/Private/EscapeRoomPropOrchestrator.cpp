@@ -0,0 +1,221 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "EscapeRoomPropOrchestrator.h"
+#include "EmbeddedDeviceController.h"
+#include "LBEASTExperiences.h"
+
+DECLARE_CYCLE_STAT(TEXT("PropOrchestrator Flush"), STAT_PropOrchestrator_Flush, STATGROUP_LBEASTExperiences);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Prop Commands Queued"), STAT_PropOrchestrator_Commands, STATGROUP_LBEASTExperiences);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Prop Packets Sent"), STAT_PropOrchestrator_Packets, STATGROUP_LBEASTExperiences);
+
+UEscapeRoomPropOrchestrator::UEscapeRoomPropOrchestrator()
+{
+	// Flush after every actor has had its say this frame; only tick when something is queued
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+}
+
+int32 UEscapeRoomPropOrchestrator::RegisterDevice(UEmbeddedDeviceController* Device)
+{
+	if (!Device)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Existing = Devices.IndexOfByKey(Device);
+	if (Existing != INDEX_NONE)
+	{
+		return Existing;
+	}
+
+	DeviceFireAt.Add(0.0);
+	DeviceGroupId.Add(0);
+	return Devices.Add(Device);
+}
+
+void UEscapeRoomPropOrchestrator::ClearDevices()
+{
+	Devices.Reset();
+	DeviceFireAt.Reset();
+	DeviceGroupId.Reset();
+	SetComponentTickEnabled(false);
+}
+
+UEmbeddedDeviceController* UEscapeRoomPropOrchestrator::ResolveDevice(int32 DeviceIndex) const
+{
+	if (!Devices.IsValidIndex(DeviceIndex))
+	{
+		return nullptr;
+	}
+
+	UEmbeddedDeviceController* Device = Devices[DeviceIndex];
+	return (Device && Device->IsDeviceConnected()) ? Device : nullptr;
+}
+
+UEmbeddedDeviceController* UEscapeRoomPropOrchestrator::ResolveProp(int32 PropIndex, int32& OutDeviceIndex, int32& OutChannel) const
+{
+	if (!PropBindings.IsValidIndex(PropIndex))
+	{
+		return nullptr;
+	}
+
+	OutDeviceIndex = PropBindings[PropIndex].DeviceIndex;
+	OutChannel = PropBindings[PropIndex].Channel;
+	return ResolveDevice(OutDeviceIndex);
+}
+
+void UEscapeRoomPropOrchestrator::ScheduleFlush()
+{
+	LBEASTEXPERIENCES_INC_COUNTER(STAT_PropOrchestrator_Commands, 1);
+	if (!IsComponentTickEnabled())
+	{
+		SetComponentTickEnabled(true);
+	}
+}
+
+bool UEscapeRoomPropOrchestrator::QueuePropFloat(int32 PropIndex, float Value)
+{
+	int32 DeviceIndex, Channel;
+	UEmbeddedDeviceController* Device = ResolveProp(PropIndex, DeviceIndex, Channel);
+	if (!Device)
+	{
+		return false;
+	}
+
+	Device->QueueFloat(Channel, Value);
+	ScheduleFlush();
+	return true;
+}
+
+bool UEscapeRoomPropOrchestrator::QueuePropBool(int32 PropIndex, bool Value)
+{
+	int32 DeviceIndex, Channel;
+	UEmbeddedDeviceController* Device = ResolveProp(PropIndex, DeviceIndex, Channel);
+	if (!Device)
+	{
+		return false;
+	}
+
+	Device->QueueBool(Channel, Value);
+	ScheduleFlush();
+	return true;
+}
+
+bool UEscapeRoomPropOrchestrator::QueueDeviceFloat(int32 DeviceIndex, int32 Channel, float Value)
+{
+	UEmbeddedDeviceController* Device = ResolveDevice(DeviceIndex);
+	if (!Device)
+	{
+		return false;
+	}
+
+	Device->QueueFloat(Channel, Value);
+	ScheduleFlush();
+	return true;
+}
+
+bool UEscapeRoomPropOrchestrator::QueueDeviceBool(int32 DeviceIndex, int32 Channel, bool Value)
+{
+	UEmbeddedDeviceController* Device = ResolveDevice(DeviceIndex);
+	if (!Device)
+	{
+		return false;
+	}
+
+	Device->QueueBool(Channel, Value);
+	ScheduleFlush();
+	return true;
+}
+
+int32 UEscapeRoomPropOrchestrator::TriggerPropGroup(const TArray<int32>& PropIndices, float Value)
+{
+	const double FireAt = FPlatformTime::Seconds() + GroupLeadMs / 1000.0;
+	const uint8 GroupId = NextGroupId;
+	NextGroupId = NextGroupId == 255 ? 1 : NextGroupId + 1;
+
+	int32 Queued = 0;
+	for (int32 PropIndex : PropIndices)
+	{
+		int32 DeviceIndex, Channel;
+		UEmbeddedDeviceController* Device = ResolveProp(PropIndex, DeviceIndex, Channel);
+		if (!Device)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("EscapeRoomPropOrchestrator: Prop %d has no connected device, skipped in group"), PropIndex);
+			continue;
+		}
+
+		Device->QueueFloat(Channel, Value);
+		// Two groups in one frame on the same device share the later fire time (one batch per device per frame)
+		DeviceFireAt[DeviceIndex] = FMath::Max(DeviceFireAt[DeviceIndex], FireAt);
+		DeviceGroupId[DeviceIndex] = GroupId;
+		ScheduleFlush();
+		Queued++;
+	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("EscapeRoomPropOrchestrator: Group %d queued %d/%d props"), GroupId, Queued, PropIndices.Num());
+	return Queued;
+}
+
+void UEscapeRoomPropOrchestrator::Flush()
+{
+	LBEASTEXPERIENCES_SCOPE_CYCLE_COUNTER(STAT_PropOrchestrator_Flush);
+
+	// One clock read for every device so their hold delays all point at the same instant
+	const double Now = FPlatformTime::Seconds();
+	int32 Packets = 0;
+
+	for (int32 DeviceIndex = 0; DeviceIndex < Devices.Num(); DeviceIndex++)
+	{
+		UEmbeddedDeviceController* Device = Devices[DeviceIndex];
+		if (Device && Device->HasQueuedCommands())
+		{
+			const double FireAt = DeviceFireAt[DeviceIndex];
+			int32 DelayMs = 0;
+			if (FireAt > 0.0)
+			{
+				// The hold starts when the batch arrives, so take this device's delivery time off it
+				const double OneWayMs = Device->GetRoundTripP50Ms() * 0.5;
+				const double RemainingMs = (FireAt - Now) * 1000.0 - OneWayMs;
+				if (RemainingMs < 0.0)
+				{
+					UE_LOG(LogTemp, Verbose, TEXT("EscapeRoomPropOrchestrator: Device %d one-way latency %.1fms exceeds the group lead, fires %.1fms late"),
+						DeviceIndex, OneWayMs, -RemainingMs);
+				}
+				DelayMs = FMath::Clamp(FMath::RoundToInt(RemainingMs), 0, (int32)MAX_uint16);
+			}
+			Packets += Device->FlushQueuedCommands(DelayMs, DeviceGroupId[DeviceIndex]);
+		}
+
+		DeviceFireAt[DeviceIndex] = 0.0;
+		DeviceGroupId[DeviceIndex] = 0;
+	}
+
+	LastFlushPackets = Packets;
+	LBEASTEXPERIENCES_INC_COUNTER(STAT_PropOrchestrator_Packets, Packets);
+}
+
+float UEscapeRoomPropOrchestrator::GetPropSensor(int32 PropIndex) const
+{
+	if (!PropBindings.IsValidIndex(PropIndex))
+	{
+		return 0.0f;
+	}
+
+	const FEscapeRoomPropBinding& Binding = PropBindings[PropIndex];
+	if (!Devices.IsValidIndex(Binding.DeviceIndex) || !Devices[Binding.DeviceIndex])
+	{
+		return 0.0f;
+	}
+
+	// Cached by the device when its push arrived
+	return Devices[Binding.DeviceIndex]->GetInputValue(Binding.Channel);
+}
+
+void UEscapeRoomPropOrchestrator::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	Flush();
+	SetComponentTickEnabled(false);
+}
@@ -3,6 +3,9 @@
 #include "FlightSimExperience.h"
 #include "2DOFGyroPlatformController.h"
 #include "Models/GyroState.h"
+#include "LBEASTExperiences.h"
+
+DECLARE_CYCLE_STAT(TEXT("FlightSimExperience Tick"), STAT_FlightSimExperience_Tick, STATGROUP_LBEASTExperiences);
 
 AFlightSimExperience::AFlightSimExperience()
 {
@@ -73,6 +76,7 @@ bool AFlightSimExperience::InitializeExperienceImpl()
 void AFlightSimExperience::Tick(float DeltaSeconds)
 {
 	Super::Tick(DeltaSeconds);
+	LBEASTEXPERIENCES_SCOPE_CYCLE_COUNTER(STAT_FlightSimExperience_Tick);
 	UpdateCockpitTransform(DeltaSeconds);
 }
 
@@ -163,8 +167,8 @@ void AFlightSimExperience::EmergencyStop()
 		return;
 	}
 
-	// Send emergency stop command (Channel 7)
-	GyroscopeController->SendBool(7, true);
+	// Send emergency stop command (Channel 7) on the acknowledged safety lane
+	GyroscopeController->SendSafetyBool(7, true);
 }
 
 void AFlightSimExperience::UpdateCockpitTransform(float DeltaSeconds)
@@ -4,6 +4,10 @@
 #include "LBEASTExperiences.h"
 #include "Networking/LBEASTUDPTransport.h"
 
+DECLARE_CYCLE_STAT(TEXT("GoKartECUController Tick"), STAT_GoKartECUController_Tick, STATGROUP_LBEASTExperiences);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GoKart Throttle Envelopes"), STAT_GoKartECUController_Envelopes, STATGROUP_LBEASTExperiences);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GoKart Clock Sync Samples"), STAT_GoKartECUController_ClockSamples, STATGROUP_LBEASTExperiences);
+
 UGoKartECUController::UGoKartECUController()
 {
 	PrimaryComponentTick.bCanEverTick = true;
@@ -27,6 +31,7 @@ void UGoKartECUController::BeginPlay()
 void UGoKartECUController::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	LBEASTEXPERIENCES_SCOPE_CYCLE_COUNTER(STAT_GoKartECUController_Tick);
 
 	// NOOP: UDP data processing will be implemented
 	// Check for connection timeout
@@ -41,6 +46,15 @@ void UGoKartECUController::TickComponent(float DeltaTime, ELevelTick TickType, F
 			UE_LOG(LogGoKart, Warning, TEXT("GoKartECU: Connection timeout"));
 		}
 	}
+
+	// Keep the ECU clock estimate fresh: a spaced burst until a few samples exist, then periodic
+	if (UDPTransport && UDPTransport->IsUDPConnected())
+	{
+		if (FPlatformTime::Seconds() - LastClockSyncRequest >= GetClockSyncSpacingSeconds())
+		{
+			RequestClockSync();
+		}
+	}
 }
 
 bool UGoKartECUController::InitializeECU(const FString& InECUIPAddress, int32 InECUPort)
@@ -59,6 +73,14 @@ bool UGoKartECUController::InitializeECU(const FString& InECUIPAddress, int32 In
 		return false;
 	}
 
+	UDPTransport->OnBytesReceived.AddUniqueDynamic(this, &UGoKartECUController::OnBytesReceived);
+
+	// A (re)connected ECU may have rebooted - start the clock estimate over
+	ClockSamples.Reset();
+	BestClockSample = INDEX_NONE;
+	ClockRequestsUnanswered = 0;
+	LastClockSyncRequest = 0.0;
+
 	bECUConnected = true;
 	UE_LOG(LogGoKart, Log, TEXT("GoKartECU: Connected to %s:%d"), *ECUIPAddress, ECUPort);
 	return true;
@@ -68,6 +90,7 @@ void UGoKartECUController::ShutdownECU()
 {
 	if (UDPTransport)
 	{
+		UDPTransport->OnBytesReceived.RemoveDynamic(this, &UGoKartECUController::OnBytesReceived);
 		UDPTransport->ShutdownUDPConnection();
 	}
 	bECUConnected = false;
@@ -89,14 +112,144 @@ void UGoKartECUController::SetThrottleMultiplier(float Multiplier)
 
 void UGoKartECUController::SendThrottleState(const FGoKartThrottleState& ThrottleState)
 {
-	// NOOP: Will send complete throttle state struct to ECU via Channel 100
+	// Complete throttle state struct to ECU via Channel 100
+	if (UDPTransport)
+	{
+		UDPTransport->SendStruct(100, ThrottleState);
+	}
+}
+
+int32 UGoKartECUController::SendThrottleEnvelope(FGoKartThrottleEnvelope Envelope)
+{
+	Envelope.TargetMultiplier = FMath::Clamp(Envelope.TargetMultiplier, 0.0f, 2.0f);
+	Envelope.RampInMs = FMath::Max(0, Envelope.RampInMs);
+	Envelope.HoldMs = FMath::Max(0, Envelope.HoldMs);
+	Envelope.RampOutMs = FMath::Max(0, Envelope.RampOutMs);
+	Envelope.EffectId = NextEffectId++;
+
+	// Unsynced envelopes start on receipt
+	Envelope.StartAtMs = 0;
+	if (IsClockSynced())
+	{
+		Envelope.StartAtMs = PlatformSecondsToECUMs(FPlatformTime::Seconds() + EnvelopeLeadMs / 1000.0);
+		// 0 means "on receipt", so nudge a start time that happens to land on it
+		if (Envelope.StartAtMs == 0)
+		{
+			Envelope.StartAtMs = 1;
+		}
+	}
+
 	if (UDPTransport)
 	{
-		// Send as struct packet
-		TArray<uint8> StructData;
-		// Serialize struct to bytes (implementation needed)
-		UDPTransport->SendStruct(100, StructData);
+		UDPTransport->SendStruct(101, Envelope);
+		LBEASTEXPERIENCES_INC_COUNTER(STAT_GoKartECUController_Envelopes, 1);
 	}
+
+	UE_LOG(LogGoKart, Verbose, TEXT("GoKartECU: Envelope %d -> x%.2f (in %d ms, hold %d ms, out %d ms) at ECU %u ms"),
+		Envelope.EffectId, Envelope.TargetMultiplier, Envelope.RampInMs, Envelope.HoldMs, Envelope.RampOutMs, static_cast<uint32>(Envelope.StartAtMs));
+	return Envelope.EffectId;
+}
+
+// =====================================
+// Clock Sync
+// =====================================
+
+void UGoKartECUController::RequestClockSync()
+{
+	if (!UDPTransport)
+	{
+		return;
+	}
+
+	const int32 Sequence = NextClockSequence++;
+	const int32 Slot = Sequence % CLOCK_REQUEST_RING;
+	LastClockSyncRequest = FPlatformTime::Seconds();
+	ClockRequestSequence[Slot] = Sequence;
+	ClockRequestSentAt[Slot] = LastClockSyncRequest;
+
+	if (++ClockRequestsUnanswered == CLOCK_SYNC_UNANSWERED_WARNING)
+	{
+		UE_LOG(LogGoKart, Warning, TEXT("GoKartECU: %d clock-sync requests unanswered (does the ECU firmware reply on Channel 102?), backing off to every %.1fs"),
+			ClockRequestsUnanswered, ClockSyncIntervalSeconds);
+	}
+
+	UDPTransport->SendInt32(102, Sequence);
+}
+
+double UGoKartECUController::GetClockSyncSpacingSeconds() const
+{
+	if (ClockSamples.Num() >= CLOCK_SYNC_BURST)
+	{
+		return ClockSyncIntervalSeconds;
+	}
+
+	// The request in flight is not overdue yet, so only earlier misses count towards the back-off
+	const int32 Missed = FMath::Clamp(ClockRequestsUnanswered - 1, 0, 16);
+	return FMath::Min(CLOCK_SYNC_BURST_SPACING_SECONDS * (double)(1 << Missed), (double)ClockSyncIntervalSeconds);
+}
+
+void UGoKartECUController::HandleClockSyncReply(const FGoKartClockSyncReply& Reply)
+{
+	const double ReceivedAt = FPlatformTime::Seconds();
+	const int32 Slot = Reply.Sequence % CLOCK_REQUEST_RING;
+	if (Reply.Sequence <= 0 || ClockRequestSequence[Slot] != Reply.Sequence || ClockRequestSentAt[Slot] <= 0.0)
+	{
+		// Unknown, duplicated or too old to still have its send time
+		return;
+	}
+
+	const double SentAt = ClockRequestSentAt[Slot];
+	ClockRequestSentAt[Slot] = 0.0;
+	ClockRequestsUnanswered = 0;
+
+	// Assume the ECU stamped the reply halfway through the round trip
+	FClockSample Sample;
+	Sample.RoundTripMs = (ReceivedAt - SentAt) * 1000.0;
+	Sample.OffsetMs = static_cast<double>(static_cast<uint32>(Reply.ECUTimeMs)) - (SentAt + ReceivedAt) * 500.0;
+
+	if (ClockSamples.IsValidIndex(BestClockSample))
+	{
+		// Offsets are compared modulo the ECU's 32-bit wrap; a jump beyond both round trips means the ECU restarted
+		const FClockSample& Best = ClockSamples[BestClockSample];
+		const int32 Jump = static_cast<int32>(static_cast<uint32>(FMath::RoundToInt64(Sample.OffsetMs)) - static_cast<uint32>(FMath::RoundToInt64(Best.OffsetMs)));
+		if (FMath::Abs(Jump) > Sample.RoundTripMs + Best.RoundTripMs + 50.0)
+		{
+			UE_LOG(LogGoKart, Log, TEXT("GoKartECU: ECU clock jumped %d ms, resyncing"), Jump);
+			ClockSamples.Reset();
+		}
+	}
+
+	if (ClockSamples.Num() >= CLOCK_SAMPLE_WINDOW)
+	{
+		ClockSamples.RemoveAt(0, 1, EAllowShrinking::No);
+	}
+	ClockSamples.Add(Sample);
+	LBEASTEXPERIENCES_INC_COUNTER(STAT_GoKartECUController_ClockSamples, 1);
+
+	BestClockSample = 0;
+	for (int32 i = 1; i < ClockSamples.Num(); i++)
+	{
+		if (ClockSamples[i].RoundTripMs < ClockSamples[BestClockSample].RoundTripMs)
+		{
+			BestClockSample = i;
+		}
+	}
+}
+
+float UGoKartECUController::GetClockSyncRoundTripMs() const
+{
+	return ClockSamples.IsValidIndex(BestClockSample) ? static_cast<float>(ClockSamples[BestClockSample].RoundTripMs) : -1.0f;
+}
+
+int32 UGoKartECUController::PlatformSecondsToECUMs(double PlatformSeconds) const
+{
+	if (!ClockSamples.IsValidIndex(BestClockSample))
+	{
+		return 0;
+	}
+
+	const int64 ECUMs = FMath::RoundToInt64(PlatformSeconds * 1000.0 + ClockSamples[BestClockSample].OffsetMs);
+	return static_cast<int32>(static_cast<uint32>(ECUMs));
 }
 
 void UGoKartECUController::SetPlaySessionActive(bool bActive)
@@ -105,15 +258,16 @@ void UGoKartECUController::SetPlaySessionActive(bool bActive)
 	if (UDPTransport)
 	{
 		UDPTransport->SendBool(9, bActive);
+		UDPTransport->SetTelemetrySessionActive(bActive);
 	}
 }
 
 void UGoKartECUController::EmergencyStop()
 {
-	// NOOP: Will send emergency stop to ECU via Channel 7
+	// Emergency stop via Channel 7 on the acknowledged safety lane
 	if (UDPTransport)
 	{
-		UDPTransport->SendBool(7, true);
+		UDPTransport->SendSafetyBool(7, true);
 	}
 }
 
@@ -158,3 +312,22 @@ void UGoKartECUController::ProcessReceivedData(const TArray<uint8>& Data)
 	// NOOP: Will process incoming UDP data and route to appropriate channels
 }
 
+void UGoKartECUController::OnBytesReceived(int32 Channel, TArray<uint8> Data)
+{
+	// Channel 102: clock-sync reply (the wire channel is one byte, so replies reuse the request channel)
+	if (Channel == 102)
+	{
+		if (Data.Num() >= sizeof(FGoKartClockSyncReply))
+		{
+			FGoKartClockSyncReply Reply;
+			FMemory::Memcpy(&Reply, Data.GetData(), sizeof(FGoKartClockSyncReply));
+			HandleClockSyncReply(Reply);
+		}
+		else
+		{
+			UE_LOG(LogGoKart, Warning, TEXT("GoKartECU: Invalid clock sync packet size (%d bytes, expected %d)"),
+				Data.Num(), sizeof(FGoKartClockSyncReply));
+		}
+	}
+}
+
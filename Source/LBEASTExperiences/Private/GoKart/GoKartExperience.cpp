@@ -8,6 +8,8 @@
 #include "GoKart/GoKartTrackSpline.h"
 #include "LBEASTExperiences.h"
 
+DECLARE_CYCLE_STAT(TEXT("GoKartExperience Tick"), STAT_GoKartExperience_Tick, STATGROUP_LBEASTExperiences);
+
 AGoKartExperience::AGoKartExperience()
 {
 	ECUController = CreateDefaultSubobject<UGoKartECUController>(TEXT("ECUController"));
@@ -17,7 +19,6 @@ AGoKartExperience::AGoKartExperience()
 	bMultiplayerEnabled = false; // Single player for now
 	ActiveTrackIndex = 0;
 	CurrentThrottleMultiplier = 1.0f;
-	ThrottleEffectTimer = 0.0f;
 }
 
 bool AGoKartExperience::InitializeExperienceImpl()
@@ -76,16 +77,7 @@ void AGoKartExperience::ShutdownExperienceImpl()
 void AGoKartExperience::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
-
-	// Update throttle effect timer
-	if (ThrottleEffectTimer > 0.0f)
-	{
-		ThrottleEffectTimer -= DeltaTime;
-		if (ThrottleEffectTimer <= 0.0f)
-		{
-			ResetThrottle();
-		}
-	}
+	LBEASTEXPERIENCES_SCOPE_CYCLE_COUNTER(STAT_GoKartExperience_Tick);
 
 	// Update vehicle state
 	UpdateVehicleState(DeltaTime);
@@ -132,24 +124,33 @@ AGoKartTrackSpline* AGoKartExperience::GetActiveTrack() const
 }
 
 void AGoKartExperience::ApplyThrottleEffect(float Multiplier, float Duration)
+{
+	ApplyThrottleEnvelope(Multiplier, 0.0f, Duration, 0.0f);
+}
+
+void AGoKartExperience::ApplyThrottleEnvelope(float Multiplier, float RampInSeconds, float Duration, float RampOutSeconds)
 {
 	CurrentThrottleMultiplier = FMath::Clamp(Multiplier, 0.0f, 2.0f);
-	ThrottleEffectTimer = Duration;
 
 	if (ECUController)
 	{
-		ECUController->SetThrottleMultiplier(CurrentThrottleMultiplier);
+		FGoKartThrottleEnvelope Envelope;
+		Envelope.TargetMultiplier = CurrentThrottleMultiplier;
+		Envelope.RampInMs = FMath::RoundToInt(FMath::Max(0.0f, RampInSeconds) * 1000.0f);
+		Envelope.HoldMs = FMath::RoundToInt(FMath::Max(0.0f, Duration) * 1000.0f);
+		Envelope.RampOutMs = FMath::RoundToInt(FMath::Max(0.0f, RampOutSeconds) * 1000.0f);
+		ECUController->SendThrottleEnvelope(Envelope);
 	}
 }
 
 void AGoKartExperience::ResetThrottle()
 {
 	CurrentThrottleMultiplier = 1.0f;
-	ThrottleEffectTimer = 0.0f;
 
 	if (ECUController)
 	{
-		ECUController->SetThrottleMultiplier(1.0f);
+		// Replaces whatever effect the ECU is running with a step back to normal
+		ECUController->SendThrottleEnvelope(FGoKartThrottleEnvelope());
 	}
 }
 
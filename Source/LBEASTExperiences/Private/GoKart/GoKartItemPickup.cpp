@@ -5,6 +5,8 @@
 #include "GoKart/GoKartItemActor.h"
 #include "LBEASTExperiences.h"
 
+DECLARE_CYCLE_STAT(TEXT("GoKartItemPickup Tick"), STAT_GoKartItemPickup_Tick, STATGROUP_LBEASTExperiences);
+
 UGoKartItemPickup::UGoKartItemPickup()
 {
 	PrimaryComponentTick.bCanEverTick = true;
@@ -21,6 +23,7 @@ void UGoKartItemPickup::BeginPlay()
 void UGoKartItemPickup::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	LBEASTEXPERIENCES_SCOPE_CYCLE_COUNTER(STAT_GoKartItemPickup_Tick);
 	// NOOP: Will handle item respawn timers
 }
 
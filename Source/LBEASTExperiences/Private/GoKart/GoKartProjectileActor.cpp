@@ -7,6 +7,8 @@
 #include "GoKart/GoKartBarrierSystem.h"
 #include "LBEASTExperiences.h"
 
+DECLARE_CYCLE_STAT(TEXT("GoKartProjectileActor Tick"), STAT_GoKartProjectileActor_Tick, STATGROUP_LBEASTExperiences);
+
 AGoKartProjectileActor::AGoKartProjectileActor()
 {
 	PrimaryActorTick.bCanEverTick = true;
@@ -52,6 +54,7 @@ void AGoKartProjectileActor::BeginPlay()
 void AGoKartProjectileActor::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
+	LBEASTEXPERIENCES_SCOPE_CYCLE_COUNTER(STAT_GoKartProjectileActor_Tick);
 
 	// Check lifetime
 	LifetimeTimer += DeltaTime;
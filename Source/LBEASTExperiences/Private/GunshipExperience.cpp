@@ -8,6 +8,25 @@ AGunshipExperience::AGunshipExperience()
 	PlatformController = CreateDefaultSubobject<U4DOFPlatformController>(TEXT("PlatformController"));
 	bMultiplayerEnabled = true;
 
+	// Gunship ECU rate channels: 100 = button events (firmware floor 10 ms), 101 = gun telemetry (floor 100 ms)
+	FLBEASTTelemetryStream ButtonEvents;
+	ButtonEvents.StreamName = TEXT("GunButtons");
+	ButtonEvents.IntervalChannel = 100;
+	ButtonEvents.ActiveIntervalMs = 20;
+	ButtonEvents.IdleIntervalMs = 200;
+	ButtonEvents.MinIntervalMs = 10;
+	ButtonEvents.MaxIntervalMs = 500;
+	PlatformController->TelemetryStreams.Add(ButtonEvents);
+
+	FLBEASTTelemetryStream GunTelemetry;
+	GunTelemetry.StreamName = TEXT("GunTelemetry");
+	GunTelemetry.IntervalChannel = 101;
+	GunTelemetry.ActiveIntervalMs = 500;
+	GunTelemetry.IdleIntervalMs = 2000;
+	GunTelemetry.MinIntervalMs = 100;
+	GunTelemetry.MaxIntervalMs = 2000;
+	PlatformController->TelemetryStreams.Add(GunTelemetry);
+
 	// Default 4-seat configuration
 	SeatLocations.Add(FVector(-100, -100, 0));  // Front Left
 	SeatLocations.Add(FVector(100, -100, 0));   // Front Right
@@ -117,3 +136,14 @@ void AGunshipExperience::EmergencyStop()
 	}
 }
 
+void AGunshipExperience::SetPlaySessionActive(bool bActive)
+{
+	if (!PlatformController)
+	{
+		return;
+	}
+
+	PlatformController->SendBool(9, bActive);
+	PlatformController->SetTelemetrySessionActive(bActive);
+	UE_LOG(LogTemp, Log, TEXT("GunshipExperience: Play session %s"), bActive ? TEXT("active") : TEXT("inactive"));
+}
@@ -5,7 +5,11 @@
 #include "Networking/LBEASTServerCommandProtocol.h"
 #include "ExperienceLoop/ExperienceStateMachine.h"
 #include "LBEASTWorldPositionCalibrator.h"
+#include "AIReadinessSubsystem.h"
 #include "GameFramework/GameStateBase.h"
+#include "LBEASTExperiences.h"
+
+DECLARE_CYCLE_STAT(TEXT("LBEASTExperienceBase Tick"), STAT_LBEASTExperienceBase_Tick, STATGROUP_LBEASTExperiences);
 
 ALBEASTExperienceBase::ALBEASTExperienceBase()
 {
@@ -70,6 +74,16 @@ bool ALBEASTExperienceBase::InitializeExperience()
 
 	bIsInitialized = true;
 	UE_LOG(LogTemp, Log, TEXT("LBEASTExperience: Initialization complete"));
+
+	// AI providers registered during InitializeExperienceImpl() are warming up now
+	if (UAIReadinessSubsystem* Readiness = UAIReadinessSubsystem::Get(this))
+	{
+		Readiness->OnAIReadyChanged.AddUniqueDynamic(this, &ALBEASTExperienceBase::HandleAIReadyChanged);
+		if (bRequireAIReady && !Readiness->IsAIReady())
+		{
+			UE_LOG(LogTemp, Log, TEXT("LBEASTExperience: Waiting for AI warm-up before admitting guests"));
+		}
+	}
 	return true;
 }
 
@@ -84,6 +98,11 @@ void ALBEASTExperienceBase::ShutdownExperience()
 
 	ShutdownExperienceImpl();
 
+	if (UAIReadinessSubsystem* Readiness = UAIReadinessSubsystem::Get(this))
+	{
+		Readiness->OnAIReadyChanged.RemoveDynamic(this, &ALBEASTExperienceBase::HandleAIReadyChanged);
+	}
+
 	bIsInitialized = false;
 	UE_LOG(LogTemp, Log, TEXT("LBEASTExperience: Shutdown complete"));
 }
@@ -99,8 +118,12 @@ bool ALBEASTExperienceBase::InitializeExperienceImpl()
 		NarrativeStateMachine = NewObject<UExperienceStateMachine>(this, UExperienceStateMachine::StaticClass());
 		if (NarrativeStateMachine)
 		{
-			// Bind to state change events (dynamic delegate uses AddDynamic)
-			NarrativeStateMachine->OnStateChanged.AddDynamic(this, &ALBEASTExperienceBase::HandleNarrativeStateChanged);
+			// Only Blueprint subclasses that implement the event need the name-based delegate;
+			// C++ subclasses register per-state handlers on the state machine instead
+			if (GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(ALBEASTExperienceBase, OnNarrativeStateChanged)))
+			{
+				NarrativeStateMachine->OnStateChanged.AddDynamic(this, &ALBEASTExperienceBase::HandleNarrativeStateChanged);
+			}
 			UE_LOG(LogTemp, Log, TEXT("LBEASTExperienceBase: Narrative state machine created"));
 		}
 	}
@@ -117,12 +140,18 @@ void ALBEASTExperienceBase::ShutdownExperienceImpl()
 		CommandProtocol->StopListening();
 	}
 
+	if (NarrativeStateMachine)
+	{
+		NarrativeStateMachine->UnbindStateHandlers(this);
+	}
+
 	// Base implementation - override in derived classes
 }
 
 void ALBEASTExperienceBase::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
+	LBEASTEXPERIENCES_SCOPE_CYCLE_COUNTER(STAT_LBEASTExperienceBase_Tick);
 
 	// Tick command protocol if listening (dedicated server mode)
 	if (CommandProtocol && CommandProtocol->IsListening())
@@ -136,6 +165,23 @@ ULBEASTInputAdapter* ALBEASTExperienceBase::GetInputAdapter() const
 	return InputAdapter;
 }
 
+bool ALBEASTExperienceBase::IsAIReady() const
+{
+	const UAIReadinessSubsystem* Readiness = UAIReadinessSubsystem::Get(this);
+	return !Readiness || Readiness->IsAIReady();
+}
+
+bool ALBEASTExperienceBase::IsReadyForGuests() const
+{
+	return bIsInitialized && (!bRequireAIReady || IsAIReady());
+}
+
+void ALBEASTExperienceBase::HandleAIReadyChanged(bool bAIReady)
+{
+	UE_LOG(LogTemp, Log, TEXT("LBEASTExperienceBase: AI %s"), bAIReady ? TEXT("ready") : TEXT("warming up"));
+	OnAIReadinessChanged(bAIReady);
+}
+
 void ALBEASTExperienceBase::InitializeCommandProtocol()
 {
 	UWorld* World = GetWorld();
@@ -184,13 +230,15 @@ void ALBEASTExperienceBase::OnCommandReceived(const FLBEASTServerCommandMessage&
 		}
 
 		// Build status JSON response
+		const TCHAR* ExperienceState = !bIsInitialized ? TEXT("Idle") : IsReadyForGuests() ? TEXT("Active") : TEXT("WarmingUp");
 		FString StatusData = FString::Printf(
-			TEXT("{\"IsRunning\":%s,\"IsInitialized\":%s,\"CurrentPlayers\":%d,\"MaxPlayers\":%d,\"ExperienceState\":\"%s\"}"),
+			TEXT("{\"IsRunning\":%s,\"IsInitialized\":%s,\"CurrentPlayers\":%d,\"MaxPlayers\":%d,\"ExperienceState\":\"%s\",\"AIReady\":%s}"),
 			bIsInitialized ? TEXT("true") : TEXT("false"),
 			bIsInitialized ? TEXT("true") : TEXT("false"),
 			CurrentPlayerCount,
 			GetMaxPlayers(),
-			bIsInitialized ? TEXT("Active") : TEXT("Idle")
+			ExperienceState,
+			IsAIReady() ? TEXT("true") : TEXT("false")
 		);
 
 		// Send response back to client
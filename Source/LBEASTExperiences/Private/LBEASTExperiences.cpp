@@ -4,6 +4,7 @@
 
 DEFINE_LOG_CATEGORY(LogGoKart);
 DEFINE_LOG_CATEGORY(LogSuperheroFlight);
+LBEAST_DEFINE_TRACE_CHANNEL(LBEASTExperiencesChannel);
 
 #define LOCTEXT_NAMESPACE "FLBEASTExperiencesModule"
 
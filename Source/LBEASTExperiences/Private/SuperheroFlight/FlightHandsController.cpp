@@ -13,6 +13,8 @@
 #include "HeadMountedDisplayTypes.h"
 #include "Features/IModularFeatures.h"
 
+DECLARE_CYCLE_STAT(TEXT("FlightHandsController Tick"), STAT_FlightHandsController_Tick, STATGROUP_LBEASTExperiences);
+
 UFlightHandsController::UFlightHandsController()
 {
 	PrimaryComponentTick.bCanEverTick = true;
@@ -36,6 +38,7 @@ void UFlightHandsController::BeginPlay()
 void UFlightHandsController::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	LBEASTEXPERIENCES_SCOPE_CYCLE_COUNTER(STAT_FlightHandsController_Tick);
 
 	if (PlayerController)
 	{
@@ -8,6 +8,8 @@
 #include "Engine/Canvas.h"
 #include "Kismet/GameplayStatics.h"
 
+DECLARE_CYCLE_STAT(TEXT("GestureDebugger Tick"), STAT_GestureDebugger_Tick, STATGROUP_LBEASTExperiences);
+
 UGestureDebugger::UGestureDebugger()
 {
 	PrimaryComponentTick.bCanEverTick = true;
@@ -28,6 +30,7 @@ void UGestureDebugger::BeginPlay()
 void UGestureDebugger::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	LBEASTEXPERIENCES_SCOPE_CYCLE_COUNTER(STAT_GestureDebugger_Tick);
 
 	if (bDebugEnabled && FlightHandsController)
 	{
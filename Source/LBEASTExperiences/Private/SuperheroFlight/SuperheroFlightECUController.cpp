@@ -4,6 +4,8 @@
 #include "LBEASTExperiences.h"
 #include "Networking/LBEASTUDPTransport.h"
 
+DECLARE_CYCLE_STAT(TEXT("SuperheroFlightECUController Tick"), STAT_SuperheroFlightECUController_Tick, STATGROUP_LBEASTExperiences);
+
 USuperheroFlightECUController::USuperheroFlightECUController()
 {
 	PrimaryComponentTick.bCanEverTick = true;
@@ -27,6 +29,7 @@ void USuperheroFlightECUController::BeginPlay()
 void USuperheroFlightECUController::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	LBEASTEXPERIENCES_SCOPE_CYCLE_COUNTER(STAT_SuperheroFlightECUController_Tick);
 
 	// Check for connection timeout
 	if (bECUConnected)
@@ -136,14 +139,16 @@ void USuperheroFlightECUController::SetPlaySessionActive(bool bActive)
 	if (UDPTransport)
 	{
 		UDPTransport->SendBool(9, bActive);
+		UDPTransport->SetTelemetrySessionActive(bActive);
 	}
 }
 
 void USuperheroFlightECUController::EmergencyStop()
 {
+	// Channel 7 on the acknowledged safety lane (winches must stop even if telemetry is saturating the link)
 	if (UDPTransport)
 	{
-		UDPTransport->SendBool(7, true);
+		UDPTransport->SendSafetyBool(7, true);
 	}
 }
 
@@ -10,6 +10,8 @@
 #include "Engine/World.h"
 #include "Engine/GameInstance.h"
 
+DECLARE_CYCLE_STAT(TEXT("SuperheroFlightExperience Tick"), STAT_SuperheroFlightExperience_Tick, STATGROUP_LBEASTExperiences);
+
 ASuperheroFlightExperience::ASuperheroFlightExperience()
 {
 	PrimaryActorTick.bCanEverTick = true;
@@ -120,6 +122,7 @@ void ASuperheroFlightExperience::ShutdownExperienceImpl()
 void ASuperheroFlightExperience::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
+	LBEASTEXPERIENCES_SCOPE_CYCLE_COUNTER(STAT_SuperheroFlightExperience_Tick);
 
 	if (!bIsInitialized)
 	{
@@ -14,6 +14,9 @@ class UAIFacemaskScriptManager;
 class UAIFacemaskImprovManager;
 class UAIFacemaskASRManager;
 
+/** Native event: held state of the wrist forward/backward buttons changed (either wrist) */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnAIFacemaskWristButtonsChanged, bool /*bForwardPressed*/, bool /*bBackwardPressed*/);
+
 /**
  * AI Facemask Experience Template
  * 
@@ -142,6 +145,9 @@ public:
 
 	virtual int32 GetMaxPlayers() const override { return NumberOfLiveActors + NumberOfPlayers; }
 
+	/** Fired on press and release of the wrist buttons (HUD arrow feedback) */
+	FOnAIFacemaskWristButtonsChanged OnWristButtonsChanged;
+
 protected:
 	virtual bool InitializeExperienceImpl() override;
 	virtual void ShutdownExperienceImpl() override;
@@ -176,14 +182,6 @@ private:
 	 */
 	bool RetreatExperienceInternal();
 
-	/**
-	 * Handle narrative state changes (implements base class BlueprintImplementableEvent)
-	 * Called when live actor advances/retreats narrative state via wireless trigger buttons
-	 * Each state change triggers automated AI facemask performances
-	 * Override in Blueprint to trigger game events based on state changes
-	 */
-	void OnNarrativeStateChanged(FName OldState, FName NewState, int32 NewStateIndex);
-
 	/** Handle server discovery (auto-connect) */
 	UFUNCTION()
 	void OnServerDiscovered(const FLBEASTServerInfo& ServerInfo);
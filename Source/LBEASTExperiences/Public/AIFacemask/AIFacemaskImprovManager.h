@@ -95,6 +95,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "LBEAST|AIFacemask Improv")
 	void MarkCurrentResponseAsSpoken();
 
+	/** Native event: current response text, usage state or generating flag changed (HUD refresh) */
+	FSimpleMulticastDelegate OnResponseStateChanged;
+
 	/**
 	 * Phase 11: Notify of narrative state change (for transition buffering)
 	 */
@@ -111,6 +114,8 @@ protected:
 	virtual void RequestAudio2FaceConversion(const FString& AudioFilePath) override;
 	virtual void OnTTSConversionComplete(const FString& AudioFilePath, const TArray<uint8>& AudioData) override;
 	virtual void OnAudio2FaceConversionComplete(bool bSuccess) override;
+	virtual FString GetTransitionContextForState(FName TargetState) const override;
+	virtual FString GetWarmupVoiceName() const override { return GetVoiceNameString(FacemaskImprovConfig.VoiceType); }
 
 	/**
 	 * Convert voice type enum to voice name string for TTS
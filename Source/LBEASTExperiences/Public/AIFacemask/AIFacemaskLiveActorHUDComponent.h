@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Components/WidgetComponent.h"
+#include "AIFacemaskScript.h"
 #include "AIFacemaskLiveActorHUDComponent.generated.h"
 
 // Forward declarations
@@ -12,6 +13,7 @@ class UAIFacemaskLiveActorHUD;
 class UAIFacemaskScriptManager;
 class UAIFacemaskImprovManager;
 class UCameraComponent;
+class UTextBlock;
 
 /**
  * Live Actor HUD Component
@@ -29,6 +31,12 @@ class UCameraComponent;
  * - Automatically created by AAIFacemaskExperience for live actor pawns
  * - Finds ScriptManager and ImprovManager on the same actor
  * - Subscribes to state change events for real-time updates
+ *
+ * UPDATES:
+ * - Event-driven: script line, improv response, narrative state and wrist button events
+ *   mark the affected elements dirty; nothing is read or pushed on frames without events
+ * - Dirty elements are flushed at most MaxUpdateRateHz times per second, and a widget is
+ *   only touched when its text, color or visibility actually differs from what it shows
  */
 UCLASS(ClassGroup=(LBEAST), meta=(BlueprintSpawnableComponent))
 class LBEASTEXPERIENCES_API UAIFacemaskLiveActorHUDComponent : public UActorComponent
@@ -48,7 +56,7 @@ public:
 	bool InitializeHUD(UAIFacemaskScriptManager* InScriptManager, UAIFacemaskImprovManager* InImprovManager);
 
 	/**
-	 * Update HUD display (called by managers when state changes)
+	 * Refresh every HUD element now (events normally keep it current)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "LBEAST|AIFacemask HUD")
 	void UpdateHUDDisplay();
@@ -71,20 +79,32 @@ protected:
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 private:
+	/** What a text block currently shows (widget calls are skipped when nothing differs) */
+	struct FHUDLineCache
+	{
+		FString Text;
+		bool bSpoken = false;
+		bool bValid = false;
+	};
+
 	/** Create widget component and attach to camera */
 	void CreateWidgetComponent();
 
 	/** Create all widget elements procedurally (called after widget is created) */
 	void CreateWidgetElements();
 
-	/** Update text display with proper ordering and state-based colors */
-	void UpdateTextDisplay(
-		const FString& CurrentImprovResponse,
-		bool bImprovResponseSpoken,
-		const FString& CurrentNarrativeTargetSentence,
-		bool bNarrativeTargetSpoken,
-		const FString& BufferedTransitionText,
-		bool bTransitionSpoken);
+	/** Subscribe to manager, state machine and button events */
+	void BindEvents();
+	void UnbindEvents();
+
+	/** Flag elements for the next flush and wake the (throttled) tick */
+	void MarkDirty(uint8 Flags);
+
+	/** Read and push only the elements in DirtyMask */
+	void FlushDirty();
+
+	/** Update one text block with state-based color; hidden when the text is empty */
+	void UpdateTextLine(UTextBlock* TextBlock, const FString& Text, bool bSpoken, FHUDLineCache& Cache);
 
 	/** Update arrow button visual feedback */
 	void UpdateArrowButtons(bool bForwardPressed, bool bBackwardPressed);
@@ -101,8 +121,20 @@ private:
 	/** Get current state from ImprovManager */
 	void GetCurrentStateFromImprovManager(FString& OutImprovResponse, bool& OutbImprovResponseSpoken, FString& OutBufferedTransition, bool& OutbTransitionSpoken) const;
 
-	/** Get button press states (from embedded system or VR controllers) */
-	void GetButtonPressStates(bool& OutbForwardPressed, bool& OutbBackwardPressed) const;
+	// Event handlers (all just mark elements dirty)
+	UFUNCTION()
+	void HandleScriptStarted(FName StateName, const FAIFacemaskScript& Script);
+
+	UFUNCTION()
+	void HandleScriptLineStarted(FName StateName, int32 LineIndex, const FAIFacemaskScriptLine& ScriptLine);
+
+	UFUNCTION()
+	void HandleScriptFinished(FName StateName, const FAIFacemaskScript& Script);
+
+	void HandleNarrativeStateEntered(int32 OldStateIndex, int32 NewStateIndex);
+
+	void HandleImprovResponseStateChanged();
+	void HandleWristButtonsChanged(bool bForwardPressed, bool bBackwardPressed);
 
 	/** Widget component attached to camera for stereo rendering */
 	UPROPERTY()
@@ -126,6 +158,27 @@ private:
 	/** Whether component is initialized */
 	bool bIsInitialized = false;
 
+	/** Elements waiting for the next flush */
+	uint8 DirtyMask = 0;
+
+	/** Last wrist button states reported by the experience */
+	bool bForwardButtonPressed = false;
+	bool bBackwardButtonPressed = false;
+
+	/** What each element currently shows */
+	FHUDLineCache NarrativeCache;
+	FHUDLineCache ImprovCache;
+	FHUDLineCache TransitionCache;
+	FName ShownStateName = NAME_None;
+	int32 ShownStateIndex = INDEX_NONE;
+	bool bShownForwardPressed = false;
+	bool bShownBackwardPressed = false;
+	bool bArrowsValid = false;
+
+	FDelegateHandle ImprovStateHandle;
+	FDelegateHandle NarrativeStateHandle;
+	FDelegateHandle WristButtonsHandle;
+
 	/** Widget class to instantiate */
 	UPROPERTY(EditAnywhere, Category = "LBEAST|AIFacemask HUD")
 	TSubclassOf<UAIFacemaskLiveActorHUD> HUDWidgetClass;
@@ -138,5 +191,8 @@ public:
 	/** Distance from camera/face for widget rendering (in world units) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|AIFacemask HUD", meta = (ClampMin = "0.1", ClampMax = "10.0"))
 	float FaceDistance = 2.0f;
-};
 
+	/** Upper bound on HUD refreshes per second while events are arriving (static frames cost nothing) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|AIFacemask HUD", meta = (ClampMin = "1.0", ClampMax = "120.0"))
+	float MaxUpdateRateHz = 30.0f;
+};
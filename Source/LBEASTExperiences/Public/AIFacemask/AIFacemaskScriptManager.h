@@ -9,6 +9,9 @@
 
 // Forward declarations
 class UAIFacemaskFaceController;
+class UAIFacemaskImprovManager;
+class UExperienceStateMachine;
+class FAIFacemaskScriptClock;
 
 /**
  * Delegate for script playback events (facemask-specific)
@@ -30,6 +33,15 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAIFacemaskScriptPreBakeComplete,
  * - Facemask-specific script structures (FAIFacemaskScript)
  * - Face controller integration
  * - Experience-specific delegates
+ *
+ * LINE TIMING:
+ * Line boundaries are scheduled on the audio render clock rather than accumulated from frame
+ * DeltaTime. Each line ends at its start time plus the exact pre-baked audio length, and the next
+ * line starts at that boundary, so long scripts do not drift. The audio thread stamps each
+ * boundary as its buffer is rendered; the game thread consumes them in TickComponent and fires
+ * OnScriptLineStarted. Listeners that need tighter sync (lighting fades, face animation) can
+ * offset by GetScriptClockSeconds() - GetCurrentLineStartClock().
+ * Without an audio device (dedicated server, -nosound) platform time is used instead.
  */
 UCLASS(ClassGroup=(LBEAST), meta=(BlueprintSpawnableComponent))
 class LBEASTEXPERIENCES_API UAIFacemaskScriptManager : public UAIScriptManager
@@ -112,7 +124,8 @@ public:
 	FAIFacemaskScript GetScriptForState(FName StateName) const;
 
 	/**
-	 * Handle narrative state change (called by experience base)
+	 * Handle narrative state change by name (for Blueprint-driven flows)
+	 * C++ experiences should call BindToStateMachine() once instead.
 	 * @param OldState - Previous state name
 	 * @param NewState - New state name
 	 * @param NewStateIndex - Index of new state
@@ -120,8 +133,25 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "LBEAST|AIFacemask Script")
 	void HandleNarrativeStateChanged(FName OldState, FName NewState, int32 NewStateIndex);
 
+	/**
+	 * Register state-entry handlers on a state machine
+	 * Only states that have a script get a trigger handler, so transitions into script-less states cost
+	 * nothing here. The improv manager is looked up once and notified on every transition.
+	 * Call again after the state list or ScriptCollection changes; pass null to unbind.
+	 */
+	void BindToStateMachine(UExperienceStateMachine* StateMachine);
+
+	/** Current time on the script clock (audio render clock when audio is available), seconds */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|AIFacemask Script")
+	double GetScriptClockSeconds() const;
+
+	/** Script clock time at which the current line started (the scheduled boundary, not the tick that noticed it) */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|AIFacemask Script")
+	double GetCurrentLineStartClock() const { return CurrentLineStartClock; }
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	// Override generic base class protected methods
@@ -129,17 +159,27 @@ protected:
 	virtual void RequestScriptPreBake(FName ScriptID) override;
 
 private:
-	/** Timer for script playback */
-	float ScriptPlaybackTimer = 0.0f;
+	/** Line boundary scheduler (registered on the main submix when an audio device exists) */
+	TSharedPtr<FAIFacemaskScriptClock> ScriptClock;
+
+	/** Script clock time the current line started */
+	double CurrentLineStartClock = 0.0;
 
-	/** Current script line start time */
-	float CurrentScriptLineStartTime = 0.0f;
+	/** Boundary the next StartScriptLine() should start from (negative = now) */
+	double PendingLineStartClock = -1.0;
 
 	/** Whether we're waiting for script start delay */
 	bool bWaitingForStartDelay = false;
 
-	/** Start delay timer */
-	float StartDelayTimer = 0.0f;
+	/** Create the script clock and attach it to the audio device */
+	void StartScriptClock();
+	void StopScriptClock();
+
+	/** Playback length of a line of the current script (prefers pre-bake results in the collection) */
+	double GetLineDuration(int32 LineIndex) const;
+
+	/** Consume line boundaries queued by the script clock */
+	void DispatchLineBoundaries();
 
 	/**
 	 * Start playing a script line
@@ -169,13 +209,26 @@ private:
 	/**
 	 * Request TTS conversion for a script line
 	 */
-	void RequestTTSConversion(const FAIFacemaskScriptLine& ScriptLine, TFunction<void(const FString& AudioFilePath, float Duration)> Callback);
+	void RequestTTSConversion(const FAIFacemaskScriptLine& ScriptLine, TFunction<void(const FString& AudioFilePath, float Duration, int64 SampleCount, int32 SampleRate)> Callback);
 
 	/**
 	 * Request Audio2Face conversion for a script line
 	 */
 	void RequestAudio2FaceConversion(const FAIFacemaskScriptLine& ScriptLine, const FString& AudioFilePath, TFunction<void(bool bSuccess)> Callback);
 
+	/** State machine the handlers are registered on */
+	TWeakObjectPtr<UExperienceStateMachine> BoundStateMachine;
+
+	/** Improv manager on the same actor (cached at bind time) */
+	UPROPERTY()
+	TObjectPtr<UAIFacemaskImprovManager> BoundImprovManager;
+
+	/** Entered a state that has a script (StateName bound per handler) */
+	void HandleScriptStateEntered(int32 OldStateIndex, int32 NewStateIndex, FName StateName);
+
+	/** Any transition: forward to the improv manager for transition buffering */
+	void HandleImprovStateEntered(int32 OldStateIndex, int32 NewStateIndex);
+
 	/** Reference to AIFacemaskFaceController for streaming facial animation */
 	UPROPERTY()
 	TObjectPtr<UAIFacemaskFaceController> FaceController;
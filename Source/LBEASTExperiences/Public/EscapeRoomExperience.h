@@ -8,6 +8,8 @@
 
 // Forward declarations
 class UEmbeddedDeviceController;
+class UEscapeRoomPropOrchestrator;
+struct FLBEASTShowCue;
 
 /**
  * Escape Room Experience Template
@@ -47,6 +49,10 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LBEAST|Escape Room|Components")
 	TObjectPtr<UEmbeddedDeviceController> PropController;
 
+	/** Batches door/prop commands per device per frame (DoorController and PropController are registered with it) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LBEAST|Escape Room|Components")
+	TObjectPtr<UEscapeRoomPropOrchestrator> PropOrchestrator;
+
 	/** Number of doors/locks in this escape room */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Escape Room|Config", meta = (ClampMin = "1", ClampMax = "16"))
 	int32 NumberOfDoors = 4;
@@ -59,12 +65,17 @@ public:
 	 * Mapping of narrative states to door indices for automatic unlocking
 	 * When a state is reached, the corresponding door will be automatically unlocked.
 	 * Leave empty to disable automatic unlocking, or override OnNarrativeStateChanged for custom logic.
+	 * Resolved to per-state handlers at initialization - call RebindStateDoors() after editing it at runtime.
 	 * 
 	 * Example: Map "Puzzle1" state to door 0, "Puzzle2" to door 1, etc.
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Escape Room|Config|Narrative")
 	TMap<FName, int32> StateToDoorMapping;
 
+	/** Show-control track the props answer to (Action cues: TargetIndex = prop, Value = action). None = not registered. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Escape Room|Config|Show Control")
+	FName PropShowTrackName = FName("Props");
+
 	/**
 	 * Unlock a door by index
 	 * Sends unlock command to embedded device via wireless communication
@@ -106,6 +117,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "LBEAST|Escape Room|Props")
 	bool TriggerPropAction(int32 PropIndex, float ActionValue = 1.0f);
 
+	/**
+	 * Activate several props so they move together
+	 * One packet per device, all held until a shared fire time (see UEscapeRoomPropOrchestrator::GroupLeadMs)
+	 * 
+	 * @param PropIndices - Props to activate (0-based)
+	 * @param ActionValue - Action value applied to every prop (0.0-1.0)
+	 * @return Number of props the command was queued for
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|Escape Room|Props")
+	int32 TriggerPropGroup(const TArray<int32>& PropIndices, float ActionValue = 1.0f);
+
 	/**
 	 * Read sensor value from a prop
 	 * Reads analog/digital sensor state from embedded device
@@ -140,11 +162,14 @@ protected:
 	virtual void ShutdownExperienceImpl() override;
 
 	/**
-	 * Handle narrative state changes and unlock doors based on puzzle completion
-	 * This implements the BlueprintImplementableEvent from the base class
-	 * Note: No UFUNCTION macro needed - inherits from base class declaration
+	 * Register a state-entry handler for every StateToDoorMapping entry
+	 * Names are resolved to state indices here, once; a transition then only runs its own door handler.
 	 */
-	void OnNarrativeStateChanged(FName OldState, FName NewState, int32 NewStateIndex);
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|Escape Room|Narrative")
+	void RebindStateDoors();
+
+	/** Unlock DoorIndex when its mapped state is entered (bound per state by RebindStateDoors) */
+	void HandleDoorStateEntered(int32 OldStateIndex, int32 NewStateIndex, int32 DoorIndex);
 
 	/**
 	 * Initialize embedded device controllers for doors and props
@@ -170,6 +195,12 @@ protected:
 	UFUNCTION()
 	void OnPropSensorValue(int32 Channel, float Value);
 
+	/** Show-control track handler for prop cues (game thread) */
+	void ExecutePropShowCue(const FLBEASTShowCue& Cue, double LateSeconds);
+
+	/** Name the track was actually registered under (PropShowTrackName, or PropShowTrackName_N if another instance holds it) */
+	FName RegisteredShowTrackName;
+
 	/** Track door unlock states (cached from embedded devices) */
 	UPROPERTY()
 	TArray<bool> DoorUnlockStates;
@@ -177,5 +208,9 @@ protected:
 	/** Track prop sensor values (cached from embedded devices) */
 	UPROPERTY()
 	TArray<float> PropSensorValues;
+
+	/** Orchestrator device indices for DoorController / PropController */
+	int32 DoorDeviceIndex = INDEX_NONE;
+	int32 PropDeviceIndex = INDEX_NONE;
 };
 
@@ -0,0 +1,137 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "EscapeRoomPropOrchestrator.generated.h"
+
+class UEmbeddedDeviceController;
+
+/**
+ * Where a prop lives: which registered device and which channel on it
+ */
+USTRUCT(BlueprintType)
+struct LBEASTEXPERIENCES_API FEscapeRoomPropBinding
+{
+	GENERATED_BODY()
+
+	/** Index returned by UEscapeRoomPropOrchestrator::RegisterDevice() */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Escape Room|Props")
+	int32 DeviceIndex = 0;
+
+	/** Output/input channel on that device */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Escape Room|Props")
+	int32 Channel = 0;
+};
+
+/**
+ * Escape Room Prop Orchestrator
+ *
+ * Fans prop and door commands out to any number of embedded devices without one packet per command.
+ *
+ * - Commands are queued on their device and flushed once per frame (TG_PostUpdateWork), so a puzzle
+ *   solve that moves ten props on one controller costs one datagram instead of ten.
+ * - Group triggers share one target fire time. The firmware has no synced clock, so each device
+ *   gets a relative hold delay: the time left until the target at flush, minus that device's
+ *   one-way latency estimated as half its median RTT (measured from safety lane ACKs). Props on
+ *   different controllers land together to within the asymmetry and jitter of their links; a
+ *   device with no RTT measured yet is assumed to have zero latency and fires late by its
+ *   actual delivery time.
+ * - Sensor reads come from the values the devices push (cached on receipt), never from a poll.
+ *
+ * The component only ticks on frames where something was queued.
+ */
+UCLASS(ClassGroup=(LBEAST), meta=(BlueprintSpawnableComponent))
+class LBEASTEXPERIENCES_API UEscapeRoomPropOrchestrator : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UEscapeRoomPropOrchestrator();
+
+	/** Prop index -> device/channel */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Escape Room|Props")
+	TArray<FEscapeRoomPropBinding> PropBindings;
+
+	/**
+	 * Lead time for group triggers (ms)
+	 * Must cover one-way delivery to every device (per-device hold delays are shortened by it),
+	 * otherwise the slowest device fires late.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Escape Room|Props", meta = (ClampMin = "0", ClampMax = "1000"))
+	int32 GroupLeadMs = 30;
+
+	/**
+	 * Add a device to fan out to
+	 * @return Device index for FEscapeRoomPropBinding / QueueDevice*() (INDEX_NONE if Device is null)
+	 */
+	int32 RegisterDevice(UEmbeddedDeviceController* Device);
+
+	/** Forget all devices (queued commands are dropped) */
+	void ClearDevices();
+
+	/** Queue an analog/position command for a prop (sent at end of frame) */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|Escape Room|Props")
+	bool QueuePropFloat(int32 PropIndex, float Value);
+
+	/** Queue an on/off command for a prop (sent at end of frame) */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|Escape Room|Props")
+	bool QueuePropBool(int32 PropIndex, bool Value);
+
+	/** Queue a float command by device/channel (for outputs that are not props, e.g. lights on a prop board) */
+	bool QueueDeviceFloat(int32 DeviceIndex, int32 Channel, float Value);
+
+	/** Queue a bool command by device/channel (door locks) */
+	bool QueueDeviceBool(int32 DeviceIndex, int32 Channel, bool Value);
+
+	/**
+	 * Fire several props together
+	 * Every device involved gets one batch this frame, held so that it fires at now + GroupLeadMs
+	 * after its own estimated delivery time.
+	 * Other commands queued on those devices this frame ride along in the same batch.
+	 * @return Number of props queued
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|Escape Room|Props")
+	int32 TriggerPropGroup(const TArray<int32>& PropIndices, float Value);
+
+	/** Send everything queued so far now instead of waiting for the end of the frame */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|Escape Room|Props")
+	void Flush();
+
+	/** Latest value the prop's device pushed for its channel (0 if none yet) */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|Escape Room|Props")
+	float GetPropSensor(int32 PropIndex) const;
+
+	/** Packets sent by the last flush (all devices) */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|Escape Room|Props")
+	int32 GetLastFlushPacketCount() const { return LastFlushPackets; }
+
+protected:
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+private:
+	/** Registered devices (index = device index) */
+	UPROPERTY()
+	TArray<TObjectPtr<UEmbeddedDeviceController>> Devices;
+
+	/** Per device: shared fire time for this frame's batch (platform seconds, 0 = apply on receipt) */
+	TArray<double> DeviceFireAt;
+
+	/** Per device: group id carried with this frame's batch (0 = ungrouped) */
+	TArray<uint8> DeviceGroupId;
+
+	/** Group ids wrap within 1..255 so 0 stays "ungrouped" */
+	uint8 NextGroupId = 1;
+
+	int32 LastFlushPackets = 0;
+
+	/** Resolve a prop to a connected device (null if unbound or disconnected) */
+	UEmbeddedDeviceController* ResolveProp(int32 PropIndex, int32& OutDeviceIndex, int32& OutChannel) const;
+
+	/** Resolve a device index to a connected device */
+	UEmbeddedDeviceController* ResolveDevice(int32 DeviceIndex) const;
+
+	/** Make sure the end-of-frame flush runs */
+	void ScheduleFlush();
+};
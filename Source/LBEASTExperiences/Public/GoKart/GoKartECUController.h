@@ -7,6 +7,7 @@
 #include "Networking/LBEASTUDPTransport.h"
 #include "GoKart/Models/GoKartButtonEvents.h"
 #include "GoKart/Models/GoKartThrottleState.h"
+#include "GoKart/Models/GoKartThrottleEnvelope.h"
 #include "GoKartECUController.generated.h"
 
 /**
@@ -24,6 +25,14 @@
  * Communication Protocol:
  * - Server → ECU: Throttle commands, game state
  * - ECU → Server: Button events, throttle feedback, vehicle telemetry
+ *
+ * Throttle effects are sent as envelopes (FGoKartThrottleEnvelope) that the ECU runs on its own
+ * clock, so ramps and effect ends are not quantized to server frames or delayed by the network.
+ * A clock-sync handshake on Channel 102 keeps an estimate of the ECU clock: each exchange
+ * gives a round trip and an offset, and the offset from the lowest-RTT recent sample is used
+ * (queueing delay only ever adds to RTT, so the fastest exchange is the most symmetric one).
+ * Envelopes are stamped to start EnvelopeLeadMs after sending, so every effect starts a fixed
+ * delay after the game event regardless of jitter. Until the first sync they start on receipt.
  */
 UCLASS(ClassGroup=(LBEAST), meta=(BlueprintSpawnableComponent))
 class LBEASTEXPERIENCES_API UGoKartECUController : public UActorComponent
@@ -73,6 +82,41 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "LBEAST|GoKart|ECU|Throttle")
 	void SendThrottleState(const FGoKartThrottleState& ThrottleState);
 
+	/**
+	 * Send a throttle effect envelope (Channel 101), replacing any effect running on the ECU
+	 * StartAtMs and EffectId are filled in here.
+	 * @return Effect id assigned to the envelope
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|GoKart|ECU|Throttle")
+	int32 SendThrottleEnvelope(FGoKartThrottleEnvelope Envelope);
+
+	/** Delay between sending an envelope and the ECU starting it (ms) - must cover network delivery */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|GoKart|ECU|Throttle", meta = (ClampMin = "0", ClampMax = "500"))
+	int32 EnvelopeLeadMs = 20;
+
+	// =====================================
+	// Clock Sync
+	// =====================================
+
+	/** Seconds between clock-sync exchanges once synced (crystal drift is well under 1 ms over this) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|GoKart|ECU|Clock Sync", meta = (ClampMin = "0.5"))
+	float ClockSyncIntervalSeconds = 5.0f;
+
+	/** Send a clock-sync request now (also sent automatically) */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|GoKart|ECU|Clock Sync")
+	void RequestClockSync();
+
+	/** Whether an ECU clock offset estimate exists */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|GoKart|ECU|Clock Sync")
+	bool IsClockSynced() const { return ClockSamples.Num() > 0; }
+
+	/** Round trip of the sample the offset comes from (ms, -1 if not synced) */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|GoKart|ECU|Clock Sync")
+	float GetClockSyncRoundTripMs() const;
+
+	/** ECU clock (ms since boot, wrapped like the ECU's) at a platform time in seconds */
+	int32 PlatformSecondsToECUMs(double PlatformSeconds) const;
+
 	// =====================================
 	// Game State (Server → ECU)
 	// =====================================
@@ -139,5 +183,51 @@ private:
 
 	/** Process received UDP data */
 	void ProcessReceivedData(const TArray<uint8>& Data);
+
+	/** Handle bytes received from UDP transport (clock-sync replies) */
+	UFUNCTION()
+	void OnBytesReceived(int32 Channel, TArray<uint8> Data);
+
+	/** One completed clock-sync exchange */
+	struct FClockSample
+	{
+		double OffsetMs = 0.0;	// ECU ms - platform ms
+		double RoundTripMs = 0.0;
+	};
+
+	static constexpr int32 CLOCK_REQUEST_RING = 8;
+	static constexpr int32 CLOCK_SAMPLE_WINDOW = 8;
+
+	/** Requests sent at burst spacing until this many samples exist */
+	static constexpr int32 CLOCK_SYNC_BURST = 4;
+
+	/** Spacing of burst requests while every request is answered (s); doubles per unanswered request, up to ClockSyncIntervalSeconds */
+	static constexpr double CLOCK_SYNC_BURST_SPACING_SECONDS = 0.25;
+
+	/** Unanswered requests in a row after which the ECU is reported as not answering (once) */
+	static constexpr int32 CLOCK_SYNC_UNANSWERED_WARNING = 8;
+
+	/** Recent samples (oldest first, at most CLOCK_SAMPLE_WINDOW) */
+	TArray<FClockSample> ClockSamples;
+
+	/** Index into ClockSamples of the lowest-RTT sample */
+	int32 BestClockSample = INDEX_NONE;
+
+	/** Send time of each outstanding request, by sequence % CLOCK_REQUEST_RING */
+	double ClockRequestSentAt[CLOCK_REQUEST_RING] = {};
+	int32 ClockRequestSequence[CLOCK_REQUEST_RING] = {};
+
+	int32 NextClockSequence = 1;
+	double LastClockSyncRequest = 0.0;
+
+	/** Requests sent since the last valid reply (drives the burst back-off) */
+	int32 ClockRequestsUnanswered = 0;
+
+	/** Seconds to wait after the last request before sending the next one */
+	double GetClockSyncSpacingSeconds() const;
+
+	int32 NextEffectId = 1;
+
+	void HandleClockSyncReply(const FGoKartClockSyncReply& Reply);
 };
 
@@ -97,6 +97,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "LBEAST|GoKart|Throttle")
 	void ApplyThrottleEffect(float Multiplier, float Duration = 0.0f);
 
+	/**
+	 * Apply a ramped throttle effect, timed entirely by the ECU
+	 * The whole effect is sent once; the ECU ramps, holds and releases it on its own clock.
+	 * @param Multiplier - Target multiplier (1.0 = normal, >1.0 = boost, <1.0 = reduction)
+	 * @param RampInSeconds - Ramp from the current multiplier to the target
+	 * @param Duration - Hold at the target after the ramp (0 = until reset or replaced)
+	 * @param RampOutSeconds - Ramp back to normal after the hold
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|GoKart|Throttle")
+	void ApplyThrottleEnvelope(float Multiplier, float RampInSeconds, float Duration, float RampOutSeconds);
+
 	/**
 	 * Reset throttle to normal (1.0 multiplier)
 	 */
@@ -117,12 +128,9 @@ protected:
 	virtual void Tick(float DeltaTime) override;
 
 private:
-	/** Current throttle multiplier effect */
+	/** Target of the last throttle effect sent (the ECU ends timed effects itself; VehicleState has the live value) */
 	float CurrentThrottleMultiplier = 1.0f;
 
-	/** Throttle effect duration timer */
-	float ThrottleEffectTimer = 0.0f;
-
 	/** Update vehicle state from ECU and tracking */
 	void UpdateVehicleState(float DeltaTime);
 
@@ -0,0 +1,63 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GoKartThrottleEnvelope.generated.h"
+
+/**
+ * GoKart throttle effect envelope
+ *
+ * A complete boost/slow effect, sent once and run by the ECU on its own clock:
+ * ramp from the current multiplier to TargetMultiplier over RampInMs, hold for HoldMs,
+ * then ramp back to 1.0 over RampOutMs. A newer envelope replaces the running one,
+ * starting from whatever multiplier the kart is at when it takes effect.
+ *
+ * Sent on Channel 101 as raw bytes - keep members 4-byte primitives so the layout matches the firmware.
+ */
+USTRUCT(BlueprintType)
+struct LBEASTEXPERIENCES_API FGoKartThrottleEnvelope
+{
+	GENERATED_BODY()
+
+	/** Multiplier reached at the end of the ramp-in (0.0-2.0, 1.0 = normal) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GoKart|Throttle")
+	float TargetMultiplier = 1.0f;
+
+	/** Ramp from the current multiplier to the target (ms, 0 = step) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GoKart|Throttle")
+	int32 RampInMs = 0;
+
+	/** Time held at the target after the ramp-in (ms, 0 = until replaced) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GoKart|Throttle")
+	int32 HoldMs = 0;
+
+	/** Ramp back to 1.0 after the hold (ms, 0 = step) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GoKart|Throttle")
+	int32 RampOutMs = 0;
+
+	/** ECU clock time to start at (ms since ECU boot, wraps as uint32; 0 = on receipt). Filled in by UGoKartECUController. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GoKart|Throttle")
+	int32 StartAtMs = 0;
+
+	/** Increasing per effect; the ECU drops duplicates and late copies of older effects. Filled in by UGoKartECUController. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GoKart|Throttle")
+	int32 EffectId = 0;
+};
+
+/**
+ * ECU reply to a clock-sync request (sent back on Channel 102, like a safety ACK)
+ */
+USTRUCT()
+struct LBEASTEXPERIENCES_API FGoKartClockSyncReply
+{
+	GENERATED_BODY()
+
+	/** Sequence from the request (Channel 102) */
+	UPROPERTY()
+	int32 Sequence = 0;
+
+	/** ECU clock when the reply was sent (ms since boot, wraps as uint32) */
+	UPROPERTY()
+	int32 ECUTimeMs = 0;
+};
@@ -88,6 +88,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "LBEAST|Gunship")
 	void EmergencyStop();
 
+	/**
+	 * Enable or disable the guns for a play session (Channel 9).
+	 * Also raises the ECU's button and gun telemetry rates for play and lowers them when idle.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|Gunship")
+	void SetPlaySessionActive(bool bActive);
+
 	virtual int32 GetMaxPlayers() const override { return 4; }
 
 protected:
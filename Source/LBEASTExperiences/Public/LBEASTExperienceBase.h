@@ -134,6 +134,13 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Experience|Narrative")
 	bool bUseNarrativeStateMachine = false;
 
+	/**
+	 * Hold IsReadyForGuests() until the AI providers are warmed up (UAIReadinessSubsystem)
+	 * Enable for experiences whose first interaction is AI-driven.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Experience|AI")
+	bool bRequireAIReady = false;
+
 	/**
 	 * Initialize the experience
 	 * Called automatically if bAutoInitialize is true, or manually by developer
@@ -160,6 +167,30 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|Experience")
 	virtual int32 GetMaxPlayers() const { return 1; }
 
+	// ========================================
+	// AI READINESS
+	// ========================================
+
+	/**
+	 * Whether every registered AI provider has been warmed up
+	 * @return true when no AI providers are registered
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|Experience|AI")
+	bool IsAIReady() const;
+
+	/**
+	 * Whether guests can be admitted: initialized, and AI warm if bRequireAIReady
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|Experience")
+	bool IsReadyForGuests() const;
+
+	/**
+	 * Event fired when the AI ready gate opens or closes
+	 * Override in Blueprint or C++ to hold the intro until models are hot
+	 */
+	UFUNCTION(BlueprintImplementableEvent, Category = "LBEAST|Experience|AI")
+	void OnAIReadinessChanged(bool bAIReady);
+
 	// ========================================
 	// NARRATIVE STATE MACHINE API
 	// ========================================
@@ -202,7 +233,8 @@ public:
 
 	/**
 	 * Event fired when narrative state changes
-	 * Override in Blueprint or C++ to handle state transitions
+	 * Override in Blueprint to handle state transitions. C++ subclasses should bind
+	 * per-state handlers with NarrativeStateMachine->BindStateEntered() instead.
 	 * 
 	 * @param OldState - Previous state name
 	 * @param NewState - New state name
@@ -254,5 +286,11 @@ protected:
 	 */
 	UFUNCTION()
 	void HandleNarrativeStateChanged(FName OldState, FName NewState, int32 NewStateIndex);
+
+	/**
+	 * Internal handler for the AI ready gate (binds to UAIReadinessSubsystem delegate)
+	 */
+	UFUNCTION()
+	void HandleAIReadyChanged(bool bAIReady);
 };
 
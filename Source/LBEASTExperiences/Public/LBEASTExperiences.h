@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "LBEASTStats.h"
 
 /**
  * LBEAST Experiences Module
@@ -23,6 +24,14 @@
 DECLARE_LOG_CATEGORY_EXTERN(LogGoKart, Log, All);
 DECLARE_LOG_CATEGORY_EXTERN(LogSuperheroFlight, Log, All);
 
+/** Stats group ("stat LBEASTExperiences") and Unreal Insights channel for this module (see LBEASTStats.h) */
+DECLARE_STATS_GROUP(TEXT("LBEAST Experiences"), STATGROUP_LBEASTExperiences, STATCAT_Advanced);
+LBEAST_DECLARE_TRACE_CHANNEL(LBEASTExperiencesChannel, LBEASTEXPERIENCES_API);
+
+#define LBEASTEXPERIENCES_SCOPE_CYCLE_COUNTER(StatId) LBEAST_SCOPE_CYCLE_COUNTER(StatId, "Experiences", LBEASTExperiencesChannel)
+#define LBEASTEXPERIENCES_INC_COUNTER(StatId, Amount) LBEAST_INC_COUNTER(StatId, "Experiences", Amount)
+#define LBEASTEXPERIENCES_SET_GAUGE(StatId, Value) LBEAST_SET_GAUGE(StatId, "Experiences", Value)
+
 class FLBEASTExperiencesModule : public IModuleInterface
 {
 public:
@@ -4,6 +4,9 @@
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
 #include "HOTASInputMappingContext.h"
+#include "LargeHaptics.h"
+
+DECLARE_CYCLE_STAT(TEXT("2DOFGyroPlatformController Tick"), STAT_2DOFGyroPlatformController_Tick, STATGROUP_LBEASTLargeHaptics);
 
 U2DOFGyroPlatformController::U2DOFGyroPlatformController()
 {
@@ -37,6 +40,7 @@ bool U2DOFGyroPlatformController::InitializePlatform(const FHapticPlatformConfig
 void U2DOFGyroPlatformController::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	LARGEHAPTICS_SCOPE_CYCLE_COUNTER(STAT_2DOFGyroPlatformController_Tick);
 
 	// Process HOTAS input and map to gyroscope rotation
 	if (bIsInitialized && IsHOTASConnected() && Config.GyroscopeConfig.bEnableJoystick)
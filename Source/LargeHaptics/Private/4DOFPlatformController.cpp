@@ -3,6 +3,8 @@
 #include "4DOFPlatformController.h"
 #include "Models/GunButtonEvents.h"
 #include "Models/GunTelemetry.h"
+#include "Health/LBEASTDeviceHealth.h"
+#include "GameFramework/Actor.h"
 
 U4DOFPlatformController::U4DOFPlatformController()
 {
@@ -88,3 +90,53 @@ bool U4DOFPlatformController::GetGunTelemetry(FGunTelemetry& OutTelemetry) const
 	return false;
 }
 
+void U4DOFPlatformController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	FLBEASTDeviceHealthRegistry::Get().UnregisterDevice(GunHealthHandle);
+	GunHealthHandle = -1;
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void U4DOFPlatformController::HandleReceivedPacket(const TArray<uint8>& Data, int32 Length)
+{
+	Super::HandleReceivedPacket(Data, Length);
+
+	// Gun telemetry arrives at 0.5-10 Hz on Channel 311; only react when a new one has been cached
+	const TArray<uint8>* TelemetryBytes = ReceivedBytesCache.Find(311);
+	if (TelemetryBytes && TelemetryBytes->Num() >= sizeof(FGunTelemetry))
+	{
+		FGunTelemetry Telemetry;
+		FMemory::Memcpy(&Telemetry, TelemetryBytes->GetData(), sizeof(FGunTelemetry));
+		if (Telemetry.Timestamp != LastGunTelemetryTimestamp)
+		{
+			LastGunTelemetryTimestamp = Telemetry.Timestamp;
+			ReportGunTelemetryHealth(Telemetry);
+		}
+	}
+}
+
+void U4DOFPlatformController::ReportGunTelemetryHealth(const FGunTelemetry& Telemetry)
+{
+	FLBEASTDeviceHealthRegistry& Health = FLBEASTDeviceHealthRegistry::Get();
+
+	if (GunHealthHandle < 0)
+	{
+		// The report interval is server-controlled (Channel 101, up to 2 s idle), so no fixed expected interval
+		FLBEASTDeviceHealthConfig GunConfig;
+		GunConfig.TimeoutSeconds = 6.0f;
+		const AActor* Owner = GetOwner();
+		GunHealthHandle = Health.RegisterDevice(FString::Printf(TEXT("%s Guns"), Owner ? *Owner->GetName() : *GetName()), TEXT("gunship"), GunConfig);
+	}
+
+	// ECU timestamp (ms since boot) gives sender-side jitter
+	Health.ReportPacket(GunHealthHandle, 0.0, -1, Telemetry.Timestamp / 1000.0);
+
+	for (int32 Station = 0; Station < 4; Station++)
+	{
+		Health.ReportTemperature(GunHealthHandle, *FString::Printf(TEXT("Station%d.Solenoid"), Station), Telemetry.ActiveSolenoidTemp[Station]);
+		Health.ReportTemperature(GunHealthHandle, *FString::Printf(TEXT("Station%d.Driver"), Station), Telemetry.DriverModuleTemp[Station]);
+		Health.SetCondition(GunHealthHandle, *FString::Printf(TEXT("Station%d.ThermalShutdown"), Station), Telemetry.ThermalShutdown[Station]);
+		Health.SetCondition(GunHealthHandle, *FString::Printf(TEXT("Station%d.Disconnected"), Station), !Telemetry.StationConnected[Station]);
+	}
+}
@@ -2,6 +2,10 @@
 
 #include "HapticPlatformController.h"
 #include "IPAddress.h"
+#include "LargeHaptics.h"
+#include "ShowControl/LBEASTShowTimeline.h"
+
+DECLARE_CYCLE_STAT(TEXT("HapticPlatformController Tick"), STAT_HapticPlatformController_Tick, STATGROUP_LBEASTLargeHaptics);
 
 UHapticPlatformController::UHapticPlatformController()
 {
@@ -17,17 +21,66 @@ void UHapticPlatformController::BeginPlay()
 	{
 		InitializePlatform(Config);
 	}
+
+	if (!ShowTrackName.IsNone())
+	{
+		if (ULBEASTShowControlSubsystem* ShowControl = ULBEASTShowControlSubsystem::Get(this))
+		{
+			RegisteredShowTrackName = ShowControl->RegisterTrack(ShowTrackName, this, [this](const FLBEASTShowCue& Cue, double LateSeconds)
+			{
+				ExecuteShowCue(Cue, LateSeconds);
+			});
+		}
+	}
 }
 
 void UHapticPlatformController::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (!RegisteredShowTrackName.IsNone())
+	{
+		if (ULBEASTShowControlSubsystem* ShowControl = ULBEASTShowControlSubsystem::Get(this))
+		{
+			ShowControl->UnregisterTrack(RegisteredShowTrackName, this);
+		}
+		RegisteredShowTrackName = NAME_None;
+	}
+
 	ShutdownUDPConnection();
 	Super::EndPlay(EndPlayReason);
 }
 
+void UHapticPlatformController::ExecuteShowCue(const FLBEASTShowCue& Cue, double LateSeconds)
+{
+	static const FName MotionCommand(TEXT("Motion"));
+	static const FName ActuatorCommand(TEXT("Actuator"));
+	static const FName NeutralCommand(TEXT("Neutral"));
+
+	// Motion moves absorb lateness into their ramp so the platform arrives when the show expects it
+	const float Duration = FMath::Max(0.0f, Cue.DurationSeconds - static_cast<float>(LateSeconds));
+
+	if (Cue.Command == MotionCommand)
+	{
+		// Vector = (TiltX, TiltY, Vertical), Value = Forward
+		SendNormalizedMotion(Cue.Vector.X, Cue.Vector.Y, Cue.Value, Cue.Vector.Z, Duration);
+	}
+	else if (Cue.Command == ActuatorCommand)
+	{
+		SetActuatorExtension(Cue.TargetName, Cue.Value);
+	}
+	else if (Cue.Command == NeutralCommand)
+	{
+		ReturnToNeutral(Duration);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("HapticPlatformController: Unknown show cue command '%s'"), *Cue.Command.ToString());
+	}
+}
+
 void UHapticPlatformController::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	LARGEHAPTICS_SCOPE_CYCLE_COUNTER(STAT_HapticPlatformController_Tick);
 
 	if (!bIsInitialized)
 	{
@@ -35,7 +88,7 @@ void UHapticPlatformController::TickComponent(float DeltaTime, ELevelTick TickTy
 	}
 
 	// Receive data from hardware (bidirectional IO) - handled by base class
-	// Base class TickComponent already calls ProcessIncomingUDPData()
+	// (I/O reactor batch per frame, or ProcessIncomingUDPData() from the base TickComponent)
 
 	// Note: HOTAS input processing is handled by subclasses (e.g., U2DOFGyroPlatformController)
 	// Base class does not handle HOTAS - it's platform-specific
@@ -226,9 +279,10 @@ void UHapticPlatformController::EmergencyStop()
 	TargetState = CurrentState;
 
 	// Notify ECU universally for all large haptics experiences (Channel 7 = Emergency Stop)
+	// Safety lane: sent before anything else queued this frame, redundantly, retransmitted until the ECU ACKs
 	if (bIsInitialized && IsHardwareConnected())
 	{
-		SendBool(7, true);
+		SendSafetyBool(7, true);
 	}
 	UE_LOG(LogTemp, Warning, TEXT("HapticPlatformController: EMERGENCY STOP (Ch7=true)"));
 }
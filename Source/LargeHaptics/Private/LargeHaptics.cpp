@@ -2,6 +2,8 @@
 
 #include "LargeHaptics.h"
 
+LBEAST_DEFINE_TRACE_CHANNEL(LBEASTLargeHapticsChannel);
+
 #define LOCTEXT_NAMESPACE "FLargeHapticsModule"
 
 void FLargeHapticsModule::StartupModule()
@@ -83,5 +83,18 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LBEAST|Haptics|4DOF|Guns")
 	bool GetGunTelemetry(FGunTelemetry& OutTelemetry) const;
 
+protected:
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void HandleReceivedPacket(const TArray<uint8>& Data, int32 Length) override;
+
+private:
+	/** Feed new gun telemetry (temperatures, thermal shutdown, station links) to the device health service */
+	void ReportGunTelemetryHealth(const FGunTelemetry& Telemetry);
+
+	/** Device health registration for the gun stations (-1 until the first telemetry arrives) */
+	int32 GunHealthHandle = -1;
+
+	/** Timestamp of the last telemetry reported, so repeated parses of the cached packet aren't counted twice */
+	uint32 LastGunTelemetryTimestamp = 0;
 };
 
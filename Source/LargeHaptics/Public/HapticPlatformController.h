@@ -6,6 +6,8 @@
 #include "Networking/LBEASTUDPTransport.h"
 #include "HapticPlatformController.generated.h"
 
+struct FLBEASTShowCue;
+
 /**
  * Platform type enumeration
  */
@@ -227,6 +229,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Haptics")
 	FHapticPlatformConfig Config;
 
+	/** Show-control track this platform answers to (Motion, Actuator, Neutral cues). None = not registered. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LBEAST|Haptics|Show Control")
+	FName ShowTrackName = FName("Motion");
+
 	/**
 	 * Initialize the haptic platform system
 	 * @param InConfig - Configuration settings
@@ -307,6 +313,11 @@ protected:
 	bool bIsInitialized = false;
 
 private:
+	/** Show-control track handler (game thread) */
+	void ExecuteShowCue(const FLBEASTShowCue& Cue, double LateSeconds);
+
+	/** Name the track was actually registered under (ShowTrackName, or ShowTrackName_N if another instance holds it) */
+	FName RegisteredShowTrackName;
 
 	/** Current platform state */
 	FPlatformMotionCommand CurrentState;
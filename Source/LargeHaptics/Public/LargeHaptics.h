@@ -4,6 +4,15 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "LBEASTStats.h"
+
+/** Stats group ("stat LBEASTLargeHaptics") and Unreal Insights channel for this module (see LBEASTStats.h) */
+DECLARE_STATS_GROUP(TEXT("LBEAST LargeHaptics"), STATGROUP_LBEASTLargeHaptics, STATCAT_Advanced);
+LBEAST_DECLARE_TRACE_CHANNEL(LBEASTLargeHapticsChannel, LARGEHAPTICS_API);
+
+#define LARGEHAPTICS_SCOPE_CYCLE_COUNTER(StatId) LBEAST_SCOPE_CYCLE_COUNTER(StatId, "LargeHaptics", LBEASTLargeHapticsChannel)
+#define LARGEHAPTICS_INC_COUNTER(StatId, Amount) LBEAST_INC_COUNTER(StatId, "LargeHaptics", Amount)
+#define LARGEHAPTICS_SET_GAUGE(StatId, Value) LBEAST_SET_GAUGE(StatId, "LargeHaptics", Value)
 
 /**
  * Large Haptics Module
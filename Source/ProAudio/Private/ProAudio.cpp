@@ -3,6 +3,7 @@
 #include "ProAudio.h"
 
 DEFINE_LOG_CATEGORY(LogProAudio);
+LBEAST_DEFINE_TRACE_CHANNEL(LBEASTProAudioChannel);
 
 #define LOCTEXT_NAMESPACE "FProAudioModule"
 
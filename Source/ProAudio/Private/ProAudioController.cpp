@@ -6,6 +6,15 @@
 #include "OSCMessage.h"
 #include "OSCAddress.h"
 #include "OSCTypes.h"
+#include "ProAudio.h"
+#include "Networking/LBEASTSessionCapture.h"
+#include "Networking/LBEASTIOReactor.h"
+#include "Common/UdpSocketBuilder.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "ShowControl/LBEASTShowTimeline.h"
+
+DECLARE_CYCLE_STAT(TEXT("ProAudioController Tick"), STAT_ProAudioController_Tick, STATGROUP_LBEASTProAudio);
 
 UProAudioController::UProAudioController(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -14,6 +23,242 @@ UProAudioController::UProAudioController(const FObjectInitializer& ObjectInitial
 	bIsInitialized = false;
 }
 
+namespace
+{
+	/**
+	 * OSC messages are captured in OSC 1.0 wire format (the OSC plugin doesn't expose its packet bytes).
+	 * Only the argument types ProAudio sends and parses (f, i, s) are encoded.
+	 */
+	void AppendOSCString(TArray<uint8>& Buffer, const FString& Value)
+	{
+		FTCHARToUTF8 Converter(*Value);
+		Buffer.Append(reinterpret_cast<const uint8*>(Converter.Get()), Converter.Length());
+		Buffer.AddZeroed(4 - (Converter.Length() % 4));
+	}
+
+	void AppendOSCInt(TArray<uint8>& Buffer, uint32 Value)
+	{
+		Buffer.Add((uint8)(Value >> 24));
+		Buffer.Add((uint8)(Value >> 16));
+		Buffer.Add((uint8)(Value >> 8));
+		Buffer.Add((uint8)Value);
+	}
+
+	void EncodeOSCForCapture(const FOSCMessage& Message, TArray<uint8>& OutData)
+	{
+		const TArray<UE::OSC::FOSCData>& Args = Message.GetArgumentsChecked();
+
+		FString TypeTags = TEXT(",");
+		for (const UE::OSC::FOSCData& Arg : Args)
+		{
+			TypeTags.AppendChar(Arg.IsFloat() ? TEXT('f') : Arg.IsInt32() ? TEXT('i') : Arg.IsString() ? TEXT('s') : TEXT('N'));
+		}
+
+		AppendOSCString(OutData, Message.GetAddress().GetFullPath());
+		AppendOSCString(OutData, TypeTags);
+		for (const UE::OSC::FOSCData& Arg : Args)
+		{
+			if (Arg.IsFloat())
+			{
+				const float Value = Arg.GetFloat();
+				uint32 Bits;
+				FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+				AppendOSCInt(OutData, Bits);
+			}
+			else if (Arg.IsInt32())
+			{
+				AppendOSCInt(OutData, (uint32)Arg.GetInt32());
+			}
+			else if (Arg.IsString())
+			{
+				AppendOSCString(OutData, Arg.GetString());
+			}
+		}
+	}
+
+	bool ReadOSCString(const TArray<uint8>& Data, int32& Offset, int32 End, FString& OutValue)
+	{
+		int32 Terminator = Offset;
+		while (Terminator < End && Data[Terminator] != 0)
+		{
+			Terminator++;
+		}
+		if (Terminator >= End)
+		{
+			return false;
+		}
+
+		FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Data.GetData() + Offset), Terminator - Offset);
+		OutValue = FString(Converter.Length(), Converter.Get());
+		Offset = Align(Terminator + 1, 4);
+		return Offset <= End;
+	}
+
+	bool ReadOSCInt(const TArray<uint8>& Data, int32& Offset, int32 End, uint32& OutValue)
+	{
+		if (Offset + 4 > End)
+		{
+			return false;
+		}
+		OutValue = ((uint32)Data[Offset] << 24) | ((uint32)Data[Offset + 1] << 16) | ((uint32)Data[Offset + 2] << 8) | (uint32)Data[Offset + 3];
+		Offset += 4;
+		return true;
+	}
+
+	bool ReadOSCInt64(const TArray<uint8>& Data, int32& Offset, int32 End, uint64& OutValue)
+	{
+		uint32 High = 0;
+		uint32 Low = 0;
+		if (!ReadOSCInt(Data, Offset, End, High) || !ReadOSCInt(Data, Offset, End, Low))
+		{
+			return false;
+		}
+		OutValue = ((uint64)High << 32) | Low;
+		return true;
+	}
+
+	/**
+	 * Decode one OSC 1.0 message from Data[Offset, End).
+	 * f/i/s map straight onto FOSCData; d, h, T and F are narrowed to float/int32 so routing sees them;
+	 * t, b, N and I are consumed (to keep the argument stream aligned) but not routed.
+	 */
+	bool DecodeOSCMessage(const TArray<uint8>& Data, int32 Offset, int32 End, FOSCMessage& OutMessage)
+	{
+		FString Path;
+		FString TypeTags;
+		if (!ReadOSCString(Data, Offset, End, Path) || !ReadOSCString(Data, Offset, End, TypeTags) || !TypeTags.StartsWith(TEXT(",")))
+		{
+			return false;
+		}
+
+		TArray<UE::OSC::FOSCData> Args;
+		for (int32 i = 1; i < TypeTags.Len(); i++)
+		{
+			uint32 Value = 0;
+			uint64 Value64 = 0;
+			FString StringValue;
+			switch (TypeTags[i])
+			{
+				case TEXT('f'):
+				{
+					if (!ReadOSCInt(Data, Offset, End, Value))
+					{
+						return false;
+					}
+					float FloatValue;
+					FMemory::Memcpy(&FloatValue, &Value, sizeof(FloatValue));
+					Args.Add(UE::OSC::FOSCData(FloatValue));
+					break;
+				}
+				case TEXT('d'):
+				{
+					if (!ReadOSCInt64(Data, Offset, End, Value64))
+					{
+						return false;
+					}
+					double DoubleValue;
+					FMemory::Memcpy(&DoubleValue, &Value64, sizeof(DoubleValue));
+					Args.Add(UE::OSC::FOSCData((float)DoubleValue));
+					break;
+				}
+				case TEXT('i'):
+					if (!ReadOSCInt(Data, Offset, End, Value))
+					{
+						return false;
+					}
+					Args.Add(UE::OSC::FOSCData((int32)Value));
+					break;
+				case TEXT('h'):
+					if (!ReadOSCInt64(Data, Offset, End, Value64))
+					{
+						return false;
+					}
+					Args.Add(UE::OSC::FOSCData((int32)FMath::Clamp<int64>((int64)Value64, MIN_int32, MAX_int32)));
+					break;
+				case TEXT('t'):
+					if (!ReadOSCInt64(Data, Offset, End, Value64))
+					{
+						return false;
+					}
+					break;
+				case TEXT('s'):
+				case TEXT('S'):
+					if (!ReadOSCString(Data, Offset, End, StringValue))
+					{
+						return false;
+					}
+					Args.Add(UE::OSC::FOSCData(StringValue));
+					break;
+				case TEXT('b'):
+					if (!ReadOSCInt(Data, Offset, End, Value) || (int64)Offset + Value > End)
+					{
+						return false;
+					}
+					Offset = Align(Offset + (int32)Value, 4);
+					break;
+				case TEXT('c'):
+				case TEXT('r'):
+				case TEXT('m'):
+					if (!ReadOSCInt(Data, Offset, End, Value))
+					{
+						return false;
+					}
+					break;
+				case TEXT('T'):
+					Args.Add(UE::OSC::FOSCData((int32)1));
+					break;
+				case TEXT('F'):
+					Args.Add(UE::OSC::FOSCData((int32)0));
+					break;
+				default:
+					// N, I and array brackets carry no payload
+					break;
+			}
+		}
+
+		OutMessage = FOSCMessage(FOSCAddress(Path), Args);
+		return true;
+	}
+
+	/** Decode an OSC packet (a message or a possibly nested #bundle) from Data[Offset, End) */
+	bool DecodeOSCPacket(const TArray<uint8>& Data, int32 Offset, int32 End, TArray<FOSCMessage>& OutMessages, int32 Depth = 0)
+	{
+		static const uint8 BundleTag[8] = { '#', 'b', 'u', 'n', 'd', 'l', 'e', 0 };
+		if (End - Offset >= 16 && FMemory::Memcmp(Data.GetData() + Offset, BundleTag, sizeof(BundleTag)) == 0)
+		{
+			if (Depth >= 8)
+			{
+				return false;
+			}
+
+			// Skip the tag and time tag; bundled messages are routed immediately
+			Offset += 16;
+			while (Offset < End)
+			{
+				uint32 ElementSize = 0;
+				if (!ReadOSCInt(Data, Offset, End, ElementSize) || (int64)Offset + ElementSize > End)
+				{
+					return false;
+				}
+				if (!DecodeOSCPacket(Data, Offset, Offset + (int32)ElementSize, OutMessages, Depth + 1))
+				{
+					return false;
+				}
+				Offset += (int32)ElementSize;
+			}
+			return true;
+		}
+
+		FOSCMessage Message;
+		if (!DecodeOSCMessage(Data, Offset, End, Message))
+		{
+			return false;
+		}
+		OutMessages.Add(MoveTemp(Message));
+		return true;
+	}
+}
+
 void UProAudioController::BeginPlay()
 {
 	Super::BeginPlay();
@@ -22,14 +267,64 @@ void UProAudioController::BeginPlay()
 	{
 		InitializeConsole(Config);
 	}
+
+	if (!ShowTrackName.IsNone())
+	{
+		if (ULBEASTShowControlSubsystem* ShowControl = ULBEASTShowControlSubsystem::Get(this))
+		{
+			RegisteredShowTrackName = ShowControl->RegisterTrack(ShowTrackName, this, [this](const FLBEASTShowCue& Cue, double LateSeconds)
+			{
+				ExecuteShowCue(Cue, LateSeconds);
+			});
+		}
+	}
 }
 
 void UProAudioController::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (!RegisteredShowTrackName.IsNone())
+	{
+		if (ULBEASTShowControlSubsystem* ShowControl = ULBEASTShowControlSubsystem::Get(this))
+		{
+			ShowControl->UnregisterTrack(RegisteredShowTrackName, this);
+		}
+		RegisteredShowTrackName = NAME_None;
+	}
+
 	Shutdown();
 	Super::EndPlay(EndPlayReason);
 }
 
+void UProAudioController::ExecuteShowCue(const FLBEASTShowCue& Cue, double LateSeconds)
+{
+	static const FName FaderCommand(TEXT("Fader"));
+	static const FName MuteCommand(TEXT("Mute"));
+	static const FName BusSendCommand(TEXT("BusSend"));
+	static const FName MasterCommand(TEXT("Master"));
+
+	// Console moves are instantaneous OSC sets, so lateness needs no compensation here
+	if (Cue.Command == FaderCommand)
+	{
+		SetChannelFader(Cue.TargetIndex, Cue.Value);
+	}
+	else if (Cue.Command == MuteCommand)
+	{
+		SetChannelMute(Cue.TargetIndex, Cue.Value > 0.5f);
+	}
+	else if (Cue.Command == BusSendCommand)
+	{
+		SetChannelBusSend(Cue.TargetIndex, FMath::RoundToInt(Cue.Vector.X), Cue.Value);
+	}
+	else if (Cue.Command == MasterCommand)
+	{
+		SetMasterFader(Cue.Value);
+	}
+	else
+	{
+		UE_LOG(LogProAudio, Warning, TEXT("ProAudioController: Unknown show cue command '%s'"), *Cue.Command.ToString());
+	}
+}
+
 bool UProAudioController::InitializeConsole(const FLBEASTProAudioConfig& InConfig)
 {
 	Config = InConfig;
@@ -58,8 +353,15 @@ bool UProAudioController::InitializeConsole(const FLBEASTProAudioConfig& InConfi
 	// Connect client
 	OSCClient->Connect();
 
-	// Create OSC server for bidirectional communication (if enabled)
+	// Receive on an I/O reactor socket so console updates arrive batched on the game thread
+	// with their wire bytes (captured verbatim); fall back to the OSC plugin's server thread
 	if (Config.bEnableReceive)
+	{
+		StartReactorReceive();
+	}
+
+	// Create OSC server for bidirectional communication (if enabled)
+	if (Config.bEnableReceive && ReceiveReactorHandle < 0)
 	{
 		OSCServer = NewObject<UOSCServer>(this);
 		if (OSCServer)
@@ -83,6 +385,8 @@ bool UProAudioController::InitializeConsole(const FLBEASTProAudioConfig& InConfi
 	}
 
 	bIsInitialized = true;
+	CaptureSource = FLBEASTSessionCapture::Get().RegisterSource(FString::Printf(TEXT("OSC %s:%d"), *Config.BoardIPAddress, Config.OSCPort),
+		FOnLBEASTCaptureReplay::CreateUObject(this, &UProAudioController::HandleCaptureReplay));
 	UE_LOG(LogProAudio, Log, TEXT("ProAudioController: Initialized (Console: %d, IP: %s:%d)"), 
 		(uint8)Config.ConsoleType, *Config.BoardIPAddress, Config.OSCPort);
 
@@ -112,7 +416,7 @@ void UProAudioController::SetChannelFader(int32 Channel, float Level)
 	Args.Add(UE::OSC::FOSCData(ConsoleLevel));
 	FOSCMessage Message(FOSCAddress(OSCPath), Args);
 
-	OSCClient->SendOSCMessage(Message);
+	SendOSCMessage(Message);
 	
 	UE_LOG(LogProAudio, Verbose, TEXT("ProAudioController: Set fader - Virtual CH %d -> Physical CH %d = %.3f"), 
 		Channel, PhysicalChannel, ConsoleLevel);
@@ -141,7 +445,7 @@ void UProAudioController::SetChannelMute(int32 Channel, bool bMute)
 	Args.Add(UE::OSC::FOSCData(MuteValue));
 	FOSCMessage Message(FOSCAddress(OSCPath), Args);
 
-	OSCClient->SendOSCMessage(Message);
+	SendOSCMessage(Message);
 	
 	UE_LOG(LogProAudio, Verbose, TEXT("ProAudioController: Set mute - Virtual CH %d -> Physical CH %d = %s"), 
 		Channel, PhysicalChannel, bMute ? TEXT("Muted") : TEXT("Unmuted"));
@@ -169,7 +473,7 @@ void UProAudioController::SetChannelBusSend(int32 Channel, int32 Bus, float Leve
 	Args.Add(UE::OSC::FOSCData(ConsoleLevel));
 	FOSCMessage Message(FOSCAddress(OSCPath), Args);
 
-	OSCClient->SendOSCMessage(Message);
+	SendOSCMessage(Message);
 	
 	UE_LOG(LogProAudio, Verbose, TEXT("ProAudioController: Set bus send - Virtual CH %d -> Physical CH %d, Bus %d = %.3f"), 
 		Channel, PhysicalChannel, Bus, ConsoleLevel);
@@ -190,7 +494,7 @@ void UProAudioController::SetMasterFader(float Level)
 	Args.Add(UE::OSC::FOSCData(ConsoleLevel));
 	FOSCMessage Message(FOSCAddress(OSCPath), Args);
 
-	OSCClient->SendOSCMessage(Message);
+	SendOSCMessage(Message);
 }
 
 bool UProAudioController::IsConsoleConnected() const
@@ -210,10 +514,111 @@ void UProAudioController::Shutdown()
 		OSCServer = nullptr;
 	}
 
+	StopReactorReceive();
+
 	bIsInitialized = false;
+	FLBEASTSessionCapture::Get().UnregisterSource(CaptureSource);
+	CaptureSource = -1;
 	UE_LOG(LogProAudio, Log, TEXT("ProAudioController: Shutdown"));
 }
 
+void UProAudioController::SendOSCMessage(FOSCMessage& Message)
+{
+	OSCClient->SendOSCMessage(Message);
+
+	FLBEASTSessionCapture& Capture = FLBEASTSessionCapture::Get();
+	if (Capture.IsRecording())
+	{
+		TArray<uint8> Data;
+		EncodeOSCForCapture(Message, Data);
+		Capture.Record(CaptureSource, ELBEASTCaptureDirection::Outbound, 0, Data.GetData(), Data.Num());
+	}
+}
+
+void UProAudioController::HandleCaptureReplay(uint32 Address, const TArray<uint8>& Data)
+{
+	TArray<FOSCMessage> Messages;
+	if (DecodeOSCPacket(Data, 0, Data.Num(), Messages))
+	{
+		for (const FOSCMessage& Message : Messages)
+		{
+			RouteOSCMessage(Message);
+		}
+	}
+}
+
+void UProAudioController::StartReactorReceive()
+{
+	ULBEASTIOReactorSubsystem* Reactor = ULBEASTIOReactorSubsystem::Get(this);
+	if (!Reactor)
+	{
+		return;
+	}
+
+	ReceiveSocket = FUdpSocketBuilder(TEXT("ProAudioOSCReceive"))
+		.AsNonBlocking()
+		.AsReusable()
+		.BoundToPort(Config.ReceivePort)
+		.WithReceiveBufferSize(256 * 1024);
+	if (!ReceiveSocket)
+	{
+		UE_LOG(LogProAudio, Warning, TEXT("ProAudioController: Failed to bind OSC receive port %d, falling back to the OSC plugin server"), Config.ReceivePort);
+		return;
+	}
+
+	ReceiveReactorHandle = Reactor->RegisterSocket(ReceiveSocket,
+		FOnLBEASTIODatagrams::CreateUObject(this, &UProAudioController::HandleIOReactorDatagrams), TEXT("ProAudioOSC"));
+	if (ReceiveReactorHandle < 0)
+	{
+		StopReactorReceive();
+		return;
+	}
+
+	IOReactor = Reactor;
+	UE_LOG(LogProAudio, Log, TEXT("ProAudioController: OSC receive on port %d via I/O reactor (bidirectional sync enabled)"), Config.ReceivePort);
+}
+
+void UProAudioController::StopReactorReceive()
+{
+	// The reactor must stop reading the socket before it is destroyed
+	if (ReceiveReactorHandle >= 0)
+	{
+		if (ULBEASTIOReactorSubsystem* Reactor = IOReactor.Get())
+		{
+			Reactor->Unregister(ReceiveReactorHandle);
+		}
+		ReceiveReactorHandle = -1;
+	}
+
+	if (ReceiveSocket)
+	{
+		ReceiveSocket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ReceiveSocket);
+		ReceiveSocket = nullptr;
+	}
+}
+
+void UProAudioController::HandleIOReactorDatagrams(const TArray<FLBEASTIODatagram>& Datagrams)
+{
+	FLBEASTSessionCapture& Capture = FLBEASTSessionCapture::Get();
+	TArray<FOSCMessage> Messages;
+	for (const FLBEASTIODatagram& Datagram : Datagrams)
+	{
+		Capture.Record(CaptureSource, ELBEASTCaptureDirection::Inbound, 0, Datagram.Data.GetData(), Datagram.Data.Num());
+
+		Messages.Reset();
+		if (!DecodeOSCPacket(Datagram.Data, 0, Datagram.Data.Num(), Messages))
+		{
+			UE_LOG(LogProAudio, Verbose, TEXT("ProAudioController: Dropped malformed OSC packet (%d bytes)"), Datagram.Data.Num());
+			continue;
+		}
+		for (const FOSCMessage& Message : Messages)
+		{
+			RouteOSCMessage(Message);
+		}
+	}
+}
+
 FString UProAudioController::BuildOSCPath(const FString& Command, int32 Channel, int32 Bus) const
 {
 	FString Path;
@@ -497,15 +902,16 @@ int32 UProAudioController::FindFirstAvailablePhysicalChannel() const
 
 bool UProAudioController::IsBidirectionalSyncEnabled() const
 {
-	return bIsInitialized && Config.bEnableReceive && OSCServer != nullptr;
+	return bIsInitialized && Config.bEnableReceive && (OSCServer != nullptr || ReceiveReactorHandle >= 0);
 }
 
 void UProAudioController::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	PROAUDIO_SCOPE_CYCLE_COUNTER(STAT_ProAudioController_Tick);
 
-	// OSC messages are handled automatically via event bindings (OnOSCFaderReceived, etc.)
-	// Unreal's OSC plugin routes incoming messages to bound UFUNCTIONs
+	// OSC messages arrive via the I/O reactor (HandleIOReactorDatagrams) or, without a reactor,
+	// via the OSC plugin's OnOscMessageReceived binding
 	// No polling needed - when physical board sends OSC update, handler fires -> delegate broadcasts -> UMG widgets update
 }
 
@@ -593,6 +999,19 @@ int32 UProAudioController::ExtractBusFromOSCAddress(const FString& OSCAddress) c
 }
 
 void UProAudioController::OnOSCMessageReceived(const FOSCMessage& Message, const FString& IPAddress, int32 Port)
+{
+	FLBEASTSessionCapture& Capture = FLBEASTSessionCapture::Get();
+	if (Capture.IsRecording())
+	{
+		TArray<uint8> Data;
+		EncodeOSCForCapture(Message, Data);
+		Capture.Record(CaptureSource, ELBEASTCaptureDirection::Inbound, 0, Data.GetData(), Data.Num());
+	}
+
+	RouteOSCMessage(Message);
+}
+
+void UProAudioController::RouteOSCMessage(const FOSCMessage& Message)
 {
 	// Get address from message
 	const FOSCAddress& Address = Message.GetAddress();
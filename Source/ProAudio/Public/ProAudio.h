@@ -4,9 +4,18 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "LBEASTStats.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogProAudio, Log, All);
 
+/** Stats group ("stat LBEASTProAudio") and Unreal Insights channel for this module (see LBEASTStats.h) */
+DECLARE_STATS_GROUP(TEXT("LBEAST ProAudio"), STATGROUP_LBEASTProAudio, STATCAT_Advanced);
+LBEAST_DECLARE_TRACE_CHANNEL(LBEASTProAudioChannel, PROAUDIO_API);
+
+#define PROAUDIO_SCOPE_CYCLE_COUNTER(StatId) LBEAST_SCOPE_CYCLE_COUNTER(StatId, "ProAudio", LBEASTProAudioChannel)
+#define PROAUDIO_INC_COUNTER(StatId, Amount) LBEAST_INC_COUNTER(StatId, "ProAudio", Amount)
+#define PROAUDIO_SET_GAUGE(StatId, Value) LBEAST_SET_GAUGE(StatId, "ProAudio", Value)
+
 /**
  * LBEAST ProAudio Module
  * 
@@ -10,6 +10,11 @@
 #include "ProAudio.h"  // For LogProAudio
 #include "ProAudioController.generated.h"
 
+struct FLBEASTShowCue;
+struct FLBEASTIODatagram;
+class ULBEASTIOReactorSubsystem;
+class FSocket;
+
 /**
  * Pro Audio Console Types
  */
@@ -100,6 +105,9 @@ class PROAUDIO_API UProAudioController : public UActorComponent
 {
 	GENERATED_BODY()
 
+	/** LBEASTBenchmarks times BuildOSCPath() */
+	friend struct FLBEASTBenchmarkAccess;
+
 public:
 	UProAudioController(const FObjectInitializer& ObjectInitializer);
 
@@ -107,6 +115,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProAudio")
 	FLBEASTProAudioConfig Config;
 
+	/** Show-control track this controller answers to (Fader, Mute, BusSend, Master cues). None = not registered. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProAudio|Show Control")
+	FName ShowTrackName = FName("Audio");
+
 	/**
 	 * Initialize connection to pro audio console
 	 */
@@ -245,16 +257,30 @@ protected:
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 private:
+	/** Show-control track handler (game thread) */
+	void ExecuteShowCue(const FLBEASTShowCue& Cue, double LateSeconds);
+
+	/** Name the track was actually registered under (ShowTrackName, or ShowTrackName_N if another instance holds it) */
+	FName RegisteredShowTrackName;
+
 	/** OSC Client for sending commands */
 	UPROPERTY()
 	UOSCClient* OSCClient = nullptr;
 
-	/** OSC Server for receiving (if bidirectional) */
+	/** OSC Server for receiving (if bidirectional and no I/O reactor is available) */
 	UPROPERTY()
 	UOSCServer* OSCServer = nullptr;
 
+	/** OSC receive socket registered with the I/O reactor (preferred over OSCServer) */
+	FSocket* ReceiveSocket = nullptr;
+	TWeakObjectPtr<ULBEASTIOReactorSubsystem> IOReactor;
+	int32 ReceiveReactorHandle = -1;
+
 	bool bIsInitialized = false;
 
+	/** FLBEASTSessionCapture source id */
+	int32 CaptureSource = -1;
+
 	/** Set of registered virtual channels for bidirectional sync (used by UMG templates) */
 	TSet<int32> RegisteredChannelsForSync;
 
@@ -280,7 +306,23 @@ private:
 	UFUNCTION()
 	void OnOSCMessageReceived(const FOSCMessage& Message, const FString& IPAddress, int32 Port);
 
-	/** OSC event handlers (called by OnOSCMessageReceived based on address pattern) */
+	/** Dispatch a received (or replayed) OSC message by address pattern */
+	void RouteOSCMessage(const FOSCMessage& Message);
+
+	/** Send through the OSC client and report to session capture */
+	void SendOSCMessage(FOSCMessage& Message);
+
+	/** Bind ReceiveSocket and register it with the I/O reactor; leaves ReceiveReactorHandle at -1 on failure */
+	void StartReactorReceive();
+	void StopReactorReceive();
+
+	/** I/O reactor batch callback: capture the wire bytes, decode messages and bundles, route (game thread) */
+	void HandleIOReactorDatagrams(const TArray<FLBEASTIODatagram>& Datagrams);
+
+	/** Session replay callback: decode a captured OSC message and route it */
+	void HandleCaptureReplay(uint32 Address, const TArray<uint8>& Data);
+
+	/** OSC event handlers (called by RouteOSCMessage based on address pattern) */
 	void OnOSCFaderReceived(const FOSCAddress& AddressPattern, const FOSCMessage& Message);
 
 	void OnOSCMuteReceived(const FOSCAddress& AddressPattern, const FOSCMessage& Message);
@@ -2,8 +2,15 @@
 
 #include "ProLighting/Public/ArtNetManager.h"
 #include "ProLighting/Public/ProLightingController.h"
+#include "Health/LBEASTDeviceHealth.h"
+#include "Networking/LBEASTIOReactor.h"
+#include "Networking/LBEASTSessionCapture.h"
+#include "HAL/PlatformTime.h"
 #include "Interfaces/IPv4/IPv4Address.h"
 #include "IPAddress.h"
+#include "ProLighting.h"
+
+DECLARE_CYCLE_STAT(TEXT("ArtNetManager Tick"), STAT_ArtNetManager_Tick, STATGROUP_LBEASTProLighting);
 
 bool FArtNetManager::Initialize(const FString& IP, int32 Port, int32 Net, int32 SubNet)
 {
@@ -32,6 +39,10 @@ bool FArtNetManager::Initialize()
 
 void FArtNetManager::Shutdown()
 {
+    // The reactor must stop reading the socket before it is destroyed
+    UnregisterFromIOReactor();
+    FLBEASTSessionCapture::Get().UnregisterSource(CaptureSource);
+    CaptureSource = -1;
     if (DiscoverySocket)
     {
         DiscoverySocket->Close();
@@ -39,7 +50,15 @@ void FArtNetManager::Shutdown()
         DiscoverySocket = nullptr;
     }
     SendAddr.Reset();
+    NodeAddresses.Empty();
+    RDM.Reset();
+    FakeRDMNode.Reset();
     DiscoveredNodes.Empty();
+    for (const TPair<FString, FNodeHealth>& Entry : NodeHealth)
+    {
+        FLBEASTDeviceHealthRegistry::Get().UnregisterDevice(Entry.Value.Handle);
+    }
+    NodeHealth.Empty();
     if (Transport)
     {
         Transport->Shutdown();
@@ -49,6 +68,8 @@ void FArtNetManager::Shutdown()
 
 void FArtNetManager::Tick(float DeltaTime)
 {
+    PROLIGHTING_SCOPE_CYCLE_COUNTER(STAT_ArtNetManager_Tick);
+
     ProcessIncoming();
     Accumulated += DeltaTime;
     if (Accumulated >= PollIntervalSeconds)
@@ -56,6 +77,126 @@ void FArtNetManager::Tick(float DeltaTime)
         SendArtPoll();
         Accumulated = 0.0f;
     }
+
+    if (RDM)
+    {
+        // The fake node answered during last frame's RDM tick; deliver like network replies
+        if (FakeRDMNode)
+        {
+            TArray<TArray<uint8>> Replies;
+            FakeRDMNode->TakeReplies(Replies);
+            for (const TArray<uint8>& Reply : Replies)
+            {
+                RDM->HandlePacket(Reply.GetData(), Reply.Num(), FArtNetRDMFakeNode::NodeIP);
+            }
+        }
+        RDM->Tick(FPlatformTime::Seconds());
+    }
+}
+
+void FArtNetManager::UseIOReactor(ULBEASTIOReactorSubsystem* Reactor)
+{
+    UnregisterFromIOReactor();
+    if (!Reactor || !DiscoverySocket)
+    {
+        return;
+    }
+
+    IOReactorHandle = Reactor->RegisterSocket(DiscoverySocket,
+        FOnLBEASTIODatagrams::CreateRaw(this, &FArtNetManager::HandleIOReactorDatagrams),
+        TEXT("ArtNetDiscovery"));
+    if (IOReactorHandle >= 0)
+    {
+        IOReactor = Reactor;
+    }
+}
+
+void FArtNetManager::UnregisterFromIOReactor()
+{
+    if (IOReactorHandle >= 0)
+    {
+        if (ULBEASTIOReactorSubsystem* Reactor = IOReactor.Get())
+        {
+            Reactor->Unregister(IOReactorHandle);
+        }
+    }
+    IOReactorHandle = -1;
+    IOReactor.Reset();
+}
+
+void FArtNetManager::HandleIOReactorDatagrams(const TArray<FLBEASTIODatagram>& Datagrams)
+{
+    for (const FLBEASTIODatagram& Datagram : Datagrams)
+    {
+        uint32 SenderIP = 0;
+        if (Datagram.Sender.IsValid())
+        {
+            Datagram.Sender->GetIp(SenderIP);
+        }
+        FLBEASTSessionCapture::Get().Record(CaptureSource, ELBEASTCaptureDirection::Inbound, SenderIP, Datagram.Data.GetData(), Datagram.Data.Num(), Datagram.ReceiveTimeSeconds);
+        HandleDiscoveryPacket(Datagram.Data.GetData(), Datagram.Data.Num(), Datagram.Sender.IsValid() ? Datagram.Sender->ToString(false) : FString());
+    }
+}
+
+void FArtNetManager::HandleCaptureReplay(uint32 Address, const TArray<uint8>& Data)
+{
+    // Address is the node's IPv4 address, so replayed replies land on the same node entries
+    HandleDiscoveryPacket(Data.GetData(), Data.Num(), FIPv4Address(Address).ToString());
+}
+
+void FArtNetManager::SendDiscoveryPacket(const TArray<uint8>& Packet, const FInternetAddr& Destination, int32& OutBytesSent)
+{
+    DiscoverySocket->SendTo(Packet.GetData(), Packet.Num(), OutBytesSent, Destination);
+
+    uint32 DestinationIP = 0;
+    Destination.GetIp(DestinationIP);
+    FLBEASTSessionCapture::Get().Record(CaptureSource, ELBEASTCaptureDirection::Outbound, DestinationIP, Packet.GetData(), Packet.Num());
+}
+
+void FArtNetManager::EnableRDM(const FArtNetRDMEngine::FSettings& Settings)
+{
+    RDM = MakeUnique<FArtNetRDMEngine>();
+    RDM->Initialize(Settings, [this](const TArray<uint8>& Packet, const FString& NodeIP)
+    {
+        SendRDMPacket(Packet, NodeIP);
+    });
+}
+
+void FArtNetManager::SendRDMPacket(const TArray<uint8>& Packet, const FString& NodeIP)
+{
+    if (FakeRDMNode)
+    {
+        FakeRDMNode->HandlePacket(Packet);
+        return;
+    }
+    if (!DiscoverySocket || !SendAddr)
+    {
+        return;
+    }
+
+    // Table requests are broadcast; RDM commands go straight to the node that owns the port
+    FInternetAddr* Destination = SendAddr.Get();
+    if (!NodeIP.IsEmpty())
+    {
+        TSharedRef<FInternetAddr>* Cached = NodeAddresses.Find(NodeIP);
+        if (!Cached)
+        {
+            TSharedRef<FInternetAddr> Addr = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
+            bool bIsValid = false;
+            Addr->SetIp(*NodeIP, bIsValid);
+            Addr->SetPort(ArtNetPort);
+            if (!bIsValid)
+            {
+                UE_LOG(LogProLighting, Warning, TEXT("ArtNetManager: Bad node address %s"), *NodeIP);
+                return;
+            }
+            Cached = &NodeAddresses.Add(NodeIP, Addr);
+        }
+        Destination = &Cached->Get();
+    }
+
+    int32 BytesSent = 0;
+    SendDiscoveryPacket(Packet, *Destination, BytesSent);
 }
 
 bool FArtNetManager::IsConnected() const { return Transport && Transport->IsConnected(); }
@@ -76,10 +217,17 @@ void FArtNetManager::SendArtPoll()
     }
     TArray<uint8> Packet = BuildArtPollPacket();
     int32 BytesSent = 0;
-    DiscoverySocket->SendTo(Packet.GetData(), Packet.Num(), BytesSent, *SendAddr);
+    SendDiscoveryPacket(Packet, *SendAddr, BytesSent);
     if (BytesSent != Packet.Num())
     {
         UE_LOG(LogProLighting, Warning, TEXT("ArtNetManager: ArtPoll send incomplete (%d/%d)"), BytesSent, Packet.Num());
+        return;
+    }
+
+    LastPollSentSeconds = FPlatformTime::Seconds();
+    for (TPair<FString, FNodeHealth>& Entry : NodeHealth)
+    {
+        Entry.Value.bAwaitingPollReply = true;
     }
 }
 
@@ -129,13 +277,18 @@ bool FArtNetManager::InitializeDiscovery(uint16 InPort)
     SendAddr->SetBroadcastAddress();
     SendAddr->SetPort(InPort);
 
+    // ArtPoll/ArtPollReply and RDM traffic; ArtDmx output is captured by FArtNetTransport's UDP transport
+    CaptureSource = FLBEASTSessionCapture::Get().RegisterSource(FString::Printf(TEXT("Art-Net Discovery :%d"), (int32)InPort),
+        FOnLBEASTCaptureReplay::CreateRaw(this, &FArtNetManager::HandleCaptureReplay));
+
     UE_LOG(LogProLighting, Log, TEXT("ArtNetManager: Discovery initialized on port %d"), (int32)InPort);
     return true;
 }
 
 void FArtNetManager::ProcessIncoming()
 {
-    if (!DiscoverySocket)
+    // Reactor-registered sockets are delivered in batches by ULBEASTIOReactorSubsystem
+    if (!DiscoverySocket || IOReactorHandle >= 0)
     {
         return;
     }
@@ -149,27 +302,71 @@ void FArtNetManager::ProcessIncoming()
     {
         if (BytesRead > 0)
         {
-            TArray<uint8> PacketData;
-            PacketData.Append(ReceiveBuffer.GetData(), BytesRead);
+            uint32 SenderIP = 0;
+            SourceAddr->GetIp(SenderIP);
+            FLBEASTSessionCapture::Get().Record(CaptureSource, ELBEASTCaptureDirection::Inbound, SenderIP, ReceiveBuffer.GetData(), BytesRead);
+            HandleDiscoveryPacket(ReceiveBuffer.GetData(), BytesRead, SourceAddr->ToString(false));
+        }
+    }
+}
+
+void FArtNetManager::HandleDiscoveryPacket(const uint8* Data, int32 Num, const FString& SourceIP)
+{
+    const uint16 OpCode = FArtNetRDMCodec::ReadOpCode(Data, Num);
+    if (OpCode != FArtNetRDMCodec::OpPollReply)
+    {
+        if (RDM && !FakeRDMNode)
+        {
+            RDM->HandlePacket(Data, Num, SourceIP);
+        }
+        return;
+    }
 
-            FString SourceIP = SourceAddr->ToString(false);
-            FLBEASTArtNetNode Node;
-            if (ParseArtPollReply(PacketData, Node))
-            {
-                if (!DiscoveredNodes.Contains(SourceIP))
-                {
-                    Node.IPAddress = SourceIP;
-                    Node.LastSeenTimestamp = FDateTime::Now();
-                    DiscoveredNodes.Add(SourceIP, Node);
-                    OnNodeDiscoveredDelegate.Broadcast(Node);
-                    UE_LOG(LogProLighting, Log, TEXT("ArtNetManager: Discovered node: %s (%s)"), *Node.NodeName, *SourceIP);
-                }
-                else
-                {
-                    DiscoveredNodes[SourceIP].LastSeenTimestamp = FDateTime::Now();
-                }
-            }
+    TArray<uint8> PacketData;
+    PacketData.Append(Data, Num);
+
+    FLBEASTArtNetNode Node;
+    if (ParseArtPollReply(PacketData, Node))
+    {
+        if (!DiscoveredNodes.Contains(SourceIP))
+        {
+            Node.IPAddress = SourceIP;
+            Node.LastSeenTimestamp = FDateTime::Now();
+            DiscoveredNodes.Add(SourceIP, Node);
+            OnNodeDiscoveredDelegate.Broadcast(Node);
+            UE_LOG(LogProLighting, Log, TEXT("ArtNetManager: Discovered node: %s (%s)"), *Node.NodeName, *SourceIP);
         }
+        else
+        {
+            DiscoveredNodes[SourceIP].LastSeenTimestamp = FDateTime::Now();
+        }
+        ReportNodeHealth(SourceIP, DiscoveredNodes[SourceIP]);
+    }
+}
+
+void FArtNetManager::ReportNodeHealth(const FString& SourceIP, const FLBEASTArtNetNode& Node)
+{
+    FLBEASTDeviceHealthRegistry& Health = FLBEASTDeviceHealthRegistry::Get();
+
+    FNodeHealth* Entry = NodeHealth.Find(SourceIP);
+    if (!Entry)
+    {
+        // Nodes answer every ArtPoll; three missed polls is a lost node
+        FLBEASTDeviceHealthConfig NodeConfig;
+        NodeConfig.ExpectedIntervalSeconds = PollIntervalSeconds;
+        NodeConfig.TimeoutSeconds = PollIntervalSeconds * 3.0f;
+        Entry = &NodeHealth.Add(SourceIP);
+        Entry->Handle = Health.RegisterDevice(FString::Printf(TEXT("Art-Net %s (%s)"), *Node.NodeName, *SourceIP), TEXT("artnet"), NodeConfig);
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    Health.ReportPacket(Entry->Handle, Now);
+
+    // First reply since our last ArtPoll. Replies are read once per tick, so this RTT is frame-quantized.
+    if (Entry->bAwaitingPollReply)
+    {
+        Entry->bAwaitingPollReply = false;
+        Health.ReportRoundTrip(Entry->Handle, (float)((Now - LastPollSentSeconds) * 1000.0));
     }
 }
 
@@ -179,12 +376,10 @@ TArray<uint8> FArtNetManager::BuildArtPollPacket() const
     Packet.SetNumUninitialized(14);
     int32 Offset = 0;
     FMemory::Memcpy(Packet.GetData() + Offset, "Art-Net\0", 8); Offset += 8;
-    Packet[Offset++] = 0x20; Packet[Offset++] = 0x00; // OpCode ArtPoll
-    Packet[Offset++] = 0x0E; Packet[Offset++] = 0x00; // ProtVer 14
-    Packet[Offset++] = 0x02; // Flags
-    Packet[Offset++] = 0x07; // TalkToMe
-    Packet[Offset++] = 0x00;
-    Packet[Offset++] = 0x00;
+    Packet[Offset++] = 0x00; Packet[Offset++] = 0x20; // OpCode ArtPoll (little-endian)
+    Packet[Offset++] = 0x00; Packet[Offset++] = 0x0E; // ProtVer 14 (big-endian)
+    Packet[Offset++] = 0x02; // Flags: send ArtPollReply whenever node conditions change
+    Packet[Offset++] = 0x00; // DiagPriority
     return Packet;
 }
 
@@ -193,7 +388,7 @@ bool FArtNetManager::ParseArtPollReply(const TArray<uint8>& PacketData, FLBEASTA
     if (PacketData.Num() < 240) return false;
     if (FMemory::Memcmp(PacketData.GetData(), "Art-Net\0", 8) != 0) return false;
     uint16 OpCode = (uint16)PacketData[8] | ((uint16)PacketData[9] << 8);
-    if (OpCode != 0x0021) return false; // ArtPollReply
+    if (OpCode != FArtNetRDMCodec::OpPollReply) return false;
 
     int32 NameOffset = 26;
     OutNode.NodeName = FString(ANSI_TO_TCHAR((const char*)PacketData.GetData() + NameOffset));
@@ -0,0 +1,853 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "ProLighting/Public/ArtNetRDM.h"
+#include "ProLighting.h"
+
+DECLARE_CYCLE_STAT(TEXT("RDM Tick"), STAT_ProLighting_RDMTick, STATGROUP_LBEASTProLighting);
+DECLARE_DWORD_COUNTER_STAT(TEXT("RDM Requests Sent"), STAT_ProLighting_RDMRequests, STATGROUP_LBEASTProLighting);
+DECLARE_DWORD_COUNTER_STAT(TEXT("RDM Timeouts"), STAT_ProLighting_RDMTimeouts, STATGROUP_LBEASTProLighting);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("RDM In Flight"), STAT_ProLighting_RDMInFlight, STATGROUP_LBEASTProLighting);
+
+namespace
+{
+	/** Art-Net header (8) + opcode (2) + protocol version (2) + filler/spare up to Net */
+	constexpr int32 ArtAddressedHeaderSize = 24;
+	constexpr int32 ArtTodDataHeaderSize = 28;
+	constexpr int32 UIDSize = 6;
+
+	/** E1.20 reserves manufacturer IDs 0x7FF0-0x7FFF for prototypes; nothing shipping uses them */
+	constexpr uint64 ControllerManufacturerID = 0x7FF0;
+
+	void WriteUID(uint64 UID, TArray<uint8>& Out)
+	{
+		for (int32 Shift = 40; Shift >= 0; Shift -= 8)
+		{
+			Out.Add((uint8)(UID >> Shift));
+		}
+	}
+
+	uint64 ReadUID(const uint8* Data)
+	{
+		uint64 UID = 0;
+		for (int32 Index = 0; Index < UIDSize; ++Index)
+		{
+			UID = (UID << 8) | Data[Index];
+		}
+		return UID;
+	}
+
+	uint16 ReadBE16(const uint8* Data) { return (uint16)((Data[0] << 8) | Data[1]); }
+	uint32 ReadBE32(const uint8* Data) { return ((uint32)Data[0] << 24) | ((uint32)Data[1] << 16) | ((uint32)Data[2] << 8) | Data[3]; }
+
+	/** RDM text parameters are up to 32 ASCII characters, not necessarily terminated */
+	FString ReadLabel(const uint8* Data, int32 Num)
+	{
+		TArray<ANSICHAR, TInlineAllocator<33>> Text;
+		Text.Append((const ANSICHAR*)Data, FMath::Min(Num, 32));
+		Text.Add('\0');
+		return FString(ANSI_TO_TCHAR(Text.GetData())).TrimEnd();
+	}
+
+	/** E1.20 product categories for moving-head fixtures (fixture moving yoke / moving mirror) */
+	constexpr uint16 ProductCategoryMovingYoke = 0x0102;
+	constexpr uint16 ProductCategoryMovingMirror = 0x0103;
+
+	ELBEASTDMXFixtureType InferFixtureType(uint16 ProductCategory, int32 Footprint)
+	{
+		if (ProductCategory == ProductCategoryMovingYoke || ProductCategory == ProductCategoryMovingMirror)
+		{
+			return ELBEASTDMXFixtureType::MovingHead;
+		}
+		switch (Footprint)
+		{
+		case 1: return ELBEASTDMXFixtureType::Dimmable;
+		case 3: return ELBEASTDMXFixtureType::RGB;
+		case 4: return ELBEASTDMXFixtureType::RGBW;
+		default: return ELBEASTDMXFixtureType::Custom;
+		}
+	}
+
+	/** Round-robin poll steps; bit N of FDevice::UnsupportedPolls marks step N */
+	constexpr uint16 PollPids[] = { FArtNetRDMCodec::PidDMXStartAddress, FArtNetRDMCodec::PidStatusMessages, FArtNetRDMCodec::PidLampHours };
+	constexpr int32 NumPollSteps = UE_ARRAY_COUNT(PollPids);
+}
+
+// =====================================
+// FArtNetRDMCodec
+// =====================================
+
+FString FArtNetRDMCodec::FormatUID(uint64 UID)
+{
+	return FString::Printf(TEXT("%04X:%08X"), (uint32)((UID >> 32) & 0xFFFF), (uint32)(UID & 0xFFFFFFFF));
+}
+
+bool FArtNetRDMCodec::ParseUID(const FString& Text, uint64& OutUID)
+{
+	FString Manufacturer;
+	FString Device;
+	if (!Text.Split(TEXT(":"), &Manufacturer, &Device) || Manufacturer.IsEmpty() || Device.IsEmpty())
+	{
+		return false;
+	}
+	OutUID = ((FCString::Strtoui64(*Manufacturer, nullptr, 16) & 0xFFFF) << 32) | (FCString::Strtoui64(*Device, nullptr, 16) & 0xFFFFFFFF);
+	return true;
+}
+
+void FArtNetRDMCodec::WriteMessage(const FMessage& Message, TArray<uint8>& Out)
+{
+	const int32 Start = Out.Num();
+	const int32 DataLength = FMath::Min(Message.Data.Num(), 231);
+
+	Out.Add(SubStartCode);
+	Out.Add((uint8)(HeaderSize + 1 + DataLength)); // Message length counts the start code
+	WriteUID(Message.Destination, Out);
+	WriteUID(Message.Source, Out);
+	Out.Add(Message.Transaction);
+	Out.Add(Message.PortOrResponse);
+	Out.Add(Message.MessageCount);
+	Out.Add((uint8)(Message.SubDevice >> 8)); Out.Add((uint8)Message.SubDevice);
+	Out.Add(Message.CommandClass);
+	Out.Add((uint8)(Message.PID >> 8)); Out.Add((uint8)Message.PID);
+	Out.Add((uint8)DataLength);
+	Out.Append(Message.Data.GetData(), DataLength);
+
+	uint16 Checksum = StartCode;
+	for (int32 Index = Start; Index < Out.Num(); ++Index)
+	{
+		Checksum += Out[Index];
+	}
+	Out.Add((uint8)(Checksum >> 8)); Out.Add((uint8)Checksum);
+}
+
+bool FArtNetRDMCodec::ReadMessage(const uint8* Data, int32 Num, FMessage& OutMessage)
+{
+	if (Num < HeaderSize + 2 || Data[0] != SubStartCode)
+	{
+		return false;
+	}
+	const int32 DataLength = Data[22];
+	const int32 BodyLength = HeaderSize + DataLength;
+	if (Data[1] != BodyLength + 1 || Num < BodyLength + 2)
+	{
+		return false;
+	}
+
+	uint16 Checksum = StartCode;
+	for (int32 Index = 0; Index < BodyLength; ++Index)
+	{
+		Checksum += Data[Index];
+	}
+	if (Checksum != ReadBE16(Data + BodyLength))
+	{
+		return false;
+	}
+
+	OutMessage.Destination = ReadUID(Data + 2);
+	OutMessage.Source = ReadUID(Data + 8);
+	OutMessage.Transaction = Data[14];
+	OutMessage.PortOrResponse = Data[15];
+	OutMessage.MessageCount = Data[16];
+	OutMessage.SubDevice = ReadBE16(Data + 17);
+	OutMessage.CommandClass = Data[19];
+	OutMessage.PID = ReadBE16(Data + 20);
+	OutMessage.Data.Reset();
+	OutMessage.Data.Append(Data + HeaderSize, DataLength);
+	return true;
+}
+
+uint16 FArtNetRDMCodec::ReadOpCode(const uint8* Data, int32 Num)
+{
+	if (Num < 12 || FMemory::Memcmp(Data, "Art-Net\0", 8) != 0)
+	{
+		return 0;
+	}
+	return (uint16)(Data[8] | (Data[9] << 8));
+}
+
+void FArtNetRDMCodec::WriteHeader(uint16 OpCode, TArray<uint8>& Out)
+{
+	Out.Append((const uint8*)"Art-Net\0", 8);
+	Out.Add((uint8)OpCode); Out.Add((uint8)(OpCode >> 8));
+	Out.Add(0x00); Out.Add(0x0E); // ProtVer 14
+}
+
+void FArtNetRDMCodec::BuildTodRequest(uint8 Net, TConstArrayView<uint8> Addresses, TArray<uint8>& Out)
+{
+	const int32 Count = FMath::Min(Addresses.Num(), 32);
+	Out.Reset();
+	WriteHeader(OpTodRequest, Out);
+	Out.AddZeroed(9); // Filler, spare
+	Out.Add(Net & 0x7F);
+	Out.Add(0x00); // TodFull
+	Out.Add((uint8)Count);
+	Out.Append(Addresses.GetData(), Count);
+	Out.AddZeroed(32 - Count);
+}
+
+void FArtNetRDMCodec::BuildTodControl(uint8 Net, uint8 Address, uint8 Command, TArray<uint8>& Out)
+{
+	Out.Reset();
+	WriteHeader(OpTodControl, Out);
+	Out.AddZeroed(9);
+	Out.Add(Net & 0x7F);
+	Out.Add(Command);
+	Out.Add(Address);
+}
+
+void FArtNetRDMCodec::BuildTodData(uint8 Net, uint8 Address, uint8 Port, int32 UidTotal, uint8 BlockCount, TConstArrayView<uint64> Uids, TArray<uint8>& Out)
+{
+	const int32 Count = FMath::Min(Uids.Num(), MaxUidsPerTodBlock);
+	Out.Reset();
+	WriteHeader(OpTodData, Out);
+	Out.Add(0x01); // RdmVer: E1.20
+	Out.Add(Port);
+	Out.AddZeroed(6);
+	Out.Add(0x00); // BindIndex
+	Out.Add(Net & 0x7F);
+	Out.Add(0x00); // TodFull
+	Out.Add(Address);
+	Out.Add((uint8)(UidTotal >> 8)); Out.Add((uint8)UidTotal);
+	Out.Add(BlockCount);
+	Out.Add((uint8)Count);
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		WriteUID(Uids[Index], Out);
+	}
+}
+
+void FArtNetRDMCodec::BuildRdm(uint8 Net, uint8 Address, const FMessage& Message, TArray<uint8>& Out)
+{
+	Out.Reset();
+	WriteHeader(OpRdm, Out);
+	Out.Add(0x01); // RdmVer
+	Out.AddZeroed(8);
+	Out.Add(Net & 0x7F);
+	Out.Add(0x00); // ArProcess
+	Out.Add(Address);
+	WriteMessage(Message, Out);
+}
+
+bool FArtNetRDMCodec::ParseTodData(const uint8* Data, int32 Num, FTodBlock& OutBlock)
+{
+	if (Num < ArtTodDataHeaderSize || ReadOpCode(Data, Num) != OpTodData)
+	{
+		return false;
+	}
+	OutBlock.Net = Data[21];
+	OutBlock.CommandResponse = Data[22];
+	OutBlock.Address = Data[23];
+	OutBlock.UidTotal = ReadBE16(Data + 24);
+	OutBlock.BlockCount = Data[26];
+
+	const int32 Count = FMath::Min<int32>(Data[27], (Num - ArtTodDataHeaderSize) / UIDSize);
+	OutBlock.Uids.Reset(Count);
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		OutBlock.Uids.Add(ReadUID(Data + ArtTodDataHeaderSize + Index * UIDSize));
+	}
+	return true;
+}
+
+bool FArtNetRDMCodec::ParseAddressed(const uint8* Data, int32 Num, uint8& OutNet, TArray<uint8, TInlineAllocator<32>>& OutAddresses, uint8& OutCommand)
+{
+	const uint16 OpCode = ReadOpCode(Data, Num);
+	if (Num < ArtAddressedHeaderSize || (OpCode != OpTodRequest && OpCode != OpTodControl && OpCode != OpRdm))
+	{
+		return false;
+	}
+	OutNet = Data[21];
+	OutCommand = Data[22];
+	OutAddresses.Reset();
+	if (OpCode == OpTodRequest)
+	{
+		const int32 Count = FMath::Min<int32>(Data[23], Num - ArtAddressedHeaderSize);
+		OutAddresses.Append(Data + ArtAddressedHeaderSize, Count);
+	}
+	else
+	{
+		OutAddresses.Add(Data[23]);
+	}
+	return true;
+}
+
+// =====================================
+// FArtNetRDMEngine
+// =====================================
+
+void FArtNetRDMEngine::Initialize(const FSettings& InSettings, FSendFunction InSend)
+{
+	Settings = InSettings;
+	Settings.MaxInFlightPerPort = FMath::Max(1, Settings.MaxInFlightPerPort);
+	Settings.MaxRetries = FMath::Max(0, Settings.MaxRetries);
+	Settings.FailuresBeforeLost = FMath::Max(1, Settings.FailuresBeforeLost);
+	Send = MoveTemp(InSend);
+
+	// Random device ID so two controllers on one network do not answer for each other
+	const uint32 DeviceID = ((uint32)FMath::Rand() << 16) ^ (uint32)FMath::Rand();
+	ControllerUID = (ControllerManufacturerID << 32) | DeviceID;
+
+	Ports.Reset();
+	Devices.Reset();
+	TodUniverses.Reset();
+	Counters = FArtNetRDMStats();
+}
+
+void FArtNetRDMEngine::Discover(TConstArrayView<int32> Universes, bool bFull)
+{
+	for (int32 Universe = 0; Universes.Num() == 0 && Universe < 16; ++Universe)
+	{
+		TodUniverses.AddUnique(Universe);
+	}
+	for (int32 Universe : Universes)
+	{
+		TodUniverses.AddUnique(Universe & 0x0F);
+	}
+	SendTodRequests(bFull);
+	NextTodRefreshAt = LastTickSeconds + Settings.TodRefreshSeconds;
+}
+
+void FArtNetRDMEngine::SendTodRequests(bool bFlush)
+{
+	if (!Send || TodUniverses.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<uint8, TInlineAllocator<16>> Addresses;
+	for (int32 Universe : TodUniverses)
+	{
+		Addresses.Add(PortAddressLow(Universe));
+	}
+
+	TArray<uint8> Packet;
+	if (bFlush)
+	{
+		// Nodes answer a flush with ArtTodData once their line discovery finishes
+		for (uint8 Address : Addresses)
+		{
+			FArtNetRDMCodec::BuildTodControl(Settings.Net, Address, FArtNetRDMCodec::AtcFlush, Packet);
+			Send(Packet, FString());
+		}
+	}
+	FArtNetRDMCodec::BuildTodRequest(Settings.Net, Addresses, Packet);
+	Send(Packet, FString());
+}
+
+bool FArtNetRDMEngine::HandlePacket(const uint8* Data, int32 Num, const FString& SourceIP)
+{
+	switch (FArtNetRDMCodec::ReadOpCode(Data, Num))
+	{
+	case FArtNetRDMCodec::OpTodData:
+		HandleTodData(Data, Num, SourceIP);
+		return true;
+	case FArtNetRDMCodec::OpRdm:
+		HandleRdm(Data, Num, SourceIP);
+		return true;
+	case FArtNetRDMCodec::OpTodRequest:
+	case FArtNetRDMCodec::OpTodControl:
+		// Our own broadcasts coming back
+		return true;
+	default:
+		return false;
+	}
+}
+
+int32 FArtNetRDMEngine::FindOrAddPort(const FString& NodeIP, uint8 Address)
+{
+	for (int32 Index = 0; Index < Ports.Num(); ++Index)
+	{
+		if (Ports[Index].Address == Address && Ports[Index].NodeIP == NodeIP)
+		{
+			return Index;
+		}
+	}
+	FPort& Port = Ports.AddDefaulted_GetRef();
+	Port.NodeIP = NodeIP;
+	Port.Address = Address;
+	return Ports.Num() - 1;
+}
+
+void FArtNetRDMEngine::HandleTodData(const uint8* Data, int32 Num, const FString& SourceIP)
+{
+	FArtNetRDMCodec::FTodBlock Block;
+	if (!FArtNetRDMCodec::ParseTodData(Data, Num, Block) || Block.Net != (Settings.Net & 0x7F))
+	{
+		return;
+	}
+	if (Block.CommandResponse == FArtNetRDMCodec::TodNak)
+	{
+		UE_LOG(LogProLighting, Warning, TEXT("ArtNetRDM: Node %s could not build its device table for port-address 0x%02X"), *SourceIP, Block.Address);
+		return;
+	}
+
+	// Tables larger than one block arrive as BlockCount 0, 1, ... until UidTotal UIDs are in
+	const int32 PortIndex = FindOrAddPort(SourceIP, Block.Address);
+	FPort& Port = Ports[PortIndex];
+	if (Block.BlockCount == 0)
+	{
+		Port.PendingTod.Reset();
+	}
+	Port.PendingTod.Append(Block.Uids);
+	Port.PendingTodTotal = Block.UidTotal;
+	if (Port.PendingTod.Num() >= Port.PendingTodTotal)
+	{
+		ApplyTod(PortIndex);
+	}
+}
+
+void FArtNetRDMEngine::ApplyTod(int32 PortIndex)
+{
+	FPort& Port = Ports[PortIndex];
+	const int32 Universe = Port.Address & 0x0F;
+
+	// Gone from this port's table
+	for (uint64 UID : Port.DeviceUIDs)
+	{
+		FDevice* Device = Devices.Find(UID);
+		if (Device && Device->PortIndex == PortIndex && !Port.PendingTod.Contains(UID) && !Device->bLost)
+		{
+			Device->bLost = true;
+			DropQueued(UID);
+			DeviceLost.Broadcast(Device->Info.RDMUID);
+		}
+	}
+
+	Port.DeviceUIDs.Reset(Port.PendingTod.Num());
+	for (uint64 UID : Port.PendingTod)
+	{
+		Port.DeviceUIDs.Add(UID);
+
+		FDevice* Device = Devices.Find(UID);
+		if (!Device)
+		{
+			Device = &Devices.Add(UID);
+			Device->UID = UID;
+			Device->PortIndex = PortIndex;
+			Device->Info.RDMUID = FArtNetRDMCodec::FormatUID(UID);
+			Device->Info.ManufacturerID = (int32)((UID >> 32) & 0xFFFF);
+			Device->Info.Universe = Universe;
+			Device->Info.NodeIPAddress = Port.NodeIP;
+
+			Device->InterrogationPending = 4;
+			Enqueue(*Device, FArtNetRDMCodec::PidDeviceInfo, true);
+			Enqueue(*Device, FArtNetRDMCodec::PidManufacturerLabel, true);
+			Enqueue(*Device, FArtNetRDMCodec::PidDeviceModelDescription, true);
+			Enqueue(*Device, FArtNetRDMCodec::PidDeviceLabel, true);
+			continue;
+		}
+
+		if (Device->PortIndex != PortIndex)
+		{
+			// Re-cabled to another node or universe
+			DropQueued(UID);
+			Ports[Device->PortIndex].DeviceUIDs.Remove(UID);
+			Device->PortIndex = PortIndex;
+			Device->Info.Universe = Universe;
+			Device->Info.NodeIPAddress = Port.NodeIP;
+			Enqueue(*Device, FArtNetRDMCodec::PidDeviceInfo, false);
+		}
+		else if (Device->bLost)
+		{
+			// Back in the table; the answer to this brings it back online
+			Enqueue(*Device, FArtNetRDMCodec::PidDeviceInfo, false);
+		}
+	}
+
+	Port.PendingTod.Reset();
+	Port.PollCursor = 0;
+	UE_LOG(LogProLighting, Verbose, TEXT("ArtNetRDM: %s port-address 0x%02X lists %d devices"), *Port.NodeIP, Port.Address, Port.DeviceUIDs.Num());
+}
+
+void FArtNetRDMEngine::Enqueue(FDevice& Device, uint16 PID, bool bInterrogation, TConstArrayView<uint8> Params)
+{
+	FRequest& Request = Ports[Device.PortIndex].Queue.AddDefaulted_GetRef();
+	Request.UID = Device.UID;
+	Request.PID = PID;
+	Request.Params.Append(Params.GetData(), Params.Num());
+	Request.bInterrogation = bInterrogation;
+}
+
+void FArtNetRDMEngine::DropQueued(uint64 UID)
+{
+	if (const FDevice* Device = Devices.Find(UID))
+	{
+		Ports[Device->PortIndex].Queue.RemoveAll([UID](const FRequest& Request) { return Request.UID == UID; });
+	}
+}
+
+void FArtNetRDMEngine::HandleRdm(const uint8* Data, int32 Num, const FString& SourceIP)
+{
+	FArtNetRDMCodec::FMessage Message;
+	if (Num <= 24 || !FArtNetRDMCodec::ReadMessage(Data + 24, Num - 24, Message))
+	{
+		return;
+	}
+	if (Message.CommandClass != FArtNetRDMCodec::GetCommandResponse || Message.Destination != ControllerUID)
+	{
+		return;
+	}
+
+	const uint8 Address = Data[23];
+	FPort* Port = Ports.FindByPredicate([&](const FPort& P) { return P.Address == Address && P.NodeIP == SourceIP; });
+	if (!Port)
+	{
+		return;
+	}
+	const int32 InFlightIndex = Port->InFlight.IndexOfByPredicate([&Message](const FRequest& Request)
+	{
+		return Request.UID == Message.Source && Request.Transaction == Message.Transaction && Request.PID == Message.PID;
+	});
+	FDevice* Device = Devices.Find(Message.Source);
+	if (InFlightIndex == INDEX_NONE || !Device)
+	{
+		return; // Late answer to a request we already gave up on
+	}
+
+	FRequest Request = MoveTemp(Port->InFlight[InFlightIndex]);
+	Port->InFlight.RemoveAtSwap(InFlightIndex);
+	MarkResponded(*Device);
+
+	switch (Message.PortOrResponse)
+	{
+	case FArtNetRDMCodec::ResponseAck:
+		Request.Gathered.Append(Message.Data.GetData(), Message.Data.Num());
+		CompleteRequest(*Device, Request, true, Request.Gathered.GetData(), Request.Gathered.Num());
+		break;
+
+	case FArtNetRDMCodec::ResponseAckOverflow:
+		// More to come: ask again at once and keep what we have
+		Request.Gathered.Append(Message.Data.GetData(), Message.Data.Num());
+		Request.Attempts = 0;
+		Request.NotBefore = 0.0;
+		Port->Queue.Insert(MoveTemp(Request), 0);
+		break;
+
+	case FArtNetRDMCodec::ResponseAckTimer:
+	{
+		// Device is busy; the delay is in 100 ms units. Asking again after it is simpler than
+		// QUEUED_MESSAGE and gives the same answer for GETs.
+		const float DelaySeconds = Message.Data.Num() >= 2 ? ReadBE16(Message.Data.GetData()) * 0.1f : 0.1f;
+		Request.Attempts = 0;
+		Request.NotBefore = LastTickSeconds + DelaySeconds;
+		Port->Queue.Insert(MoveTemp(Request), 0);
+		break;
+	}
+
+	case FArtNetRDMCodec::ResponseNackReason:
+	default:
+	{
+		++Counters.Nacks;
+		const uint16 Reason = Message.Data.Num() >= 2 ? ReadBE16(Message.Data.GetData()) : 0;
+		if (Reason == FArtNetRDMCodec::NackUnknownPid || Reason == FArtNetRDMCodec::NackUnsupportedCommandClass)
+		{
+			for (int32 Step = 0; Step < NumPollSteps; ++Step)
+			{
+				if (PollPids[Step] == Request.PID)
+				{
+					Device->UnsupportedPolls |= (uint8)(1 << Step);
+				}
+			}
+		}
+		CompleteRequest(*Device, Request, false, nullptr, 0);
+		break;
+	}
+	}
+}
+
+void FArtNetRDMEngine::CompleteRequest(FDevice& Device, const FRequest& Request, bool bAck, const uint8* Data, int32 Num)
+{
+	const bool bChanged = bAck && ApplyResponse(Device, Request.PID, Data, Num);
+
+	if (Request.bInterrogation && Device.InterrogationPending > 0)
+	{
+		if (--Device.InterrogationPending == 0 && !Device.bInterrogated)
+		{
+			Device.bInterrogated = true;
+			Device.NextPollAt = LastTickSeconds + Settings.PollIntervalSeconds;
+			++Counters.Interrogated;
+			UE_LOG(LogProLighting, Log, TEXT("ArtNetRDM: %s %s (%s) at universe %d, address %d, %d channels"),
+				*Device.Info.RDMUID, *Device.Info.ModelName, *Device.Info.ManufacturerName, Device.Info.Universe, Device.Info.DMXAddress, Device.Info.ChannelCount);
+			DeviceChanged.Broadcast(Device.Info);
+		}
+		return;
+	}
+
+	if (bChanged && Device.bInterrogated)
+	{
+		DeviceChanged.Broadcast(Device.Info);
+	}
+}
+
+bool FArtNetRDMEngine::ApplyResponse(FDevice& Device, uint16 PID, const uint8* Data, int32 Num)
+{
+	FLBEASTDiscoveredFixture& Info = Device.Info;
+	switch (PID)
+	{
+	case FArtNetRDMCodec::PidDeviceInfo:
+	{
+		if (Num < FArtNetRDMCodec::DeviceInfoSize)
+		{
+			return false;
+		}
+		const int32 ModelID = ReadBE16(Data + 2);
+		const uint16 ProductCategory = ReadBE16(Data + 4);
+		const int32 Footprint = ReadBE16(Data + 10);
+		const uint16 StartAddress = ReadBE16(Data + 14);
+		const int32 Address = (StartAddress >= 1 && StartAddress <= 512) ? StartAddress : 0; // 0xFFFF = no footprint
+		const ELBEASTDMXFixtureType Type = InferFixtureType(ProductCategory, Footprint);
+
+		const bool bChanged = Info.ModelID != ModelID || Info.ChannelCount != FMath::Max(1, Footprint) || Info.DMXAddress != Address || Info.FixtureType != Type;
+		Info.ModelID = ModelID;
+		Info.ChannelCount = FMath::Max(1, Footprint);
+		Info.DMXAddress = Address;
+		Info.FixtureType = Type;
+		return bChanged;
+	}
+	case FArtNetRDMCodec::PidManufacturerLabel:
+	{
+		FString Label = ReadLabel(Data, Num);
+		const bool bChanged = Label != Info.ManufacturerName;
+		Info.ManufacturerName = MoveTemp(Label);
+		return bChanged;
+	}
+	case FArtNetRDMCodec::PidDeviceModelDescription:
+	{
+		FString Label = ReadLabel(Data, Num);
+		const bool bChanged = Label != Info.ModelName;
+		Info.ModelName = MoveTemp(Label);
+		return bChanged;
+	}
+	case FArtNetRDMCodec::PidDeviceLabel:
+	{
+		FString Label = ReadLabel(Data, Num);
+		const bool bChanged = Label != Info.DeviceLabel;
+		Info.DeviceLabel = MoveTemp(Label);
+		return bChanged;
+	}
+	case FArtNetRDMCodec::PidDMXStartAddress:
+	{
+		if (Num < 2)
+		{
+			return false;
+		}
+		const uint16 StartAddress = ReadBE16(Data);
+		const int32 Address = (StartAddress >= 1 && StartAddress <= 512) ? StartAddress : 0;
+		const bool bChanged = Info.DMXAddress != Address;
+		Info.DMXAddress = Address;
+		return bChanged;
+	}
+	case FArtNetRDMCodec::PidStatusMessages:
+	{
+		const int32 Count = Num / FArtNetRDMCodec::StatusMessageSize;
+		const bool bChanged = Info.StatusMessageCount != Count;
+		Info.StatusMessageCount = Count;
+		return bChanged;
+	}
+	case FArtNetRDMCodec::PidLampHours:
+	{
+		if (Num < 4)
+		{
+			return false;
+		}
+		const int32 Hours = (int32)FMath::Min<uint32>(ReadBE32(Data), MAX_int32);
+		const bool bChanged = Info.LampHours != Hours;
+		Info.LampHours = Hours;
+		return bChanged;
+	}
+	default:
+		return false;
+	}
+}
+
+void FArtNetRDMEngine::MarkResponded(FDevice& Device)
+{
+	++Counters.Responses;
+	Device.ConsecutiveFailures = 0;
+	DeviceResponded.Broadcast(Device.Info.RDMUID);
+	if (Device.bLost)
+	{
+		// Back from a power cycle or re-cable: report it again in case it was pruned meanwhile
+		Device.bLost = false;
+		if (Device.bInterrogated)
+		{
+			DeviceChanged.Broadcast(Device.Info);
+		}
+	}
+}
+
+void FArtNetRDMEngine::MarkFailed(FDevice& Device)
+{
+	if (++Device.ConsecutiveFailures >= Settings.FailuresBeforeLost && !Device.bLost)
+	{
+		Device.bLost = true;
+		DropQueued(Device.UID);
+		UE_LOG(LogProLighting, Log, TEXT("ArtNetRDM: %s stopped responding"), *Device.Info.RDMUID);
+		DeviceLost.Broadcast(Device.Info.RDMUID);
+	}
+}
+
+void FArtNetRDMEngine::SendRequest(FPort& Port, FRequest& Request, double NowSeconds)
+{
+	FArtNetRDMCodec::FMessage Message;
+	Message.Destination = Request.UID;
+	Message.Source = ControllerUID;
+	Message.Transaction = NextTransaction++;
+	Message.CommandClass = FArtNetRDMCodec::GetCommand;
+	Message.PID = Request.PID;
+	Message.Data.Append(Request.Params.GetData(), Request.Params.Num());
+
+	Request.Transaction = Message.Transaction;
+	Request.SentAt = NowSeconds;
+	++Request.Attempts;
+
+	TArray<uint8> Packet;
+	FArtNetRDMCodec::BuildRdm(Settings.Net, Port.Address, Message, Packet);
+	Send(Packet, Port.NodeIP);
+
+	Port.NextSendAt = NowSeconds + Settings.PortSpacingSeconds;
+	++Counters.RequestsSent;
+	PROLIGHTING_INC_COUNTER(STAT_ProLighting_RDMRequests, 1);
+}
+
+void FArtNetRDMEngine::Tick(double NowSeconds)
+{
+	PROLIGHTING_SCOPE_CYCLE_COUNTER(STAT_ProLighting_RDMTick);
+
+	LastTickSeconds = NowSeconds;
+	if (!Send)
+	{
+		return;
+	}
+
+	int32 InFlight = 0;
+	for (FPort& Port : Ports)
+	{
+		// Timeouts: retry, then count a failure against the device
+		for (int32 Index = Port.InFlight.Num() - 1; Index >= 0; --Index)
+		{
+			if (NowSeconds - Port.InFlight[Index].SentAt < Settings.RequestTimeoutSeconds)
+			{
+				continue;
+			}
+			FRequest Request = MoveTemp(Port.InFlight[Index]);
+			Port.InFlight.RemoveAtSwap(Index);
+			++Counters.Timeouts;
+			PROLIGHTING_INC_COUNTER(STAT_ProLighting_RDMTimeouts, 1);
+
+			if (Request.Attempts <= Settings.MaxRetries)
+			{
+				Request.NotBefore = 0.0;
+				Port.Queue.Insert(MoveTemp(Request), 0);
+			}
+			else if (FDevice* Device = Devices.Find(Request.UID))
+			{
+				if (Request.bInterrogation && Device->InterrogationPending > 0)
+				{
+					// Interrogate with what did arrive rather than never reporting the device
+					CompleteRequest(*Device, Request, false, nullptr, 0);
+				}
+				MarkFailed(*Device);
+			}
+		}
+
+		// Send: bounded in flight and spaced, so the node's DMX output is never held for long
+		while (Port.InFlight.Num() < Settings.MaxInFlightPerPort && NowSeconds >= Port.NextSendAt)
+		{
+			const int32 Ready = Port.Queue.IndexOfByPredicate([NowSeconds](const FRequest& Request) { return Request.NotBefore <= NowSeconds; });
+			if (Ready == INDEX_NONE)
+			{
+				break;
+			}
+			FRequest& Request = Port.InFlight.Add_GetRef(MoveTemp(Port.Queue[Ready]));
+			Port.Queue.RemoveAt(Ready);
+			SendRequest(Port, Request, NowSeconds);
+		}
+		InFlight += Port.InFlight.Num();
+	}
+
+	SchedulePolls(NowSeconds);
+
+	if (TodUniverses.Num() > 0 && NowSeconds >= NextTodRefreshAt)
+	{
+		NextTodRefreshAt = NowSeconds + Settings.TodRefreshSeconds;
+		SendTodRequests(false);
+	}
+
+	PROLIGHTING_SET_GAUGE(STAT_ProLighting_RDMInFlight, InFlight);
+}
+
+void FArtNetRDMEngine::SchedulePolls(double NowSeconds)
+{
+	for (FPort& Port : Ports)
+	{
+		// Only idle ports: interrogation and retries go first, and the poll backlog never builds up
+		if (Port.Queue.Num() > 0 || Port.InFlight.Num() > 0 || Port.DeviceUIDs.Num() == 0)
+		{
+			continue;
+		}
+
+		for (int32 Scanned = 0; Scanned < Port.DeviceUIDs.Num(); ++Scanned)
+		{
+			Port.PollCursor = (Port.PollCursor + 1) % Port.DeviceUIDs.Num();
+			FDevice* Device = Devices.Find(Port.DeviceUIDs[Port.PollCursor]);
+			if (!Device || !Device->bInterrogated || Device->bLost || NowSeconds < Device->NextPollAt)
+			{
+				continue;
+			}
+
+			Device->NextPollAt = NowSeconds + Settings.PollIntervalSeconds;
+			if (Device->UnsupportedPolls == (1 << NumPollSteps) - 1)
+			{
+				// Nothing optional supported: DEVICE_INFO is mandatory and still tells us it is there
+				Enqueue(*Device, FArtNetRDMCodec::PidDeviceInfo, false);
+				break;
+			}
+			do
+			{
+				Device->PollStep = (Device->PollStep + 1) % NumPollSteps;
+			}
+			while (Device->UnsupportedPolls & (1 << Device->PollStep));
+
+			const uint16 PID = PollPids[Device->PollStep];
+			if (PID == FArtNetRDMCodec::PidStatusMessages)
+			{
+				const uint8 StatusType = FArtNetRDMCodec::StatusWarning;
+				Enqueue(*Device, PID, false, MakeArrayView(&StatusType, 1));
+			}
+			else
+			{
+				Enqueue(*Device, PID, false);
+			}
+			break;
+		}
+	}
+}
+
+float FArtNetRDMEngine::GetPollCycleSeconds() const
+{
+	int32 MostDevices = 0;
+	for (const FPort& Port : Ports)
+	{
+		MostDevices = FMath::Max(MostDevices, Port.DeviceUIDs.Num());
+	}
+	const float PerRequest = FMath::Max(Settings.PortSpacingSeconds, 0.005f) / Settings.MaxInFlightPerPort;
+	return FMath::Max(Settings.PollIntervalSeconds, MostDevices * PerRequest);
+}
+
+FArtNetRDMStats FArtNetRDMEngine::GetStats() const
+{
+	FArtNetRDMStats Stats = Counters;
+	Stats.Devices = 0;
+	for (const TPair<uint64, FDevice>& Entry : Devices)
+	{
+		Stats.Devices += Entry.Value.bLost ? 0 : 1;
+	}
+	Stats.InFlight = 0;
+	Stats.Queued = 0;
+	for (const FPort& Port : Ports)
+	{
+		Stats.InFlight += Port.InFlight.Num();
+		Stats.Queued += Port.Queue.Num();
+	}
+	return Stats;
+}
@@ -0,0 +1,213 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "ProLighting/Public/ArtNetRDMFakeNode.h"
+#include "ProLighting/Public/ArtNetRDM.h"
+
+const TCHAR* FArtNetRDMFakeNode::NodeIP = TEXT("127.0.0.1");
+
+namespace
+{
+	/** Personalities handed out in turn: footprint, product category, model name */
+	struct FFakePersonality
+	{
+		uint16 Footprint;
+		uint16 ProductCategory;
+		const TCHAR* ModelName;
+	};
+	const FFakePersonality FakePersonalities[] =
+	{
+		{ 1, 0x0101, TEXT("Sim Dimmer") },
+		{ 3, 0x0101, TEXT("Sim RGB Par") },
+		{ 4, 0x0101, TEXT("Sim RGBW Par") },
+		{ 16, 0x0102, TEXT("Sim Moving Head") },
+	};
+
+	/** Manufacturer ID used for simulated devices (prototype range) */
+	constexpr uint64 FakeManufacturerID = 0x7FFE;
+
+	void AppendBE16(TArray<uint8, TInlineAllocator<32>>& Out, uint16 Value)
+	{
+		Out.Add((uint8)(Value >> 8)); Out.Add((uint8)Value);
+	}
+
+	void AppendLabel(TArray<uint8, TInlineAllocator<32>>& Out, const FString& Label)
+	{
+		const FTCHARToUTF8 Text(*Label.Left(32));
+		Out.Append((const uint8*)Text.Get(), FMath::Min(Text.Length(), 32));
+	}
+}
+
+void FArtNetRDMFakeNode::PopulateRig(uint8 InNet, uint8 SubNet, int32 Count)
+{
+	Net = InNet & 0x7F;
+	Devices.Reset(Count);
+
+	int32 Universe = 0;
+	int32 NextChannel = 1;
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const FFakePersonality& Personality = FakePersonalities[Index % UE_ARRAY_COUNT(FakePersonalities)];
+		if (NextChannel + Personality.Footprint - 1 > 512)
+		{
+			++Universe;
+			NextChannel = 1;
+		}
+		if (Universe > 15)
+		{
+			UE_LOG(LogProLighting, Warning, TEXT("ArtNetRDMFakeNode: Rig full at %d fixtures (one SubNet)"), Index);
+			break;
+		}
+
+		FFakeDevice& Device = Devices.AddDefaulted_GetRef();
+		Device.UID = (FakeManufacturerID << 32) | (uint32)(0x1000 + Index);
+		Device.Address = (uint8)(((SubNet & 0x0F) << 4) | Universe);
+		Device.StartAddress = (uint16)NextChannel;
+		Device.Footprint = Personality.Footprint;
+		Device.ProductCategory = Personality.ProductCategory;
+		Device.ModelID = (uint16)(1 + Index % UE_ARRAY_COUNT(FakePersonalities));
+		Device.ModelName = Personality.ModelName;
+		Device.DeviceLabel = FString::Printf(TEXT("Sim %d"), Index + 1);
+		Device.LampHours = (uint32)(Index * 7);
+		NextChannel += Personality.Footprint;
+	}
+	UE_LOG(LogProLighting, Log, TEXT("ArtNetRDMFakeNode: Simulating %d RDM fixtures on %d universes"), Devices.Num(), Universe + 1);
+}
+
+void FArtNetRDMFakeNode::HandlePacket(const TArray<uint8>& Packet)
+{
+	uint8 PacketNet = 0;
+	uint8 Command = 0;
+	TArray<uint8, TInlineAllocator<32>> Addresses;
+	if (!FArtNetRDMCodec::ParseAddressed(Packet.GetData(), Packet.Num(), PacketNet, Addresses, Command) || PacketNet != Net)
+	{
+		return;
+	}
+
+	switch (FArtNetRDMCodec::ReadOpCode(Packet.GetData(), Packet.Num()))
+	{
+	case FArtNetRDMCodec::OpTodRequest:
+		for (uint8 Address : Addresses)
+		{
+			SendTod(Address);
+		}
+		break;
+	case FArtNetRDMCodec::OpTodControl:
+		if (Command == FArtNetRDMCodec::AtcFlush)
+		{
+			SendTod(Addresses[0]);
+		}
+		break;
+	case FArtNetRDMCodec::OpRdm:
+		AnswerRdm(Packet);
+		break;
+	default:
+		break;
+	}
+}
+
+void FArtNetRDMFakeNode::SendTod(uint8 Address)
+{
+	TArray<uint64> Uids;
+	for (const FFakeDevice& Device : Devices)
+	{
+		if (Device.Address == Address && !Device.bUnplugged)
+		{
+			Uids.Add(Device.UID);
+		}
+	}
+
+	// An empty table is still answered, so the controller sees devices leave
+	int32 Block = 0;
+	do
+	{
+		const int32 First = Block * FArtNetRDMCodec::MaxUidsPerTodBlock;
+		const int32 Count = FMath::Clamp(Uids.Num() - First, 0, FArtNetRDMCodec::MaxUidsPerTodBlock);
+		TArray<uint8>& Reply = Replies.AddDefaulted_GetRef();
+		FArtNetRDMCodec::BuildTodData(Net, Address, 1, Uids.Num(), (uint8)Block, MakeArrayView(Uids.GetData() + First, Count), Reply);
+		++Block;
+	}
+	while (Block * FArtNetRDMCodec::MaxUidsPerTodBlock < Uids.Num());
+}
+
+void FArtNetRDMFakeNode::AnswerRdm(const TArray<uint8>& Packet)
+{
+	FArtNetRDMCodec::FMessage Request;
+	if (Packet.Num() <= 24 || !FArtNetRDMCodec::ReadMessage(Packet.GetData() + 24, Packet.Num() - 24, Request) || Request.CommandClass != FArtNetRDMCodec::GetCommand)
+	{
+		return;
+	}
+	const uint8 Address = Packet[23];
+	const FFakeDevice* Device = Devices.FindByPredicate([&](const FFakeDevice& D) { return D.UID == Request.Destination && D.Address == Address; });
+	if (!Device || Device->bUnplugged || (DropRate > 0.0f && FMath::FRand() < DropRate))
+	{
+		return;
+	}
+
+	FArtNetRDMCodec::FMessage Response;
+	Response.Destination = Request.Source;
+	Response.Source = Device->UID;
+	Response.Transaction = Request.Transaction;
+	Response.PortOrResponse = FArtNetRDMCodec::ResponseAck;
+	Response.CommandClass = FArtNetRDMCodec::GetCommandResponse;
+	Response.PID = Request.PID;
+
+	switch (Request.PID)
+	{
+	case FArtNetRDMCodec::PidDeviceInfo:
+		AppendBE16(Response.Data, 0x0100); // RDM protocol 1.0
+		AppendBE16(Response.Data, Device->ModelID);
+		AppendBE16(Response.Data, Device->ProductCategory);
+		Response.Data.Append({ 0, 0, 0, 1 }); // Software version
+		AppendBE16(Response.Data, Device->Footprint);
+		Response.Data.Append({ 1, 1 }); // Personality 1 of 1
+		AppendBE16(Response.Data, Device->StartAddress);
+		AppendBE16(Response.Data, 0); // Sub-devices
+		Response.Data.Add(0); // Sensors
+		break;
+	case FArtNetRDMCodec::PidManufacturerLabel:
+		AppendLabel(Response.Data, TEXT("LBEAST Simulated"));
+		break;
+	case FArtNetRDMCodec::PidDeviceModelDescription:
+		AppendLabel(Response.Data, Device->ModelName);
+		break;
+	case FArtNetRDMCodec::PidDeviceLabel:
+		AppendLabel(Response.Data, Device->DeviceLabel);
+		break;
+	case FArtNetRDMCodec::PidDMXStartAddress:
+		AppendBE16(Response.Data, Device->StartAddress);
+		break;
+	case FArtNetRDMCodec::PidStatusMessages:
+		for (int32 Index = 0; Index < Device->StatusMessages; ++Index)
+		{
+			AppendBE16(Response.Data, 0); // Root device
+			Response.Data.Add(FArtNetRDMCodec::StatusWarning);
+			AppendBE16(Response.Data, 0x0001); // STS_CAL_FAIL
+			AppendBE16(Response.Data, 0);
+			AppendBE16(Response.Data, 0);
+		}
+		break;
+	case FArtNetRDMCodec::PidLampHours:
+		if (Device->ProductCategory == 0x0102)
+		{
+			AppendBE16(Response.Data, (uint16)(Device->LampHours >> 16));
+			AppendBE16(Response.Data, (uint16)Device->LampHours);
+			break;
+		}
+		// LED fixtures have no lamp
+		[[fallthrough]];
+	default:
+		Response.PortOrResponse = FArtNetRDMCodec::ResponseNackReason;
+		Response.Data.Reset();
+		AppendBE16(Response.Data, FArtNetRDMCodec::NackUnknownPid);
+		break;
+	}
+
+	TArray<uint8>& Reply = Replies.AddDefaulted_GetRef();
+	FArtNetRDMCodec::BuildRdm(Net, Address, Response, Reply);
+}
+
+void FArtNetRDMFakeNode::TakeReplies(TArray<TArray<uint8>>& OutReplies)
+{
+	OutReplies = MoveTemp(Replies);
+	Replies.Reset();
+}
@@ -0,0 +1,345 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "ProLighting/Public/FixtureRegistry.h"
+#include "Algo/BinarySearch.h"
+
+DECLARE_CYCLE_STAT(TEXT("Fixture Registry Reindex"), STAT_ProLighting_RegistryReindex, STATGROUP_LBEASTProLighting);
+DECLARE_CYCLE_STAT(TEXT("Fixture Query"), STAT_ProLighting_FixtureQuery, STATGROUP_LBEASTProLighting);
+
+namespace
+{
+	/** Registry order: universe, start address, then ID so the order is total */
+	bool FixtureOrderLess(const FLBEASTDMXFixture& A, const FLBEASTDMXFixture& B)
+	{
+		if (A.Universe != B.Universe) return A.Universe < B.Universe;
+		if (A.DMXChannel != B.DMXChannel) return A.DMXChannel < B.DMXChannel;
+		return A.VirtualFixtureID < B.VirtualFixtureID;
+	}
+}
+
+bool FFixtureRegistry::Register(const FLBEASTDMXFixture& Fixture)
+{
+	if (bIndexDirty)
+	{
+		// Stays stale (rebuilt once on the next lookup); a linear check beats a rebuild per fixture
+		if (Fixtures.ContainsByPredicate([&Fixture](const FLBEASTDMXFixture& F) { return F.VirtualFixtureID == Fixture.VirtualFixtureID; }))
+		{
+			return false;
+		}
+		Fixtures.Add(Fixture);
+		Serial++;
+		return true;
+	}
+
+	if (IndexByID.Contains(Fixture.VirtualFixtureID))
+	{
+		return false;
+	}
+	InsertIndexed(Fixture);
+	Serial++;
+	return true;
+}
+
+void FFixtureRegistry::Unregister(int32 VirtualFixtureID)
+{
+	if (bIndexDirty)
+	{
+		const int32 Index = Fixtures.IndexOfByPredicate([VirtualFixtureID](const FLBEASTDMXFixture& F) { return F.VirtualFixtureID == VirtualFixtureID; });
+		if (Index != INDEX_NONE)
+		{
+			Fixtures.RemoveAt(Index, 1, EAllowShrinking::No);
+			Serial++;
+		}
+	}
+	else if (const int32* Index = IndexByID.Find(VirtualFixtureID))
+	{
+		RemoveIndexed(*Index);
+		Serial++;
+	}
+	FString UID;
+	if (VirtualToRDM.RemoveAndCopyValue(VirtualFixtureID, UID))
+	{
+		RDMToVirtual.Remove(UID);
+	}
+}
+
+void FFixtureRegistry::Assign(TArray<FLBEASTDMXFixture>&& InFixtures)
+{
+	Reset();
+	Fixtures = MoveTemp(InFixtures);
+	MarkChanged();
+}
+
+const FLBEASTDMXFixture* FFixtureRegistry::Find(int32 VirtualFixtureID) const
+{
+	const int32 Index = IndexOf(VirtualFixtureID);
+	return Index != INDEX_NONE ? &Fixtures[Index] : nullptr;
+}
+
+FLBEASTDMXFixture* FFixtureRegistry::FindMutable(int32 VirtualFixtureID)
+{
+	const int32 Index = IndexOf(VirtualFixtureID);
+	return Index != INDEX_NONE ? &Fixtures[Index] : nullptr;
+}
+
+void FFixtureRegistry::MarkChanged()
+{
+	bIndexDirty = true;
+	// Now rather than at the rebuild, so a serial read before the next lookup already differs
+	Serial++;
+}
+
+void FFixtureRegistry::InsertIndexed(const FLBEASTDMXFixture& Fixture)
+{
+	const int32 Index = Algo::UpperBound(Fixtures, Fixture, &FixtureOrderLess);
+	Fixtures.Insert(Fixture, Index);
+	Layouts.Insert(FFixtureDrivers::Compile(Fixture), Index);
+	FixtureIDs.Insert(Fixture.VirtualFixtureID, Index);
+
+	for (TPair<int32, int32>& Pair : IndexByID)
+	{
+		Pair.Value += Pair.Value >= Index ? 1 : 0;
+	}
+	IndexByID.Add(Fixture.VirtualFixtureID, Index);
+
+	// Every bitset spans the whole registry; sets this fixture introduces are added after
+	const int32 Count = Fixtures.Num();
+	for (TPair<FName, TBitArray<>>& Pair : GroupBits)
+	{
+		Pair.Value.Insert(Fixture.Groups.Contains(Pair.Key), Index);
+	}
+	for (TPair<FName, TBitArray<>>& Pair : TagBits)
+	{
+		Pair.Value.Insert(Fixture.Tags.Contains(Pair.Key), Index);
+	}
+	for (TPair<int32, TBitArray<>>& Pair : ZoneBits)
+	{
+		Pair.Value.Insert(Fixture.Zone == Pair.Key, Index);
+	}
+
+	for (const FName& Group : Fixture.Groups)
+	{
+		if (!GroupBits.Contains(Group))
+		{
+			GroupBits.Add(Group, TBitArray<>(false, Count))[Index] = true;
+		}
+	}
+	for (const FName& Tag : Fixture.Tags)
+	{
+		if (!TagBits.Contains(Tag))
+		{
+			TagBits.Add(Tag, TBitArray<>(false, Count))[Index] = true;
+		}
+	}
+	if (Fixture.Zone > 0 && !ZoneBits.Contains(Fixture.Zone))
+	{
+		ZoneBits.Add(Fixture.Zone, TBitArray<>(false, Count))[Index] = true;
+	}
+}
+
+void FFixtureRegistry::RemoveIndexed(int32 Index)
+{
+	IndexByID.Remove(FixtureIDs[Index]);
+	for (TPair<int32, int32>& Pair : IndexByID)
+	{
+		Pair.Value -= Pair.Value > Index ? 1 : 0;
+	}
+
+	Fixtures.RemoveAt(Index, 1, EAllowShrinking::No);
+	Layouts.RemoveAt(Index, 1, EAllowShrinking::No);
+	FixtureIDs.RemoveAt(Index, 1, EAllowShrinking::No);
+
+	for (TPair<FName, TBitArray<>>& Pair : GroupBits)
+	{
+		Pair.Value.RemoveAt(Index);
+	}
+	for (TPair<FName, TBitArray<>>& Pair : TagBits)
+	{
+		Pair.Value.RemoveAt(Index);
+	}
+	for (TPair<int32, TBitArray<>>& Pair : ZoneBits)
+	{
+		Pair.Value.RemoveAt(Index);
+	}
+}
+
+bool FFixtureRegistry::Relocate(int32 VirtualFixtureID, int32 NewDMXChannel)
+{
+	FLBEASTDMXFixture* Fixture = FindMutable(VirtualFixtureID);
+	if (!Fixture)
+	{
+		return false;
+	}
+	Fixture->DMXChannel = NewDMXChannel;
+	MarkChanged();
+	return true;
+}
+
+const FFixtureChannelLayout* FFixtureRegistry::FindLayout(int32 VirtualFixtureID) const
+{
+	const int32 Index = IndexOf(VirtualFixtureID);
+	return Index != INDEX_NONE ? &Layouts[Index] : nullptr;
+}
+
+int32 FFixtureRegistry::IndexOf(int32 VirtualFixtureID) const
+{
+	EnsureIndexed();
+	const int32* Index = IndexByID.Find(VirtualFixtureID);
+	return Index ? *Index : INDEX_NONE;
+}
+
+const FLBEASTDMXFixture* FFixtureRegistry::FindOverlap(int32 Universe, int32 FirstChannel, int32 LastChannel) const
+{
+	EnsureIndexed();
+
+	// First fixture on the universe starting after LastChannel; only fixtures before it can overlap
+	const int32 End = Algo::UpperBoundBy(Fixtures, TPair<int32, int32>(Universe, LastChannel),
+		[](const FLBEASTDMXFixture& F) { return TPair<int32, int32>(F.Universe, F.DMXChannel); });
+
+	// Walk back through the universe; fixtures moved by RDM are not validated, so do not assume the nearest is the only candidate
+	for (int32 Index = End - 1; Index >= 0 && Fixtures[Index].Universe == Universe; --Index)
+	{
+		const FLBEASTDMXFixture& Existing = Fixtures[Index];
+		if (Existing.DMXChannel + Existing.ChannelCount - 1 >= FirstChannel)
+		{
+			return &Existing;
+		}
+	}
+	return nullptr;
+}
+
+void FFixtureRegistry::Query(const FLBEASTFixtureQuery& InQuery, TArray<FFixtureSpan>& OutSpans) const
+{
+	PROLIGHTING_SCOPE_CYCLE_COUNTER(STAT_ProLighting_FixtureQuery);
+	EnsureIndexed();
+	OutSpans.Reset();
+
+	// Universes are contiguous in registry order
+	int32 RangeBegin = 0;
+	int32 RangeEnd = Fixtures.Num();
+	if (InQuery.Universe >= 0)
+	{
+		auto UniverseOf = [](const FLBEASTDMXFixture& F) { return F.Universe; };
+		RangeBegin = Algo::LowerBoundBy(Fixtures, InQuery.Universe, UniverseOf);
+		RangeEnd = Algo::UpperBoundBy(Fixtures, InQuery.Universe, UniverseOf);
+	}
+	if (RangeBegin >= RangeEnd)
+	{
+		return;
+	}
+
+	const bool bFiltered = InQuery.Groups.Num() > 0 || InQuery.Tags.Num() > 0 || InQuery.Zone > 0;
+	if (!bFiltered)
+	{
+		OutSpans.Add({ RangeBegin, RangeEnd - RangeBegin });
+		return;
+	}
+
+	TBitArray<> Match(true, Fixtures.Num());
+	if (InQuery.Groups.Num() > 0)
+	{
+		TBitArray<> AnyGroup(false, Fixtures.Num());
+		for (const FName& Group : InQuery.Groups)
+		{
+			if (const TBitArray<>* Bits = GroupBits.Find(Group))
+			{
+				AnyGroup.CombineWithBitwiseOR(*Bits, EBitwiseOperatorFlags::MaintainSize);
+			}
+		}
+		Match.CombineWithBitwiseAND(AnyGroup, EBitwiseOperatorFlags::MaintainSize);
+	}
+	for (const FName& Tag : InQuery.Tags)
+	{
+		const TBitArray<>* Bits = TagBits.Find(Tag);
+		if (!Bits)
+		{
+			return;
+		}
+		Match.CombineWithBitwiseAND(*Bits, EBitwiseOperatorFlags::MaintainSize);
+	}
+	if (InQuery.Zone > 0)
+	{
+		const TBitArray<>* Bits = ZoneBits.Find(InQuery.Zone);
+		if (!Bits)
+		{
+			return;
+		}
+		Match.CombineWithBitwiseAND(*Bits, EBitwiseOperatorFlags::MaintainSize);
+	}
+
+	for (TConstSetBitIterator<> It(Match, RangeBegin); It && It.GetIndex() < RangeEnd; ++It)
+	{
+		const int32 Index = It.GetIndex();
+		if (OutSpans.Num() > 0 && OutSpans.Last().First + OutSpans.Last().Num == Index)
+		{
+			OutSpans.Last().Num++;
+		}
+		else
+		{
+			OutSpans.Add({ Index, 1 });
+		}
+	}
+}
+
+void FFixtureRegistry::EnsureIndexed() const
+{
+	if (!bIndexDirty)
+	{
+		return;
+	}
+	PROLIGHTING_SCOPE_CYCLE_COUNTER(STAT_ProLighting_RegistryReindex);
+	bIndexDirty = false;
+
+	// Stable for equal keys is not needed: the ID breaks ties
+	Fixtures.Sort(&FixtureOrderLess);
+
+	const int32 Count = Fixtures.Num();
+	Layouts.Reset(Count);
+	FixtureIDs.Reset(Count);
+	IndexByID.Reset();
+	GroupBits.Reset();
+	TagBits.Reset();
+	ZoneBits.Reset();
+
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const FLBEASTDMXFixture& Fixture = Fixtures[Index];
+		Layouts.Add(FFixtureDrivers::Compile(Fixture));
+		FixtureIDs.Add(Fixture.VirtualFixtureID);
+		IndexByID.Add(Fixture.VirtualFixtureID, Index);
+
+		for (const FName& Group : Fixture.Groups)
+		{
+			TBitArray<>& Bits = GroupBits.FindOrAdd(Group);
+			Bits.SetNum(Count, false);
+			Bits[Index] = true;
+		}
+		for (const FName& Tag : Fixture.Tags)
+		{
+			TBitArray<>& Bits = TagBits.FindOrAdd(Tag);
+			Bits.SetNum(Count, false);
+			Bits[Index] = true;
+		}
+		if (Fixture.Zone > 0)
+		{
+			TBitArray<>& Bits = ZoneBits.FindOrAdd(Fixture.Zone);
+			Bits.SetNum(Count, false);
+			Bits[Index] = true;
+		}
+	}
+}
+
+void FFixtureRegistry::Reset()
+{
+	Fixtures.Reset();
+	Layouts.Reset();
+	FixtureIDs.Reset();
+	IndexByID.Reset();
+	GroupBits.Reset();
+	TagBits.Reset();
+	ZoneBits.Reset();
+	bIndexDirty = false;
+	Serial++;
+	VirtualToRDM.Reset();
+	RDMToVirtual.Reset();
+}
@@ -2,8 +2,12 @@
 
 #include "ProLighting/Public/FixtureService.h"
 #include "ProLighting/Public/RDMService.h"
+#include "ProLighting/Public/LightingShowFile.h"
 #include "ProLighting/Public/ProLightingController.h"
 
+DECLARE_CYCLE_STAT(TEXT("Fixture Batch Apply"), STAT_ProLighting_FixtureBatch, STATGROUP_LBEASTProLighting);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Fixture Writes"), STAT_ProLighting_FixtureWrites, STATGROUP_LBEASTProLighting);
+
 FFixtureService::FFixtureService(FUniverseBuffer& InBuffer)
 	: Buffer(InBuffer) {}
 
@@ -39,16 +43,267 @@ void FFixtureService::Unregister(int32 VirtualFixtureID)
 	Fade.Cancel(VirtualFixtureID);
 }
 
+int32 FFixtureService::LoadPatch(TArray<FLBEASTDMXFixture>&& Fixtures)
+{
+	Fade.Reset();
+	for (const FLBEASTDMXFixture& Fixture : Fixtures)
+	{
+		Buffer.EnsureUniverse(Fixture.Universe);
+		NextVirtualFixtureID = FMath::Max(NextVirtualFixtureID, Fixture.VirtualFixtureID + 1);
+	}
+	const int32 Count = Fixtures.Num();
+	Registry.Assign(MoveTemp(Fixtures));
+	return Count;
+}
+
+int32 FFixtureService::RecallCue(const FLightingShowFile& File, int32 CueIndex)
+{
+	Fade.Reset();
+	return File.RecallCue(CueIndex, Buffer);
+}
+
+const FFixtureChannelLayout* FFixtureService::FindLayout(int32 VirtualFixtureID) const
+{
+	return Registry.FindLayout(VirtualFixtureID);
+}
+
+uint8* FFixtureService::ResolveUniverse(int32 Universe, int32& CachedUniverse, uint8*& CachedData)
+{
+	if (CachedData && CachedUniverse == Universe)
+	{
+		return CachedData;
+	}
+
+	CachedUniverse = Universe;
+	CachedData = Buffer.GetUniverseData(Universe);
+	if (!CachedData)
+	{
+		// Only after the buffer was reset - registration creates the universe
+		Buffer.EnsureUniverse(Universe);
+		CachedData = Buffer.GetUniverseData(Universe);
+	}
+	return CachedData;
+}
+
 void FFixtureService::ApplyIntensity(const FLBEASTDMXFixture& Fixture, float Intensity)
 {
-	TUniquePtr<IFixtureDriver> Driver = FFixtureDriverFactory::Create(Fixture.FixtureType);
-	Driver->ApplyIntensity(Fixture, Intensity, Buffer);
+	const FFixtureChannelLayout Layout = FFixtureDrivers::Compile(Fixture);
+	int32 CachedUniverse = INDEX_NONE;
+	uint8* CachedData = nullptr;
+	if (uint8* Data = ResolveUniverse(Layout.Universe, CachedUniverse, CachedData))
+	{
+		FFixtureDrivers::WriteIntensity(Layout, Intensity, Data);
+	}
 }
 
 void FFixtureService::ApplyColor(const FLBEASTDMXFixture& Fixture, float Red, float Green, float Blue, float White)
 {
-	TUniquePtr<IFixtureDriver> Driver = FFixtureDriverFactory::Create(Fixture.FixtureType);
-	Driver->ApplyColor(Fixture, Red, Green, Blue, White, Buffer);
+	const FFixtureChannelLayout Layout = FFixtureDrivers::Compile(Fixture);
+	int32 CachedUniverse = INDEX_NONE;
+	uint8* CachedData = nullptr;
+	if (uint8* Data = ResolveUniverse(Layout.Universe, CachedUniverse, CachedData))
+	{
+		FFixtureDrivers::WriteColor(Layout, Red, Green, Blue, White, Data);
+	}
+}
+
+int32 FFixtureService::ApplyIntensityBatch(TConstArrayView<int32> VirtualFixtureIDs, TConstArrayView<float> Intensities)
+{
+	PROLIGHTING_SCOPE_CYCLE_COUNTER(STAT_ProLighting_FixtureBatch);
+	if (Intensities.Num() != 1 && Intensities.Num() != VirtualFixtureIDs.Num())
+	{
+		UE_LOG(LogProLighting, Warning, TEXT("FixtureService: Intensity batch has %d values for %d fixtures"), Intensities.Num(), VirtualFixtureIDs.Num());
+		return 0;
+	}
+
+	const bool bNotify = IntensityChanged.IsBound();
+	int32 CachedUniverse = INDEX_NONE;
+	uint8* CachedData = nullptr;
+	int32 Written = 0;
+
+	for (int32 i = 0; i < VirtualFixtureIDs.Num(); i++)
+	{
+		const FFixtureChannelLayout* Layout = FindLayout(VirtualFixtureIDs[i]);
+		uint8* Data = Layout ? ResolveUniverse(Layout->Universe, CachedUniverse, CachedData) : nullptr;
+		if (!Data)
+		{
+			continue;
+		}
+
+		const float Intensity = FMath::Clamp(Intensities[Intensities.Num() == 1 ? 0 : i], 0.0f, 1.0f);
+		FFixtureDrivers::WriteIntensity(*Layout, Intensity, Data);
+		Written++;
+		if (bNotify)
+		{
+			IntensityChanged.Broadcast(VirtualFixtureIDs[i], Intensity);
+		}
+	}
+
+	PROLIGHTING_INC_COUNTER(STAT_ProLighting_FixtureWrites, Written);
+	return Written;
+}
+
+int32 FFixtureService::ApplyColorBatch(TConstArrayView<int32> VirtualFixtureIDs, TConstArrayView<FLinearColor> Colors)
+{
+	PROLIGHTING_SCOPE_CYCLE_COUNTER(STAT_ProLighting_FixtureBatch);
+	if (Colors.Num() != 1 && Colors.Num() != VirtualFixtureIDs.Num())
+	{
+		UE_LOG(LogProLighting, Warning, TEXT("FixtureService: Color batch has %d values for %d fixtures"), Colors.Num(), VirtualFixtureIDs.Num());
+		return 0;
+	}
+
+	const bool bNotify = ColorChanged.IsBound();
+	int32 CachedUniverse = INDEX_NONE;
+	uint8* CachedData = nullptr;
+	int32 Written = 0;
+
+	for (int32 i = 0; i < VirtualFixtureIDs.Num(); i++)
+	{
+		const FFixtureChannelLayout* Layout = FindLayout(VirtualFixtureIDs[i]);
+		if (!Layout || !Layout->HasColor())
+		{
+			continue;
+		}
+		uint8* Data = ResolveUniverse(Layout->Universe, CachedUniverse, CachedData);
+		if (!Data)
+		{
+			continue;
+		}
+
+		const FLinearColor& Color = Colors[Colors.Num() == 1 ? 0 : i];
+		FFixtureDrivers::WriteColor(*Layout, Color.R, Color.G, Color.B, Color.A, Data);
+		Written++;
+		if (bNotify)
+		{
+			ColorChanged.Broadcast(VirtualFixtureIDs[i],
+				FMath::Clamp(Color.R, 0.0f, 1.0f),
+				FMath::Clamp(Color.G, 0.0f, 1.0f),
+				FMath::Clamp(Color.B, 0.0f, 1.0f));
+		}
+	}
+
+	PROLIGHTING_INC_COUNTER(STAT_ProLighting_FixtureWrites, Written);
+	return Written;
+}
+
+void FFixtureService::QueryFixtures(const FLBEASTFixtureQuery& Query, TArray<FFixtureSpan>& OutSpans) const
+{
+	Registry.Query(Query, OutSpans);
+}
+
+void FFixtureService::GetFixtureIDs(const FLBEASTFixtureQuery& Query, TArray<int32>& OutIDs) const
+{
+	TArray<FFixtureSpan> Spans;
+	Registry.Query(Query, Spans);
+	const TConstArrayView<int32> IDs = Registry.GetIDs();
+	OutIDs.Reset();
+	for (const FFixtureSpan& Span : Spans)
+	{
+		OutIDs.Append(IDs.GetData() + Span.First, Span.Num);
+	}
+}
+
+int32 FFixtureService::ApplyIntensityToQuery(const FLBEASTFixtureQuery& Query, float Intensity)
+{
+	PROLIGHTING_SCOPE_CYCLE_COUNTER(STAT_ProLighting_FixtureBatch);
+	Registry.Query(Query, QuerySpans);
+	const TConstArrayView<FFixtureChannelLayout> Layouts = Registry.GetLayouts();
+	const TConstArrayView<int32> IDs = Registry.GetIDs();
+
+	Intensity = FMath::Clamp(Intensity, 0.0f, 1.0f);
+	const bool bNotify = IntensityChanged.IsBound();
+	int32 CachedUniverse = INDEX_NONE;
+	uint8* CachedData = nullptr;
+	int32 Written = 0;
+
+	for (const FFixtureSpan& Span : QuerySpans)
+	{
+		for (int32 Index = Span.First; Index < Span.First + Span.Num; Index++)
+		{
+			uint8* Data = ResolveUniverse(Layouts[Index].Universe, CachedUniverse, CachedData);
+			if (!Data)
+			{
+				continue;
+			}
+			FFixtureDrivers::WriteIntensity(Layouts[Index], Intensity, Data);
+			Written++;
+			if (bNotify)
+			{
+				IntensityChanged.Broadcast(IDs[Index], Intensity);
+			}
+		}
+	}
+
+	PROLIGHTING_INC_COUNTER(STAT_ProLighting_FixtureWrites, Written);
+	return Written;
+}
+
+int32 FFixtureService::ApplyColorToQuery(const FLBEASTFixtureQuery& Query, const FLinearColor& Color)
+{
+	PROLIGHTING_SCOPE_CYCLE_COUNTER(STAT_ProLighting_FixtureBatch);
+	Registry.Query(Query, QuerySpans);
+	const TConstArrayView<FFixtureChannelLayout> Layouts = Registry.GetLayouts();
+	const TConstArrayView<int32> IDs = Registry.GetIDs();
+
+	const bool bNotify = ColorChanged.IsBound();
+	int32 CachedUniverse = INDEX_NONE;
+	uint8* CachedData = nullptr;
+	int32 Written = 0;
+
+	for (const FFixtureSpan& Span : QuerySpans)
+	{
+		for (int32 Index = Span.First; Index < Span.First + Span.Num; Index++)
+		{
+			const FFixtureChannelLayout& Layout = Layouts[Index];
+			uint8* Data = Layout.HasColor() ? ResolveUniverse(Layout.Universe, CachedUniverse, CachedData) : nullptr;
+			if (!Data)
+			{
+				continue;
+			}
+			FFixtureDrivers::WriteColor(Layout, Color.R, Color.G, Color.B, Color.A, Data);
+			Written++;
+			if (bNotify)
+			{
+				ColorChanged.Broadcast(IDs[Index],
+					FMath::Clamp(Color.R, 0.0f, 1.0f),
+					FMath::Clamp(Color.G, 0.0f, 1.0f),
+					FMath::Clamp(Color.B, 0.0f, 1.0f));
+			}
+		}
+	}
+
+	PROLIGHTING_INC_COUNTER(STAT_ProLighting_FixtureWrites, Written);
+	return Written;
+}
+
+int32 FFixtureService::StartFadeForQuery(const FLBEASTFixtureQuery& Query, float TargetIntensity, float DurationSec)
+{
+	Registry.Query(Query, QuerySpans);
+	const TConstArrayView<FFixtureChannelLayout> Layouts = Registry.GetLayouts();
+	const TConstArrayView<int32> IDs = Registry.GetIDs();
+
+	TargetIntensity = FMath::Clamp(TargetIntensity, 0.0f, 1.0f);
+	DurationSec = FMath::Max(0.01f, DurationSec);
+	int32 CachedUniverse = INDEX_NONE;
+	uint8* CachedData = nullptr;
+	int32 Started = 0;
+
+	for (const FFixtureSpan& Span : QuerySpans)
+	{
+		for (int32 Index = Span.First; Index < Span.First + Span.Num; Index++)
+		{
+			const FFixtureChannelLayout& Layout = Layouts[Index];
+			if (Layout.Intensity == FFixtureChannelLayout::None)
+			{
+				continue;
+			}
+			const uint8* Data = ResolveUniverse(Layout.Universe, CachedUniverse, CachedData);
+			const float Current = Data ? Data[Layout.Intensity] / 255.0f : 0.0f;
+			StartFade(IDs[Index], Current, TargetIntensity, DurationSec);
+			Started++;
+		}
+	}
+	return Started;
 }
 
 void FFixtureService::ApplyChannelRaw(const FLBEASTDMXFixture& Fixture, int32 ChannelOffset, uint8 Value)
@@ -68,14 +323,19 @@ void FFixtureService::TickFades(float DeltaTime, TFunctionRef<void(int32,float)>
 
 void FFixtureService::AllOff(TFunctionRef<void(int32,float)> OnIntensity)
 {
-    for (int32 Id : Registry.GetIDs())
+    const TConstArrayView<FFixtureChannelLayout> Layouts = Registry.GetLayouts();
+    const TConstArrayView<int32> IDs = Registry.GetIDs();
+    int32 CachedUniverse = INDEX_NONE;
+    uint8* CachedData = nullptr;
+    for (int32 Index = 0; Index < Layouts.Num(); Index++)
     {
-        if (const FLBEASTDMXFixture* Fx = Registry.Find(Id))
+        const int32 Id = IDs[Index];
+        if (uint8* Data = ResolveUniverse(Layouts[Index].Universe, CachedUniverse, CachedData))
         {
-            ApplyIntensity(*Fx, 0.0f);
-            OnIntensity(Id, 0.0f);
-            IntensityChanged.Broadcast(Id, 0.0f);
+            FFixtureDrivers::WriteIntensity(Layouts[Index], 0.0f, Data);
         }
+        OnIntensity(Id, 0.0f);
+        IntensityChanged.Broadcast(Id, 0.0f);
     }
 }
 
@@ -97,38 +357,39 @@ void FFixtureService::UpdateFixtureOnlineStatus(const FString& RDMUID, bool bIsO
 
 int32 FFixtureService::SetIntensityById(int32 VirtualFixtureID, float Intensity)
 {
-    const FLBEASTDMXFixture* Fixture = Registry.Find(VirtualFixtureID);
-    if (!Fixture) return -1;
-    ApplyIntensity(*Fixture, FMath::Clamp(Intensity, 0.0f, 1.0f));
+    const FFixtureChannelLayout* Layout = FindLayout(VirtualFixtureID);
+    if (!Layout) return -1;
+    int32 CachedUniverse = INDEX_NONE;
+    uint8* CachedData = nullptr;
+    if (uint8* Data = ResolveUniverse(Layout->Universe, CachedUniverse, CachedData))
+    {
+        FFixtureDrivers::WriteIntensity(*Layout, Intensity, Data);
+    }
     IntensityChanged.Broadcast(VirtualFixtureID, FMath::Clamp(Intensity, 0.0f, 1.0f));
-    return Fixture->Universe;
+    return Layout->Universe;
 }
 
 int32 FFixtureService::SetColorRGBWById(int32 VirtualFixtureID, float Red, float Green, float Blue, float White)
 {
-    const FLBEASTDMXFixture* Fixture = Registry.Find(VirtualFixtureID);
-    if (!Fixture) return -1;
-    switch (Fixture->FixtureType)
+    const FFixtureChannelLayout* Layout = FindLayout(VirtualFixtureID);
+    if (!Layout) return -1;
+    if (!Layout->HasColor())
     {
-        case ELBEASTDMXFixtureType::RGB:
-        case ELBEASTDMXFixtureType::RGBW:
-        case ELBEASTDMXFixtureType::MovingHead:
-        case ELBEASTDMXFixtureType::Custom:
-            break;
-        default:
-            UE_LOG(LogProLighting, Warning, TEXT("FixtureService: Fixture %d does not support color"), VirtualFixtureID);
-            return -1;
+        UE_LOG(LogProLighting, Warning, TEXT("FixtureService: Fixture %d does not support color"), VirtualFixtureID);
+        return -1;
+    }
+    int32 CachedUniverse = INDEX_NONE;
+    uint8* CachedData = nullptr;
+    if (uint8* Data = ResolveUniverse(Layout->Universe, CachedUniverse, CachedData))
+    {
+        // Negative white ("disabled") clamps to 0 in the kernel
+        FFixtureDrivers::WriteColor(*Layout, Red, Green, Blue, White, Data);
     }
-    ApplyColor(*Fixture,
-        FMath::Clamp(Red, 0.0f, 1.0f),
-        FMath::Clamp(Green, 0.0f, 1.0f),
-        FMath::Clamp(Blue, 0.0f, 1.0f),
-        (White >= 0.0f) ? FMath::Clamp(White, 0.0f, 1.0f) : White);
     ColorChanged.Broadcast(VirtualFixtureID,
         FMath::Clamp(Red, 0.0f, 1.0f),
         FMath::Clamp(Green, 0.0f, 1.0f),
         FMath::Clamp(Blue, 0.0f, 1.0f));
-    return Fixture->Universe;
+    return Layout->Universe;
 }
 
 int32 FFixtureService::SetChannelById(int32 VirtualFixtureID, int32 ChannelOffset, float Value)
@@ -155,9 +416,10 @@ int32 FFixtureService::SetChannelById(int32 VirtualFixtureID, int32 ChannelOffse
 
 void FFixtureService::StartFadeById(int32 VirtualFixtureID, float TargetIntensity, float DurationSec)
 {
-    const FLBEASTDMXFixture* Fixture = Registry.Find(VirtualFixtureID);
-    if (!Fixture) return;
-    float Current = Buffer.GetChannel(Fixture->Universe, Fixture->DMXChannel) / 255.0f;
+    const FFixtureChannelLayout* Layout = FindLayout(VirtualFixtureID);
+    if (!Layout) return;
+    // Read back from the fixture's intensity channel (not always its first channel, e.g. moving heads)
+    float Current = (Layout->Intensity != FFixtureChannelLayout::None) ? Buffer.GetChannel(Layout->Universe, Layout->Intensity + 1) / 255.0f : 0.0f;
     StartFade(VirtualFixtureID, Current, FMath::Clamp(TargetIntensity, 0.0f, 1.0f), FMath::Max(0.01f, DurationSec));
 }
 
@@ -166,6 +428,22 @@ void FFixtureService::AllOffAndNotify(TFunctionRef<void(int32,float)> OnIntensit
     AllOff(OnIntensity);
 }
 
+bool FFixtureService::RelocateFixture(int32 VirtualFixtureID, int32 NewDMXChannel)
+{
+    return Registry.Relocate(VirtualFixtureID, NewDMXChannel);
+}
+
+bool FFixtureService::SetFixtureGrouping(int32 VirtualFixtureID, const TArray<FName>& Groups, const TArray<FName>& Tags, int32 Zone)
+{
+    FLBEASTDMXFixture* Fixture = Registry.FindMutable(VirtualFixtureID);
+    if (!Fixture) return false;
+    Fixture->Groups = Groups;
+    Fixture->Tags = Tags;
+    Fixture->Zone = FMath::Max(0, Zone);
+    Registry.MarkChanged();
+    return true;
+}
+
 bool FFixtureService::IsFixtureRDMCapable(int32 VirtualFixtureID) const
 {
     const FLBEASTDMXFixture* Fixture = Registry.Find(VirtualFixtureID);
@@ -63,7 +63,10 @@ FTransportSetupResult IDMXTransport::CreateTransport(const FLBEASTProLightingCon
 
 			// Initialize RDM service after Art-Net init
 			Controller->RDMService = MakeUnique<FRDMService>();
-			Controller->RDMService->Initialize(ConfigCopy.RDMPollInterval);
+			if (ConfigCopy.bEnableRDM)
+			{
+				Controller->BindArtNetRDM();
+			}
 			
 			// Note: Event bridging is handled by Controller->BridgeServiceEvents() which is called after initialization
 			if (Controller->FixtureService)
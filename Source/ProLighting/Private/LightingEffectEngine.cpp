@@ -0,0 +1,635 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "LightingEffectEngine.h"
+#include "FixtureService.h"
+#include "UniverseBuffer.h"
+#include "HAL/RunnableThread.h"
+#include "Algo/BinarySearch.h"
+#include "Math/Float16Color.h"
+#include "Engine/Texture.h"
+#include "TextureResource.h"
+#include "RenderingThread.h"
+#include "RHIGPUReadback.h"
+
+DECLARE_CYCLE_STAT(TEXT("Effect Evaluate (Worker)"), STAT_ProLighting_EffectEvaluate, STATGROUP_LBEASTProLighting);
+DECLARE_CYCLE_STAT(TEXT("Effect Composite"), STAT_ProLighting_EffectComposite, STATGROUP_LBEASTProLighting);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Effect Fixtures Evaluated"), STAT_ProLighting_EffectFixtures, STATGROUP_LBEASTProLighting);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Active Effects"), STAT_ProLighting_ActiveEffects, STATGROUP_LBEASTProLighting);
+
+namespace
+{
+	/** Upper bound on how long the worker sleeps between kicks (so Stop() is never missed) */
+	constexpr uint32 MaxIdleWaitMs = 100;
+
+	/** Merge one layer's level into an overlay channel (modes as FUniverseOverlay: 1 = Highest, 2 = Replace) */
+	FORCEINLINE void PutChannel(uint8* Value, uint8* Mode, int16 Index, uint8 Level, bool bReplace)
+	{
+		if (Index == FFixtureChannelLayout::None)
+		{
+			return;
+		}
+		if (bReplace || Mode[Index] == 0)
+		{
+			Value[Index] = Level;
+			Mode[Index] = bReplace ? 2 : FMath::Max<uint8>(Mode[Index], 1);
+		}
+		else
+		{
+			Value[Index] = FMath::Max(Value[Index], Level);
+		}
+	}
+}
+
+/**
+ * Pixel-map source readback (render thread only after creation)
+ *
+ * One copy is kept in flight per source; each frame the render thread checks whether the previous
+ * copy has landed, converts it for the worker and queues the next one, so the game thread never
+ * waits on the GPU.
+ */
+struct FLightingEffectEngine::FPixelReadback
+{
+	FLiveEffectPtr Live;
+	TUniquePtr<FRHIGPUTextureReadback> Readback;
+	int32 Width = 0;
+	int32 Height = 0;
+	EPixelFormat Format = PF_Unknown;
+	bool bPending = false;
+	bool bWarnedFormat = false;
+
+	void Update(FRHICommandListImmediate& RHICmdList, FRHITexture* Texture)
+	{
+		if (bPending)
+		{
+			if (!Readback->IsReady())
+			{
+				return;
+			}
+			int32 RowPitchInPixels = 0;
+			if (const uint8* Data = static_cast<const uint8*>(Readback->Lock(RowPitchInPixels)))
+			{
+				Publish(Data, RowPitchInPixels);
+			}
+			Readback->Unlock();
+			bPending = false;
+		}
+
+		const FRHITextureDesc& Desc = Texture->GetDesc();
+		Width = Desc.Extent.X;
+		Height = Desc.Extent.Y;
+		Format = Desc.Format;
+		if (!Readback)
+		{
+			Readback = MakeUnique<FRHIGPUTextureReadback>(TEXT("LBEASTLightingPixelMap"));
+		}
+		Readback->EnqueueCopy(RHICmdList, Texture);
+		bPending = true;
+	}
+
+	void Publish(const uint8* Data, int32 RowPitchInPixels)
+	{
+		TSharedPtr<FPixelFrame, ESPMode::ThreadSafe> Frame = MakeShared<FPixelFrame, ESPMode::ThreadSafe>();
+		Frame->Width = Width;
+		Frame->Height = Height;
+		Frame->Pixels.SetNumUninitialized(Width * Height);
+
+		for (int32 Y = 0; Y < Height; Y++)
+		{
+			FColor* Dest = Frame->Pixels.GetData() + Y * Width;
+			switch (Format)
+			{
+			case PF_B8G8R8A8:
+				FMemory::Memcpy(Dest, Data + (SIZE_T)Y * RowPitchInPixels * 4, Width * sizeof(FColor));
+				break;
+			case PF_R8G8B8A8:
+			{
+				const uint8* Src = Data + (SIZE_T)Y * RowPitchInPixels * 4;
+				for (int32 X = 0; X < Width; X++, Src += 4)
+				{
+					Dest[X] = FColor(Src[0], Src[1], Src[2], Src[3]);
+				}
+				break;
+			}
+			case PF_FloatRGBA:
+			{
+				const FFloat16Color* Src = reinterpret_cast<const FFloat16Color*>(Data) + (SIZE_T)Y * RowPitchInPixels;
+				for (int32 X = 0; X < Width; X++)
+				{
+					Dest[X] = FLinearColor(Src[X].R.GetFloat(), Src[X].G.GetFloat(), Src[X].B.GetFloat(), Src[X].A.GetFloat()).ToFColor(false);
+				}
+				break;
+			}
+			default:
+				if (!bWarnedFormat)
+				{
+					bWarnedFormat = true;
+					UE_LOG(LogProLighting, Warning, TEXT("LightingEffectEngine: Pixel map source format %s is not supported (use RGBA8 or RGBA16f)"), GetPixelFormatString(Format));
+				}
+				return;
+			}
+		}
+
+		FScopeLock ScopeLock(&Live->PixelLock);
+		Live->PixelFrame = Frame;
+	}
+};
+
+// =====================================
+// Lifecycle
+// =====================================
+
+FLightingEffectEngine::FLightingEffectEngine(FFixtureService& InFixtures)
+	: Fixtures(InFixtures)
+{
+}
+
+FLightingEffectEngine::~FLightingEffectEngine()
+{
+	Shutdown();
+}
+
+bool FLightingEffectEngine::Start()
+{
+	if (Thread)
+	{
+		return true;
+	}
+
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	bStopRequested = false;
+	Thread = FRunnableThread::Create(this, TEXT("LBEAST_LightingEffects"), 0, TPri_AboveNormal);
+	if (!Thread)
+	{
+		UE_LOG(LogProLighting, Error, TEXT("LightingEffectEngine: Failed to create worker thread"));
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+		return false;
+	}
+	return true;
+}
+
+void FLightingEffectEngine::Shutdown()
+{
+	if (Thread)
+	{
+		Thread->Kill(true);
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	if (WakeEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+
+	// Readbacks still queued on the render thread hold their own references
+	Effects.Reset();
+	GameProgram.Reset();
+	PendingProgram.Reset();
+	bJobPending = false;
+	Overlays[FrontIndex].Reset();
+}
+
+// =====================================
+// Effects (game thread)
+// =====================================
+
+int32 FLightingEffectEngine::PlayEffect(const FLBEASTLightingEffect& Effect)
+{
+	FEffectEntry Entry;
+	Entry.Handle = NextHandle;
+	Entry.Priority = Effect.Priority;
+	Entry.Source = Effect;
+	Entry.StartSeconds = FPlatformTime::Seconds();
+	Entry.Live = MakeShared<FLiveEffect, ESPMode::ThreadSafe>();
+	Entry.Live->Master = FMath::Clamp(Effect.Master, 0.0f, 1.0f);
+
+	FCompiledEffect Probe;
+	CompileEffect(Fixtures, Entry, Probe);
+	if (Probe.Layouts.Num() == 0)
+	{
+		UE_LOG(LogProLighting, Warning, TEXT("LightingEffectEngine: Effect has no registered fixtures (%d IDs given)"), Effect.FixtureIDs.Num());
+		return INDEX_NONE;
+	}
+
+	if (Effect.Waveform == ELBEASTLightingWaveform::PixelMap)
+	{
+		if (!Effect.PixelSource)
+		{
+			UE_LOG(LogProLighting, Warning, TEXT("LightingEffectEngine: Pixel map effect has no PixelSource"));
+			return INDEX_NONE;
+		}
+		Entry.Readback = MakeShared<FPixelReadback, ESPMode::ThreadSafe>();
+		Entry.Readback->Live = Entry.Live;
+	}
+
+	NextHandle++;
+
+	// Stable by priority: equal priorities stay in play order, so the later effect ends up on top
+	const int32 InsertAt = Algo::UpperBoundBy(Effects, Entry.Priority, &FEffectEntry::Priority);
+	Effects.Insert(MoveTemp(Entry), InsertAt);
+	Recompile();
+	return Effects[InsertAt].Handle;
+}
+
+bool FLightingEffectEngine::StopEffect(int32 EffectHandle)
+{
+	const int32 Index = Effects.IndexOfByPredicate([EffectHandle](const FEffectEntry& Entry) { return Entry.Handle == EffectHandle; });
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+	Effects.RemoveAt(Index);
+	Recompile();
+	return true;
+}
+
+void FLightingEffectEngine::StopAllEffects()
+{
+	Effects.Reset();
+	Recompile();
+}
+
+bool FLightingEffectEngine::SetEffectMaster(int32 EffectHandle, float Master)
+{
+	for (FEffectEntry& Entry : Effects)
+	{
+		if (Entry.Handle == EffectHandle)
+		{
+			Entry.Source.Master = FMath::Clamp(Master, 0.0f, 1.0f);
+			Entry.Live->Master.store(Entry.Source.Master, std::memory_order_relaxed);
+			return true;
+		}
+	}
+	return false;
+}
+
+void FLightingEffectEngine::Recompile()
+{
+	CompiledLayoutSerial = Fixtures.GetLayoutSerial();
+	PROLIGHTING_SET_GAUGE(STAT_ProLighting_ActiveEffects, Effects.Num());
+
+	if (Effects.Num() == 0)
+	{
+		GameProgram.Reset();
+		return;
+	}
+
+	TSharedPtr<FProgram, ESPMode::ThreadSafe> Program = MakeShared<FProgram, ESPMode::ThreadSafe>();
+	Program->Effects.SetNum(Effects.Num());
+	for (int32 Index = 0; Index < Effects.Num(); Index++)
+	{
+		CompileEffect(Fixtures, Effects[Index], Program->Effects[Index]);
+	}
+	GameProgram = Program;
+}
+
+void FLightingEffectEngine::CompileEffect(const FFixtureService& InFixtures, const FEffectEntry& Entry, FCompiledEffect& Out)
+{
+	const FLBEASTLightingEffect& Source = Entry.Source;
+	Out.Target = Source.Target;
+	Out.Waveform = Source.Waveform;
+	Out.MergeMode = Source.MergeMode;
+	Out.Rate = Source.Rate;
+	Out.Duty = FMath::Clamp(Source.Duty, 0.0f, 1.0f);
+	Out.Low = FMath::Clamp(Source.Low, 0.0f, 1.0f);
+	Out.High = FMath::Clamp(Source.High, 0.0f, 1.0f);
+	Out.ColorA = Source.ColorA;
+	Out.ColorB = Source.ColorB;
+	Out.bHueCycle = Source.bHueCycle;
+	Out.StartSeconds = Entry.StartSeconds;
+	Out.Live = Entry.Live;
+
+	const int32 Count = Source.FixtureIDs.Num();
+	Out.Layouts.Reset(Count);
+	Out.PixelUVs.Reset(Count);
+	// Padded to whole vectors so the wave loops need no scalar tail
+	Out.PhaseOffsets.Reset(Align(Count, 4));
+
+	const bool bPixelMap = Source.Waveform == ELBEASTLightingWaveform::PixelMap;
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		const FFixtureChannelLayout* Layout = InFixtures.FindLayout(Source.FixtureIDs[Index]);
+		if (!Layout)
+		{
+			continue;
+		}
+		Out.Layouts.Add(*Layout);
+		// Later fixtures lag behind, so the wave travels along FixtureIDs. Phase follows the position
+		// in the group, not the surviving index, so a missing fixture leaves a gap.
+		Out.PhaseOffsets.Add(-Source.PhaseSpread * Index / Count);
+		if (bPixelMap)
+		{
+			Out.PixelUVs.Add(Source.PixelPositions.IsValidIndex(Index)
+				? FVector2f(Source.PixelPositions[Index])
+				: FVector2f((Index + 0.5f) / Count, 0.5f));
+		}
+	}
+	Out.PhaseOffsets.SetNumZeroed(Align(Out.Layouts.Num(), 4));
+}
+
+// =====================================
+// Frame (game thread)
+// =====================================
+
+void FLightingEffectEngine::Tick()
+{
+	if (Effects.Num() > 0 && Fixtures.GetLayoutSerial() != CompiledLayoutSerial)
+	{
+		// Fixtures were re-patched or removed since the effects were compiled
+		Recompile();
+	}
+
+	{
+		FScopeLock ScopeLock(&ResultLock);
+		if (bReadyFresh && ReadyGeneration == Generation)
+		{
+			Swap(FrontIndex, ReadyIndex);
+		}
+		bReadyFresh = false;
+	}
+
+	if (!GameProgram.IsValid())
+	{
+		// Nothing playing: drop the last overlay, and anything still in flight from the old effects
+		if (Overlays[FrontIndex].Num() > 0)
+		{
+			Overlays[FrontIndex].Reset();
+			Generation++;
+		}
+		return;
+	}
+
+	RequestPixelReadbacks();
+
+	{
+		FScopeLock ScopeLock(&JobLock);
+		PendingProgram = GameProgram;
+		PendingSeconds = FPlatformTime::Seconds();
+		PendingGeneration = Generation;
+		bJobPending = true;
+	}
+	if (WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+void FLightingEffectEngine::RequestPixelReadbacks()
+{
+	for (const FEffectEntry& Entry : Effects)
+	{
+		if (!Entry.Readback.IsValid() || !Entry.Source.PixelSource)
+		{
+			continue;
+		}
+
+		FTextureResource* Resource = Entry.Source.PixelSource->GetResource();
+		if (!Resource)
+		{
+			continue;
+		}
+
+		ENQUEUE_RENDER_COMMAND(LBEASTLightingPixelReadback)(
+			[Readback = Entry.Readback, Resource](FRHICommandListImmediate& RHICmdList)
+			{
+				if (FRHITexture* Texture = Resource->GetTextureRHI())
+				{
+					Readback->Update(RHICmdList, Texture);
+				}
+			});
+	}
+}
+
+bool FLightingEffectEngine::Composite(const FUniverseBuffer& Base, FUniverseBuffer& Out) const
+{
+	if (!GameProgram.IsValid())
+	{
+		return false;
+	}
+	PROLIGHTING_SCOPE_CYCLE_COUNTER(STAT_ProLighting_EffectComposite);
+
+	Base.ForEachUniverse([&Out](int32 Universe, const TArray<uint8>& Data)
+	{
+		Out.EnsureUniverse(Universe);
+		FMemory::Memcpy(Out.GetUniverseData(Universe), Data.GetData(), 512);
+	});
+
+	for (const FUniverseOverlay& Overlay : Overlays[FrontIndex])
+	{
+		if (!Base.GetUniverse(Overlay.Universe))
+		{
+			// Effect-only universe: nothing manual underneath
+			Out.EnsureUniverse(Overlay.Universe);
+			FMemory::Memzero(Out.GetUniverseData(Overlay.Universe), 512);
+		}
+
+		uint8* Data = Out.GetUniverseData(Overlay.Universe);
+		for (int32 Channel = 0; Channel < 512; Channel++)
+		{
+			const uint8 Mode = Overlay.Mode[Channel];
+			const uint8 Value = Overlay.Value[Channel];
+			Data[Channel] = Mode == FUniverseOverlay::Replace ? Value : (Mode == FUniverseOverlay::Highest ? FMath::Max(Data[Channel], Value) : Data[Channel]);
+		}
+	}
+	return true;
+}
+
+// =====================================
+// Worker Thread
+// =====================================
+
+uint32 FLightingEffectEngine::Run()
+{
+	while (!bStopRequested)
+	{
+		WakeEvent->Wait(MaxIdleWaitMs);
+
+		FProgramPtr Program;
+		double NowSeconds = 0.0;
+		uint32 JobGeneration = 0;
+		{
+			FScopeLock ScopeLock(&JobLock);
+			if (!bJobPending)
+			{
+				continue;
+			}
+			Program = MoveTemp(PendingProgram);
+			NowSeconds = PendingSeconds;
+			JobGeneration = PendingGeneration;
+			bJobPending = false;
+		}
+
+		Evaluate(*Program, NowSeconds, Overlays[BackIndex]);
+
+		FScopeLock ScopeLock(&ResultLock);
+		Swap(BackIndex, ReadyIndex);
+		ReadyGeneration = JobGeneration;
+		bReadyFresh = true;
+	}
+	return 0;
+}
+
+void FLightingEffectEngine::Stop()
+{
+	bStopRequested = true;
+	if (WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+void FLightingEffectEngine::EvaluateWave(const FCompiledEffect& Effect, double NowSeconds, TArray<float>& OutPhase, TArray<float>& OutWave)
+{
+	const int32 Padded = Effect.PhaseOffsets.Num();
+	OutPhase.SetNumUninitialized(Padded, EAllowShrinking::No);
+	OutWave.SetNumUninitialized(Padded, EAllowShrinking::No);
+
+	// Wrap the base phase in double precision so long-running effects do not lose resolution
+	const double Cycles = (NowSeconds - Effect.StartSeconds) * Effect.Rate;
+	const float BasePhase = (float)(Cycles - FMath::FloorToDouble(Cycles));
+
+	const VectorRegister4Float Zero = VectorSetFloat1(0.0f);
+	const VectorRegister4Float One = VectorSetFloat1(1.0f);
+	const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+	const VectorRegister4Float Two = VectorSetFloat1(2.0f);
+	const VectorRegister4Float TwoPi = VectorSetFloat1(UE_TWO_PI);
+	const VectorRegister4Float Base = VectorSetFloat1(BasePhase);
+	const VectorRegister4Float Duty = VectorSetFloat1(Effect.Duty);
+
+	const float* Offsets = Effect.PhaseOffsets.GetData();
+	float* PhaseOut = OutPhase.GetData();
+	float* WaveOut = OutWave.GetData();
+
+	for (int32 Index = 0; Index < Padded; Index += 4)
+	{
+		// Phase in [0, 1) per fixture
+		VectorRegister4Float P = VectorFractional(VectorAdd(VectorLoad(Offsets + Index), Base));
+		P = VectorSelect(VectorCompareLT(P, Zero), VectorAdd(P, One), P);
+		VectorStore(P, PhaseOut + Index);
+
+		VectorRegister4Float W;
+		switch (Effect.Waveform)
+		{
+		case ELBEASTLightingWaveform::Sine:
+			W = VectorMultiplyAdd(VectorSin(VectorMultiply(P, TwoPi)), Half, Half);
+			break;
+		case ELBEASTLightingWaveform::Triangle:
+			W = VectorSubtract(One, VectorAbs(VectorSubtract(VectorMultiply(P, Two), One)));
+			break;
+		case ELBEASTLightingWaveform::Step:
+			W = VectorSelect(VectorCompareLT(P, Duty), One, Zero);
+			break;
+		case ELBEASTLightingWaveform::Saw:
+		default:
+			W = P;
+			break;
+		}
+		VectorStore(W, WaveOut + Index);
+	}
+}
+
+void FLightingEffectEngine::Evaluate(const FProgram& Program, double NowSeconds, TArray<FUniverseOverlay>& Out)
+{
+	PROLIGHTING_SCOPE_CYCLE_COUNTER(STAT_ProLighting_EffectEvaluate);
+
+	Out.Reset();
+	int32 Evaluated = 0;
+
+	auto FindOverlay = [&Out](int32 Universe) -> FUniverseOverlay&
+	{
+		for (FUniverseOverlay& Overlay : Out)
+		{
+			if (Overlay.Universe == Universe)
+			{
+				return Overlay;
+			}
+		}
+		FUniverseOverlay& Added = Out.AddDefaulted_GetRef();
+		Added.Universe = Universe;
+		FMemory::Memzero(Added.Mode, sizeof(Added.Mode));
+		return Added;
+	};
+
+	for (const FCompiledEffect& Effect : Program.Effects)
+	{
+		const float Master = Effect.Live->Master.load(std::memory_order_relaxed);
+		const bool bReplace = Effect.MergeMode == ELBEASTLightingMergeMode::LTP;
+		if (Master <= 0.0f && !bReplace)
+		{
+			// HTP at zero cannot raise anything
+			continue;
+		}
+
+		const bool bPixelMap = Effect.Waveform == ELBEASTLightingWaveform::PixelMap;
+		FPixelFramePtr Pixels;
+		if (bPixelMap)
+		{
+			FScopeLock ScopeLock(&Effect.Live->PixelLock);
+			Pixels = Effect.Live->PixelFrame;
+			if (!Pixels.IsValid() || Pixels->Width <= 0 || Pixels->Height <= 0)
+			{
+				// First readback has not landed yet
+				continue;
+			}
+		}
+		else
+		{
+			EvaluateWave(Effect, NowSeconds, Phase, Wave);
+		}
+
+		const double Scroll = bPixelMap ? (NowSeconds - Effect.StartSeconds) * Effect.Rate : 0.0;
+		const float ScrollU = (float)(Scroll - FMath::FloorToDouble(Scroll));
+
+		FUniverseOverlay* Overlay = nullptr;
+		for (int32 Index = 0; Index < Effect.Layouts.Num(); Index++)
+		{
+			const FFixtureChannelLayout& Layout = Effect.Layouts[Index];
+			if (!Overlay || Overlay->Universe != Layout.Universe)
+			{
+				Overlay = &FindOverlay(Layout.Universe);
+			}
+
+			if (bPixelMap)
+			{
+				const FVector2f& UV = Effect.PixelUVs[Index];
+				const float U = FMath::Frac(UV.X + ScrollU);
+				const int32 X = FMath::Clamp((int32)(U * Pixels->Width), 0, Pixels->Width - 1);
+				const int32 Y = FMath::Clamp((int32)(UV.Y * Pixels->Height), 0, Pixels->Height - 1);
+				const FColor& Pixel = Pixels->Pixels[Y * Pixels->Width + X];
+
+				if (Effect.Target == ELBEASTLightingEffectTarget::Intensity)
+				{
+					const float Level = FMath::Max3(Pixel.R, Pixel.G, Pixel.B) / 255.0f;
+					PutChannel(Overlay->Value, Overlay->Mode, Layout.Intensity, FFixtureDrivers::ToDMX(FMath::Lerp(Effect.Low, Effect.High, Level) * Master), bReplace);
+				}
+				else
+				{
+					// White is left to lower layers: a pixel has no white component
+					PutChannel(Overlay->Value, Overlay->Mode, Layout.Red, (uint8)(Pixel.R * Master), bReplace);
+					PutChannel(Overlay->Value, Overlay->Mode, Layout.Green, (uint8)(Pixel.G * Master), bReplace);
+					PutChannel(Overlay->Value, Overlay->Mode, Layout.Blue, (uint8)(Pixel.B * Master), bReplace);
+				}
+			}
+			else if (Effect.Target == ELBEASTLightingEffectTarget::Intensity)
+			{
+				const float Level = FMath::Lerp(Effect.Low, Effect.High, Wave[Index]) * Master;
+				PutChannel(Overlay->Value, Overlay->Mode, Layout.Intensity, FFixtureDrivers::ToDMX(Level), bReplace);
+			}
+			else
+			{
+				const FLinearColor Color = (Effect.bHueCycle
+					? FLinearColor(Wave[Index] * 360.0f, 1.0f, 1.0f, 0.0f).HSVToLinearRGB()
+					: FMath::Lerp(Effect.ColorA, Effect.ColorB, Wave[Index])) * Master;
+				PutChannel(Overlay->Value, Overlay->Mode, Layout.Red, FFixtureDrivers::ToDMX(Color.R), bReplace);
+				PutChannel(Overlay->Value, Overlay->Mode, Layout.Green, FFixtureDrivers::ToDMX(Color.G), bReplace);
+				PutChannel(Overlay->Value, Overlay->Mode, Layout.Blue, FFixtureDrivers::ToDMX(Color.B), bReplace);
+				PutChannel(Overlay->Value, Overlay->Mode, Layout.White, FFixtureDrivers::ToDMX(Color.A), bReplace);
+			}
+		}
+		Evaluated += Effect.Layouts.Num();
+	}
+
+	PROLIGHTING_INC_COUNTER(STAT_ProLighting_EffectFixtures, Evaluated);
+}
@@ -0,0 +1,572 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#include "ProLighting/Public/LightingShowFile.h"
+#include "ProLighting/Public/UniverseBuffer.h"
+#include "Async/MappedFileHandle.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Crc.h"
+
+DECLARE_CYCLE_STAT(TEXT("Show File Open"), STAT_ProLighting_ShowFileOpen, STATGROUP_LBEASTProLighting);
+DECLARE_CYCLE_STAT(TEXT("Cue Recall"), STAT_ProLighting_CueRecall, STATGROUP_LBEASTProLighting);
+
+// Records are read in place, so the file's byte order has to be the machine's
+static_assert(PLATFORM_LITTLE_ENDIAN, "Show files are little-endian");
+
+using namespace LightingShowFormat;
+
+namespace
+{
+	const ANSICHAR ShowMagic[8] = { 'L', 'B', 'E', 'A', 'S', 'T', 'L', 'X' };
+
+	constexpr int32 UniverseSize = 512;
+	constexpr int32 SectionTableOffset = 24;
+
+	/** Bytes per counted element of each section (Levels and Strings are counted in bytes) */
+	const int32 SectionStride[Section_Count] =
+	{
+		sizeof(FFixtureRecord),
+		sizeof(int32),
+		sizeof(FGroupRecord),
+		sizeof(uint32),
+		sizeof(FCueRecord),
+		sizeof(FCueBlock),
+		1,
+		1
+	};
+
+	template<typename T>
+	T ReadRaw(const uint8* At)
+	{
+		T Value;
+		FMemory::Memcpy(&Value, At, sizeof(T));
+		return Value;
+	}
+
+	template<typename T>
+	void WriteRaw(TArray<uint8>& Image, int32 At, T Value)
+	{
+		FMemory::Memcpy(Image.GetData() + At, &Value, sizeof(T));
+	}
+
+	void ReadSection(const uint8* FileData, int32 Section, uint32& OutOffset, uint32& OutCount)
+	{
+		OutOffset = ReadRaw<uint32>(FileData + SectionTableOffset + Section * 8);
+		OutCount = ReadRaw<uint32>(FileData + SectionTableOffset + Section * 8 + 4);
+	}
+
+	/** Only valid once the section table has been bounds-checked */
+	template<typename T>
+	TConstArrayView<T> SectionView(const uint8* FileData, int32 Section)
+	{
+		uint32 Offset, Count;
+		ReadSection(FileData, Section, Offset, Count);
+		return TConstArrayView<T>(reinterpret_cast<const T*>(FileData + Offset), (int32)Count);
+	}
+
+	bool StringInBounds(const FStringRef& Ref, int32 StringsSize)
+	{
+		return (uint64)Ref.Offset + Ref.Length <= (uint64)StringsSize;
+	}
+}
+
+// =====================================
+// FLightingShowFile
+// =====================================
+
+FLightingShowFile::FLightingShowFile() = default;
+
+FLightingShowFile::~FLightingShowFile()
+{
+	Close();
+}
+
+bool FLightingShowFile::Open(const FString& FilePath, FString& OutError)
+{
+	PROLIGHTING_SCOPE_CYCLE_COUNTER(STAT_ProLighting_ShowFileOpen);
+	Close();
+	const double StartSeconds = FPlatformTime::Seconds();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	FOpenMappedResult Mapped = PlatformFile.OpenMappedEx(*FilePath);
+	if (Mapped.HasValue())
+	{
+		MappedHandle = Mapped.StealValue();
+		MappedRegion.Reset(MappedHandle->MapRegion(0, MappedHandle->GetFileSize()));
+	}
+
+	if (MappedRegion.IsValid())
+	{
+		Data = MappedRegion->GetMappedPtr();
+		Size = MappedRegion->GetMappedSize();
+	}
+	else
+	{
+		MappedHandle.Reset();
+		if (!FFileHelper::LoadFileToArray(LoadedBytes, *FilePath))
+		{
+			OutError = FString::Printf(TEXT("Could not open %s"), *FilePath);
+			return false;
+		}
+		Data = LoadedBytes.GetData();
+		Size = LoadedBytes.Num();
+	}
+
+	FString Error;
+	if (!Validate(Data, Size, Error))
+	{
+		OutError = FString::Printf(TEXT("%s: %s"), *FilePath, *Error);
+		Close();
+		return false;
+	}
+
+	Path = FilePath;
+	BindSections();
+	UE_LOG(LogProLighting, Log, TEXT("LightingShowFile: Opened %s - %d fixtures, %d groups, %d cues (%s, %.2f ms)"),
+		*FilePath, Fixtures.Num(), Groups.Num(), Cues.Num(), MappedRegion.IsValid() ? TEXT("mapped") : TEXT("read"),
+		(FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+	return true;
+}
+
+void FLightingShowFile::Close()
+{
+	// The region has to go before the handle it was mapped from
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+	LoadedBytes.Empty();
+	Data = nullptr;
+	Size = 0;
+	Path.Reset();
+
+	Fixtures = {};
+	Mappings = {};
+	Groups = {};
+	Members = {};
+	Cues = {};
+	CueBlocks = {};
+	Levels = {};
+	Strings = {};
+	CueIndexByName.Reset();
+}
+
+bool FLightingShowFile::Validate(const uint8* FileData, int64 FileSize, FString& OutError)
+{
+	if (!FileData || FileSize < HeaderSize || FileSize > MAX_int32)
+	{
+		OutError = TEXT("Not a show file (bad size)");
+		return false;
+	}
+
+	const uint32 Version = ReadRaw<uint32>(FileData + 8);
+	const uint32 StoredHeaderSize = ReadRaw<uint32>(FileData + 12);
+	if (FMemory::Memcmp(FileData, ShowMagic, sizeof(ShowMagic)) != 0 || Version == 0 || Version > FileVersion
+		|| StoredHeaderSize < (uint32)HeaderSize || StoredHeaderSize > (uint64)FileSize)
+	{
+		OutError = TEXT("Not a supported show file");
+		return false;
+	}
+	if (Version < FileVersion)
+	{
+		// Records are read in place, so an older record layout cannot be used as is
+		OutError = FString::Printf(TEXT("Show file version %u is older than %u; save it again from the editor"), Version, FileVersion);
+		return false;
+	}
+
+	for (int32 Section = 0; Section < Section_Count; ++Section)
+	{
+		uint32 Offset, Count;
+		ReadSection(FileData, Section, Offset, Count);
+		const uint64 End = (uint64)Offset + (uint64)Count * SectionStride[Section];
+		if (Offset % 8 != 0 || Offset < StoredHeaderSize || End > (uint64)FileSize)
+		{
+			OutError = FString::Printf(TEXT("Section %d is out of bounds"), Section);
+			return false;
+		}
+	}
+
+	if (FCrc::MemCrc32(FileData + StoredHeaderSize, (int32)(FileSize - StoredHeaderSize)) != ReadRaw<uint32>(FileData + 16))
+	{
+		OutError = TEXT("Checksum mismatch (damaged or modified)");
+		return false;
+	}
+
+	const TConstArrayView<FFixtureRecord> FixtureRecords = SectionView<FFixtureRecord>(FileData, Section_Fixtures);
+	const TConstArrayView<FGroupRecord> GroupRecords = SectionView<FGroupRecord>(FileData, Section_Groups);
+	const TConstArrayView<uint32> MemberIndices = SectionView<uint32>(FileData, Section_Members);
+	const TConstArrayView<FCueRecord> CueRecords = SectionView<FCueRecord>(FileData, Section_Cues);
+	const TConstArrayView<FCueBlock> Blocks = SectionView<FCueBlock>(FileData, Section_CueBlocks);
+	const int32 NumMappings = SectionView<int32>(FileData, Section_Mappings).Num();
+	const int32 LevelsSize = SectionView<uint8>(FileData, Section_Levels).Num();
+	const int32 StringsSize = SectionView<uint8>(FileData, Section_Strings).Num();
+
+	// Fixtures are in patch order, so an overlap can only be with the furthest-reaching fixture before it on the universe
+	TSet<int32> SeenIDs;
+	SeenIDs.Reserve(FixtureRecords.Num());
+	int32 LastUniverse = -1;
+	int32 LastEnd = 0;
+	for (const FFixtureRecord& Record : FixtureRecords)
+	{
+		const int32 End = Record.DMXChannel + Record.ChannelCount - 1;
+		if (Record.VirtualFixtureID <= 0 || Record.FixtureType > (uint8)ELBEASTDMXFixtureType::Custom || Record.Universe > MaxUniverse
+			|| Record.DMXChannel < 1 || Record.ChannelCount < 1 || End > UniverseSize
+			|| (uint64)Record.FirstMapping + Record.NumMappings > (uint64)NumMappings || !StringInBounds(Record.RDMUID, StringsSize))
+		{
+			OutError = FString::Printf(TEXT("Fixture %d is invalid"), Record.VirtualFixtureID);
+			return false;
+		}
+
+		bool bDuplicate = false;
+		SeenIDs.Add(Record.VirtualFixtureID, &bDuplicate);
+		if (bDuplicate)
+		{
+			OutError = FString::Printf(TEXT("Fixture ID %d is used twice"), Record.VirtualFixtureID);
+			return false;
+		}
+
+		if (Record.Universe != LastUniverse)
+		{
+			if (Record.Universe < LastUniverse)
+			{
+				OutError = FString::Printf(TEXT("Fixture %d is out of patch order"), Record.VirtualFixtureID);
+				return false;
+			}
+			LastUniverse = Record.Universe;
+			LastEnd = 0;
+		}
+		if (Record.DMXChannel <= LastEnd)
+		{
+			OutError = FString::Printf(TEXT("Fixture %d overlaps the fixture before it or is out of patch order"), Record.VirtualFixtureID);
+			return false;
+		}
+		LastEnd = End;
+	}
+
+	for (const FGroupRecord& Group : GroupRecords)
+	{
+		if ((Group.Kind != EGroupKind::Group && Group.Kind != EGroupKind::Tag) || !StringInBounds(Group.Name, StringsSize)
+			|| (uint64)Group.FirstMember + Group.NumMembers > (uint64)MemberIndices.Num())
+		{
+			OutError = TEXT("Group record is invalid");
+			return false;
+		}
+	}
+	for (uint32 Member : MemberIndices)
+	{
+		if (Member >= (uint32)FixtureRecords.Num())
+		{
+			OutError = TEXT("Group member is not a fixture in the file");
+			return false;
+		}
+	}
+
+	for (const FCueRecord& Cue : CueRecords)
+	{
+		if (!StringInBounds(Cue.Name, StringsSize) || (uint64)Cue.FirstBlock + Cue.NumBlocks > (uint64)Blocks.Num())
+		{
+			OutError = TEXT("Cue record is invalid");
+			return false;
+		}
+	}
+	for (const FCueBlock& Block : Blocks)
+	{
+		if (Block.Universe < 0 || Block.Universe > MaxUniverse || (uint64)Block.LevelsOffset + UniverseSize > (uint64)LevelsSize)
+		{
+			OutError = FString::Printf(TEXT("Cue levels for universe %d are invalid"), Block.Universe);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FLightingShowFile::BindSections()
+{
+	Fixtures = SectionView<FFixtureRecord>(Data, Section_Fixtures);
+	Mappings = SectionView<int32>(Data, Section_Mappings);
+	Groups = SectionView<FGroupRecord>(Data, Section_Groups);
+	Members = SectionView<uint32>(Data, Section_Members);
+	Cues = SectionView<FCueRecord>(Data, Section_Cues);
+	CueBlocks = SectionView<FCueBlock>(Data, Section_CueBlocks);
+	Levels = SectionView<uint8>(Data, Section_Levels);
+	Strings = SectionView<uint8>(Data, Section_Strings);
+
+	CueIndexByName.Reset();
+	CueIndexByName.Reserve(Cues.Num());
+	for (int32 Index = 0; Index < Cues.Num(); ++Index)
+	{
+		CueIndexByName.Add(FName(*ReadString(Cues[Index].Name)), Index);
+	}
+}
+
+FString FLightingShowFile::ReadString(const FStringRef& Ref) const
+{
+	if (Ref.Length == 0)
+	{
+		return FString();
+	}
+	const FUTF8ToTCHAR Text(reinterpret_cast<const ANSICHAR*>(Strings.GetData() + Ref.Offset), (int32)Ref.Length);
+	return FString(Text.Length(), Text.Get());
+}
+
+void FLightingShowFile::BuildPatch(TArray<FLBEASTDMXFixture>& OutFixtures) const
+{
+	OutFixtures.Reset(Fixtures.Num());
+	for (const FFixtureRecord& Record : Fixtures)
+	{
+		FLBEASTDMXFixture& Fixture = OutFixtures.AddDefaulted_GetRef();
+		Fixture.VirtualFixtureID = Record.VirtualFixtureID;
+		Fixture.FixtureType = static_cast<ELBEASTDMXFixtureType>(Record.FixtureType);
+		Fixture.DMXChannel = Record.DMXChannel;
+		Fixture.Universe = Record.Universe;
+		Fixture.ChannelCount = Record.ChannelCount;
+		Fixture.Zone = Record.Zone;
+		Fixture.CustomChannelMapping.Append(Mappings.GetData() + Record.FirstMapping, (int32)Record.NumMappings);
+		Fixture.RDMUID = ReadString(Record.RDMUID);
+		Fixture.bRDMCapable = (Record.Flags & FixtureFlag_RDMCapable) != 0;
+	}
+
+	for (const FGroupRecord& Group : Groups)
+	{
+		const FName Name(*ReadString(Group.Name));
+		for (uint32 Member : Members.Slice((int32)Group.FirstMember, (int32)Group.NumMembers))
+		{
+			FLBEASTDMXFixture& Fixture = OutFixtures[(int32)Member];
+			(Group.Kind == EGroupKind::Tag ? Fixture.Tags : Fixture.Groups).AddUnique(Name);
+		}
+	}
+}
+
+int32 FLightingShowFile::FindCue(FName CueName) const
+{
+	const int32* Index = CueIndexByName.Find(CueName);
+	return Index ? *Index : INDEX_NONE;
+}
+
+FName FLightingShowFile::GetCueName(int32 CueIndex) const
+{
+	return Cues.IsValidIndex(CueIndex) ? FName(*ReadString(Cues[CueIndex].Name)) : NAME_None;
+}
+
+void FLightingShowFile::GetCueLevels(int32 CueIndex, TArray<int32>& OutUniverses, TArray<TConstArrayView<uint8>>& OutLevels) const
+{
+	OutUniverses.Reset();
+	OutLevels.Reset();
+	if (!Cues.IsValidIndex(CueIndex))
+	{
+		return;
+	}
+	const FCueRecord& Cue = Cues[CueIndex];
+	for (const FCueBlock& Block : CueBlocks.Slice((int32)Cue.FirstBlock, (int32)Cue.NumBlocks))
+	{
+		OutUniverses.Add(Block.Universe);
+		OutLevels.Add(Levels.Slice((int32)Block.LevelsOffset, UniverseSize));
+	}
+}
+
+int32 FLightingShowFile::RecallCue(int32 CueIndex, FUniverseBuffer& Buffer) const
+{
+	if (!Cues.IsValidIndex(CueIndex))
+	{
+		return 0;
+	}
+	PROLIGHTING_SCOPE_CYCLE_COUNTER(STAT_ProLighting_CueRecall);
+
+	const FCueRecord& Cue = Cues[CueIndex];
+	for (const FCueBlock& Block : CueBlocks.Slice((int32)Cue.FirstBlock, (int32)Cue.NumBlocks))
+	{
+		Buffer.EnsureUniverse(Block.Universe);
+		FMemory::Memcpy(Buffer.GetUniverseData(Block.Universe), Levels.GetData() + Block.LevelsOffset, UniverseSize);
+	}
+	return (int32)Cue.NumBlocks;
+}
+
+// =====================================
+// FLightingShowFileWriter
+// =====================================
+
+void FLightingShowFileWriter::SetPatch(TConstArrayView<FLBEASTDMXFixture> InFixtures)
+{
+	Fixtures.Reset(InFixtures.Num());
+	Fixtures.Append(InFixtures.GetData(), InFixtures.Num());
+	Fixtures.Sort([](const FLBEASTDMXFixture& A, const FLBEASTDMXFixture& B)
+	{
+		if (A.Universe != B.Universe) return A.Universe < B.Universe;
+		if (A.DMXChannel != B.DMXChannel) return A.DMXChannel < B.DMXChannel;
+		return A.VirtualFixtureID < B.VirtualFixtureID;
+	});
+}
+
+FLightingShowFileWriter::FRecordedCue& FLightingShowFileWriter::FindOrAddCue(FName CueName)
+{
+	if (FRecordedCue* Existing = Cues.FindByPredicate([CueName](const FRecordedCue& Cue) { return Cue.Name == CueName; }))
+	{
+		return *Existing;
+	}
+	FRecordedCue& Cue = Cues.AddDefaulted_GetRef();
+	Cue.Name = CueName;
+	return Cue;
+}
+
+void FLightingShowFileWriter::AddCue(FName CueName, const FUniverseBuffer& Buffer)
+{
+	FRecordedCue& Cue = FindOrAddCue(CueName);
+	Cue.Universes.Reset();
+	Cue.Levels.Reset(Buffer.NumUniverses() * UniverseSize);
+	Buffer.ForEachUniverse([&Cue](int32 Universe, const TArray<uint8>& UniverseData)
+	{
+		Cue.Universes.Add(Universe);
+		Cue.Levels.Append(UniverseData.GetData(), UniverseSize);
+	});
+}
+
+void FLightingShowFileWriter::AddCues(const FLightingShowFile& File)
+{
+	TArray<int32> Universes;
+	TArray<TConstArrayView<uint8>> UniverseLevels;
+	for (int32 CueIndex = 0; CueIndex < File.NumCues(); ++CueIndex)
+	{
+		const FName CueName = File.GetCueName(CueIndex);
+		if (Cues.ContainsByPredicate([CueName](const FRecordedCue& Cue) { return Cue.Name == CueName; }))
+		{
+			continue;
+		}
+		File.GetCueLevels(CueIndex, Universes, UniverseLevels);
+		FRecordedCue& Cue = Cues.AddDefaulted_GetRef();
+		Cue.Name = CueName;
+		Cue.Universes = Universes;
+		for (const TConstArrayView<uint8>& UniverseData : UniverseLevels)
+		{
+			Cue.Levels.Append(UniverseData.GetData(), UniverseData.Num());
+		}
+	}
+}
+
+void FLightingShowFileWriter::Reset()
+{
+	Fixtures.Reset();
+	Cues.Reset();
+}
+
+bool FLightingShowFileWriter::Save(const FString& FilePath, FString& OutError) const
+{
+	TArray<uint8> Strings;
+	auto AddString = [&Strings](const FString& Text)
+	{
+		const FTCHARToUTF8 Utf8(*Text);
+		FStringRef Ref;
+		Ref.Offset = (uint32)Strings.Num();
+		Ref.Length = (uint32)Utf8.Length();
+		Strings.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+		return Ref;
+	};
+
+	// Fixtures, their mappings, and group/tag membership by fixture index
+	TArray<FFixtureRecord> FixtureRecords;
+	TArray<int32> Mappings;
+	TMap<FName, TArray<uint32>> GroupMembers;
+	TMap<FName, TArray<uint32>> TagMembers;
+	FixtureRecords.Reserve(Fixtures.Num());
+	for (int32 Index = 0; Index < Fixtures.Num(); ++Index)
+	{
+		const FLBEASTDMXFixture& Fixture = Fixtures[Index];
+		FFixtureRecord& Record = FixtureRecords.AddDefaulted_GetRef();
+		// Out-of-range values are clamped to ones the validator below still rejects
+		Record.VirtualFixtureID = Fixture.VirtualFixtureID;
+		Record.FixtureType = (uint8)Fixture.FixtureType;
+		Record.Universe = (uint16)FMath::Clamp(Fixture.Universe, 0, 0xFFFF);
+		Record.DMXChannel = (uint16)FMath::Clamp(Fixture.DMXChannel, 0, 0xFFFF);
+		Record.ChannelCount = (uint16)FMath::Clamp(Fixture.ChannelCount, 0, 0xFFFF);
+		Record.Flags = (uint16)(Fixture.bRDMCapable ? FixtureFlag_RDMCapable : 0);
+		Record.Zone = Fixture.Zone;
+		Record.FirstMapping = (uint32)Mappings.Num();
+		Record.NumMappings = (uint32)Fixture.CustomChannelMapping.Num();
+		Mappings.Append(Fixture.CustomChannelMapping);
+		if (!Fixture.RDMUID.IsEmpty())
+		{
+			Record.RDMUID = AddString(Fixture.RDMUID);
+		}
+
+		for (const FName& Group : Fixture.Groups)
+		{
+			GroupMembers.FindOrAdd(Group).AddUnique((uint32)Index);
+		}
+		for (const FName& Tag : Fixture.Tags)
+		{
+			TagMembers.FindOrAdd(Tag).AddUnique((uint32)Index);
+		}
+	}
+
+	TArray<FGroupRecord> GroupRecords;
+	TArray<uint32> Members;
+	auto AddGroups = [&](const TMap<FName, TArray<uint32>>& Source, EGroupKind Kind)
+	{
+		for (const TPair<FName, TArray<uint32>>& Pair : Source)
+		{
+			FGroupRecord& Record = GroupRecords.AddDefaulted_GetRef();
+			Record.Name = AddString(Pair.Key.ToString());
+			Record.Kind = Kind;
+			Record.FirstMember = (uint32)Members.Num();
+			Record.NumMembers = (uint32)Pair.Value.Num();
+			Members.Append(Pair.Value);
+		}
+	};
+	AddGroups(GroupMembers, EGroupKind::Group);
+	AddGroups(TagMembers, EGroupKind::Tag);
+
+	TArray<FCueRecord> CueRecords;
+	TArray<FCueBlock> Blocks;
+	TArray<uint8> Levels;
+	for (const FRecordedCue& Cue : Cues)
+	{
+		FCueRecord& Record = CueRecords.AddDefaulted_GetRef();
+		Record.Name = AddString(Cue.Name.ToString());
+		Record.FirstBlock = (uint32)Blocks.Num();
+		Record.NumBlocks = (uint32)Cue.Universes.Num();
+		for (int32 Index = 0; Index < Cue.Universes.Num(); ++Index)
+		{
+			Blocks.Add({ Cue.Universes[Index], (uint32)(Levels.Num() + Index * UniverseSize) });
+		}
+		Levels.Append(Cue.Levels);
+	}
+
+	TArray<uint8> Image;
+	Image.SetNumZeroed(FLightingShowFile::HeaderSize);
+	FMemory::Memcpy(Image.GetData(), ShowMagic, sizeof(ShowMagic));
+	WriteRaw<uint32>(Image, 8, FLightingShowFile::FileVersion);
+	WriteRaw<uint32>(Image, 12, FLightingShowFile::HeaderSize);
+
+	auto AppendSection = [&Image](int32 Section, const void* SectionData, int32 Count)
+	{
+		Image.SetNumZeroed(Align(Image.Num(), 8));
+		WriteRaw<uint32>(Image, SectionTableOffset + Section * 8, (uint32)Image.Num());
+		WriteRaw<uint32>(Image, SectionTableOffset + Section * 8 + 4, (uint32)Count);
+		Image.Append(static_cast<const uint8*>(SectionData), Count * SectionStride[Section]);
+	};
+	AppendSection(Section_Fixtures, FixtureRecords.GetData(), FixtureRecords.Num());
+	AppendSection(Section_Mappings, Mappings.GetData(), Mappings.Num());
+	AppendSection(Section_Groups, GroupRecords.GetData(), GroupRecords.Num());
+	AppendSection(Section_Members, Members.GetData(), Members.Num());
+	AppendSection(Section_Cues, CueRecords.GetData(), CueRecords.Num());
+	AppendSection(Section_CueBlocks, Blocks.GetData(), Blocks.Num());
+	AppendSection(Section_Levels, Levels.GetData(), Levels.Num());
+	AppendSection(Section_Strings, Strings.GetData(), Strings.Num());
+
+	WriteRaw<uint32>(Image, 16, FCrc::MemCrc32(Image.GetData() + FLightingShowFile::HeaderSize, Image.Num() - FLightingShowFile::HeaderSize));
+
+	FString Error;
+	if (!FLightingShowFile::Validate(Image.GetData(), Image.Num(), Error))
+	{
+		OutError = FString::Printf(TEXT("Not saving %s: %s"), *FilePath, *Error);
+		return false;
+	}
+	if (!FFileHelper::SaveArrayToFile(Image, *FilePath))
+	{
+		OutError = FString::Printf(TEXT("Could not write %s"), *FilePath);
+		return false;
+	}
+
+	UE_LOG(LogProLighting, Log, TEXT("LightingShowFile: Saved %s - %d fixtures, %d groups, %d cues (%d bytes)"),
+		*FilePath, FixtureRecords.Num(), GroupRecords.Num(), CueRecords.Num(), Image.Num());
+	return true;
+}
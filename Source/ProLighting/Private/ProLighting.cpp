@@ -3,6 +3,7 @@
 #include "ProLighting.h"
 
 DEFINE_LOG_CATEGORY(LogProLighting);
+LBEAST_DEFINE_TRACE_CHANNEL(LBEASTProLightingChannel);
 
 #define LOCTEXT_NAMESPACE "FProLightingModule"
 
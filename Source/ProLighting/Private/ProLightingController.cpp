@@ -3,6 +3,18 @@
 #include "ProLightingController.h"
 #include "ProLighting/Public/RDMService.h"
 #include "Misc/DateTime.h"
+#include "ProLighting.h"
+#include "LightingCommandRouter.h"
+#include "ShowControl/LBEASTShowTimeline.h"
+#include "Networking/LBEASTIOReactor.h"
+#include "Misc/Paths.h"
+
+DECLARE_CYCLE_STAT(TEXT("ProLightingController Tick"), STAT_ProLightingController_Tick, STATGROUP_LBEASTProLighting);
+DECLARE_CYCLE_STAT(TEXT("Fade Engine Tick"), STAT_ProLighting_TickFades, STATGROUP_LBEASTProLighting);
+DECLARE_CYCLE_STAT(TEXT("Flush DMX Universe"), STAT_ProLighting_FlushDMX, STATGROUP_LBEASTProLighting);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DMX Packets Sent"), STAT_ProLighting_DMXPacketsSent, STATGROUP_LBEASTProLighting);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DMX Bytes Sent"), STAT_ProLighting_DMXBytesSent, STATGROUP_LBEASTProLighting);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Active Universes"), STAT_ProLighting_ActiveUniverses, STATGROUP_LBEASTProLighting);
 
 UProLightingController::UProLightingController(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -19,24 +31,86 @@ void UProLightingController::BeginPlay()
 
 	// Create fixture service (owns registry and fade engine, uses shared buffer)
 	FixtureService = MakeUnique<FFixtureService>(UniverseBuffer);
+	EffectEngine = MakeUnique<FLightingEffectEngine>(*FixtureService);
+	EffectEngine->Start();
     // Bridge all service events to Blueprint delegates
     BridgeServiceEvents();
 
+	if (!Config.ShowFilePath.IsEmpty())
+	{
+		LoadShowFile(Config.ShowFilePath);
+	}
+
 	if (!Config.COMPort.IsEmpty() || !Config.ArtNetIPAddress.IsEmpty())
 	{
 		InitializeDMX(Config);
 	}
+
+	if (!ShowTrackName.IsNone())
+	{
+		if (ULBEASTShowControlSubsystem* ShowControl = ULBEASTShowControlSubsystem::Get(this))
+		{
+			RegisteredShowTrackName = ShowControl->RegisterTrack(ShowTrackName, this, [this](const FLBEASTShowCue& Cue, double LateSeconds)
+			{
+				ExecuteShowCue(Cue, LateSeconds);
+			});
+		}
+	}
 }
 
 void UProLightingController::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (!RegisteredShowTrackName.IsNone())
+	{
+		if (ULBEASTShowControlSubsystem* ShowControl = ULBEASTShowControlSubsystem::Get(this))
+		{
+			ShowControl->UnregisterTrack(RegisteredShowTrackName, this);
+		}
+		RegisteredShowTrackName = NAME_None;
+	}
+
 	Shutdown();
+
+	// Joins the worker before the fixture service it reads from goes away
+	EffectEngine.Reset();
 	Super::EndPlay(EndPlayReason);
 }
 
+void UProLightingController::ExecuteShowCue(const FLBEASTShowCue& Cue, double LateSeconds)
+{
+	static const FName IntensityCommand(TEXT("Intensity"));
+	static const FName ColorCommand(TEXT("Color"));
+	static const FName FadeCommand(TEXT("Fade"));
+	static const FName CueCommand(TEXT("Cue"));
+
+	if (Cue.Command == IntensityCommand)
+	{
+		FLightingCommandRouter::SetIntensity(*this, Cue.TargetIndex, Cue.Value);
+	}
+	else if (Cue.Command == ColorCommand)
+	{
+		FLightingCommandRouter::SetColor(*this, Cue.TargetIndex, Cue.Vector.X, Cue.Vector.Y, Cue.Vector.Z);
+	}
+	else if (Cue.Command == FadeCommand && FixtureService)
+	{
+		// Shorten the fade by however late the cue arrived so it still lands on its planned end time
+		const float Duration = FMath::Max(0.0f, Cue.DurationSeconds - static_cast<float>(LateSeconds));
+		FixtureService->StartFadeById(Cue.TargetIndex, FMath::Clamp(Cue.Value, 0.0f, 1.0f), Duration);
+	}
+	else if (Cue.Command == CueCommand)
+	{
+		RecallCue(Cue.TargetName);
+	}
+	else
+	{
+		UE_LOG(LogProLighting, Warning, TEXT("ProLightingController: Unknown show cue command '%s'"), *Cue.Command.ToString());
+	}
+}
+
 void UProLightingController::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	PROLIGHTING_SCOPE_CYCLE_COUNTER(STAT_ProLightingController_Tick);
 
 	if (!bIsConnected)
 	{
@@ -46,44 +120,49 @@ void UProLightingController::TickComponent(float DeltaTime, ELevelTick TickType,
 	// Update fades via service
     if (FixtureService)
     {
-        FixtureService->TickFades(DeltaTime, [this](int32 Id, float NewIntensity)
+        PROLIGHTING_SCOPE_CYCLE_COUNTER(STAT_ProLighting_TickFades);
+        // Fades only write the buffer; every universe goes out once below
+        FFixtureService* Svc = FixtureService.Get();
+        Svc->TickFades(DeltaTime, [Svc](int32 Id, float NewIntensity)
         {
-            if (FFixtureService* Svc = FixtureService.Get())
-            {
-                int32 Univ = Svc->SetIntensityById(Id, NewIntensity);
-                if (Univ >= 0)
-                {
-                    FlushDMXUniverse(Univ);
-                }
-            }
+            Svc->SetIntensityById(Id, NewIntensity);
         });
     }
 
-	// Flush universes (optimize later)
-	for (int32 Universe : UniverseBuffer.GetUniverses())
+	// Effects: collect last frame's overlay and kick this frame's evaluation
+	if (EffectEngine)
 	{
-		FlushDMXUniverse(Universe);
+		EffectEngine->Tick();
 	}
 
+	// One send per universe per frame (manual levels, plus effects when any are playing)
+	const FUniverseBuffer& Outgoing = (EffectEngine && EffectEngine->Composite(UniverseBuffer, EffectOutputBuffer)) ? EffectOutputBuffer : UniverseBuffer;
+	PROLIGHTING_SET_GAUGE(STAT_ProLighting_ActiveUniverses, Outgoing.NumUniverses());
+	Outgoing.ForEachUniverse([this](int32 Universe, const TArray<uint8>& UniverseData)
+	{
+		FlushDMXUniverse(Universe, UniverseData);
+	});
+
     // Tick discovery
     if (ArtNetManager && Config.DMXMode == ELBEASTDMXMode::ArtNet)
 	{
 		ArtNetManager->Tick(DeltaTime);
 	}
 
-	// RDM polling...
+	// RDM requests and polling run inside ArtNetManager->Tick(); here we only age out silent fixtures
 	if (Config.bEnableRDM && bIsConnected && RDMService)
 	{
 		RDMPollTimer += DeltaTime;
 		if (RDMPollTimer >= Config.RDMPollInterval)
 		{
 			RDMPollTimer = 0.0f;
-			PollRDMFixtures(DeltaTime);
+			// A big rig takes longer than RDMPollInterval to poll round; judge silence against the real cycle
+			const FArtNetRDMEngine* RDM = ArtNetManager ? ArtNetManager->GetRDM() : nullptr;
+			const float PollCycle = FMath::Max(Config.RDMPollInterval, RDM ? RDM->GetPollCycleSeconds() : 0.0f);
 			TArray<int32> WentOffline; TArray<FString> Removed;
 			// Prune fires OnWentOfflineEvent internally, which is bridged to Blueprint via BridgeServiceEvents()
-			RDMService->Prune(Config.RDMPollInterval * 3.0f, Config.RDMPollInterval * 10.0f, WentOffline, Removed, RDMUIDToVirtualFixtureMap);
+			RDMService->Prune(PollCycle * 3.0f, PollCycle * 10.0f, WentOffline, Removed, RDMUIDToVirtualFixtureMap);
 		}
-		RDMService->Tick(DeltaTime);
 	}
 }
 
@@ -119,6 +198,7 @@ bool UProLightingController::InitializeDMX(const FLBEASTProLightingConfig& InCon
 	if (SetupResult.ArtNetManager)
 	{
 		ArtNetManager = TUniquePtr<FArtNetManager>(SetupResult.ArtNetManager);
+		ArtNetManager->UseIOReactor(ULBEASTIOReactorSubsystem::Get(this));
 	}
 	
 	// Run mode-specific setup callback (Art-Net discovery bridging, RDM init, etc.)
@@ -173,13 +253,193 @@ void UProLightingController::BridgeServiceEvents()
 // FIXTURE CONTROL API
 // ========================================
 
-// Control methods removed; use FixtureService directly.
+// Per-fixture control lives on FixtureService; groups are wrapped here for Blueprint.
+
+int32 UProLightingController::SetGroupIntensity(const FLBEASTFixtureQuery& Query, float Intensity)
+{
+	return FixtureService ? FixtureService->ApplyIntensityToQuery(Query, Intensity) : 0;
+}
+
+int32 UProLightingController::SetGroupColor(const FLBEASTFixtureQuery& Query, FLinearColor Color, float White)
+{
+	return FixtureService ? FixtureService->ApplyColorToQuery(Query, FLinearColor(Color.R, Color.G, Color.B, White)) : 0;
+}
+
+int32 UProLightingController::FadeGroup(const FLBEASTFixtureQuery& Query, float TargetIntensity, float DurationSec)
+{
+	return FixtureService ? FixtureService->StartFadeForQuery(Query, TargetIntensity, DurationSec) : 0;
+}
+
+TArray<int32> UProLightingController::GetFixturesInQuery(const FLBEASTFixtureQuery& Query) const
+{
+	TArray<int32> IDs;
+	if (FixtureService)
+	{
+		FixtureService->GetFixtureIDs(Query, IDs);
+	}
+	return IDs;
+}
+
+// ========================================
+// EFFECTS
+// ========================================
+
+int32 UProLightingController::PlayEffect(const FLBEASTLightingEffect& Effect)
+{
+	return EffectEngine ? EffectEngine->PlayEffect(Effect) : -1;
+}
+
+bool UProLightingController::StopEffect(int32 EffectHandle)
+{
+	return EffectEngine && EffectEngine->StopEffect(EffectHandle);
+}
+
+void UProLightingController::StopAllEffects()
+{
+	if (EffectEngine)
+	{
+		EffectEngine->StopAllEffects();
+	}
+}
+
+bool UProLightingController::SetEffectMaster(int32 EffectHandle, float Master)
+{
+	return EffectEngine && EffectEngine->SetEffectMaster(EffectHandle, Master);
+}
 
 bool UProLightingController::IsDMXConnected() const
 {
 	return bIsConnected;
 }
 
+// ========================================
+// SHOW FILE
+// ========================================
+
+FString UProLightingController::ResolveShowFilePath(const FString& FilePath) const
+{
+	return FPaths::IsRelative(FilePath) ? FPaths::Combine(FPaths::ProjectDir(), FilePath) : FilePath;
+}
+
+bool UProLightingController::LoadShowFile(const FString& FilePath)
+{
+	if (!FixtureService)
+	{
+		UE_LOG(LogProLighting, Warning, TEXT("ProLightingController: Cannot load a show file before BeginPlay"));
+		return false;
+	}
+
+	TUniquePtr<FLightingShowFile> File = MakeUnique<FLightingShowFile>();
+	FString Error;
+	if (!File->Open(ResolveShowFilePath(FilePath), Error))
+	{
+		UE_LOG(LogProLighting, Error, TEXT("ProLightingController: Show file not loaded - %s"), *Error);
+		return false;
+	}
+
+	TArray<FLBEASTDMXFixture> Patch;
+	File->BuildPatch(Patch);
+
+	// Patched RDM fixtures are matched by UID on the next discovery instead of being patched again
+	VirtualFixtureToRDMUIDMap.Reset();
+	RDMUIDToVirtualFixtureMap.Reset();
+	for (const FLBEASTDMXFixture& Fixture : Patch)
+	{
+		if (!Fixture.RDMUID.IsEmpty())
+		{
+			VirtualFixtureToRDMUIDMap.Add(Fixture.VirtualFixtureID, Fixture.RDMUID);
+			RDMUIDToVirtualFixtureMap.Add(Fixture.RDMUID, Fixture.VirtualFixtureID);
+		}
+	}
+
+	FixtureService->LoadPatch(MoveTemp(Patch));
+	ShowFile = MoveTemp(File);
+	return true;
+}
+
+void UProLightingController::RecordCue(FName CueName)
+{
+	if (CueName.IsNone())
+	{
+		UE_LOG(LogProLighting, Warning, TEXT("ProLightingController: A cue needs a name"));
+		return;
+	}
+	RecordedCues.AddCue(CueName, UniverseBuffer);
+}
+
+bool UProLightingController::SaveShowFile(const FString& FilePath)
+{
+	if (!FixtureService)
+	{
+		return false;
+	}
+
+	FLightingShowFileWriter Writer = RecordedCues;
+	Writer.SetPatch(FixtureService->GetFixtures());
+	FString PreviousPath;
+	if (ShowFile)
+	{
+		Writer.AddCues(*ShowFile);
+		PreviousPath = ShowFile->GetPath();
+		// Windows cannot replace a file while it is mapped
+		ShowFile.Reset();
+	}
+
+	const FString ResolvedPath = ResolveShowFilePath(FilePath);
+	FString Error;
+	const bool bSaved = Writer.Save(ResolvedPath, Error);
+	if (!bSaved)
+	{
+		UE_LOG(LogProLighting, Error, TEXT("ProLightingController: Show file not saved - %s"), *Error);
+	}
+	else
+	{
+		RecordedCues.Reset();
+	}
+
+	// Recall from what is on disk now; the patch in memory already matches it
+	const FString RecallPath = bSaved ? ResolvedPath : PreviousPath;
+	if (!RecallPath.IsEmpty())
+	{
+		TUniquePtr<FLightingShowFile> File = MakeUnique<FLightingShowFile>();
+		if (File->Open(RecallPath, Error))
+		{
+			ShowFile = MoveTemp(File);
+		}
+		else
+		{
+			UE_LOG(LogProLighting, Warning, TEXT("ProLightingController: Cues unavailable - %s"), *Error);
+		}
+	}
+	return bSaved;
+}
+
+bool UProLightingController::RecallCue(FName CueName)
+{
+	const int32 CueIndex = ShowFile ? ShowFile->FindCue(CueName) : INDEX_NONE;
+	if (CueIndex == INDEX_NONE || !FixtureService)
+	{
+		UE_LOG(LogProLighting, Warning, TEXT("ProLightingController: No saved cue '%s'"), *CueName.ToString());
+		return false;
+	}
+	FixtureService->RecallCue(*ShowFile, CueIndex);
+	return true;
+}
+
+TArray<FName> UProLightingController::GetCueNames() const
+{
+	TArray<FName> Names;
+	if (ShowFile)
+	{
+		Names.Reserve(ShowFile->NumCues());
+		for (int32 CueIndex = 0; CueIndex < ShowFile->NumCues(); ++CueIndex)
+		{
+			Names.Add(ShowFile->GetCueName(CueIndex));
+		}
+	}
+	return Names;
+}
+
 void UProLightingController::Shutdown()
 {
 	// Shutdown active transport (polymorphic - handles both USB DMX and Art-Net)
@@ -203,6 +463,7 @@ void UProLightingController::Shutdown()
 	bIsInitialized = false;
 	bIsConnected = false;
     UniverseBuffer.Reset();
+    EffectOutputBuffer.Reset();
     // FixtureService owns Registry and FadeEngine; dropping the service will clean them up
     // Art-Net nodes are owned by ArtNetManager
     if (RDMService)
@@ -251,10 +512,11 @@ void UProLightingController::InitializeDMXUniverse(int32 Universe)
     UniverseBuffer.EnsureUniverse(Universe);
 }
 
-void UProLightingController::FlushDMXUniverse(int32 Universe)
+void UProLightingController::FlushDMXUniverse(int32 Universe, const TArray<uint8>& UniverseData)
 {
-	const TArray<uint8>* UniverseData = UniverseBuffer.GetUniverse(Universe);
-	if (!UniverseData || UniverseData->Num() != 512)
+	PROLIGHTING_SCOPE_CYCLE_COUNTER(STAT_ProLighting_FlushDMX);
+
+	if (UniverseData.Num() != 512)
 	{
 		return;
 	}
@@ -262,7 +524,9 @@ void UProLightingController::FlushDMXUniverse(int32 Universe)
 	// Use polymorphic transport interface
 	if (ActiveTransport && ActiveTransport->IsConnected())
 	{
-		ActiveTransport->SendDMX(Universe, *UniverseData);
+		ActiveTransport->SendDMX(Universe, UniverseData);
+		PROLIGHTING_INC_COUNTER(STAT_ProLighting_DMXPacketsSent, 1);
+		PROLIGHTING_INC_COUNTER(STAT_ProLighting_DMXBytesSent, UniverseData.Num());
 	}
 }
 
@@ -295,42 +559,16 @@ void UProLightingController::DiscoverRDMFixtures()
 		return;
 	}
 
-	if (!CheckRDMSupport())
+	FArtNetRDMEngine* RDM = ArtNetManager ? ArtNetManager->GetRDM() : nullptr;
+	if (!CheckRDMSupport() || !RDM)
 	{
-		UE_LOG(LogProLighting, Warning, TEXT("ProLightingController: RDM not supported by current DMX interface"));
+		UE_LOG(LogProLighting, Warning, TEXT("ProLightingController: RDM not supported by current DMX interface (Art-Net only)"));
 		return;
 	}
 
-	UE_LOG(LogProLighting, Log, TEXT("ProLightingController: Starting RDM fixture discovery..."));
-
-    // Discover fixtures on each universe
-    for (int32 Universe : UniverseBuffer.GetUniverses())
-    {
-		TArray<FLBEASTDiscoveredFixture> DiscoveredFixtures;
-		
-		if (SendRDMDiscoveryPacket(Universe))
-		{
-			if (ReceiveRDMDiscoveryResponse(Universe, DiscoveredFixtures))
-			{
-				// Process discovered fixtures
-				for (FLBEASTDiscoveredFixture& Fixture : DiscoveredFixtures)
-				{
-					// Check if we already know about this fixture (by RDM UID)
-                    bool bNew = RDMService ? RDMService->AddOrUpdate(Fixture) : false;
-                    if (bNew)
-                    {
-                        UE_LOG(LogProLighting, Log, TEXT("ProLightingController: Discovered RDM fixture: %s (%s) at DMX %d"), 
-                            *Fixture.ModelName, *Fixture.RDMUID, Fixture.DMXAddress);
-                    }
-				}
-			}
-		}
-	}
-
-    if (RDMService)
-    {
-        UE_LOG(LogProLighting, Log, TEXT("ProLightingController: RDM discovery complete. Found %d fixtures"), RDMService->GetAll().Num());
-    }
+	// Results arrive over the next frames through HandleRDMDeviceChanged()
+	UE_LOG(LogProLighting, Log, TEXT("ProLightingController: Starting RDM fixture discovery (%d fixtures known)"), RDMService ? RDMService->GetAll().Num() : 0);
+	RDM->Discover({}, true);
 }
 
 TArray<FLBEASTArtNetNode> UProLightingController::GetDiscoveredArtNetNodes() const
@@ -389,8 +627,7 @@ int32 UProLightingController::AutoRegisterDiscoveredFixture(const FString& RDMUI
 		RDMUIDToVirtualFixtureMap.Add(RDMUID, Fixture.VirtualFixtureID);
 
 		// Update discovered fixture with virtual ID
-        // Update cached entry
-        // (Optional: we could add a SetVirtualID method to RDMService if needed)
+		RDMService->SetVirtualFixtureID(RDMUID, Fixture.VirtualFixtureID);
 
 		UE_LOG(LogProLighting, Log, TEXT("ProLightingController: Auto-registered RDM fixture %s as virtual fixture %d"), 
 			*RDMUID, Fixture.VirtualFixtureID);
@@ -448,127 +685,86 @@ bool UProLightingController::CheckRDMSupport() const
 	return false;
 }
 
-bool UProLightingController::SendRDMDiscoveryPacket(int32 Universe)
+void UProLightingController::BindArtNetRDM()
 {
-	// RDM Discovery uses "Mute" command with Discovery Unique Branch (DUB)
-	// This is complex - RDM packets are interleaved with DMX data
-	// For now, stubbed - requires low-level DMX/RDM packet construction
-	
-	UE_LOG(LogProLighting, Verbose, TEXT("ProLightingController: RDM discovery packet (stubbed) for universe %d"), Universe);
-	
-	// TODO: Implement RDM discovery protocol
-	// This requires:
-	// 1. Constructing RDM packet (start code 0xCC)
-	// 2. Sending on DMX line (requires USB DMX interface or Art-Net node with RDM support)
-	// 3. Receiving RDM responses (on same DMX line, interleaved with DMX data)
-	
-	return false;  // Not yet implemented
-}
+	if (!ArtNetManager)
+	{
+		return;
+	}
 
-bool UProLightingController::ReceiveRDMDiscoveryResponse(int32 Universe, TArray<FLBEASTDiscoveredFixture>& OutFixtures)
-{
-	// TODO: Implement RDM discovery response parsing
-	// Requires reading RDM packets from DMX line
-	
-	return false;  // Not yet implemented
-}
+	FArtNetRDMEngine::FSettings Settings;
+	Settings.Net = (uint8)Config.ArtNetNet;
+	Settings.SubNet = (uint8)Config.ArtNetSubNet;
+	Settings.PollIntervalSeconds = Config.RDMPollInterval;
+	ArtNetManager->EnableRDM(Settings);
 
-bool UProLightingController::SendRDMGetRequest(int32 Universe, const FString& RDMUID, int32 PID, TArray<uint8>& OutResponse)
-{
-	// RDM GET request for querying fixture parameters
-	// PID = Parameter ID (e.g., DMX_START_ADDRESS, DEVICE_INFO, etc.)
-	
-	UE_LOG(LogProLighting, Verbose, TEXT("ProLightingController: RDM GET request (stubbed) - Universe %d, UID %s, PID %d"), 
-		Universe, *RDMUID, PID);
-	
-	// TODO: Implement RDM GET request
-	
-	return false;  // Not yet implemented
-}
+	if (Config.bSimulateRDMNode)
+	{
+		TUniquePtr<FArtNetRDMFakeNode> FakeNode = MakeUnique<FArtNetRDMFakeNode>();
+		FakeNode->PopulateRig(Settings.Net, Settings.SubNet, Config.SimulatedRDMFixtureCount);
+		ArtNetManager->AttachFakeRDMNode(MoveTemp(FakeNode));
+	}
 
-bool UProLightingController::ParseRDMResponse(const TArray<uint8>& ResponseData, FLBEASTDiscoveredFixture& OutFixture)
-{
-	// TODO: Parse RDM response packet
-	// Extract fixture information from RDM response
-	
-	return false;  // Not yet implemented
+	FArtNetRDMEngine* RDM = ArtNetManager->GetRDM();
+	RDM->OnDeviceChanged().AddUObject(this, &UProLightingController::HandleRDMDeviceChanged);
+	RDM->OnDeviceResponded().AddWeakLambda(this, [this](const FString& RDMUID)
+	{
+		if (RDMService)
+		{
+			const int32* VirtualFixtureID = RDMUIDToVirtualFixtureMap.Find(RDMUID);
+			RDMService->MarkOnline(RDMUID, VirtualFixtureID ? *VirtualFixtureID : -1);
+		}
+	});
+	RDM->OnDeviceLost().AddWeakLambda(this, [this](const FString& RDMUID)
+	{
+		if (RDMService)
+		{
+			const int32* VirtualFixtureID = RDMUIDToVirtualFixtureMap.Find(RDMUID);
+			RDMService->MarkOffline(RDMUID, VirtualFixtureID ? *VirtualFixtureID : -1);
+		}
+	});
+
+	// Nodes answer with the tables they already have; DiscoverRDMFixtures() forces a fresh scan
+	RDM->Discover({}, false);
 }
 
-void UProLightingController::PollRDMFixtures(float DeltaTime)
+void UProLightingController::HandleRDMDeviceChanged(const FLBEASTDiscoveredFixture& Device)
 {
-	if (!Config.bEnableRDM)
+	if (!RDMService)
 	{
 		return;
 	}
 
-	// Poll each registered RDM-capable fixture
-	for (const auto& Pair : VirtualFixtureToRDMUIDMap)
+	const bool bNew = RDMService->AddOrUpdate(Device);
+	if (const int32* VirtualFixtureID = RDMUIDToVirtualFixtureMap.Find(Device.RDMUID))
 	{
-		int32 VirtualFixtureID = Pair.Key;
-		FString RDMUID = Pair.Value;
-
-        const FLBEASTDMXFixture* Fixture = FixtureService ? FixtureService->FindFixture(VirtualFixtureID) : nullptr;
-		if (!Fixture)
+		// Readdressed at the fixture (menu or another console): follow it so our levels land on it
+		const FLBEASTDMXFixture* Fixture = FixtureService ? FixtureService->FindFixture(*VirtualFixtureID) : nullptr;
+		if (Fixture && Device.DMXAddress > 0 && Device.DMXAddress != Fixture->DMXChannel)
 		{
-			continue;
+			UE_LOG(LogProLighting, Log, TEXT("ProLightingController: RDM fixture %s moved from DMX %d to %d"),
+				*Device.RDMUID, Fixture->DMXChannel, Device.DMXAddress);
+			// Recompiles the fixture's channel layout as well
+			FixtureService->RelocateFixture(*VirtualFixtureID, Device.DMXAddress);
 		}
+		RDMService->MarkOnline(Device.RDMUID, *VirtualFixtureID);
+		return;
+	}
 
-		// Query fixture status via RDM GET request
-    int32 Universe = (Config.DMXMode == ELBEASTDMXMode::USBDMX) ? 0 : Fixture->Universe;
-		TArray<uint8> Response;
+	if (bNew)
+	{
+		UE_LOG(LogProLighting, Log, TEXT("ProLightingController: Discovered RDM fixture: %s (%s) at DMX %d"),
+			*Device.ModelName, *Device.RDMUID, Device.DMXAddress);
+	}
 
-		// Query DMX_START_ADDRESS to get current fixture state
-		// PID 0x00F0 = DMX_START_ADDRESS
-		if (SendRDMGetRequest(Universe, RDMUID, 0x00F0, Response))
-		{
-			FLBEASTDiscoveredFixture DiscoveredFixture;
-			if (ParseRDMResponse(Response, DiscoveredFixture))
-			{
-				// Update discovered fixture cache via service
-				if (RDMService)
-				{
-					RDMService->AddOrUpdate(DiscoveredFixture);
-				}
-
-				// If DMX start address changed, update our registered mapping
-				if (Fixture && DiscoveredFixture.DMXAddress != Fixture->DMXChannel)
-				{
-					UE_LOG(LogProLighting, Log, TEXT("ProLightingController: RDM fixture %s moved from DMX %d to %d"), 
-						*RDMUID, Fixture->DMXChannel, DiscoveredFixture.DMXAddress);
-					if (FLBEASTDMXFixture* RegisteredFixture = FixtureService ? FixtureService->FindFixtureMutable(VirtualFixtureID) : nullptr)
-					{
-						RegisteredFixture->DMXChannel = DiscoveredFixture.DMXAddress;
-					}
-				}
-
-				// Mark online via service
-				if (RDMService)
-				{
-					RDMService->MarkOnline(RDMUID, VirtualFixtureID);
-				}
-
-				// TODO: Query actual DMX channel values if fixture supports it
-				// Some RDM fixtures can report current parameter values
-				// This would enable true bidirectional sync
-			}
-		}
-		else
-		{
-			// RDM query failed - fixture might be offline
-			if (RDMService)
-			{
-				RDMService->MarkOffline(RDMUID, VirtualFixtureID);
-			}
-		}
+	// Fixtures without a start address (no footprint, or not yet set) are left for manual patching
+	if (Config.bAutoRegisterRDMFixtures && Device.DMXAddress > 0)
+	{
+		AutoRegisterDiscoveredFixture(Device.RDMUID);
 	}
 }
 
 // UpdateFixtureOnlineStatus moved to FFixtureService
 
-void UProLightingController::PruneOfflineFixtures()
-{
-    // Handled in Tick() via RDMService->Prune
-}
-
 // GetNextVirtualFixtureID moved to FFixtureService
 
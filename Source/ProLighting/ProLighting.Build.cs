@@ -37,7 +37,9 @@ public class ProLighting : ModuleRules
 			new string[]
 			{
 				"Slate",
-				"SlateCore"
+				"SlateCore",
+				"RenderCore",
+				"RHI"
 			}
 		);
 	}
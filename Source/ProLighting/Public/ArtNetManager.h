@@ -6,11 +6,16 @@
 #include "ProLighting.h"
 #include "ProLightingTypes.h"
 #include "ArtNetTransport.h"
+#include "ArtNetRDM.h"
+#include "ArtNetRDMFakeNode.h"
 #include "IDMXTransport.h"
 #include "IBridgeEvents.h"
 #include "Sockets.h"
 #include "SocketSubsystem.h"
 
+class ULBEASTIOReactorSubsystem;
+struct FLBEASTIODatagram;
+
 /** Consolidated manager for Art-Net transport + discovery */
 /** Implements IDMXTransport for transport operations, with additional discovery capabilities */
 class PROLIGHTING_API FArtNetManager : public IDMXTransport, public IBridgeEvents
@@ -29,11 +34,20 @@ public:
     
     // Art-Net specific methods
     void Tick(float DeltaTime);
+    /** Receive discovery/RDM replies through the game instance's I/O reactor instead of polling in Tick() */
+    void UseIOReactor(ULBEASTIOReactorSubsystem* Reactor);
     void SendArtPoll();
     const TMap<FString, FLBEASTArtNetNode>& GetDiscoveredArtNetNodes() const { return DiscoveredNodes; }
     TArray<FLBEASTArtNetNode> GetNodes() const;
     FOnNodeDiscovered& OnNodeDiscovered() { return OnNodeDiscoveredDelegate; }
 
+    // RDM over Art-Net (ArtTodRequest/ArtTodData/ArtRdm on the discovery socket)
+    void EnableRDM(const FArtNetRDMEngine::FSettings& Settings);
+    FArtNetRDMEngine* GetRDM() const { return RDM.Get(); }
+    /** Route RDM traffic to an in-process node instead of the network (development/testing) */
+    void AttachFakeRDMNode(TUniquePtr<FArtNetRDMFakeNode> Node) { FakeRDMNode = MoveTemp(Node); }
+    FArtNetRDMFakeNode* GetFakeRDMNode() const { return FakeRDMNode.Get(); }
+
 	// IBridgeEvents interface
 	virtual void BridgeEvents(UProLightingController* Controller) override;
 
@@ -42,16 +56,41 @@ private:
     // Discovery (consolidated from ArtNetDiscovery)
     bool InitializeDiscovery(uint16 InPort);
     void ProcessIncoming();
+    void HandleDiscoveryPacket(const uint8* Data, int32 Num, const FString& SourceIP);
+    void HandleIOReactorDatagrams(const TArray<FLBEASTIODatagram>& Datagrams);
+    void UnregisterFromIOReactor();
+    /** Session replay callback (Address = node IPv4) */
+    void HandleCaptureReplay(uint32 Address, const TArray<uint8>& Data);
+    /** SendTo on the discovery socket, reported to session capture */
+    void SendDiscoveryPacket(const TArray<uint8>& Packet, const FInternetAddr& Destination, int32& OutBytesSent);
     TArray<uint8> BuildArtPollPacket() const;
     bool ParseArtPollReply(const TArray<uint8>& PacketData, FLBEASTArtNetNode& OutNode);
+    void ReportNodeHealth(const FString& SourceIP, const FLBEASTArtNetNode& Node);
+    void SendRDMPacket(const TArray<uint8>& Packet, const FString& NodeIP);
 
     FSocket* DiscoverySocket = nullptr;
+    TWeakObjectPtr<ULBEASTIOReactorSubsystem> IOReactor;
+    int32 IOReactorHandle = -1;
+    int32 CaptureSource = -1; // FLBEASTSessionCapture source id
     TSharedPtr<FInternetAddr> SendAddr;
     uint16 ArtNetPort = 6454;
     float PollIntervalSeconds = 2.0f;
     float Accumulated = 0.0f;
     TMap<FString, FLBEASTArtNetNode> DiscoveredNodes; // Key = Source IP
     FOnNodeDiscovered OnNodeDiscoveredDelegate;
+
+    // Device health (FLBEASTDeviceHealthRegistry) per discovered node
+    struct FNodeHealth
+    {
+        int32 Handle = -1;
+        bool bAwaitingPollReply = false;
+    };
+    TMap<FString, FNodeHealth> NodeHealth; // Key = Source IP
+    double LastPollSentSeconds = 0.0;
+
+    TUniquePtr<FArtNetRDMEngine> RDM;
+    TUniquePtr<FArtNetRDMFakeNode> FakeRDMNode;
+    TMap<FString, TSharedRef<FInternetAddr>> NodeAddresses; // Key = node IP (unicast RDM)
 };
 
 
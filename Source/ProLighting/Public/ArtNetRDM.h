@@ -0,0 +1,295 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProLighting.h"
+#include "ProLightingTypes.h"
+
+/**
+ * FArtNetRDMCodec - RDM (ANSI E1.20) messages and the Art-Net 4 packets that carry them
+ *
+ * Art-Net carries RDM without the 0xCC start code: an ArtRdm payload starts at the sub-start code,
+ * and the trailing checksum still includes the start code, exactly as on the DMX line.
+ * UIDs are 48-bit (manufacturer:device) held in the low bits of a uint64.
+ */
+struct PROLIGHTING_API FArtNetRDMCodec
+{
+	// Art-Net opcodes (sent little-endian)
+	static constexpr uint16 OpPoll = 0x2000;
+	static constexpr uint16 OpPollReply = 0x2100;
+	static constexpr uint16 OpTodRequest = 0x8000;
+	static constexpr uint16 OpTodData = 0x8100;
+	static constexpr uint16 OpTodControl = 0x8200;
+	static constexpr uint16 OpRdm = 0x8300;
+
+	/** ArtTodControl command: flush the table of devices and run full discovery on the DMX line */
+	static constexpr uint8 AtcFlush = 0x01;
+	/** ArtTodData CommandResponse: the node could not build the table */
+	static constexpr uint8 TodNak = 0xFF;
+	/** Largest table-of-devices block in one ArtTodData */
+	static constexpr int32 MaxUidsPerTodBlock = 200;
+
+	// RDM framing
+	static constexpr uint8 StartCode = 0xCC;
+	static constexpr uint8 SubStartCode = 0x01;
+	/** Bytes from the sub-start code to the parameter data */
+	static constexpr int32 HeaderSize = 23;
+
+	// Command classes
+	static constexpr uint8 GetCommand = 0x20;
+	static constexpr uint8 GetCommandResponse = 0x21;
+
+	// Response types
+	static constexpr uint8 ResponseAck = 0x00;
+	static constexpr uint8 ResponseAckTimer = 0x01;
+	static constexpr uint8 ResponseNackReason = 0x02;
+	static constexpr uint8 ResponseAckOverflow = 0x03;
+
+	// NACK reasons that mean "never ask this device for this PID again"
+	static constexpr uint16 NackUnknownPid = 0x0000;
+	static constexpr uint16 NackUnsupportedCommandClass = 0x0005;
+
+	// Parameter IDs
+	static constexpr uint16 PidStatusMessages = 0x0030;
+	static constexpr uint16 PidDeviceInfo = 0x0060;
+	static constexpr uint16 PidDeviceModelDescription = 0x0080;
+	static constexpr uint16 PidManufacturerLabel = 0x0081;
+	static constexpr uint16 PidDeviceLabel = 0x0082;
+	static constexpr uint16 PidDMXStartAddress = 0x00F0;
+	static constexpr uint16 PidLampHours = 0x0401;
+
+	/** STATUS_MESSAGES request: warnings and errors */
+	static constexpr uint8 StatusWarning = 0x03;
+	/** One STATUS_MESSAGES entry */
+	static constexpr int32 StatusMessageSize = 9;
+	/** DEVICE_INFO parameter data length */
+	static constexpr int32 DeviceInfoSize = 19;
+
+	/** One RDM message (request or response) */
+	struct FMessage
+	{
+		uint64 Destination = 0;
+		uint64 Source = 0;
+		uint8 Transaction = 0;
+		/** Port ID in requests, response type in responses */
+		uint8 PortOrResponse = 1;
+		uint8 MessageCount = 0;
+		uint16 SubDevice = 0;
+		uint8 CommandClass = GetCommand;
+		uint16 PID = 0;
+		TArray<uint8, TInlineAllocator<32>> Data;
+	};
+
+	/** "MMMM:DDDDDDDD" (the usual RDM notation) */
+	static FString FormatUID(uint64 UID);
+	static bool ParseUID(const FString& Text, uint64& OutUID);
+
+	/** Append an RDM message (sub-start code through checksum) */
+	static void WriteMessage(const FMessage& Message, TArray<uint8>& Out);
+
+	/** Parse an RDM message starting at the sub-start code; false on bad framing or checksum */
+	static bool ReadMessage(const uint8* Data, int32 Num, FMessage& OutMessage);
+
+	/** Art-Net opcode of a packet (0 if it is not Art-Net) */
+	static uint16 ReadOpCode(const uint8* Data, int32 Num);
+
+	/** "Art-Net\0" + opcode + protocol version 14 */
+	static void WriteHeader(uint16 OpCode, TArray<uint8>& Out);
+
+	/** ArtTodRequest for up to 32 port-addresses sharing one Net */
+	static void BuildTodRequest(uint8 Net, TConstArrayView<uint8> Addresses, TArray<uint8>& Out);
+	static void BuildTodControl(uint8 Net, uint8 Address, uint8 Command, TArray<uint8>& Out);
+	static void BuildTodData(uint8 Net, uint8 Address, uint8 Port, int32 UidTotal, uint8 BlockCount, TConstArrayView<uint64> Uids, TArray<uint8>& Out);
+	static void BuildRdm(uint8 Net, uint8 Address, const FMessage& Message, TArray<uint8>& Out);
+
+	/** ArtTodData: table block for one port-address */
+	struct FTodBlock
+	{
+		uint8 Net = 0;
+		uint8 Address = 0;
+		uint8 CommandResponse = 0;
+		int32 UidTotal = 0;
+		uint8 BlockCount = 0;
+		TArray<uint64> Uids;
+	};
+	static bool ParseTodData(const uint8* Data, int32 Num, FTodBlock& OutBlock);
+
+	/** ArtTodRequest / ArtTodControl / ArtRdm: Net and the first address byte (ArtTodRequest: all of them) */
+	static bool ParseAddressed(const uint8* Data, int32 Num, uint8& OutNet, TArray<uint8, TInlineAllocator<32>>& OutAddresses, uint8& OutCommand);
+};
+
+/**
+ * Art-Net RDM engine counters
+ */
+struct PROLIGHTING_API FArtNetRDMStats
+{
+	int32 Devices = 0;
+	int32 Interrogated = 0;
+	int32 InFlight = 0;
+	int32 Queued = 0;
+	int64 RequestsSent = 0;
+	int64 Responses = 0;
+	int64 Timeouts = 0;
+	int64 Nacks = 0;
+};
+
+/**
+ * FArtNetRDMEngine - RDM discovery and parameter polling over Art-Net (ArtTodRequest/ArtTodData/ArtRdm)
+ *
+ * Discovery on the DMX line (the DISC_UNIQUE_BRANCH binary search) belongs to the Art-Net node;
+ * Art-Net does not forward discovery messages. The engine asks nodes for their table of devices
+ * (flushing it first for a full rediscovery), refreshes it periodically, and diffs each complete
+ * table against what it knows: new UIDs are interrogated (DEVICE_INFO, model and manufacturer
+ * labels), UIDs that disappear are reported lost.
+ *
+ * GETs are queued per node port (node IP + port-address) and sent at most MaxInFlightPerPort at a
+ * time, spaced by PortSpacingSeconds, because every RDM transaction holds that node's DMX output
+ * for a few milliseconds. Once interrogated, devices are polled round-robin for start address,
+ * status messages and lamp hours; polls are only queued onto idle ports, so a large rig stretches
+ * the poll cycle rather than the DMX refresh.
+ *
+ * Non-blocking and game-thread driven: HandlePacket() as packets arrive, Tick() once per frame.
+ */
+class PROLIGHTING_API FArtNetRDMEngine
+{
+public:
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnDeviceChangedNative, const FLBEASTDiscoveredFixture& /*Fixture*/);
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnDeviceUIDNative, const FString& /*RDMUID*/);
+
+	/** Send an Art-Net packet to a node (empty IP = broadcast) */
+	using FSendFunction = TFunction<void(const TArray<uint8>& /*Packet*/, const FString& /*NodeIP*/)>;
+
+	struct FSettings
+	{
+		/** Art-Net Net (port-address bits 14-8) */
+		uint8 Net = 0;
+		/** Art-Net SubNet (port-address bits 7-4) */
+		uint8 SubNet = 0;
+		/** Outstanding RDM requests per node port */
+		int32 MaxInFlightPerPort = 1;
+		/** Minimum gap between transactions on one node port, so DMX keeps flowing */
+		float PortSpacingSeconds = 0.02f;
+		float RequestTimeoutSeconds = 0.5f;
+		int32 MaxRetries = 2;
+		/** Minimum time between polls of one device */
+		float PollIntervalSeconds = 0.5f;
+		/** Ask nodes for their table again this often (picks up hot-plugged fixtures) */
+		float TodRefreshSeconds = 10.0f;
+		/** Failed polls in a row before a device is reported lost */
+		int32 FailuresBeforeLost = 2;
+	};
+
+	void Initialize(const FSettings& InSettings, FSendFunction InSend);
+
+	/**
+	 * Discover devices behind the given universes (0-15 within the configured SubNet)
+	 * @param Universes - Empty = all 16 universes of the SubNet (nodes ignore ports they lack)
+	 * @param bFull - Flush the nodes' tables first so they run full discovery on the line
+	 */
+	void Discover(TConstArrayView<int32> Universes, bool bFull);
+
+	/** Offer a received Art-Net packet; true if it was RDM traffic */
+	bool HandlePacket(const uint8* Data, int32 Num, const FString& SourceIP);
+
+	/** Timeouts, retries, polling and table refresh (game thread, once per frame) */
+	void Tick(double NowSeconds);
+
+	/** Time for every device on the busiest port to be polled once */
+	float GetPollCycleSeconds() const;
+
+	FArtNetRDMStats GetStats() const;
+
+	/** Device interrogated, or polled info (address, lamp hours, status) changed */
+	FOnDeviceChangedNative& OnDeviceChanged() { return DeviceChanged; }
+	/** Any response from a device */
+	FOnDeviceUIDNative& OnDeviceResponded() { return DeviceResponded; }
+	/** Device left its node's table or stopped answering */
+	FOnDeviceUIDNative& OnDeviceLost() { return DeviceLost; }
+
+private:
+	/** One GET, queued or in flight */
+	struct FRequest
+	{
+		uint64 UID = 0;
+		uint16 PID = 0;
+		TArray<uint8, TInlineAllocator<4>> Params;
+		int32 Attempts = 0;
+		/** Part of the first look at a new device (DEVICE_INFO and labels) */
+		bool bInterrogation = false;
+		uint8 Transaction = 0;
+		double SentAt = 0.0;
+		double NotBefore = 0.0;
+		/** ACK_OVERFLOW: data gathered so far */
+		TArray<uint8> Gathered;
+	};
+
+	/** One DMX output of one node: the unit RDM transactions are serialized on */
+	struct FPort
+	{
+		FString NodeIP;
+		uint8 Address = 0;
+		TArray<FRequest> Queue;
+		TArray<FRequest> InFlight;
+		double NextSendAt = 0.0;
+
+		/** Devices in the node's last table, in table order; polled round-robin from PollCursor */
+		TArray<uint64> DeviceUIDs;
+		int32 PollCursor = 0;
+
+		/** Table of devices being assembled from ArtTodData blocks */
+		TSet<uint64> PendingTod;
+		int32 PendingTodTotal = 0;
+	};
+
+	struct FDevice
+	{
+		uint64 UID = 0;
+		int32 PortIndex = INDEX_NONE;
+		FLBEASTDiscoveredFixture Info;
+		/** Interrogation GETs still outstanding */
+		int32 InterrogationPending = 0;
+		bool bInterrogated = false;
+		bool bLost = false;
+		int32 ConsecutiveFailures = 0;
+		double NextPollAt = 0.0;
+		int32 PollStep = 0;
+		/** Poll PIDs the device NACKed as unknown (bit per poll step) */
+		uint8 UnsupportedPolls = 0;
+	};
+
+	FSettings Settings;
+	FSendFunction Send;
+	uint64 ControllerUID = 0;
+	uint8 NextTransaction = 0;
+
+	TArray<FPort> Ports;
+	TMap<uint64, FDevice> Devices;
+	TArray<int32> TodUniverses;
+	double NextTodRefreshAt = 0.0;
+	double LastTickSeconds = 0.0;
+
+	FArtNetRDMStats Counters;
+
+	FOnDeviceChangedNative DeviceChanged;
+	FOnDeviceUIDNative DeviceResponded;
+	FOnDeviceUIDNative DeviceLost;
+
+	uint8 PortAddressLow(int32 Universe) const { return (uint8)(((Settings.SubNet & 0x0F) << 4) | (Universe & 0x0F)); }
+	int32 FindOrAddPort(const FString& NodeIP, uint8 Address);
+	void Enqueue(FDevice& Device, uint16 PID, bool bInterrogation, TConstArrayView<uint8> Params = {});
+	void DropQueued(uint64 UID);
+	void SendTodRequests(bool bFlush);
+
+	void HandleTodData(const uint8* Data, int32 Num, const FString& SourceIP);
+	void ApplyTod(int32 PortIndex);
+	void HandleRdm(const uint8* Data, int32 Num, const FString& SourceIP);
+	void CompleteRequest(FDevice& Device, const FRequest& Request, bool bAck, const uint8* Data, int32 Num);
+	/** @return true if anything reported in FLBEASTDiscoveredFixture changed */
+	bool ApplyResponse(FDevice& Device, uint16 PID, const uint8* Data, int32 Num);
+
+	void SendRequest(FPort& Port, FRequest& Request, double NowSeconds);
+	void SchedulePolls(double NowSeconds);
+	void MarkResponded(FDevice& Device);
+	void MarkFailed(FDevice& Device);
+};
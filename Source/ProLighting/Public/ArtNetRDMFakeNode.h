@@ -0,0 +1,65 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProLighting.h"
+
+/**
+ * FArtNetRDMFakeNode - in-process Art-Net node with a rig of simulated RDM fixtures
+ *
+ * Answers ArtTodRequest/ArtTodControl with its table of devices (in 200-UID blocks, like a real
+ * node) and ArtRdm GETs for the PIDs FArtNetRDMEngine uses; anything else is NACKed as an unknown
+ * PID. FArtNetManager routes its RDM traffic here instead of the network when one is attached
+ * (FLBEASTProLightingConfig::bSimulateRDMNode), so discovery, auto-patch and polling of a large
+ * rig can be exercised without hardware. Replies are picked up on the next manager tick.
+ */
+class PROLIGHTING_API FArtNetRDMFakeNode
+{
+public:
+	/** Source IP the node's replies appear to come from */
+	static const TCHAR* NodeIP;
+
+	struct FFakeDevice
+	{
+		uint64 UID = 0;
+		/** Port-address low byte (SubNet << 4 | Universe) */
+		uint8 Address = 0;
+		uint16 StartAddress = 1;
+		uint16 Footprint = 1;
+		uint16 ProductCategory = 0x0101; // Fixture, fixed
+		uint16 ModelID = 1;
+		FString ModelName;
+		FString DeviceLabel;
+		uint32 LampHours = 0;
+		int32 StatusMessages = 0;
+		/** Still powered but missing from the line: absent from the table, no replies */
+		bool bUnplugged = false;
+	};
+
+	/**
+	 * Build a rig of Count fixtures packed into consecutive universes (SubNet, Universe 0 upward):
+	 * dimmers, RGB, RGBW and moving heads in turn
+	 */
+	void PopulateRig(uint8 InNet, uint8 SubNet, int32 Count);
+
+	TArray<FFakeDevice>& GetDevices() { return Devices; }
+
+	/** Fraction of RDM requests dropped without a reply (0-1) */
+	void SetDropRate(float InDropRate) { DropRate = FMath::Clamp(InDropRate, 0.0f, 1.0f); }
+
+	/** A packet sent by the controller; replies are queued */
+	void HandlePacket(const TArray<uint8>& Packet);
+
+	/** Move queued replies to OutReplies */
+	void TakeReplies(TArray<TArray<uint8>>& OutReplies);
+
+private:
+	uint8 Net = 0;
+	float DropRate = 0.0f;
+	TArray<FFakeDevice> Devices;
+	TArray<TArray<uint8>> Replies;
+
+	void SendTod(uint8 Address);
+	void AnswerRdm(const TArray<uint8>& Packet);
+};
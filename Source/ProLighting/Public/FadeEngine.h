@@ -30,6 +30,11 @@ public:
 		States.Remove(VirtualId);
 	}
 
+	void Reset()
+	{
+		States.Reset();
+	}
+
 	void Tick(float DeltaTime, TFunctionRef<void(int32,float)> OnIntensity)
 	{
 		for (auto& Pair : States)
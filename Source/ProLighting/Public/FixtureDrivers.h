@@ -5,122 +5,110 @@
 #include "CoreMinimal.h"
 #include "ProLighting.h"
 #include "ProLightingTypes.h"
-#include "UniverseBuffer.h"
 
-class PROLIGHTING_API IFixtureDriver
+/**
+ * FFixtureChannelLayout - a fixture personality compiled down to where its channels live
+ *
+ * Every supported personality (Dimmable, RGB, RGBW, MovingHead, Custom) differs only in which
+ * channels carry intensity and color, so registration resolves that once into absolute 0-based
+ * indices inside the fixture's universe. Channels the personality lacks (or that fall outside
+ * the universe) are None, which makes the write kernels a handful of branches and stores.
+ */
+struct FFixtureChannelLayout
 {
-public:
-	virtual ~IFixtureDriver() = default;
-	virtual void ApplyIntensity(const FLBEASTDMXFixture& Fixture, float Intensity, FUniverseBuffer& Buffer) = 0;
-	virtual void ApplyColor(const FLBEASTDMXFixture& Fixture, float Red, float Green, float Blue, float White, FUniverseBuffer& Buffer) = 0;
-};
+	static constexpr int16 None = -1;
 
-class PROLIGHTING_API FFixtureDriverDimmable : public IFixtureDriver
-{
-public:
-	virtual void ApplyIntensity(const FLBEASTDMXFixture& Fixture, float Intensity, FUniverseBuffer& Buffer) override
-	{
-		uint8 V = (uint8)(FMath::Clamp(Intensity, 0.0f, 1.0f) * 255.0f);
-		Buffer.SetChannel(Fixture.Universe, Fixture.DMXChannel, V);
-	}
-	virtual void ApplyColor(const FLBEASTDMXFixture&, float, float, float, float, FUniverseBuffer&) override {}
-};
+	int32 Universe = 0;
+	int16 Intensity = None;
+	int16 Red = None;
+	int16 Green = None;
+	int16 Blue = None;
+	int16 White = None;
 
-class PROLIGHTING_API FFixtureDriverRGB : public IFixtureDriver
-{
-public:
-	virtual void ApplyIntensity(const FLBEASTDMXFixture& Fixture, float Intensity, FUniverseBuffer& Buffer) override
-	{
-		uint8 V = (uint8)(FMath::Clamp(Intensity, 0.0f, 1.0f) * 255.0f);
-		Buffer.SetChannel(Fixture.Universe, Fixture.DMXChannel, V);
-	}
-	virtual void ApplyColor(const FLBEASTDMXFixture& Fixture, float Red, float Green, float Blue, float, FUniverseBuffer& Buffer) override
-	{
-		int32 Base = Fixture.DMXChannel;
-		Buffer.SetChannel(Fixture.Universe, Base + 0, (uint8)(FMath::Clamp(Red, 0.0f, 1.0f) * 255.0f));
-		Buffer.SetChannel(Fixture.Universe, Base + 1, (uint8)(FMath::Clamp(Green, 0.0f, 1.0f) * 255.0f));
-		Buffer.SetChannel(Fixture.Universe, Base + 2, (uint8)(FMath::Clamp(Blue, 0.0f, 1.0f) * 255.0f));
-	}
+	bool HasColor() const { return Red != None || Green != None || Blue != None || White != None; }
 };
 
-class PROLIGHTING_API FFixtureDriverRGBW : public IFixtureDriver
+/**
+ * FFixtureDrivers - stateless fixture kernels
+ *
+ * Compile() is the only place that looks at the personality; the kernels write straight into a
+ * 512-byte universe and never allocate, so they can run over thousands of fixtures per frame.
+ */
+struct FFixtureDrivers
 {
-public:
-	virtual void ApplyIntensity(const FLBEASTDMXFixture& Fixture, float Intensity, FUniverseBuffer& Buffer) override
-	{
-		uint8 V = (uint8)(FMath::Clamp(Intensity, 0.0f, 1.0f) * 255.0f);
-		Buffer.SetChannel(Fixture.Universe, Fixture.DMXChannel, V);
-	}
-	virtual void ApplyColor(const FLBEASTDMXFixture& Fixture, float Red, float Green, float Blue, float White, FUniverseBuffer& Buffer) override
+	static FFixtureChannelLayout Compile(const FLBEASTDMXFixture& Fixture)
 	{
-		int32 Base = Fixture.DMXChannel;
-		Buffer.SetChannel(Fixture.Universe, Base + 0, (uint8)(FMath::Clamp(Red, 0.0f, 1.0f) * 255.0f));
-		Buffer.SetChannel(Fixture.Universe, Base + 1, (uint8)(FMath::Clamp(Green, 0.0f, 1.0f) * 255.0f));
-		Buffer.SetChannel(Fixture.Universe, Base + 2, (uint8)(FMath::Clamp(Blue, 0.0f, 1.0f) * 255.0f));
-		Buffer.SetChannel(Fixture.Universe, Base + 3, (uint8)(FMath::Clamp(White, 0.0f, 1.0f) * 255.0f));
-	}
-};
+		FFixtureChannelLayout Layout;
+		Layout.Universe = Fixture.Universe;
 
-class PROLIGHTING_API FFixtureDriverMovingHead : public IFixtureDriver
-{
-public:
-	virtual void ApplyIntensity(const FLBEASTDMXFixture& Fixture, float Intensity, FUniverseBuffer& Buffer) override
-	{
-		uint8 V = (uint8)(FMath::Clamp(Intensity, 0.0f, 1.0f) * 255.0f);
-		int32 Base = Fixture.DMXChannel;
-		int32 Offset = (Fixture.ChannelCount >= 3) ? 2 : 0;
-		Buffer.SetChannel(Fixture.Universe, Base + Offset, V);
-	}
-	virtual void ApplyColor(const FLBEASTDMXFixture& Fixture, float Red, float Green, float Blue, float, FUniverseBuffer& Buffer) override
-	{
-		int32 Base = Fixture.DMXChannel;
-		// Assume RGB at offsets 3,4,5 (1-based -> 0-based math)
-		Buffer.SetChannel(Fixture.Universe, Base + 3, (uint8)(FMath::Clamp(Red, 0.0f, 1.0f) * 255.0f));
-		Buffer.SetChannel(Fixture.Universe, Base + 4, (uint8)(FMath::Clamp(Green, 0.0f, 1.0f) * 255.0f));
-		Buffer.SetChannel(Fixture.Universe, Base + 5, (uint8)(FMath::Clamp(Blue, 0.0f, 1.0f) * 255.0f));
+		// Offset from the start address -> universe index (None if absent or off the end)
+		auto At = [&Fixture](int32 Offset) -> int16
+		{
+			const int32 Channel = Fixture.DMXChannel + Offset;
+			return (Offset >= 0 && Channel >= 1 && Channel <= 512) ? (int16)(Channel - 1) : FFixtureChannelLayout::None;
+		};
+
+		switch (Fixture.FixtureType)
+		{
+		case ELBEASTDMXFixtureType::RGB:
+			// No dedicated dimmer: intensity drives the first (red) channel
+			Layout.Intensity = At(0);
+			Layout.Red = At(0);
+			Layout.Green = At(1);
+			Layout.Blue = At(2);
+			break;
+		case ELBEASTDMXFixtureType::RGBW:
+			Layout.Intensity = At(0);
+			Layout.Red = At(0);
+			Layout.Green = At(1);
+			Layout.Blue = At(2);
+			Layout.White = At(3);
+			break;
+		case ELBEASTDMXFixtureType::MovingHead:
+			// Pan, tilt, dimmer, then RGB
+			Layout.Intensity = At(Fixture.ChannelCount >= 3 ? 2 : 0);
+			Layout.Red = At(3);
+			Layout.Green = At(4);
+			Layout.Blue = At(5);
+			break;
+		case ELBEASTDMXFixtureType::Custom:
+			// CustomChannelMapping holds 1-based offsets for R, G, B (0 = not present)
+			Layout.Intensity = At(0);
+			if (Fixture.CustomChannelMapping.Num() >= 3)
+			{
+				Layout.Red = At(Fixture.CustomChannelMapping[0] - 1);
+				Layout.Green = At(Fixture.CustomChannelMapping[1] - 1);
+				Layout.Blue = At(Fixture.CustomChannelMapping[2] - 1);
+			}
+			break;
+		case ELBEASTDMXFixtureType::Dimmable:
+		default:
+			Layout.Intensity = At(0);
+			break;
+		}
+		return Layout;
 	}
-};
 
-class PROLIGHTING_API FFixtureDriverCustom : public IFixtureDriver
-{
-public:
-	virtual void ApplyIntensity(const FLBEASTDMXFixture& Fixture, float Intensity, FUniverseBuffer& Buffer) override
+	static FORCEINLINE uint8 ToDMX(float Value)
 	{
-		uint8 V = (uint8)(FMath::Clamp(Intensity, 0.0f, 1.0f) * 255.0f);
-		Buffer.SetChannel(Fixture.Universe, Fixture.DMXChannel, V);
+		return (uint8)(FMath::Clamp(Value, 0.0f, 1.0f) * 255.0f);
 	}
-	virtual void ApplyColor(const FLBEASTDMXFixture& Fixture, float Red, float Green, float Blue, float, FUniverseBuffer& Buffer) override
+
+	/** Write intensity into the fixture's universe (UniverseData = 512 bytes) */
+	static FORCEINLINE void WriteIntensity(const FFixtureChannelLayout& Layout, float Intensity, uint8* UniverseData)
 	{
-		if (Fixture.CustomChannelMapping.Num() >= 3)
+		if (Layout.Intensity != FFixtureChannelLayout::None)
 		{
-			int32 Base = Fixture.DMXChannel;
-			int32 ro = Fixture.CustomChannelMapping[0] - 1;
-			int32 go = Fixture.CustomChannelMapping[1] - 1;
-			int32 bo = Fixture.CustomChannelMapping[2] - 1;
-			if (ro >= 0) Buffer.SetChannel(Fixture.Universe, Base + ro, (uint8)(FMath::Clamp(Red, 0.0f, 1.0f) * 255.0f));
-			if (go >= 0) Buffer.SetChannel(Fixture.Universe, Base + go, (uint8)(FMath::Clamp(Green, 0.0f, 1.0f) * 255.0f));
-			if (bo >= 0) Buffer.SetChannel(Fixture.Universe, Base + bo, (uint8)(FMath::Clamp(Blue, 0.0f, 1.0f) * 255.0f));
+			UniverseData[Layout.Intensity] = ToDMX(Intensity);
 		}
 	}
-};
 
-class PROLIGHTING_API FFixtureDriverFactory
-{
-public:
-	static TUniquePtr<IFixtureDriver> Create(ELBEASTDMXFixtureType Type)
+	/** Write color into the fixture's universe; channels the fixture lacks are skipped */
+	static FORCEINLINE void WriteColor(const FFixtureChannelLayout& Layout, float Red, float Green, float Blue, float White, uint8* UniverseData)
 	{
-		switch (Type)
-		{
-		case ELBEASTDMXFixtureType::Dimmable: return MakeUnique<FFixtureDriverDimmable>();
-		case ELBEASTDMXFixtureType::RGB:      return MakeUnique<FFixtureDriverRGB>();
-		case ELBEASTDMXFixtureType::RGBW:     return MakeUnique<FFixtureDriverRGBW>();
-		case ELBEASTDMXFixtureType::MovingHead:return MakeUnique<FFixtureDriverMovingHead>();
-		case ELBEASTDMXFixtureType::Custom:   return MakeUnique<FFixtureDriverCustom>();
-		default: return MakeUnique<FFixtureDriverDimmable>();
-		}
+		if (Layout.Red != FFixtureChannelLayout::None) UniverseData[Layout.Red] = ToDMX(Red);
+		if (Layout.Green != FFixtureChannelLayout::None) UniverseData[Layout.Green] = ToDMX(Green);
+		if (Layout.Blue != FFixtureChannelLayout::None) UniverseData[Layout.Blue] = ToDMX(Blue);
+		if (Layout.White != FFixtureChannelLayout::None) UniverseData[Layout.White] = ToDMX(White);
 	}
 };
-
-
-
-
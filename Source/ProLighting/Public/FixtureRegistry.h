@@ -4,46 +4,71 @@
 
 #include "CoreMinimal.h"
 #include "ProLighting.h"
+#include "ProLightingTypes.h"
+#include "FixtureDrivers.h"
 
-// Forward declare to avoid circular include
-struct FLBEASTDMXFixture;
+/** Run of consecutive fixtures in registry order: indices First .. First + Num - 1 */
+struct FFixtureSpan
+{
+	int32 First = 0;
+	int32 Num = 0;
+};
 
-/** Simple registry for fixtures and RDM mappings */
+/**
+ * FFixtureRegistry - fixtures in patch order, with group/tag/zone indexes
+ *
+ * Fixtures, their compiled channel layouts and their IDs are parallel dense arrays sorted by
+ * universe and start address, so walking a universe - or a group patched side by side - reads
+ * memory front to back and stays on one universe buffer. Groups, tags and zones are indexed as
+ * bitsets over that order; Query() combines them and returns runs of consecutive fixtures.
+ *
+ * Register/Unregister update an up-to-date index in place (one insert or remove per array, no
+ * sort), so registering fixtures one by one stays linear per fixture. Other changes (Assign,
+ * MarkChanged) mark the order stale; it is rebuilt (sort plus one linear pass) on the next lookup.
+ * Indices, spans and pointers returned here are valid until the next change.
+ */
 class PROLIGHTING_API FFixtureRegistry
 {
 public:
-	bool Register(const FLBEASTDMXFixture& Fixture)
-	{
-		if (Fixtures.Contains(Fixture.VirtualFixtureID)) return false;
-		Fixtures.Add(Fixture.VirtualFixtureID, Fixture);
-		return true;
-	}
+	/** Add a fixture (false if the ID is taken) */
+	bool Register(const FLBEASTDMXFixture& Fixture);
 
-	void Unregister(int32 VirtualFixtureID)
-	{
-		Fixtures.Remove(VirtualFixtureID);
-		if (VirtualToRDM.Contains(VirtualFixtureID))
-		{
-			FString UID = VirtualToRDM[VirtualFixtureID];
-			VirtualToRDM.Remove(VirtualFixtureID);
-			RDMToVirtual.Remove(UID);
-		}
-	}
+	void Unregister(int32 VirtualFixtureID);
 
-	const FLBEASTDMXFixture* Find(int32 VirtualFixtureID) const
-	{
-		return Fixtures.Find(VirtualFixtureID);
-	}
+	/** Replace every fixture at once (show file load); IDs must already be unique */
+	void Assign(TArray<FLBEASTDMXFixture>&& InFixtures);
 
-	FLBEASTDMXFixture* FindMutable(int32 VirtualFixtureID)
-	{
-		return Fixtures.Find(VirtualFixtureID);
-	}
+	const FLBEASTDMXFixture* Find(int32 VirtualFixtureID) const;
 
-	TArray<int32> GetIDs() const
-	{
-		TArray<int32> Keys; Fixtures.GetKeys(Keys); return Keys;
-	}
+	/** Edit a fixture in place; call MarkChanged() after changing address, universe, personality or grouping */
+	FLBEASTDMXFixture* FindMutable(int32 VirtualFixtureID);
+
+	/** Rebuild order, layouts and indexes on the next lookup (bumps the serial now) */
+	void MarkChanged();
+
+	/** Move a fixture to a new start address in its universe */
+	bool Relocate(int32 VirtualFixtureID, int32 NewDMXChannel);
+
+	const FFixtureChannelLayout* FindLayout(int32 VirtualFixtureID) const;
+
+	/** Position of a fixture in registry order (INDEX_NONE if unknown) */
+	int32 IndexOf(int32 VirtualFixtureID) const;
+
+	int32 Num() const { return Fixtures.Num(); }
+
+	// Parallel arrays in registry order (universe, then start address)
+	TConstArrayView<FLBEASTDMXFixture> GetFixtures() const { EnsureIndexed(); return Fixtures; }
+	TConstArrayView<FFixtureChannelLayout> GetLayouts() const { EnsureIndexed(); return Layouts; }
+	TConstArrayView<int32> GetIDs() const { EnsureIndexed(); return FixtureIDs; }
+
+	/** A registered fixture occupying any of FirstChannel..LastChannel on Universe, or nullptr */
+	const FLBEASTDMXFixture* FindOverlap(int32 Universe, int32 FirstChannel, int32 LastChannel) const;
+
+	/** Fixtures matching Query, as runs of consecutive registry indices */
+	void Query(const FLBEASTFixtureQuery& InQuery, TArray<FFixtureSpan>& OutSpans) const;
+
+	/** Bumped by every change to order or layouts (immediately, not at the rebuild), so copies of layouts know to recompile */
+	uint32 GetSerial() const { return Serial; }
 
 	void MapRDM(int32 VirtualFixtureID, const FString& UID)
 	{
@@ -57,17 +82,28 @@ public:
 		return false;
 	}
 
-	void Reset()
-	{
-		Fixtures.Reset();
-		VirtualToRDM.Reset();
-		RDMToVirtual.Reset();
-	}
+	void Reset();
 
 private:
-	TMap<int32, FLBEASTDMXFixture> Fixtures;
+	void EnsureIndexed() const;
+
+	/** Insert into the sorted arrays and indexes (index must be up to date) */
+	void InsertIndexed(const FLBEASTDMXFixture& Fixture);
+
+	/** Remove from the sorted arrays and indexes (index must be up to date) */
+	void RemoveIndexed(int32 Index);
+
+	// Fixtures are only appended or removed directly; order, layouts and indexes are derived
+	mutable TArray<FLBEASTDMXFixture> Fixtures;
+	mutable TArray<FFixtureChannelLayout> Layouts;
+	mutable TArray<int32> FixtureIDs;
+	mutable TMap<int32, int32> IndexByID;
+	mutable TMap<FName, TBitArray<>> GroupBits;
+	mutable TMap<FName, TBitArray<>> TagBits;
+	mutable TMap<int32, TBitArray<>> ZoneBits;
+	mutable bool bIndexDirty = false;
+	mutable uint32 Serial = 0;
+
 	TMap<int32, FString> VirtualToRDM;
 	TMap<FString, int32> RDMToVirtual;
 };
-
-
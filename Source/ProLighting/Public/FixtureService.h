@@ -13,10 +13,17 @@
 #include "IBridgeEvents.h"
 
 class FRDMService;
+class FLightingShowFile;
 
 /**
  * FFixtureService
  * Encapsulates fixture registration, validation, driver application, fades, and buffer updates.
+ *
+ * Registration compiles each fixture's personality into an FFixtureChannelLayout, kept by the
+ * registry in patch order; every write by ID (including fades and the batch APIs) goes through that
+ * layout and the stateless kernels in FFixtureDrivers, straight into universe memory, without
+ * allocating. Group operations select fixtures with an FLBEASTFixtureQuery and walk the matching
+ * runs of the registry's arrays in order.
  */
 class PROLIGHTING_API FFixtureService : public IBridgeEvents
 {
@@ -29,10 +36,59 @@ public:
 
 	void Unregister(int32 VirtualFixtureID);
 
+	/**
+	 * Replace the whole patch with one validated as a unit (FLightingShowFile), skipping per-fixture
+	 * validation; running fades are dropped
+	 * @return Number of fixtures registered
+	 */
+	int32 LoadPatch(TArray<FLBEASTDMXFixture>&& Fixtures);
+
+	/** Every registered fixture, in registry order */
+	TConstArrayView<FLBEASTDMXFixture> GetFixtures() const { return Registry.GetFixtures(); }
+
+	/**
+	 * Copy a show file cue's levels into the universes. Running fades stop so they don't pull
+	 * fixtures off the cue; no per-fixture change events are raised.
+	 * @return Number of universes written
+	 */
+	int32 RecallCue(const FLightingShowFile& File, int32 CueIndex);
+
 	void ApplyIntensity(const FLBEASTDMXFixture& Fixture, float Intensity);
 
 	void ApplyColor(const FLBEASTDMXFixture& Fixture, float Red, float Green, float Blue, float White);
 
+	/**
+	 * Set intensity on many registered fixtures at once (chases, group fades)
+	 * @param Intensities - One value per fixture, or a single value for all of them
+	 * @return Number of fixtures written
+	 */
+	int32 ApplyIntensityBatch(TConstArrayView<int32> VirtualFixtureIDs, TConstArrayView<float> Intensities);
+
+	/**
+	 * Set color on many registered fixtures at once; A carries white (ignored by fixtures without one)
+	 * @param Colors - One color per fixture, or a single color for all of them
+	 * @return Number of fixtures written
+	 */
+	int32 ApplyColorBatch(TConstArrayView<int32> VirtualFixtureIDs, TConstArrayView<FLinearColor> Colors);
+
+	/** Fixtures matching a group/tag/zone query, as runs of registry indices (see FFixtureRegistry) */
+	void QueryFixtures(const FLBEASTFixtureQuery& Query, TArray<FFixtureSpan>& OutSpans) const;
+
+	/** IDs of the fixtures matching a query, in patch order */
+	void GetFixtureIDs(const FLBEASTFixtureQuery& Query, TArray<int32>& OutIDs) const;
+
+	/** Set intensity on every fixture matching Query in one pass; @return Number of fixtures written */
+	int32 ApplyIntensityToQuery(const FLBEASTFixtureQuery& Query, float Intensity);
+
+	/** Set color on every color-capable fixture matching Query; A carries white */
+	int32 ApplyColorToQuery(const FLBEASTFixtureQuery& Query, const FLinearColor& Color);
+
+	/** Fade every fixture matching Query from its current level; @return Number of fades started */
+	int32 StartFadeForQuery(const FLBEASTFixtureQuery& Query, float TargetIntensity, float DurationSec);
+
+	/** Replace a fixture's groups, tags and zone */
+	bool SetFixtureGrouping(int32 VirtualFixtureID, const TArray<FName>& Groups, const TArray<FName>& Tags, int32 Zone);
+
 	void ApplyChannelRaw(const FLBEASTDMXFixture& Fixture, int32 ChannelOffset, uint8 Value);
 
 	void StartFade(int32 VirtualFixtureID, float Current, float Target, float DurationSec);
@@ -50,9 +106,19 @@ public:
     void StartFadeById(int32 VirtualFixtureID, float TargetIntensity, float DurationSec);
     void AllOffAndNotify(TFunctionRef<void(int32,float)> OnIntensity);
 
+    /** Move a registered fixture to a new start address (e.g. RDM reported a readdress) */
+    bool RelocateFixture(int32 VirtualFixtureID, int32 NewDMXChannel);
+
+    /** Compiled channel layout of a registered fixture (nullptr if unknown); invalidated by the next layout change */
+    const FFixtureChannelLayout* FindLayout(int32 VirtualFixtureID) const;
+
+    /** Bumped whenever a layout is added, moved or removed, so copies of layouts know to recompile */
+    uint32 GetLayoutSerial() const { return Registry.GetSerial(); }
+
     // Fixture query methods
     bool IsFixtureRDMCapable(int32 VirtualFixtureID) const;
     const FLBEASTDMXFixture* FindFixture(int32 VirtualFixtureID) const;
+    /** Metadata only - address, personality and grouping changes go through RelocateFixture / SetFixtureGrouping / re-registration */
     FLBEASTDMXFixture* FindFixtureMutable(int32 VirtualFixtureID);
 
     // ID generation
@@ -81,6 +147,12 @@ private:
     // ID generation counter
     int32 NextVirtualFixtureID = 1;
 
+    // Reused by the query operations
+    TArray<FFixtureSpan> QuerySpans;
+
+    /** Universe memory for a layout, reusing the previous lookup while consecutive fixtures share a universe */
+    uint8* ResolveUniverse(int32 Universe, int32& CachedUniverse, uint8*& CachedData);
+
     FOnIntensityChangedNative IntensityChanged;
     FOnColorChangedNative ColorChanged;
 };
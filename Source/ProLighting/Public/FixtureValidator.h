@@ -17,18 +17,10 @@ public:
 		int32 Channels = Candidate.ChannelCount > 0 ? Candidate.ChannelCount : RequiredChannels(Candidate);
 		int32 End = Candidate.DMXChannel + Channels - 1;
 		if (End > 512) { OutError = TEXT("Fixture exceeds universe size"); return false; }
-		for (int32 Id : Registry.GetIDs())
+		if (const FLBEASTDMXFixture* Existing = Registry.FindOverlap(Candidate.Universe, Candidate.DMXChannel, End))
 		{
-			const FLBEASTDMXFixture* Existing = Registry.Find(Id);
-			if (!Existing) continue;
-			if (Existing->Universe != Candidate.Universe) continue;
-			int32 ExistingEnd = Existing->DMXChannel + Existing->ChannelCount - 1;
-			bool bOverlap = !(End < Existing->DMXChannel || Candidate.DMXChannel > ExistingEnd);
-			if (bOverlap)
-			{
-				OutError = FString::Printf(TEXT("Overlaps with fixture %d"), Existing->VirtualFixtureID);
-				return false;
-			}
+			OutError = FString::Printf(TEXT("Overlaps with fixture %d"), Existing->VirtualFixtureID);
+			return false;
 		}
 		return true;
 	}
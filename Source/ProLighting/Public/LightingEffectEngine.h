@@ -0,0 +1,188 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "ProLighting.h"
+#include "ProLightingTypes.h"
+#include "FixtureDrivers.h"
+#include <atomic>
+
+class FFixtureService;
+class FUniverseBuffer;
+class FRunnableThread;
+class FEvent;
+
+/**
+ * FLightingEffectEngine - bulk evaluation of lighting effects off the game thread
+ *
+ * Effects (FLBEASTLightingEffect) are compiled against the fixtures' channel layouts when played.
+ * Each frame the game thread kicks the worker thread with the current time; the worker evaluates
+ * every effect over its whole fixture array (waveforms four fixtures at a time) and resolves the
+ * effect layers by priority into one overlay per universe. The game thread picks up the newest
+ * finished overlay on the next frame and composites it over the manual levels in Composite().
+ *
+ * Layering, lowest first: manual levels (FixtureService writes), then effects by Priority.
+ * An LTP layer replaces everything below it on the channels it drives; an HTP layer keeps the
+ * higher of itself and what is below. Manual levels are never overwritten, so stopping an
+ * effect reveals them again.
+ *
+ * The overlay trails the game thread by one frame. Effects do not raise per-fixture
+ * intensity/color events.
+ */
+class PROLIGHTING_API FLightingEffectEngine : public FRunnable
+{
+public:
+	explicit FLightingEffectEngine(FFixtureService& InFixtures);
+	virtual ~FLightingEffectEngine();
+
+	bool Start();
+	void Shutdown();
+
+	/**
+	 * Start an effect (game thread)
+	 * @return Effect handle, or INDEX_NONE if none of its fixtures are registered
+	 */
+	int32 PlayEffect(const FLBEASTLightingEffect& Effect);
+
+	bool StopEffect(int32 EffectHandle);
+	void StopAllEffects();
+
+	/** Change an effect's level without recompiling it */
+	bool SetEffectMaster(int32 EffectHandle, float Master);
+
+	int32 NumActiveEffects() const { return Effects.Num(); }
+
+	/**
+	 * Per frame (game thread): pick up the newest finished overlay, start pixel-map readbacks
+	 * and kick evaluation for this frame
+	 */
+	void Tick();
+
+	/**
+	 * Write manual levels plus the effect overlay into Out (game thread)
+	 * @return false when no effect is active - send Base as is
+	 */
+	bool Composite(const FUniverseBuffer& Base, FUniverseBuffer& Out) const;
+
+	// FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	/** CPU copy of a pixel-map source (BGRA, row-major) */
+	struct FPixelFrame
+	{
+		int32 Width = 0;
+		int32 Height = 0;
+		TArray<FColor> Pixels;
+	};
+	using FPixelFramePtr = TSharedPtr<const FPixelFrame, ESPMode::ThreadSafe>;
+
+	/** State shared by the game thread, the worker and the render thread for one playing effect */
+	struct FLiveEffect
+	{
+		std::atomic<float> Master{ 1.0f };
+		FCriticalSection PixelLock;
+		FPixelFramePtr PixelFrame;
+	};
+	using FLiveEffectPtr = TSharedPtr<FLiveEffect, ESPMode::ThreadSafe>;
+
+	struct FPixelReadback;
+
+	/** Effect as the worker sees it: settings plus struct-of-arrays over its fixtures */
+	struct FCompiledEffect
+	{
+		ELBEASTLightingEffectTarget Target = ELBEASTLightingEffectTarget::Intensity;
+		ELBEASTLightingWaveform Waveform = ELBEASTLightingWaveform::Sine;
+		ELBEASTLightingMergeMode MergeMode = ELBEASTLightingMergeMode::HTP;
+		float Rate = 1.0f;
+		float Duty = 0.5f;
+		float Low = 0.0f;
+		float High = 1.0f;
+		FLinearColor ColorA = FLinearColor::Black;
+		FLinearColor ColorB = FLinearColor::White;
+		bool bHueCycle = false;
+		double StartSeconds = 0.0;
+
+		TArray<FFixtureChannelLayout> Layouts;
+		/** Per fixture: phase offset in cycles */
+		TArray<float> PhaseOffsets;
+		/** Per fixture: pixel-map UV */
+		TArray<FVector2f> PixelUVs;
+
+		FLiveEffectPtr Live;
+	};
+
+	/** Immutable, sorted by priority (lowest first); swapped whole when effects change */
+	struct FProgram
+	{
+		TArray<FCompiledEffect> Effects;
+	};
+	using FProgramPtr = TSharedPtr<const FProgram, ESPMode::ThreadSafe>;
+
+	/** Per-channel result of every effect layer on one universe */
+	struct FUniverseOverlay
+	{
+		enum : uint8 { Untouched = 0, Highest = 1, Replace = 2 };
+
+		int32 Universe = 0;
+		uint8 Value[512];
+		uint8 Mode[512];
+	};
+
+	/** Game-thread record of a playing effect */
+	struct FEffectEntry
+	{
+		int32 Handle = INDEX_NONE;
+		int32 Priority = 0;
+		FLBEASTLightingEffect Source;
+		double StartSeconds = 0.0;
+		FLiveEffectPtr Live;
+		TSharedPtr<FPixelReadback, ESPMode::ThreadSafe> Readback;
+	};
+
+	FFixtureService& Fixtures;
+
+	// Game thread
+	TArray<FEffectEntry> Effects;
+	int32 NextHandle = 1;
+	uint32 CompiledLayoutSerial = 0;
+	FProgramPtr GameProgram;
+
+	void Recompile();
+	static void CompileEffect(const FFixtureService& InFixtures, const FEffectEntry& Entry, FCompiledEffect& Out);
+	void RequestPixelReadbacks();
+
+	// Kick: latest job wins if the worker is still busy
+	FCriticalSection JobLock;
+	FProgramPtr PendingProgram;
+	double PendingSeconds = 0.0;
+	uint32 PendingGeneration = 0;
+	bool bJobPending = false;
+
+	/** Bumped when the last effect stops, so results still in flight for old effects are dropped */
+	uint32 Generation = 0;
+
+	// Triple buffer: worker fills Back, publishes it as Ready; the game thread takes Ready as Front
+	TArray<FUniverseOverlay> Overlays[3];
+	int32 BackIndex = 0;
+	int32 ReadyIndex = 1;
+	int32 FrontIndex = 2;
+	bool bReadyFresh = false;
+	uint32 ReadyGeneration = 0;
+	FCriticalSection ResultLock;
+
+	// Worker scratch (reused every frame)
+	TArray<float> Phase;
+	TArray<float> Wave;
+
+	void Evaluate(const FProgram& Program, double NowSeconds, TArray<FUniverseOverlay>& Out);
+	static void EvaluateWave(const FCompiledEffect& Effect, double NowSeconds, TArray<float>& OutPhase, TArray<float>& OutWave);
+
+	FRunnableThread* Thread = nullptr;
+	FEvent* WakeEvent = nullptr;
+	FThreadSafeBool bStopRequested;
+};
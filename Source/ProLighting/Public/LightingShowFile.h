@@ -0,0 +1,232 @@
+// Copyright (c) 2025 AJ Campbell. Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProLighting.h"
+#include "ProLightingTypes.h"
+
+class FUniverseBuffer;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * On-disk records of a show file. Plain data read in place from the mapped file, so sizes and
+ * layout are part of the format - bump FLightingShowFile::FileVersion when any of them change.
+ */
+namespace LightingShowFormat
+{
+	/** UTF-8 text in the Strings section */
+	struct FStringRef
+	{
+		uint32 Offset = 0;
+		uint32 Length = 0;
+	};
+
+	struct FFixtureRecord
+	{
+		int32 VirtualFixtureID = 0;
+		uint8 FixtureType = 0;
+		/** Explicit padding, written as zero so the checksummed image is deterministic */
+		uint8 Reserved0 = 0;
+		/** 15-bit Art-Net port address (Net:SubNet:Universe), 0..MaxUniverse */
+		uint16 Universe = 0;
+		uint16 DMXChannel = 1;
+		uint16 ChannelCount = 1;
+		uint16 Flags = 0;
+		uint16 Reserved1 = 0;
+		int32 Zone = 0;
+		/** Range of the Mappings section (CustomChannelMapping) */
+		uint32 FirstMapping = 0;
+		uint32 NumMappings = 0;
+		FStringRef RDMUID;
+	};
+
+	enum EFixtureFlags : uint16
+	{
+		FixtureFlag_RDMCapable = 1 << 0
+	};
+
+	enum class EGroupKind : uint32
+	{
+		Group = 0,
+		Tag = 1
+	};
+
+	/** A group or tag; its members are fixture indices in the Members section */
+	struct FGroupRecord
+	{
+		FStringRef Name;
+		EGroupKind Kind = EGroupKind::Group;
+		uint32 FirstMember = 0;
+		uint32 NumMembers = 0;
+	};
+
+	/** A cue: full 512-channel levels for each universe it stores */
+	struct FCueRecord
+	{
+		FStringRef Name;
+		uint32 FirstBlock = 0;
+		uint32 NumBlocks = 0;
+	};
+
+	struct FCueBlock
+	{
+		int32 Universe = 0;
+		/** Byte offset of the universe's 512 levels in the Levels section */
+		uint32 LevelsOffset = 0;
+	};
+
+	enum ESection : int32
+	{
+		Section_Fixtures,
+		Section_Mappings,
+		Section_Groups,
+		Section_Members,
+		Section_Cues,
+		Section_CueBlocks,
+		Section_Levels,
+		Section_Strings,
+		Section_Count
+	};
+
+	/** Highest universe a show file can address (Art-Net port addresses are 15 bits) */
+	constexpr int32 MaxUniverse = 0x7FFF;
+
+	static_assert(sizeof(FFixtureRecord) == 36, "Show file fixture record layout changed");
+	static_assert(sizeof(FGroupRecord) == 20, "Show file group record layout changed");
+	static_assert(sizeof(FCueRecord) == 16, "Show file cue record layout changed");
+	static_assert(sizeof(FCueBlock) == 8, "Show file cue block layout changed");
+}
+
+/**
+ * FLightingShowFile - a venue's patch and cues, loaded from one binary file
+ *
+ * File format (little-endian, sections 8-byte aligned):
+ *   Header:   "LBEASTLX" | uint32 Version | uint32 HeaderSize | uint32 Crc32 (of everything after the header)
+ *             | uint32 Reserved | Section_Count x (uint32 Offset, uint32 Count)
+ *   Fixtures: FFixtureRecord[], sorted by universe and start address (FFixtureRegistry order)
+ *   Mappings: int32[] custom channel mappings
+ *   Groups:   FGroupRecord[]
+ *   Members:  uint32[] fixture indices
+ *   Cues:     FCueRecord[]
+ *   CueBlocks: FCueBlock[]
+ *   Levels:   uint8[] (512 per cue block)
+ *   Strings:  UTF-8 text
+ *
+ * Open() maps the file (falling back to reading it on platforms without mapping) and checks the
+ * header, every section bound, the checksum and every record - IDs unique, addresses inside the
+ * universe, no overlaps - in one pass. After that the patch is trusted as a whole and cue recall is
+ * a straight copy of stored levels into universe memory. The file stays mapped while this object
+ * lives.
+ */
+class PROLIGHTING_API FLightingShowFile
+{
+public:
+	/** 2: fixture universes widened to 16 bits (version 1 files are rejected; re-save them) */
+	static constexpr uint32 FileVersion = 2;
+	static constexpr int32 HeaderSize = 24 + LightingShowFormat::Section_Count * 8;
+
+	FLightingShowFile();
+	~FLightingShowFile();
+
+	/** Map and validate a show file; on failure nothing stays open */
+	bool Open(const FString& FilePath, FString& OutError);
+
+	void Close();
+
+	bool IsOpen() const { return Data != nullptr; }
+	const FString& GetPath() const { return Path; }
+
+	/**
+	 * Check a whole show file image (header, bounds, checksum and records)
+	 * Shared by Open() and FLightingShowFileWriter, so nothing is written that would not load.
+	 */
+	static bool Validate(const uint8* FileData, int64 FileSize, FString& OutError);
+
+	/** The patch as registrable fixtures, in registry order */
+	void BuildPatch(TArray<FLBEASTDMXFixture>& OutFixtures) const;
+
+	int32 NumFixtures() const { return Fixtures.Num(); }
+	int32 NumGroups() const { return Groups.Num(); }
+	int32 NumCues() const { return Cues.Num(); }
+
+	/** Cue index by name (INDEX_NONE if the file has no such cue) */
+	int32 FindCue(FName CueName) const;
+
+	FName GetCueName(int32 CueIndex) const;
+
+	/** Universes a cue stores and their 512 levels each */
+	void GetCueLevels(int32 CueIndex, TArray<int32>& OutUniverses, TArray<TConstArrayView<uint8>>& OutLevels) const;
+
+	/**
+	 * Copy a cue's levels into Buffer, creating universes as needed
+	 * @return Number of universes written
+	 */
+	int32 RecallCue(int32 CueIndex, FUniverseBuffer& Buffer) const;
+
+private:
+	FString Path;
+
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	/** Used instead of the mapping where the platform cannot map files */
+	TArray<uint8> LoadedBytes;
+
+	const uint8* Data = nullptr;
+	int64 Size = 0;
+
+	// Views into Data
+	TConstArrayView<LightingShowFormat::FFixtureRecord> Fixtures;
+	TConstArrayView<int32> Mappings;
+	TConstArrayView<LightingShowFormat::FGroupRecord> Groups;
+	TConstArrayView<uint32> Members;
+	TConstArrayView<LightingShowFormat::FCueRecord> Cues;
+	TConstArrayView<LightingShowFormat::FCueBlock> CueBlocks;
+	TConstArrayView<uint8> Levels;
+	TConstArrayView<uint8> Strings;
+
+	TMap<FName, int32> CueIndexByName;
+
+	void BindSections();
+	FString ReadString(const LightingShowFormat::FStringRef& Ref) const;
+};
+
+/**
+ * FLightingShowFileWriter - exports a patch and recorded cues as a show file
+ *
+ * Fixtures are written in registry order with their groups and tags; each cue stores the full
+ * levels of every universe it was captured from. Save() validates the image with the same checks
+ * as FLightingShowFile::Open() before anything reaches disk.
+ */
+class PROLIGHTING_API FLightingShowFileWriter
+{
+public:
+	void SetPatch(TConstArrayView<FLBEASTDMXFixture> InFixtures);
+
+	/** Capture every universe in Buffer as a cue; replaces a cue with the same name */
+	void AddCue(FName CueName, const FUniverseBuffer& Buffer);
+
+	/** Copy cues from a loaded file, keeping any already added under the same name */
+	void AddCues(const FLightingShowFile& File);
+
+	int32 NumCues() const { return Cues.Num(); }
+
+	void Reset();
+
+	bool Save(const FString& FilePath, FString& OutError) const;
+
+private:
+	struct FRecordedCue
+	{
+		FName Name;
+		TArray<int32> Universes;
+		/** 512 levels per universe, in Universes order */
+		TArray<uint8> Levels;
+	};
+
+	TArray<FLBEASTDMXFixture> Fixtures;
+	TArray<FRecordedCue> Cues;
+
+	FRecordedCue& FindOrAddCue(FName CueName);
+};
@@ -4,9 +4,18 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "LBEASTStats.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogProLighting, Log, All);
 
+/** Stats group ("stat LBEASTProLighting") and Unreal Insights channel for this module (see LBEASTStats.h) */
+DECLARE_STATS_GROUP(TEXT("LBEAST ProLighting"), STATGROUP_LBEASTProLighting, STATCAT_Advanced);
+LBEAST_DECLARE_TRACE_CHANNEL(LBEASTProLightingChannel, PROLIGHTING_API);
+
+#define PROLIGHTING_SCOPE_CYCLE_COUNTER(StatId) LBEAST_SCOPE_CYCLE_COUNTER(StatId, "ProLighting", LBEASTProLightingChannel)
+#define PROLIGHTING_INC_COUNTER(StatId, Amount) LBEAST_INC_COUNTER(StatId, "ProLighting", Amount)
+#define PROLIGHTING_SET_GAUGE(StatId, Value) LBEAST_SET_GAUGE(StatId, "ProLighting", Value)
+
 class FProLightingModule : public IModuleInterface
 {
 public:
@@ -12,8 +12,12 @@
 #include "USBDMXTransport.h"
 #include "ArtNetManager.h"
 #include "FixtureService.h"
+#include "LightingEffectEngine.h"
+#include "LightingShowFile.h"
 #include "ProLightingController.generated.h"
 
+struct FLBEASTShowCue;
+
 // ELBEASTDMXMode and FLBEASTProLightingConfig moved to ProLightingTypes.h
 
 /**
@@ -39,6 +43,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProLighting")
 	FLBEASTProLightingConfig Config;
 
+	/** Show-control track this controller answers to (Intensity, Color, Fade, Cue cues). None = not registered. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProLighting|Show Control")
+	FName ShowTrackName = FName("Lighting");
+
 	/**
 	 * Initialize DMX connection
 	 */
@@ -59,9 +67,10 @@ public:
 	void DiscoverArtNetNodes();
 
 	/**
-	 * Discover RDM-capable fixtures on the DMX line
-	 * Works with USB DMX (if RDM-capable) or Art-Net (RDM runs over DMX cable from Art-Net nodes)
-	 * Requires RDM-capable DMX interface
+	 * Rediscover RDM fixtures on every universe of the configured Art-Net SubNet
+	 * Nodes flush their device tables and rerun discovery on the DMX line; fixtures are reported
+	 * through OnFixtureDiscovered as they are identified (and registered if bAutoRegisterRDMFixtures).
+	 * Art-Net only - discovery and polling also run on their own once RDM is enabled.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "LBEAST|ProLighting|Discovery")
 	void DiscoverRDMFixtures();
@@ -111,6 +120,81 @@ public:
     // Controller exposes service accessor for direct use where appropriate (C++ only - not exposed to Blueprint)
     FFixtureService* GetFixtureService() const { return FixtureService.Get(); }
 
+	/**
+	 * Set intensity on every fixture matching a group/tag/zone query
+	 * @return Number of fixtures written
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|ProLighting|Groups")
+	int32 SetGroupIntensity(const FLBEASTFixtureQuery& Query, float Intensity);
+
+	/**
+	 * Set color on every color-capable fixture matching a query
+	 * @param White - White channel level (0-1) on fixtures that have one
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|ProLighting|Groups")
+	int32 SetGroupColor(const FLBEASTFixtureQuery& Query, FLinearColor Color, float White = 0.0f);
+
+	/** Fade every fixture matching a query from its current level */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|ProLighting|Groups")
+	int32 FadeGroup(const FLBEASTFixtureQuery& Query, float TargetIntensity, float DurationSec);
+
+	/** IDs of the fixtures matching a query, in patch order */
+	UFUNCTION(BlueprintPure, Category = "LBEAST|ProLighting|Groups")
+	TArray<int32> GetFixturesInQuery(const FLBEASTFixtureQuery& Query) const;
+
+	// ========================================
+	// EFFECTS
+	// ========================================
+
+	/**
+	 * Play a parameterized effect (wave, chase, rainbow, pixel map) over a group of fixtures
+	 * Evaluated in bulk on the effect worker thread and layered over manual levels by priority (HTP/LTP).
+	 * @return Effect handle for StopEffect / SetEffectMaster, -1 if no fixture in the group is registered
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|ProLighting|Effects")
+	int32 PlayEffect(const FLBEASTLightingEffect& Effect);
+
+	/** Stop a playing effect; the levels beneath it show again */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|ProLighting|Effects")
+	bool StopEffect(int32 EffectHandle);
+
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|ProLighting|Effects")
+	void StopAllEffects();
+
+	/** Scale a playing effect (0-1) - cheap enough to drive from a fader every frame */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|ProLighting|Effects")
+	bool SetEffectMaster(int32 EffectHandle, float Master);
+
+	// ========================================
+	// SHOW FILE (patch and cues)
+	// ========================================
+
+	/**
+	 * Replace the patch with a show file's and keep the file open for cue recall
+	 * Fixtures registered at runtime are dropped. Relative paths are under the project directory.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|ProLighting|Show File")
+	bool LoadShowFile(const FString& FilePath);
+
+	/** Capture the current manual levels of every universe as a cue (effects are not recorded) */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|ProLighting|Show File")
+	void RecordCue(FName CueName);
+
+	/**
+	 * Export the current patch, the recorded cues and the open file's other cues
+	 * The saved file becomes the one cues are recalled from.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|ProLighting|Show File")
+	bool SaveShowFile(const FString& FilePath);
+
+	/** Copy a saved cue's levels into the universes; running fades stop */
+	UFUNCTION(BlueprintCallable, Category = "LBEAST|ProLighting|Show File")
+	bool RecallCue(FName CueName);
+
+	/** Cues in the open show file */
+	UFUNCTION(BlueprintPure, Category = "LBEAST|ProLighting|Show File")
+	TArray<FName> GetCueNames() const;
+
 	/**
 	 * Check if DMX is connected
 	 */
@@ -191,9 +275,19 @@ protected:
 private:
 	friend class IDMXTransport; // Allow factory to access private members for setup
 
+	/** Show-control track handler (game thread) */
+	void ExecuteShowCue(const FLBEASTShowCue& Cue, double LateSeconds);
+
+	/** Name the track was actually registered under (ShowTrackName, or ShowTrackName_N if another instance holds it) */
+	FName RegisteredShowTrackName;
+
     /** DMX universe data (shared between controller for flushing and FixtureService for fixture operations) */
     FUniverseBuffer UniverseBuffer;
 
+    /** Effect engine (worker thread) and the manual-plus-effects output it composites into */
+    TUniquePtr<FLightingEffectEngine> EffectEngine;
+    FUniverseBuffer EffectOutputBuffer;
+
     /** RDM service */
     TUniquePtr<FRDMService> RDMService;
 
@@ -209,6 +303,12 @@ private:
     /** RDM polling timer */
     float RDMPollTimer = 0.0f;
 
+	/** Open show file (cue recall) and cues recorded since, waiting for SaveShowFile */
+	TUniquePtr<FLightingShowFile> ShowFile;
+	FLightingShowFileWriter RecordedCues;
+
+	FString ResolveShowFilePath(const FString& FilePath) const;
+
 	// ========================================
 	// Transport/Manager Instances
 	// ========================================
@@ -239,23 +339,11 @@ private:
 	/** Check if DMX interface supports RDM */
 	bool CheckRDMSupport() const;
 
-	/** Send RDM discovery packet */
-	bool SendRDMDiscoveryPacket(int32 Universe);
-
-	/** Receive RDM discovery response */
-	bool ReceiveRDMDiscoveryResponse(int32 Universe, TArray<FLBEASTDiscoveredFixture>& OutFixtures);
-
-	/** Send RDM GET request (query fixture parameter) */
-	bool SendRDMGetRequest(int32 Universe, const FString& RDMUID, int32 PID, TArray<uint8>& OutResponse);
-
-	/** Parse RDM response packet */
-	bool ParseRDMResponse(const TArray<uint8>& ResponseData, FLBEASTDiscoveredFixture& OutFixture);
-
-	/** Poll RDM fixtures for status updates */
-	void PollRDMFixtures(float DeltaTime);
+	/** Start RDM on the Art-Net manager and route its results here (Art-Net setup callback) */
+	void BindArtNetRDM();
 
-	/** Prune fixtures that haven't been seen (offline detection) */
-	void PruneOfflineFixtures();
+	/** A fixture was identified or re-polled: cache it, follow readdressing, auto-register */
+	void HandleRDMDeviceChanged(const FLBEASTDiscoveredFixture& Device);
 
 	// ========================================
 	// DMX Data Management
@@ -270,8 +358,8 @@ private:
 	/** Initialize DMX universe (set all channels to 0) */
 	void InitializeDMXUniverse(int32 Universe);
 
-	/** Send updated DMX data for a universe */
-	void FlushDMXUniverse(int32 Universe);
+	/** Send a universe's 512 channels to the active transport */
+	void FlushDMXUniverse(int32 Universe, const TArray<uint8>& UniverseData);
 
     // Fixture-level DMX helpers removed; use FixtureService APIs instead
 
@@ -9,6 +9,8 @@
 
 #include "ProLightingTypes.generated.h"
 
+class UTexture;
+
 /**
  * DMX Fixture Types
  */
@@ -53,6 +55,44 @@ struct PROLIGHTING_API FLBEASTDMXFixture
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "DMX Fixture|RDM")
 	bool bRDMCapable = false;
+
+	/** Groups this fixture belongs to (e.g. House, Stage) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "DMX Fixture|Grouping")
+	TArray<FName> Groups;
+
+	/** Free-form tags (e.g. Uplight, Wash) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "DMX Fixture|Grouping")
+	TArray<FName> Tags;
+
+	/** Venue zone (0 = none) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "DMX Fixture|Grouping", meta = (ClampMin = "0"))
+	int32 Zone = 0;
+};
+
+/**
+ * Selects registered fixtures by grouping; every criterion that is set must match
+ * e.g. "all house lights" = Groups {House}; "zone 3 uplights" = Zone 3, Tags {Uplight}
+ */
+USTRUCT(BlueprintType)
+struct PROLIGHTING_API FLBEASTFixtureQuery
+{
+	GENERATED_BODY()
+
+	/** In any of these groups (empty = any group) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fixture Query")
+	TArray<FName> Groups;
+
+	/** Has all of these tags */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fixture Query")
+	TArray<FName> Tags;
+
+	/** In this zone (0 = any zone) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fixture Query", meta = (ClampMin = "0"))
+	int32 Zone = 0;
+
+	/** On this universe (-1 = any universe) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fixture Query", meta = (ClampMin = "-1", ClampMax = "15"))
+	int32 Universe = -1;
 };
 
 /**
@@ -171,6 +211,22 @@ struct PROLIGHTING_API FLBEASTProLightingConfig
 	/** If true, only use RDM-capable fixtures (ignore non-RDM fixtures) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProLighting|RDM", meta = (EditCondition = "bEnableRDM"))
 	bool bRDMOnlyMode = false;
+
+	/** Register fixtures found by RDM as virtual fixtures as soon as they are identified (Art-Net) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProLighting|RDM", meta = (EditCondition = "bEnableRDM"))
+	bool bAutoRegisterRDMFixtures = true;
+
+	/** Answer RDM from an in-process simulated Art-Net node instead of the network (development/testing) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProLighting|RDM", AdvancedDisplay, meta = (EditCondition = "bEnableRDM"))
+	bool bSimulateRDMNode = false;
+
+	/** Fixtures on the simulated node */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProLighting|RDM", AdvancedDisplay, meta = (EditCondition = "bSimulateRDMNode", ClampMin = "1", ClampMax = "2000"))
+	int32 SimulatedRDMFixtureCount = 300;
+
+	/** Show file (patch and cues) loaded when the controller starts; relative to the project directory. Empty = patch at runtime. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ProLighting|Show File")
+	FString ShowFilePath;
 };
 
 /**
@@ -181,7 +237,7 @@ struct PROLIGHTING_API FLBEASTDiscoveredFixture
 {
 	GENERATED_BODY()
 
-	/** RDM Unique ID (64-bit, formatted as hex string like "0x12345678ABCDEF01") */
+	/** RDM Unique ID (48-bit, formatted manufacturer:device like "7FF0:12345678") */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RDM Fixture")
 	FString RDMUID;
 
@@ -217,6 +273,22 @@ struct PROLIGHTING_API FLBEASTDiscoveredFixture
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RDM Fixture")
 	ELBEASTDMXFixtureType FixtureType = ELBEASTDMXFixtureType::Dimmable;
 
+	/** User-assigned label (DEVICE_LABEL, empty if unsupported) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RDM Fixture")
+	FString DeviceLabel;
+
+	/** Lamp hours (-1 if the fixture does not report them) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "RDM Fixture")
+	int32 LampHours = -1;
+
+	/** Warnings and errors in the fixture's last STATUS_MESSAGES reply */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "RDM Fixture")
+	int32 StatusMessageCount = 0;
+
+	/** Art-Net node the fixture is cabled to */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "RDM Fixture")
+	FString NodeIPAddress;
+
 	/** Whether fixture is currently online (last RDM query succeeded) */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "RDM Fixture")
 	bool bIsOnline = true;
@@ -231,3 +303,116 @@ struct PROLIGHTING_API FLBEASTDiscoveredFixture
 };
 
 
+
+/**
+ * Lighting effect waveform
+ */
+UENUM(BlueprintType)
+enum class ELBEASTLightingWaveform : uint8
+{
+	Sine         UMETA(DisplayName = "Sine"),
+	Saw          UMETA(DisplayName = "Saw (ramp up)"),
+	Triangle     UMETA(DisplayName = "Triangle"),
+	/** On for Duty of each cycle - with PhaseSpread this is a classic chase */
+	Step         UMETA(DisplayName = "Step / Chase"),
+	/** Sample PixelSource at each fixture's PixelPosition */
+	PixelMap     UMETA(DisplayName = "Pixel Map")
+};
+
+/**
+ * What a lighting effect drives
+ */
+UENUM(BlueprintType)
+enum class ELBEASTLightingEffectTarget : uint8
+{
+	Intensity    UMETA(DisplayName = "Intensity"),
+	Color        UMETA(DisplayName = "Color")
+};
+
+/**
+ * How a lighting effect layer merges with what is below it
+ */
+UENUM(BlueprintType)
+enum class ELBEASTLightingMergeMode : uint8
+{
+	/** Highest takes precedence - the brighter value wins */
+	HTP          UMETA(DisplayName = "HTP (Highest Takes Precedence)"),
+	/** Latest takes precedence - replaces lower layers and manual levels */
+	LTP          UMETA(DisplayName = "LTP (Latest Takes Precedence)")
+};
+
+/**
+ * Parameterized lighting effect over a group of fixtures
+ *
+ * Played through UProLightingController::PlayEffect(). Each fixture gets its own phase
+ * (PhaseSpread cycles across the group, in FixtureIDs order), so one effect covers
+ * waves, rainbows and chases without per-fixture calls.
+ */
+USTRUCT(BlueprintType)
+struct PROLIGHTING_API FLBEASTLightingEffect
+{
+	GENERATED_BODY()
+
+	/** Fixtures in the effect, in phase order (unregistered IDs are skipped) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting Effect")
+	TArray<int32> FixtureIDs;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting Effect")
+	ELBEASTLightingEffectTarget Target = ELBEASTLightingEffectTarget::Intensity;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting Effect")
+	ELBEASTLightingWaveform Waveform = ELBEASTLightingWaveform::Sine;
+
+	/** Layer merge against lower layers and manual levels */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting Effect|Layering")
+	ELBEASTLightingMergeMode MergeMode = ELBEASTLightingMergeMode::HTP;
+
+	/** Higher priorities composite on top (equal priorities: the later-played effect is on top) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting Effect|Layering")
+	int32 Priority = 1;
+
+	/** Cycles per second (Pixel Map: horizontal scroll in texture widths per second) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting Effect")
+	float Rate = 1.0f;
+
+	/** Phase offset across the whole group in cycles (0 = all in unison, 1 = one wave travelling along the group in FixtureIDs order, negative = reverse) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting Effect")
+	float PhaseSpread = 1.0f;
+
+	/** Step only: fraction of each cycle that is on (1 / fixture count = one fixture at a time) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting Effect", meta = (ClampMin = "0.0", ClampMax = "1.0", EditCondition = "Waveform == ELBEASTLightingWaveform::Step"))
+	float Duty = 0.5f;
+
+	/** Intensity at the bottom of the wave */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting Effect|Intensity", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float Low = 0.0f;
+
+	/** Intensity at the top of the wave */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting Effect|Intensity", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float High = 1.0f;
+
+	/** Color at the bottom of the wave (A = white channel where the fixture has one; the color
+	 *  picker's default alpha of 1 means white at full) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting Effect|Color")
+	FLinearColor ColorA = FLinearColor(0.0f, 0.0f, 0.0f, 0.0f);
+
+	/** Color at the top of the wave (A = white channel, as for ColorA - alpha 1 means white at full) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting Effect|Color")
+	FLinearColor ColorB = FLinearColor(1.0f, 1.0f, 1.0f, 0.0f);
+
+	/** Color: the wave sweeps hue (full saturation) instead of blending ColorA -> ColorB - a rainbow */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting Effect|Color")
+	bool bHueCycle = false;
+
+	/** Effect level (scales intensity / color); change while playing with SetEffectMaster() */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting Effect", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float Master = 1.0f;
+
+	/** Pixel Map: texture or render target to sample (read back from the GPU every frame) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting Effect|Pixel Map", meta = (EditCondition = "Waveform == ELBEASTLightingWaveform::PixelMap"))
+	TObjectPtr<UTexture> PixelSource;
+
+	/** Pixel Map: UV (0-1) per fixture, parallel to FixtureIDs (empty = fixtures spread left to right across the middle row) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting Effect|Pixel Map", meta = (EditCondition = "Waveform == ELBEASTLightingWaveform::PixelMap"))
+	TArray<FVector2D> PixelPositions;
+};
@@ -17,28 +17,16 @@ public:
 
 	FRDMService() {}
 
-	void Initialize(float InPollIntervalSeconds)
-	{
-		PollInterval = FMath::Max(0.1f, InPollIntervalSeconds);
-		Accumulated = 0.0f;
-	}
-
-	void Tick(float DeltaTime)
-	{
-		Accumulated += DeltaTime;
-		if (Accumulated >= PollInterval)
-		{
-			Accumulated = 0.0f;
-			// Polling is driven externally (controller) for now; nothing here.
-		}
-	}
-
-	// Add or update a discovered fixture (returns true if new)
+	// Add or update a discovered fixture (returns true if new). Keeps the virtual fixture mapping and online state.
 	bool AddOrUpdate(const FLBEASTDiscoveredFixture& Fixture)
 	{
 		bool bIsNew = !Discovered.Contains(Fixture.RDMUID);
 		FLBEASTDiscoveredFixture& Entry = Discovered.FindOrAdd(Fixture.RDMUID);
+		const int32 VirtualFixtureID = bIsNew ? Fixture.VirtualFixtureID : Entry.VirtualFixtureID;
+		const bool bIsOnline = bIsNew ? Fixture.bIsOnline : Entry.bIsOnline;
 		Entry = Fixture;
+		Entry.VirtualFixtureID = VirtualFixtureID;
+		Entry.bIsOnline = bIsOnline;
 		Entry.LastSeenTimestamp = FDateTime::Now();
 		if (bIsNew)
 		{
@@ -61,6 +49,14 @@ public:
         return Discovered.Find(RDMUID);
     }
 
+	void SetVirtualFixtureID(const FString& RDMUID, int32 VirtualFixtureID)
+	{
+		if (FLBEASTDiscoveredFixture* P = Discovered.Find(RDMUID))
+		{
+			P->VirtualFixtureID = VirtualFixtureID;
+		}
+	}
+
 	TArray<FLBEASTDiscoveredFixture> GetAll() const
 	{
 		TArray<FLBEASTDiscoveredFixture> Arr; Discovered.GenerateValueArray(Arr); return Arr;
@@ -127,8 +123,6 @@ public:
 
 private:
 	TMap<FString, FLBEASTDiscoveredFixture> Discovered;
-	float PollInterval = 0.5f;
-	float Accumulated = 0.0f;
 	FOnDiscoveredNative OnDiscovered;
 	FOnWentOfflineNative OnWentOffline;
 	FOnCameOnlineNative OnCameOnline;
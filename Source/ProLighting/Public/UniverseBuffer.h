@@ -67,12 +67,33 @@ public:
 		return UniverseToData.Find(Universe);
 	}
 
+	/**
+	 * Writable 512-byte universe memory (or nullptr if missing), for batched fixture writes
+	 * Stays valid while the universe exists - adding other universes does not move it.
+	 */
+	uint8* GetUniverseData(int32 Universe)
+	{
+		TArray<uint8>* Data = UniverseToData.Find(Universe);
+		return Data ? Data->GetData() : nullptr;
+	}
+
 	/** Enumerate universes */
 	TArray<int32> GetUniverses() const
 	{
 		TArray<int32> Keys; UniverseToData.GetKeys(Keys); return Keys;
 	}
 
+	/** Visit every universe without building a key array (per-frame flush) */
+	void ForEachUniverse(TFunctionRef<void(int32, const TArray<uint8>&)> Visitor) const
+	{
+		for (const TPair<int32, TArray<uint8>>& Pair : UniverseToData)
+		{
+			Visitor(Pair.Key, Pair.Value);
+		}
+	}
+
+	int32 NumUniverses() const { return UniverseToData.Num(); }
+
 	/** Clear all universes */
 	void Reset() { UniverseToData.Reset(); }
 
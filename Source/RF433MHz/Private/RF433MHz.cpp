@@ -3,6 +3,7 @@
 #include "RF433MHz.h"
 
 DEFINE_LOG_CATEGORY(LogRF433MHz);
+LBEAST_DEFINE_TRACE_CHANNEL(LBEASTRF433MHzChannel);
 
 void FRF433MHzModule::StartupModule()
 {
@@ -4,6 +4,7 @@
 #include "RF433MHz.h"
 #include "I433MHzReceiver.h"
 #include "Generic433MHzReceiver.h"
+#include "Health/LBEASTDeviceHealth.h"
 #include "HAL/PlatformTime.h"
 #include "HAL/PlatformFilemanager.h"
 #include "Misc/FileHelper.h"
@@ -15,6 +16,8 @@
 #include "Serialization/JsonWriter.h"
 #include "Serialization/JsonReader.h"
 
+DECLARE_CYCLE_STAT(TEXT("RF433MHzReceiver Tick"), STAT_RF433MHzReceiver_Tick, STATGROUP_LBEASTRF433MHz);
+
 URF433MHzReceiver::URF433MHzReceiver(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -49,6 +52,10 @@ void URF433MHzReceiver::EndPlay(const EEndPlayReason::Type EndPlayReason)
 void URF433MHzReceiver::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	RF433MHZ_SCOPE_CYCLE_COUNTER(STAT_RF433MHzReceiver_Tick);
+
+	// Remotes only transmit on button presses, so the dongle link is the liveness signal
+	FLBEASTDeviceHealthRegistry::Get().SetLinkUp(HealthHandle, ReceiverImpl && ReceiverImpl->IsConnected());
 
 	if (!ReceiverImpl || !ReceiverImpl->IsConnected())
 	{
@@ -65,6 +72,7 @@ void URF433MHzReceiver::TickComponent(float DeltaTime, ELevelTick TickType, FAct
 	TArray<FRF433MHzButtonEvent> Events;
 	if (ReceiverImpl->GetButtonEvents(Events))
 	{
+		FLBEASTDeviceHealthRegistry::Get().ReportPacket(HealthHandle);
 		ProcessButtonEvents(Events);
 	}
 }
@@ -93,6 +101,11 @@ bool URF433MHzReceiver::InitializeReceiver(const FRF433MHzReceiverConfig& InConf
 	UE_LOG(LogRF433MHz, Log, TEXT("RF433MHzReceiver: Initialized (Type: %d, Device: %s)"), 
 		(uint8)Config.ReceiverType, *Config.USBDevicePath);
 
+	FLBEASTDeviceHealthConfig HealthConfig;
+	HealthConfig.TimeoutSeconds = 0.0f;
+	FLBEASTDeviceHealthRegistry::Get().UnregisterDevice(HealthHandle);
+	HealthHandle = FLBEASTDeviceHealthRegistry::Get().RegisterDevice(FString::Printf(TEXT("RF433 %s"), *Config.USBDevicePath), TEXT("rf433"), HealthConfig);
+
 	return true;
 }
 
@@ -104,6 +117,9 @@ void URF433MHzReceiver::ShutdownReceiver()
 		ReceiverImpl.Reset();
 		UE_LOG(LogRF433MHz, Log, TEXT("RF433MHzReceiver: Shutdown"));
 	}
+
+	FLBEASTDeviceHealthRegistry::Get().UnregisterDevice(HealthHandle);
+	HealthHandle = -1;
 }
 
 bool URF433MHzReceiver::IsConnected() const
@@ -4,9 +4,18 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "LBEASTStats.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogRF433MHz, Log, All);
 
+/** Stats group ("stat LBEASTRF433MHz") and Unreal Insights channel for this module (see LBEASTStats.h) */
+DECLARE_STATS_GROUP(TEXT("LBEAST RF433MHz"), STATGROUP_LBEASTRF433MHz, STATCAT_Advanced);
+LBEAST_DECLARE_TRACE_CHANNEL(LBEASTRF433MHzChannel, RF433MHZ_API);
+
+#define RF433MHZ_SCOPE_CYCLE_COUNTER(StatId) LBEAST_SCOPE_CYCLE_COUNTER(StatId, "RF433MHz", LBEASTRF433MHzChannel)
+#define RF433MHZ_INC_COUNTER(StatId, Amount) LBEAST_INC_COUNTER(StatId, "RF433MHz", Amount)
+#define RF433MHZ_SET_GAUGE(StatId, Value) LBEAST_SET_GAUGE(StatId, "RF433MHz", Value)
+
 /**
  * RF433MHz Module
  * 
@@ -251,6 +251,9 @@ private:
 	/** Receiver implementation (polymorphic) */
 	TUniquePtr<I433MHzReceiver> ReceiverImpl;
 
+	/** Device health registration for the USB dongle (-1 = not initialized) */
+	int32 HealthHandle = -1;
+
 	/** Last received button states (for detecting press/release) */
 	TMap<int32, bool> LastButtonStates;
 
@@ -14,6 +14,13 @@
 #include "Common/TcpSocketBuilder.h"
 #include "Serialization/ArrayReader.h"
 #include "Serialization/ArrayWriter.h"
+#include "Networking/LBEASTIOReactor.h"
+#include "Async/Async.h"
+#include "TimerManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Handle Webhook Request"), STAT_Retail_HandleWebhook, STATGROUP_LBEASTRetail);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Webhook Requests"), STAT_Retail_WebhookRequests, STATGROUP_LBEASTRetail);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Webhook Bytes Received"), STAT_Retail_WebhookBytes, STATGROUP_LBEASTRetail);
 
 AArcadePaymentManager::AArcadePaymentManager(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -42,6 +49,21 @@ void AArcadePaymentManager::BeginPlay()
 void AArcadePaymentManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	bIsServerRunning = false;
+
+	// Reactor path: the reactor must stop reading the sockets before they are destroyed
+	GetWorldTimerManager().ClearTimer(WebhookExpiryTimer);
+	while (WebhookClients.Num() > 0)
+	{
+		CloseWebhookClient(WebhookClients.Num() - 1);
+	}
+	if (ListenReactorHandle >= 0)
+	{
+		if (ULBEASTIOReactorSubsystem* Reactor = IOReactor.Get())
+		{
+			Reactor->Unregister(ListenReactorHandle);
+		}
+		ListenReactorHandle = -1;
+	}
 	
 	// Stop server thread
 	if (ServerThread)
@@ -100,6 +122,22 @@ void AArcadePaymentManager::StartWebhookServer()
 
 	bIsServerRunning = true;
 
+	// Prefer the I/O reactor: accepts and reads happen on the game thread only when a socket is readable
+	if (ULBEASTIOReactorSubsystem* Reactor = ULBEASTIOReactorSubsystem::Get(this))
+	{
+		ListenSocket->SetNonBlocking(true);
+		ListenReactorHandle = Reactor->RegisterReadableSocket(ListenSocket,
+			FOnLBEASTIOReadable::CreateUObject(this, &AArcadePaymentManager::AcceptWebhookConnections), TEXT("PaymentWebhook"));
+		if (ListenReactorHandle >= 0)
+		{
+			IOReactor = Reactor;
+			GetWorldTimerManager().SetTimer(WebhookExpiryTimer, this, &AArcadePaymentManager::ExpireWebhookClients, 1.0f, true);
+			UE_LOG(LogRetail, Log, TEXT("[Payment] Webhook server started on %s:%d/%s (I/O reactor)"), 
+				*GetLocalIP(), WebhookPort, *GetWebhookPath());
+			return;
+		}
+	}
+
 	// Start background thread to accept connections
 	// Create a simple runnable that processes webhook connections
 	class FWebhookServerRunnable : public FRunnable
@@ -376,6 +414,10 @@ void AArcadePaymentManager::ProcessWebhookConnections()
 			
 			if (ClientSocket)
 			{
+				// Runs on the webhook thread; the registry and Insights are thread-safe
+				RETAIL_SCOPE_CYCLE_COUNTER(STAT_Retail_HandleWebhook);
+				RETAIL_INC_COUNTER(STAT_Retail_WebhookRequests, 1);
+
 				// Set socket to blocking for reading
 				ClientSocket->SetNonBlocking(false);
 				
@@ -390,6 +432,7 @@ void AArcadePaymentManager::ProcessWebhookConnections()
 					if (ClientSocket->Recv(RequestData.GetData(), RequestData.Num(), DataSize))
 					{
 						RequestData.SetNum(DataSize);
+						RETAIL_INC_COUNTER(STAT_Retail_WebhookBytes, DataSize);
 					}
 					else
 					{
@@ -398,38 +441,7 @@ void AArcadePaymentManager::ProcessWebhookConnections()
 					
 					if (DataSize > 0)
 					{
-						FString Method, Path, Body;
-						if (ParseHTTPRequest(RequestData, Method, Path, Body))
-						{
-							// Check if this is a POST to our webhook path
-							if (Method == TEXT("POST") && Path.Contains(GetWebhookPath()))
-							{
-								// Parse JSON payload
-								TSharedPtr<FJsonObject> JsonObject;
-								TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Body);
-								
-								if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid())
-								{
-									FString CardId = JsonObject->GetStringField(TEXT("cardId"));
-									float Amount = JsonObject->GetNumberField(TEXT("amount"));
-									float NewBalance = JsonObject->GetNumberField(TEXT("newBalance"));
-
-									// Process on game thread
-									AsyncTask(ENamedThreads::GameThread, [this, CardId, NewBalance]()
-									{
-										StartSession(CardId, NewBalance);
-									});
-								}
-							}
-							
-							// Send HTTP 200 OK response
-							SendHTTPResponse(ClientSocket, 200, TEXT("OK"));
-						}
-						else
-						{
-							// Send HTTP 400 Bad Request
-							SendHTTPResponse(ClientSocket, 400, TEXT("Bad Request"));
-						}
+						HandleWebhookRequest(ClientSocket, RequestData);
 					}
 				}
 				
@@ -444,6 +456,189 @@ void AArcadePaymentManager::ProcessWebhookConnections()
 	}
 }
 
+void AArcadePaymentManager::AcceptWebhookConnections()
+{
+	bool bHasPendingConnection = false;
+	while (ListenSocket && ListenSocket->HasPendingConnection(bHasPendingConnection) && bHasPendingConnection)
+	{
+		TSharedRef<FInternetAddr> ClientAddr = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
+		FSocket* ClientSocket = ListenSocket->Accept(*ClientAddr, TEXT("PaymentWebhookClient"));
+		if (!ClientSocket)
+		{
+			break;
+		}
+
+		ClientSocket->SetNonBlocking(true);
+
+		FArcadeWebhookClient& Client = WebhookClients.AddDefaulted_GetRef();
+		Client.Socket = ClientSocket;
+		Client.AcceptTimeSeconds = FPlatformTime::Seconds();
+		if (ULBEASTIOReactorSubsystem* Reactor = IOReactor.Get())
+		{
+			Client.ReactorHandle = Reactor->RegisterReadableSocket(ClientSocket,
+				FOnLBEASTIOReadable::CreateUObject(this, &AArcadePaymentManager::ReadWebhookClient, ClientSocket), TEXT("PaymentWebhookClient"));
+		}
+		if (Client.ReactorHandle < 0)
+		{
+			CloseWebhookClient(WebhookClients.Num() - 1);
+		}
+	}
+}
+
+void AArcadePaymentManager::ReadWebhookClient(FSocket* ClientSocket)
+{
+	const int32 ClientIndex = WebhookClients.IndexOfByPredicate([ClientSocket](const FArcadeWebhookClient& Client) { return Client.Socket == ClientSocket; });
+	if (ClientIndex == INDEX_NONE)
+	{
+		return;
+	}
+	FArcadeWebhookClient& Client = WebhookClients[ClientIndex];
+
+	// Drain what has arrived; Recv succeeds with 0 bytes when it would block and fails once the peer closed
+	uint8 Buffer[4096];
+	int32 BytesRead = 0;
+	bool bPeerClosed = false;
+	for (;;)
+	{
+		if (!Client.Socket->Recv(Buffer, sizeof(Buffer), BytesRead))
+		{
+			bPeerClosed = true;
+			break;
+		}
+		if (BytesRead <= 0)
+		{
+			break;
+		}
+		Client.Data.Append(Buffer, BytesRead);
+		RETAIL_INC_COUNTER(STAT_Retail_WebhookBytes, BytesRead);
+		if (Client.Data.Num() > MaxWebhookRequestBytes)
+		{
+			UE_LOG(LogRetail, Warning, TEXT("[Payment] Webhook request exceeds %d bytes, dropping connection"), MaxWebhookRequestBytes);
+			SendHTTPResponse(Client.Socket, 400, TEXT("Bad Request"));
+			CloseWebhookClient(ClientIndex);
+			return;
+		}
+	}
+
+	if (IsHTTPRequestComplete(Client.Data))
+	{
+		RETAIL_SCOPE_CYCLE_COUNTER(STAT_Retail_HandleWebhook);
+		RETAIL_INC_COUNTER(STAT_Retail_WebhookRequests, 1);
+		HandleWebhookRequest(Client.Socket, Client.Data);
+		CloseWebhookClient(ClientIndex);
+	}
+	else if (bPeerClosed)
+	{
+		CloseWebhookClient(ClientIndex);
+	}
+}
+
+void AArcadePaymentManager::ExpireWebhookClients()
+{
+	const double Now = FPlatformTime::Seconds();
+	for (int32 i = WebhookClients.Num() - 1; i >= 0; i--)
+	{
+		if (Now - WebhookClients[i].AcceptTimeSeconds > WebhookClientTimeoutSeconds)
+		{
+			UE_LOG(LogRetail, Verbose, TEXT("[Payment] Webhook client timed out after %d bytes"), WebhookClients[i].Data.Num());
+			CloseWebhookClient(i);
+		}
+	}
+}
+
+void AArcadePaymentManager::CloseWebhookClient(int32 ClientIndex)
+{
+	FArcadeWebhookClient& Client = WebhookClients[ClientIndex];
+	if (Client.ReactorHandle >= 0)
+	{
+		if (ULBEASTIOReactorSubsystem* Reactor = IOReactor.Get())
+		{
+			Reactor->Unregister(Client.ReactorHandle);
+		}
+	}
+	if (Client.Socket)
+	{
+		Client.Socket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Client.Socket);
+	}
+	WebhookClients.RemoveAtSwap(ClientIndex);
+}
+
+bool AArcadePaymentManager::IsHTTPRequestComplete(const TArray<uint8>& Data)
+{
+	// Locate the end of the headers
+	int32 HeaderEnd = INDEX_NONE;
+	for (int32 i = 0; i + 3 < Data.Num(); i++)
+	{
+		if (Data[i] == '\r' && Data[i + 1] == '\n' && Data[i + 2] == '\r' && Data[i + 3] == '\n')
+		{
+			HeaderEnd = i + 4;
+			break;
+		}
+	}
+	if (HeaderEnd == INDEX_NONE)
+	{
+		return false;
+	}
+
+	// Without Content-Length the request has no body
+	const FString Headers(HeaderEnd, reinterpret_cast<const ANSICHAR*>(Data.GetData()));
+	TArray<FString> Lines;
+	Headers.ParseIntoArrayLines(Lines);
+	int32 ContentLength = 0;
+	for (const FString& Line : Lines)
+	{
+		if (Line.StartsWith(TEXT("Content-Length:"), ESearchCase::IgnoreCase))
+		{
+			ContentLength = FCString::Atoi(*Line.Mid(15).TrimStartAndEnd());
+			break;
+		}
+	}
+
+	return Data.Num() - HeaderEnd >= ContentLength;
+}
+
+void AArcadePaymentManager::HandleWebhookRequest(FSocket* ClientSocket, const TArray<uint8>& RequestData)
+{
+	FString Method, Path, Body;
+	if (!ParseHTTPRequest(RequestData, Method, Path, Body))
+	{
+		// Send HTTP 400 Bad Request
+		SendHTTPResponse(ClientSocket, 400, TEXT("Bad Request"));
+		return;
+	}
+
+	// Check if this is a POST to our webhook path
+	if (Method == TEXT("POST") && Path.Contains(GetWebhookPath()))
+	{
+		// Parse JSON payload
+		TSharedPtr<FJsonObject> JsonObject;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Body);
+		
+		if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid())
+		{
+			FString CardId = JsonObject->GetStringField(TEXT("cardId"));
+			float NewBalance = JsonObject->GetNumberField(TEXT("newBalance"));
+
+			// The reactor path is already on the game thread; the server thread fallback is not
+			if (IsInGameThread())
+			{
+				StartSession(CardId, NewBalance);
+			}
+			else
+			{
+				AsyncTask(ENamedThreads::GameThread, [this, CardId, NewBalance]()
+				{
+					StartSession(CardId, NewBalance);
+				});
+			}
+		}
+	}
+	
+	// Send HTTP 200 OK response
+	SendHTTPResponse(ClientSocket, 200, TEXT("OK"));
+}
+
 bool AArcadePaymentManager::ParseHTTPRequest(const TArray<uint8>& Data, FString& OutMethod, FString& OutPath, FString& OutBody)
 {
 	if (Data.Num() == 0)
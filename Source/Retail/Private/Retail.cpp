@@ -3,6 +3,7 @@
 #include "Retail.h"
 
 DEFINE_LOG_CATEGORY(LogRetail);
+LBEAST_DEFINE_TRACE_CHANNEL(LBEASTRetailChannel);
 
 void FRetailModule::StartupModule()
 {
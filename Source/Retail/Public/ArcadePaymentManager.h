@@ -11,6 +11,20 @@
 #include "Retail.h"
 #include "ArcadePaymentManager.generated.h"
 
+class FSocket;
+class ULBEASTIOReactorSubsystem;
+
+/**
+ * Webhook connection being read by the I/O reactor path (request bytes arrive across frames)
+ */
+struct FArcadeWebhookClient
+{
+	FSocket* Socket = nullptr;
+	int32 ReactorHandle = -1;
+	TArray<uint8> Data;
+	double AcceptTimeSeconds = 0.0;
+};
+
 /**
  * Payment Provider Types
  */
@@ -103,12 +117,40 @@ private:
 	/** TCP listen socket for webhook server */
 	FSocket* ListenSocket = nullptr;
 
-	/** Background thread for accepting connections */
+	/** Background thread for accepting connections (only when no I/O reactor is available) */
 	FRunnableThread* ServerThread = nullptr;
 
-	/** Process incoming HTTP connections */
+	/** I/O reactor registration for ListenSocket; clients are registered individually */
+	TWeakObjectPtr<ULBEASTIOReactorSubsystem> IOReactor;
+	int32 ListenReactorHandle = -1;
+	TArray<FArcadeWebhookClient> WebhookClients;
+	FTimerHandle WebhookExpiryTimer;
+
+	/** Seconds a reactor-path client may take to deliver its full request before it is dropped */
+	static constexpr double WebhookClientTimeoutSeconds = 5.0;
+
+	/** Cap on buffered request size (headers + body) */
+	static constexpr int32 MaxWebhookRequestBytes = 64 * 1024;
+
+	/** Process incoming HTTP connections (server thread fallback; blocking reads) */
 	void ProcessWebhookConnections();
 
+	/** I/O reactor callbacks (game thread): accept pending connections / read a client without blocking */
+	void AcceptWebhookConnections();
+	void ReadWebhookClient(FSocket* ClientSocket);
+
+	/** Close reactor-path clients that have not delivered a full request in time */
+	void ExpireWebhookClients();
+
+	/** Unregister and destroy one reactor-path client */
+	void CloseWebhookClient(int32 ClientIndex);
+
+	/** Whether Data holds a complete request (headers plus Content-Length bytes of body) */
+	static bool IsHTTPRequestComplete(const TArray<uint8>& Data);
+
+	/** Parse a complete request, start the session if it is a payment webhook and send the response */
+	void HandleWebhookRequest(FSocket* ClientSocket, const TArray<uint8>& RequestData);
+
 	/** Parse HTTP request from raw data */
 	bool ParseHTTPRequest(const TArray<uint8>& Data, FString& OutMethod, FString& OutPath, FString& OutBody);
 
@@ -4,9 +4,18 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "LBEASTStats.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogRetail, Log, All);
 
+/** Stats group ("stat LBEASTRetail") and Unreal Insights channel for this module (see LBEASTStats.h) */
+DECLARE_STATS_GROUP(TEXT("LBEAST Retail"), STATGROUP_LBEASTRetail, STATCAT_Advanced);
+LBEAST_DECLARE_TRACE_CHANNEL(LBEASTRetailChannel, RETAIL_API);
+
+#define RETAIL_SCOPE_CYCLE_COUNTER(StatId) LBEAST_SCOPE_CYCLE_COUNTER(StatId, "Retail", LBEASTRetailChannel)
+#define RETAIL_INC_COUNTER(StatId, Amount) LBEAST_INC_COUNTER(StatId, "Retail", Amount)
+#define RETAIL_SET_GAUGE(StatId, Value) LBEAST_SET_GAUGE(StatId, "Retail", Value)
+
 class FRetailModule : public IModuleInterface
 {
 public:
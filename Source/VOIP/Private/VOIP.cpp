@@ -3,6 +3,7 @@
 #include "VOIP.h"
 
 DEFINE_LOG_CATEGORY(LogVOIP);
+LBEAST_DEFINE_TRACE_CHANNEL(LBEASTVOIPChannel);
 
 #define LOCTEXT_NAMESPACE "FVOIPModule"
 
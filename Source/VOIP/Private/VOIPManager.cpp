@@ -9,6 +9,8 @@
 #include "GameFramework/PlayerState.h"
 #include "Engine/World.h"
 
+DECLARE_CYCLE_STAT(TEXT("VOIPManager Tick"), STAT_VOIPManager_Tick, STATGROUP_LBEASTVOIP);
+
 UVOIPManager::UVOIPManager(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -81,6 +83,7 @@ void UVOIPManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 void UVOIPManager::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	VOIP_SCOPE_CYCLE_COUNTER(STAT_VOIPManager_Tick);
 
 	// Update audio source positions
 	if (ConnectionState == EVOIPConnectionState::Connected)
@@ -4,9 +4,18 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "LBEASTStats.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogVOIP, Log, All);
 
+/** Stats group ("stat LBEASTVOIP") and Unreal Insights channel for this module (see LBEASTStats.h) */
+DECLARE_STATS_GROUP(TEXT("LBEAST VOIP"), STATGROUP_LBEASTVOIP, STATCAT_Advanced);
+LBEAST_DECLARE_TRACE_CHANNEL(LBEASTVOIPChannel, VOIP_API);
+
+#define VOIP_SCOPE_CYCLE_COUNTER(StatId) LBEAST_SCOPE_CYCLE_COUNTER(StatId, "VOIP", LBEASTVOIPChannel)
+#define VOIP_INC_COUNTER(StatId, Amount) LBEAST_INC_COUNTER(StatId, "VOIP", Amount)
+#define VOIP_SET_GAUGE(StatId, Value) LBEAST_SET_GAUGE(StatId, "VOIP", Value)
+
 /**
  * LBEAST VOIP Module
  * 